@@ -403,6 +403,52 @@ LSP_DSP_LIB_SYMBOL(void, apply_matrix3d_mm2, LSP_DSP_LIB_TYPE(matrix3d_t) *r, co
  */
 LSP_DSP_LIB_SYMBOL(void, apply_matrix3d_mm1, LSP_DSP_LIB_TYPE(matrix3d_t) *r, const LSP_DSP_LIB_TYPE(matrix3d_t) *m);
 
+/** Apply matrix to array of vectors, the result is the same as calling apply_matrix3d_mv2()
+ * for each vector. The target and source arrays may be the same.
+ *
+ * @param r array of target vectors
+ * @param v array of source vectors
+ * @param m matrix
+ * @param n number of vectors
+ */
+LSP_DSP_LIB_SYMBOL(void, apply_matrix3d_mvn, LSP_DSP_LIB_TYPE(vector3d_t) *r, const LSP_DSP_LIB_TYPE(vector3d_t) *v, const LSP_DSP_LIB_TYPE(matrix3d_t) *m, size_t n);
+
+/** Apply matrix to array of points, the result is the same as calling apply_matrix3d_mp2()
+ * for each point. The target and source arrays may be the same.
+ *
+ * @param r array of target points
+ * @param p array of source points
+ * @param m matrix
+ * @param n number of points
+ */
+LSP_DSP_LIB_SYMBOL(void, apply_matrix3d_mpn, LSP_DSP_LIB_TYPE(point3d_t) *r, const LSP_DSP_LIB_TYPE(point3d_t) *p, const LSP_DSP_LIB_TYPE(matrix3d_t) *m, size_t n);
+
+/** Apply matrix to vectors stored as structure of arrays (dw = 0 for each vector).
+ * The result is homogenized and only dx, dy and dz components are stored.
+ * The target and source arrays may be the same.
+ *
+ * @param dst target vectors
+ * @param src source vectors
+ * @param m matrix
+ * @param n number of vectors
+ */
+LSP_DSP_LIB_SYMBOL(void, apply_matrix3d_mv_soa,
+        LSP_DSP_LIB_TYPE(vector3d_soa_t) *dst, const LSP_DSP_LIB_TYPE(vector3d_soa_t) *src,
+        const LSP_DSP_LIB_TYPE(matrix3d_t) *m, size_t n);
+
+/** Apply matrix to points stored as structure of arrays (w = 1 for each point).
+ * The result is homogenized and only x, y and z components are stored.
+ * The target and source arrays may be the same.
+ *
+ * @param dst target points
+ * @param src source points
+ * @param m matrix
+ * @param n number of points
+ */
+LSP_DSP_LIB_SYMBOL(void, apply_matrix3d_mp_soa,
+        LSP_DSP_LIB_TYPE(point3d_soa_t) *dst, const LSP_DSP_LIB_TYPE(point3d_soa_t) *src,
+        const LSP_DSP_LIB_TYPE(matrix3d_t) *m, size_t n);
+
 /** Transpose matrix
  *
  * @param r target matrix
@@ -855,6 +901,17 @@ LSP_DSP_LIB_SYMBOL(void, add_vector_pvk2, LSP_DSP_LIB_TYPE(point3d_t) *p, const
  */
 LSP_DSP_LIB_SYMBOL(void, calc_bound_box, LSP_DSP_LIB_TYPE(bound_box3d_t) *b, const LSP_DSP_LIB_TYPE(point3d_t) *p, size_t n);
 
+/**
+ * Apply matrix to array of points and compute bounding box around the transformed points
+ * in one pass, the result is the same as calling apply_matrix3d_mpn() and calc_bound_box()
+ * @param b bounding box object
+ * @param r array of target points, may be the same as the source array
+ * @param p array of source points
+ * @param m matrix
+ * @param n number of points
+ */
+LSP_DSP_LIB_SYMBOL(void, apply_matrix3d_mpn_bound_box, LSP_DSP_LIB_TYPE(bound_box3d_t) *b, LSP_DSP_LIB_TYPE(point3d_t) *r, const LSP_DSP_LIB_TYPE(point3d_t) *p, const LSP_DSP_LIB_TYPE(matrix3d_t) *m, size_t n);
+
 /**
  * Compute plane equation using three points
  * @param v pointer to store plane equation
@@ -1211,4 +1268,134 @@ LSP_DSP_LIB_SYMBOL(void, unit_vector_p1p3, LSP_DSP_LIB_TYPE(vector3d_t) *v, cons
  */
 LSP_DSP_LIB_SYMBOL(void, unit_vector_p1pv, LSP_DSP_LIB_TYPE(vector3d_t) *v, const LSP_DSP_LIB_TYPE(point3d_t) *sp, const LSP_DSP_LIB_TYPE(point3d_t) *pv);
 
+/** Convert array of points to structure of arrays, the w component is dropped
+ *
+ * @param dst structure of arrays to store coordinates
+ * @param src array of points
+ * @param n number of points
+ */
+LSP_DSP_LIB_SYMBOL(void, points3d_to_soa, const LSP_DSP_LIB_TYPE(point3d_soa_t) *dst, const LSP_DSP_LIB_TYPE(point3d_t) *src, size_t n);
+
+/** Convert structure of arrays to array of points, the w component is set to 1
+ *
+ * @param dst array of points to store result
+ * @param src structure of arrays with coordinates
+ * @param n number of points
+ */
+LSP_DSP_LIB_SYMBOL(void, points3d_from_soa, LSP_DSP_LIB_TYPE(point3d_t) *dst, const LSP_DSP_LIB_TYPE(point3d_soa_t) *src, size_t n);
+
+/** Convert array of raw triangles to structure of arrays, the w component of each vertex is dropped
+ *
+ * @param dst structure of arrays to store vertexes
+ * @param src array of triangles
+ * @param n number of triangles
+ */
+LSP_DSP_LIB_SYMBOL(void, raw_triangles_to_soa, const LSP_DSP_LIB_TYPE(raw_triangle_soa_t) *dst, const LSP_DSP_LIB_TYPE(raw_triangle_t) *src, size_t n);
+
+/** Convert structure of arrays to array of raw triangles, the w component of each vertex is set to 1
+ *
+ * @param dst array of triangles to store result
+ * @param src structure of arrays with vertexes
+ * @param n number of triangles
+ */
+LSP_DSP_LIB_SYMBOL(void, raw_triangles_from_soa, LSP_DSP_LIB_TYPE(raw_triangle_t) *dst, const LSP_DSP_LIB_TYPE(raw_triangle_soa_t) *src, size_t n);
+
+/** Calculate distances between pairs of points stored as structure of arrays,
+ * the same as calc_distance_p2() for each pair
+ *
+ * @param dst array to store distances
+ * @param p1 first points
+ * @param p2 second points
+ * @param n number of pairs
+ */
+LSP_DSP_LIB_SYMBOL(void, calc_distance_soa, float *dst, const LSP_DSP_LIB_TYPE(point3d_soa_t) *p1, const LSP_DSP_LIB_TYPE(point3d_soa_t) *p2, size_t n);
+
+/** Calculate areas of triangles stored as structure of arrays, the same as calc_area_pv()
+ * for each triangle
+ *
+ * @param dst array to store areas
+ * @param t triangles
+ * @param n number of triangles
+ */
+LSP_DSP_LIB_SYMBOL(void, calc_area_soa, float *dst, const LSP_DSP_LIB_TYPE(raw_triangle_soa_t) *t, size_t n);
+
+/** Calculate normals of triangles stored as structure of arrays, the same as calc_normal3d_pv()
+ * for each triangle
+ *
+ * @param dst structure of arrays to store normals
+ * @param t triangles
+ * @param n number of triangles
+ */
+LSP_DSP_LIB_SYMBOL(void, calc_normal3d_soa, LSP_DSP_LIB_TYPE(vector3d_soa_t) *dst, const LSP_DSP_LIB_TYPE(raw_triangle_soa_t) *t, size_t n);
+
+/**
+ * Check colocation of a plane and triangles stored as structure of arrays, the same as
+ * colocation_x3_v1pv() for each triangle
+ *
+ * @param dst array to store bit masks, see colocation_x3_v1pv() for the description
+ * @param pl vector that contains plane equation
+ * @param t triangles
+ * @param n number of triangles
+ */
+LSP_DSP_LIB_SYMBOL(void, colocation_x3_v1_soa, uint32_t *dst, const LSP_DSP_LIB_TYPE(vector3d_t) *pl, const LSP_DSP_LIB_TYPE(raw_triangle_soa_t) *t, size_t n);
+
+/** Calculate distances from the source point to each point of the array,
+ * the same as calc_distance_p2() for each point
+ *
+ * @param dst array to store distances
+ * @param sp source point
+ * @param p array of points
+ * @param n number of points
+ */
+LSP_DSP_LIB_SYMBOL(void, calc_distance_p1n, float *dst, const LSP_DSP_LIB_TYPE(point3d_t) *sp, const LSP_DSP_LIB_TYPE(point3d_t) *p, size_t n);
+
+/** Calculate squares of distances from the source point to each point of the array,
+ * the same as calc_sqr_distance_p2() for each point
+ *
+ * @param dst array to store squares of distances
+ * @param sp source point
+ * @param p array of points
+ * @param n number of points
+ */
+LSP_DSP_LIB_SYMBOL(void, calc_sqr_distance_p1n, float *dst, const LSP_DSP_LIB_TYPE(point3d_t) *sp, const LSP_DSP_LIB_TYPE(point3d_t) *p, size_t n);
+
+/** Estimate the average distance from the source point to each triangle,
+ * the same as calc_avg_distance_p3() for each triangle
+ *
+ * @param dst array to store distances
+ * @param sp source point
+ * @param pv array of 3*n points, each three points form a triangle
+ * @param n number of triangles
+ */
+LSP_DSP_LIB_SYMBOL(void, calc_avg_distance_pvn, float *dst, const LSP_DSP_LIB_TYPE(point3d_t) *sp, const LSP_DSP_LIB_TYPE(point3d_t) *pv, size_t n);
+
+/** Compute unit vectors from the source point to the center of each triangle,
+ * the same as unit_vector_p1pv() for each triangle
+ *
+ * @param v array to store vectors
+ * @param sp source point
+ * @param pv array of 3*n points, each three points form a triangle
+ * @param n number of triangles
+ */
+LSP_DSP_LIB_SYMBOL(void, unit_vector_p1pvn, LSP_DSP_LIB_TYPE(vector3d_t) *v, const LSP_DSP_LIB_TYPE(point3d_t) *sp, const LSP_DSP_LIB_TYPE(point3d_t) *pv, size_t n);
+
+/** Compute plane equations of triangles so the orienting point is always 'below' each plane,
+ * the same as calc_oriented_plane_pv() for each triangle
+ *
+ * @param v array to store plane equations
+ * @param sp orienting point
+ * @param pv array of 3*n points, each three points form a triangle
+ * @param n number of triangles
+ */
+LSP_DSP_LIB_SYMBOL(void, calc_oriented_plane_pvn, LSP_DSP_LIB_TYPE(vector3d_t) *v, const LSP_DSP_LIB_TYPE(point3d_t) *sp, const LSP_DSP_LIB_TYPE(point3d_t) *pv, size_t n);
+
+/** Compute vector multiplication of pairs of vectors, the same as vector_mul_v2() for each pair
+ *
+ * @param r array to store result
+ * @param v1 first vectors
+ * @param v2 second vectors
+ * @param n number of pairs
+ */
+LSP_DSP_LIB_SYMBOL(void, vector_mul_v2n, LSP_DSP_LIB_TYPE(vector3d_t) *r, const LSP_DSP_LIB_TYPE(vector3d_t) *v1, const LSP_DSP_LIB_TYPE(vector3d_t) *v2, size_t n);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_3DMATH_H_ */
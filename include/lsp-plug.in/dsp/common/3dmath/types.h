@@ -86,6 +86,30 @@ namespace lsp
 
     #pragma pack(pop)
 
+        /* Structure-of-arrays containers, they do not own the memory and just refer to
+         * the arrays of coordinates provided by the caller. Each array should hold enough
+         * elements for the operation. The w component of each point is implied to be 1,
+         * the dw component of each vector is implied to be 0.
+         */
+        typedef struct LSP_DSP_LIB_TYPE(point3d_soa_t)
+        {
+            float      *x;          // Array of X coordinates
+            float      *y;          // Array of Y coordinates
+            float      *z;          // Array of Z coordinates
+        } LSP_DSP_LIB_TYPE(point3d_soa_t);
+
+        typedef struct LSP_DSP_LIB_TYPE(vector3d_soa_t)
+        {
+            float      *dx;         // Array of X coordinates
+            float      *dy;         // Array of Y coordinates
+            float      *dz;         // Array of Z coordinates
+        } LSP_DSP_LIB_TYPE(vector3d_soa_t);
+
+        typedef struct LSP_DSP_LIB_TYPE(raw_triangle_soa_t)
+        {
+            LSP_DSP_LIB_TYPE(point3d_soa_t) v[3];   // Arrays of vertexes
+        } LSP_DSP_LIB_TYPE(raw_triangle_soa_t);
+
         typedef enum LSP_DSP_LIB_TYPE(axis_orientation_t)
         {
             AO3D_POS_X_FWD_POS_Y_UP,
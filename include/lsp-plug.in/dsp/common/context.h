@@ -50,6 +50,17 @@ namespace lsp
             const char     *features;   /* CPU features */
         } LSP_DSP_LIB_TYPE(info_t);
 
+        /**
+         * Flags that describe the denormal handling state of the FPU
+         */
+        typedef enum LSP_DSP_LIB_TYPE(denormal_flags_t)
+        {
+            DENORMAL_FTZ        = 1 << 0,   /* Denormal results are flushed to zero */
+            DENORMAL_DAZ        = 1 << 1,   /* Denormal inputs are treated as zeros */
+            DENORMAL_INPUT      = 1 << 2,   /* Denormal input operand has been met, never raised on x86 in DAZ mode */
+            DENORMAL_OUTPUT     = 1 << 3    /* Result has underflown to denormal or zero value */
+        } LSP_DSP_LIB_TYPE(denormal_flags_t);
+
         // Start and finish types
         typedef void (* LSP_DSP_LIB_TYPE(start_t))(LSP_DSP_LIB_TYPE(context_t) *ctx);
         typedef void (* LSP_DSP_LIB_TYPE(finish_t))(LSP_DSP_LIB_TYPE(context_t) *ctx);
@@ -92,6 +103,31 @@ LSP_DSP_LIB_SYMBOL(void, start, LSP_DSP_LIB_TYPE(context_t) *ctx);
  */
 LSP_DSP_LIB_SYMBOL(void, finish, LSP_DSP_LIB_TYPE(context_t) *ctx);
 
+/**
+ * Get current denormal handling mode of the calling thread
+ *
+ * @return combination of DENORMAL_FTZ and DENORMAL_DAZ flags, zero if
+ *   the mode is not supported by the architecture or not enabled
+ */
+LSP_DSP_LIB_SYMBOL(uint32_t, denormal_mode, );
+
+/**
+ * Sample and reset sticky denormal flags of the calling thread: the x86 MXCSR
+ * denormal and underflow flags, the ARM FPSCR/FPSR cumulative input denormal
+ * and underflow bits. Frequent non-zero result indicates that the processing
+ * produces or consumes a lot of denormal values
+ *
+ * The meaning of DENORMAL_INPUT depends on the architecture. x86 does not raise
+ * the MXCSR denormal flag while DAZ mode is enabled, so between dsp::start() and
+ * dsp::finish() only DENORMAL_OUTPUT is reported, DENORMAL_INPUT is reported only
+ * when DAZ mode is off. ARM raises the input denormal flag only when the denormal
+ * input is flushed to zero, so DENORMAL_INPUT is reported only in flush-to-zero mode.
+ *
+ * @return combination of DENORMAL_INPUT and DENORMAL_OUTPUT flags raised
+ *   since the previous call, always zero if the architecture is not supported
+ */
+LSP_DSP_LIB_SYMBOL(uint32_t, denormal_sample, );
+
 /**
  * Get DSP information, returns pointer to dsp::info_t structure
  * that can be freed by free()
@@ -99,4 +135,104 @@ LSP_DSP_LIB_SYMBOL(void, finish, LSP_DSP_LIB_TYPE(context_t) *ctx);
  */
 LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(info_t) *, info, );
 
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+        /**
+         * Scoped DSP context: calls dsp::start() on construction and dsp::finish()
+         * on destruction, so flush-to-zero and denormals-are-zero modes are
+         * enabled for the calling thread while the object is alive. Should be
+         * created and destroyed by the same thread.
+         *
+         * In sampling mode the object also keeps statistics of denormal flags
+         * obtained by the sample() calls, the sticky flags are reset on construction.
+         */
+        class context_guard_t
+        {
+            private:
+                context_t       sCtx;
+                bool            bSampling;
+                uint32_t        nFlags;
+                size_t          nSamples;
+                size_t          nEvents;
+
+            private:
+                context_guard_t(const context_guard_t &);
+                context_guard_t & operator = (const context_guard_t &);
+
+            public:
+                explicit inline context_guard_t(bool sampling = false)
+                {
+                    dsp::start(&sCtx);
+
+                    bSampling       = sampling;
+                    nFlags          = 0;
+                    nSamples        = 0;
+                    nEvents         = 0;
+
+                    if (sampling)
+                        dsp::denormal_sample();
+                }
+
+                inline ~context_guard_t()
+                {
+                    dsp::finish(&sCtx);
+                }
+
+            public:
+                /**
+                 * Get current denormal handling mode
+                 * @return combination of DENORMAL_FTZ and DENORMAL_DAZ flags
+                 */
+                inline uint32_t     mode() const        { return dsp::denormal_mode();  }
+
+                /**
+                 * Sample and reset sticky denormal flags, does nothing if sampling mode is off
+                 * @return combination of DENORMAL_INPUT and DENORMAL_OUTPUT flags
+                 */
+                inline uint32_t     sample()
+                {
+                    if (!bSampling)
+                        return 0;
+
+                    uint32_t flags  = dsp::denormal_sample();
+                    ++nSamples;
+                    if (flags != 0)
+                    {
+                        ++nEvents;
+                        nFlags         |= flags;
+                    }
+                    return flags;
+                }
+
+                /**
+                 * Check that sampling mode is enabled
+                 * @return true if sampling mode is enabled
+                 */
+                inline bool         sampling() const    { return bSampling;             }
+
+                /**
+                 * Get all flags obtained by the sample() calls
+                 * @return combination of DENORMAL_INPUT and DENORMAL_OUTPUT flags
+                 */
+                inline uint32_t     flags() const       { return nFlags;                }
+
+                /**
+                 * Get number of sample() calls
+                 * @return number of sample() calls
+                 */
+                inline size_t       samples() const     { return nSamples;              }
+
+                /**
+                 * Get number of sample() calls that have detected denormal flags
+                 * @return number of sample() calls that have detected denormal flags
+                 */
+                inline size_t       events() const      { return nEvents;               }
+        };
+    }
+}
+#endif /* __cplusplus */
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_CONTEXT_H_ */
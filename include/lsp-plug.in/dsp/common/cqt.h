@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_CQT_H_
+#define LSP_PLUG_IN_DSP_COMMON_CQT_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+  CONSTANT-Q TRANSFORM
+
+    The transform is computed from the spectrum X[j] of the signal frame of
+    2^rank samples obtained by the packed_direct_fft() call (J.C. Brown,
+    M.S. Puckette, "An efficient algorithm for the calculation of a constant
+    Q transform", 1992):
+
+      C[k]  =   | sum { X[j] * K[k, j] } |
+
+    The bin k has center frequency f[k] = fmin * 2^(k/bpo) and uses
+    Hann-windowed complex exponential of N[k] = Q / f[k] samples as the
+    analysis kernel, Q = 1 / (2^(1/bpo) - 1). N[k] is limited by the FFT size,
+    so the lowest bins may lose the constant-Q property if the FFT is too short.
+
+    The spectrum of the kernel K[k, j] is concentrated around the frequency
+    f[k], so only the main lobe of the window (+/- 2 * 2^rank / N[k] FFT bins
+    and one guard bin at each side) is stored. The kernel is normalized to
+    give the amplitude of the real sinusoid at the center frequency of the bin.
+ */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+    #pragma pack(push, 1)
+
+        /**
+         * Constant-Q transform parameters
+         */
+        typedef struct LSP_DSP_LIB_TYPE(cqt_params_t)
+        {
+            float       fmin;           // Frequency of the first bin normalized to sample rate (0 .. 0.5)
+            float       fmax;           // Maximum frequency normalized to sample rate (0 .. 0.5)
+            uint32_t    bpo;            // Number of bins per octave
+            uint32_t    rank;           // Rank of the FFT
+        } LSP_DSP_LIB_TYPE(cqt_params_t);
+
+        /**
+         * Sparse kernel descriptor of the constant-Q transform bin
+         */
+        typedef struct LSP_DSP_LIB_TYPE(cqt_bin_t)
+        {
+            uint32_t    first;          // Index of the first FFT bin used by the kernel
+            uint32_t    count;          // Number of FFT bins used by the kernel
+            uint32_t    offset;         // Offset of the kernel data in the kernel buffer, in floats
+            float       freq;           // Center frequency of the bin normalized to sample rate
+        } LSP_DSP_LIB_TYPE(cqt_bin_t);
+
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/** Compute number of constant-Q transform bins
+ *
+ * @param p transform parameters
+ * @return number of bins, zero if parameters are invalid
+ */
+LSP_DSP_LIB_SYMBOL(size_t, cqt_bins, const LSP_DSP_LIB_TYPE(cqt_params_t) *p);
+
+/** Compute size of the sparse kernel data
+ *
+ * @param p transform parameters
+ * @return number of floats required to store the kernel data
+ */
+LSP_DSP_LIB_SYMBOL(size_t, cqt_kernel_size, const LSP_DSP_LIB_TYPE(cqt_params_t) *p);
+
+/** Initialize sparse kernels of the constant-Q transform
+ *
+ * @param bins array of cqt_bins() bin descriptors to initialize
+ * @param kernel buffer of cqt_kernel_size() floats to store packed complex kernel data
+ * @param tmp temporary buffer of 2^(rank+1) floats
+ * @param p transform parameters
+ */
+LSP_DSP_LIB_SYMBOL(void, cqt_init, LSP_DSP_LIB_TYPE(cqt_bin_t) *bins, float *kernel, float *tmp,
+        const LSP_DSP_LIB_TYPE(cqt_params_t) *p);
+
+/** Apply constant-Q transform to the FFT data and compute magnitudes
+ *
+ * @param dst destination buffer to store magnitudes of the bins
+ * @param fft packed complex spectrum computed by the packed_direct_fft() call
+ * @param bins array of bin descriptors
+ * @param kernel packed complex kernel data
+ * @param count number of bins to compute
+ */
+LSP_DSP_LIB_SYMBOL(void, cqt_apply, float *dst, const float *fft,
+        const LSP_DSP_LIB_TYPE(cqt_bin_t) *bins, const float *kernel, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_CQT_H_ */
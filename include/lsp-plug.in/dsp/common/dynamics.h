@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_DYNAMICS_H_
+#define LSP_PLUG_IN_DSP_COMMON_DYNAMICS_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+  DYNAMICS PROCESSING
+
+    The envelope follower is a one-pole smoother with separate attack and release coefficients
+    applied to the detector signal d[i] (|x[i]| for peak, x[i]^2 for RMS):
+
+      k      = (d[i] > e) ? attack : release
+      e      = e + k * (d[i] - e)
+
+    The peak follower outputs e, the RMS follower outputs sqrt(e).
+
+    The gain computer works in the natural logarithm domain. For the level L = ln(env) and the
+    threshold T = ln(threshold) the compressor applies the gain (1/ratio - 1) * h(L - T) above the
+    threshold, the expander applies the gain (ratio - 1) * -h(T - L) below the threshold, where h(s)
+    is the soft-knee hinge of half-width w = -ln(knee):
+
+      h(s)   = 0                    for s <= -w
+      h(s)   = (s + w)^2 / (4*w)    for -w < s < w
+      h(s)   = s                    for s >= w
+
+    The resulting linear gain exp(G) is bounded below by exp(-80).
+
+    Multichannel processing:
+      - unlinked: envelope_*_mc follow each channel separately, gain_curve is applied to each
+        envelope, the SIMD implementations process several channels in parallel lanes;
+      - linked: envelope_*_linked follow the single envelope of the loudest channel (peak)
+        or of the mean power of channels (RMS), the single gain is applied to all channels.
+ */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+        typedef enum LSP_DSP_LIB_TYPE(gain_curve_type_t)
+        {
+            GAIN_CURVE_COMPRESSOR,  /* Gain reduction above the threshold */
+            GAIN_CURVE_EXPANDER     /* Gain reduction below the threshold */
+        } LSP_DSP_LIB_TYPE(gain_curve_type_t);
+
+    #pragma pack(push, 1)
+        /**
+         * Envelope follower state, initialized by envelope_init
+         */
+        typedef struct LSP_DSP_LIB_TYPE(envelope_t)
+        {
+            float       attack;     // Attack coefficient: 1 - exp(-1 / attack_samples)
+            float       release;    // Release coefficient: 1 - exp(-1 / release_samples)
+            float       env;        // Current value: peak level or mean square
+            float       __pad;      // Padding, keeps the structure 16 bytes long
+        } LSP_DSP_LIB_TYPE(envelope_t);
+
+        /**
+         * Gain computer curve, initialized by gain_curve_init
+         */
+        typedef struct LSP_DSP_LIB_TYPE(gain_curve_t)
+        {
+            float       dir;        // Direction: +1 for compressor, -1 for expander
+            float       thresh;     // -dir * ln(threshold)
+            float       knee;       // Half-width of the knee: -ln(knee)
+            float       kscale;     // 1 / (4 * knee) or 0 for the hard knee
+            float       slope;      // Gain slope: 1/ratio - 1 for compressor, 1 - ratio for expander
+            float       __pad[3];   // Padding, keeps the structure 32 bytes long
+        } LSP_DSP_LIB_TYPE(gain_curve_t);
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/**
+ * Initialize envelope follower and reset it's state
+ *
+ * @param env envelope follower to initialize
+ * @param attack attack time constant in samples
+ * @param release release time constant in samples
+ */
+LSP_DSP_LIB_SYMBOL(void, envelope_init, LSP_DSP_LIB_TYPE(envelope_t) *env, float attack, float release);
+
+/**
+ * Initialize gain computer curve
+ *
+ * @param c curve to initialize
+ * @param threshold threshold level (linear, > 0)
+ * @param ratio compression or expansion ratio (>= 1)
+ * @param knee knee level (linear, 0 < knee <= 1), the knee spans from threshold*knee to threshold/knee,
+ *   1 means the hard knee
+ * @param type type of the curve: downward compressor or downward expander
+ */
+LSP_DSP_LIB_SYMBOL(void, gain_curve_init, LSP_DSP_LIB_TYPE(gain_curve_t) *c, float threshold, float ratio, float knee,
+    LSP_DSP_LIB_TYPE(gain_curve_type_t) type);
+
+/**
+ * Follow peak envelope of the signal:
+ *   dst[i] = env(|src[i]|)
+ *
+ * @param dst destination buffer
+ * @param src source buffer
+ * @param env envelope follower state
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, envelope_peak, float *dst, const float *src, LSP_DSP_LIB_TYPE(envelope_t) *env, size_t count);
+
+/**
+ * Follow RMS envelope of the signal:
+ *   dst[i] = sqrt(env(src[i]^2))
+ *
+ * @param dst destination buffer
+ * @param src source buffer
+ * @param env envelope follower state
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, envelope_rms, float *dst, const float *src, LSP_DSP_LIB_TYPE(envelope_t) *env, size_t count);
+
+/**
+ * Follow peak envelopes of multiple channels independently (unlinked)
+ *
+ * @param dst array of destination buffers
+ * @param src array of source buffers
+ * @param env array of envelope follower states, one per channel
+ * @param channels number of channels
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, envelope_peak_mc, float **dst, const float **src, LSP_DSP_LIB_TYPE(envelope_t) *env, size_t channels, size_t count);
+
+/**
+ * Follow RMS envelopes of multiple channels independently (unlinked)
+ *
+ * @param dst array of destination buffers
+ * @param src array of source buffers
+ * @param env array of envelope follower states, one per channel
+ * @param channels number of channels
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, envelope_rms_mc, float **dst, const float **src, LSP_DSP_LIB_TYPE(envelope_t) *env, size_t channels, size_t count);
+
+/**
+ * Follow the linked peak envelope of multiple channels:
+ *   dst[i] = env(max(|src[0][i]|, ..., |src[channels-1][i]|))
+ *
+ * @param dst destination buffer
+ * @param src array of source buffers
+ * @param env envelope follower state
+ * @param channels number of channels
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, envelope_peak_linked, float *dst, const float **src, LSP_DSP_LIB_TYPE(envelope_t) *env, size_t channels, size_t count);
+
+/**
+ * Follow the linked RMS envelope of multiple channels:
+ *   dst[i] = sqrt(env((src[0][i]^2 + ... + src[channels-1][i]^2) / channels))
+ *
+ * @param dst destination buffer
+ * @param src array of source buffers
+ * @param env envelope follower state
+ * @param channels number of channels
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, envelope_rms_linked, float *dst, const float **src, LSP_DSP_LIB_TYPE(envelope_t) *env, size_t channels, size_t count);
+
+/**
+ * Compute linear gain for the envelope:
+ *   dst[i] = exp(G(ln(src[i])))
+ *
+ * @param dst destination buffer to store gain
+ * @param src envelope (linear level)
+ * @param c gain computer curve
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, gain_curve, float *dst, const float *src, const LSP_DSP_LIB_TYPE(gain_curve_t) *c, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_DYNAMICS_H_ */
@@ -64,4 +64,32 @@ LSP_DSP_LIB_SYMBOL(void, fastconv_restore, float *dst, float *src, size_t rank);
  */
 LSP_DSP_LIB_SYMBOL(void, fastconv_apply, float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
 
+/** Multiply two fast convolution data and add the result to the accumulator
+ * of fast convolution data: dst = dst + c1 * c2. The accumulated data can be
+ * restored to real data with the fastconv_restore() call.
+ *
+ * @param dst accumulator of fast convolution data of 2^(rank+1) floats
+ * @param c1 fast convolution data of 2^(rank+1) floats
+ * @param c2 fast convolution data of 2^(rank+1) floats
+ * @param rank the convolution rank
+ */
+LSP_DSP_LIB_SYMBOL(void, fastconv_fmadd, float *dst, const float *c1, const float *c2, size_t rank);
+
+/** Apply the matrix of convolutions to the block of multichannel input data:
+ * parse each input block to fast convolution data once, accumulate products
+ * with convolutions of all inputs for each output, restore the result to real data
+ * and add to the output buffer. The convolution of i-th input for o-th output
+ * is stored at c[o*inputs + i], NULL pointer means that there is no path between
+ * the input and the output.
+ *
+ * @param dst array of outputs of 2^rank floats each to add convolved data
+ * @param tmp temporary buffer of (inputs + 2) * 2^(rank+1) floats
+ * @param c array of inputs * outputs pointers to fast convolution data of 2^(rank+1) floats
+ * @param src array of inputs of 2^(rank-1) floats each
+ * @param rank the convolution rank
+ * @param inputs number of inputs
+ * @param outputs number of outputs
+ */
+LSP_DSP_LIB_SYMBOL(void, fastconv_matrix_apply, float * const *dst, float *tmp, const float * const *c, const float * const *src, size_t rank, size_t inputs, size_t outputs);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_FASTCONV_H_ */
@@ -56,6 +56,45 @@ LSP_DSP_LIB_SYMBOL(void, reverse_fft, float *dst_re, float *dst_im, const float
  */
 LSP_DSP_LIB_SYMBOL(void, packed_reverse_fft, float *dst, const float *src, size_t rank);
 
+/** Direct Fast Fourier Transform of multiple channels of equal size. The butterfly
+ * passes are interleaved between channels so twiddle factors are loaded once per pass for
+ * the whole group of channels. Strided layouts are passed as arrays of pointers to channels.
+ *
+ * @param dst_re array of pointers to real parts of spectrum
+ * @param dst_im array of pointers to imaginary parts of spectrum
+ * @param src_re array of pointers to real parts of signal
+ * @param src_im array of pointers to imaginary parts of signal
+ * @param rank the rank of FFT
+ * @param count number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, direct_fft_batch, float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+
+/** Direct Fast Fourier Transform of multiple channels of equal size with packed complex data
+ * @param dst array of pointers to complex spectrums [re, im, re, im ...]
+ * @param src array of pointers to complex signals [re, im, re, im ...]
+ * @param rank the rank of FFT
+ * @param count number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, packed_direct_fft_batch, float **dst, const float * const *src, size_t rank, size_t count);
+
+/** Reverse Fast Fourier transform of multiple channels of equal size
+ * @param dst_re array of pointers to real parts of signal
+ * @param dst_im array of pointers to imaginary parts of signal
+ * @param src_re array of pointers to real parts of spectrum
+ * @param src_im array of pointers to imaginary parts of spectrum
+ * @param rank the rank of FFT
+ * @param count number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, reverse_fft_batch, float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+
+/** Reverse Fast Fourier transform of multiple channels of equal size with packed complex data
+ * @param dst array of pointers to complex signals [re, im, re, im ...]
+ * @param src array of pointers to complex spectrums [re, im, re, im ...]
+ * @param rank the rank of FFT
+ * @param count number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, packed_reverse_fft_batch, float **dst, const float * const *src, size_t rank, size_t count);
+
 /** Normalize FFT coefficients
  *
  * @param dst_re target array for real part of signal
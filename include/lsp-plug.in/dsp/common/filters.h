@@ -29,5 +29,7 @@
 #include <lsp-plug.in/dsp/common/filters/static.h>
 #include <lsp-plug.in/dsp/common/filters/transfer.h>
 #include <lsp-plug.in/dsp/common/filters/transform.h>
+#include <lsp-plug.in/dsp/common/filters/fir.h>
+#include <lsp-plug.in/dsp/common/filters/crossover.h>
 
 #endif /* LSP_PLUG_IN_DSP_COMMON_FILTERS_H_ */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_FILTERS_CROSSOVER_H_
+#define LSP_PLUG_IN_DSP_COMMON_FILTERS_CROSSOVER_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+#include <lsp-plug.in/dsp/common/filters/types.h>
+
+/*
+  LINKWITZ-RILEY CROSSOVER
+
+    The crossover splits the signal into N bands by the tree of Linkwitz-Riley
+    splits. Each split at frequency f[j] produces low-pass and high-pass outputs
+    which are the squared Butterworth filters:
+
+      LR4:  LP = BW2_LP^2,   HP = BW2_HP^2,   LP + HP = AP2
+      LR8:  LP = BW4_LP^2,   HP = BW4_HP^2,   LP + HP = AP4
+
+    where AP2 and AP4 are the allpass filters with the same poles as BW2 and BW4.
+
+    The tree is balanced: the bands [lo, hi) are split at the frequency between
+    the bands m-1 and m, m = (lo + hi) / 2, then each half is split recursively.
+    For 4 bands:
+
+                        ┌─ LP(f[0]) ─── band 0
+          ┌─ LP(f[1]) ──┤
+          │             └─ HP(f[0]) ─── band 1
+       ───┤
+          │             ┌─ LP(f[2]) ─── band 2
+          └─ HP(f[1]) ──┤
+                        └─ HP(f[2]) ─── band 3
+
+    With phase compensation enabled each branch of the split is also passed
+    through the allpass filters of all splits of the other branch, so the sum
+    of all bands is an allpass filter and has flat magnitude response. For the
+    example above the branch LP(f[1]) gets AP(f[2]) and the branch HP(f[1])
+    gets AP(f[0]).
+
+    Since all filters are linear, the chain of biquad sections of each band can be
+    computed independently of other bands. All chains are padded with identity
+    sections to the same length and stored as the array of biquad_x8_t banks where
+    the lane k of each bank holds the section of the band k. This allows to compute
+    all bands in parallel SIMD lanes by reading the input signal only once.
+ */
+
+#define LSP_DSP_CROSSOVER_MAX_BANDS             8           /* Maximum number of bands */
+#define LSP_DSP_CROSSOVER_MAX_STAGES            20          /* Maximum number of biquad sections per band */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+        /**
+         * Slope of the crossover
+         */
+        typedef enum LSP_DSP_LIB_TYPE(crossover_type_t)
+        {
+            CROSSOVER_LR4,              // 4th order Linkwitz-Riley, 24 dB/oct
+            CROSSOVER_LR8               // 8th order Linkwitz-Riley, 48 dB/oct
+        } LSP_DSP_LIB_TYPE(crossover_type_t);
+
+    #pragma pack(push, 1)
+
+        /**
+         * Crossover parameters
+         */
+        typedef struct LSP_DSP_LIB_TYPE(crossover_params_t)
+        {
+            uint32_t    type;           // Slope of the crossover, crossover_type_t
+            uint32_t    bands;          // Number of bands, 1 .. LSP_DSP_CROSSOVER_MAX_BANDS
+            uint32_t    phase;          // Non-zero value enables allpass phase compensation
+            float       freq[LSP_DSP_CROSSOVER_MAX_BANDS - 1]; // Split frequencies normalized to sample rate (0 .. 0.5), ascending
+        } LSP_DSP_LIB_TYPE(crossover_params_t);
+
+        /**
+         * Crossover state, should be aligned same as biquad_t
+         */
+        typedef struct LSP_DSP_LIB_TYPE(crossover_t)
+        {
+            LSP_DSP_LIB_TYPE(biquad_x8_t) stage[LSP_DSP_CROSSOVER_MAX_STAGES];  // Biquad sections, lane k is the section of band k
+            float       d[LSP_DSP_CROSSOVER_MAX_STAGES * 16];   // Memory of sections: d0[8], d1[8] for each stage
+            uint32_t    bands;          // Number of bands
+            uint32_t    stages;         // Number of used sections
+            uint32_t    __pad[14];
+        } __lsp_aligned(LSP_DSP_BIQUAD_ALIGN) LSP_DSP_LIB_TYPE(crossover_t);
+
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/** Initialize crossover: compute the biquad sections and clear the memory
+ *
+ * @param c crossover to initialize
+ * @param p crossover parameters
+ */
+LSP_DSP_LIB_SYMBOL(void, crossover_init, LSP_DSP_LIB_TYPE(crossover_t) *c, const LSP_DSP_LIB_TYPE(crossover_params_t) *p);
+
+/** Clear the memory of the crossover
+ *
+ * @param c crossover to reset
+ */
+LSP_DSP_LIB_SYMBOL(void, crossover_reset, LSP_DSP_LIB_TYPE(crossover_t) *c);
+
+/** Split the signal into bands in a single pass
+ *
+ * @param dst array of c->bands destination buffers, should not overlap the source buffer
+ * @param src source buffer
+ * @param count number of samples to process
+ * @param c crossover
+ */
+LSP_DSP_LIB_SYMBOL(void, crossover_process, float **dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(crossover_t) *c);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_FILTERS_CROSSOVER_H_ */
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_FILTERS_FIR_H_
+#define LSP_PLUG_IN_DSP_COMMON_FILTERS_FIR_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+  FIR FILTER DESIGN
+
+    All designed filters are linear-phase and symmetric (or anti-symmetric for Hilbert
+    transformer) around the center of the kernel: c = (N - 1) / 2, x = i - c.
+
+    Windowed-sinc method:
+                 sin(2*pi*f*x)
+      h[i]  =   ─────────────── * w[i]
+                     pi*x
+
+    Where w[i] is one of the cosine-sum windows:
+      w[i]  =   a0 - a1*cos(2*pi*i/(N-1)) + a2*cos(4*pi*i/(N-1)) - a3*cos(6*pi*i/(N-1))
+
+    Least-squares method (C.S. Burrus, A.W. Soewito, R.A. Gopinath, "Least squared error FIR
+    filter design with transition bands", 1992) gives the kernel with minimum integral squared
+    error to the ideal response with spline transition band of width 'tw':
+
+                 sin(2*pi*f*x)    ┌   sin(pi*tw*x/p)  ┐ p
+      h[i]  =   ─────────────── * │ ──────────────── │
+                     pi*x         └    pi*tw*x/p    ┘
+
+    where p = 0.62 * N * tw (but not less than 1) is the optimal order of the spline.
+    No window is applied.
+
+    High-pass and band-stop filters are built by spectral inversion of low-pass and
+    band-pass filters and require odd number of taps, so as the Hilbert transformer.
+    For even number of taps these filters are designed with N-1 taps and the last
+    tap is set to zero.
+ */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+        /**
+         * Type of the FIR filter
+         */
+        typedef enum LSP_DSP_LIB_TYPE(fir_type_t)
+        {
+            FIR_LOWPASS,                // Low-pass filter, f1 is the cutoff frequency
+            FIR_HIGHPASS,               // High-pass filter, f1 is the cutoff frequency
+            FIR_BANDPASS,               // Band-pass filter, f1 and f2 are the band edges
+            FIR_BANDSTOP,               // Band-stop filter, f1 and f2 are the band edges
+            FIR_HILBERT                 // Hilbert transformer, f1 and f2 are ignored
+        } LSP_DSP_LIB_TYPE(fir_type_t);
+
+        /**
+         * Design method of the FIR filter
+         */
+        typedef enum LSP_DSP_LIB_TYPE(fir_method_t)
+        {
+            FIR_RECTANGULAR,            // Windowed-sinc with rectangular window
+            FIR_HANN,                   // Windowed-sinc with Hann window
+            FIR_HAMMING,                // Windowed-sinc with Hamming window
+            FIR_BLACKMAN,               // Windowed-sinc with Blackman window
+            FIR_BLACKMAN_HARRIS,        // Windowed-sinc with 4-term Blackman-Harris window
+            FIR_LSQ                     // Least-squares with spline transition band
+        } LSP_DSP_LIB_TYPE(fir_method_t);
+
+    #pragma pack(push, 1)
+
+        /**
+         * FIR filter design parameters
+         */
+        typedef struct LSP_DSP_LIB_TYPE(fir_params_t)
+        {
+            uint32_t    type;           // Filter type, fir_type_t
+            uint32_t    method;         // Design method, fir_method_t
+            float       f1;             // First edge frequency normalized to sample rate (0 .. 0.5)
+            float       f2;             // Second edge frequency normalized to sample rate (0 .. 0.5)
+            float       transition;     // Transition band width normalized to sample rate, used by FIR_LSQ method
+        } LSP_DSP_LIB_TYPE(fir_params_t);
+
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/** Design FIR filter kernel
+ *
+ * @param dst destination buffer to store kernel
+ * @param p filter design parameters
+ * @param count number of taps in the kernel
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_design, float *dst, const LSP_DSP_LIB_TYPE(fir_params_t) *p, size_t count);
+
+/** Design FIR filter kernel and convert it to fast convolution data
+ * as it would be done by the fastconv_parse() call, the rest of the
+ * kernel is padded with zeros. The conversion is performed in place,
+ * no temporary buffer is required
+ *
+ * @param dst destination buffer of 2^(rank+1) floats to store fast convolution data
+ * @param p filter design parameters
+ * @param count number of taps in the kernel, should not be greater than 2^(rank-1)
+ * @param rank the convolution rank, at least 3
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_design_fastconv, float *dst, const LSP_DSP_LIB_TYPE(fir_params_t) *p, size_t count, size_t rank);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_FILTERS_FIR_H_ */
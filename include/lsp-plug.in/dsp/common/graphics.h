@@ -188,6 +188,25 @@ LSP_DSP_LIB_SYMBOL(void, rgba_to_bgra32, void *dst, const float *src, size_t cou
  */
 LSP_DSP_LIB_SYMBOL(void, rgba32_to_bgra32_ra, void *dst, const void *src, size_t count);
 
+/** Rasterize row of spectrogram: convert magnitudes to decibels, map the range
+ * [dbmin, dbmax] to the index in colormap and store the colormap entry as BGRA32 pixel.
+ * The index is computed by formula:
+ *   i = clamp(round(255 * (20*log10(|src|) - dbmin) / (dbmax - dbmin)), 0, 255)
+ * Logarithm is approximated with error less than 0.006 dB, values that are NaN or below
+ * the smallest normalized float are mapped to the first entry of the colormap.
+ *
+ * Colormap is usually prepared once by the rgba_to_bgra32() call for 256 RGBA colors,
+ * so the pixels are stored premultiplied.
+ *
+ * @param dst target buffer (4 bytes per pixel)
+ * @param src source magnitudes
+ * @param lut colormap of 256 BGRA32 entries (4 bytes per entry)
+ * @param dbmin level in decibels that corresponds to the first colormap entry
+ * @param dbmax level in decibels that corresponds to the last colormap entry, should be greater than dbmin
+ * @param count number of pixels to process
+ */
+LSP_DSP_LIB_SYMBOL(void, spectrogram_bgra32, void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+
 /**
  * Generate set of pixels with applied hue shift effect
  * @param dst target array to store pixels
@@ -224,6 +243,47 @@ LSP_DSP_LIB_SYMBOL(void, eff_hsla_light, float *dst, const float *v, const LSP_D
  */
 LSP_DSP_LIB_SYMBOL(void, eff_hsla_alpha, float *dst, const float *v, const LSP_DSP_LIB_TYPE(hsla_alpha_eff_t) *eff, size_t count);
 
+/**
+ * Generate set of BGRA32 pixels with applied hue shift effect, the result is the same
+ * to eff_hsla_hue() followed by hsla_to_rgba() and rgba_to_bgra32() calls, but the
+ * computation is performed in a single pass without intermediate float buffers
+ * @param dst target buffer (4 bytes per pixel)
+ * @param v hue shift in range (-1 .. +1)
+ * @param eff effect parameters
+ * @param count number of points to process
+ */
+LSP_DSP_LIB_SYMBOL(void, eff_hsla_hue_bgra32, void *dst, const float *v, const LSP_DSP_LIB_TYPE(hsla_hue_eff_t) *eff, size_t count);
+
+/**
+ * Generate set of BGRA32 pixels with applied saturation effect, the result is the same
+ * to eff_hsla_sat() followed by hsla_to_rgba() and rgba_to_bgra32() calls
+ * @param dst target buffer (4 bytes per pixel)
+ * @param v saturation shift in range (-1 .. +1)
+ * @param eff effect parameters
+ * @param count number of points to process
+ */
+LSP_DSP_LIB_SYMBOL(void, eff_hsla_sat_bgra32, void *dst, const float *v, const LSP_DSP_LIB_TYPE(hsla_sat_eff_t) *eff, size_t count);
+
+/**
+ * Generate set of BGRA32 pixels with applied lightness effect, the result is the same
+ * to eff_hsla_light() followed by hsla_to_rgba() and rgba_to_bgra32() calls
+ * @param dst target buffer (4 bytes per pixel)
+ * @param v lightness shift in range (-1 .. +1)
+ * @param eff effect parameters
+ * @param count number of points to process
+ */
+LSP_DSP_LIB_SYMBOL(void, eff_hsla_light_bgra32, void *dst, const float *v, const LSP_DSP_LIB_TYPE(hsla_light_eff_t) *eff, size_t count);
+
+/**
+ * Generate set of BGRA32 pixels with applied alpha effect, the result is the same
+ * to eff_hsla_alpha() followed by hsla_to_rgba() and rgba_to_bgra32() calls
+ * @param dst target buffer (4 bytes per pixel)
+ * @param v alpha shift in range (-1 .. +1)
+ * @param eff effect parameters
+ * @param count number of points to process
+ */
+LSP_DSP_LIB_SYMBOL(void, eff_hsla_alpha_bgra32, void *dst, const float *v, const LSP_DSP_LIB_TYPE(hsla_alpha_eff_t) *eff, size_t count);
+
 /**
  * Perform cubic smooth of linear-scaled data using x^2*(3-2*x) polynom
  * @param dst target buffer to store interpolation data, excludes start and stop samples
@@ -234,7 +294,8 @@ LSP_DSP_LIB_SYMBOL(void, eff_hsla_alpha, float *dst, const float *v, const LSP_D
 LSP_DSP_LIB_SYMBOL(void, smooth_cubic_linear, float *dst, float start, float stop, size_t count);
 
 /**
- * Perform cubic smooth of logarithmic-scaled data using x^2*(3-2*x) polynom
+ * Perform cubic smooth of logarithmic-scaled data using x^2*(3-2*x) polynom.
+ * If start and stop are not both non-zero and of the same sign, smooth_cubic_linear is applied
  * @param dst target buffer to store interpolation data, excludes start and stop samples
  * @param start start interpolation value
  * @param stop end interpolation value
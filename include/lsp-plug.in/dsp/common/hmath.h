@@ -24,6 +24,7 @@
 
 #include <lsp-plug.in/dsp/common/types.h>
 
+#include <lsp-plug.in/dsp/common/hmath/hcsum.h>
 #include <lsp-plug.in/dsp/common/hmath/hdotp.h>
 #include <lsp-plug.in/dsp/common/hmath/hsum.h>
 
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_HMATH_HCSUM_H_
+#define LSP_PLUG_IN_DSP_COMMON_HMATH_HCSUM_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+ * Compensated (Kahan) horizontal reductions for long buffers.
+ *
+ * The plain h_sum/h_dotp functions accumulate into single-precision lanes, so their error
+ * grows with the number of elements. The functions below keep a running compensation term
+ * for each SIMD lane and merge the lanes only at the end. For count < 2^24 the absolute
+ * error of the result is bounded by 8 * FLT_EPSILON * sum {i} abs(x[i]), where x[i] is the
+ * reduced term (src[i], sqr(src[i]), abs(src[i]) or a[i]*b[i] respectively), independently
+ * of count. For dot products, an additional FLT_EPSILON * sum {i} abs(a[i]*b[i]) comes from
+ * rounding of the products themselves.
+ */
+
+/** Calculate compensated horizontal sum: result = sum (i) from 0 to count-1 src[i]
+ *
+ * @param src vector to summarize
+ * @param count number of elements
+ * @return sum of elements
+ */
+LSP_DSP_LIB_SYMBOL(float, h_csum, const float *src, size_t count);
+
+/** Calculate compensated horizontal sum of squares: result = sum (i) from 0 to count-1 sqr(src[i])
+ *
+ * @param src vector to summarize
+ * @param count number of elements
+ * @return sum of squares of elements
+ */
+LSP_DSP_LIB_SYMBOL(float, h_sqr_csum, const float *src, size_t count);
+
+/** Calculate compensated horizontal sum of absolute values: result = sum (i) from 0 to count-1 abs(src[i])
+ *
+ * @param src vector to summarize
+ * @param count number of elements
+ * @return sum of absolute values of elements
+ */
+LSP_DSP_LIB_SYMBOL(float, h_abs_csum, const float *src, size_t count);
+
+/** Calculate compensated dot product: sum {from 0 to count-1} (a[i] * b[i])
+ *
+ * @param a first vector
+ * @param b second vector
+ * @param count number of elements
+ * @return scalar multiplication
+ */
+LSP_DSP_LIB_SYMBOL(float, h_cdotp, const float *a, const float *b, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_HMATH_HCSUM_H_ */
@@ -23,5 +23,7 @@
 #define LSP_PLUG_IN_DSP_COMMON_INTERPOLATION_H_
 
 #include <lsp-plug.in/dsp/common/interpolation/linear.h>
+#include <lsp-plug.in/dsp/common/interpolation/ramp.h>
+#include <lsp-plug.in/dsp/common/interpolation/delay.h>
 
 #endif /* INCLUDE_LSP_PLUG_IN_DSP_COMMON_INTERPOLATION_H_ */
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_INTERPOLATION_DELAY_H_
+#define LSP_PLUG_IN_DSP_COMMON_INTERPOLATION_DELAY_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+  FRACTIONAL DELAY LINE
+
+    The delay line is a ring buffer of 2^rank samples allocated by the caller. The buffer
+    should have LSP_DSP_DELAY_GUARD additional samples after the end: they always mirror
+    the first samples of the buffer, so any block of up to LSP_DSP_DELAY_GUARD samples
+    starting inside the ring can be read without wraparound. Rings shorter than the guard
+    are repeated in it, guard sample i always equals buf[i & mask]. Positions are wrapped
+    by the mask only, there are no per-sample branches.
+
+    The read functions should be called after writing the block of samples to the delay
+    line. The i'th read sample corresponds to the i'th sample of the last written block:
+
+      dst[i]    = x(head - count + i - delay[i])
+
+    The value between samples is interpolated, for the position p = k + f, 0 <= f < 1:
+
+      linear:   x(p) = x[k] + (x[k+1] - x[k]) * f
+      hermite:  4-point cubic Hermite (Catmull-Rom) spline over x[k-1] .. x[k+2]
+      lagrange: 3rd order Lagrange polynomial over x[k-1] .. x[k+2]
+      allpass:  y    = x[k] + (x[k+1] - y') * e,  e = f / (2 - f), y' = previous output
+
+    The allpass interpolator is the first order Thiran filter: it has flat magnitude
+    response but keeps the state and should be used with slowly changing delays.
+
+    The delay should be at least 1 sample for linear and allpass interpolation and at
+    least 2 samples for hermite and lagrange interpolation, and delay + count should not
+    exceed 2^rank - 2.
+ */
+
+#define LSP_DSP_DELAY_GUARD             16          /* Number of mirrored samples after the end of the ring */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+        typedef enum LSP_DSP_LIB_TYPE(delay_interp_t)
+        {
+            DELAY_LINEAR,           /* Linear interpolation */
+            DELAY_HERMITE,          /* 4-point cubic Hermite interpolation */
+            DELAY_LAGRANGE          /* 4-point 3rd order Lagrange interpolation */
+        } LSP_DSP_LIB_TYPE(delay_interp_t);
+
+    #pragma pack(push, 1)
+        typedef struct LSP_DSP_LIB_TYPE(delay_t)
+        {
+            uint32_t    mask;       // Size of the ring minus 1, the size is a power of 2
+            uint32_t    head;       // Position of the next written sample, not wrapped
+        } LSP_DSP_LIB_TYPE(delay_t);
+
+        typedef struct LSP_DSP_LIB_TYPE(delay_tap_t)
+        {
+            float       delay;      // Delay of the tap in samples
+            float       gain;       // Gain of the tap
+            uint32_t    interp;     // Interpolation, see delay_interp_t
+        } LSP_DSP_LIB_TYPE(delay_tap_t);
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/**
+ * Initialize the delay line and clear the buffer
+ *
+ * @param buf buffer of 2^rank + LSP_DSP_DELAY_GUARD samples
+ * @param d delay line descriptor
+ * @param rank log2 of the size of the ring
+ */
+LSP_DSP_LIB_SYMBOL(void, delay_init, float *buf, LSP_DSP_LIB_TYPE(delay_t) *d, size_t rank);
+
+/**
+ * Write the block of samples to the delay line and advance the head
+ *
+ * @param buf delay line buffer
+ * @param d delay line descriptor
+ * @param src source samples
+ * @param count number of samples to write
+ */
+LSP_DSP_LIB_SYMBOL(void, delay_write, float *buf, LSP_DSP_LIB_TYPE(delay_t) *d, const float *src, size_t count);
+
+/**
+ * Read the last written block with per-sample delays and linear interpolation
+ *
+ * @param dst destination buffer
+ * @param buf delay line buffer
+ * @param d delay line descriptor
+ * @param delay delay of each sample, at least 1 sample
+ * @param count number of samples in the last written block to read
+ */
+LSP_DSP_LIB_SYMBOL(void, delay_read_linear, float *dst, const float *buf, const LSP_DSP_LIB_TYPE(delay_t) *d, const float *delay, size_t count);
+
+/**
+ * Read the last written block with per-sample delays and cubic Hermite interpolation
+ *
+ * @param dst destination buffer
+ * @param buf delay line buffer
+ * @param d delay line descriptor
+ * @param delay delay of each sample, at least 2 samples
+ * @param count number of samples in the last written block to read
+ */
+LSP_DSP_LIB_SYMBOL(void, delay_read_hermite, float *dst, const float *buf, const LSP_DSP_LIB_TYPE(delay_t) *d, const float *delay, size_t count);
+
+/**
+ * Read the last written block with per-sample delays and 3rd order Lagrange interpolation
+ *
+ * @param dst destination buffer
+ * @param buf delay line buffer
+ * @param d delay line descriptor
+ * @param delay delay of each sample, at least 2 samples
+ * @param count number of samples in the last written block to read
+ */
+LSP_DSP_LIB_SYMBOL(void, delay_read_lagrange, float *dst, const float *buf, const LSP_DSP_LIB_TYPE(delay_t) *d, const float *delay, size_t count);
+
+/**
+ * Read the last written block with per-sample delays and first order allpass interpolation
+ *
+ * @param dst destination buffer
+ * @param buf delay line buffer
+ * @param d delay line descriptor
+ * @param delay delay of each sample, at least 1 sample
+ * @param state the state of the allpass filter (last output sample), should be zero initially
+ * @param count number of samples in the last written block to read
+ */
+LSP_DSP_LIB_SYMBOL(void, delay_read_allpass, float *dst, const float *buf, const LSP_DSP_LIB_TYPE(delay_t) *d, const float *delay, float *state, size_t count);
+
+/**
+ * Read the last written block by multiple taps with constant delays and sum them:
+ *   dst[i] = sum(taps[j].gain * x(head - count + i - taps[j].delay))
+ * All taps are computed for each block of samples, so the destination is written once
+ *
+ * @param dst destination buffer
+ * @param buf delay line buffer
+ * @param d delay line descriptor
+ * @param taps array of taps
+ * @param ntaps number of taps
+ * @param count number of samples in the last written block to read
+ */
+LSP_DSP_LIB_SYMBOL(void, delay_read_taps, float *dst, const float *buf, const LSP_DSP_LIB_TYPE(delay_t) *d, const LSP_DSP_LIB_TYPE(delay_tap_t) *taps, size_t ntaps, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_INTERPOLATION_DELAY_H_ */
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_INTERPOLATION_RAMP_H_
+#define LSP_PLUG_IN_DSP_COMMON_INTERPOLATION_RAMP_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+  PARAMETER RAMPS
+
+    The ramp describes the smooth transition of the parameter from the start value to the stop
+    value over the specified number of samples. For the position p of the ramp the normalized
+    coordinate x = p / length is computed and the value of the ramp is:
+
+      RAMP_LINEAR:  start + (stop - start) * x
+      RAMP_CUBIC:   start + (stop - start) * x^2 * (3 - 2*x)
+      RAMP_EXP:     start * (stop / start) ^ x
+      RAMP_LOG:     start * (stop / start) ^ (x^2 * (3 - 2*x))
+
+    RAMP_EXP changes the value by the constant ratio for each sample (linear change in decibels),
+    RAMP_LOG performs cubic smoothing of logarithmic-scaled values. Both require start and stop
+    values to be non-zero and of the same sign, otherwise RAMP_LINEAR and RAMP_CUBIC are applied
+    respectively.
+
+    Each call of ramp_* function processes the next portion of the ramp and advances the
+    offset field. After the ramp is complete, the stop value is applied.
+ */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+        typedef enum LSP_DSP_LIB_TYPE(ramp_shape_t)
+        {
+            RAMP_LINEAR,            /* Linear interpolation */
+            RAMP_CUBIC,             /* Cubic x^2*(3-2*x) interpolation */
+            RAMP_EXP,               /* Linear interpolation of logarithmic-scaled values */
+            RAMP_LOG                /* Cubic x^2*(3-2*x) interpolation of logarithmic-scaled values */
+        } LSP_DSP_LIB_TYPE(ramp_shape_t);
+
+    #pragma pack(push, 1)
+        typedef struct LSP_DSP_LIB_TYPE(ramp_t)
+        {
+            float       start;      // Value at the beginning of the ramp
+            float       stop;       // Value at the end of the ramp
+            uint32_t    shape;      // Shape of the ramp, see ramp_shape_t
+            uint32_t    length;     // Length of the ramp in samples
+            uint32_t    offset;     // Current position in the ramp, advanced by each call
+        } LSP_DSP_LIB_TYPE(ramp_t);
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/**
+ * Fill the buffer with the next portion of the ramp:
+ *   dst[i] = ramp[i]
+ *
+ * @param dst destination buffer
+ * @param r ramp descriptor, offset is advanced by count samples
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, ramp_set, float *dst, LSP_DSP_LIB_TYPE(ramp_t) *r, size_t count);
+
+/**
+ * Apply the next portion of the ramp to the buffer:
+ *   dst[i] = dst[i] * ramp[i]
+ *
+ * @param dst destination buffer
+ * @param r ramp descriptor, offset is advanced by count samples
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, ramp_mul2, float *dst, LSP_DSP_LIB_TYPE(ramp_t) *r, size_t count);
+
+/**
+ * Apply the next portion of the ramp to the source buffer:
+ *   dst[i] = src[i] * ramp[i]
+ *
+ * @param dst destination buffer
+ * @param src source buffer
+ * @param r ramp descriptor, offset is advanced by count samples
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, ramp_mul3, float *dst, const float *src, LSP_DSP_LIB_TYPE(ramp_t) *r, size_t count);
+
+/**
+ * Apply the next portion of the ramp to the source buffer and add to the destination buffer:
+ *   dst[i] = dst[i] + src[i] * ramp[i]
+ *
+ * @param dst destination buffer
+ * @param src source buffer
+ * @param r ramp descriptor, offset is advanced by count samples
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, ramp_fmadd2, float *dst, const float *src, LSP_DSP_LIB_TYPE(ramp_t) *r, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_INTERPOLATION_RAMP_H_ */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_IR_H_
+#define LSP_PLUG_IN_DSP_COMMON_IR_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+  IMPULSE RESPONSE SYNTHESIS FROM SPARSE TAPS
+
+    Each tap (reflection arrival) with the fractional position p and the gain g is
+    rendered into the impulse response as the band-limited impulse:
+
+      dst[n] += g * h(n - p),   floor(p) - 3 <= n <= floor(p) + 4
+
+    The interpolation kernel h(x) is the sinc function with the Blackman window
+    of LSP_DSP_IR_POINTS samples. It is tabulated by ir_kernel_init() for
+    LSP_DSP_IR_PHASES fractional positions per sample, each phase is normalized to
+    the unity DC gain. The kernel for the fractional position between two phases is
+    linearly interpolated, so each table row stores the coefficients of the phase
+    and the difference to the next phase.
+
+    Taps may be passed in any order, but writes stay inside a few cache lines when
+    taps are sorted by position. ir_bin_taps() performs the stable counting sort of
+    taps into blocks of 2^LSP_DSP_IR_BLOCK_RANK samples: it is linear in the number
+    of taps and is sufficient to keep the rendering local. Taps near the edges of the
+    buffer are clipped.
+ */
+
+#define LSP_DSP_IR_POINTS               8           /* Number of points of the interpolation kernel */
+#define LSP_DSP_IR_PHASES               64          /* Number of tabulated fractional positions */
+#define LSP_DSP_IR_KERNEL_SIZE          (LSP_DSP_IR_PHASES * LSP_DSP_IR_POINTS * 2) /* Size of the kernel table */
+#define LSP_DSP_IR_BLOCK_RANK           8           /* log2 of the block size for binning taps */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+    #pragma pack(push, 1)
+
+        /**
+         * Sparse tap of the impulse response
+         */
+        typedef struct LSP_DSP_LIB_TYPE(ir_tap_t)
+        {
+            float       position;       // Position of the tap in samples
+            float       gain;           // Gain of the tap
+        } LSP_DSP_LIB_TYPE(ir_tap_t);
+
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/** Initialize the table of the interpolation kernel
+ *
+ * @param kernel buffer of LSP_DSP_IR_KERNEL_SIZE floats, should be aligned to 32 bytes
+ */
+LSP_DSP_LIB_SYMBOL(void, ir_kernel_init, float *kernel);
+
+/** Sort taps by blocks of 2^LSP_DSP_IR_BLOCK_RANK samples, the order of taps
+ * inside the block is preserved
+ *
+ * @param dst destination array of taps, should not overlap the source
+ * @param src source array of taps
+ * @param bins temporary array of ((length + 2^LSP_DSP_IR_BLOCK_RANK - 1) >> LSP_DSP_IR_BLOCK_RANK) + 1 counters
+ * @param count number of taps
+ * @param length length of the impulse response in samples
+ */
+LSP_DSP_LIB_SYMBOL(void, ir_bin_taps, LSP_DSP_LIB_TYPE(ir_tap_t) *dst, const LSP_DSP_LIB_TYPE(ir_tap_t) *src,
+        uint32_t *bins, size_t count, size_t length);
+
+/** Render sparse taps into the impulse response, the destination buffer is not cleared
+ *
+ * @param dst destination buffer of the impulse response
+ * @param taps array of taps, preferably sorted or binned by ir_bin_taps()
+ * @param kernel interpolation kernel table initialized by ir_kernel_init()
+ * @param count number of taps
+ * @param length length of the impulse response in samples
+ */
+LSP_DSP_LIB_SYMBOL(void, ir_render_taps, float *dst, const LSP_DSP_LIB_TYPE(ir_tap_t) *taps,
+        const float *kernel, size_t count, size_t length);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_IR_H_ */
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_LOUDNESS_H_
+#define LSP_PLUG_IN_DSP_COMMON_LOUDNESS_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+  LOUDNESS METER (ITU-R BS.1770-4, EBU R128, EBU Tech 3341/3342)
+
+    Each channel is passed through the K-weighting filter (high-shelf stage followed by
+    the high-pass stage) and the squares of the filtered samples are accumulated for the
+    100 ms sub-block. At the end of each sub-block the weighted mean-square of channels
+
+      P      = sum(G[c] * ms[c])
+
+    is stored in the ring buffer of the last 30 sub-blocks. The loudness of the power is
+
+      L(P)   = -0.691 + 10*log10(P) LUFS
+
+    The values provided by the meter:
+      - momentary loudness: the power of the last 400 ms (4 sub-blocks);
+      - short-term loudness: the power of the last 3 s (30 sub-blocks);
+      - integrated loudness: the gated power of all 400 ms blocks with 75% overlap,
+        the absolute gate is -70 LUFS, the relative gate is -10 LU;
+      - loudness range (LRA): the difference between the 95th and the 10th percentiles
+        of the short-term loudness values above the absolute gate of -70 LUFS and the
+        relative gate of -20 LU.
+
+    The gating blocks are not stored: each block adds one count to the histogram of
+    loudness values with LSP_DSP_LOUDNESS_HIST_STEP resolution, so the update costs O(1)
+    per block and the memory does not grow with the duration of the measurement. The
+    gated values are computed from the bin centers, the error does not exceed the half
+    of the bin width (0.05 LU).
+ */
+
+#define LSP_DSP_LOUDNESS_MAX_CHANNELS           8           /* Maximum number of channels */
+#define LSP_DSP_LOUDNESS_MOMENTARY_BLOCKS       4           /* Number of 100 ms sub-blocks in the momentary window */
+#define LSP_DSP_LOUDNESS_SHORT_BLOCKS           30          /* Number of 100 ms sub-blocks in the short-term window */
+#define LSP_DSP_LOUDNESS_HIST_MIN               -70.0f      /* Absolute gate and the lower bound of the histogram, LUFS */
+#define LSP_DSP_LOUDNESS_HIST_STEP              0.1f        /* Width of the histogram bin, LU */
+#define LSP_DSP_LOUDNESS_HIST_BINS              800         /* Number of histogram bins: -70 .. +10 LUFS */
+#define LSP_DSP_LOUDNESS_SILENCE                -120.0f     /* Loudness reported for silence or lack of data, LUFS */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+    #pragma pack(push, 1)
+        /**
+         * Loudness meter state, initialized by loudness_init
+         */
+        typedef struct LSP_DSP_LIB_TYPE(loudness_t)
+        {
+            float       kw[12];     // K-weighting filter: b0, b1, b2, a1, a2 of high-shelf and high-pass stages, padding
+            float       d[4 * LSP_DSP_LOUDNESS_MAX_CHANNELS];  // Filter memory, 4 rows of per-channel values
+            float       ms[LSP_DSP_LOUDNESS_MAX_CHANNELS];     // Sums of squares of the current sub-block
+            float       weight[LSP_DSP_LOUDNESS_MAX_CHANNELS]; // Channel weights G[c], 1.0 by default
+            float       power[LSP_DSP_LOUDNESS_SHORT_BLOCKS];  // Ring buffer of sub-block powers
+            uint32_t    channels;   // Number of channels
+            uint32_t    block_size; // Number of samples in the 100 ms sub-block
+            uint32_t    offset;     // Number of samples accumulated in the current sub-block
+            uint32_t    head;       // Position of the next sub-block in the ring buffer
+            uint32_t    blocks;     // Number of complete sub-blocks
+            uint32_t    __pad[3];   // Padding
+            uint32_t    hist_i[LSP_DSP_LOUDNESS_HIST_BINS];    // Histogram of 400 ms blocks for integrated loudness
+            uint32_t    hist_s[LSP_DSP_LOUDNESS_HIST_BINS];    // Histogram of short-term values for loudness range
+        } LSP_DSP_LIB_TYPE(loudness_t);
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/**
+ * Initialize the loudness meter and reset it's state. All channel weights are set to 1.0,
+ * for the 5.1 layout the caller should set weights of surround channels to 1.41 and the
+ * weight of LFE channel to 0.0
+ *
+ * @param l loudness meter to initialize
+ * @param channels number of channels, 1..LSP_DSP_LOUDNESS_MAX_CHANNELS
+ * @param sample_rate sample rate in Hz
+ */
+LSP_DSP_LIB_SYMBOL(void, loudness_init, LSP_DSP_LIB_TYPE(loudness_t) *l, size_t channels, size_t sample_rate);
+
+/**
+ * Reset the state of the loudness meter: filter memory, sub-blocks and histograms,
+ * the filter coefficients and channel weights are kept
+ *
+ * @param l loudness meter
+ */
+LSP_DSP_LIB_SYMBOL(void, loudness_reset, LSP_DSP_LIB_TYPE(loudness_t) *l);
+
+/**
+ * Apply K-weighting filter to each channel and accumulate squares of filtered samples
+ * to l->ms without closing the sub-block, the low-level part of loudness_process
+ *
+ * @param l loudness meter
+ * @param src array of l->channels source buffers
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, loudness_accumulate, LSP_DSP_LIB_TYPE(loudness_t) *l, const float **src, size_t count);
+
+/**
+ * Process the multichannel signal, close the 100 ms sub-blocks and update histograms
+ *
+ * @param l loudness meter
+ * @param src array of l->channels source buffers
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, loudness_process, LSP_DSP_LIB_TYPE(loudness_t) *l, const float **src, size_t count);
+
+/**
+ * Get the momentary loudness (400 ms window)
+ *
+ * @param l loudness meter
+ * @return momentary loudness, LUFS
+ */
+LSP_DSP_LIB_SYMBOL(float, loudness_momentary, const LSP_DSP_LIB_TYPE(loudness_t) *l);
+
+/**
+ * Get the short-term loudness (3 s window)
+ *
+ * @param l loudness meter
+ * @return short-term loudness, LUFS
+ */
+LSP_DSP_LIB_SYMBOL(float, loudness_short_term, const LSP_DSP_LIB_TYPE(loudness_t) *l);
+
+/**
+ * Get the gated integrated loudness since the last reset
+ *
+ * @param l loudness meter
+ * @return integrated loudness, LUFS
+ */
+LSP_DSP_LIB_SYMBOL(float, loudness_integrated, const LSP_DSP_LIB_TYPE(loudness_t) *l);
+
+/**
+ * Get the loudness range since the last reset
+ *
+ * @param l loudness meter
+ * @return loudness range, LU, zero if there are not enough data
+ */
+LSP_DSP_LIB_SYMBOL(float, loudness_range, const LSP_DSP_LIB_TYPE(loudness_t) *l);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_LOUDNESS_H_ */
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_NOISE_H_
+#define LSP_PLUG_IN_DSP_COMMON_NOISE_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+  NOISE GENERATORS
+
+    The generator consists of LSP_DSP_NOISE_LANES independent xorshift128 generators
+    (G. Marsaglia, "Xorshift RNGs", 2003), one per lane:
+
+      t     = x ^ (x << 11)
+      x, y, z, w = y, z, w, w ^ (w >> 19) ^ t ^ (t >> 8)
+
+    One step advances all lanes and produces LSP_DSP_NOISE_LANES random words, sample i
+    of the step is taken from lane i. The state words of each lane are stored as a ring
+    of four rows, so a step overwrites only the oldest row. The upper 23 bits of each
+    word form the mantissa of a float u in the range [1, 2), which gives:
+
+      uniform   = k * (2*u - 3)                         in [-k, k), 1 step per 8 samples
+      tpdf      = k * (u1 + u2 - 3)                     in [-k, k), 2 steps per 8 samples
+      gaussian  = s * sqrt(3) * (u1 + u2 + u3 + u4 - 6)     4 steps per 8 samples
+
+    The gaussian noise is the Irwin-Hall approximation with zero mean and standard
+    deviation s, bounded by +/- 2*sqrt(3)*s. The pink noise is generated by the
+    Voss-McCartney algorithm with LSP_DSP_NOISE_PINK_ROWS rows: row r is replaced by a
+    new random value every 2^(r+1) samples (the last row every 2^r samples) and the output
+    is the sum of all rows and one more white noise sample, normalized to the RMS of the
+    uniform noise of amplitude k.
+
+    A tail of less than 8 samples still makes the whole steps, the unused samples are
+    dropped. So the output depends only on the seed and the sequence of the calls, and
+    all implementations produce the same sequence.
+ */
+
+#define LSP_DSP_NOISE_LANES             8           /* Number of independent generators */
+#define LSP_DSP_NOISE_PINK_ROWS         16          /* Number of rows of the pink noise generator */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+    #pragma pack(push, 1)
+        typedef struct LSP_DSP_LIB_TYPE(noise_t)
+        {
+            uint32_t    s[4][LSP_DSP_NOISE_LANES];      // Ring of xorshift128 state rows
+            float       rows[LSP_DSP_NOISE_PINK_ROWS];  // Rows of the pink noise generator
+            uint32_t    index;                          // Index of the oldest state row in the ring
+            uint32_t    counter;                        // Counter of 8-sample blocks of the pink noise
+        } LSP_DSP_LIB_TYPE(noise_t);
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/**
+ * Initialize the noise generator
+ *
+ * @param n noise generator to initialize
+ * @param seed seed, generators with the same seed produce the same noise
+ */
+LSP_DSP_LIB_SYMBOL(void, noise_init, LSP_DSP_LIB_TYPE(noise_t) *n, uint32_t seed);
+
+/**
+ * Generate uniform white noise in the range [-k, k)
+ *
+ * @param dst destination buffer
+ * @param n noise generator
+ * @param k amplitude of the noise
+ * @param count number of samples to generate
+ */
+LSP_DSP_LIB_SYMBOL(void, noise_uniform, float *dst, LSP_DSP_LIB_TYPE(noise_t) *n, float k, size_t count);
+
+/**
+ * Generate white noise with triangular probability density in the range [-k, k)
+ *
+ * @param dst destination buffer
+ * @param n noise generator
+ * @param k amplitude of the noise
+ * @param count number of samples to generate
+ */
+LSP_DSP_LIB_SYMBOL(void, noise_tpdf, float *dst, LSP_DSP_LIB_TYPE(noise_t) *n, float k, size_t count);
+
+/**
+ * Generate approximately gaussian white noise with zero mean
+ *
+ * @param dst destination buffer
+ * @param n noise generator
+ * @param s standard deviation of the noise
+ * @param count number of samples to generate
+ */
+LSP_DSP_LIB_SYMBOL(void, noise_gaussian, float *dst, LSP_DSP_LIB_TYPE(noise_t) *n, float s, size_t count);
+
+/**
+ * Generate pink noise with the RMS of the uniform noise of the same amplitude
+ *
+ * @param dst destination buffer
+ * @param n noise generator
+ * @param k amplitude of the noise
+ * @param count number of samples to generate
+ */
+LSP_DSP_LIB_SYMBOL(void, noise_pink, float *dst, LSP_DSP_LIB_TYPE(noise_t) *n, float k, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_NOISE_H_ */
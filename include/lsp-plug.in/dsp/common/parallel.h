@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_PARALLEL_H_
+#define LSP_PLUG_IN_DSP_COMMON_PARALLEL_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+#include <lsp-plug.in/dsp/common/3dmath/types.h>
+
+/*
+  MULTI-THREADED PROCESSING
+
+    Functions with '_mt' suffix split the work into chunks and process them by the internal
+    pool of worker threads and the calling thread. The size of chunks depends only on the
+    size of the input data, so the result is bit-exact to the single-threaded call of
+    the same kernel for any number of threads.
+
+    The pool is empty by default, all '_mt' functions are executed by the calling thread
+    until set_threads() is called. Worker threads inherit flush-to-zero and
+    denormals-are-zero mode of the calling thread (see dsp::start()) for each call.
+
+    Only one '_mt' call is served by the pool at a time, concurrent calls from other threads
+    are executed by these threads without any help from the pool. These functions cause
+    thread synchronization and should not be used for realtime processing.
+ */
+
+/**
+ * Set the number of threads used by '_mt' functions, including the calling thread.
+ * Blocks until the currently running '_mt' call completes.
+ *
+ * @param count number of threads, 0 means the number of available CPUs, 1 disables the pool
+ * @return actual number of threads
+ */
+LSP_DSP_LIB_SYMBOL(size_t, set_threads, size_t count);
+
+/**
+ * Get the number of threads used by '_mt' functions, including the calling thread
+ *
+ * @return number of threads
+ */
+LSP_DSP_LIB_SYMBOL(size_t, get_threads, );
+
+/** Multi-threaded add2: dst[i] = dst[i] + src[i]
+ *
+ * @param dst destination
+ * @param src source
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, add2_mt, float *dst, const float *src, size_t count);
+
+/** Multi-threaded sub2: dst[i] = dst[i] - src[i]
+ *
+ * @param dst destination
+ * @param src source
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, sub2_mt, float *dst, const float *src, size_t count);
+
+/** Multi-threaded mul2: dst[i] = dst[i] * src[i]
+ *
+ * @param dst destination
+ * @param src source
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, mul2_mt, float *dst, const float *src, size_t count);
+
+/** Multi-threaded div2: dst[i] = dst[i] / src[i]
+ *
+ * @param dst destination
+ * @param src source
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, div2_mt, float *dst, const float *src, size_t count);
+
+/** Multi-threaded add3: dst[i] = src1[i] + src2[i]
+ *
+ * @param dst destination
+ * @param src1 first source
+ * @param src2 second source
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, add3_mt, float *dst, const float *src1, const float *src2, size_t count);
+
+/** Multi-threaded sub3: dst[i] = src1[i] - src2[i]
+ *
+ * @param dst destination
+ * @param src1 first source
+ * @param src2 second source
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, sub3_mt, float *dst, const float *src1, const float *src2, size_t count);
+
+/** Multi-threaded mul3: dst[i] = src1[i] * src2[i]
+ *
+ * @param dst destination
+ * @param src1 first source
+ * @param src2 second source
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, mul3_mt, float *dst, const float *src1, const float *src2, size_t count);
+
+/** Multi-threaded div3: dst[i] = src1[i] / src2[i]
+ *
+ * @param dst destination
+ * @param src1 first source
+ * @param src2 second source
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, div3_mt, float *dst, const float *src1, const float *src2, size_t count);
+
+/** Multi-threaded fmadd3: dst[i] = dst[i] + a[i] * b[i]
+ *
+ * @param dst destination
+ * @param a multiplier
+ * @param b multiplier
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, fmadd3_mt, float *dst, const float *a, const float *b, size_t count);
+
+/** Multi-threaded fmadd4: dst[i] = a[i] + b[i] * c[i]
+ *
+ * @param dst destination
+ * @param a addendum
+ * @param b multiplier
+ * @param c multiplier
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, fmadd4_mt, float *dst, const float *a, const float *b, const float *c, size_t count);
+
+/** Multi-threaded direct_fft_batch(), channels are distributed between threads
+ *
+ * @param dst_re array of pointers to real parts of spectrum
+ * @param dst_im array of pointers to imaginary parts of spectrum
+ * @param src_re array of pointers to real parts of signal
+ * @param src_im array of pointers to imaginary parts of signal
+ * @param rank the rank of FFT
+ * @param count number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, direct_fft_batch_mt, float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+
+/** Multi-threaded packed_direct_fft_batch(), channels are distributed between threads
+ *
+ * @param dst array of pointers to complex spectrums [re, im, re, im ...]
+ * @param src array of pointers to complex signals [re, im, re, im ...]
+ * @param rank the rank of FFT
+ * @param count number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, packed_direct_fft_batch_mt, float **dst, const float * const *src, size_t rank, size_t count);
+
+/** Multi-threaded reverse_fft_batch(), channels are distributed between threads
+ *
+ * @param dst_re array of pointers to real parts of signal
+ * @param dst_im array of pointers to imaginary parts of signal
+ * @param src_re array of pointers to real parts of spectrum
+ * @param src_im array of pointers to imaginary parts of spectrum
+ * @param rank the rank of FFT
+ * @param count number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, reverse_fft_batch_mt, float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+
+/** Multi-threaded packed_reverse_fft_batch(), channels are distributed between threads
+ *
+ * @param dst array of pointers to complex signals [re, im, re, im ...]
+ * @param src array of pointers to complex spectrums [re, im, re, im ...]
+ * @param rank the rank of FFT
+ * @param count number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, packed_reverse_fft_batch_mt, float **dst, const float * const *src, size_t rank, size_t count);
+
+/** Convolve long signal with fast convolution data by series of fastconv_parse_apply()
+ * calls for each 2^(rank-1) samples of the signal. Blocks with even and odd numbers are
+ * processed in two passes to prevent overlapping of the output of different threads.
+ * The function allocates temporary buffers for each thread.
+ *
+ * @param dst destination buffer of count + 2^(rank-1) samples, is overwritten
+ * @param c fast convolution data of 2^(rank+1) floats
+ * @param src source signal
+ * @param rank the convolution rank, should be at least 3
+ * @param count number of samples in the source signal
+ */
+LSP_DSP_LIB_SYMBOL(void, fastconv_convolve_mt, float *dst, const float *c, const float *src, size_t rank, size_t count);
+
+/** Multi-threaded calc_bound_box()
+ *
+ * @param b bounding box to store the result
+ * @param p array of points
+ * @param n number of points
+ */
+LSP_DSP_LIB_SYMBOL(void, calc_bound_box_mt, LSP_DSP_LIB_TYPE(bound_box3d_t) *b, const LSP_DSP_LIB_TYPE(point3d_t) *p, size_t n);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_PARALLEL_H_ */
@@ -24,6 +24,14 @@
 
 #include <lsp-plug.in/dsp/common/types.h>
 
+/**
+ * These constants define the number of allpass sections in the halfband filter,
+ * it's alignment and maximum number of cascaded 2x oversampling stages
+ */
+#define LSP_DSP_HALFBAND_ITEMS                      8
+#define LSP_DSP_HALFBAND_ALIGN                      0x40
+#define LSP_DSP_HALFBAND_STAGES                     3
+
 #ifdef __cplusplus
 namespace lsp
 {
@@ -42,6 +50,41 @@ namespace lsp
          */
         typedef void (* LSP_DSP_LIB_TYPE(resampling_function_t))(float *dst, const float *src, size_t count);
 
+    #pragma pack(push, 1)
+
+        /**
+         * Polyphase IIR halfband filter used for 2x oversampling stages.
+         *
+         * The filter is built of two parallel paths, each path is a cascade of
+         * first-order allpass sections in z^-2 domain:
+         *
+         *       x  ┌──────┐   ┌──────┐   ┌──────┐   ┌──────┐
+         *     ──┬─►│ A[0] │──►│ A[2] │──►│ A[4] │──►│ A[6] │──► path 0
+         *       │  └──────┘   └──────┘   └──────┘   └──────┘
+         *       │  ┌──────┐   ┌──────┐   ┌──────┐   ┌──────┐
+         *       └─►│ A[1] │──►│ A[3] │──►│ A[5] │──►│ A[7] │──► path 1
+         *          └──────┘   └──────┘   └──────┘   └──────┘
+         *
+         *     A[i]: y = a[i] * (x - y[i]) + x[i]; x[i] = x; y[i] = y
+         *
+         * Both paths are interleaved in memory, so sections of the same stage
+         * occupy adjacent lanes. This allows to process all sections at once
+         * with SIMD in a pipeline mode like it is done for biquad filter banks.
+         *
+         * It should be aligned at least to 16-byte boundary due to
+         * alignment restrictions of some different hardware architectures
+         * For best purpose it should be aligned to 64-byte boundary
+         */
+        typedef struct LSP_DSP_LIB_TYPE(halfband_t)
+        {
+            float   x[LSP_DSP_HALFBAND_ITEMS];      // Input memory of allpass sections
+            float   y[LSP_DSP_HALFBAND_ITEMS];      // Output memory of allpass sections
+            float   a[LSP_DSP_HALFBAND_ITEMS];      // Allpass coefficients
+            float   __pad[8];
+        } __lsp_aligned(LSP_DSP_HALFBAND_ALIGN) LSP_DSP_LIB_TYPE(halfband_t);
+
+    #pragma pack(pop)
+
 #ifdef __cplusplus
     }
 }
@@ -227,4 +270,82 @@ LSP_DSP_LIB_SYMBOL(void, downsample_6x, float *dst, const float *src, size_t cou
  */
 LSP_DSP_LIB_SYMBOL(void, downsample_8x, float *dst, const float *src, size_t count);
 
+/** Design polyphase IIR halfband filter and reset it's memory.
+ * The filter passes band [0 .. 0.25 - transition/2] and attenuates band [0.25 + transition/2 .. 0.5]
+ * of the higher sample rate. Narrower transition band gives lower stopband attenuation:
+ * about 69 dB for transition = 0.01, about 107 dB for transition = 0.05
+ *
+ * @param f halfband filter to initialize
+ * @param transition normalized width of the transition band (0 < transition < 0.5)
+ */
+LSP_DSP_LIB_SYMBOL(void, halfband_init, LSP_DSP_LIB_TYPE(halfband_t) *f, float transition);
+
+/** Reset memory of the halfband filter without changing it's coefficients
+ *
+ * @param f halfband filter to reset
+ */
+LSP_DSP_LIB_SYMBOL(void, halfband_reset, LSP_DSP_LIB_TYPE(halfband_t) *f);
+
+/** Perform 2x upsampling with polyphase IIR halfband filter.
+ * Unlike lanczos resampling, there is no convolution tail, the filter state is kept
+ * in the filter memory between calls.
+ *
+ * @param dst destination buffer of count*2 samples
+ * @param src source buffer of count samples
+ * @param count number of source samples
+ * @param f halfband filter
+ */
+LSP_DSP_LIB_SYMBOL(void, halfband_upsample_2x, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(halfband_t) *f);
+
+/** Perform 4x upsampling with two cascaded polyphase IIR halfband filters.
+ * Filter f[0] operates at 2x sample rate, filter f[1] at 4x sample rate.
+ *
+ * @param dst destination buffer of count*4 samples
+ * @param src source buffer of count samples
+ * @param count number of source samples
+ * @param f array of two halfband filters
+ */
+LSP_DSP_LIB_SYMBOL(void, halfband_upsample_4x, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(halfband_t) *f);
+
+/** Perform 8x upsampling with three cascaded polyphase IIR halfband filters.
+ * Filter f[0] operates at 2x sample rate, filter f[1] at 4x, filter f[2] at 8x sample rate.
+ *
+ * @param dst destination buffer of count*8 samples
+ * @param src source buffer of count samples
+ * @param count number of source samples
+ * @param f array of three halfband filters
+ */
+LSP_DSP_LIB_SYMBOL(void, halfband_upsample_8x, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(halfband_t) *f);
+
+/** Perform 2x downsampling with polyphase IIR halfband filter.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*2 samples
+ * @param count number of destination samples
+ * @param f halfband filter
+ */
+LSP_DSP_LIB_SYMBOL(void, halfband_downsample_2x, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(halfband_t) *f);
+
+/** Perform 4x downsampling with two cascaded polyphase IIR halfband filters.
+ * Filter f[0] operates at 2x sample rate, filter f[1] at 4x sample rate,
+ * so the same design can be used for upsampling and downsampling.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*4 samples
+ * @param count number of destination samples
+ * @param f array of two halfband filters
+ */
+LSP_DSP_LIB_SYMBOL(void, halfband_downsample_4x, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(halfband_t) *f);
+
+/** Perform 8x downsampling with three cascaded polyphase IIR halfband filters.
+ * Filter f[0] operates at 2x sample rate, filter f[1] at 4x, filter f[2] at 8x sample rate,
+ * so the same design can be used for upsampling and downsampling.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*8 samples
+ * @param count number of destination samples
+ * @param f array of three halfband filters
+ */
+LSP_DSP_LIB_SYMBOL(void, halfband_downsample_8x, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(halfband_t) *f);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_RESAMPLING_H_ */
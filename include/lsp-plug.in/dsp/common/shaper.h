@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_SHAPER_H_
+#define LSP_PLUG_IN_DSP_COMMON_SHAPER_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+#include <lsp-plug.in/dsp/common/resampling.h>
+
+/*
+  TABLE-DRIVEN WAVESHAPER
+
+    The transfer curve is defined by N >= 2 points c[0] .. c[N-1] uniformly spread over
+    the input range [xmin, xmax]. Each input sample x is mapped to the table position:
+
+      u     = clamp((x - xmin) * (N - 1) / (xmax - xmin), 0, N - 1)
+      y     = interpolate(c, u)
+
+    Out-of-range input is clamped to the end points of the curve without branches, NaN
+    input is mapped to c[0]. The table buffer stores the curve with LSP_DSP_SHAPER_GUARD
+    extrapolated guard points (one before and two after the curve), so 4-point cubic
+    interpolation never reads outside of the buffer. The cubic interpolation is the
+    Catmull-Rom spline, the same as DELAY_HERMITE of the delay line.
+
+    Waveshaping generates harmonics that may alias, shaper_oversampled() wraps the
+    shaper with 2x or 4x oversampling by the polyphase IIR halfband filters.
+ */
+
+#define LSP_DSP_SHAPER_GUARD            3           /* Number of additional points of the table buffer */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+        typedef enum LSP_DSP_LIB_TYPE(shaper_interp_t)
+        {
+            SHAPER_LINEAR,          /* Linear interpolation */
+            SHAPER_CUBIC            /* 4-point cubic Hermite (Catmull-Rom) interpolation */
+        } LSP_DSP_LIB_TYPE(shaper_interp_t);
+
+    #pragma pack(push, 1)
+        typedef struct LSP_DSP_LIB_TYPE(shaper_t)
+        {
+            float       scale;      // Multiplier of the input to get the table position
+            float       offset;     // Offset of the input to get the table position
+            float       last;       // Position of the last point of the curve, N - 1
+            uint32_t    size;       // Number of points of the curve
+        } LSP_DSP_LIB_TYPE(shaper_t);
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/**
+ * Initialize the waveshaper and fill the table buffer
+ *
+ * @param buf table buffer of size + LSP_DSP_SHAPER_GUARD floats
+ * @param s waveshaper descriptor
+ * @param curve points of the transfer curve
+ * @param size number of points of the curve, at least 2
+ * @param xmin input value that corresponds to the first point of the curve
+ * @param xmax input value that corresponds to the last point of the curve, should be greater than xmin
+ */
+LSP_DSP_LIB_SYMBOL(void, shaper_init, float *buf, LSP_DSP_LIB_TYPE(shaper_t) *s, const float *curve, size_t size, float xmin, float xmax);
+
+/**
+ * Map samples through the transfer curve with linear interpolation
+ *
+ * @param dst destination buffer, may be the same as the source
+ * @param src source buffer
+ * @param buf table buffer initialized by shaper_init()
+ * @param s waveshaper descriptor
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, shaper_linear, float *dst, const float *src, const float *buf, const LSP_DSP_LIB_TYPE(shaper_t) *s, size_t count);
+
+/**
+ * Map samples through the transfer curve with cubic Hermite interpolation
+ *
+ * @param dst destination buffer, may be the same as the source
+ * @param src source buffer
+ * @param buf table buffer initialized by shaper_init()
+ * @param s waveshaper descriptor
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, shaper_cubic, float *dst, const float *src, const float *buf, const LSP_DSP_LIB_TYPE(shaper_t) *s, size_t count);
+
+/**
+ * Map samples through the transfer curve at the oversampled rate:
+ * upsample, apply the shaper and downsample with halfband filters
+ *
+ * @param dst destination buffer, may be the same as the source
+ * @param src source buffer
+ * @param tmp temporary buffer of count * factor samples
+ * @param buf table buffer initialized by shaper_init()
+ * @param s waveshaper descriptor
+ * @param interp interpolation, see shaper_interp_t
+ * @param factor oversampling factor: 1, 2 or 4
+ * @param up array of log2(factor) halfband filters for upsampling
+ * @param down array of log2(factor) halfband filters for downsampling
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, shaper_oversampled, float *dst, const float *src, float *tmp,
+        const float *buf, const LSP_DSP_LIB_TYPE(shaper_t) *s, size_t interp, size_t factor,
+        LSP_DSP_LIB_TYPE(halfband_t) *up, LSP_DSP_LIB_TYPE(halfband_t) *down, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_SHAPER_H_ */
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_WAVEFORM_H_
+#define LSP_PLUG_IN_DSP_COMMON_WAVEFORM_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+  WAVEFORM MIPMAP
+
+    The mipmap is a pyramid of summaries of the signal used for drawing the waveform
+    at any zoom level without scanning all samples. Each entry of the first level
+    summarizes 2^shift samples of the signal, each entry of the next level summarizes
+    two entries of the previous level. The last level always consists of one entry.
+    The entry stores the minimum, the maximum and the sum of squares of the samples,
+    so the RMS value can be computed for any range of entries.
+
+    All levels are stored in one array of waveform_peak_t entries allocated by the
+    caller. The signal can be appended to the mipmap by arbitrary portions, the last
+    entry of each level always summarizes all samples that are already appended.
+ */
+
+#define LSP_DSP_WAVEFORM_MAX_LEVELS     32
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+    #pragma pack(push, 1)
+
+        /**
+         * Summary of the range of samples
+         */
+        typedef struct LSP_DSP_LIB_TYPE(waveform_peak_t)
+        {
+            float       min;            // Minimum value
+            float       max;            // Maximum value
+            float       sqr;            // Sum of squares
+        } LSP_DSP_LIB_TYPE(waveform_peak_t);
+
+        /**
+         * Waveform mipmap descriptor
+         */
+        typedef struct LSP_DSP_LIB_TYPE(waveform_mipmap_t)
+        {
+            uint32_t    shift;          // Log2 of number of samples per entry of the first level
+            uint32_t    levels;         // Number of levels
+            uint32_t    capacity;       // Maximum number of samples
+            uint32_t    count;          // Number of appended samples
+            uint32_t    offset[LSP_DSP_WAVEFORM_MAX_LEVELS]; // Offset of each level in the array of entries
+        } LSP_DSP_LIB_TYPE(waveform_mipmap_t);
+
+    #pragma pack(pop)
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/** Initialize empty waveform mipmap
+ *
+ * @param m mipmap descriptor to initialize
+ * @param capacity maximum number of samples, 1..2^31-1
+ * @param shift log2 of number of samples per entry of the first level, 0..16
+ * @return number of waveform_peak_t entries to allocate, zero if parameters are invalid
+ */
+LSP_DSP_LIB_SYMBOL(size_t, waveform_mipmap_init, LSP_DSP_LIB_TYPE(waveform_mipmap_t) *m, size_t capacity, size_t shift);
+
+/** Append samples to the waveform mipmap, only the affected entries are updated
+ *
+ * @param m mipmap descriptor
+ * @param data array of mipmap entries
+ * @param src samples to append
+ * @param count number of samples to append
+ * @return number of appended samples, may be less than count if the capacity is reached
+ */
+LSP_DSP_LIB_SYMBOL(size_t, waveform_mipmap_append, LSP_DSP_LIB_TYPE(waveform_mipmap_t) *m,
+        LSP_DSP_LIB_TYPE(waveform_peak_t) *data, const float *src, size_t count);
+
+/** Compute envelope of the waveform for the set of pixel columns. The column c covers
+ * the range of samples [first + c*step, first + (c+1)*step), the level of the mipmap
+ * is selected by the step, so the number of entries scanned per column is constant.
+ * The ranges are aligned to the entries of the selected level, if step is less than
+ * the number of samples per entry of the first level and the signal is passed, the
+ * envelope is computed directly from the signal. Columns beyond the appended samples
+ * are set to zero.
+ *
+ * @param min destination buffer to store minimums
+ * @param max destination buffer to store maximums
+ * @param rms destination buffer to store RMS values, may be NULL
+ * @param m mipmap descriptor
+ * @param data array of mipmap entries
+ * @param src the signal of at least m->count samples, may be NULL
+ * @param first index of the first sample of the first column
+ * @param step number of samples per column, should be positive
+ * @param count number of columns
+ */
+LSP_DSP_LIB_SYMBOL(void, waveform_mipmap_query, float *min, float *max, float *rms,
+        const LSP_DSP_LIB_TYPE(waveform_mipmap_t) *m, const LSP_DSP_LIB_TYPE(waveform_peak_t) *data,
+        const float *src, size_t first, float step, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_WAVEFORM_H_ */
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_XCORR_H_
+#define LSP_PLUG_IN_DSP_COMMON_XCORR_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+/*
+  GENERALIZED CROSS-CORRELATION
+
+    The cross-correlation of frames a and b of 2^(rank-1) samples is computed from
+    their spectra A and B zero-padded to 2^rank samples, so the result is free of
+    circular aliasing for lags up to +/- (2^(rank-1) - 1) samples (C. Knapp, G. Carter,
+    "The generalized correlation method for estimation of time delay", 1976):
+
+      G[j]  = conj(A[j]) * B[j]
+      R[j]  = R[j] + k * (W[j] * G[j] - R[j])
+      r[n]  = IFFT(R)[n]
+
+    The weighting W[j] is selected by the xcorr_weight_t mode:
+
+      plain:    W[j] = 1
+      phat:     W[j] = 1 / (|G[j]| + eps), the phase transform that whitens the
+                cross-spectrum and leaves the sharp peak at the lag for any signal
+
+    The smoothing factor k = 1 gives the cross-correlation of the current frames,
+    0 < k < 1 gives the exponentially averaged cross-spectrum for tracking the drift
+    of the delay over the stream: each new block requires only one forward FFT per
+    channel, the spectrum of the reference channel can be shared between pairs.
+
+    The peak at the positive lag n means that the signal b is delayed by n samples
+    relatively to the signal a.
+ */
+
+#ifdef __cplusplus
+namespace lsp
+{
+    namespace dsp
+    {
+#endif /* __cplusplus */
+
+        typedef enum LSP_DSP_LIB_TYPE(xcorr_weight_t)
+        {
+            XCORR_PLAIN,            /* Plain cross-correlation */
+            XCORR_PHAT              /* Phase transform weighting */
+        } LSP_DSP_LIB_TYPE(xcorr_weight_t);
+
+#ifdef __cplusplus
+    }
+}
+#endif /* __cplusplus */
+
+/** Compute the spectrum of the frame for cross-correlation
+ *
+ * @param dst destination buffer of 2^(rank+1) floats to store packed complex spectrum
+ * @param src source frame of 2^(rank-1) samples
+ * @param rank rank of the FFT
+ */
+LSP_DSP_LIB_SYMBOL(void, xcorr_spectrum, float *dst, const float *src, size_t rank);
+
+/** Compute the weighted cross-spectrum of two spectra and add it to the smoothed
+ * cross-spectrum: acc = acc + k * (W * conj(a) * b - acc). The accumulator
+ * should be zeroed before the first call.
+ *
+ * @param acc packed complex accumulator of the cross-spectrum
+ * @param a packed complex spectrum of the first (reference) signal
+ * @param b packed complex spectrum of the second signal
+ * @param k smoothing factor, 1 to replace the accumulator with the new cross-spectrum
+ * @param weight weighting mode, see xcorr_weight_t
+ * @param count number of complex bins, 2^rank for the spectra computed by xcorr_spectrum()
+ */
+LSP_DSP_LIB_SYMBOL(void, xcorr_accumulate, float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+
+/** Compute the cross-correlation from the cross-spectrum and find the lag of its maximum
+ * with sub-sample precision by parabolic interpolation
+ *
+ * @param value pointer to store the interpolated value of the cross-correlation at the peak, may be NULL
+ * @param tmp temporary buffer of 2^(rank+1) floats, contains the cross-correlation as packed complex data on return
+ * @param acc packed complex cross-spectrum of 2^rank bins
+ * @param max_lag maximum absolute lag to search, limited by 2^(rank-1) - 1
+ * @param rank rank of the FFT
+ * @return lag of the peak in samples
+ */
+LSP_DSP_LIB_SYMBOL(float, xcorr_peak, float *value, float *tmp, const float *acc, size_t max_lag, size_t rank);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_XCORR_H_ */
@@ -48,20 +48,29 @@
 #include <lsp-plug.in/dsp/common/context.h>
 #include <lsp-plug.in/dsp/common/convolution.h>
 #include <lsp-plug.in/dsp/common/copy.h>
+#include <lsp-plug.in/dsp/common/cqt.h>
+#include <lsp-plug.in/dsp/common/dynamics.h>
 #include <lsp-plug.in/dsp/common/fastconv.h>
 #include <lsp-plug.in/dsp/common/fft.h>
 #include <lsp-plug.in/dsp/common/filters.h>
 #include <lsp-plug.in/dsp/common/float.h>
 #include <lsp-plug.in/dsp/common/graphics.h>
 #include <lsp-plug.in/dsp/common/hmath.h>
+#include <lsp-plug.in/dsp/common/ir.h>
+#include <lsp-plug.in/dsp/common/loudness.h>
 #include <lsp-plug.in/dsp/common/misc.h>
 #include <lsp-plug.in/dsp/common/mix.h>
 #include <lsp-plug.in/dsp/common/msmatrix.h>
+#include <lsp-plug.in/dsp/common/noise.h>
+#include <lsp-plug.in/dsp/common/parallel.h>
 #include <lsp-plug.in/dsp/common/pcomplex.h>
 #include <lsp-plug.in/dsp/common/pmath.h>
 #include <lsp-plug.in/dsp/common/resampling.h>
 #include <lsp-plug.in/dsp/common/search.h>
+#include <lsp-plug.in/dsp/common/shaper.h>
 #include <lsp-plug.in/dsp/common/smath.h>
+#include <lsp-plug.in/dsp/common/waveform.h>
+#include <lsp-plug.in/dsp/common/xcorr.h>
 #include <lsp-plug.in/dsp/common/interpolation.h>
 
 #undef LSP_DSP_LIB_CXX_IFACE
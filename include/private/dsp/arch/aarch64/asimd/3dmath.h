@@ -0,0 +1,1347 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_3DMATH_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_3DMATH_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        IF_ARCH_AARCH64(
+            static const uint32_t matrix3d_const[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0x3f800000),   // 1.0
+                LSP_DSP_VEC4(0x7f800000),   // +inf
+                LSP_DSP_VEC4(0xff800000),   // -inf
+                LSP_DSP_VEC4(0x3727c5ac),   // +DSP_3D_TOLERANCE
+                LSP_DSP_VEC4(0xb727c5ac),   // -DSP_3D_TOLERANCE
+            };
+        )
+
+        #define MATRIX3D_LOAD(TRANSLATE) \
+            __ASM_EMIT("ldp             q16, q17, [%[m], #0x00]")       /* v16  = m0  m1  m2  m3,  v17 = m4  m5  m6  m7 */ \
+            __ASM_EMIT("ldp             q18, q19, [%[m], #0x20]")       /* v18  = m8  m9  m10 m11, v19 = m12 m13 m14 m15 */ \
+            __ASM_EMIT("ldr             q24, [%[MC], #0x00]")           /* v24  = 1 */ \
+            TRANSLATE( \
+                __ASM_EMIT("dup             v20.4s, v19.s[0]")          /* v20  = m12 */ \
+                __ASM_EMIT("dup             v21.4s, v19.s[1]")          /* v21  = m13 */ \
+                __ASM_EMIT("dup             v22.4s, v19.s[2]")          /* v22  = m14 */ \
+                __ASM_EMIT("dup             v23.4s, v19.s[3]")          /* v23  = m15 */ \
+            )
+
+        /* Transform four points
+         * v0 = x, v1 = y, v2 = z
+         * Output: v4 = rx, v5 = ry, v6 = rz, v7 = rw, homogenized
+         */
+        #define MATRIX3D_CORE(TRANSLATE) \
+            __ASM_EMIT("fmul            v4.4s, v0.4s, v16.s[0]")        /* v4   = m0*x */ \
+            __ASM_EMIT("fmul            v5.4s, v0.4s, v16.s[1]")        /* v5   = m1*x */ \
+            __ASM_EMIT("fmul            v6.4s, v0.4s, v16.s[2]")        /* v6   = m2*x */ \
+            __ASM_EMIT("fmul            v7.4s, v0.4s, v16.s[3]")        /* v7   = m3*x */ \
+            __ASM_EMIT("fmla            v4.4s, v1.4s, v17.s[0]")        /* v4   = m0*x + m4*y */ \
+            __ASM_EMIT("fmla            v5.4s, v1.4s, v17.s[1]")        /* v5   = m1*x + m5*y */ \
+            __ASM_EMIT("fmla            v6.4s, v1.4s, v17.s[2]")        /* v6   = m2*x + m6*y */ \
+            __ASM_EMIT("fmla            v7.4s, v1.4s, v17.s[3]")        /* v7   = m3*x + m7*y */ \
+            __ASM_EMIT("fmla            v4.4s, v2.4s, v18.s[0]")        /* v4   = m0*x + m4*y + m8*z */ \
+            __ASM_EMIT("fmla            v5.4s, v2.4s, v18.s[1]")        /* v5   = m1*x + m5*y + m9*z */ \
+            __ASM_EMIT("fmla            v6.4s, v2.4s, v18.s[2]")        /* v6   = m2*x + m6*y + m10*z */ \
+            __ASM_EMIT("fmla            v7.4s, v2.4s, v18.s[3]")        /* v7   = m3*x + m7*y + m11*z */ \
+            TRANSLATE( \
+                __ASM_EMIT("fadd            v4.4s, v4.4s, v20.4s")      /* v4   = rx */ \
+                __ASM_EMIT("fadd            v5.4s, v5.4s, v21.4s")      /* v5   = ry */ \
+                __ASM_EMIT("fadd            v6.4s, v6.4s, v22.4s")      /* v6   = rz */ \
+                __ASM_EMIT("fadd            v7.4s, v7.4s, v23.4s")      /* v7   = rw */ \
+            ) \
+            __ASM_EMIT("fcmeq           v3.4s, v7.4s, #0.0")            /* v3   = [rw == 0] */ \
+            __ASM_EMIT("and             v3.16b, v3.16b, v24.16b")       /* v3   = [rw == 0] & 1 */ \
+            __ASM_EMIT("fadd            v3.4s, v3.4s, v7.4s")           /* v3   = d = (rw == 0) ? 1 : rw */ \
+            __ASM_EMIT("fdiv            v4.4s, v4.4s, v3.4s") \
+            __ASM_EMIT("fdiv            v5.4s, v5.4s, v3.4s") \
+            __ASM_EMIT("fdiv            v6.4s, v6.4s, v3.4s") \
+            __ASM_EMIT("fdiv            v7.4s, v7.4s, v3.4s")
+
+        #define MATRIX3D_TRANSLATE(...)     __VA_ARGS__
+        #define MATRIX3D_NONE(...)
+
+        #define MATRIX3D_AOS_KERNEL(TRANSLATE) \
+            ARCH_AARCH64_ASM( \
+                MATRIX3D_LOAD(TRANSLATE) \
+                __ASM_EMIT("subs            %[n], %[n], #4") \
+                __ASM_EMIT("b.lo            2f") \
+                /* 4x blocks */ \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("ld4             {v0.4s, v1.4s, v2.4s, v3.4s}, [%[src]]") \
+                MATRIX3D_CORE(TRANSLATE) \
+                __ASM_EMIT("st4             {v4.4s, v5.4s, v6.4s, v7.4s}, [%[dst]]") \
+                __ASM_EMIT("subs            %[n], %[n], #4") \
+                __ASM_EMIT("add             %[src], %[src], #0x40") \
+                __ASM_EMIT("add             %[dst], %[dst], #0x40") \
+                __ASM_EMIT("b.hs            1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("adds            %[n], %[n], #3") \
+                __ASM_EMIT("b.lt            4f") \
+                __ASM_EMIT("3:") \
+                __ASM_EMIT("ld4             {v0.s, v1.s, v2.s, v3.s}[0], [%[src]]") \
+                MATRIX3D_CORE(TRANSLATE) \
+                __ASM_EMIT("st4             {v4.s, v5.s, v6.s, v7.s}[0], [%[dst]]") \
+                __ASM_EMIT("subs            %[n], %[n], #1") \
+                __ASM_EMIT("add             %[src], %[src], #0x10") \
+                __ASM_EMIT("add             %[dst], %[dst], #0x10") \
+                __ASM_EMIT("b.ge            3b") \
+                __ASM_EMIT("4:") \
+                : [dst] "+r" (r), [src] "+r" (src), [n] "+r" (n) \
+                : [m] "r" (m), \
+                  [MC] "r" (&matrix3d_const[0]) \
+                : "cc", "memory", \
+                  "v0", "v1", "v2", "v3", \
+                  "v4", "v5", "v6", "v7", \
+                  "v16", "v17", "v18", "v19", \
+                  "v20", "v21", "v22", "v23", \
+                  "v24" \
+            )
+
+        void apply_matrix3d_mvn(dsp::vector3d_t *r, const dsp::vector3d_t *v, const dsp::matrix3d_t *m, size_t n)
+        {
+            const dsp::vector3d_t *src = v;
+            MATRIX3D_AOS_KERNEL(MATRIX3D_NONE);
+        }
+
+        void apply_matrix3d_mpn(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n)
+        {
+            const dsp::point3d_t *src = p;
+            MATRIX3D_AOS_KERNEL(MATRIX3D_TRANSLATE);
+        }
+
+        #define MATRIX3D_SOA_KERNEL(TRANSLATE) \
+            ARCH_AARCH64_ASM( \
+                MATRIX3D_LOAD(TRANSLATE) \
+                __ASM_EMIT("subs            %[n], %[n], #4") \
+                __ASM_EMIT("b.lo            2f") \
+                /* 4x blocks */ \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("ldr             q0, [%[sx]]") \
+                __ASM_EMIT("ldr             q1, [%[sy]]") \
+                __ASM_EMIT("ldr             q2, [%[sz]]") \
+                MATRIX3D_CORE(TRANSLATE) \
+                __ASM_EMIT("str             q4, [%[dx]]") \
+                __ASM_EMIT("str             q5, [%[dy]]") \
+                __ASM_EMIT("str             q6, [%[dz]]") \
+                __ASM_EMIT("subs            %[n], %[n], #4") \
+                __ASM_EMIT("add             %[sx], %[sx], #0x10") \
+                __ASM_EMIT("add             %[sy], %[sy], #0x10") \
+                __ASM_EMIT("add             %[sz], %[sz], #0x10") \
+                __ASM_EMIT("add             %[dx], %[dx], #0x10") \
+                __ASM_EMIT("add             %[dy], %[dy], #0x10") \
+                __ASM_EMIT("add             %[dz], %[dz], #0x10") \
+                __ASM_EMIT("b.hs            1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("adds            %[n], %[n], #3") \
+                __ASM_EMIT("b.lt            4f") \
+                __ASM_EMIT("3:") \
+                __ASM_EMIT("ldr             s0, [%[sx]]") \
+                __ASM_EMIT("ldr             s1, [%[sy]]") \
+                __ASM_EMIT("ldr             s2, [%[sz]]") \
+                MATRIX3D_CORE(TRANSLATE) \
+                __ASM_EMIT("str             s4, [%[dx]]") \
+                __ASM_EMIT("str             s5, [%[dy]]") \
+                __ASM_EMIT("str             s6, [%[dz]]") \
+                __ASM_EMIT("subs            %[n], %[n], #1") \
+                __ASM_EMIT("add             %[sx], %[sx], #0x04") \
+                __ASM_EMIT("add             %[sy], %[sy], #0x04") \
+                __ASM_EMIT("add             %[sz], %[sz], #0x04") \
+                __ASM_EMIT("add             %[dx], %[dx], #0x04") \
+                __ASM_EMIT("add             %[dy], %[dy], #0x04") \
+                __ASM_EMIT("add             %[dz], %[dz], #0x04") \
+                __ASM_EMIT("b.ge            3b") \
+                __ASM_EMIT("4:") \
+                : [dx] "+r" (dx), [dy] "+r" (dy), [dz] "+r" (dz), \
+                  [sx] "+r" (sx), [sy] "+r" (sy), [sz] "+r" (sz), \
+                  [n] "+r" (n) \
+                : [m] "r" (m), \
+                  [MC] "r" (&matrix3d_const[0]) \
+                : "cc", "memory", \
+                  "v0", "v1", "v2", "v3", \
+                  "v4", "v5", "v6", "v7", \
+                  "v16", "v17", "v18", "v19", \
+                  "v20", "v21", "v22", "v23", \
+                  "v24" \
+            )
+
+        void apply_matrix3d_mv_soa(dsp::vector3d_soa_t *dst, const dsp::vector3d_soa_t *src, const dsp::matrix3d_t *m, size_t n)
+        {
+            float *dx = dst->dx, *dy = dst->dy, *dz = dst->dz;
+            const float *sx = src->dx, *sy = src->dy, *sz = src->dz;
+            MATRIX3D_SOA_KERNEL(MATRIX3D_NONE);
+        }
+
+        void apply_matrix3d_mp_soa(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n)
+        {
+            float *dx = dst->x, *dy = dst->y, *dz = dst->z;
+            const float *sx = src->x, *sy = src->y, *sz = src->z;
+            MATRIX3D_SOA_KERNEL(MATRIX3D_TRANSLATE);
+        }
+
+        void apply_matrix3d_mpn_bound_box(dsp::bound_box3d_t *b, dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n)
+        {
+            if (n <= 0)
+            {
+                dsp::calc_bound_box(b, r, 0);
+                return;
+            }
+
+            float mm[8];
+            dsp::point3d_t *dst = r;
+
+            ARCH_AARCH64_ASM(
+                MATRIX3D_LOAD(MATRIX3D_TRANSLATE)
+                __ASM_EMIT("ldp             q26, q29, [%[MC], #0x10]")      // v26  = +inf, v29 = -inf
+                __ASM_EMIT("mov             v27.16b, v26.16b")              // v27  = +inf
+                __ASM_EMIT("mov             v28.16b, v26.16b")              // v28  = +inf
+                __ASM_EMIT("mov             v30.16b, v29.16b")              // v30  = -inf
+                __ASM_EMIT("mov             v31.16b, v29.16b")              // v31  = -inf
+                __ASM_EMIT("subs            %[n], %[n], #4")
+                __ASM_EMIT("b.lo            2f")
+                // 4x blocks
+                __ASM_EMIT("1:")
+                __ASM_EMIT("ld4             {v0.4s, v1.4s, v2.4s, v3.4s}, [%[src]]")
+                MATRIX3D_CORE(MATRIX3D_TRANSLATE)
+                __ASM_EMIT("st4             {v4.4s, v5.4s, v6.4s, v7.4s}, [%[dst]]")
+                __ASM_EMIT("fminnm          v26.4s, v26.4s, v4.4s")
+                __ASM_EMIT("fminnm          v27.4s, v27.4s, v5.4s")
+                __ASM_EMIT("fminnm          v28.4s, v28.4s, v6.4s")
+                __ASM_EMIT("fmaxnm          v29.4s, v29.4s, v4.4s")
+                __ASM_EMIT("fmaxnm          v30.4s, v30.4s, v5.4s")
+                __ASM_EMIT("fmaxnm          v31.4s, v31.4s, v6.4s")
+                __ASM_EMIT("subs            %[n], %[n], #4")
+                __ASM_EMIT("add             %[src], %[src], #0x40")
+                __ASM_EMIT("add             %[dst], %[dst], #0x40")
+                __ASM_EMIT("b.hs            1b")
+                // Horizontal reduction
+                __ASM_EMIT("2:")
+                __ASM_EMIT("fminnmv         s26, v26.4s")
+                __ASM_EMIT("fminnmv         s27, v27.4s")
+                __ASM_EMIT("fminnmv         s28, v28.4s")
+                __ASM_EMIT("fmaxnmv         s29, v29.4s")
+                __ASM_EMIT("fmaxnmv         s30, v30.4s")
+                __ASM_EMIT("fmaxnmv         s31, v31.4s")
+                // 1x blocks
+                __ASM_EMIT("adds            %[n], %[n], #3")
+                __ASM_EMIT("b.lt            4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("ld4             {v0.s, v1.s, v2.s, v3.s}[0], [%[src]]")
+                MATRIX3D_CORE(MATRIX3D_TRANSLATE)
+                __ASM_EMIT("st4             {v4.s, v5.s, v6.s, v7.s}[0], [%[dst]]")
+                __ASM_EMIT("fminnm          s26, s26, s4")
+                __ASM_EMIT("fminnm          s27, s27, s5")
+                __ASM_EMIT("fminnm          s28, s28, s6")
+                __ASM_EMIT("fmaxnm          s29, s29, s4")
+                __ASM_EMIT("fmaxnm          s30, s30, s5")
+                __ASM_EMIT("fmaxnm          s31, s31, s6")
+                __ASM_EMIT("subs            %[n], %[n], #1")
+                __ASM_EMIT("add             %[src], %[src], #0x10")
+                __ASM_EMIT("add             %[dst], %[dst], #0x10")
+                __ASM_EMIT("b.ge            3b")
+                __ASM_EMIT("4:")
+                __ASM_EMIT("stp             s26, s27, [%[mm], #0x00]")
+                __ASM_EMIT("stp             s28, s29, [%[mm], #0x08]")
+                __ASM_EMIT("stp             s30, s31, [%[mm], #0x10]")
+                : [dst] "+r" (dst), [src] "+r" (p), [n] "+r" (n)
+                : [m] "r" (m), [mm] "r" (&mm[0]),
+                  [MC] "r" (&matrix3d_const[0])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21", "v22", "v23",
+                  "v24", "v26", "v27",
+                  "v28", "v29", "v30", "v31"
+            );
+
+            // Build the box in the same order as calc_bound_box() does
+            const float *min = &mm[0], *max = &mm[3];
+            float w         = r[0].w;
+            dsp::init_point_xyz(&b->p[0], min[0], max[1], max[2]);
+            dsp::init_point_xyz(&b->p[1], min[0], min[1], max[2]);
+            dsp::init_point_xyz(&b->p[2], max[0], min[1], max[2]);
+            dsp::init_point_xyz(&b->p[3], max[0], max[1], max[2]);
+            dsp::init_point_xyz(&b->p[4], min[0], max[1], min[2]);
+            dsp::init_point_xyz(&b->p[5], min[0], min[1], min[2]);
+            dsp::init_point_xyz(&b->p[6], max[0], min[1], min[2]);
+            dsp::init_point_xyz(&b->p[7], max[0], max[1], min[2]);
+            for (size_t i=0; i<8; ++i)
+                b->p[i].w       = w;
+        }
+
+        #undef MATRIX3D_SOA_KERNEL
+        #undef MATRIX3D_AOS_KERNEL
+        #undef MATRIX3D_NONE
+        #undef MATRIX3D_TRANSLATE
+        #undef MATRIX3D_CORE
+        #undef MATRIX3D_LOAD
+
+        void points3d_to_soa(const dsp::point3d_soa_t *dst, const dsp::point3d_t *src, size_t n)
+        {
+            float *x = dst->x, *y = dst->y, *z = dst->z;
+
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("subs            %[n], %[n], #4")
+                __ASM_EMIT("b.lo            2f")
+                // 4x blocks
+                __ASM_EMIT("1:")
+                __ASM_EMIT("ld4             {v0.4s, v1.4s, v2.4s, v3.4s}, [%[src]], #0x40")    // v0 = x, v1 = y, v2 = z, v3 = w
+                __ASM_EMIT("str             q0, [%[x]], #0x10")
+                __ASM_EMIT("str             q1, [%[y]], #0x10")
+                __ASM_EMIT("str             q2, [%[z]], #0x10")
+                __ASM_EMIT("subs            %[n], %[n], #4")
+                __ASM_EMIT("b.hs            1b")
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds            %[n], %[n], #3")
+                __ASM_EMIT("b.lt            4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("ld4             {v0.s, v1.s, v2.s, v3.s}[0], [%[src]], #0x10")
+                __ASM_EMIT("str             s0, [%[x]], #0x04")
+                __ASM_EMIT("str             s1, [%[y]], #0x04")
+                __ASM_EMIT("str             s2, [%[z]], #0x04")
+                __ASM_EMIT("subs            %[n], %[n], #1")
+                __ASM_EMIT("b.ge            3b")
+                __ASM_EMIT("4:")
+                : [src] "+r" (src), [n] "+r" (n),
+                  [x] "+r" (x), [y] "+r" (y), [z] "+r" (z)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3"
+            );
+        }
+
+        void points3d_from_soa(dsp::point3d_t *dst, const dsp::point3d_soa_t *src, size_t n)
+        {
+            const float *x = src->x, *y = src->y, *z = src->z;
+
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("fmov            v3.4s, #1.0")                                       // v3 = 1
+                __ASM_EMIT("subs            %[n], %[n], #4")
+                __ASM_EMIT("b.lo            2f")
+                // 4x blocks
+                __ASM_EMIT("1:")
+                __ASM_EMIT("ldr             q0, [%[x]], #0x10")
+                __ASM_EMIT("ldr             q1, [%[y]], #0x10")
+                __ASM_EMIT("ldr             q2, [%[z]], #0x10")
+                __ASM_EMIT("st4             {v0.4s, v1.4s, v2.4s, v3.4s}, [%[dst]], #0x40")
+                __ASM_EMIT("subs            %[n], %[n], #4")
+                __ASM_EMIT("b.hs            1b")
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds            %[n], %[n], #3")
+                __ASM_EMIT("b.lt            4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("ld1             {v0.s}[0], [%[x]], #0x04")
+                __ASM_EMIT("ld1             {v1.s}[0], [%[y]], #0x04")
+                __ASM_EMIT("ld1             {v2.s}[0], [%[z]], #0x04")
+                __ASM_EMIT("st4             {v0.s, v1.s, v2.s, v3.s}[0], [%[dst]], #0x10")
+                __ASM_EMIT("subs            %[n], %[n], #1")
+                __ASM_EMIT("b.ge            3b")
+                __ASM_EMIT("4:")
+                : [dst] "+r" (dst), [n] "+r" (n),
+                  [x] "+r" (x), [y] "+r" (y), [z] "+r" (z)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3"
+            );
+        }
+
+        /* Load/store vertexes of triangles one by one, so the vertex j of the triangle i
+         * is placed into the lane i of the register set j:
+         *   v0..v3 for vertex 0, v4..v7 for vertex 1, v16..v19 for vertex 2
+         */
+        #define SOA3D_TRIANGLE_LANE(OP, I, PTR) \
+            __ASM_EMIT(OP "             {v0.s, v1.s, v2.s, v3.s}[" I "], [%[" PTR "]], #0x10") \
+            __ASM_EMIT(OP "             {v4.s, v5.s, v6.s, v7.s}[" I "], [%[" PTR "]], #0x10") \
+            __ASM_EMIT(OP "             {v16.s, v17.s, v18.s, v19.s}[" I "], [%[" PTR "]], #0x10")
+
+        void raw_triangles_to_soa(const dsp::raw_triangle_soa_t *dst, const dsp::raw_triangle_t *src, size_t n)
+        {
+            float *x0 = dst->v[0].x, *y0 = dst->v[0].y, *z0 = dst->v[0].z;
+            float *x1 = dst->v[1].x, *y1 = dst->v[1].y, *z1 = dst->v[1].z;
+            float *x2 = dst->v[2].x, *y2 = dst->v[2].y, *z2 = dst->v[2].z;
+
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("subs            %[n], %[n], #4")
+                __ASM_EMIT("b.lo            2f")
+                // 4x blocks
+                __ASM_EMIT("1:")
+                SOA3D_TRIANGLE_LANE("ld4", "0", "src")
+                SOA3D_TRIANGLE_LANE("ld4", "1", "src")
+                SOA3D_TRIANGLE_LANE("ld4", "2", "src")
+                SOA3D_TRIANGLE_LANE("ld4", "3", "src")
+                __ASM_EMIT("str             q0, [%[x0]], #0x10")
+                __ASM_EMIT("str             q1, [%[y0]], #0x10")
+                __ASM_EMIT("str             q2, [%[z0]], #0x10")
+                __ASM_EMIT("str             q4, [%[x1]], #0x10")
+                __ASM_EMIT("str             q5, [%[y1]], #0x10")
+                __ASM_EMIT("str             q6, [%[z1]], #0x10")
+                __ASM_EMIT("str             q16, [%[x2]], #0x10")
+                __ASM_EMIT("str             q17, [%[y2]], #0x10")
+                __ASM_EMIT("str             q18, [%[z2]], #0x10")
+                __ASM_EMIT("subs            %[n], %[n], #4")
+                __ASM_EMIT("b.hs            1b")
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds            %[n], %[n], #3")
+                __ASM_EMIT("b.lt            4f")
+                __ASM_EMIT("3:")
+                SOA3D_TRIANGLE_LANE("ld4", "0", "src")
+                __ASM_EMIT("str             s0, [%[x0]], #0x04")
+                __ASM_EMIT("str             s1, [%[y0]], #0x04")
+                __ASM_EMIT("str             s2, [%[z0]], #0x04")
+                __ASM_EMIT("str             s4, [%[x1]], #0x04")
+                __ASM_EMIT("str             s5, [%[y1]], #0x04")
+                __ASM_EMIT("str             s6, [%[z1]], #0x04")
+                __ASM_EMIT("str             s16, [%[x2]], #0x04")
+                __ASM_EMIT("str             s17, [%[y2]], #0x04")
+                __ASM_EMIT("str             s18, [%[z2]], #0x04")
+                __ASM_EMIT("subs            %[n], %[n], #1")
+                __ASM_EMIT("b.ge            3b")
+                __ASM_EMIT("4:")
+                : [src] "+r" (src), [n] "+r" (n),
+                  [x0] "+r" (x0), [y0] "+r" (y0), [z0] "+r" (z0),
+                  [x1] "+r" (x1), [y1] "+r" (y1), [z1] "+r" (z1),
+                  [x2] "+r" (x2), [y2] "+r" (y2), [z2] "+r" (z2)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19"
+            );
+        }
+
+        void raw_triangles_from_soa(dsp::raw_triangle_t *dst, const dsp::raw_triangle_soa_t *src, size_t n)
+        {
+            const float *x0 = src->v[0].x, *y0 = src->v[0].y, *z0 = src->v[0].z;
+            const float *x1 = src->v[1].x, *y1 = src->v[1].y, *z1 = src->v[1].z;
+            const float *x2 = src->v[2].x, *y2 = src->v[2].y, *z2 = src->v[2].z;
+
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("fmov            v3.4s, #1.0")                                       // v3 = 1
+                __ASM_EMIT("fmov            v7.4s, #1.0")                                       // v7 = 1
+                __ASM_EMIT("fmov            v19.4s, #1.0")                                      // v19 = 1
+                __ASM_EMIT("subs            %[n], %[n], #4")
+                __ASM_EMIT("b.lo            2f")
+                // 4x blocks
+                __ASM_EMIT("1:")
+                __ASM_EMIT("ldr             q0, [%[x0]], #0x10")
+                __ASM_EMIT("ldr             q1, [%[y0]], #0x10")
+                __ASM_EMIT("ldr             q2, [%[z0]], #0x10")
+                __ASM_EMIT("ldr             q4, [%[x1]], #0x10")
+                __ASM_EMIT("ldr             q5, [%[y1]], #0x10")
+                __ASM_EMIT("ldr             q6, [%[z1]], #0x10")
+                __ASM_EMIT("ldr             q16, [%[x2]], #0x10")
+                __ASM_EMIT("ldr             q17, [%[y2]], #0x10")
+                __ASM_EMIT("ldr             q18, [%[z2]], #0x10")
+                SOA3D_TRIANGLE_LANE("st4", "0", "dst")
+                SOA3D_TRIANGLE_LANE("st4", "1", "dst")
+                SOA3D_TRIANGLE_LANE("st4", "2", "dst")
+                SOA3D_TRIANGLE_LANE("st4", "3", "dst")
+                __ASM_EMIT("subs            %[n], %[n], #4")
+                __ASM_EMIT("b.hs            1b")
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds            %[n], %[n], #3")
+                __ASM_EMIT("b.lt            4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("ld1             {v0.s}[0], [%[x0]], #0x04")
+                __ASM_EMIT("ld1             {v1.s}[0], [%[y0]], #0x04")
+                __ASM_EMIT("ld1             {v2.s}[0], [%[z0]], #0x04")
+                __ASM_EMIT("ld1             {v4.s}[0], [%[x1]], #0x04")
+                __ASM_EMIT("ld1             {v5.s}[0], [%[y1]], #0x04")
+                __ASM_EMIT("ld1             {v6.s}[0], [%[z1]], #0x04")
+                __ASM_EMIT("ld1             {v16.s}[0], [%[x2]], #0x04")
+                __ASM_EMIT("ld1             {v17.s}[0], [%[y2]], #0x04")
+                __ASM_EMIT("ld1             {v18.s}[0], [%[z2]], #0x04")
+                SOA3D_TRIANGLE_LANE("st4", "0", "dst")
+                __ASM_EMIT("subs            %[n], %[n], #1")
+                __ASM_EMIT("b.ge            3b")
+                __ASM_EMIT("4:")
+                : [dst] "+r" (dst), [n] "+r" (n),
+                  [x0] "+r" (x0), [y0] "+r" (y0), [z0] "+r" (z0),
+                  [x1] "+r" (x1), [y1] "+r" (y1), [z1] "+r" (z1),
+                  [x2] "+r" (x2), [y2] "+r" (y2), [z2] "+r" (z2)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19"
+            );
+        }
+
+        /* The generic loop over SoA elements with 4x and 1x blocks,
+         * BODY(R, INC) is called with the register prefix for loads/stores and the pointer increment
+         */
+        #define SOA3D_LOOP(BODY) \
+            __ASM_EMIT("subs            %[n], %[n], #4") \
+            __ASM_EMIT("b.lo            2f") \
+            /* 4x blocks */ \
+            __ASM_EMIT("1:") \
+            BODY("q", "#0x10") \
+            __ASM_EMIT("subs            %[n], %[n], #4") \
+            __ASM_EMIT("b.hs            1b") \
+            /* 1x blocks */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("adds            %[n], %[n], #3") \
+            __ASM_EMIT("b.lt            4f") \
+            __ASM_EMIT("3:") \
+            BODY("s", "#0x04") \
+            __ASM_EMIT("subs            %[n], %[n], #1") \
+            __ASM_EMIT("b.ge            3b") \
+            __ASM_EMIT("4:")
+
+        #define SOA3D_DISTANCE(R, INC) \
+            __ASM_EMIT("ldr             " R "0, [%[x1]], " INC) \
+            __ASM_EMIT("ldr             " R "1, [%[y1]], " INC) \
+            __ASM_EMIT("ldr             " R "2, [%[z1]], " INC) \
+            __ASM_EMIT("ldr             " R "3, [%[x2]], " INC) \
+            __ASM_EMIT("ldr             " R "4, [%[y2]], " INC) \
+            __ASM_EMIT("ldr             " R "5, [%[z2]], " INC) \
+            __ASM_EMIT("fsub            v3.4s, v3.4s, v0.4s")                               /* v3 = dx */ \
+            __ASM_EMIT("fsub            v4.4s, v4.4s, v1.4s")                               /* v4 = dy */ \
+            __ASM_EMIT("fsub            v5.4s, v5.4s, v2.4s")                               /* v5 = dz */ \
+            __ASM_EMIT("fmul            v3.4s, v3.4s, v3.4s")                               /* v3 = dx*dx */ \
+            __ASM_EMIT("fmla            v3.4s, v4.4s, v4.4s")                               /* v3 = dx*dx + dy*dy */ \
+            __ASM_EMIT("fmla            v3.4s, v5.4s, v5.4s")                               /* v3 = dx*dx + dy*dy + dz*dz */ \
+            __ASM_EMIT("fsqrt           v3.4s, v3.4s") \
+            __ASM_EMIT("str             " R "3, [%[dst]], " INC)
+
+        void calc_distance_soa(float *dst, const dsp::point3d_soa_t *p1, const dsp::point3d_soa_t *p2, size_t n)
+        {
+            const float *x1 = p1->x, *y1 = p1->y, *z1 = p1->z;
+            const float *x2 = p2->x, *y2 = p2->y, *z2 = p2->z;
+
+            ARCH_AARCH64_ASM(
+                SOA3D_LOOP(SOA3D_DISTANCE)
+                : [dst] "+r" (dst), [n] "+r" (n),
+                  [x1] "+r" (x1), [y1] "+r" (y1), [z1] "+r" (z1),
+                  [x2] "+r" (x2), [y2] "+r" (y2), [z2] "+r" (z2)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5"
+            );
+        }
+
+        #undef SOA3D_DISTANCE
+
+        /* Compute the cross product of two triangle edges:
+         *   d0 = v1 - v0, d1 = v2 - A, where A is v0 (v0..v2) or v1 (v3..v5)
+         * Output: v16 = nx, v17 = ny, v18 = nz, v19 = l = sqrt(nx*nx + ny*ny + nz*nz)
+         */
+        #define SOA3D_CROSS(R, INC, A0, A1, A2) \
+            __ASM_EMIT("ldr             " R "0, [%[x0]], " INC) \
+            __ASM_EMIT("ldr             " R "1, [%[y0]], " INC) \
+            __ASM_EMIT("ldr             " R "2, [%[z0]], " INC) \
+            __ASM_EMIT("ldr             " R "3, [%[x1]], " INC) \
+            __ASM_EMIT("ldr             " R "4, [%[y1]], " INC) \
+            __ASM_EMIT("ldr             " R "5, [%[z1]], " INC) \
+            __ASM_EMIT("ldr             " R "6, [%[x2]], " INC) \
+            __ASM_EMIT("ldr             " R "7, [%[y2]], " INC) \
+            __ASM_EMIT("ldr             " R "8, [%[z2]], " INC) \
+            __ASM_EMIT("fsub            v6.4s, v6.4s, v" A0 ".4s")                          /* v6 = d1x */ \
+            __ASM_EMIT("fsub            v7.4s, v7.4s, v" A1 ".4s")                          /* v7 = d1y */ \
+            __ASM_EMIT("fsub            v8.4s, v8.4s, v" A2 ".4s")                          /* v8 = d1z */ \
+            __ASM_EMIT("fsub            v3.4s, v3.4s, v0.4s")                               /* v3 = d0x */ \
+            __ASM_EMIT("fsub            v4.4s, v4.4s, v1.4s")                               /* v4 = d0y */ \
+            __ASM_EMIT("fsub            v5.4s, v5.4s, v2.4s")                               /* v5 = d0z */ \
+            __ASM_EMIT("fmul            v16.4s, v4.4s, v8.4s")                              /* v16 = d0y*d1z */ \
+            __ASM_EMIT("fmul            v17.4s, v5.4s, v6.4s")                              /* v17 = d0z*d1x */ \
+            __ASM_EMIT("fmul            v18.4s, v3.4s, v7.4s")                              /* v18 = d0x*d1y */ \
+            __ASM_EMIT("fmls            v16.4s, v5.4s, v7.4s")                              /* v16 = nx = d0y*d1z - d0z*d1y */ \
+            __ASM_EMIT("fmls            v17.4s, v3.4s, v8.4s")                              /* v17 = ny = d0z*d1x - d0x*d1z */ \
+            __ASM_EMIT("fmls            v18.4s, v4.4s, v6.4s")                              /* v18 = nz = d0x*d1y - d0y*d1x */ \
+            __ASM_EMIT("fmul            v19.4s, v16.4s, v16.4s")                            /* v19 = nx*nx */ \
+            __ASM_EMIT("fmla            v19.4s, v17.4s, v17.4s")                            /* v19 = nx*nx + ny*ny */ \
+            __ASM_EMIT("fmla            v19.4s, v18.4s, v18.4s")                            /* v19 = nx*nx + ny*ny + nz*nz */ \
+            __ASM_EMIT("fsqrt           v19.4s, v19.4s")                                    /* v19 = l */
+
+        #define SOA3D_AREA(R, INC) \
+            SOA3D_CROSS(R, INC, "0", "1", "2") \
+            __ASM_EMIT("str             " R "19, [%[dst]], " INC)
+
+        void calc_area_soa(float *dst, const dsp::raw_triangle_soa_t *t, size_t n)
+        {
+            const float *x0 = t->v[0].x, *y0 = t->v[0].y, *z0 = t->v[0].z;
+            const float *x1 = t->v[1].x, *y1 = t->v[1].y, *z1 = t->v[1].z;
+            const float *x2 = t->v[2].x, *y2 = t->v[2].y, *z2 = t->v[2].z;
+
+            ARCH_AARCH64_ASM(
+                SOA3D_LOOP(SOA3D_AREA)
+                : [dst] "+r" (dst), [n] "+r" (n),
+                  [x0] "+r" (x0), [y0] "+r" (y0), [z0] "+r" (z0),
+                  [x1] "+r" (x1), [y1] "+r" (y1), [z1] "+r" (z1),
+                  [x2] "+r" (x2), [y2] "+r" (y2), [z2] "+r" (z2)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v8", "v16", "v17", "v18",
+                  "v19"
+            );
+        }
+
+        #define SOA3D_NORMAL(R, INC) \
+            SOA3D_CROSS(R, INC, "3", "4", "5") \
+            __ASM_EMIT("fcmgt           v21.4s, v19.4s, #0.0")                              /* v21 = [l > 0] */ \
+            __ASM_EMIT("fdiv            v22.4s, v20.4s, v19.4s")                            /* v22 = 1/l */ \
+            __ASM_EMIT("bif             v22.16b, v20.16b, v21.16b")                         /* v22 = k = (l > 0) ? 1/l : 1 */ \
+            __ASM_EMIT("fmul            v16.4s, v16.4s, v22.4s") \
+            __ASM_EMIT("fmul            v17.4s, v17.4s, v22.4s") \
+            __ASM_EMIT("fmul            v18.4s, v18.4s, v22.4s") \
+            __ASM_EMIT("str             " R "16, [%[dx]], " INC) \
+            __ASM_EMIT("str             " R "17, [%[dy]], " INC) \
+            __ASM_EMIT("str             " R "18, [%[dz]], " INC)
+
+        void calc_normal3d_soa(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n)
+        {
+            float *dx = dst->dx, *dy = dst->dy, *dz = dst->dz;
+            const float *x0 = t->v[0].x, *y0 = t->v[0].y, *z0 = t->v[0].z;
+            const float *x1 = t->v[1].x, *y1 = t->v[1].y, *z1 = t->v[1].z;
+            const float *x2 = t->v[2].x, *y2 = t->v[2].y, *z2 = t->v[2].z;
+
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("fmov            v20.4s, #1.0")                                      // v20 = 1
+                SOA3D_LOOP(SOA3D_NORMAL)
+                : [dx] "+r" (dx), [dy] "+r" (dy), [dz] "+r" (dz),
+                  [n] "+r" (n),
+                  [x0] "+r" (x0), [y0] "+r" (y0), [z0] "+r" (z0),
+                  [x1] "+r" (x1), [y1] "+r" (y1), [z1] "+r" (z1),
+                  [x2] "+r" (x2), [y2] "+r" (y2), [z2] "+r" (z2)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v8", "v16", "v17", "v18",
+                  "v19", "v20", "v21", "v22"
+            );
+        }
+
+        #undef SOA3D_NORMAL
+        #undef SOA3D_AREA
+        #undef SOA3D_CROSS
+
+        /* Compute the colocation tag of the vertex and the plane:
+         *   k = x*dx + y*dy + z*dz + dw, tag = -([k <= +TOL] + [k < -TOL])
+         * v16 = plane, v17 = dw, v18 = +TOL, v19 = -TOL
+         */
+        #define SOA3D_COLOCATE(R, INC, X, Y, Z, T) \
+            __ASM_EMIT("ldr             " R "0, [%[" X "]], " INC)                          /* v0 = x */ \
+            __ASM_EMIT("ldr             " R "1, [%[" Y "]], " INC)                          /* v1 = y */ \
+            __ASM_EMIT("ldr             " R "2, [%[" Z "]], " INC)                          /* v2 = z */ \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v16.s[0]")                            /* v0 = x*dx */ \
+            __ASM_EMIT("fmla            v0.4s, v1.4s, v16.s[1]")                            /* v0 = x*dx + y*dy */ \
+            __ASM_EMIT("fmla            v0.4s, v2.4s, v16.s[2]")                            /* v0 = x*dx + y*dy + z*dz */ \
+            __ASM_EMIT("fadd            v0.4s, v0.4s, v17.4s")                              /* v0 = k */ \
+            __ASM_EMIT("fcmge           v1.4s, v18.4s, v0.4s")                              /* v1 = [k <= +TOL] */ \
+            __ASM_EMIT("fcmgt           v2.4s, v19.4s, v0.4s")                              /* v2 = [k < -TOL] */ \
+            __ASM_EMIT("add             " T ".4s, v1.4s, v2.4s")                            /* T = -tag */
+
+        #define SOA3D_COLOCATION(R, INC) \
+            SOA3D_COLOCATE(R, INC, "x0", "y0", "z0", "v3") \
+            SOA3D_COLOCATE(R, INC, "x1", "y1", "z1", "v4") \
+            SOA3D_COLOCATE(R, INC, "x2", "y2", "z2", "v5") \
+            __ASM_EMIT("shl             v4.4s, v4.4s, #2") \
+            __ASM_EMIT("shl             v5.4s, v5.4s, #4") \
+            __ASM_EMIT("add             v3.4s, v3.4s, v4.4s") \
+            __ASM_EMIT("add             v3.4s, v3.4s, v5.4s")                               /* v3 = -(tag0 | (tag1 << 2) | (tag2 << 4)) */ \
+            __ASM_EMIT("neg             v3.4s, v3.4s") \
+            __ASM_EMIT("str             " R "3, [%[dst]], " INC)
+
+        void colocation_x3_v1_soa(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n)
+        {
+            const float *x0 = t->v[0].x, *y0 = t->v[0].y, *z0 = t->v[0].z;
+            const float *x1 = t->v[1].x, *y1 = t->v[1].y, *z1 = t->v[1].z;
+            const float *x2 = t->v[2].x, *y2 = t->v[2].y, *z2 = t->v[2].z;
+
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldr             q16, [%[pl]]")                                      // v16 = dx dy dz dw
+                __ASM_EMIT("ldp             q18, q19, [%[TOL]]")                                // v18 = +TOL, v19 = -TOL
+                __ASM_EMIT("dup             v17.4s, v16.s[3]")                                  // v17 = dw
+                SOA3D_LOOP(SOA3D_COLOCATION)
+                : [dst] "+r" (dst), [n] "+r" (n),
+                  [x0] "+r" (x0), [y0] "+r" (y0), [z0] "+r" (z0),
+                  [x1] "+r" (x1), [y1] "+r" (y1), [z1] "+r" (z1),
+                  [x2] "+r" (x2), [y2] "+r" (y2), [z2] "+r" (z2)
+                : [pl] "r" (pl),
+                  [TOL] "r" (&matrix3d_const[12])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5",
+                  "v16", "v17", "v18", "v19"
+            );
+        }
+
+        #undef SOA3D_COLOCATION
+        #undef SOA3D_COLOCATE
+        #undef SOA3D_LOOP
+
+        /* Compute the dot product of 3D vectors: S = ax*bx + ay*by + az*bz
+         * vA, vB = input vectors, vD = temporary register
+         */
+        #define DOT3(S, D, A, B) \
+            __ASM_EMIT("fmul            v" D ".4s, v" A ".4s, v" B ".4s") \
+            __ASM_EMIT("mov             v" D ".s[3], wzr") \
+            __ASM_EMIT("faddp           v" D ".4s, v" D ".4s, v" D ".4s") \
+            __ASM_EMIT("faddp           " S ", v" D ".2s")
+
+        /* Compute the cross product of 3D vectors: vR = vA x vB, the w component of vR is set to zero
+         * vR should not be vA or vB, vT = temporary register
+         */
+        #define CROSS3(R, A, B, T) \
+            __ASM_EMIT("ext             v" T ".16b, v" A ".16b, v" A ".16b, #4") \
+            __ASM_EMIT("ext             v" R ".16b, v" B ".16b, v" B ".16b, #4") \
+            __ASM_EMIT("mov             v" T ".s[2], v" A ".s[0]")                          /* vT = ay az ax ax */ \
+            __ASM_EMIT("mov             v" R ".s[2], v" B ".s[0]")                          /* vR = by bz bx bx */ \
+            __ASM_EMIT("fmul            v" R ".4s, v" R ".4s, v" A ".4s")                   /* vR = ax*by ay*bz az*bx ? */ \
+            __ASM_EMIT("fmul            v" T ".4s, v" T ".4s, v" B ".4s")                   /* vT = ay*bx az*by ax*bz ? */ \
+            __ASM_EMIT("fsub            v" T ".4s, v" R ".4s, v" T ".4s")                   /* vT = NZ NX NY ? */ \
+            __ASM_EMIT("ext             v" R ".16b, v" T ".16b, v" T ".16b, #4") \
+            __ASM_EMIT("mov             v" R ".s[2], v" T ".s[0]") \
+            __ASM_EMIT("mov             v" R ".s[3], wzr")                                  /* vR = NX NY NZ 0 */
+
+        /* Input: v0 = p0, v1 = p1, v2 = p2
+         * Output: points with lengths of edges stored in w components and the normal are stored to t
+         */
+        #define TRIANGLE3D_PARAMS \
+            __ASM_EMIT("fsub            v3.4s, v1.4s, v0.4s")                               /* v3 = d0 = p1 - p0 */ \
+            __ASM_EMIT("fsub            v4.4s, v2.4s, v1.4s")                               /* v4 = d1 = p2 - p1 */ \
+            __ASM_EMIT("fsub            v5.4s, v2.4s, v0.4s")                               /* v5 = d2 = p2 - p0 */ \
+            CROSS3("6", "3", "5", "7")                                                      /* v6 = N = d0 x d2 */ \
+            DOT3("s3", "3", "3", "3")                                                       /* s3 = l0*l0 */ \
+            DOT3("s4", "4", "4", "4")                                                       /* s4 = l1*l1 */ \
+            DOT3("s5", "5", "5", "5")                                                       /* s5 = l2*l2 */ \
+            DOT3("s7", "7", "6", "6")                                                       /* s7 = l3*l3 */ \
+            __ASM_EMIT("fsqrt           s3, s3") \
+            __ASM_EMIT("fsqrt           s4, s4") \
+            __ASM_EMIT("fsqrt           s5, s5") \
+            __ASM_EMIT("fsqrt           s7, s7") \
+            __ASM_EMIT("dup             v7.4s, v7.s[0]")                                    /* v7 = l3 */ \
+            __ASM_EMIT("fdiv            v6.4s, v6.4s, v7.4s")                               /* v6 = nx ny nz 0 */ \
+            DOT3("s16", "16", "6", "0")                                                     /* s16 = nx*x0 + ny*y0 + nz*z0 */ \
+            __ASM_EMIT("fneg            s16, s16") \
+            __ASM_EMIT("mov             v6.s[3], v16.s[0]")                                 /* v6 = nx ny nz dw */ \
+            __ASM_EMIT("mov             v0.s[3], v3.s[0]") \
+            __ASM_EMIT("mov             v1.s[3], v4.s[0]") \
+            __ASM_EMIT("mov             v2.s[3], v5.s[0]") \
+            __ASM_EMIT("stp             q0, q1, [%[t], #0x00]") \
+            __ASM_EMIT("stp             q2, q6, [%[t], #0x20]")
+
+        void calc_triangle3d_params(dsp::triangle3d_t *t)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldp             q0, q1, [%[t], #0x00]")
+                __ASM_EMIT("ldr             q2, [%[t], #0x20]")
+                TRIANGLE3D_PARAMS
+                :
+                : [t] "r" (t)
+                : "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16"
+            );
+        }
+
+        void calc_triangle3d_p3(
+                dsp::triangle3d_t *t,
+                const dsp::point3d_t *p1,
+                const dsp::point3d_t *p2,
+                const dsp::point3d_t *p3
+            )
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldr             q0, [%[p1]]")
+                __ASM_EMIT("ldr             q1, [%[p2]]")
+                __ASM_EMIT("ldr             q2, [%[p3]]")
+                TRIANGLE3D_PARAMS
+                :
+                : [t] "r" (t), [p1] "r" (p1), [p2] "r" (p2), [p3] "r" (p3)
+                : "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16"
+            );
+        }
+
+        void calc_triangle3d_pv(dsp::triangle3d_t *t, const dsp::point3d_t *p)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldp             q0, q1, [%[p], #0x00]")
+                __ASM_EMIT("ldr             q2, [%[p], #0x20]")
+                TRIANGLE3D_PARAMS
+                :
+                : [t] "r" (t), [p] "r" (p)
+                : "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16"
+            );
+        }
+
+        void calc_triangle3d(dsp::triangle3d_t *dst, const dsp::triangle3d_t *src)
+        {
+            calc_triangle3d_pv(dst, src->p);
+        }
+
+        #undef TRIANGLE3D_PARAMS
+
+        void vector_mul_v2(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldr             q0, [%[v1]]")                                       // v0 = dx1 dy1 dz1 dw1
+                __ASM_EMIT("ldr             q1, [%[v2]]")                                       // v1 = dx2 dy2 dz2 dw2
+                CROSS3("2", "0", "1", "3")                                                      // v2 = NX NY NZ 0
+                __ASM_EMIT("str             q2, [%[r]]")
+                :
+                : [r] "r" (r), [v1] "r" (v1), [v2] "r" (v2)
+                : "memory",
+                  "v0", "v1", "v2", "v3"
+            );
+        }
+
+        void vector_mul_vv(dsp::vector3d_t *r, const dsp::vector3d_t *vv)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldp             q0, q1, [%[vv]]")                                   // v0 = dx1 dy1 dz1 dw1, v1 = dx2 dy2 dz2 dw2
+                CROSS3("2", "0", "1", "3")                                                      // v2 = NX NY NZ 0
+                __ASM_EMIT("str             q2, [%[r]]")
+                :
+                : [r] "r" (r), [vv] "r" (vv)
+                : "memory",
+                  "v0", "v1", "v2", "v3"
+            );
+        }
+
+        /* Compute the oriented plane for the triangle
+         * Input: v0 = p0, v1 = p1, v2 = p2, v7 = sp
+         * Output: plane stored to v, res = 1/|N| or 0 for the degenerate triangle
+         * KEEP is the branch condition that keeps the orientation of the plane
+         */
+        #define ORIENTED_PLANE_CORE(KEEP) \
+            __ASM_EMIT("fsub            v1.4s, v1.4s, v0.4s")                               /* v1 = d0 = p1 - p0 */ \
+            __ASM_EMIT("fsub            v2.4s, v2.4s, v0.4s") \
+            __ASM_EMIT("fsub            v2.4s, v2.4s, v1.4s")                               /* v2 = d1 = p2 - p1 */ \
+            CROSS3("3", "1", "2", "4")                                                      /* v3 = N = nx ny nz 0 */ \
+            DOT3("s4", "4", "3", "3") \
+            __ASM_EMIT("fsqrt           s4, s4")                                            /* s4 = W = |N| */ \
+            __ASM_EMIT("fcmp            s4, #0.0") \
+            __ASM_EMIT("b.ne            1f") \
+            __ASM_EMIT("fmov            %s[res], wzr") \
+            __ASM_EMIT("b               2f") \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("fmov            s5, #1.0") \
+            __ASM_EMIT("fdiv            s5, s5, s4")                                        /* s5 = 1/W */ \
+            __ASM_EMIT("fmov            %s[res], s5") \
+            __ASM_EMIT("fmul            v3.4s, v3.4s, v5.s[0]")                             /* v3 = n = N/W */ \
+            DOT3("s5", "5", "3", "0") \
+            __ASM_EMIT("fneg            s5, s5")                                            /* s5 = dw = -(n*p0) */ \
+            __ASM_EMIT("mov             v3.s[3], v5.s[0]")                                  /* v3 = nx ny nz dw */ \
+            DOT3("s6", "6", "3", "7") \
+            __ASM_EMIT("fadd            s6, s6, s5")                                        /* s6 = a = n*sp + dw */ \
+            __ASM_EMIT("fcmp            s6, #0.0") \
+            __ASM_EMIT(KEEP "            2f") \
+            __ASM_EMIT("fneg            v3.4s, v3.4s") \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("str             q3, [%[v]]")
+
+        #define ORIENTED_PLANE_KEEP         "b.le"      /* keep orientation if a <= 0 */
+        #define ORIENTED_PLANE_REV_KEEP     "b.pl"      /* keep orientation if a >= 0 */
+
+        #define ORIENTED_PLANE_P3(KEEP) \
+            float res; \
+            ARCH_AARCH64_ASM( \
+                __ASM_EMIT("ldr             q0, [%[p0]]") \
+                __ASM_EMIT("ldr             q1, [%[p1]]") \
+                __ASM_EMIT("ldr             q2, [%[p2]]") \
+                __ASM_EMIT("ldr             q7, [%[sp]]") \
+                ORIENTED_PLANE_CORE(KEEP) \
+                : [res] "=&w" (res) \
+                : [v] "r" (v), [sp] "r" (sp), [p0] "r" (p0), [p1] "r" (p1), [p2] "r" (p2) \
+                : "cc", "memory", \
+                  "v0", "v1", "v2", "v3", \
+                  "v4", "v5", "v6", "v7" \
+            ); \
+            return res;
+
+        #define ORIENTED_PLANE_PV(KEEP) \
+            float res; \
+            ARCH_AARCH64_ASM( \
+                __ASM_EMIT("ldp             q0, q1, [%[pv], #0x00]") \
+                __ASM_EMIT("ldr             q2, [%[pv], #0x20]") \
+                __ASM_EMIT("ldr             q7, [%[sp]]") \
+                ORIENTED_PLANE_CORE(KEEP) \
+                : [res] "=&w" (res) \
+                : [v] "r" (v), [sp] "r" (sp), [pv] "r" (pv) \
+                : "cc", "memory", \
+                  "v0", "v1", "v2", "v3", \
+                  "v4", "v5", "v6", "v7" \
+            ); \
+            return res;
+
+        float calc_oriented_plane_p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2)
+        {
+            ORIENTED_PLANE_P3(ORIENTED_PLANE_KEEP)
+        }
+
+        float calc_oriented_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv)
+        {
+            ORIENTED_PLANE_PV(ORIENTED_PLANE_KEEP)
+        }
+
+        float calc_rev_oriented_plane_p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2)
+        {
+            ORIENTED_PLANE_P3(ORIENTED_PLANE_REV_KEEP)
+        }
+
+        float calc_rev_oriented_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv)
+        {
+            ORIENTED_PLANE_PV(ORIENTED_PLANE_REV_KEEP)
+        }
+
+        #undef ORIENTED_PLANE_PV
+        #undef ORIENTED_PLANE_P3
+
+        #define DISTANCE_P2(SQRT) \
+            float res; \
+            ARCH_AARCH64_ASM( \
+                __ASM_EMIT("ldr             q0, [%[p1]]") \
+                __ASM_EMIT("ldr             q1, [%[p2]]") \
+                __ASM_EMIT("fsub            v0.4s, v1.4s, v0.4s")                           /* v0 = p2 - p1 */ \
+                DOT3("s0", "0", "0", "0") \
+                SQRT \
+                : [res] "=&w" (res) \
+                : [p1] "r" (p1), [p2] "r" (p2) \
+                : "v0", "v1" \
+            ); \
+            return res;
+
+        float calc_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2)
+        {
+            DISTANCE_P2(__ASM_EMIT("fsqrt           %s[res], s0"))
+        }
+
+        float calc_sqr_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2)
+        {
+            DISTANCE_P2(__ASM_EMIT("fmov            %s[res], s0"))
+        }
+
+        float calc_distance_pv(const dsp::point3d_t *pv)
+        {
+            return calc_distance_p2(&pv[0], &pv[1]);
+        }
+
+        float calc_sqr_distance_pv(const dsp::point3d_t *pv)
+        {
+            return calc_sqr_distance_p2(&pv[0], &pv[1]);
+        }
+
+        #undef DISTANCE_P2
+
+        float calc_distance_v1(const dsp::vector3d_t *v)
+        {
+            float res;
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldr             q0, [%[v]]")
+                DOT3("s0", "0", "0", "0")
+                __ASM_EMIT("fsqrt           %s[res], s0")
+                : [res] "=&w" (res)
+                : [v] "r" (v)
+                : "v0"
+            );
+            return res;
+        }
+
+        float projection_length_p2(const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *pp)
+        {
+            float res;
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldr             q0, [%[p0]]")
+                __ASM_EMIT("ldr             q1, [%[p1]]")
+                __ASM_EMIT("ldr             q2, [%[pp]]")
+                __ASM_EMIT("fsub            v1.4s, v1.4s, v0.4s")                               // v1 = pv = p1 - p0
+                __ASM_EMIT("fsub            v2.4s, v2.4s, v0.4s")                               // v2 = v = pp - p0
+                DOT3("s2", "2", "2", "1")                                                       // s2 = v*pv
+                DOT3("s1", "1", "1", "1")                                                       // s1 = pv*pv
+                __ASM_EMIT("fdiv            %s[res], s2, s1")
+                : [res] "=&w" (res)
+                : [p0] "r" (p0), [p1] "r" (p1), [pp] "r" (pp)
+                : "v0", "v1", "v2"
+            );
+            return res;
+        }
+
+        float projection_length_v2(const dsp::vector3d_t *v, const dsp::vector3d_t *pv)
+        {
+            float res;
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldr             q0, [%[v]]")
+                __ASM_EMIT("ldr             q1, [%[pv]]")
+                DOT3("s0", "0", "0", "1")                                                       // s0 = v*pv
+                DOT3("s1", "1", "1", "1")                                                       // s1 = pv*pv
+                __ASM_EMIT("fdiv            %s[res], s0, s1")
+                : [res] "=&w" (res)
+                : [v] "r" (v), [pv] "r" (pv)
+                : "v0", "v1"
+            );
+            return res;
+        }
+
+        /* Input: v0 = p0, v1 = p1, v2 = p2, v3 = sp
+         * Output: v0 = d = (p0 + p1 + p2)/3 - sp, w = 0
+         */
+        #define TRIANGLE_CENTER \
+            __ASM_EMIT("fmov            v4.4s, #3.0") \
+            __ASM_EMIT("fadd            v0.4s, v0.4s, v1.4s") \
+            __ASM_EMIT("fadd            v0.4s, v0.4s, v2.4s") \
+            __ASM_EMIT("fdiv            v0.4s, v0.4s, v4.4s")                               /* v0 = (p0 + p1 + p2)/3 */ \
+            __ASM_EMIT("fsub            v0.4s, v0.4s, v3.4s") \
+            __ASM_EMIT("mov             v0.s[3], wzr")
+
+        float calc_avg_distance_p3(const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2)
+        {
+            float res;
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldr             q0, [%[p0]]")
+                __ASM_EMIT("ldr             q1, [%[p1]]")
+                __ASM_EMIT("ldr             q2, [%[p2]]")
+                __ASM_EMIT("ldr             q3, [%[sp]]")
+                TRIANGLE_CENTER
+                DOT3("s0", "1", "0", "0")
+                __ASM_EMIT("fsqrt           %s[res], s0")
+                : [res] "=&w" (res)
+                : [sp] "r" (sp), [p0] "r" (p0), [p1] "r" (p1), [p2] "r" (p2)
+                : "v0", "v1", "v2", "v3",
+                  "v4"
+            );
+            return res;
+        }
+
+        /* Input: v0 = p0, v1 = p1, v2 = p2, v3 = sp
+         * Output: unit vector from sp to the center of the triangle stored to v
+         */
+        #define UNIT_VECTOR_CORE \
+            TRIANGLE_CENTER \
+            DOT3("s1", "1", "0", "0") \
+            __ASM_EMIT("fsqrt           s1, s1")                                            /* s1 = w */ \
+            __ASM_EMIT("fmov            s2, #1.0") \
+            __ASM_EMIT("fcmp            s1, #0.0") \
+            __ASM_EMIT("b.eq            1f") \
+            __ASM_EMIT("fdiv            s1, s2, s1")                                        /* s1 = 1/w */ \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v1.s[0]") \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("str             q0, [%[v]]")
+
+        void unit_vector_p1p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldr             q0, [%[p0]]")
+                __ASM_EMIT("ldr             q1, [%[p1]]")
+                __ASM_EMIT("ldr             q2, [%[p2]]")
+                __ASM_EMIT("ldr             q3, [%[sp]]")
+                UNIT_VECTOR_CORE
+                :
+                : [v] "r" (v), [sp] "r" (sp), [p0] "r" (p0), [p1] "r" (p1), [p2] "r" (p2)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4"
+            );
+        }
+
+        void unit_vector_p1pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldp             q0, q1, [%[pv], #0x00]")
+                __ASM_EMIT("ldr             q2, [%[pv], #0x20]")
+                __ASM_EMIT("ldr             q3, [%[sp]]")
+                UNIT_VECTOR_CORE
+                :
+                : [v] "r" (v), [sp] "r" (sp), [pv] "r" (pv)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4"
+            );
+        }
+
+        #undef UNIT_VECTOR_CORE
+        #undef TRIANGLE_CENTER
+
+        /* The generic loop over arrays of points/vectors with 4x and 1x blocks,
+         * LOAD4/STORE4 and LOAD1/STORE1 perform de-interleaving loads and stores of elements
+         */
+        #define AOS3D_LOOP(LOAD4, STORE4, LOAD1, STORE1, BODY) \
+            __ASM_EMIT("subs            %[n], %[n], #4") \
+            __ASM_EMIT("b.lo            2f") \
+            /* 4x blocks */ \
+            __ASM_EMIT("1:") \
+            LOAD4 \
+            BODY \
+            STORE4 \
+            __ASM_EMIT("subs            %[n], %[n], #4") \
+            __ASM_EMIT("b.hs            1b") \
+            /* 1x blocks */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("adds            %[n], %[n], #3") \
+            __ASM_EMIT("b.lt            4f") \
+            __ASM_EMIT("3:") \
+            LOAD1 \
+            BODY \
+            STORE1 \
+            __ASM_EMIT("subs            %[n], %[n], #1") \
+            __ASM_EMIT("b.ge            3b") \
+            __ASM_EMIT("4:")
+
+        #define AOS3D_LOAD4(PTR) \
+            __ASM_EMIT("ld4             {v0.4s, v1.4s, v2.4s, v3.4s}, [%[" PTR "]], #0x40")
+        #define AOS3D_LOAD1(PTR) \
+            __ASM_EMIT("ld4             {v0.s, v1.s, v2.s, v3.s}[0], [%[" PTR "]], #0x10")
+        #define AOS3D_STORE4(PTR) \
+            __ASM_EMIT("st4             {v0.4s, v1.4s, v2.4s, v3.4s}, [%[" PTR "]], #0x40")
+        #define AOS3D_STORE1(PTR) \
+            __ASM_EMIT("st4             {v0.s, v1.s, v2.s, v3.s}[0], [%[" PTR "]], #0x10")
+        #define AOS3D_TRIANGLE4(PTR) \
+            SOA3D_TRIANGLE_LANE("ld4", "0", PTR) \
+            SOA3D_TRIANGLE_LANE("ld4", "1", PTR) \
+            SOA3D_TRIANGLE_LANE("ld4", "2", PTR) \
+            SOA3D_TRIANGLE_LANE("ld4", "3", PTR)
+        #define AOS3D_TRIANGLE1(PTR) \
+            SOA3D_TRIANGLE_LANE("ld4", "0", PTR)
+
+        /* v0 = x, v1 = y, v2 = z, v24 = sx, v25 = sy, v26 = sz
+         * Output: v0 = squared distance
+         */
+        #define AOS3D_SQR_DISTANCE \
+            __ASM_EMIT("fsub            v0.4s, v0.4s, v24.4s")                              /* v0 = dx */ \
+            __ASM_EMIT("fsub            v1.4s, v1.4s, v25.4s")                              /* v1 = dy */ \
+            __ASM_EMIT("fsub            v2.4s, v2.4s, v26.4s")                              /* v2 = dz */ \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v0.4s") \
+            __ASM_EMIT("fmla            v0.4s, v1.4s, v1.4s") \
+            __ASM_EMIT("fmla            v0.4s, v2.4s, v2.4s")                               /* v0 = dx*dx + dy*dy + dz*dz */
+
+        #define AOS3D_DISTANCE \
+            AOS3D_SQR_DISTANCE \
+            __ASM_EMIT("fsqrt           v0.4s, v0.4s")
+
+        /* v0..v3 = p0, v4..v7 = p1, v16..v19 = p2, v24..v26 = sp, v20 = 3
+         * Output: v0 = dx, v1 = dy, v2 = dz of the vector from sp to the center of the triangle
+         */
+        #define AOS3D_TRIANGLE_CENTER \
+            __ASM_EMIT("fadd            v0.4s, v0.4s, v4.4s") \
+            __ASM_EMIT("fadd            v1.4s, v1.4s, v5.4s") \
+            __ASM_EMIT("fadd            v2.4s, v2.4s, v6.4s") \
+            __ASM_EMIT("fadd            v0.4s, v0.4s, v16.4s") \
+            __ASM_EMIT("fadd            v1.4s, v1.4s, v17.4s") \
+            __ASM_EMIT("fadd            v2.4s, v2.4s, v18.4s") \
+            __ASM_EMIT("fdiv            v0.4s, v0.4s, v20.4s") \
+            __ASM_EMIT("fdiv            v1.4s, v1.4s, v20.4s") \
+            __ASM_EMIT("fdiv            v2.4s, v2.4s, v20.4s") \
+            __ASM_EMIT("fsub            v0.4s, v0.4s, v24.4s") \
+            __ASM_EMIT("fsub            v1.4s, v1.4s, v25.4s") \
+            __ASM_EMIT("fsub            v2.4s, v2.4s, v26.4s")
+
+        #define AOS3D_AVG_DISTANCE \
+            AOS3D_TRIANGLE_CENTER \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v0.4s") \
+            __ASM_EMIT("fmla            v0.4s, v1.4s, v1.4s") \
+            __ASM_EMIT("fmla            v0.4s, v2.4s, v2.4s") \
+            __ASM_EMIT("fsqrt           v0.4s, v0.4s")
+
+        #define AOS3D_UNIT_VECTOR \
+            AOS3D_TRIANGLE_CENTER \
+            __ASM_EMIT("fmul            v3.4s, v0.4s, v0.4s") \
+            __ASM_EMIT("fmla            v3.4s, v1.4s, v1.4s") \
+            __ASM_EMIT("fmla            v3.4s, v2.4s, v2.4s") \
+            __ASM_EMIT("fsqrt           v3.4s, v3.4s")                                      /* v3 = w */ \
+            __ASM_EMIT("fcmeq           v4.4s, v3.4s, #0.0")                                /* v4 = [w == 0] */ \
+            __ASM_EMIT("fdiv            v3.4s, v21.4s, v3.4s")                              /* v3 = 1/w */ \
+            __ASM_EMIT("bit             v3.16b, v21.16b, v4.16b")                           /* v3 = (w == 0) ? 1 : 1/w */ \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v3.4s") \
+            __ASM_EMIT("fmul            v1.4s, v1.4s, v3.4s") \
+            __ASM_EMIT("fmul            v2.4s, v2.4s, v3.4s") \
+            __ASM_EMIT("eor             v3.16b, v3.16b, v3.16b")                            /* v3 = 0 */
+
+        /* v0..v3 = a, v4..v7 = b
+         * Output: v0..v3 = a x b, w = 0
+         */
+        #define AOS3D_VECTOR_MUL \
+            __ASM_EMIT("fmul            v16.4s, v1.4s, v6.4s")                              /* v16 = ay*bz */ \
+            __ASM_EMIT("fmul            v17.4s, v2.4s, v4.4s")                              /* v17 = az*bx */ \
+            __ASM_EMIT("fmul            v18.4s, v0.4s, v5.4s")                              /* v18 = ax*by */ \
+            __ASM_EMIT("fmul            v19.4s, v2.4s, v5.4s")                              /* v19 = az*by */ \
+            __ASM_EMIT("fmul            v20.4s, v0.4s, v6.4s")                              /* v20 = ax*bz */ \
+            __ASM_EMIT("fmul            v21.4s, v1.4s, v4.4s")                              /* v21 = ay*bx */ \
+            __ASM_EMIT("fsub            v0.4s, v16.4s, v19.4s")                             /* v0 = NX */ \
+            __ASM_EMIT("fsub            v1.4s, v17.4s, v20.4s")                             /* v1 = NY */ \
+            __ASM_EMIT("fsub            v2.4s, v18.4s, v21.4s")                             /* v2 = NZ */ \
+            __ASM_EMIT("eor             v3.16b, v3.16b, v3.16b")                            /* v3 = 0 */
+
+        void calc_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ld4r            {v24.4s, v25.4s, v26.4s, v27.4s}, [%[sp]]")         // v24 = sx, v25 = sy, v26 = sz
+                AOS3D_LOOP(
+                    AOS3D_LOAD4("p"), __ASM_EMIT("str             q0, [%[dst]], #0x10"),
+                    AOS3D_LOAD1("p"), __ASM_EMIT("str             s0, [%[dst]], #0x04"),
+                    AOS3D_DISTANCE)
+                : [dst] "+r" (dst), [p] "+r" (p), [n] "+r" (n)
+                : [sp] "r" (sp)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v24", "v25", "v26", "v27"
+            );
+        }
+
+        void calc_sqr_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ld4r            {v24.4s, v25.4s, v26.4s, v27.4s}, [%[sp]]")         // v24 = sx, v25 = sy, v26 = sz
+                AOS3D_LOOP(
+                    AOS3D_LOAD4("p"), __ASM_EMIT("str             q0, [%[dst]], #0x10"),
+                    AOS3D_LOAD1("p"), __ASM_EMIT("str             s0, [%[dst]], #0x04"),
+                    AOS3D_SQR_DISTANCE)
+                : [dst] "+r" (dst), [p] "+r" (p), [n] "+r" (n)
+                : [sp] "r" (sp)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v24", "v25", "v26", "v27"
+            );
+        }
+
+        void calc_avg_distance_pvn(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ld4r            {v24.4s, v25.4s, v26.4s, v27.4s}, [%[sp]]")         // v24 = sx, v25 = sy, v26 = sz
+                __ASM_EMIT("fmov            v20.4s, #3.0")                                      // v20 = 3
+                AOS3D_LOOP(
+                    AOS3D_TRIANGLE4("pv"), __ASM_EMIT("str             q0, [%[dst]], #0x10"),
+                    AOS3D_TRIANGLE1("pv"), __ASM_EMIT("str             s0, [%[dst]], #0x04"),
+                    AOS3D_AVG_DISTANCE)
+                : [dst] "+r" (dst), [pv] "+r" (pv), [n] "+r" (n)
+                : [sp] "r" (sp)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19",
+                  "v20",
+                  "v24", "v25", "v26", "v27"
+            );
+        }
+
+        void unit_vector_p1pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ld4r            {v24.4s, v25.4s, v26.4s, v27.4s}, [%[sp]]")         // v24 = sx, v25 = sy, v26 = sz
+                __ASM_EMIT("fmov            v20.4s, #3.0")                                      // v20 = 3
+                __ASM_EMIT("fmov            v21.4s, #1.0")                                      // v21 = 1
+                AOS3D_LOOP(
+                    AOS3D_TRIANGLE4("pv"), AOS3D_STORE4("v"),
+                    AOS3D_TRIANGLE1("pv"), AOS3D_STORE1("v"),
+                    AOS3D_UNIT_VECTOR)
+                : [v] "+r" (v), [pv] "+r" (pv), [n] "+r" (n)
+                : [sp] "r" (sp)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21",
+                  "v24", "v25", "v26", "v27"
+            );
+        }
+
+        void vector_mul_v2n(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n)
+        {
+            ARCH_AARCH64_ASM(
+                AOS3D_LOOP(
+                    AOS3D_LOAD4("v1")
+                    __ASM_EMIT("ld4             {v4.4s, v5.4s, v6.4s, v7.4s}, [%[v2]], #0x40"),
+                    AOS3D_STORE4("r"),
+                    AOS3D_LOAD1("v1")
+                    __ASM_EMIT("ld4             {v4.s, v5.s, v6.s, v7.s}[0], [%[v2]], #0x10"),
+                    AOS3D_STORE1("r"),
+                    AOS3D_VECTOR_MUL)
+                : [r] "+r" (r), [v1] "+r" (v1), [v2] "+r" (v2), [n] "+r" (n)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21"
+            );
+        }
+
+        void calc_oriented_plane_pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n)
+        {
+            float res;
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("cbz             %[n], 4f")
+                __ASM_EMIT("ldr             q7, [%[sp]]")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("ldp             q0, q1, [%[pv], #0x00]")
+                __ASM_EMIT("ldr             q2, [%[pv], #0x20]")
+                ORIENTED_PLANE_CORE(ORIENTED_PLANE_KEEP)
+                __ASM_EMIT("add             %[pv], %[pv], #0x30")
+                __ASM_EMIT("add             %[v], %[v], #0x10")
+                __ASM_EMIT("subs            %[n], %[n], #1")
+                __ASM_EMIT("b.ne            3b")
+                __ASM_EMIT("4:")
+                : [v] "+r" (v), [pv] "+r" (pv), [n] "+r" (n),
+                  [res] "=&w" (res)
+                : [sp] "r" (sp)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7"
+            );
+        }
+
+        #undef AOS3D_VECTOR_MUL
+        #undef AOS3D_UNIT_VECTOR
+        #undef AOS3D_AVG_DISTANCE
+        #undef AOS3D_TRIANGLE_CENTER
+        #undef AOS3D_DISTANCE
+        #undef AOS3D_SQR_DISTANCE
+        #undef AOS3D_TRIANGLE1
+        #undef AOS3D_TRIANGLE4
+        #undef AOS3D_STORE1
+        #undef AOS3D_STORE4
+        #undef AOS3D_LOAD1
+        #undef AOS3D_LOAD4
+        #undef AOS3D_LOOP
+        #undef ORIENTED_PLANE_REV_KEEP
+        #undef ORIENTED_PLANE_KEEP
+        #undef ORIENTED_PLANE_CORE
+        #undef CROSS3
+        #undef DOT3
+        #undef SOA3D_TRIANGLE_LANE
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_3DMATH_H_ */
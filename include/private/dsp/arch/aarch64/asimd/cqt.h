@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_CQT_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_CQT_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        void cqt_apply(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count)
+        {
+            for (size_t i=0; i<count; ++i, ++dst)
+            {
+                const dsp::cqt_bin_t *b = &bins[i];
+                const float *x  = &fft[b->first * 2];
+                const float *k  = &kernel[b->offset];
+                size_t n        = b->count;
+
+                ARCH_AARCH64_ASM
+                (
+                    __ASM_EMIT("eor         v0.16b, v0.16b, v0.16b")        /* v0   = sum(xr*kr) sum(xi*ki) */
+                    __ASM_EMIT("eor         v1.16b, v1.16b, v1.16b")        /* v1   = sum(xr*ki) sum(xi*kr) */
+                    __ASM_EMIT("eor         v2.16b, v2.16b, v2.16b")
+                    __ASM_EMIT("eor         v3.16b, v3.16b, v3.16b")
+                    __ASM_EMIT("subs        %[n], %[n], #4")
+                    __ASM_EMIT("b.lo        2f")
+
+                    /* x4 blocks */
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("ldp         q4, q5, [%[x]]")                /* v4   = xr0 xi0 xr1 xi1, v5 = xr2 xi2 xr3 xi3 */
+                    __ASM_EMIT("ldp         q6, q7, [%[k]]")                /* v6   = kr0 ki0 kr1 ki1, v7 = kr2 ki2 kr3 ki3 */
+                    __ASM_EMIT("rev64       v16.4s, v6.4s")                 /* v16  = ki0 kr0 ki1 kr1 */
+                    __ASM_EMIT("rev64       v17.4s, v7.4s")                 /* v17  = ki2 kr2 ki3 kr3 */
+                    __ASM_EMIT("fmla        v0.4s, v4.4s, v6.4s")
+                    __ASM_EMIT("fmla        v2.4s, v5.4s, v7.4s")
+                    __ASM_EMIT("fmla        v1.4s, v4.4s, v16.4s")
+                    __ASM_EMIT("fmla        v3.4s, v5.4s, v17.4s")
+                    __ASM_EMIT("add         %[x], %[x], #0x20")
+                    __ASM_EMIT("add         %[k], %[k], #0x20")
+                    __ASM_EMIT("subs        %[n], %[n], #4")
+                    __ASM_EMIT("b.hs        1b")
+
+                    /* x2 block */
+                    __ASM_EMIT("2:")
+                    __ASM_EMIT("adds        %[n], %[n], #2")
+                    __ASM_EMIT("b.lt        4f")
+                    __ASM_EMIT("ldr         q4, [%[x]]")
+                    __ASM_EMIT("ldr         q6, [%[k]]")
+                    __ASM_EMIT("rev64       v16.4s, v6.4s")
+                    __ASM_EMIT("fmla        v0.4s, v4.4s, v6.4s")
+                    __ASM_EMIT("fmla        v1.4s, v4.4s, v16.4s")
+                    __ASM_EMIT("add         %[x], %[x], #0x10")
+                    __ASM_EMIT("add         %[k], %[k], #0x10")
+                    __ASM_EMIT("sub         %[n], %[n], #2")
+
+                    /* x1 block */
+                    __ASM_EMIT("4:")
+                    __ASM_EMIT("adds        %[n], %[n], #1")
+                    __ASM_EMIT("b.lt        6f")
+                    __ASM_EMIT("ldr         d4, [%[x]]")                    /* v4   = xr0 xi0 0 0 */
+                    __ASM_EMIT("ldr         d6, [%[k]]")                    /* v6   = kr0 ki0 0 0 */
+                    __ASM_EMIT("rev64       v16.4s, v6.4s")
+                    __ASM_EMIT("fmla        v0.4s, v4.4s, v6.4s")
+                    __ASM_EMIT("fmla        v1.4s, v4.4s, v16.4s")
+
+                    /* Compute magnitude */
+                    __ASM_EMIT("6:")
+                    __ASM_EMIT("fadd        v0.4s, v0.4s, v2.4s")
+                    __ASM_EMIT("fadd        v1.4s, v1.4s, v3.4s")
+                    __ASM_EMIT("ext         v2.16b, v0.16b, v0.16b, #8")    /* v2   = a2 a3 a0 a1 */
+                    __ASM_EMIT("ext         v3.16b, v1.16b, v1.16b, #8")    /* v3   = b2 b3 b0 b1 */
+                    __ASM_EMIT("fadd        v0.2s, v0.2s, v2.2s")           /* v0   = a0+a2 a1+a3 */
+                    __ASM_EMIT("fadd        v1.2s, v1.2s, v3.2s")           /* v1   = b0+b2 b1+b3 */
+                    __ASM_EMIT("fneg        v2.2s, v0.2s")                  /* v2   = -(a0+a2) -(a1+a3) */
+                    __ASM_EMIT("ins         v0.s[1], v2.s[1]")              /* v0   = a0+a2 -(a1+a3) */
+                    __ASM_EMIT("faddp       s0, v0.2s")                     /* s0   = re */
+                    __ASM_EMIT("faddp       s1, v1.2s")                     /* s1   = im */
+                    __ASM_EMIT("fmul        s0, s0, s0")
+                    __ASM_EMIT("fmadd       s0, s1, s1, s0")                /* s0   = re*re + im*im */
+                    __ASM_EMIT("fsqrt       s0, s0")
+                    __ASM_EMIT("str         s0, [%[dst]]")
+
+                    : [x] "+r" (x), [k] "+r" (k), [n] "+r" (n)
+                    : [dst] "r" (dst)
+                    : "cc", "memory",
+                      "v0", "v1", "v2", "v3",
+                      "v4", "v5", "v6", "v7",
+                      "v16", "v17"
+                );
+            }
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_CQT_H_ */
@@ -0,0 +1,336 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_DYNAMICS_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_DYNAMICS_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+#include <private/dsp/arch/aarch64/asimd/pmath/exp.h>
+#include <private/dsp/arch/aarch64/asimd/pmath/log.h>
+
+#define DYNAMICS_BUF_SIZE           0x200
+
+/*
+    Envelope followers of 4 channels are computed in parallel lanes. Each
+    4x4 block of samples is transposed so that every register holds one
+    time step of all channels, the recurrence is applied step by step and
+    the block is transposed back.
+
+    Register allocation:
+      v0-v3         = samples / envelope values of 4 time steps
+      v4-v7         = temporaries
+      v28           = attack coefficients
+      v29           = release coefficients
+      v30           = envelope state
+ */
+
+// Transpose 4x4 matrix in v0-v3 using v4-v7 as temporaries
+#define DYN_TRANSPOSE \
+    __ASM_EMIT("trn1            v4.4s, v0.4s, v1.4s")           /* v4   = a0 b0 a2 b2 */ \
+    __ASM_EMIT("trn2            v5.4s, v0.4s, v1.4s")           /* v5   = a1 b1 a3 b3 */ \
+    __ASM_EMIT("trn1            v6.4s, v2.4s, v3.4s")           /* v6   = c0 d0 c2 d2 */ \
+    __ASM_EMIT("trn2            v7.4s, v2.4s, v3.4s")           /* v7   = c1 d1 c3 d3 */ \
+    __ASM_EMIT("trn1            v0.2d, v4.2d, v6.2d")           /* v0   = a0 b0 c0 d0 */ \
+    __ASM_EMIT("trn1            v1.2d, v5.2d, v7.2d")           /* v1   = a1 b1 c1 d1 */ \
+    __ASM_EMIT("trn2            v2.2d, v4.2d, v6.2d")           /* v2   = a2 b2 c2 d2 */ \
+    __ASM_EMIT("trn2            v3.2d, v5.2d, v7.2d")           /* v3   = a3 b3 c3 d3 */
+
+// Perform one step of the envelope follower for the detector in register x
+#define DYN_STEP(x) \
+    __ASM_EMIT("fsub            v4.4s, " x ".4s, v30.4s")       /* v4   = d = x - e */ \
+    __ASM_EMIT("fcmgt           " x ".4s, " x ".4s, v30.4s")    /* x    = [x > e] */ \
+    __ASM_EMIT("bsl             " x ".16b, v28.16b, v29.16b")   /* x    = k = [x > e] ? A : R */ \
+    __ASM_EMIT("fmla            v30.4s, " x ".4s, v4.4s")       /* v30  = e' = e + k*d */ \
+    __ASM_EMIT("mov             " x ".16b, v30.16b")            /* x    = e' */
+
+#define DYN_PEAK_PRE(x) \
+    __ASM_EMIT("fabs            " x ".4s, " x ".4s")            /* x    = |x| */
+
+#define DYN_RMS_PRE(x) \
+    __ASM_EMIT("fmul            " x ".4s, " x ".4s, " x ".4s")  /* x    = x*x */
+
+#define DYN_PEAK_POST(x)
+
+#define DYN_RMS_POST(x) \
+    __ASM_EMIT("fsqrt           " x ".4s, " x ".4s")            /* x    = sqrt(e) */
+
+#define DYN_ENVELOPE_KERNEL(PRE, POST) \
+    ARCH_AARCH64_ASM( \
+        __ASM_EMIT("ldp             q28, q29, [%[P], #0x00]")       /* v28  = A, v29 = R */ \
+        __ASM_EMIT("ldr             q30, [%[P], #0x20]")            /* v30  = e */ \
+        __ASM_EMIT("subs            %[count], %[count], #4") \
+        __ASM_EMIT("b.lo            2f") \
+        /* 4x blocks */ \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("ldr             q0, [%[s0]], #0x10") \
+        __ASM_EMIT("ldr             q1, [%[s1]], #0x10") \
+        __ASM_EMIT("ldr             q2, [%[s2]], #0x10") \
+        __ASM_EMIT("ldr             q3, [%[s3]], #0x10") \
+        PRE("v0") \
+        PRE("v1") \
+        PRE("v2") \
+        PRE("v3") \
+        DYN_TRANSPOSE \
+        DYN_STEP("v0") \
+        DYN_STEP("v1") \
+        DYN_STEP("v2") \
+        DYN_STEP("v3") \
+        DYN_TRANSPOSE \
+        POST("v0") \
+        POST("v1") \
+        POST("v2") \
+        POST("v3") \
+        __ASM_EMIT("str             q0, [%[d0]], #0x10") \
+        __ASM_EMIT("str             q1, [%[d1]], #0x10") \
+        __ASM_EMIT("str             q2, [%[d2]], #0x10") \
+        __ASM_EMIT("str             q3, [%[d3]], #0x10") \
+        __ASM_EMIT("subs            %[count], %[count], #4") \
+        __ASM_EMIT("b.hs            1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("adds            %[count], %[count], #3") \
+        __ASM_EMIT("b.lt            4f") \
+        __ASM_EMIT("3:") \
+        __ASM_EMIT("ld1             {v0.s}[0], [%[s0]], #0x04")     /* v0   = a ? ? ? */ \
+        __ASM_EMIT("ld1             {v0.s}[1], [%[s1]], #0x04")     /* v0   = a b ? ? */ \
+        __ASM_EMIT("ld1             {v0.s}[2], [%[s2]], #0x04")     /* v0   = a b c ? */ \
+        __ASM_EMIT("ld1             {v0.s}[3], [%[s3]], #0x04")     /* v0   = a b c d */ \
+        PRE("v0") \
+        DYN_STEP("v0") \
+        POST("v0") \
+        __ASM_EMIT("st1             {v0.s}[0], [%[d0]], #0x04") \
+        __ASM_EMIT("st1             {v0.s}[1], [%[d1]], #0x04") \
+        __ASM_EMIT("st1             {v0.s}[2], [%[d2]], #0x04") \
+        __ASM_EMIT("st1             {v0.s}[3], [%[d3]], #0x04") \
+        __ASM_EMIT("subs            %[count], %[count], #1") \
+        __ASM_EMIT("b.ge            3b") \
+        __ASM_EMIT("4:") \
+        __ASM_EMIT("str             q30, [%[P], #0x20]")            /* e = v30 */ \
+        : [count] "+r" (k), \
+          [d0] "+r" (d[0]), [d1] "+r" (d[1]), [d2] "+r" (d[2]), [d3] "+r" (d[3]), \
+          [s0] "+r" (s[0]), [s1] "+r" (s[1]), [s2] "+r" (s[2]), [s3] "+r" (s[3]) \
+        : [P] "r" (&p[0]) \
+        : "cc", "memory", \
+          "v0", "v1", "v2", "v3", \
+          "v4", "v5", "v6", "v7", \
+          "v28", "v29", "v30" \
+    )
+
+namespace lsp
+{
+    namespace asimd
+    {
+        /**
+         * Prepare the group of up to 4 channels for the parallel processing. Missing
+         * channels are substituted by the first channel of the group, so they produce
+         * the same values as the first channel.
+         * @param p parameters to initialize, 3 vectors
+         * @param d destination pointers to initialize
+         * @param s source pointers to initialize
+         * @param dst destination buffers of the group
+         * @param src source buffers of the group
+         * @param env envelope states of the group
+         * @param n number of channels in the group, 2..4
+         */
+        static inline void envelope_group_init(float *p, float **d, const float **s,
+            float **dst, const float **src, const dsp::envelope_t *env, size_t n)
+        {
+            for (size_t i=0; i<4; ++i)
+            {
+                size_t j        = (i < n) ? i : 0;
+                d[i]            = dst[j];
+                s[i]            = src[j];
+                p[i]            = env[j].attack;
+                p[i + 4]        = env[j].release;
+                p[i + 8]        = env[j].env;
+            }
+        }
+
+        void envelope_peak_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count)
+        {
+            float p[3*4] __lsp_aligned16;
+            float *d[4];
+            const float *s[4];
+
+            for (size_t i=0; i<channels; i += 4)
+            {
+                size_t n        = channels - i;
+                if (n <= 1)
+                {
+                    dsp::envelope_peak(dst[i], src[i], &env[i], count);
+                    break;
+                }
+                else if (n > 4)
+                    n               = 4;
+
+                envelope_group_init(p, d, s, &dst[i], &src[i], &env[i], n);
+                size_t k        = count;
+                DYN_ENVELOPE_KERNEL(DYN_PEAK_PRE, DYN_PEAK_POST);
+                for (size_t j=0; j<n; ++j)
+                    env[i + j].env  = p[j + 8];
+            }
+        }
+
+        void envelope_rms_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count)
+        {
+            float p[3*4] __lsp_aligned16;
+            float *d[4];
+            const float *s[4];
+
+            for (size_t i=0; i<channels; i += 4)
+            {
+                size_t n        = channels - i;
+                if (n <= 1)
+                {
+                    dsp::envelope_rms(dst[i], src[i], &env[i], count);
+                    break;
+                }
+                else if (n > 4)
+                    n               = 4;
+
+                envelope_group_init(p, d, s, &dst[i], &src[i], &env[i], n);
+                size_t k        = count;
+                DYN_ENVELOPE_KERNEL(DYN_RMS_PRE, DYN_RMS_POST);
+                for (size_t j=0; j<n; ++j)
+                    env[i + j].env  = p[j + 8];
+            }
+        }
+
+        #define GAIN_CURVE_CORE \
+            LOGN_CORE_X4("v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23", "v24", "v25") \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v26.4s")          /* v0   = 2*dir*y*L */ \
+            __ASM_EMIT("fmla            v0.4s, v2.4s, v27.4s")          /* v0   = dir*ln(x) */ \
+            __ASM_EMIT("fadd            v0.4s, v0.4s, v28.4s")          /* v0   = t = dir*ln(x) + thresh + knee */ \
+            __ASM_EMIT("fsub            v1.4s, v0.4s, v29.4s")          /* v1   = t - W */ \
+            __ASM_EMIT("fmax            v0.4s, v0.4s, v13.4s")          /* v0   = max(t, 0) */ \
+            __ASM_EMIT("fmax            v1.4s, v1.4s, v13.4s")          /* v1   = b = max(t - W, 0) */ \
+            __ASM_EMIT("fmin            v0.4s, v0.4s, v29.4s")          /* v0   = a = min(max(t, 0), W) */ \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v0.4s")           /* v0   = a*a */ \
+            __ASM_EMIT("fmla            v1.4s, v0.4s, v30.4s")          /* v1   = h = a*a*KS + b */ \
+            __ASM_EMIT("fmul            v0.4s, v1.4s, v31.4s")          /* v0   = g = h*SL */ \
+            __ASM_EMIT("fmax            v0.4s, v0.4s, v12.4s")          /* v0   = max(g, GM) */
+
+        /**
+         * Compute the gain of the curve in the natural logarithmic domain, the
+         * register budget does not allow to keep both logarithm and exponent
+         * constants, so the exponent is computed by the separate pass
+         * @param dst destination buffer
+         * @param src source buffer
+         * @param p parameters of the curve, 8 vectors
+         * @param count number of samples to process
+         */
+        static void gain_curve_log(float *dst, const float *src, const float *p, size_t count)
+        {
+            ARCH_AARCH64_ASM(
+                __ASM_EMIT("ldp             q16, q17, [%[L2C], #0x00]")     /* v16  = MM, v17 = ME */
+                __ASM_EMIT("ldp             q18, q19, [%[L2C], #0x20]")     /* v18  = C0, v19 = C1 */
+                __ASM_EMIT("ldp             q20, q21, [%[L2C], #0x40]")     /* v20  = C2, v21 = C3 */
+                __ASM_EMIT("ldp             q22, q23, [%[L2C], #0x60]")     /* v22  = C4, v23 = C5 */
+                __ASM_EMIT("ldp             q24, q25, [%[L2C], #0x80]")     /* v24  = C6, v25 = C7 */
+                __ASM_EMIT("ldp             q26, q27, [%[P], #0x00]")       /* v26  = K1, v27 = K2 */
+                __ASM_EMIT("ldp             q28, q29, [%[P], #0x20]")       /* v28  = T, v29 = W */
+                __ASM_EMIT("ldp             q30, q31, [%[P], #0x40]")       /* v30  = KS, v31 = SL */
+                __ASM_EMIT("ldp             q12, q13, [%[P], #0x60]")       /* v12  = GM, v13 = 0 */
+                __ASM_EMIT("subs            %[count], %[count], #4")
+                __ASM_EMIT("b.lo            2f")
+
+                // 4x blocks
+                __ASM_EMIT("1:")
+                __ASM_EMIT("ldr             q0, [%[src]]")
+                GAIN_CURVE_CORE
+                __ASM_EMIT("str             q0, [%[dst]]")
+                __ASM_EMIT("subs            %[count], %[count], #4")
+                __ASM_EMIT("add             %[src], %[src], #0x10")
+                __ASM_EMIT("add             %[dst], %[dst], #0x10")
+                __ASM_EMIT("b.hs            1b")
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds            %[count], %[count], #3")
+                __ASM_EMIT("b.lt            4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("ldr             s0, [%[src]]")
+                GAIN_CURVE_CORE
+                __ASM_EMIT("str             s0, [%[dst]]")
+                __ASM_EMIT("subs            %[count], %[count], #1")
+                __ASM_EMIT("add             %[src], %[src], #0x04")
+                __ASM_EMIT("add             %[dst], %[dst], #0x04")
+                __ASM_EMIT("b.ge            3b")
+                __ASM_EMIT("4:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [P] "r" (&p[0]),
+                  [L2C] "r" (&LOG2_CONST[0])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v8", "v9",
+                  "v12", "v13",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21", "v22", "v23",
+                  "v24", "v25", "v26", "v27",
+                  "v28", "v29", "v30", "v31"
+            );
+        }
+
+        void gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count)
+        {
+            float p[8*4] __lsp_aligned16;
+            for (size_t i=0; i<4; ++i)
+            {
+                p[i]            = 2.0f * c->dir;                    // K1 = 2*dir
+                p[i + 4]        = c->dir * M_LN2;                   // K2 = dir*ln(2)
+                p[i + 8]        = c->thresh + c->knee;              // T = thresh + knee
+                p[i + 12]       = 2.0f * c->knee;                   // W = 2*knee
+                p[i + 16]       = c->kscale;                        // KS = 1/(4*knee)
+                p[i + 20]       = c->slope;                         // SL = slope
+                p[i + 24]       = -80.0f;                           // GM = minimum gain
+                p[i + 28]       = 0.0f;
+            }
+
+            // Process data in chunks to keep the intermediate gain in cache
+            for (size_t off=0; off < count; off += DYNAMICS_BUF_SIZE)
+            {
+                size_t n        = count - off;
+                if (n > DYNAMICS_BUF_SIZE)
+                    n               = DYNAMICS_BUF_SIZE;
+                gain_curve_log(&dst[off], &src[off], p, n);
+                exp1(&dst[off], n);
+            }
+        }
+
+        #undef GAIN_CURVE_CORE
+    }
+}
+
+#undef DYNAMICS_BUF_SIZE
+
+#undef DYN_ENVELOPE_KERNEL
+#undef DYN_RMS_POST
+#undef DYN_PEAK_POST
+#undef DYN_RMS_PRE
+#undef DYN_PEAK_PRE
+#undef DYN_STEP
+#undef DYN_TRANSPOSE
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_DYNAMICS_H_ */
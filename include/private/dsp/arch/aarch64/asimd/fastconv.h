@@ -32,5 +32,6 @@
 #include <private/dsp/arch/aarch64/asimd/fastconv/restore.h>
 #include <private/dsp/arch/aarch64/asimd/fastconv/apply.h>
 #include <private/dsp/arch/aarch64/asimd/fastconv/papply.h>
+#include <private/dsp/arch/aarch64/asimd/fastconv/fmadd.h>
 
 #endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_FASTCONV_H_ */
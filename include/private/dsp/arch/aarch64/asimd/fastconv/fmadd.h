@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_FASTCONV_FMADD_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_FASTCONV_FMADD_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t blocks       = size_t(1) << (rank - 2); // number of 4x complex blocks, always even
+
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("ldp         q0, q1, [%[c1], #0x00]")        // v0   = ar0, v1 = ai0
+                __ASM_EMIT("ldp         q2, q3, [%[c1], #0x20]")        // v2   = ar1, v3 = ai1
+                __ASM_EMIT("ldp         q4, q5, [%[c2], #0x00]")        // v4   = br0, v5 = bi0
+                __ASM_EMIT("ldp         q6, q7, [%[c2], #0x20]")        // v6   = br1, v7 = bi1
+                __ASM_EMIT("ldp         q16, q17, [%[dst], #0x00]")     // v16  = dr0, v17 = di0
+                __ASM_EMIT("ldp         q18, q19, [%[dst], #0x20]")     // v18  = dr1, v19 = di1
+                __ASM_EMIT("fmla        v16.4s, v0.4s, v4.4s")          // v16  = dr0 + ar0*br0
+                __ASM_EMIT("fmla        v17.4s, v0.4s, v5.4s")          // v17  = di0 + ar0*bi0
+                __ASM_EMIT("fmla        v18.4s, v2.4s, v6.4s")          // v18  = dr1 + ar1*br1
+                __ASM_EMIT("fmla        v19.4s, v2.4s, v7.4s")          // v19  = di1 + ar1*bi1
+                __ASM_EMIT("fmls        v16.4s, v1.4s, v5.4s")          // v16  = dr0 + ar0*br0 - ai0*bi0
+                __ASM_EMIT("fmla        v17.4s, v1.4s, v4.4s")          // v17  = di0 + ar0*bi0 + ai0*br0
+                __ASM_EMIT("fmls        v18.4s, v3.4s, v7.4s")          // v18  = dr1 + ar1*br1 - ai1*bi1
+                __ASM_EMIT("fmla        v19.4s, v3.4s, v6.4s")          // v19  = di1 + ar1*bi1 + ai1*br1
+                __ASM_EMIT("stp         q16, q17, [%[dst], #0x00]")
+                __ASM_EMIT("stp         q18, q19, [%[dst], #0x20]")
+                __ASM_EMIT("subs        %[blocks], %[blocks], #2")
+                __ASM_EMIT("add         %[c1], %[c1], #0x40")
+                __ASM_EMIT("add         %[c2], %[c2], #0x40")
+                __ASM_EMIT("add         %[dst], %[dst], #0x40")
+                __ASM_EMIT("b.ne        1b")
+
+                : [dst] "+r" (dst), [c1] "+r" (c1), [c2] "+r" (c2),
+                  [blocks] "+r" (blocks)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19"
+            );
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_FASTCONV_FMADD_H_ */
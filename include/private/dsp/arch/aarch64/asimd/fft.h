@@ -26,6 +26,7 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
 
+#include <private/dsp/fft.h>
 #include <private/dsp/arch/aarch64/asimd/fft/const.h>
 #include <private/dsp/arch/aarch64/asimd/fft/scramble.h>
 #include <private/dsp/arch/aarch64/asimd/fft/butterfly.h>
@@ -42,15 +43,15 @@ namespace lsp
             {
                 if (rank == 2)
                 {
-                    float s0_re     = src_re[0] + src_re[1];
-                    float s1_re     = src_re[0] - src_re[1];
-                    float s2_re     = src_re[2] + src_re[3];
-                    float s3_re     = src_re[2] - src_re[3];
+                    float s0_re     = src_re[0] + src_re[2];
+                    float s1_re     = src_re[0] - src_re[2];
+                    float s2_re     = src_re[1] + src_re[3];
+                    float s3_re     = src_re[1] - src_re[3];
 
-                    float s0_im     = src_im[0] + src_im[1];
-                    float s1_im     = src_im[0] - src_im[1];
-                    float s2_im     = src_im[2] + src_im[3];
-                    float s3_im     = src_im[2] - src_im[3];
+                    float s0_im     = src_im[0] + src_im[2];
+                    float s1_im     = src_im[0] - src_im[2];
+                    float s2_im     = src_im[1] + src_im[3];
+                    float s3_im     = src_im[1] - src_im[3];
 
                     dst_re[0]       = s0_re + s2_re;
                     dst_re[1]       = s1_re + s3_im;
@@ -104,15 +105,15 @@ namespace lsp
             {
                 if (rank == 2)
                 {
-                    float s0_re     = src_re[0] + src_re[1];
-                    float s1_re     = src_re[0] - src_re[1];
-                    float s2_re     = src_re[2] + src_re[3];
-                    float s3_re     = src_re[2] - src_re[3];
+                    float s0_re     = src_re[0] + src_re[2];
+                    float s1_re     = src_re[0] - src_re[2];
+                    float s2_re     = src_re[1] + src_re[3];
+                    float s3_re     = src_re[1] - src_re[3];
 
-                    float s0_im     = src_im[0] + src_im[1];
-                    float s1_im     = src_im[0] - src_im[1];
-                    float s2_im     = src_im[2] + src_im[3];
-                    float s3_im     = src_im[2] - src_im[3];
+                    float s0_im     = src_im[0] + src_im[2];
+                    float s1_im     = src_im[0] - src_im[2];
+                    float s2_im     = src_im[1] + src_im[3];
+                    float s3_im     = src_im[1] - src_im[3];
 
                     dst_re[0]       = (s0_re + s2_re)*0.25f;
                     dst_re[1]       = (s1_re - s3_im)*0.25f;
@@ -160,6 +161,89 @@ namespace lsp
 
             dsp::normalize_fft2(dst_re, dst_im, rank);
         }
+
+        void direct_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    direct_fft(dst_re[i], dst_im[i], src_re[i], src_im[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                // Scramble data
+                for (size_t j=0; j<n; ++j)
+                {
+                    if ((dst_re[j] == src_re[j]) || (dst_im[j] == src_im[j]))
+                    {
+                        dsp::move(dst_re[j], src_re[j], 1 << rank);
+                        dsp::move(dst_im[j], src_im[j], 1 << rank);
+                        scramble_self_direct(dst_re[j], dst_im[j], rank);
+                    }
+                    else
+                        scramble_copy_direct(dst_re[j], dst_im[j], src_re[j], src_im[j], rank);
+                }
+
+                for (size_t j=0; j<n; ++j)
+                    direct_butterfly_rank3(dst_re[j], dst_im[j], 1 << (rank-3));
+
+                for (size_t i=4; i <= rank; ++i)
+                    direct_butterfly_rank4p_batch(dst_re, dst_im, i, 1 << (rank - i), n);
+
+                dst_re         += n;
+                dst_im         += n;
+                src_re         += n;
+                src_im         += n;
+                count          -= n;
+            }
+        }
+
+        void reverse_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    reverse_fft(dst_re[i], dst_im[i], src_re[i], src_im[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                // Scramble data
+                for (size_t j=0; j<n; ++j)
+                {
+                    if ((dst_re[j] == src_re[j]) || (dst_im[j] == src_im[j]))
+                    {
+                        dsp::move(dst_re[j], src_re[j], 1 << rank);
+                        dsp::move(dst_im[j], src_im[j], 1 << rank);
+                        scramble_self_reverse(dst_re[j], dst_im[j], rank);
+                    }
+                    else
+                        scramble_copy_reverse(dst_re[j], dst_im[j], src_re[j], src_im[j], rank);
+                }
+
+                for (size_t j=0; j<n; ++j)
+                    reverse_butterfly_rank3(dst_re[j], dst_im[j], 1 << (rank-3));
+
+                for (size_t i=4; i <= rank; ++i)
+                    reverse_butterfly_rank4p_batch(dst_re, dst_im, i, 1 << (rank - i), n);
+
+                for (size_t j=0; j<n; ++j)
+                    dsp::normalize_fft2(dst_re[j], dst_im[j], rank);
+
+                dst_re         += n;
+                dst_im         += n;
+                src_re         += n;
+                src_im         += n;
+                count          -= n;
+            }
+        }
     }
 }
 
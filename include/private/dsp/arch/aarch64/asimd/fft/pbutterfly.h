@@ -229,7 +229,147 @@ namespace lsp
             );
         }
 
+    #define BUTTERFLY_RANK4_BATCH(op1, op2) \
+        /* Prepare angle */ \
+        __ASM_EMIT("ldp         q28, q29, [%[XFFT_A], #0x00]")          /* q28  = wr1, q29 = wr2 */ \
+        __ASM_EMIT("ldp         q30, q31, [%[XFFT_A], #0x20]")          /* q30  = wi1, q31 = wi2 */ \
+        __ASM_EMIT("ldp         q24, q25, [%[XFFT_W], #0x00]")          /* q24  = dr,  q25 = di  */ \
+        __ASM_EMIT("mov         %[off], #0") \
+        /* Loop over groups of 8 pairs */ \
+        __ASM_EMIT("1:") \
+            __ASM_EMIT("mov         %[v], %[dst]")                          /* v    = dst */ \
+            __ASM_EMIT("mov         %[j], %[count]")                        /* j    = count */ \
+            /* Loop over transforms */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("ldr         %[a], [%[v]], #8")                      /* a    = *(v++) */ \
+            __ASM_EMIT("add         %[a], %[a], %[off]") \
+            __ASM_EMIT("add         %[b], %[a], %[shift]") \
+            __ASM_EMIT("mov         %[k], %[blocks]") \
+            /* Loop over blocks: 8x butterflies */ \
+            /* Calculate complex c = w * b */ \
+            __ASM_EMIT("3:") \
+            __ASM_EMIT("ldp         q0, q2, [%[a], #0x00]")                 /* v0   = ar1, v2 = ai1 */ \
+            __ASM_EMIT("ldp         q1, q3, [%[a], #0x20]")                 /* v1   = ar2, v3 = ai2 */ \
+            __ASM_EMIT("ldp         q4, q6, [%[b], #0x00]")                 /* v4   = br1, v6 = bi1 */ \
+            __ASM_EMIT("ldp         q5, q7, [%[b], #0x20]")                 /* v5   = br2, v7 = bi2 */ \
+            /* Calc cr and ci */ \
+            __ASM_EMIT("fmul        v16.4s, v28.4s, v4.4s")                 /* v16  = wr1 * br1 */ \
+            __ASM_EMIT("fmul        v17.4s, v29.4s, v5.4s")                 /* v17  = wr2 * br2 */ \
+            __ASM_EMIT("fmul        v18.4s, v28.4s, v6.4s")                 /* v18  = wr1 * bi1 */ \
+            __ASM_EMIT("fmul        v19.4s, v29.4s, v7.4s")                 /* v19  = wr2 * bi2 */ \
+            __ASM_EMIT(op1 "        v16.4s, v30.4s, v6.4s")                 /* v16  = wr1 * br1 +- wi1 * bi1 = cr1 */ \
+            __ASM_EMIT(op1 "        v17.4s, v31.4s, v7.4s")                 /* v17  = wr2 * br2 +- wi2 * bi2 = cr2 */ \
+            __ASM_EMIT(op2 "        v18.4s, v30.4s, v4.4s")                 /* v18  = wr1 * bi1 -+ wi1 * br1 = ci1 */ \
+            __ASM_EMIT(op2 "        v19.4s, v31.4s, v5.4s")                 /* v19  = wr1 * bi1 -+ wi2 * br2 = ci2 */ \
+            /* Apply butterfly */ \
+            __ASM_EMIT("fsub        v4.4s, v0.4s, v16.4s")                  /* v4   = ar1 - cr1 */ \
+            __ASM_EMIT("fsub        v5.4s, v1.4s, v17.4s")                  /* v5   = ar2 - cr2 */ \
+            __ASM_EMIT("fsub        v6.4s, v2.4s, v18.4s")                  /* v6   = ai1 - ci1 */ \
+            __ASM_EMIT("fsub        v7.4s, v3.4s, v19.4s")                  /* v7   = ai2 - ci2 */ \
+            __ASM_EMIT("fadd        v0.4s, v0.4s, v16.4s")                  /* v0   = ar1 + cr1 */ \
+            __ASM_EMIT("fadd        v1.4s, v1.4s, v17.4s")                  /* v1   = ar2 + cr2 */ \
+            __ASM_EMIT("fadd        v2.4s, v2.4s, v18.4s")                  /* v2   = ai1 + ci1 */ \
+            __ASM_EMIT("fadd        v3.4s, v3.4s, v19.4s")                  /* v3   = ai2 + ci2 */ \
+            __ASM_EMIT("stp         q0, q2, [%[a], #0x00]") \
+            __ASM_EMIT("stp         q1, q3, [%[a], #0x20]") \
+            __ASM_EMIT("stp         q4, q6, [%[b], #0x00]") \
+            __ASM_EMIT("stp         q5, q7, [%[b], #0x20]") \
+            __ASM_EMIT("subs        %[k], %[k], #1") \
+            __ASM_EMIT("add         %[a], %[a], %[stride]") \
+            __ASM_EMIT("add         %[b], %[b], %[stride]") \
+            __ASM_EMIT("b.ne        3b") \
+        __ASM_EMIT("subs        %[j], %[j], #1") \
+        __ASM_EMIT("b.ne        2b") \
+        /* Move to the next group of pairs */ \
+        __ASM_EMIT("subs        %[np], %[np], #2") \
+        __ASM_EMIT("add         %[off], %[off], #0x40") \
+        __ASM_EMIT("b.le        4f") \
+        /* Rotate angle */ \
+        __ASM_EMIT("fmul        v16.4s, v28.4s, v25.4s")                /* v16  = wr1 * di */ \
+        __ASM_EMIT("fmul        v17.4s, v29.4s, v25.4s")                /* v17  = wr2 * di */ \
+        __ASM_EMIT("fmul        v18.4s, v30.4s, v25.4s")                /* v18  = wi1 * di */ \
+        __ASM_EMIT("fmul        v19.4s, v31.4s, v25.4s")                /* v19  = wi2 * di */ \
+        __ASM_EMIT("fmul        v28.4s, v28.4s, v24.4s")                /* v28  = wr1 * dr */ \
+        __ASM_EMIT("fmul        v29.4s, v29.4s, v24.4s")                /* v29  = wr2 * dr */ \
+        __ASM_EMIT("fmul        v30.4s, v30.4s, v24.4s")                /* v30  = wi1 * dr */ \
+        __ASM_EMIT("fmul        v31.4s, v31.4s, v24.4s")                /* v31  = wi2 * dr */ \
+        __ASM_EMIT("fsub        v28.4s, v28.4s, v18.4s")                /* v28  = wr1*dr - wi1*di */ \
+        __ASM_EMIT("fsub        v29.4s, v29.4s, v19.4s")                /* v29  = wr2*dr - wi2*di */ \
+        __ASM_EMIT("fadd        v30.4s, v30.4s, v16.4s")                /* v30  = wi1*dr + wr1*di */ \
+        __ASM_EMIT("fadd        v31.4s, v31.4s, v17.4s")                /* v31  = wi2*dr + wr2*di */ \
+        __ASM_EMIT("b           1b") \
+        __ASM_EMIT("4:")
+
+        /**
+         * Batch butterflies: each group of 8 angles is computed once and applied
+         * to all blocks of all transforms in the batch before it gets rotated
+         */
+        void packed_direct_butterfly_rank4p_batch(float **dst, size_t rank, size_t blocks, size_t count)
+        {
+            IF_ARCH_AARCH64(
+                rank -= 3;
+                const float *xfft_a = &XFFT_A[rank << 4];
+                const float *xfft_dw = &XFFT_DW[rank << 3];
+                size_t np = 1 << rank;
+                size_t shift = np << 5;
+                size_t stride = shift << 1;
+                float **v;
+                float *a, *b;
+                size_t off, j, k;
+            )
+
+            ARCH_AARCH64_ASM(
+                BUTTERFLY_RANK4_BATCH("fmla", "fmls")
+                : [v] "=&r" (v), [a] "=&r" (a), [b] "=&r" (b),
+                  [off] "=&r" (off), [j] "=&r" (j), [k] "=&r" (k),
+                  [np] "+r" (np)
+                : [dst] "r" (dst),
+                  [count] "r" (count), [blocks] "r" (blocks),
+                  [shift] "r" (shift), [stride] "r" (stride),
+                  [XFFT_A] "r" (xfft_a), [XFFT_W] "r" (xfft_dw)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19",
+                  "v24", "v25",
+                  "v28", "v29", "v30", "v31"
+            );
+        }
+
+        void packed_reverse_butterfly_rank4p_batch(float **dst, size_t rank, size_t blocks, size_t count)
+        {
+            IF_ARCH_AARCH64(
+                rank -= 3;
+                const float *xfft_a = &XFFT_A[rank << 4];
+                const float *xfft_dw = &XFFT_DW[rank << 3];
+                size_t np = 1 << rank;
+                size_t shift = np << 5;
+                size_t stride = shift << 1;
+                float **v;
+                float *a, *b;
+                size_t off, j, k;
+            )
+
+            ARCH_AARCH64_ASM(
+                BUTTERFLY_RANK4_BATCH("fmls", "fmla")
+                : [v] "=&r" (v), [a] "=&r" (a), [b] "=&r" (b),
+                  [off] "=&r" (off), [j] "=&r" (j), [k] "=&r" (k),
+                  [np] "+r" (np)
+                : [dst] "r" (dst),
+                  [count] "r" (count), [blocks] "r" (blocks),
+                  [shift] "r" (shift), [stride] "r" (stride),
+                  [XFFT_A] "r" (xfft_a), [XFFT_W] "r" (xfft_dw)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19",
+                  "v24", "v25",
+                  "v28", "v29", "v30", "v31"
+            );
+        }
+
         #undef PBUTTERFLY_RANK4
+        #undef BUTTERFLY_RANK4_BATCH
     }
 }
 
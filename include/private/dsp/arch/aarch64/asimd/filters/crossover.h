@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_FILTERS_CROSSOVER_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_FILTERS_CROSSOVER_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+/*
+    Bands are processed by groups of 4 in parallel lanes. For each block of 4 samples
+    all sections of the crossover are applied to 4 broadcasted samples, so the memory
+    and coefficients of the section are loaded once per block. Then the block is
+    transposed and stored to 4 destination buffers.
+
+    Lanes of the group that do not match any band have identity sections and store
+    the data to the buffer of the first band of the group. Stores are performed in
+    descending order of lanes, so the valid data is always written last.
+
+    Register allocation:
+      v0-v3         = samples of 4 time steps
+      v4-v5         = memory of the section d0, d1
+      v6-v7         = temporaries
+      v16-v20       = coefficients of the section b0, b1, b2, a1, a2
+ */
+
+// Load coefficients and memory of the section
+#define XO_LOAD \
+    __ASM_EMIT("ldr             q16, [%[f], #0x00]")            /* v16  = b0 */ \
+    __ASM_EMIT("ldr             q17, [%[f], #0x20]")            /* v17  = b1 */ \
+    __ASM_EMIT("ldr             q18, [%[f], #0x40]")            /* v18  = b2 */ \
+    __ASM_EMIT("ldr             q19, [%[f], #0x60]")            /* v19  = a1 */ \
+    __ASM_EMIT("ldr             q20, [%[f], #0x80]")            /* v20  = a2 */ \
+    __ASM_EMIT("ldr             q4, [%[d], #0x00]")             /* v4   = d0 */ \
+    __ASM_EMIT("ldr             q5, [%[d], #0x20]")             /* v5   = d1 */
+
+// Store memory of the section and move to the next one
+#define XO_STORE \
+    __ASM_EMIT("str             q4, [%[d], #0x00]") \
+    __ASM_EMIT("str             q5, [%[d], #0x20]") \
+    __ASM_EMIT("add             %[f], %[f], #0xa0")             /* f    = next biquad_x8_t */ \
+    __ASM_EMIT("add             %[d], %[d], #0x40")             /* d    = next d0[8], d1[8] */
+
+// Apply the section to the register x
+#define XO_BIQUAD(x) \
+    __ASM_EMIT("fmul            v6.4s, " x ".4s, v17.4s")       /* v6   = b1*x */ \
+    __ASM_EMIT("fmul            v7.4s, " x ".4s, v18.4s")       /* v7   = b2*x */ \
+    __ASM_EMIT("fmul            " x ".4s, " x ".4s, v16.4s")    /* x    = b0*x */ \
+    __ASM_EMIT("fadd            " x ".4s, " x ".4s, v4.4s")     /* x    = y = b0*x + d0 */ \
+    __ASM_EMIT("fmul            v4.4s, " x ".4s, v19.4s")       /* v4   = a1*y */ \
+    __ASM_EMIT("fadd            v4.4s, v4.4s, v6.4s")           /* v4   = b1*x + a1*y */ \
+    __ASM_EMIT("fadd            v4.4s, v4.4s, v5.4s")           /* v4   = d0' = b1*x + a1*y + d1 */ \
+    __ASM_EMIT("fmul            v5.4s, " x ".4s, v20.4s")       /* v5   = a2*y */ \
+    __ASM_EMIT("fadd            v5.4s, v5.4s, v7.4s")           /* v5   = d1' = b2*x + a2*y */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        void crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c)
+        {
+            float *vd[4];
+            size_t off, f, d, i, t;
+
+            for (size_t g=0; g<c->bands; g += 4)
+            {
+                for (size_t j=0; j<4; ++j)
+                    vd[j]           = (g + j < c->bands) ? dst[g + j] : dst[g];
+                size_t k        = count;
+
+                ARCH_AARCH64_ASM(
+                    __ASM_EMIT("mov             %[off], #0")
+                    __ASM_EMIT("subs            %[count], %[count], #4")
+                    __ASM_EMIT("b.lo            2f")
+
+                    // 4x blocks
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("ldr             q0, [%[src], %[off]]")          /* v0   = s0 s1 s2 s3 */
+                    __ASM_EMIT("dup             v1.4s, v0.s[1]")                /* v1   = s1 */
+                    __ASM_EMIT("dup             v2.4s, v0.s[2]")                /* v2   = s2 */
+                    __ASM_EMIT("dup             v3.4s, v0.s[3]")                /* v3   = s3 */
+                    __ASM_EMIT("dup             v0.4s, v0.s[0]")                /* v0   = s0 */
+                    __ASM_EMIT("mov             %[f], %[FB]")
+                    __ASM_EMIT("mov             %[d], %[DB]")
+                    __ASM_EMIT("mov             %[i], %[N]")
+                    __ASM_EMIT("3:")
+                    XO_LOAD
+                    XO_BIQUAD("v0")
+                    XO_BIQUAD("v1")
+                    XO_BIQUAD("v2")
+                    XO_BIQUAD("v3")
+                    XO_STORE
+                    __ASM_EMIT("subs            %[i], %[i], #1")
+                    __ASM_EMIT("b.ne            3b")
+                    // Transpose: v0 = a0 a1 a2 a3, v1 = b0 b1 b2 b3, ...
+                    __ASM_EMIT("trn1            v4.4s, v0.4s, v1.4s")           /* v4   = a0 b0 a2 b2 */
+                    __ASM_EMIT("trn2            v5.4s, v0.4s, v1.4s")           /* v5   = a1 b1 a3 b3 */
+                    __ASM_EMIT("trn1            v6.4s, v2.4s, v3.4s")           /* v6   = c0 d0 c2 d2 */
+                    __ASM_EMIT("trn2            v7.4s, v2.4s, v3.4s")           /* v7   = c1 d1 c3 d3 */
+                    __ASM_EMIT("trn1            v0.2d, v4.2d, v6.2d")           /* v0   = a0 b0 c0 d0 */
+                    __ASM_EMIT("trn1            v1.2d, v5.2d, v7.2d")           /* v1   = a1 b1 c1 d1 */
+                    __ASM_EMIT("trn2            v2.2d, v4.2d, v6.2d")           /* v2   = a2 b2 c2 d2 */
+                    __ASM_EMIT("trn2            v3.2d, v5.2d, v7.2d")           /* v3   = a3 b3 c3 d3 */
+                    // Store in descending order
+                    __ASM_EMIT("ldr             %[t], [%[dst], #0x18]")
+                    __ASM_EMIT("str             q3, [%[t], %[off]]")
+                    __ASM_EMIT("ldr             %[t], [%[dst], #0x10]")
+                    __ASM_EMIT("str             q2, [%[t], %[off]]")
+                    __ASM_EMIT("ldr             %[t], [%[dst], #0x08]")
+                    __ASM_EMIT("str             q1, [%[t], %[off]]")
+                    __ASM_EMIT("ldr             %[t], [%[dst], #0x00]")
+                    __ASM_EMIT("str             q0, [%[t], %[off]]")
+                    __ASM_EMIT("add             %[off], %[off], #0x10")
+                    __ASM_EMIT("subs            %[count], %[count], #4")
+                    __ASM_EMIT("b.hs            1b")
+
+                    // 1x blocks
+                    __ASM_EMIT("2:")
+                    __ASM_EMIT("adds            %[count], %[count], #3")
+                    __ASM_EMIT("b.lt            4f")
+                    __ASM_EMIT("5:")
+                    __ASM_EMIT("ldr             s0, [%[src], %[off]]")          /* v0   = s0 */
+                    __ASM_EMIT("dup             v0.4s, v0.s[0]")                /* v0   = s0 s0 s0 s0 */
+                    __ASM_EMIT("mov             %[f], %[FB]")
+                    __ASM_EMIT("mov             %[d], %[DB]")
+                    __ASM_EMIT("mov             %[i], %[N]")
+                    __ASM_EMIT("6:")
+                    XO_LOAD
+                    XO_BIQUAD("v0")
+                    XO_STORE
+                    __ASM_EMIT("subs            %[i], %[i], #1")
+                    __ASM_EMIT("b.ne            6b")
+                    // Store in descending order
+                    __ASM_EMIT("ldr             %[t], [%[dst], #0x18]")
+                    __ASM_EMIT("add             %[t], %[t], %[off]")
+                    __ASM_EMIT("st1             {v0.s}[3], [%[t]]")
+                    __ASM_EMIT("ldr             %[t], [%[dst], #0x10]")
+                    __ASM_EMIT("add             %[t], %[t], %[off]")
+                    __ASM_EMIT("st1             {v0.s}[2], [%[t]]")
+                    __ASM_EMIT("ldr             %[t], [%[dst], #0x08]")
+                    __ASM_EMIT("add             %[t], %[t], %[off]")
+                    __ASM_EMIT("st1             {v0.s}[1], [%[t]]")
+                    __ASM_EMIT("ldr             %[t], [%[dst], #0x00]")
+                    __ASM_EMIT("str             s0, [%[t], %[off]]")
+                    __ASM_EMIT("add             %[off], %[off], #4")
+                    __ASM_EMIT("subs            %[count], %[count], #1")
+                    __ASM_EMIT("b.ge            5b")
+
+                    __ASM_EMIT("4:")
+                    : [count] "+r" (k),
+                      [off] "=&r" (off), [f] "=&r" (f), [d] "=&r" (d),
+                      [i] "=&r" (i), [t] "=&r" (t)
+                    : [src] "r" (src), [dst] "r" (&vd[0]),
+                      [FB] "r" (&c->stage[0].b0[g]), [DB] "r" (&c->d[g]),
+                      [N] "r" (size_t(c->stages))
+                    : "cc", "memory",
+                      "v0", "v1", "v2", "v3",
+                      "v4", "v5", "v6", "v7",
+                      "v16", "v17", "v18", "v19",
+                      "v20"
+                );
+            }
+        }
+    }
+}
+
+#undef XO_BIQUAD
+#undef XO_STORE
+#undef XO_LOAD
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_FILTERS_CROSSOVER_H_ */
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_GRAPHICS_COLORMAP_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_GRAPHICS_COLORMAP_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        IF_ARCH_AARCH64(
+            static const uint32_t SPECTROGRAM_CONST[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0x00800000),           // X_MIN    = FLT_MIN
+                LSP_DSP_VEC4(0x007fffff),           // X_MANT
+                LSP_DSP_VEC4(0x0000007f),           // X_BIAS   = 127
+                LSP_DSP_VEC4(0x3f800000),           // ONE
+                LSP_DSP_VEC4(0x3e2308c0),           // C3
+                LSP_DSP_VEC4(0xbf1502ca),           // C2
+                LSP_DSP_VEC4(0x3fb6204d),           // C1
+                LSP_DSP_VEC4(0x437f0000)            // MAX      = 255.0
+            };
+        )
+
+        // Input: v = magnitudes, v16-v23 = constants, v24 = k, v25 = b
+        // Output: e = colormap indices
+        #define SPECTROGRAM_CORE(v, e, p) \
+            __ASM_EMIT("fabs            " v ".4s, " v ".4s")                        /* v = abs(s) */ \
+            __ASM_EMIT("fcmge           " p ".4s, " v ".4s, v16.4s")                /* p = [ v >= X_MIN ] */ \
+            __ASM_EMIT("bif             " v ".16b, v16.16b, " p ".16b")             /* v = max(abs(s), X_MIN), NaN -> X_MIN */ \
+            __ASM_EMIT("ushr            " e ".4s, " v ".4s, #23")                   /* e = ilog2(v) + 127 */ \
+            __ASM_EMIT("and             " v ".16b, " v ".16b, v17.16b")             /* v = mant(v) */ \
+            __ASM_EMIT("sub             " e ".4s, " e ".4s, v18.4s")                /* e = ilog2(v) */ \
+            __ASM_EMIT("orr             " v ".16b, " v ".16b, v19.16b")             /* v = 1 + M */ \
+            __ASM_EMIT("scvtf           " e ".4s, " e ".4s")                        /* e = E = float(ilog2(v)) */ \
+            __ASM_EMIT("fsub            " v ".4s, " v ".4s, v19.4s")                /* v = M */ \
+            __ASM_EMIT("fmul            " p ".4s, " v ".4s, v20.4s")                /* p = M*C3 */ \
+            __ASM_EMIT("fadd            " p ".4s, " p ".4s, v21.4s")                /* p = C2+M*C3 */ \
+            __ASM_EMIT("fmul            " p ".4s, " p ".4s, " v ".4s")              /* p = M*(C2+M*C3) */ \
+            __ASM_EMIT("fadd            " p ".4s, " p ".4s, v22.4s")                /* p = C1+M*(C2+M*C3) */ \
+            __ASM_EMIT("fmul            " p ".4s, " p ".4s, " v ".4s")              /* p = M*(C1+M*(C2+M*C3)) = log2(1 + M) */ \
+            __ASM_EMIT("fadd            " e ".4s, " e ".4s, " p ".4s")              /* e = E + log2(1 + M) = log2(v) */ \
+            __ASM_EMIT("fmul            " e ".4s, " e ".4s, v24.4s")                /* e = k*log2(v) */ \
+            __ASM_EMIT("fadd            " e ".4s, " e ".4s, v25.4s")                /* e = k*log2(v) + b */ \
+            __ASM_EMIT("fmin            " e ".4s, " e ".4s, v23.4s")                /* e = min(k*log2(v) + b, 255) */ \
+            __ASM_EMIT("fcvtzu          " e ".4s, " e ".4s")                        /* e = uint(min(k*log2(v) + b, 255)), negative -> 0 */
+
+        // Input: e = colormap indices
+        #define SPECTROGRAM_STORE_X4(e) \
+            __ASM_EMIT("umov            %w[t0], " e ".s[0]") \
+            __ASM_EMIT("umov            %w[t1], " e ".s[1]") \
+            __ASM_EMIT("umov            %w[t2], " e ".s[2]") \
+            __ASM_EMIT("umov            %w[t3], " e ".s[3]") \
+            __ASM_EMIT("ldr             %w[t0], [%[lut], %[t0], lsl #2]")           /* t0 = lut[e[0]] */ \
+            __ASM_EMIT("ldr             %w[t1], [%[lut], %[t1], lsl #2]") \
+            __ASM_EMIT("ldr             %w[t2], [%[lut], %[t2], lsl #2]") \
+            __ASM_EMIT("ldr             %w[t3], [%[lut], %[t3], lsl #2]") \
+            __ASM_EMIT("stp             %w[t0], %w[t1], [%[dst], #0x00]") \
+            __ASM_EMIT("stp             %w[t2], %w[t3], [%[dst], #0x08]") \
+            __ASM_EMIT("add             %[dst], %[dst], #0x10")
+
+        void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count)
+        {
+            IF_ARCH_AARCH64(
+                float range         = 255.0f / (dbmax - dbmin);
+                float params[2] __lsp_aligned16;
+                params[0]           = 6.02059991f * range;         // k = 20 * log10(2) dB per octave
+                params[1]           = 0.5f - dbmin * range;        // b
+                size_t t0, t1, t2, t3;
+            );
+
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("ldp             q16, q17, [%[SC], #0x00]")          // v16  = X_MIN, v17 = X_MANT
+                __ASM_EMIT("ldp             q18, q19, [%[SC], #0x20]")          // v18  = X_BIAS, v19 = ONE
+                __ASM_EMIT("ldp             q20, q21, [%[SC], #0x40]")          // v20  = C3, v21 = C2
+                __ASM_EMIT("ldp             q22, q23, [%[SC], #0x60]")          // v22  = C1, v23 = MAX
+                __ASM_EMIT("ld2r            {v24.4s, v25.4s}, [%[params]]")     // v24  = k, v25 = b
+
+                // x8 blocks
+                __ASM_EMIT("subs            %[count], %[count], #8")
+                __ASM_EMIT("b.lo            2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("ldp             q0, q3, [%[src], #0x00]")
+                SPECTROGRAM_CORE("v0", "v1", "v2")
+                SPECTROGRAM_CORE("v3", "v4", "v5")
+                SPECTROGRAM_STORE_X4("v1")
+                SPECTROGRAM_STORE_X4("v4")
+                __ASM_EMIT("add             %[src], %[src], #0x20")
+                __ASM_EMIT("subs            %[count], %[count], #8")
+                __ASM_EMIT("b.hs            1b")
+
+                // x4 block
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds            %[count], %[count], #4")
+                __ASM_EMIT("b.lt            4f")
+                __ASM_EMIT("ldr             q0, [%[src], #0x00]")
+                SPECTROGRAM_CORE("v0", "v1", "v2")
+                SPECTROGRAM_STORE_X4("v1")
+                __ASM_EMIT("add             %[src], %[src], #0x10")
+                __ASM_EMIT("sub             %[count], %[count], #4")
+
+                // x1 blocks
+                __ASM_EMIT("4:")
+                __ASM_EMIT("adds            %[count], %[count], #3")
+                __ASM_EMIT("b.lt            6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("ld1r            {v0.4s}, [%[src]]")
+                SPECTROGRAM_CORE("v0", "v1", "v2")
+                __ASM_EMIT("umov            %w[t0], v1.s[0]")
+                __ASM_EMIT("ldr             %w[t0], [%[lut], %[t0], lsl #2]")   // t0 = lut[e[0]]
+                __ASM_EMIT("str             %w[t0], [%[dst]]")
+                __ASM_EMIT("add             %[src], %[src], #0x04")
+                __ASM_EMIT("add             %[dst], %[dst], #0x04")
+                __ASM_EMIT("subs            %[count], %[count], #1")
+                __ASM_EMIT("b.ge            5b")
+
+                // End
+                __ASM_EMIT("6:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+                  [t0] "=&r" (t0), [t1] "=&r" (t1), [t2] "=&r" (t2), [t3] "=&r" (t3)
+                : [lut] "r" (lut),
+                  [params] "r" (&params[0]),
+                  [SC] "r" (&SPECTROGRAM_CONST[0])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3", "v4", "v5",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21", "v22", "v23",
+                  "v24", "v25"
+            );
+        }
+
+        #undef SPECTROGRAM_STORE_X4
+        #undef SPECTROGRAM_CORE
+
+    } /* namespace asimd */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_GRAPHICS_COLORMAP_H_ */
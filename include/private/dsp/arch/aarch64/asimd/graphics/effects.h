@@ -539,6 +539,304 @@ namespace lsp
 
         #undef EFF_HSLA_ALPHA_CORE
 
+        IF_ARCH_AARCH64(
+            static const float EFF_HSLA_BGRA32_XC[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(1.0f),
+                LSP_DSP_VEC4(255.0f),
+                LSP_DSP_VEC4(1.0f / 3.0f),
+                LSP_DSP_VEC4(6.0f),
+                LSP_DSP_VEC4(4.0f)
+            };
+        )
+
+    /*
+     * Fused effects use the closed form of HSL->RGB conversion:
+     *   R = T1 + D * W(H + 1/3), G = T1 + D * W(H), B = T1 + D * W(H - 1/3)
+     * where W(t) = min(max(min(6*t, 4 - 6*t), 0), 1), D = 2 * S * min(L, 1 - L), T1 = L - D/2
+     *
+     * v24 = 1, v25 = 255, v26 = 1/3, v27 = 6, v28 = 4, v29 = 0
+     */
+    #define EFF_HSLA_BGRA32_INIT \
+        __ASM_EMIT("ldp             q24, q25, [%[XC], #0x00]")  /* v24  = 1, v25 = 255 */ \
+        __ASM_EMIT("ldp             q26, q27, [%[XC], #0x20]")  /* v26  = 1/3, v27 = 6 */ \
+        __ASM_EMIT("ldr             q28, [%[XC], #0x40]")       /* v28  = 4 */ \
+        __ASM_EMIT("eor             v29.16b, v29.16b, v29.16b") /* v29  = 0 */
+
+    #define EFF_HSLA_WEIGHT(t) \
+        __ASM_EMIT("fmul            " t ".4s, " t ".4s, v27.4s")    /* t    = 6*t */ \
+        __ASM_EMIT("fsub            v4.4s, v28.4s, " t ".4s")       /* v4   = 4 - 6*t */ \
+        __ASM_EMIT("fmin            " t ".4s, " t ".4s, v4.4s")     /* t    = min(6*t, 4 - 6*t) */ \
+        __ASM_EMIT("fmax            " t ".4s, " t ".4s, v29.4s")    /* t    = max(min(6*t, 4 - 6*t), 0) */ \
+        __ASM_EMIT("fmin            " t ".4s, " t ".4s, v24.4s")    /* t    = W(t) */
+
+    #define EFF_HSLA_WEIGHTS_CORE \
+        /* v2   = H */ \
+        __ASM_EMIT("fadd            v0.4s, v2.4s, v26.4s")      /* v0   = H + 1/3 */ \
+        __ASM_EMIT("mov             v1.16b, v2.16b")            /* v1   = TG = H */ \
+        __ASM_EMIT("fsub            v2.4s, v2.4s, v26.4s")      /* v2   = H - 1/3 */ \
+        __ASM_EMIT("fcmgt           v4.4s, v0.4s, v24.4s")      /* v4   = [ H + 1/3 > 1 ] */ \
+        __ASM_EMIT("fcmlt           v5.4s, v2.4s, #0.0")        /* v5   = [ H - 1/3 < 0 ] */ \
+        __ASM_EMIT("and             v4.16b, v4.16b, v24.16b")   /* v4   = 1 & [ H + 1/3 > 1 ] */ \
+        __ASM_EMIT("and             v5.16b, v5.16b, v24.16b")   /* v5   = 1 & [ H - 1/3 < 0 ] */ \
+        __ASM_EMIT("fsub            v0.4s, v0.4s, v4.4s")       /* v0   = TR */ \
+        __ASM_EMIT("fadd            v2.4s, v2.4s, v5.4s")       /* v2   = TB */ \
+        EFF_HSLA_WEIGHT("v0")                                   /* v0   = WR */ \
+        EFF_HSLA_WEIGHT("v1")                                   /* v1   = WG */ \
+        EFF_HSLA_WEIGHT("v2")                                   /* v2   = WB */
+
+    #define EFF_HSLA_PIXEL_CORE(T1, D, WR, WG, WB) \
+        /* v3   = alpha */ \
+        __ASM_EMIT("fmul            v3.4s, v3.4s, v25.4s")      /* v3   = alpha * 255 */ \
+        __ASM_EMIT("fmul            v4.4s, " D ".4s, " WB ".4s")    /* v4   = D*WB */ \
+        __ASM_EMIT("fmul            v5.4s, " D ".4s, " WG ".4s")    /* v5   = D*WG */ \
+        __ASM_EMIT("fmul            v6.4s, " D ".4s, " WR ".4s")    /* v6   = D*WR */ \
+        __ASM_EMIT("fsub            v7.4s, v25.4s, v3.4s")      /* v7   = A = 255 - alpha * 255 */ \
+        __ASM_EMIT("fadd            v4.4s, v4.4s, " T1 ".4s")   /* v4   = b = T1 + D*WB */ \
+        __ASM_EMIT("fadd            v5.4s, v5.4s, " T1 ".4s")   /* v5   = g = T1 + D*WG */ \
+        __ASM_EMIT("fadd            v6.4s, v6.4s, " T1 ".4s")   /* v6   = r = T1 + D*WR */ \
+        __ASM_EMIT("fmul            v4.4s, v4.4s, v7.4s")       /* v4   = B = b * A */ \
+        __ASM_EMIT("fmul            v5.4s, v5.4s, v7.4s")       /* v5   = G = g * A */ \
+        __ASM_EMIT("fmul            v6.4s, v6.4s, v7.4s")       /* v6   = R = r * A */ \
+        __ASM_EMIT("fmin            v4.4s, v4.4s, v25.4s")      /* v4   = min(B, 255) */ \
+        __ASM_EMIT("fmin            v5.4s, v5.4s, v25.4s")      /* v5   = min(G, 255) */ \
+        __ASM_EMIT("fmin            v6.4s, v6.4s, v25.4s")      /* v6   = min(R, 255) */ \
+        __ASM_EMIT("fmin            v7.4s, v7.4s, v25.4s")      /* v7   = min(A, 255) */ \
+        __ASM_EMIT("fcvtzu          v4.4s, v4.4s")              /* v4   = int(B), negative values become 0 */ \
+        __ASM_EMIT("fcvtzu          v5.4s, v5.4s")              /* v5   = int(G) */ \
+        __ASM_EMIT("fcvtzu          v6.4s, v6.4s")              /* v6   = int(R) */ \
+        __ASM_EMIT("fcvtzu          v7.4s, v7.4s")              /* v7   = int(A) */ \
+        __ASM_EMIT("shl             v5.4s, v5.4s, #8")          /* v5   = int(G) << 8 */ \
+        __ASM_EMIT("shl             v6.4s, v6.4s, #16")         /* v6   = int(R) << 16 */ \
+        __ASM_EMIT("shl             v7.4s, v7.4s, #24")         /* v7   = int(A) << 24 */ \
+        __ASM_EMIT("orr             v4.16b, v4.16b, v5.16b") \
+        __ASM_EMIT("orr             v6.16b, v6.16b, v7.16b") \
+        __ASM_EMIT("orr             v4.16b, v4.16b, v6.16b")    /* v4   = B G R A */
+
+    #define EFF_HSLA_BGRA32_LOOP(CORE) \
+        __ASM_EMIT("subs            %[count], %[count], #4") \
+        __ASM_EMIT("b.lo            2f") \
+        /* 4x blocks */ \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("ldr             q0, [%[src]]")              /* v0   = v */ \
+        CORE \
+        __ASM_EMIT("str             q4, [%[dst]]") \
+        __ASM_EMIT("add             %[src], %[src], #0x10") \
+        __ASM_EMIT("add             %[dst], %[dst], #0x10") \
+        __ASM_EMIT("subs            %[count], %[count], #4") \
+        __ASM_EMIT("b.hs            1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("adds            %[count], %[count], #3") \
+        __ASM_EMIT("b.lt            4f") \
+        __ASM_EMIT("3:") \
+        __ASM_EMIT("ld1r            {v0.4s}, [%[src]]")         /* v0   = v */ \
+        CORE \
+        __ASM_EMIT("st1             {v4.s}[0], [%[dst]]") \
+        __ASM_EMIT("add             %[src], %[src], #0x04") \
+        __ASM_EMIT("add             %[dst], %[dst], #0x04") \
+        __ASM_EMIT("subs            %[count], %[count], #1") \
+        __ASM_EMIT("b.ge            3b") \
+        __ASM_EMIT("4:")
+
+    #define EFF_HSLA_BGRA32_WEIGHTS(WR, WG, WB) \
+        __ASM_EMIT("ld1r            {v2.4s}, [%[eff]]")         /* v2   = H */ \
+        EFF_HSLA_WEIGHTS_CORE \
+        __ASM_EMIT("mov             " WR ".16b, v0.16b")        /* WR */ \
+        __ASM_EMIT("mov             " WG ".16b, v1.16b")        /* WG */ \
+        __ASM_EMIT("mov             " WB ".16b, v2.16b")        /* WB */
+
+    #define EFF_HSLA_HUE_BGRA32_CORE \
+        /* v0   = v, v16 = EH, v17 = T, v18 = KT, v19 = T1, v20 = D */ \
+        __ASM_EMIT("fabs            v0.4s, v0.4s")              /* v0   = abs(v) */ \
+        __ASM_EMIT("fsub            v1.4s, v24.4s, v0.4s")      /* v1   = V = 1 - abs(v) */ \
+        __ASM_EMIT("fsub            v3.4s, v1.4s, v17.4s")      /* v3   = V - T */ \
+        __ASM_EMIT("fmin            v1.4s, v1.4s, v17.4s")      /* v1   = min(V, T) */ \
+        __ASM_EMIT("fmax            v3.4s, v3.4s, v29.4s")      /* v3   = max(V - T, 0) */ \
+        __ASM_EMIT("fadd            v2.4s, v1.4s, v16.4s")      /* v2   = NH = EH + min(V, T) */ \
+        __ASM_EMIT("fmul            v3.4s, v3.4s, v18.4s")      /* v3   = alpha = max(V - T, 0) * KT */ \
+        __ASM_EMIT("fcmgt           v4.4s, v2.4s, v24.4s")      /* v4   = [ NH > 1 ] */ \
+        __ASM_EMIT("and             v4.16b, v4.16b, v24.16b")   /* v4   = 1 & [ NH > 1 ] */ \
+        __ASM_EMIT("fsub            v2.4s, v2.4s, v4.4s")       /* v2   = H = NH - (1 & [ NH > 1 ]) */ \
+        EFF_HSLA_WEIGHTS_CORE \
+        EFF_HSLA_PIXEL_CORE("v19", "v20", "v0", "v1", "v2")
+
+        void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count)
+        {
+            IF_ARCH_AARCH64(
+                float p[5*4] __lsp_aligned16;
+                float x     = eff->s * ((eff->l < 0.5f) ? eff->l : 1.0f - eff->l);
+                for (size_t i=0; i<4; ++i)
+                {
+                    p[i]        = eff->h;               // EH
+                    p[i + 4]    = 1.0f - eff->thresh;   // T
+                    p[i + 8]    = 1.0f / eff->thresh;   // KT
+                    p[i + 12]   = eff->l - x;           // T1
+                    p[i + 16]   = x + x;                // D
+                }
+            );
+
+            ARCH_AARCH64_ASM
+            (
+                EFF_HSLA_BGRA32_INIT
+                __ASM_EMIT("ldp             q16, q17, [%[P], #0x00]")   /* v16  = EH, v17 = T */
+                __ASM_EMIT("ldp             q18, q19, [%[P], #0x20]")   /* v18  = KT, v19 = T1 */
+                __ASM_EMIT("ldr             q20, [%[P], #0x40]")        /* v20  = D */
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_HUE_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]),
+                  [XC] "r" (&EFF_HSLA_BGRA32_XC[0])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19", "v20",
+                  "v24", "v25", "v26", "v27",
+                  "v28", "v29"
+            );
+        }
+
+    #undef EFF_HSLA_HUE_BGRA32_CORE
+
+    #define EFF_HSLA_ALPHA_BGRA32_CORE \
+        /* v0   = v, v16 = T1, v17 = D, v18 = WR, v19 = WG, v20 = WB */ \
+        __ASM_EMIT("fabs            v0.4s, v0.4s")              /* v0   = abs(v) */ \
+        __ASM_EMIT("fsub            v3.4s, v24.4s, v0.4s")      /* v3   = alpha = 1 - abs(v) */ \
+        EFF_HSLA_PIXEL_CORE("v16", "v17", "v18", "v19", "v20")
+
+        void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count)
+        {
+            float x     = eff->s * ((eff->l < 0.5f) ? eff->l : 1.0f - eff->l);
+            float t1    = eff->l - x;
+            float d     = x + x;
+
+            ARCH_AARCH64_ASM
+            (
+                EFF_HSLA_BGRA32_INIT
+                __ASM_EMIT("dup             v16.4s, %[t1].s[0]")        /* v16  = T1 */
+                __ASM_EMIT("dup             v17.4s, %[d].s[0]")         /* v17  = D */
+                EFF_HSLA_BGRA32_WEIGHTS("v18", "v19", "v20")
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_ALPHA_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [eff] "r" (eff), [t1] "w" (t1), [d] "w" (d),
+                  [XC] "r" (&EFF_HSLA_BGRA32_XC[0])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19", "v20",
+                  "v24", "v25", "v26", "v27",
+                  "v28", "v29"
+            );
+        }
+
+    #undef EFF_HSLA_ALPHA_BGRA32_CORE
+
+    #define EFF_HSLA_SAT_BGRA32_CORE \
+        /* v0   = v, v16 = L, v17 = MS, v18 = t, v19 = KT, v20 = WR, v21 = WG, v22 = WB */ \
+        __ASM_EMIT("fabs            v0.4s, v0.4s")              /* v0   = V = abs(v) */ \
+        __ASM_EMIT("fsub            v3.4s, v18.4s, v0.4s")      /* v3   = t - V */ \
+        __ASM_EMIT("fmax            v0.4s, v0.4s, v18.4s")      /* v0   = max(V, t) */ \
+        __ASM_EMIT("fmax            v3.4s, v3.4s, v29.4s")      /* v3   = max(t - V, 0) */ \
+        __ASM_EMIT("fmul            v0.4s, v0.4s, v17.4s")      /* v0   = X = max(V, t) * MS */ \
+        __ASM_EMIT("fmul            v3.4s, v3.4s, v19.4s")      /* v3   = alpha = max(t - V, 0) * KT */ \
+        __ASM_EMIT("fadd            v1.4s, v0.4s, v0.4s")       /* v1   = D = X + X */ \
+        __ASM_EMIT("fsub            v2.4s, v16.4s, v0.4s")      /* v2   = T1 = L - X */ \
+        EFF_HSLA_PIXEL_CORE("v2", "v1", "v20", "v21", "v22")
+
+        void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count)
+        {
+            IF_ARCH_AARCH64(
+                float p[4*4] __lsp_aligned16;
+                for (size_t i=0; i<4; ++i)
+                {
+                    p[i]        = eff->l;               // L
+                    p[i + 4]    = eff->s * ((eff->l < 0.5f) ? eff->l : 1.0f - eff->l); // MS
+                    p[i + 8]    = eff->thresh;          // t
+                    p[i + 12]   = 1.0f / eff->thresh;   // KT
+                }
+            );
+
+            ARCH_AARCH64_ASM
+            (
+                EFF_HSLA_BGRA32_INIT
+                __ASM_EMIT("ldp             q16, q17, [%[P], #0x00]")   /* v16  = L, v17 = MS */
+                __ASM_EMIT("ldp             q18, q19, [%[P], #0x20]")   /* v18  = t, v19 = KT */
+                EFF_HSLA_BGRA32_WEIGHTS("v20", "v21", "v22")
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_SAT_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]), [eff] "r" (eff),
+                  [XC] "r" (&EFF_HSLA_BGRA32_XC[0])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21", "v22",
+                  "v24", "v25", "v26", "v27",
+                  "v28", "v29"
+            );
+        }
+
+    #undef EFF_HSLA_SAT_BGRA32_CORE
+
+    #define EFF_HSLA_LIGHT_BGRA32_CORE \
+        /* v0   = v, v16 = ES, v17 = EL, v18 = t, v19 = KT, v20 = WR, v21 = WG, v22 = WB */ \
+        __ASM_EMIT("fabs            v0.4s, v0.4s")              /* v0   = V = abs(v) */ \
+        __ASM_EMIT("fsub            v3.4s, v18.4s, v0.4s")      /* v3   = t - V */ \
+        __ASM_EMIT("fmax            v0.4s, v0.4s, v18.4s")      /* v0   = max(V, t) */ \
+        __ASM_EMIT("fmax            v3.4s, v3.4s, v29.4s")      /* v3   = max(t - V, 0) */ \
+        __ASM_EMIT("fmul            v2.4s, v0.4s, v17.4s")      /* v2   = L = max(V, t) * EL */ \
+        __ASM_EMIT("fmul            v3.4s, v3.4s, v19.4s")      /* v3   = alpha = max(t - V, 0) * KT */ \
+        __ASM_EMIT("fsub            v1.4s, v24.4s, v2.4s")      /* v1   = 1 - L */ \
+        __ASM_EMIT("fmin            v1.4s, v1.4s, v2.4s")       /* v1   = min(L, 1 - L) */ \
+        __ASM_EMIT("fmul            v1.4s, v1.4s, v16.4s")      /* v1   = X = ES * min(L, 1 - L) */ \
+        __ASM_EMIT("fsub            v2.4s, v2.4s, v1.4s")       /* v2   = T1 = L - X */ \
+        __ASM_EMIT("fadd            v1.4s, v1.4s, v1.4s")       /* v1   = D = X + X */ \
+        EFF_HSLA_PIXEL_CORE("v2", "v1", "v20", "v21", "v22")
+
+        void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count)
+        {
+            IF_ARCH_AARCH64(
+                float p[4*4] __lsp_aligned16;
+                for (size_t i=0; i<4; ++i)
+                {
+                    p[i]        = eff->s;               // ES
+                    p[i + 4]    = eff->l;               // EL
+                    p[i + 8]    = eff->thresh;          // t
+                    p[i + 12]   = 1.0f / eff->thresh;   // KT
+                }
+            );
+
+            ARCH_AARCH64_ASM
+            (
+                EFF_HSLA_BGRA32_INIT
+                __ASM_EMIT("ldp             q16, q17, [%[P], #0x00]")   /* v16  = ES, v17 = EL */
+                __ASM_EMIT("ldp             q18, q19, [%[P], #0x20]")   /* v18  = t, v19 = KT */
+                EFF_HSLA_BGRA32_WEIGHTS("v20", "v21", "v22")
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_LIGHT_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]), [eff] "r" (eff),
+                  [XC] "r" (&EFF_HSLA_BGRA32_XC[0])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21", "v22",
+                  "v24", "v25", "v26", "v27",
+                  "v28", "v29"
+            );
+        }
+
+    #undef EFF_HSLA_LIGHT_BGRA32_CORE
+    #undef EFF_HSLA_BGRA32_WEIGHTS
+    #undef EFF_HSLA_BGRA32_LOOP
+    #undef EFF_HSLA_PIXEL_CORE
+    #undef EFF_HSLA_WEIGHTS_CORE
+    #undef EFF_HSLA_WEIGHT
+    #undef EFF_HSLA_BGRA32_INIT
+
     } /* namespace asimd */
 } /* namespace lsp */
 
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_HMATH_HCSUM_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_HMATH_HCSUM_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        /* Kahan summation step for two accumulators:
+         *   v0, v1 = sums, v2, v3 = compensations, v4, v5 = terms
+         */
+        #define HCSUM_KAHAN_X2 \
+            __ASM_EMIT("fsub        v4.4s, v4.4s, v2.4s")           /* v4 = y = x - c */ \
+            __ASM_EMIT("fsub        v5.4s, v5.4s, v3.4s") \
+            __ASM_EMIT("fadd        v6.4s, v0.4s, v4.4s")           /* v6 = t = s + y */ \
+            __ASM_EMIT("fadd        v7.4s, v1.4s, v5.4s") \
+            __ASM_EMIT("fsub        v2.4s, v6.4s, v0.4s")           /* v2 = t - s */ \
+            __ASM_EMIT("fsub        v3.4s, v7.4s, v1.4s") \
+            __ASM_EMIT("fsub        v2.4s, v2.4s, v4.4s")           /* v2 = c = (t - s) - y */ \
+            __ASM_EMIT("fsub        v3.4s, v3.4s, v5.4s") \
+            __ASM_EMIT("mov         v0.16b, v6.16b")                /* v0 = s = t */ \
+            __ASM_EMIT("mov         v1.16b, v7.16b")
+
+        /* Kahan summation step for the first accumulator, v4 = terms */
+        #define HCSUM_KAHAN_X1 \
+            __ASM_EMIT("fsub        v4.4s, v4.4s, v2.4s")           /* v4 = y = x - c */ \
+            __ASM_EMIT("fadd        v6.4s, v0.4s, v4.4s")           /* v6 = t = s + y */ \
+            __ASM_EMIT("fsub        v2.4s, v6.4s, v0.4s")           /* v2 = t - s */ \
+            __ASM_EMIT("fsub        v2.4s, v2.4s, v4.4s")           /* v2 = c = (t - s) - y */ \
+            __ASM_EMIT("mov         v0.16b, v6.16b")                /* v0 = s = t */
+
+        /* Term loaders for 8x, 4x and 1x blocks, scalar loads zero the upper lanes,
+         * so the 1x block may reuse the vector Kahan step
+         */
+        #define HCSUM_SUM_X8 \
+            __ASM_EMIT("ldp         q4, q5, [%[src]], #0x20")
+        #define HCSUM_SUM_X4 \
+            __ASM_EMIT("ldr         q4, [%[src]], #0x10")
+        #define HCSUM_SUM_X1 \
+            __ASM_EMIT("ldr         s4, [%[src]], #0x04")
+
+        #define HCSUM_SQR_X8 \
+            HCSUM_SUM_X8 \
+            __ASM_EMIT("fmul        v4.4s, v4.4s, v4.4s") \
+            __ASM_EMIT("fmul        v5.4s, v5.4s, v5.4s")
+        #define HCSUM_SQR_X4 \
+            HCSUM_SUM_X4 \
+            __ASM_EMIT("fmul        v4.4s, v4.4s, v4.4s")
+        #define HCSUM_SQR_X1 \
+            HCSUM_SUM_X1 \
+            __ASM_EMIT("fmul        v4.4s, v4.4s, v4.4s")
+
+        #define HCSUM_ABS_X8 \
+            HCSUM_SUM_X8 \
+            __ASM_EMIT("fabs        v4.4s, v4.4s") \
+            __ASM_EMIT("fabs        v5.4s, v5.4s")
+        #define HCSUM_ABS_X4 \
+            HCSUM_SUM_X4 \
+            __ASM_EMIT("fabs        v4.4s, v4.4s")
+        #define HCSUM_ABS_X1 \
+            HCSUM_SUM_X1 \
+            __ASM_EMIT("fabs        v4.4s, v4.4s")
+
+        #define HCSUM_DOTP_X8 \
+            __ASM_EMIT("ldp         q4, q5, [%[a]], #0x20") \
+            __ASM_EMIT("ldp         q16, q17, [%[b]], #0x20") \
+            __ASM_EMIT("fmul        v4.4s, v4.4s, v16.4s") \
+            __ASM_EMIT("fmul        v5.4s, v5.4s, v17.4s")
+        #define HCSUM_DOTP_X4 \
+            __ASM_EMIT("ldr         q4, [%[a]], #0x10") \
+            __ASM_EMIT("ldr         q16, [%[b]], #0x10") \
+            __ASM_EMIT("fmul        v4.4s, v4.4s, v16.4s")
+        #define HCSUM_DOTP_X1 \
+            __ASM_EMIT("ldr         s4, [%[a]], #0x04") \
+            __ASM_EMIT("ldr         s16, [%[b]], #0x04") \
+            __ASM_EMIT("fmul        v4.4s, v4.4s, v16.4s")
+
+        #define HCSUM_CORE(OP_X8, OP_X4, OP_X1) \
+            __ASM_EMIT("eor         v0.16b, v0.16b, v0.16b") \
+            __ASM_EMIT("eor         v1.16b, v1.16b, v1.16b") \
+            __ASM_EMIT("eor         v2.16b, v2.16b, v2.16b") \
+            __ASM_EMIT("eor         v3.16b, v3.16b, v3.16b") \
+            __ASM_EMIT("subs        %[count], %[count], #8") \
+            __ASM_EMIT("b.lo        2f") \
+            /* 8x blocks */ \
+            __ASM_EMIT("1:") \
+            OP_X8 \
+            HCSUM_KAHAN_X2 \
+            __ASM_EMIT("subs        %[count], %[count], #8") \
+            __ASM_EMIT("b.hs        1b") \
+            /* 4x block */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("adds        %[count], %[count], #4") \
+            __ASM_EMIT("b.lt        4f") \
+            OP_X4 \
+            HCSUM_KAHAN_X1 \
+            __ASM_EMIT("sub         %[count], %[count], #4") \
+            /* 1x blocks */ \
+            __ASM_EMIT("4:") \
+            __ASM_EMIT("adds        %[count], %[count], #3") \
+            __ASM_EMIT("b.lt        6f") \
+            __ASM_EMIT("5:") \
+            OP_X1 \
+            HCSUM_KAHAN_X1 \
+            __ASM_EMIT("subs        %[count], %[count], #1") \
+            __ASM_EMIT("b.ge        5b") \
+            /* merge lanes */ \
+            __ASM_EMIT("6:") \
+            __ASM_EMIT("fsub        v0.4s, v0.4s, v2.4s")           /* v0 = s - c */ \
+            __ASM_EMIT("fsub        v1.4s, v1.4s, v3.4s") \
+            __ASM_EMIT("fadd        v0.4s, v0.4s, v1.4s") \
+            __ASM_EMIT("ext         v1.16b, v0.16b, v0.16b, #8")    /* v0 = a0 a1 a2 a3, v1 = a2 a3 a0 a1 */ \
+            __ASM_EMIT("fadd        v0.4s, v0.4s, v1.4s")           /* v0 = a0+a2 a1+a3 a0+a2 a1+a3 */ \
+            __ASM_EMIT("ext         v1.16b, v0.16b, v0.16b, #4")    /* v1 = a1+a3 a0+a2 a1+a3 a0+a2 */ \
+            __ASM_EMIT("fadd        %[res].4s, v0.4s, v1.4s")       /* res = a0+a1+a2+a3 */
+
+        float h_csum(const float *src, size_t count)
+        {
+            IF_ARCH_AARCH64(float res);
+            ARCH_AARCH64_ASM
+            (
+                HCSUM_CORE(HCSUM_SUM_X8, HCSUM_SUM_X4, HCSUM_SUM_X1)
+                : [res] "=w" (res),
+                  [src] "+r" (src), [count] "+r" (count)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7"
+            );
+
+            return res;
+        }
+
+        float h_sqr_csum(const float *src, size_t count)
+        {
+            IF_ARCH_AARCH64(float res);
+            ARCH_AARCH64_ASM
+            (
+                HCSUM_CORE(HCSUM_SQR_X8, HCSUM_SQR_X4, HCSUM_SQR_X1)
+                : [res] "=w" (res),
+                  [src] "+r" (src), [count] "+r" (count)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7"
+            );
+
+            return res;
+        }
+
+        float h_abs_csum(const float *src, size_t count)
+        {
+            IF_ARCH_AARCH64(float res);
+            ARCH_AARCH64_ASM
+            (
+                HCSUM_CORE(HCSUM_ABS_X8, HCSUM_ABS_X4, HCSUM_ABS_X1)
+                : [res] "=w" (res),
+                  [src] "+r" (src), [count] "+r" (count)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7"
+            );
+
+            return res;
+        }
+
+        float h_cdotp(const float *a, const float *b, size_t count)
+        {
+            IF_ARCH_AARCH64(float res);
+            ARCH_AARCH64_ASM
+            (
+                HCSUM_CORE(HCSUM_DOTP_X8, HCSUM_DOTP_X4, HCSUM_DOTP_X1)
+                : [res] "=w" (res),
+                  [a] "+r" (a), [b] "+r" (b), [count] "+r" (count)
+                :
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7",
+                  "v16", "v17"
+            );
+
+            return res;
+        }
+
+        #undef HCSUM_CORE
+        #undef HCSUM_DOTP_X1
+        #undef HCSUM_DOTP_X4
+        #undef HCSUM_DOTP_X8
+        #undef HCSUM_ABS_X1
+        #undef HCSUM_ABS_X4
+        #undef HCSUM_ABS_X8
+        #undef HCSUM_SQR_X1
+        #undef HCSUM_SQR_X4
+        #undef HCSUM_SQR_X8
+        #undef HCSUM_SUM_X1
+        #undef HCSUM_SUM_X4
+        #undef HCSUM_SUM_X8
+        #undef HCSUM_KAHAN_X1
+        #undef HCSUM_KAHAN_X2
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_HMATH_HCSUM_H_ */
@@ -0,0 +1,389 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_INTERPOLATION_DELAY_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_INTERPOLATION_DELAY_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+#define DELAY_TAPS_BLOCK        16
+
+namespace lsp
+{
+    namespace asimd
+    {
+        /**
+         * Prepare parameters for reading the delay line
+         * @param p parameters to initialize, 7 vectors
+         * @param d delay line descriptor
+         * @param count number of samples to read
+         * @param k1 multiplier of (x[k+2] - x[k-1]) for the cubic term
+         * @param k2 multiplier of (x[k] - x[k+1]) for the cubic term
+         */
+        static void delay_read_init(float *p, const dsp::delay_t *d, size_t count, float k1, float k2)
+        {
+            uint32_t *u     = reinterpret_cast<uint32_t *>(p);
+            for (size_t i=0; i<4; ++i)
+            {
+                p[i]            = i;                        // I = positions
+                p[i + 4]        = 4.0f;                     // Step for 4x block
+                u[i + 8]        = d->head - count - 1;      // S = start of the block
+                u[i + 12]       = d->mask;                  // M = mask
+                p[i + 16]       = 0.5f;
+                p[i + 20]       = k1;
+                p[i + 24]       = k2;
+            }
+        }
+
+        /*
+         * Compute positions of 4 samples, split them into integer and fractional parts
+         * and load points x[k-1] .. x[k+2] of each sample into v0, v3, v2, v5
+         */
+        #define DELAY_POINTS \
+            __ASM_EMIT("ldr             q0, [%[delay]]")                /* v0   = D */ \
+            __ASM_EMIT("fsub            v1.4s, v24.4s, v0.4s")          /* v1   = P = I - D */ \
+            __ASM_EMIT("frintm          v2.4s, v1.4s")                  /* v2   = floor(P) */ \
+            __ASM_EMIT("fsub            v1.4s, v1.4s, v2.4s")           /* v1   = F = P - floor(P) */ \
+            __ASM_EMIT("fcvtzs          v3.4s, v2.4s")                  /* v3   = T = int(floor(P)) */ \
+            __ASM_EMIT("add             v3.4s, v3.4s, v26.4s")          /* v3   = S + T */ \
+            __ASM_EMIT("and             v3.16b, v3.16b, v27.16b")       /* v3   = J = (S + T) & M */ \
+            __ASM_EMIT("shl             v3.4s, v3.4s, #2")              /* v3   = J * sizeof(float) */ \
+            __ASM_EMIT("umov            %w[t], v3.s[0]") \
+            __ASM_EMIT("ldr             q4, [%[buf], %[t]]")            /* v4   = a0 a1 a2 a3 */ \
+            __ASM_EMIT("umov            %w[t], v3.s[1]") \
+            __ASM_EMIT("ldr             q5, [%[buf], %[t]]")            /* v5   = b0 b1 b2 b3 */ \
+            __ASM_EMIT("umov            %w[t], v3.s[2]") \
+            __ASM_EMIT("ldr             q6, [%[buf], %[t]]")            /* v6   = c0 c1 c2 c3 */ \
+            __ASM_EMIT("umov            %w[t], v3.s[3]") \
+            __ASM_EMIT("ldr             q7, [%[buf], %[t]]")            /* v7   = d0 d1 d2 d3 */ \
+            /* Transpose */ \
+            __ASM_EMIT("trn1            v16.4s, v4.4s, v5.4s")          /* v16  = a0 b0 a2 b2 */ \
+            __ASM_EMIT("trn2            v17.4s, v4.4s, v5.4s")          /* v17  = a1 b1 a3 b3 */ \
+            __ASM_EMIT("trn1            v18.4s, v6.4s, v7.4s")          /* v18  = c0 d0 c2 d2 */ \
+            __ASM_EMIT("trn2            v19.4s, v6.4s, v7.4s")          /* v19  = c1 d1 c3 d3 */ \
+            __ASM_EMIT("trn1            v0.2d, v16.2d, v18.2d")         /* v0   = a0 b0 c0 d0 = x[k-1] */ \
+            __ASM_EMIT("trn1            v3.2d, v17.2d, v19.2d")         /* v3   = a1 b1 c1 d1 = x[k] */ \
+            __ASM_EMIT("trn2            v2.2d, v16.2d, v18.2d")         /* v2   = a2 b2 c2 d2 = x[k+1] */ \
+            __ASM_EMIT("trn2            v5.2d, v17.2d, v19.2d")         /* v5   = a3 b3 c3 d3 = x[k+2] */
+
+        /* v0 = x[k-1], v3 = x[k], v2 = x[k+1], v5 = x[k+2], v1 = F, result in v5 */
+        #define DELAY_LINEAR_CORE \
+            __ASM_EMIT("fsub            v5.4s, v2.4s, v3.4s")           /* v5   = x[k+1] - x[k] */ \
+            __ASM_EMIT("fmul            v5.4s, v5.4s, v1.4s")           /* v5   = (x[k+1] - x[k])*F */ \
+            __ASM_EMIT("fadd            v5.4s, v5.4s, v3.4s")           /* v5   = x[k] + (x[k+1] - x[k])*F */
+
+        #define DELAY_CUBIC_TERMS \
+            __ASM_EMIT("fsub            v4.4s, v2.4s, v0.4s")           /* v4   = x[k+1] - x[k-1] */ \
+            __ASM_EMIT("fadd            v6.4s, v2.4s, v0.4s")           /* v6   = x[k-1] + x[k+1] */ \
+            __ASM_EMIT("fsub            v5.4s, v5.4s, v0.4s")           /* v5   = x[k+2] - x[k-1] */ \
+            __ASM_EMIT("fsub            v0.4s, v3.4s, v2.4s")           /* v0   = x[k] - x[k+1] */ \
+            __ASM_EMIT("fmul            v4.4s, v4.4s, v28.4s")          /* v4   = h = 0.5*(x[k+1] - x[k-1]) */ \
+            __ASM_EMIT("fmul            v6.4s, v6.4s, v28.4s")          /* v6   = 0.5*(x[k-1] + x[k+1]) */ \
+            __ASM_EMIT("fsub            v6.4s, v6.4s, v3.4s")           /* v6   = q = 0.5*(x[k-1] + x[k+1]) - x[k] */ \
+            __ASM_EMIT("fmul            v5.4s, v5.4s, v29.4s")          /* v5   = K1*(x[k+2] - x[k-1]) */ \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v30.4s")          /* v0   = K2*(x[k] - x[k+1]) */ \
+            __ASM_EMIT("fadd            v5.4s, v5.4s, v0.4s")           /* v5   = c3 */
+
+        #define DELAY_CUBIC_POLY \
+            /* v5 = c3, v6 = c2, v4 = c1 */ \
+            __ASM_EMIT("fmul            v5.4s, v5.4s, v1.4s")           /* v5   = c3*F */ \
+            __ASM_EMIT("fadd            v5.4s, v5.4s, v6.4s")           /* v5   = c3*F + c2 */ \
+            __ASM_EMIT("fmul            v5.4s, v5.4s, v1.4s")           /* v5   = (c3*F + c2)*F */ \
+            __ASM_EMIT("fadd            v5.4s, v5.4s, v4.4s")           /* v5   = (c3*F + c2)*F + c1 */ \
+            __ASM_EMIT("fmul            v5.4s, v5.4s, v1.4s")           /* v5   = ((c3*F + c2)*F + c1)*F */ \
+            __ASM_EMIT("fadd            v5.4s, v5.4s, v3.4s")           /* v5   = ((c3*F + c2)*F + c1)*F + x[k] */
+
+        #define DELAY_HERMITE_CORE \
+            DELAY_CUBIC_TERMS \
+            __ASM_EMIT("fsub            v6.4s, v6.4s, v5.4s")           /* v6   = c2 = q - c3 */ \
+            DELAY_CUBIC_POLY
+
+        #define DELAY_LAGRANGE_CORE \
+            DELAY_CUBIC_TERMS \
+            __ASM_EMIT("fsub            v4.4s, v4.4s, v5.4s")           /* v4   = c1 = h - c3 */ \
+            DELAY_CUBIC_POLY
+
+        #define DELAY_READ_KERNEL(CORE) \
+            ARCH_AARCH64_ASM( \
+                __ASM_EMIT("ldp             q24, q25, [%[P], #0x00]")       /* v24  = I, v25 = 4 */ \
+                __ASM_EMIT("ldp             q26, q27, [%[P], #0x20]")       /* v26  = S, v27 = M */ \
+                __ASM_EMIT("ldp             q28, q29, [%[P], #0x40]")       /* v28  = 0.5, v29 = K1 */ \
+                __ASM_EMIT("ldr             q30, [%[P], #0x60]")            /* v30  = K2 */ \
+                __ASM_EMIT("subs            %[count], %[count], #4") \
+                __ASM_EMIT("b.lo            2f") \
+                __ASM_EMIT("1:") \
+                DELAY_POINTS \
+                CORE \
+                __ASM_EMIT("str             q5, [%[dst]]") \
+                __ASM_EMIT("fadd            v24.4s, v24.4s, v25.4s")        /* v24  = I + 4 */ \
+                __ASM_EMIT("subs            %[count], %[count], #4") \
+                __ASM_EMIT("add             %[delay], %[delay], #0x10") \
+                __ASM_EMIT("add             %[dst], %[dst], #0x10") \
+                __ASM_EMIT("b.hs            1b") \
+                __ASM_EMIT("2:") \
+                : [dst] "+r" (vd), [delay] "+r" (vs), [count] "+r" (n), \
+                  [t] "=&r" (t) \
+                : [P] "r" (&p[0]), [buf] "r" (buf) \
+                : "cc", "memory", \
+                  "v0", "v1", "v2", "v3", \
+                  "v4", "v5", "v6", "v7", \
+                  "v16", "v17", "v18", "v19", \
+                  "v24", "v25", "v26", "v27", \
+                  "v28", "v29", "v30" \
+            )
+
+        /*
+         * The last incomplete block is processed as the full block with delays padded
+         * by a safe value, so the kernel does not need scalar code
+         */
+        #define DELAY_READ_APPLY(CORE) \
+            float *vd           = dst; \
+            const float *vs     = delay; \
+            size_t n            = count; \
+            size_t t; \
+            DELAY_READ_KERNEL(CORE); \
+            \
+            size_t done         = count & ~size_t(3); \
+            if (done < count) \
+            { \
+                float xd[4] __lsp_aligned16; \
+                float xs[4] __lsp_aligned16; \
+                for (size_t i=0; i<4; ++i) \
+                { \
+                    p[i]                = done + i; \
+                    xs[i]               = (done + i < count) ? delay[done + i] : 2.0f; \
+                } \
+                vd                  = xd; \
+                vs                  = xs; \
+                n                   = 4; \
+                DELAY_READ_KERNEL(CORE); \
+                for (size_t i=done; i<count; ++i) \
+                    dst[i]              = xd[i - done]; \
+            }
+
+        void delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            float p[7*4] __lsp_aligned16;
+            delay_read_init(p, d, count, 0.0f, 0.0f);
+            DELAY_READ_APPLY(DELAY_LINEAR_CORE);
+        }
+
+        void delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            float p[7*4] __lsp_aligned16;
+            delay_read_init(p, d, count, 0.5f, 1.5f);
+            DELAY_READ_APPLY(DELAY_HERMITE_CORE);
+        }
+
+        void delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            float p[7*4] __lsp_aligned16;
+            delay_read_init(p, d, count, 1.0f/6.0f, 0.5f);
+            DELAY_READ_APPLY(DELAY_LAGRANGE_CORE);
+        }
+
+        #undef DELAY_READ_APPLY
+        #undef DELAY_READ_KERNEL
+        #undef DELAY_LAGRANGE_CORE
+        #undef DELAY_HERMITE_CORE
+        #undef DELAY_CUBIC_POLY
+        #undef DELAY_CUBIC_TERMS
+        #undef DELAY_LINEAR_CORE
+        #undef DELAY_POINTS
+
+        /**
+         * Compute weights of the 4 points x[k-1] .. x[k+2] of the tap
+         * @param w weights of points, 4 vectors
+         * @param tap tap descriptor
+         * @return offset of the x[k-1] point relative to the sample being read
+         */
+        static int32_t delay_tap_weights(float *w, const dsp::delay_tap_t *tap)
+        {
+            float v[4];
+            float p             = -tap->delay;
+            float t             = floorf(p);
+            float f             = p - t;
+            float g             = tap->gain;
+
+            switch (tap->interp)
+            {
+                case dsp::DELAY_HERMITE:
+                {
+                    float f2            = f * f;
+                    float f3            = f2 * f;
+                    v[0]                = (-0.5f*f3 + f2 - 0.5f*f) * g;
+                    v[1]                = (1.5f*f3 - 2.5f*f2 + 1.0f) * g;
+                    v[2]                = (-1.5f*f3 + 2.0f*f2 + 0.5f*f) * g;
+                    v[3]                = (0.5f*f3 - 0.5f*f2) * g;
+                    break;
+                }
+                case dsp::DELAY_LAGRANGE:
+                {
+                    float fp            = f + 1.0f;
+                    float fm            = f - 1.0f;
+                    float fm2           = f - 2.0f;
+                    v[0]                = (-f * fm * fm2 * (1.0f/6.0f)) * g;
+                    v[1]                = (fp * fm * fm2 * 0.5f) * g;
+                    v[2]                = (-fp * f * fm2 * 0.5f) * g;
+                    v[3]                = (fp * f * fm * (1.0f/6.0f)) * g;
+                    break;
+                }
+                default:
+                    v[0]                = 0.0f;
+                    v[1]                = (1.0f - f) * g;
+                    v[2]                = f * g;
+                    v[3]                = 0.0f;
+                    break;
+            }
+
+            for (size_t i=0; i<4; ++i)
+            {
+                w[i]                = v[0];
+                w[i + 4]            = v[1];
+                w[i + 8]            = v[2];
+                w[i + 12]           = v[3];
+            }
+
+            return int32_t(t) - 1;
+        }
+
+        /* R is the register prefix: "q" for 4x blocks, "s" for 1x blocks */
+        #define DELAY_TAP_SUM(R) \
+            __ASM_EMIT("ldr             %w[idx], [%[J], %[k], lsl #2]") /* idx  = J[k] */ \
+            __ASM_EMIT("add             %w[idx], %w[idx], %w[i]")       /* idx  = J[k] + i */ \
+            __ASM_EMIT("and             %w[idx], %w[idx], %w[mask]")    /* idx  = (J[k] + i) & M */ \
+            __ASM_EMIT("add             %[idx], %[buf], %[idx], lsl #2") \
+            __ASM_EMIT("ldr             " R "1, [%[idx]]")              /* v1   = x[k-1] */ \
+            __ASM_EMIT("ldur            " R "2, [%[idx], #0x04]")       /* v2   = x[k] */ \
+            __ASM_EMIT("ldur            " R "3, [%[idx], #0x08]")       /* v3   = x[k+1] */ \
+            __ASM_EMIT("ldur            " R "4, [%[idx], #0x0c]")       /* v4   = x[k+2] */ \
+            __ASM_EMIT("ldp             q16, q17, [%[w], #0x00]")       /* v16  = w0, v17 = w1 */ \
+            __ASM_EMIT("ldp             q18, q19, [%[w], #0x20]")       /* v18  = w2, v19 = w3 */ \
+            __ASM_EMIT("fmul            v1.4s, v1.4s, v16.4s")          /* v1   = w0*x[k-1] */ \
+            __ASM_EMIT("fmul            v2.4s, v2.4s, v17.4s")          /* v2   = w1*x[k] */ \
+            __ASM_EMIT("fmul            v3.4s, v3.4s, v18.4s")          /* v3   = w2*x[k+1] */ \
+            __ASM_EMIT("fmul            v4.4s, v4.4s, v19.4s")          /* v4   = w3*x[k+2] */ \
+            __ASM_EMIT("fadd            v1.4s, v1.4s, v2.4s") \
+            __ASM_EMIT("fadd            v1.4s, v1.4s, v3.4s") \
+            __ASM_EMIT("fadd            v1.4s, v1.4s, v4.4s") \
+            __ASM_EMIT("fadd            v0.4s, v0.4s, v1.4s")           /* v0   = S + sum(w*x) */ \
+            __ASM_EMIT("add             %[w], %[w], #0x40") \
+            __ASM_EMIT("add             %[k], %[k], #1") \
+            __ASM_EMIT("cmp             %[k], %[nt]")
+
+        #define DELAY_TAPS_ZERO(R) \
+            __ASM_EMIT("eor             v0.16b, v0.16b, v0.16b")
+
+        #define DELAY_TAPS_LOAD(R) \
+            __ASM_EMIT("ldr             " R "0, [%[dst]]")
+
+        #define DELAY_TAPS_KERNEL(INIT) \
+            ARCH_AARCH64_ASM( \
+                __ASM_EMIT("mov             %[i], #0") \
+                __ASM_EMIT("subs            %[count], %[count], #4") \
+                __ASM_EMIT("b.lo            3f") \
+                /* 4x blocks */ \
+                __ASM_EMIT("1:") \
+                INIT("q") \
+                __ASM_EMIT("mov             %[k], #0") \
+                __ASM_EMIT("mov             %[w], %[W]") \
+                __ASM_EMIT("2:") \
+                DELAY_TAP_SUM("q") \
+                __ASM_EMIT("b.lo            2b") \
+                __ASM_EMIT("str             q0, [%[dst]]") \
+                __ASM_EMIT("add             %[dst], %[dst], #0x10") \
+                __ASM_EMIT("add             %[i], %[i], #4") \
+                __ASM_EMIT("subs            %[count], %[count], #4") \
+                __ASM_EMIT("b.hs            1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("3:") \
+                __ASM_EMIT("adds            %[count], %[count], #3") \
+                __ASM_EMIT("b.lt            6f") \
+                __ASM_EMIT("4:") \
+                INIT("s") \
+                __ASM_EMIT("mov             %[k], #0") \
+                __ASM_EMIT("mov             %[w], %[W]") \
+                __ASM_EMIT("5:") \
+                DELAY_TAP_SUM("s") \
+                __ASM_EMIT("b.lo            5b") \
+                __ASM_EMIT("str             s0, [%[dst]]") \
+                __ASM_EMIT("add             %[dst], %[dst], #0x04") \
+                __ASM_EMIT("add             %[i], %[i], #1") \
+                __ASM_EMIT("subs            %[count], %[count], #1") \
+                __ASM_EMIT("b.ge            4b") \
+                __ASM_EMIT("6:") \
+                : [dst] "+r" (vd), [count] "+r" (n), \
+                  [i] "=&r" (i), [k] "=&r" (k), [w] "=&r" (pw), [idx] "=&r" (idx) \
+                : [buf] "r" (buf), [W] "r" (&w[0]), [J] "r" (&j[0]), \
+                  [mask] "r" (mask), [nt] "r" (nt) \
+                : "cc", "memory", \
+                  "v0", "v1", "v2", "v3", \
+                  "v4", \
+                  "v16", "v17", "v18", "v19" \
+            )
+
+        void delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count)
+        {
+            float w[DELAY_TAPS_BLOCK*16] __lsp_aligned16;
+            uint32_t j[DELAY_TAPS_BLOCK];
+            const uint32_t mask     = d->mask;
+            const uint32_t start    = d->head - count;
+
+            if (ntaps == 0)
+            {
+                dsp::fill_zero(dst, count);
+                return;
+            }
+
+            for (size_t off=0; off < ntaps; off += DELAY_TAPS_BLOCK)
+            {
+                // Prepare the block of taps
+                size_t nt               = ntaps - off;
+                if (nt > DELAY_TAPS_BLOCK)
+                    nt                      = DELAY_TAPS_BLOCK;
+                for (size_t k=0; k<nt; ++k)
+                    j[k]                    = start + delay_tap_weights(&w[k*16], &taps[off + k]);
+
+                // Process all samples with the block of taps
+                float *vd               = dst;
+                size_t n                = count;
+                size_t i, k, idx;
+                float *pw;
+                if (off == 0)
+                    DELAY_TAPS_KERNEL(DELAY_TAPS_ZERO);
+                else
+                    DELAY_TAPS_KERNEL(DELAY_TAPS_LOAD);
+            }
+        }
+
+        #undef DELAY_TAPS_KERNEL
+        #undef DELAY_TAPS_LOAD
+        #undef DELAY_TAPS_ZERO
+        #undef DELAY_TAP_SUM
+
+    } /* namespace asimd */
+} /* namespace lsp */
+
+#undef DELAY_TAPS_BLOCK
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_INTERPOLATION_DELAY_H_ */
@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_INTERPOLATION_RAMP_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_INTERPOLATION_RAMP_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+#include <private/dsp/arch/aarch64/asimd/pmath/exp.h>
+
+namespace lsp
+{
+    namespace asimd
+    {
+        /**
+         * Prepare parameters for the next portion of the ramp and advance the ramp
+         * @param p parameters to initialize, 8 vectors
+         * @param shape pointer to store effective shape of the ramp
+         * @param r ramp descriptor
+         * @param count number of samples requested
+         * @return number of samples that belong to the ramp, the rest should be processed with the stop value
+         */
+        static size_t ramp_init(float *p, size_t *shape, dsp::ramp_t *r, size_t count)
+        {
+            *shape          = r->shape;
+            if (r->offset >= r->length)
+                return 0;
+            size_t n        = r->length - r->offset;
+            if (n > count)
+                n               = count;
+
+            float b         = 0.0f;
+            if ((r->shape == dsp::RAMP_EXP) || (r->shape == dsp::RAMP_LOG))
+            {
+                if (r->start * r->stop > 0.0f)
+                    b               = logf(r->stop / r->start) * M_LOG2E;
+                else
+                    *shape          = (r->shape == dsp::RAMP_EXP) ? dsp::RAMP_LINEAR : dsp::RAMP_CUBIC;
+            }
+            if ((*shape != dsp::RAMP_EXP) && (*shape != dsp::RAMP_LOG))
+                b               = r->stop - r->start;
+
+            float k         = 1.0f / r->length;
+            for (size_t i=0; i<4; ++i)
+            {
+                p[i]            = r->offset + i;    // P = positions
+                p[i + 4]        = k;                // K = 1/length
+                p[i + 8]        = r->start;         // A = start
+                p[i + 12]       = b;                // B = stop - start or log2(stop/start)
+                p[i + 16]       = 4.0f;             // Step for 4x block
+                p[i + 20]       = 1.0f;             // Step for 1x block
+                p[i + 24]       = 3.0f;
+                p[i + 28]       = 2.0f;
+            }
+
+            r->offset      += n;
+            return n;
+        }
+
+        #define RAMP_X \
+            __ASM_EMIT("fmul            v0.4s, v12.4s, v26.4s")         /* v0   = x = P * K */
+
+        #define RAMP_SMOOTH \
+            __ASM_EMIT("fmul            v1.4s, v0.4s, v13.4s")          /* v1   = 2*x */ \
+            __ASM_EMIT("fsub            v1.4s, v31.4s, v1.4s")          /* v1   = 3 - 2*x */ \
+            __ASM_EMIT("fmul            v1.4s, v1.4s, v0.4s")           /* v1   = x*(3 - 2*x) */ \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v1.4s")           /* v0   = x^2*(3 - 2*x) */
+
+        #define RAMP_AFFINE \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v28.4s")          /* v0   = B*x */ \
+            __ASM_EMIT("fadd            v0.4s, v0.4s, v27.4s")          /* v0   = A + B*x */
+
+        #define RAMP_POWER \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v28.4s")          /* v0   = B*x */ \
+            POW2_CORE_X4("v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23", "v24", "v25") \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v27.4s")          /* v0   = A * 2^(B*x) */
+
+        #define RAMP_LINEAR_CORE        RAMP_X RAMP_AFFINE
+        #define RAMP_CUBIC_CORE         RAMP_X RAMP_SMOOTH RAMP_AFFINE
+        #define RAMP_EXP_CORE           RAMP_X RAMP_POWER
+        #define RAMP_LOG_CORE           RAMP_X RAMP_SMOOTH RAMP_POWER
+
+        #define RAMP_SET_OP(R) \
+            __ASM_EMIT("str             " R "0, [%[dst]]")
+
+        #define RAMP_MUL_OP(R) \
+            __ASM_EMIT("ldr             " R "1, [%[src]]") \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v1.4s") \
+            __ASM_EMIT("str             " R "0, [%[dst]]")
+
+        #define RAMP_FMADD_OP(R) \
+            __ASM_EMIT("ldr             " R "1, [%[src]]") \
+            __ASM_EMIT("ldr             " R "3, [%[dst]]") \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v1.4s") \
+            __ASM_EMIT("fadd            v0.4s, v0.4s, v3.4s") \
+            __ASM_EMIT("str             " R "0, [%[dst]]")
+
+        #define RAMP_KERNEL(CORE, OP) \
+            ARCH_AARCH64_ASM( \
+                __ASM_EMIT("ldp             q16, q17, [%[E2C], #0x00]")     /* v16  = ME, v17 = L2 */ \
+                __ASM_EMIT("ldp             q18, q19, [%[E2C], #0x20]")     /* v18  = C5, v19 = C4 */ \
+                __ASM_EMIT("ldp             q20, q21, [%[E2C], #0x40]")     /* v20  = C3, v21 = C2 */ \
+                __ASM_EMIT("ldp             q22, q23, [%[E2C], #0x60]")     /* v22  = C1, v23 = C0 */ \
+                __ASM_EMIT("ldp             q24, q25, [%[E2C], #0x80]")     /* v24  = C6, v25 = C7 */ \
+                __ASM_EMIT("ldp             q12, q26, [%[P], #0x00]")       /* v12  = P, v26 = K */ \
+                __ASM_EMIT("ldp             q27, q28, [%[P], #0x20]")       /* v27  = A, v28 = B */ \
+                __ASM_EMIT("ldp             q29, q30, [%[P], #0x40]")       /* v29  = 4, v30 = 1 */ \
+                __ASM_EMIT("ldp             q31, q13, [%[P], #0x60]")       /* v31  = 3, v13 = 2 */ \
+                __ASM_EMIT("subs            %[count], %[count], #4") \
+                __ASM_EMIT("b.lo            2f") \
+                /* 4x blocks */ \
+                __ASM_EMIT("1:") \
+                CORE \
+                OP("q") \
+                __ASM_EMIT("fadd            v12.4s, v12.4s, v29.4s")        /* v12  = P + 4 */ \
+                __ASM_EMIT("subs            %[count], %[count], #4") \
+                __ASM_EMIT("add             %[src], %[src], #0x10") \
+                __ASM_EMIT("add             %[dst], %[dst], #0x10") \
+                __ASM_EMIT("b.hs            1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("adds            %[count], %[count], #3") \
+                __ASM_EMIT("b.lt            4f") \
+                __ASM_EMIT("3:") \
+                CORE \
+                OP("s") \
+                __ASM_EMIT("fadd            v12.4s, v12.4s, v30.4s")        /* v12  = P + 1 */ \
+                __ASM_EMIT("subs            %[count], %[count], #1") \
+                __ASM_EMIT("add             %[src], %[src], #0x04") \
+                __ASM_EMIT("add             %[dst], %[dst], #0x04") \
+                __ASM_EMIT("b.ge            3b") \
+                __ASM_EMIT("4:") \
+                : [dst] "+r" (d), [src] "+r" (s), [count] "+r" (n) \
+                : [P] "r" (&p[0]), \
+                  [E2C] "r" (&EXP2_CONST[0]) \
+                : "cc", "memory", \
+                  "v0", "v1", "v2", "v3", \
+                  "v4", "v6", "v8", "v10", \
+                  "v12", "v13", \
+                  "v16", "v17", "v18", "v19", \
+                  "v20", "v21", "v22", "v23", \
+                  "v24", "v25", "v26", "v27", \
+                  "v28", "v29", "v30", "v31" \
+            )
+
+        #define RAMP_APPLY(OP) \
+            switch (shape) \
+            { \
+                case dsp::RAMP_CUBIC:   RAMP_KERNEL(RAMP_CUBIC_CORE, OP); break; \
+                case dsp::RAMP_EXP:     RAMP_KERNEL(RAMP_EXP_CORE, OP); break; \
+                case dsp::RAMP_LOG:     RAMP_KERNEL(RAMP_LOG_CORE, OP); break; \
+                default:                RAMP_KERNEL(RAMP_LINEAR_CORE, OP); break; \
+            }
+
+        void ramp_set(float *dst, dsp::ramp_t *r, size_t count)
+        {
+            float p[8*4] __lsp_aligned16;
+            size_t shape;
+            size_t n        = ramp_init(p, &shape, r, count);
+            float *d        = dst;
+            const float *s  = dst;
+            size_t done     = n;
+
+            if (n > 0)
+                RAMP_APPLY(RAMP_SET_OP);
+            if (done < count)
+                dsp::fill(&dst[done], r->stop, count - done);
+        }
+
+        void ramp_mul2(float *dst, dsp::ramp_t *r, size_t count)
+        {
+            float p[8*4] __lsp_aligned16;
+            size_t shape;
+            size_t n        = ramp_init(p, &shape, r, count);
+            float *d        = dst;
+            const float *s  = dst;
+            size_t done     = n;
+
+            if (n > 0)
+                RAMP_APPLY(RAMP_MUL_OP);
+            if (done < count)
+                dsp::mul_k2(&dst[done], r->stop, count - done);
+        }
+
+        void ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count)
+        {
+            float p[8*4] __lsp_aligned16;
+            size_t shape;
+            size_t n        = ramp_init(p, &shape, r, count);
+            float *d        = dst;
+            const float *s  = src;
+            size_t done     = n;
+
+            if (n > 0)
+                RAMP_APPLY(RAMP_MUL_OP);
+            if (done < count)
+                dsp::mul_k3(&dst[done], &src[done], r->stop, count - done);
+        }
+
+        void ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count)
+        {
+            float p[8*4] __lsp_aligned16;
+            size_t shape;
+            size_t n        = ramp_init(p, &shape, r, count);
+            float *d        = dst;
+            const float *s  = src;
+            size_t done     = n;
+
+            if (n > 0)
+                RAMP_APPLY(RAMP_FMADD_OP);
+            if (done < count)
+                dsp::fmadd_k3(&dst[done], &src[done], r->stop, count - done);
+        }
+
+        #undef RAMP_APPLY
+        #undef RAMP_KERNEL
+        #undef RAMP_FMADD_OP
+        #undef RAMP_MUL_OP
+        #undef RAMP_SET_OP
+        #undef RAMP_LOG_CORE
+        #undef RAMP_EXP_CORE
+        #undef RAMP_CUBIC_CORE
+        #undef RAMP_LINEAR_CORE
+        #undef RAMP_POWER
+        #undef RAMP_AFFINE
+        #undef RAMP_SMOOTH
+        #undef RAMP_X
+
+        void smooth_cubic_linear(float *dst, float start, float stop, size_t count)
+        {
+            dsp::ramp_t r;
+            r.start     = start;
+            r.stop      = stop;
+            r.shape     = dsp::RAMP_CUBIC;
+            r.length    = count + 1;
+            r.offset    = 0;
+
+            ramp_set(dst, &r, count);
+        }
+
+        void smooth_cubic_log(float *dst, float start, float stop, size_t count)
+        {
+            dsp::ramp_t r;
+            r.start     = start;
+            r.stop      = stop;
+            r.shape     = dsp::RAMP_LOG;
+            r.length    = count + 1;
+            r.offset    = 0;
+
+            ramp_set(dst, &r, count);
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_INTERPOLATION_RAMP_H_ */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IR_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_IR_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length)
+        {
+            const ssize_t hw    = LSP_DSP_IR_POINTS / 2;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                const dsp::ir_tap_t *t  = &taps[i];
+
+                // Skip taps that do not touch the buffer
+                float p         = t->position;
+                if (!((p > float(-hw)) && (p < float(length + hw - 1))))
+                    continue;
+
+                // Compute the table row and the interpolation factor
+                ssize_t k       = floorf(p);
+                float u         = (p - k) * LSP_DSP_IR_PHASES;
+                ssize_t ph      = u;
+                if (ph >= LSP_DSP_IR_PHASES)
+                    ph              = LSP_DSP_IR_PHASES - 1;
+                float f         = u - ph;
+                const float *c  = &kernel[ph * LSP_DSP_IR_POINTS * 2];
+                ssize_t first   = k - (hw - 1);
+                float *d        = &dst[first];
+
+                if ((first >= 0) && (first + LSP_DSP_IR_POINTS <= ssize_t(length)))
+                {
+                    // The kernel is completely inside the buffer
+                    float s[2]      = { t->gain, t->gain * f };
+
+                    ARCH_AARCH64_ASM
+                    (
+                        __ASM_EMIT("ld2r        {v0.4s, v1.4s}, [%[s]]")            // v0   = g, v1 = g*f
+                        __ASM_EMIT("ldp         q16, q17, [%[c], #0x00]")           // v16  = t0..t3, v17 = t4..t7
+                        __ASM_EMIT("ldp         q18, q19, [%[c], #0x20]")           // v18  = d0..d3, v19 = d4..d7
+                        __ASM_EMIT("ldp         q20, q21, [%[d]]")                  // v20  = x0..x3, v21 = x4..x7
+                        __ASM_EMIT("fmul        v16.4s, v16.4s, v0.4s")             // v16  = g*t
+                        __ASM_EMIT("fmul        v17.4s, v17.4s, v0.4s")
+                        __ASM_EMIT("fmla        v16.4s, v18.4s, v1.4s")             // v16  = g*(t + f*d)
+                        __ASM_EMIT("fmla        v17.4s, v19.4s, v1.4s")
+                        __ASM_EMIT("fadd        v20.4s, v20.4s, v16.4s")            // v20  = x + g*(t + f*d)
+                        __ASM_EMIT("fadd        v21.4s, v21.4s, v17.4s")
+                        __ASM_EMIT("stp         q20, q21, [%[d]]")
+                        :
+                        : [c] "r" (c), [d] "r" (d), [s] "r" (&s[0])
+                        : "memory",
+                          "v0", "v1",
+                          "v16", "v17", "v18", "v19", "v20", "v21"
+                    );
+                }
+                else
+                {
+                    // Clip the kernel at the edges of the buffer
+                    size_t j        = (first < 0) ? -first : 0;
+                    size_t last     = (first + LSP_DSP_IR_POINTS > ssize_t(length)) ? length - first : LSP_DSP_IR_POINTS;
+                    for (; j < last; ++j)
+                        d[j]           += t->gain * (c[j] + c[j + LSP_DSP_IR_POINTS] * f);
+                }
+            }
+        }
+    } /* namespace asimd */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IR_H_ */
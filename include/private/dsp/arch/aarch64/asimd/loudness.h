@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_LOUDNESS_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_LOUDNESS_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+/*
+    K-weighting filters of 4 channels are computed in parallel lanes. Each 4x4
+    block of samples is transposed so that every register holds one time step
+    of all channels, the output of the filter is squared and accumulated, so
+    there is no need to transpose the block back.
+
+    Register allocation:
+      v0-v3         = samples of 4 time steps
+      v4-v7         = temporaries for the transpose
+      v8-v9         = memory of the high-shelf stage
+      v10-v11       = memory of the high-pass stage
+      v12           = sums of squares
+      v13-v14       = temporaries
+      v16-v20       = coefficients of the high-shelf stage
+      v21-v25       = coefficients of the high-pass stage
+ */
+
+// Transpose 4x4 matrix in v0-v3 using v4-v7 as temporaries
+#define LDN_TRANSPOSE \
+    __ASM_EMIT("trn1            v4.4s, v0.4s, v1.4s")           /* v4   = a0 b0 a2 b2 */ \
+    __ASM_EMIT("trn2            v5.4s, v0.4s, v1.4s")           /* v5   = a1 b1 a3 b3 */ \
+    __ASM_EMIT("trn1            v6.4s, v2.4s, v3.4s")           /* v6   = c0 d0 c2 d2 */ \
+    __ASM_EMIT("trn2            v7.4s, v2.4s, v3.4s")           /* v7   = c1 d1 c3 d3 */ \
+    __ASM_EMIT("trn1            v0.2d, v4.2d, v6.2d")           /* v0   = a0 b0 c0 d0 */ \
+    __ASM_EMIT("trn1            v1.2d, v5.2d, v7.2d")           /* v1   = a1 b1 c1 d1 */ \
+    __ASM_EMIT("trn2            v2.2d, v4.2d, v6.2d")           /* v2   = a2 b2 c2 d2 */ \
+    __ASM_EMIT("trn2            v3.2d, v5.2d, v7.2d")           /* v3   = a3 b3 c3 d3 */
+
+// One biquad stage: x = input/output, d0, d1 = filter memory, b0..a2 = coefficients
+#define LDN_BIQUAD(x, d0, d1, b0, b1, b2, a1, a2) \
+    __ASM_EMIT("fmul            v13.4s, " x ".4s, " b1 ".4s")   /* v13  = b1*x */ \
+    __ASM_EMIT("fmul            v14.4s, " x ".4s, " b2 ".4s")   /* v14  = b2*x */ \
+    __ASM_EMIT("fmul            " x ".4s, " x ".4s, " b0 ".4s") /* x    = b0*x */ \
+    __ASM_EMIT("fadd            " x ".4s, " x ".4s, " d0 ".4s") /* x    = y = b0*x + d0 */ \
+    __ASM_EMIT("fmul            " d0 ".4s, " x ".4s, " a1 ".4s") /* d0   = a1*y */ \
+    __ASM_EMIT("fadd            " d0 ".4s, " d0 ".4s, v13.4s")  /* d0   = b1*x + a1*y */ \
+    __ASM_EMIT("fadd            " d0 ".4s, " d0 ".4s, " d1 ".4s") /* d0'  = b1*x + a1*y + d1 */ \
+    __ASM_EMIT("fmul            " d1 ".4s, " x ".4s, " a2 ".4s") /* d1   = a2*y */ \
+    __ASM_EMIT("fadd            " d1 ".4s, " d1 ".4s, v14.4s")  /* d1'  = b2*x + a2*y */
+
+// Filter one time step of 4 channels in register x and accumulate the square
+#define LDN_STEP(x) \
+    LDN_BIQUAD(x, "v8", "v9", "v16", "v17", "v18", "v19", "v20") \
+    LDN_BIQUAD(x, "v10", "v11", "v21", "v22", "v23", "v24", "v25") \
+    __ASM_EMIT("fmla            v12.4s, " x ".4s, " x ".4s")    /* v12  = ms + y*y */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        void loudness_accumulate(dsp::loudness_t *l, const float **src, size_t count)
+        {
+            float p[10*4] __lsp_aligned16;
+            const float *s[4];
+
+            for (size_t i=0; i<10; ++i)
+                for (size_t j=0; j<4; ++j)
+                    p[i*4 + j]      = l->kw[i];
+
+            // Process groups of 4 channels, missing channels of the group are substituted by
+            // the first channel of the group, the results are stored to the unused entries
+            for (size_t i=0; i<l->channels; i += 4)
+            {
+                for (size_t j=0; j<4; ++j)
+                    s[j]            = (i + j < l->channels) ? src[i + j] : src[i];
+                size_t k        = count;
+
+                ARCH_AARCH64_ASM(
+                    __ASM_EMIT("ldp             q16, q17, [%[P], #0x00]")
+                    __ASM_EMIT("ldp             q18, q19, [%[P], #0x20]")
+                    __ASM_EMIT("ldp             q20, q21, [%[P], #0x40]")
+                    __ASM_EMIT("ldp             q22, q23, [%[P], #0x60]")
+                    __ASM_EMIT("ldp             q24, q25, [%[P], #0x80]")
+                    __ASM_EMIT("ldr             q8, [%[D], #0x00]")             /* v8   = d0 */
+                    __ASM_EMIT("ldr             q9, [%[D], #0x20]")             /* v9   = d1 */
+                    __ASM_EMIT("ldr             q10, [%[D], #0x40]")            /* v10  = e0 */
+                    __ASM_EMIT("ldr             q11, [%[D], #0x60]")            /* v11  = e1 */
+                    __ASM_EMIT("ldr             q12, [%[M]]")                   /* v12  = ms */
+                    __ASM_EMIT("subs            %[count], %[count], #4")
+                    __ASM_EMIT("b.lo            2f")
+                    // 4x blocks
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("ldr             q0, [%[s0]], #0x10")
+                    __ASM_EMIT("ldr             q1, [%[s1]], #0x10")
+                    __ASM_EMIT("ldr             q2, [%[s2]], #0x10")
+                    __ASM_EMIT("ldr             q3, [%[s3]], #0x10")
+                    LDN_TRANSPOSE
+                    LDN_STEP("v0")
+                    LDN_STEP("v1")
+                    LDN_STEP("v2")
+                    LDN_STEP("v3")
+                    __ASM_EMIT("subs            %[count], %[count], #4")
+                    __ASM_EMIT("b.hs            1b")
+                    // 1x blocks
+                    __ASM_EMIT("2:")
+                    __ASM_EMIT("adds            %[count], %[count], #3")
+                    __ASM_EMIT("b.lt            4f")
+                    __ASM_EMIT("3:")
+                    __ASM_EMIT("ld1             {v0.s}[0], [%[s0]], #0x04")     /* v0   = a ? ? ? */
+                    __ASM_EMIT("ld1             {v0.s}[1], [%[s1]], #0x04")     /* v0   = a b ? ? */
+                    __ASM_EMIT("ld1             {v0.s}[2], [%[s2]], #0x04")     /* v0   = a b c ? */
+                    __ASM_EMIT("ld1             {v0.s}[3], [%[s3]], #0x04")     /* v0   = a b c d */
+                    LDN_STEP("v0")
+                    __ASM_EMIT("subs            %[count], %[count], #1")
+                    __ASM_EMIT("b.ge            3b")
+                    // Store the state
+                    __ASM_EMIT("4:")
+                    __ASM_EMIT("str             q8, [%[D], #0x00]")
+                    __ASM_EMIT("str             q9, [%[D], #0x20]")
+                    __ASM_EMIT("str             q10, [%[D], #0x40]")
+                    __ASM_EMIT("str             q11, [%[D], #0x60]")
+                    __ASM_EMIT("str             q12, [%[M]]")
+                    : [count] "+r" (k),
+                      [s0] "+r" (s[0]), [s1] "+r" (s[1]), [s2] "+r" (s[2]), [s3] "+r" (s[3])
+                    : [D] "r" (&l->d[i]), [M] "r" (&l->ms[i]),
+                      [P] "r" (&p[0])
+                    : "cc", "memory",
+                      "v0", "v1", "v2", "v3",
+                      "v4", "v5", "v6", "v7",
+                      "v8", "v9", "v10", "v11",
+                      "v12", "v13", "v14",
+                      "v16", "v17", "v18", "v19",
+                      "v20", "v21", "v22", "v23",
+                      "v24", "v25"
+                );
+            }
+        }
+    }
+}
+
+#undef LDN_STEP
+#undef LDN_BIQUAD
+#undef LDN_TRANSPOSE
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_LOUDNESS_H_ */
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_NOISE_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_NOISE_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        /**
+         * Prepare parameters of the noise generator
+         * @param p parameters to initialize, 3 vectors
+         * @param K multiplier of the sum of values
+         * @param B bias of the result
+         */
+        static inline void noise_init_params(float *p, float K, float B)
+        {
+            for (size_t i=0; i<4; ++i)
+            {
+                p[i]            = 1.0f;                     // Exponent bits of the values in the range [1, 2)
+                p[i + 4]        = K;
+                p[i + 8]        = B;
+            }
+        }
+
+        /*
+         * Eight lanes of the state row are kept in a pair of registers, rows of the ring
+         * are v0-v1, v2-v3, v4-v5, v6-v7 in order of age. The step replaces the oldest
+         * row X with the new one, so the roles of registers rotate each step and return
+         * back after four steps.
+         */
+        #define NOISE_R0        "v0", "v1"
+        #define NOISE_R1        "v2", "v3"
+        #define NOISE_R2        "v4", "v5"
+        #define NOISE_R3        "v6", "v7"
+
+        #define NOISE_STEP(X, W)    NOISE_STEP_X(X, W)
+        #define NOISE_STEP_X(X0, X1, W0, W1) \
+            __ASM_EMIT("shl             v16.4s, " X0 ".4s, #11") \
+            __ASM_EMIT("shl             v17.4s, " X1 ".4s, #11") \
+            __ASM_EMIT("eor             " X0 ".16b, " X0 ".16b, v16.16b")   /* x = t = x ^ (x << 11) */ \
+            __ASM_EMIT("eor             " X1 ".16b, " X1 ".16b, v17.16b") \
+            __ASM_EMIT("ushr            v16.4s, " X0 ".4s, #8") \
+            __ASM_EMIT("ushr            v17.4s, " X1 ".4s, #8") \
+            __ASM_EMIT("eor             " X0 ".16b, " X0 ".16b, v16.16b")   /* x = t ^ (t >> 8) */ \
+            __ASM_EMIT("eor             " X1 ".16b, " X1 ".16b, v17.16b") \
+            __ASM_EMIT("ushr            v16.4s, " W0 ".4s, #19") \
+            __ASM_EMIT("ushr            v17.4s, " W1 ".4s, #19") \
+            __ASM_EMIT("eor             " X0 ".16b, " X0 ".16b, " W0 ".16b") \
+            __ASM_EMIT("eor             " X1 ".16b, " X1 ".16b, " W1 ".16b") \
+            __ASM_EMIT("eor             " X0 ".16b, " X0 ".16b, v16.16b")   /* x = w ^ (w >> 19) ^ t ^ (t >> 8) */ \
+            __ASM_EMIT("eor             " X1 ".16b, " X1 ".16b, v17.16b")
+
+        #define NOISE_FIRST(X)      NOISE_FIRST_X(X)
+        #define NOISE_FIRST_X(X0, X1) \
+            __ASM_EMIT("ushr            v18.4s, " X0 ".4s, #9") \
+            __ASM_EMIT("ushr            v19.4s, " X1 ".4s, #9") \
+            __ASM_EMIT("orr             v18.16b, v18.16b, v20.16b")         /* v18 = S = u */ \
+            __ASM_EMIT("orr             v19.16b, v19.16b, v20.16b")
+
+        #define NOISE_NEXT(X)       NOISE_NEXT_X(X)
+        #define NOISE_NEXT_X(X0, X1) \
+            __ASM_EMIT("ushr            v16.4s, " X0 ".4s, #9") \
+            __ASM_EMIT("ushr            v17.4s, " X1 ".4s, #9") \
+            __ASM_EMIT("orr             v16.16b, v16.16b, v20.16b")         /* v16 = u */ \
+            __ASM_EMIT("orr             v17.16b, v17.16b, v20.16b") \
+            __ASM_EMIT("fadd            v18.4s, v18.4s, v16.4s")            /* v18 = S + u */ \
+            __ASM_EMIT("fadd            v19.4s, v19.4s, v17.4s")
+
+        #define NOISE_STORE \
+            __ASM_EMIT("fmul            v18.4s, v18.4s, v21.4s")            /* v18 = S*K */ \
+            __ASM_EMIT("fmul            v19.4s, v19.4s, v21.4s") \
+            __ASM_EMIT("fsub            v18.4s, v18.4s, v22.4s")            /* v18 = S*K - B */ \
+            __ASM_EMIT("fsub            v19.4s, v19.4s, v22.4s") \
+            __ASM_EMIT("stp             q18, q19, [%[dst]]") \
+            __ASM_EMIT("add             %[dst], %[dst], #0x20")
+
+        /* 1 step per block */
+        #define NOISE_UNIFORM \
+            __ASM_EMIT("subs            %[count], %[count], #4") \
+            __ASM_EMIT("b.lo            2f") \
+            __ASM_EMIT("1:") \
+            NOISE_STEP(NOISE_R0, NOISE_R3) \
+            NOISE_FIRST(NOISE_R0) \
+            NOISE_STORE \
+            NOISE_STEP(NOISE_R1, NOISE_R0) \
+            NOISE_FIRST(NOISE_R1) \
+            NOISE_STORE \
+            NOISE_STEP(NOISE_R2, NOISE_R1) \
+            NOISE_FIRST(NOISE_R2) \
+            NOISE_STORE \
+            NOISE_STEP(NOISE_R3, NOISE_R2) \
+            NOISE_FIRST(NOISE_R3) \
+            NOISE_STORE \
+            __ASM_EMIT("subs            %[count], %[count], #4") \
+            __ASM_EMIT("b.hs            1b") \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("adds            %[count], %[count], #4") \
+            __ASM_EMIT("b.eq            3f") \
+            NOISE_STEP(NOISE_R0, NOISE_R3) \
+            NOISE_FIRST(NOISE_R0) \
+            NOISE_STORE \
+            __ASM_EMIT("subs            %[count], %[count], #1") \
+            __ASM_EMIT("b.eq            3f") \
+            NOISE_STEP(NOISE_R1, NOISE_R0) \
+            NOISE_FIRST(NOISE_R1) \
+            NOISE_STORE \
+            __ASM_EMIT("subs            %[count], %[count], #1") \
+            __ASM_EMIT("b.eq            3f") \
+            NOISE_STEP(NOISE_R2, NOISE_R1) \
+            NOISE_FIRST(NOISE_R2) \
+            NOISE_STORE \
+            __ASM_EMIT("3:")
+
+        /* 2 steps per block */
+        #define NOISE_TPDF \
+            __ASM_EMIT("subs            %[count], %[count], #2") \
+            __ASM_EMIT("b.lo            2f") \
+            __ASM_EMIT("1:") \
+            NOISE_STEP(NOISE_R0, NOISE_R3) \
+            NOISE_FIRST(NOISE_R0) \
+            NOISE_STEP(NOISE_R1, NOISE_R0) \
+            NOISE_NEXT(NOISE_R1) \
+            NOISE_STORE \
+            NOISE_STEP(NOISE_R2, NOISE_R1) \
+            NOISE_FIRST(NOISE_R2) \
+            NOISE_STEP(NOISE_R3, NOISE_R2) \
+            NOISE_NEXT(NOISE_R3) \
+            NOISE_STORE \
+            __ASM_EMIT("subs            %[count], %[count], #2") \
+            __ASM_EMIT("b.hs            1b") \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("adds            %[count], %[count], #2") \
+            __ASM_EMIT("b.eq            3f") \
+            NOISE_STEP(NOISE_R0, NOISE_R3) \
+            NOISE_FIRST(NOISE_R0) \
+            NOISE_STEP(NOISE_R1, NOISE_R0) \
+            NOISE_NEXT(NOISE_R1) \
+            NOISE_STORE \
+            __ASM_EMIT("3:")
+
+        /* 4 steps per block */
+        #define NOISE_GAUSSIAN \
+            __ASM_EMIT("cbz             %[count], 2f") \
+            __ASM_EMIT("1:") \
+            NOISE_STEP(NOISE_R0, NOISE_R3) \
+            NOISE_FIRST(NOISE_R0) \
+            NOISE_STEP(NOISE_R1, NOISE_R0) \
+            NOISE_NEXT(NOISE_R1) \
+            NOISE_STEP(NOISE_R2, NOISE_R1) \
+            NOISE_NEXT(NOISE_R2) \
+            NOISE_STEP(NOISE_R3, NOISE_R2) \
+            NOISE_NEXT(NOISE_R3) \
+            NOISE_STORE \
+            __ASM_EMIT("subs            %[count], %[count], #1") \
+            __ASM_EMIT("b.ne            1b") \
+            __ASM_EMIT("2:")
+
+        /*
+         * Generate BLOCKS blocks of 8 samples: load the ring in order of age starting
+         * from the oldest row, run the generator and store the rows back in place
+         */
+        #define NOISE_KERNEL(BODY, DST, BLOCKS) \
+        { \
+            float *vd       = DST; \
+            size_t nb       = BLOCKS; \
+            ARCH_AARCH64_ASM( \
+                __ASM_EMIT("ldp             q0, q1, [%[s0]]") \
+                __ASM_EMIT("ldp             q2, q3, [%[s1]]") \
+                __ASM_EMIT("ldp             q4, q5, [%[s2]]") \
+                __ASM_EMIT("ldp             q6, q7, [%[s3]]") \
+                __ASM_EMIT("ldp             q20, q21, [%[P], #0x00]")           /* v20 = 1, v21 = K */ \
+                __ASM_EMIT("ldr             q22, [%[P], #0x20]")                /* v22 = B */ \
+                BODY \
+                __ASM_EMIT("stp             q0, q1, [%[s0]]") \
+                __ASM_EMIT("stp             q2, q3, [%[s1]]") \
+                __ASM_EMIT("stp             q4, q5, [%[s2]]") \
+                __ASM_EMIT("stp             q6, q7, [%[s3]]") \
+                : [dst] "+r" (vd), [count] "+r" (nb) \
+                : [s0] "r" (n->s[n->index]), [s1] "r" (n->s[(n->index + 1) & 3]), \
+                  [s2] "r" (n->s[(n->index + 2) & 3]), [s3] "r" (n->s[(n->index + 3) & 3]), \
+                  [P] "r" (&p[0]) \
+                : "cc", "memory", \
+                  "v0", "v1", "v2", "v3", \
+                  "v4", "v5", "v6", "v7", \
+                  "v16", "v17", "v18", "v19", \
+                  "v20", "v21", "v22" \
+            ); \
+        }
+
+        #define NOISE_GENERATE(BODY, STEPS, K, B) \
+            float p[12] __lsp_aligned16; \
+            float xd[8] __lsp_aligned16; \
+            size_t blocks = count >> 3; \
+            noise_init_params(p, K, B); \
+            if (blocks > 0) \
+            { \
+                NOISE_KERNEL(BODY, dst, blocks); \
+                n->index        = (n->index + blocks * STEPS) & 3; \
+                dst            += blocks << 3; \
+            } \
+            if (count & 7) \
+            { \
+                NOISE_KERNEL(BODY, xd, 1); \
+                n->index        = (n->index + STEPS) & 3; \
+                for (size_t i=0; i < (count & 7); ++i) \
+                    dst[i]          = xd[i]; \
+            }
+
+        void noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count)
+        {
+            NOISE_GENERATE(NOISE_UNIFORM, 1, 2.0f * k, 3.0f * k);
+        }
+
+        void noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count)
+        {
+            NOISE_GENERATE(NOISE_TPDF, 2, k, 3.0f * k);
+        }
+
+        void noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count)
+        {
+            const float K   = 1.7320508f * s; // sqrt(3) * s
+            NOISE_GENERATE(NOISE_GAUSSIAN, 4, K, 6.0f * K);
+        }
+
+        #undef NOISE_GENERATE
+        #undef NOISE_KERNEL
+        #undef NOISE_GAUSSIAN
+        #undef NOISE_TPDF
+        #undef NOISE_UNIFORM
+        #undef NOISE_STORE
+        #undef NOISE_NEXT_X
+        #undef NOISE_NEXT
+        #undef NOISE_FIRST_X
+        #undef NOISE_FIRST
+        #undef NOISE_STEP_X
+        #undef NOISE_STEP
+        #undef NOISE_R3
+        #undef NOISE_R2
+        #undef NOISE_R1
+        #undef NOISE_R0
+
+    } /* namespace asimd */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_NOISE_H_ */
@@ -26,6 +26,7 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
 
+#include <private/dsp/fft.h>
 #include <private/dsp/arch/aarch64/asimd/fft/const.h>
 #include <private/dsp/arch/aarch64/asimd/fft/pscramble.h>
 #include <private/dsp/arch/aarch64/asimd/fft/pbutterfly.h>
@@ -41,15 +42,15 @@ namespace lsp
             {
                 if (rank == 2)
                 {
-                    float s0_re     = dst[0] + dst[2];
-                    float s1_re     = dst[0] - dst[2];
-                    float s0_im     = dst[1] + dst[3];
-                    float s1_im     = dst[1] - dst[3];
+                    float s0_re     = src[0] + src[4];
+                    float s1_re     = src[0] - src[4];
+                    float s0_im     = src[1] + src[5];
+                    float s1_im     = src[1] - src[5];
 
-                    float s2_re     = dst[4] + dst[6];
-                    float s3_re     = dst[4] - dst[6];
-                    float s2_im     = dst[5] + dst[7];
-                    float s3_im     = dst[5] - dst[7];
+                    float s2_re     = src[2] + src[6];
+                    float s3_re     = src[2] - src[6];
+                    float s2_im     = src[3] + src[7];
+                    float s3_im     = src[3] - src[7];
 
                     dst[0]          = s0_re + s2_re;
                     dst[1]          = s0_im + s2_im;
@@ -99,15 +100,15 @@ namespace lsp
             {
                 if (rank == 2)
                 {
-                    float s0_re     = src[0] + src[2];
-                    float s1_re     = src[0] - src[2];
-                    float s2_re     = src[4] + src[6];
-                    float s3_re     = src[4] - src[6];
+                    float s0_re     = src[0] + src[4];
+                    float s1_re     = src[0] - src[4];
+                    float s2_re     = src[2] + src[6];
+                    float s3_re     = src[2] - src[6];
 
-                    float s0_im     = src[1] + src[3];
-                    float s1_im     = src[1] - src[3];
-                    float s2_im     = src[5] + src[7];
-                    float s3_im     = src[5] - src[7];
+                    float s0_im     = src[1] + src[5];
+                    float s1_im     = src[1] - src[5];
+                    float s2_im     = src[3] + src[7];
+                    float s3_im     = src[3] - src[7];
 
                     dst[0]          = (s0_re + s2_re)*0.25f;
                     dst[1]          = (s0_im + s2_im)*0.25f;
@@ -125,10 +126,10 @@ namespace lsp
                     // s1' = s0 - s1
                     float s1_re     = src[2];
                     float s1_im     = src[3];
-                    dst[2]          = src[0] - s1_re;
-                    dst[3]          = src[1] - s1_im;
-                    dst[0]          = src[0] + s1_re;
-                    dst[1]          = src[1] + s1_im;
+                    dst[2]          = (src[0] - s1_re) * 0.5f;
+                    dst[3]          = (src[1] - s1_im) * 0.5f;
+                    dst[0]          = (src[0] + s1_re) * 0.5f;
+                    dst[1]          = (src[1] + s1_im) * 0.5f;
                 }
                 else
                 {
@@ -149,6 +150,78 @@ namespace lsp
 
             packed_unscramble_reverse(dst, rank);
         }
+
+        void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    packed_direct_fft(dst[i], src[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                {
+                    if (dst[j] == src[j])
+                        packed_scramble_self_direct(dst[j], rank);
+                    else
+                        packed_scramble_copy_direct(dst[j], src[j], rank);
+                }
+
+                for (size_t j=0; j<n; ++j)
+                    packed_direct_butterfly_rank3(dst[j], 1 << (rank-3));
+
+                for (size_t i=4; i <= rank; ++i)
+                    packed_direct_butterfly_rank4p_batch(dst, i, 1 << (rank - i), n);
+
+                for (size_t j=0; j<n; ++j)
+                    packed_unscramble_direct(dst[j], rank);
+
+                dst            += n;
+                src            += n;
+                count          -= n;
+            }
+        }
+
+        void packed_reverse_fft_batch(float **dst, const float * const *src, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    packed_reverse_fft(dst[i], src[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                {
+                    if (dst[j] == src[j])
+                        packed_scramble_self_reverse(dst[j], rank);
+                    else
+                        packed_scramble_copy_reverse(dst[j], src[j], rank);
+                }
+
+                for (size_t j=0; j<n; ++j)
+                    packed_reverse_butterfly_rank3(dst[j], 1 << (rank-3));
+
+                for (size_t i=4; i <= rank; ++i)
+                    packed_reverse_butterfly_rank4p_batch(dst, i, 1 << (rank - i), n);
+
+                for (size_t j=0; j<n; ++j)
+                    packed_unscramble_reverse(dst[j], rank);
+
+                dst            += n;
+                src            += n;
+                count          -= n;
+            }
+        }
     }
 }
 
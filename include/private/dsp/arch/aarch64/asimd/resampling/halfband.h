@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_RESAMPLING_HALFBAND_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_RESAMPLING_HALFBAND_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+/* Register allocation:
+ * v0-v1    - section inputs X
+ * v2-v3    - temporary
+ * v4-v5    - section outputs T
+ * v16-v17  - input memory x[]
+ * v18-v19  - output memory y[]
+ * v20-v21  - allpass coefficients
+ * v22-v23  - section mask
+ * v24      - all ones
+ * v25      - zero
+ * v26      - 0.5
+ */
+
+// Compute all sections, input samples should be in v0 lanes 0, 1
+#define HALFBAND_ASIMD_CALC \
+    __ASM_EMIT("mov         v0.d[1], v18.d[0]")                     /* v0   = s0 s1 y0 y1 = X0 */ \
+    __ASM_EMIT("ext         v1.16b, v18.16b, v19.16b, #8")          /* v1   = y2 y3 y4 y5 = X1 */ \
+    __ASM_EMIT("fsub        v2.4s, v0.4s, v18.4s")                  /* v2   = X0 - Y0 */ \
+    __ASM_EMIT("fsub        v3.4s, v1.4s, v19.4s")                  /* v3   = X1 - Y1 */ \
+    __ASM_EMIT("mov         v4.16b, v16.16b")                       /* v4   = XM0 */ \
+    __ASM_EMIT("mov         v5.16b, v17.16b")                       /* v5   = XM1 */ \
+    __ASM_EMIT("fmla        v4.4s, v2.4s, v20.4s")                  /* v4   = (X0 - Y0)*A0 + XM0 = T0 */ \
+    __ASM_EMIT("fmla        v5.4s, v3.4s, v21.4s")                  /* v5   = (X1 - Y1)*A1 + XM1 = T1 */
+
+// Update memory of all sections
+#define HALFBAND_ASIMD_UPDATE \
+    __ASM_EMIT("mov         v16.16b, v0.16b")                       /* v16  = XM0' = X0 */ \
+    __ASM_EMIT("mov         v17.16b, v1.16b")                       /* v17  = XM1' = X1 */ \
+    __ASM_EMIT("mov         v18.16b, v4.16b")                       /* v18  = Y0' = T0 */ \
+    __ASM_EMIT("mov         v19.16b, v5.16b")                       /* v19  = Y1' = T1 */
+
+// Update memory of sections enabled by mask
+#define HALFBAND_ASIMD_UPDATE_MASKED \
+    __ASM_EMIT("bit         v16.16b, v0.16b, v22.16b")              /* v16  = (X0 & M0) | (XM0 & ~M0) */ \
+    __ASM_EMIT("bit         v17.16b, v1.16b, v23.16b")              /* v17  = (X1 & M1) | (XM1 & ~M1) */ \
+    __ASM_EMIT("bit         v18.16b, v4.16b, v22.16b")              /* v18  = (T0 & M0) | (Y0 & ~M0) */ \
+    __ASM_EMIT("bit         v19.16b, v5.16b, v23.16b")              /* v19  = (T1 & M1) | (Y1 & ~M1) */
+
+// Shift the mask by one section and fill the first section with FILL
+#define HALFBAND_ASIMD_SHIFT_MASK(FILL) \
+    __ASM_EMIT("ext         v23.16b, v22.16b, v23.16b, #8")         /* v23  = m2 m3 m4 m5 */ \
+    __ASM_EMIT("ext         v22.16b, " FILL ".16b, v22.16b, #8")    /* v22  = n n m0 m1 */
+
+#define HALFBAND_ASIMD_PROCESS(LOAD, STORE) \
+    __ASM_EMIT("cbz         %[count], 10f") \
+    \
+    /* Prepare */ \
+    __ASM_EMIT("ldp         q16, q17, [%[f], #0x00]")               /* v16  = XM0, v17 = XM1 */ \
+    __ASM_EMIT("ldp         q18, q19, [%[f], #0x20]")               /* v18  = Y0, v19 = Y1 */ \
+    __ASM_EMIT("ldp         q20, q21, [%[f], #0x40]")               /* v20  = A0, v21 = A1 */ \
+    __ASM_EMIT("movi        v24.2d, #0xffffffffffffffff")           /* v24  = -1 -1 -1 -1 */ \
+    __ASM_EMIT("eor         v25.16b, v25.16b, v25.16b")             /* v25  = 0 */ \
+    __ASM_EMIT("fmov        v26.4s, #0.5")                          /* v26  = 0.5 */ \
+    __ASM_EMIT("ext         v22.16b, v24.16b, v25.16b, #8")         /* v22  = -1 -1 0 0 */ \
+    __ASM_EMIT("eor         v23.16b, v23.16b, v23.16b")             /* v23  = 0 */ \
+    __ASM_EMIT("mov         %[mask], #1")                           /* mask = 1 */ \
+    \
+    /* Fill the pipeline */ \
+    __ASM_EMIT("1:") \
+    LOAD \
+    HALFBAND_ASIMD_CALC \
+    HALFBAND_ASIMD_UPDATE_MASKED \
+    __ASM_EMIT("subs        %[count], %[count], #1") \
+    __ASM_EMIT("b.eq        6f") \
+    __ASM_EMIT("orr         %[mask], %[mask], %[mask], LSL #1")     /* mask = (mask << 1) | 1 */ \
+    HALFBAND_ASIMD_SHIFT_MASK("v24") \
+    __ASM_EMIT("cmp         %[mask], #0x0f") \
+    __ASM_EMIT("b.ne        1b") \
+    \
+    /* Process without mask */ \
+    __ASM_EMIT("5:") \
+    LOAD \
+    HALFBAND_ASIMD_CALC \
+    HALFBAND_ASIMD_UPDATE \
+    STORE \
+    __ASM_EMIT("subs        %[count], %[count], #1") \
+    __ASM_EMIT("b.ne        5b") \
+    \
+    /* Flush the pipeline */ \
+    __ASM_EMIT("6:") \
+    __ASM_EMIT("lsl         %[mask], %[mask], #1")                  /* mask = mask << 1 */ \
+    __ASM_EMIT("and         %[mask], %[mask], #0x0f")               /* mask = (mask << 1) & 0x0f */ \
+    HALFBAND_ASIMD_SHIFT_MASK("v25") \
+    __ASM_EMIT("7:") \
+    HALFBAND_ASIMD_CALC \
+    HALFBAND_ASIMD_UPDATE_MASKED \
+    __ASM_EMIT("tst         %[mask], #0x08")                        /* Need to emit? */ \
+    __ASM_EMIT("b.eq        8f") \
+    STORE \
+    __ASM_EMIT("8:") \
+    __ASM_EMIT("lsl         %[mask], %[mask], #1")                  /* mask = mask << 1 */ \
+    HALFBAND_ASIMD_SHIFT_MASK("v25") \
+    __ASM_EMIT("ands        %[mask], %[mask], #0x0f")               /* mask = (mask << 1) & 0x0f */ \
+    __ASM_EMIT("b.ne        7b") \
+    \
+    /* Store memory */ \
+    __ASM_EMIT("stp         q16, q17, [%[f], #0x00]") \
+    __ASM_EMIT("stp         q18, q19, [%[f], #0x20]") \
+    __ASM_EMIT("10:")
+
+namespace lsp
+{
+    namespace asimd
+    {
+        void halfband_upsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f)
+        {
+            IF_ARCH_AARCH64(
+                size_t mask;
+            );
+
+            ARCH_AARCH64_ASM
+            (
+                HALFBAND_ASIMD_PROCESS(
+                    __ASM_EMIT("ld1r        {v0.4s}, [%[src]]")                     /* v0   = s s s s */
+                    __ASM_EMIT("add         %[src], %[src], #0x04"),
+
+                    __ASM_EMIT("st1         {v19.d}[1], [%[dst]]")                  /* dst[0] = y6, dst[1] = y7 */
+                    __ASM_EMIT("add         %[dst], %[dst], #0x08")
+                )
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+                  [mask] "=&r" (mask)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21", "v22", "v23",
+                  "v24", "v25", "v26"
+            );
+        }
+
+        void halfband_downsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f)
+        {
+            IF_ARCH_AARCH64(
+                size_t mask;
+            );
+
+            ARCH_AARCH64_ASM
+            (
+                HALFBAND_ASIMD_PROCESS(
+                    __ASM_EMIT("ld1         {v0.2s}, [%[src]]")                     /* v0   = s0 s1 */
+                    __ASM_EMIT("rev64       v0.2s, v0.2s")                          /* v0   = s1 s0 */
+                    __ASM_EMIT("add         %[src], %[src], #0x08"),
+
+                    __ASM_EMIT("faddp       v2.4s, v19.4s, v19.4s")                 /* v2   = y4+y5 y6+y7 y4+y5 y6+y7 */
+                    __ASM_EMIT("fmul        v2.4s, v2.4s, v26.4s")                  /* v2   = (y4+y5)*0.5 (y6+y7)*0.5 ... */
+                    __ASM_EMIT("st1         {v2.s}[1], [%[dst]]")                   /* *dst = (y6+y7)*0.5 */
+                    __ASM_EMIT("add         %[dst], %[dst], #0x04")
+                )
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+                  [mask] "=&r" (mask)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21", "v22", "v23",
+                  "v24", "v25", "v26"
+            );
+        }
+    }
+}
+
+#undef HALFBAND_ASIMD_PROCESS
+#undef HALFBAND_ASIMD_SHIFT_MASK
+#undef HALFBAND_ASIMD_UPDATE_MASKED
+#undef HALFBAND_ASIMD_UPDATE
+#undef HALFBAND_ASIMD_CALC
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_RESAMPLING_HALFBAND_H_ */
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_SHAPER_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_SHAPER_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        /**
+         * Prepare parameters of the waveshaper
+         * @param p parameters to initialize, 6 vectors
+         * @param s waveshaper descriptor
+         */
+        static void shaper_init_params(float *p, const dsp::shaper_t *s)
+        {
+            for (size_t i=0; i<4; ++i)
+            {
+                p[i]            = s->scale;
+                p[i + 4]        = s->offset;
+                p[i + 8]        = s->last;
+                p[i + 12]       = 0.5f;
+                p[i + 16]       = 0.5f;                     // K1 of the Hermite spline
+                p[i + 20]       = 1.5f;                     // K2 of the Hermite spline
+            }
+        }
+
+        /*
+         * Compute table positions of 4 samples, clamp them, split into integer and fractional
+         * parts and load points c[k-1] .. c[k+2] of each sample into v0, v3, v2, v5.
+         * FMAXNM and FMINNM return the numeric operand, so NaN is mapped to the first point.
+         */
+        #define SHAPER_POINTS \
+            __ASM_EMIT("ldr             q1, [%[src]]")                  /* v1   = x */ \
+            __ASM_EMIT("fmul            v1.4s, v1.4s, v24.4s")          /* v1   = x*scale */ \
+            __ASM_EMIT("fadd            v1.4s, v1.4s, v25.4s")          /* v1   = u = x*scale + offset */ \
+            __ASM_EMIT("fmaxnm          v1.4s, v1.4s, v27.4s")          /* v1   = max(u, 0) */ \
+            __ASM_EMIT("fminnm          v1.4s, v1.4s, v26.4s")          /* v1   = U = min(u, last) */ \
+            __ASM_EMIT("fcvtzu          v3.4s, v1.4s")                  /* v3   = K = int(U) */ \
+            __ASM_EMIT("ucvtf           v2.4s, v3.4s")                  /* v2   = float(K) */ \
+            __ASM_EMIT("fsub            v1.4s, v1.4s, v2.4s")           /* v1   = F = U - K */ \
+            __ASM_EMIT("shl             v3.4s, v3.4s, #2")              /* v3   = K * sizeof(float) */ \
+            __ASM_EMIT("umov            %w[t], v3.s[0]") \
+            __ASM_EMIT("ldr             q4, [%[buf], %[t]]")            /* v4   = a0 a1 a2 a3 */ \
+            __ASM_EMIT("umov            %w[t], v3.s[1]") \
+            __ASM_EMIT("ldr             q5, [%[buf], %[t]]")            /* v5   = b0 b1 b2 b3 */ \
+            __ASM_EMIT("umov            %w[t], v3.s[2]") \
+            __ASM_EMIT("ldr             q6, [%[buf], %[t]]")            /* v6   = c0 c1 c2 c3 */ \
+            __ASM_EMIT("umov            %w[t], v3.s[3]") \
+            __ASM_EMIT("ldr             q7, [%[buf], %[t]]")            /* v7   = d0 d1 d2 d3 */ \
+            /* Transpose */ \
+            __ASM_EMIT("trn1            v16.4s, v4.4s, v5.4s")          /* v16  = a0 b0 a2 b2 */ \
+            __ASM_EMIT("trn2            v17.4s, v4.4s, v5.4s")          /* v17  = a1 b1 a3 b3 */ \
+            __ASM_EMIT("trn1            v18.4s, v6.4s, v7.4s")          /* v18  = c0 d0 c2 d2 */ \
+            __ASM_EMIT("trn2            v19.4s, v6.4s, v7.4s")          /* v19  = c1 d1 c3 d3 */ \
+            __ASM_EMIT("trn1            v0.2d, v16.2d, v18.2d")         /* v0   = a0 b0 c0 d0 = c[k-1] */ \
+            __ASM_EMIT("trn1            v3.2d, v17.2d, v19.2d")         /* v3   = a1 b1 c1 d1 = c[k] */ \
+            __ASM_EMIT("trn2            v2.2d, v16.2d, v18.2d")         /* v2   = a2 b2 c2 d2 = c[k+1] */ \
+            __ASM_EMIT("trn2            v5.2d, v17.2d, v19.2d")         /* v5   = a3 b3 c3 d3 = c[k+2] */
+
+        /* v0 = c[k-1], v3 = c[k], v2 = c[k+1], v5 = c[k+2], v1 = F, result in v5 */
+        #define SHAPER_LINEAR_CORE \
+            __ASM_EMIT("fsub            v5.4s, v2.4s, v3.4s")           /* v5   = c[k+1] - c[k] */ \
+            __ASM_EMIT("fmul            v5.4s, v5.4s, v1.4s")           /* v5   = (c[k+1] - c[k])*F */ \
+            __ASM_EMIT("fadd            v5.4s, v5.4s, v3.4s")           /* v5   = c[k] + (c[k+1] - c[k])*F */
+
+        #define SHAPER_CUBIC_CORE \
+            __ASM_EMIT("fsub            v4.4s, v2.4s, v0.4s")           /* v4   = c[k+1] - c[k-1] */ \
+            __ASM_EMIT("fadd            v6.4s, v2.4s, v0.4s")           /* v6   = c[k-1] + c[k+1] */ \
+            __ASM_EMIT("fsub            v5.4s, v5.4s, v0.4s")           /* v5   = c[k+2] - c[k-1] */ \
+            __ASM_EMIT("fsub            v0.4s, v3.4s, v2.4s")           /* v0   = c[k] - c[k+1] */ \
+            __ASM_EMIT("fmul            v4.4s, v4.4s, v28.4s")          /* v4   = h = 0.5*(c[k+1] - c[k-1]) */ \
+            __ASM_EMIT("fmul            v6.4s, v6.4s, v28.4s")          /* v6   = 0.5*(c[k-1] + c[k+1]) */ \
+            __ASM_EMIT("fsub            v6.4s, v6.4s, v3.4s")           /* v6   = q = 0.5*(c[k-1] + c[k+1]) - c[k] */ \
+            __ASM_EMIT("fmul            v5.4s, v5.4s, v29.4s")          /* v5   = K1*(c[k+2] - c[k-1]) */ \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v30.4s")          /* v0   = K2*(c[k] - c[k+1]) */ \
+            __ASM_EMIT("fadd            v5.4s, v5.4s, v0.4s")           /* v5   = c3 */ \
+            __ASM_EMIT("fsub            v6.4s, v6.4s, v5.4s")           /* v6   = c2 = q - c3 */ \
+            __ASM_EMIT("fmul            v5.4s, v5.4s, v1.4s")           /* v5   = c3*F */ \
+            __ASM_EMIT("fadd            v5.4s, v5.4s, v6.4s")           /* v5   = c3*F + c2 */ \
+            __ASM_EMIT("fmul            v5.4s, v5.4s, v1.4s")           /* v5   = (c3*F + c2)*F */ \
+            __ASM_EMIT("fadd            v5.4s, v5.4s, v4.4s")           /* v5   = (c3*F + c2)*F + h */ \
+            __ASM_EMIT("fmul            v5.4s, v5.4s, v1.4s")           /* v5   = ((c3*F + c2)*F + h)*F */ \
+            __ASM_EMIT("fadd            v5.4s, v5.4s, v3.4s")           /* v5   = ((c3*F + c2)*F + h)*F + c[k] */
+
+        #define SHAPER_KERNEL(CORE) \
+            ARCH_AARCH64_ASM( \
+                __ASM_EMIT("ldp             q24, q25, [%[P], #0x00]")       /* v24  = scale, v25 = offset */ \
+                __ASM_EMIT("ldp             q26, q28, [%[P], #0x20]")       /* v26  = last, v28 = 0.5 */ \
+                __ASM_EMIT("ldp             q29, q30, [%[P], #0x40]")       /* v29  = K1, v30 = K2 */ \
+                __ASM_EMIT("eor             v27.16b, v27.16b, v27.16b")     /* v27  = 0 */ \
+                __ASM_EMIT("subs            %[count], %[count], #4") \
+                __ASM_EMIT("b.lo            2f") \
+                __ASM_EMIT("1:") \
+                SHAPER_POINTS \
+                CORE \
+                __ASM_EMIT("str             q5, [%[dst]]") \
+                __ASM_EMIT("subs            %[count], %[count], #4") \
+                __ASM_EMIT("add             %[src], %[src], #0x10") \
+                __ASM_EMIT("add             %[dst], %[dst], #0x10") \
+                __ASM_EMIT("b.hs            1b") \
+                __ASM_EMIT("2:") \
+                : [dst] "+r" (vd), [src] "+r" (vs), [count] "+r" (n), \
+                  [t] "=&r" (t) \
+                : [P] "r" (&p[0]), [buf] "r" (buf) \
+                : "cc", "memory", \
+                  "v0", "v1", "v2", "v3", \
+                  "v4", "v5", "v6", "v7", \
+                  "v16", "v17", "v18", "v19", \
+                  "v24", "v25", "v26", "v27", \
+                  "v28", "v29", "v30" \
+            )
+
+        /*
+         * The last incomplete block is processed as the full block padded by zeros,
+         * so the kernel does not need scalar code
+         */
+        #define SHAPER_APPLY(CORE) \
+            float *vd           = dst; \
+            const float *vs     = src; \
+            size_t n            = count; \
+            size_t t; \
+            SHAPER_KERNEL(CORE); \
+            \
+            size_t done         = count & ~size_t(3); \
+            if (done < count) \
+            { \
+                float xd[4] __lsp_aligned16; \
+                float xs[4] __lsp_aligned16; \
+                for (size_t i=0; i<4; ++i) \
+                    xs[i]               = (done + i < count) ? src[done + i] : 0.0f; \
+                vd                  = xd; \
+                vs                  = xs; \
+                n                   = 4; \
+                SHAPER_KERNEL(CORE); \
+                for (size_t i=done; i<count; ++i) \
+                    dst[i]              = xd[i - done]; \
+            }
+
+        void shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count)
+        {
+            float p[6*4] __lsp_aligned16;
+            shaper_init_params(p, s);
+            SHAPER_APPLY(SHAPER_LINEAR_CORE);
+        }
+
+        void shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count)
+        {
+            float p[6*4] __lsp_aligned16;
+            shaper_init_params(p, s);
+            SHAPER_APPLY(SHAPER_CUBIC_CORE);
+        }
+
+        #undef SHAPER_APPLY
+        #undef SHAPER_KERNEL
+        #undef SHAPER_CUBIC_CORE
+        #undef SHAPER_LINEAR_CORE
+        #undef SHAPER_POINTS
+
+    } /* namespace asimd */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_SHAPER_H_ */
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_XCORR_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_XCORR_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        /* V is the vector arrangement: "4s" for 4x blocks, "2s" for 1x blocks */
+        #define XCORR_MUL(V) \
+            __ASM_EMIT("fmul        v0." V ", v16." V ", v18." V)           /* v0   = ar*br */ \
+            __ASM_EMIT("fmul        v1." V ", v16." V ", v19." V)           /* v1   = ar*bi */ \
+            __ASM_EMIT("fmla        v0." V ", v17." V ", v19." V)           /* v0   = gr = ar*br + ai*bi */ \
+            __ASM_EMIT("fmls        v1." V ", v17." V ", v18." V)           /* v1   = gi = ar*bi - ai*br */
+
+        #define XCORR_WEIGHT_PLAIN(V)
+
+        #define XCORR_WEIGHT_PHAT(V) \
+            __ASM_EMIT("fmul        v2." V ", v0." V ", v0." V)             /* v2   = gr*gr */ \
+            __ASM_EMIT("fmla        v2." V ", v1." V ", v1." V)             /* v2   = gr*gr + gi*gi */ \
+            __ASM_EMIT("fsqrt       v2." V ", v2." V)                       /* v2   = |g| */ \
+            __ASM_EMIT("fadd        v2." V ", v2." V ", v25." V)            /* v2   = |g| + eps */ \
+            __ASM_EMIT("fdiv        v2." V ", v26." V ", v2." V)            /* v2   = w = 1 / (|g| + eps) */ \
+            __ASM_EMIT("fmul        v0." V ", v0." V ", v2." V)             /* v0   = gr*w */ \
+            __ASM_EMIT("fmul        v1." V ", v1." V ", v2." V)             /* v1   = gi*w */
+
+        #define XCORR_SMOOTH(V) \
+            __ASM_EMIT("fsub        v0." V ", v0." V ", v20." V)            /* v0   = gr - sr */ \
+            __ASM_EMIT("fsub        v1." V ", v1." V ", v21." V)            /* v1   = gi - si */ \
+            __ASM_EMIT("fmla        v20." V ", v0." V ", v24." V)           /* v20  = sr' = sr + (gr - sr)*k */ \
+            __ASM_EMIT("fmla        v21." V ", v1." V ", v24." V)           /* v21  = si' = si + (gi - si)*k */
+
+        #define XCORR_KERNEL(WEIGHT) \
+            ARCH_AARCH64_ASM \
+            ( \
+                __ASM_EMIT("ldp         q24, q25, [%[C]]")                  /* v24  = k, v25 = eps */ \
+                __ASM_EMIT("fmov        v26.4s, #1.0")                      /* v26  = 1 */ \
+                /* x4 blocks */ \
+                __ASM_EMIT("subs        %[count], %[count], #4") \
+                __ASM_EMIT("b.lo        2f") \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("ld2         {v16.4s, v17.4s}, [%[a]], #0x20")   /* v16  = ar, v17 = ai */ \
+                __ASM_EMIT("ld2         {v18.4s, v19.4s}, [%[b]], #0x20")   /* v18  = br, v19 = bi */ \
+                __ASM_EMIT("ld2         {v20.4s, v21.4s}, [%[acc]]")        /* v20  = sr, v21 = si */ \
+                XCORR_MUL("4s") \
+                WEIGHT("4s") \
+                XCORR_SMOOTH("4s") \
+                __ASM_EMIT("subs        %[count], %[count], #4") \
+                __ASM_EMIT("st2         {v20.4s, v21.4s}, [%[acc]], #0x20") \
+                __ASM_EMIT("b.hs        1b") \
+                __ASM_EMIT("2:") \
+                /* x1 blocks */ \
+                __ASM_EMIT("adds        %[count], %[count], #3") \
+                __ASM_EMIT("b.lt        4f") \
+                __ASM_EMIT("3:") \
+                __ASM_EMIT("ld2         {v16.s, v17.s}[0], [%[a]], #0x08")  /* v16  = ar, v17 = ai */ \
+                __ASM_EMIT("ld2         {v18.s, v19.s}[0], [%[b]], #0x08")  /* v18  = br, v19 = bi */ \
+                __ASM_EMIT("ld2         {v20.s, v21.s}[0], [%[acc]]")       /* v20  = sr, v21 = si */ \
+                XCORR_MUL("2s") \
+                WEIGHT("2s") \
+                XCORR_SMOOTH("2s") \
+                __ASM_EMIT("subs        %[count], %[count], #1") \
+                __ASM_EMIT("st2         {v20.s, v21.s}[0], [%[acc]], #0x08") \
+                __ASM_EMIT("b.ge        3b") \
+                __ASM_EMIT("4:") \
+                : [acc] "+r" (acc), [a] "+r" (a), [b] "+r" (b), \
+                  [count] "+r" (count) \
+                : [C] "r" (&c[0]) \
+                : "cc", "memory", \
+                  "v0", "v1", "v2", \
+                  "v16", "v17", "v18", "v19", "v20", "v21", \
+                  "v24", "v25", "v26" \
+            )
+
+        void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count)
+        {
+            float c[8] __lsp_aligned16;
+            for (size_t i=0; i<4; ++i)
+            {
+                c[i]            = k;                // Smoothing factor
+                c[i + 4]        = 1e-20f;           // Bias of the magnitude
+            }
+
+            if (weight == dsp::XCORR_PHAT)
+                XCORR_KERNEL(XCORR_WEIGHT_PHAT);
+            else
+                XCORR_KERNEL(XCORR_WEIGHT_PLAIN);
+        }
+
+        #undef XCORR_KERNEL
+        #undef XCORR_SMOOTH
+        #undef XCORR_WEIGHT_PHAT
+        #undef XCORR_WEIGHT_PLAIN
+        #undef XCORR_MUL
+
+    } /* namespace asimd */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_XCORR_H_ */
@@ -42,6 +42,14 @@
 #define FPCR_DN                 (1 << 25)   /* Default NaN mode control */
 #define FPCR_AHP                (1 << 26)   /* Alternative half-precision control */
 
+#define FPSR_IOC                (1 << 0)    /* Invalid operation cumulative exception */
+#define FPSR_DZC                (1 << 1)    /* Division by zero cumulative exception */
+#define FPSR_OFC                (1 << 2)    /* Overflow cumulative exception */
+#define FPSR_UFC                (1 << 3)    /* Underflow cumulative exception */
+#define FPSR_IXC                (1 << 4)    /* Inexact cumulative exception */
+#define FPSR_IDC                (1 << 7)    /* Input denormal cumulative exception */
+#define FPSR_QC                 (1 << 27)   /* Cumulative saturation */
+
 namespace lsp
 {
     namespace aarch64
@@ -70,6 +78,31 @@ namespace lsp
                 :
             );
         }
+
+        inline uint64_t read_fpsr()
+        {
+            uint64_t fpsr = 0;
+
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("mrs         %[fpsr], FPSR")
+                : [fpsr] "=&r" (fpsr)
+                : :
+            );
+
+            return fpsr;
+        }
+
+        inline void write_fpsr(uint64_t fpsr)
+        {
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("msr         FPSR, %[fpsr]")
+                :
+                : [fpsr] "r" (fpsr)
+                :
+            );
+        }
     }
 }
 
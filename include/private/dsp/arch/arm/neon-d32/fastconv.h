@@ -31,5 +31,6 @@
 #include <private/dsp/arch/arm/neon-d32/fastconv/restore.h>
 #include <private/dsp/arch/arm/neon-d32/fastconv/apply.h>
 #include <private/dsp/arch/arm/neon-d32/fastconv/papply.h>
+#include <private/dsp/arch/arm/neon-d32/fastconv/fmadd.h>
 
 #endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_FASTCONV_H_ */
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_ARM_NEON_D32_FASTCONV_FMADD_H_
+#define PRIVATE_DSP_ARCH_ARM_NEON_D32_FASTCONV_FMADD_H_
+
+#ifndef PRIVATE_DSP_ARCH_ARM_NEON_D32_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_IMPL */
+
+namespace lsp
+{
+    namespace neon_d32
+    {
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t blocks       = size_t(1) << (rank - 2); // number of 4x complex blocks, always even
+
+            ARCH_ARM_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vldm        %[c1]!, {q0-q3}")           // q0   = ar0, q1 = ai0, q2 = ar1, q3 = ai1
+                __ASM_EMIT("vldm        %[c2]!, {q4-q7}")           // q4   = br0, q5 = bi0, q6 = br1, q7 = bi1
+                __ASM_EMIT("vldm        %[dst], {q8-q11}")          // q8   = dr0, q9 = di0, q10 = dr1, q11 = di1
+                __ASM_EMIT("vfma.f32    q8, q0, q4")                // q8   = dr0 + ar0*br0
+                __ASM_EMIT("vfma.f32    q9, q0, q5")                // q9   = di0 + ar0*bi0
+                __ASM_EMIT("vfma.f32    q10, q2, q6")               // q10  = dr1 + ar1*br1
+                __ASM_EMIT("vfma.f32    q11, q2, q7")               // q11  = di1 + ar1*bi1
+                __ASM_EMIT("vfms.f32    q8, q1, q5")                // q8   = dr0 + ar0*br0 - ai0*bi0
+                __ASM_EMIT("vfma.f32    q9, q1, q4")                // q9   = di0 + ar0*bi0 + ai0*br0
+                __ASM_EMIT("vfms.f32    q10, q3, q7")               // q10  = dr1 + ar1*br1 - ai1*bi1
+                __ASM_EMIT("vfma.f32    q11, q3, q6")               // q11  = di1 + ar1*bi1 + ai1*br1
+                __ASM_EMIT("subs        %[blocks], $2")
+                __ASM_EMIT("vstm        %[dst]!, {q8-q11}")
+                __ASM_EMIT("bne         1b")
+
+                : [dst] "+r" (dst), [c1] "+r" (c1), [c2] "+r" (c2),
+                  [blocks] "+r" (blocks)
+                :
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3", "q4", "q5", "q6", "q7",
+                  "q8", "q9", "q10", "q11"
+            );
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_FASTCONV_FMADD_H_ */
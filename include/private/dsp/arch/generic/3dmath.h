@@ -1398,6 +1398,82 @@ namespace lsp
             *r          = tmp;
         }
 
+        void apply_matrix3d_mvn(vector3d_t *r, const vector3d_t *v, const matrix3d_t *m, size_t n)
+        {
+            vector3d_t  tmp;
+            for (size_t i=0; i<n; ++i)
+            {
+                apply_matrix3d_mv2(&tmp, &v[i], m);
+                r[i]        = tmp;
+            }
+        }
+
+        void apply_matrix3d_mpn(point3d_t *r, const point3d_t *p, const matrix3d_t *m, size_t n)
+        {
+            point3d_t   tmp;
+            for (size_t i=0; i<n; ++i)
+            {
+                apply_matrix3d_mp2(&tmp, &p[i], m);
+                r[i]        = tmp;
+            }
+        }
+
+        void apply_matrix3d_mv_soa(vector3d_soa_t *dst, const vector3d_soa_t *src, const matrix3d_t *m, size_t n)
+        {
+            const float *M = m->m;
+            for (size_t i=0; i<n; ++i)
+            {
+                float vx    = src->dx[i];
+                float vy    = src->dy[i];
+                float vz    = src->dz[i];
+
+                float rx    = M[0] * vx + M[4] * vy + M[8]  * vz;
+                float ry    = M[1] * vx + M[5] * vy + M[9]  * vz;
+                float rz    = M[2] * vx + M[6] * vy + M[10] * vz;
+                float rw    = M[3] * vx + M[7] * vy + M[11] * vz;
+
+                // Homogenize vector
+                if (rw != 0.0f)
+                {
+                    rx         /= rw;
+                    ry         /= rw;
+                    rz         /= rw;
+                }
+
+                dst->dx[i]  = rx;
+                dst->dy[i]  = ry;
+                dst->dz[i]  = rz;
+            }
+        }
+
+        void apply_matrix3d_mp_soa(point3d_soa_t *dst, const point3d_soa_t *src, const matrix3d_t *m, size_t n)
+        {
+            const float *M = m->m;
+            for (size_t i=0; i<n; ++i)
+            {
+                float px    = src->x[i];
+                float py    = src->y[i];
+                float pz    = src->z[i];
+
+                float rx    = M[0] * px + M[4] * py + M[8]  * pz + M[12];
+                float ry    = M[1] * px + M[5] * py + M[9]  * pz + M[13];
+                float rz    = M[2] * px + M[6] * py + M[10] * pz + M[14];
+                float rw    = M[3] * px + M[7] * py + M[11] * pz + M[15];
+
+                // Homogenize point
+                if (rw != 0.0f)
+                {
+                    rx         /= rw;
+                    ry         /= rw;
+                    rz         /= rw;
+                }
+
+                dst->x[i]   = rx;
+                dst->y[i]   = ry;
+                dst->z[i]   = rz;
+            }
+        }
+
         void transpose_matrix3d1(matrix3d_t *r)
         {
             float T;
@@ -1944,6 +2020,7 @@ namespace lsp
             x.dx        = v1->dy * v2->dz - v1->dz * v2->dy;
             x.dy        = v1->dz * v2->dx - v1->dx * v2->dz;
             x.dz        = v1->dx * v2->dy - v1->dy * v2->dx;
+            x.dw        = 0.0f;
             *r          = x;
         }
 
@@ -1953,6 +2030,7 @@ namespace lsp
             x.dx        = vv[0].dy * vv[1].dz - vv[0].dz * vv[1].dy;
             x.dy        = vv[0].dz * vv[1].dx - vv[0].dx * vv[1].dz;
             x.dz        = vv[0].dx * vv[1].dy - vv[0].dy * vv[1].dx;
+            x.dw        = 0.0f;
             *r          = x;
         }
 
@@ -2091,6 +2169,49 @@ namespace lsp
             }
         }
 
+        void apply_matrix3d_mpn_bound_box(bound_box3d_t *b, point3d_t *r, const point3d_t *p, const matrix3d_t *m, size_t n)
+        {
+            if (n <= 0)
+            {
+                calc_bound_box(b, r, 0);
+                return;
+            }
+
+            point3d_t tmp, min, max;
+            apply_matrix3d_mp2(&tmp, p, m);
+            r[0]        = tmp;
+            min         = tmp;
+            max         = tmp;
+
+            for (size_t i=1; i<n; ++i)
+            {
+                apply_matrix3d_mp2(&tmp, &p[i], m);
+                r[i]        = tmp;
+
+                if (min.x > tmp.x)
+                    min.x       = tmp.x;
+                if (min.y > tmp.y)
+                    min.y       = tmp.y;
+                if (min.z > tmp.z)
+                    min.z       = tmp.z;
+                if (max.x < tmp.x)
+                    max.x       = tmp.x;
+                if (max.y < tmp.y)
+                    max.y       = tmp.y;
+                if (max.z < tmp.z)
+                    max.z       = tmp.z;
+            }
+
+            // Build the box in the same order as calc_bound_box() does
+            for (size_t i=0; i<8; ++i)
+            {
+                b->p[i].x   = ((i & 3) == 0) || ((i & 3) == 1) ? min.x : max.x;
+                b->p[i].y   = ((i & 3) == 1) || ((i & 3) == 2) ? min.y : max.y;
+                b->p[i].z   = (i < 4) ? max.z : min.z;
+                b->p[i].w   = r[0].w;
+            }
+        }
+
         float calc_plane_p3(vector3d_t *v, const point3d_t *p0, const point3d_t *p1, const point3d_t *p2)
         {
             // Calculate edge parameters
@@ -3192,7 +3313,7 @@ namespace lsp
 
             v->dx   = p.x - sp->x;
             v->dy   = p.y - sp->y;
-            v->dz   = p.z = sp->z;
+            v->dz   = p.z - sp->z;
             v->dw   = 0.0f;
 
             float   w = sqrtf(v->dx*v->dx + v->dy*v->dy + v->dz*v->dz);
@@ -3215,7 +3336,7 @@ namespace lsp
 
             v->dx   = p.x - sp->x;
             v->dy   = p.y - sp->y;
-            v->dz   = p.z = sp->z;
+            v->dz   = p.z - sp->z;
             v->dw   = 0.0f;
 
             float   w = sqrtf(v->dx*v->dx + v->dy*v->dy + v->dz*v->dz);
@@ -3228,6 +3349,184 @@ namespace lsp
                 v->dw       = 0.0f;
             }
         }
+
+        void points3d_to_soa(const point3d_soa_t *dst, const point3d_t *src, size_t n)
+        {
+            float *x = dst->x, *y = dst->y, *z = dst->z;
+            for (size_t i=0; i<n; ++i, ++src)
+            {
+                x[i]        = src->x;
+                y[i]        = src->y;
+                z[i]        = src->z;
+            }
+        }
+
+        void points3d_from_soa(point3d_t *dst, const point3d_soa_t *src, size_t n)
+        {
+            const float *x = src->x, *y = src->y, *z = src->z;
+            for (size_t i=0; i<n; ++i, ++dst)
+            {
+                dst->x      = x[i];
+                dst->y      = y[i];
+                dst->z      = z[i];
+                dst->w      = 1.0f;
+            }
+        }
+
+        void raw_triangles_to_soa(const raw_triangle_soa_t *dst, const raw_triangle_t *src, size_t n)
+        {
+            for (size_t i=0; i<n; ++i, ++src)
+            {
+                for (size_t j=0; j<3; ++j)
+                {
+                    const point3d_soa_t *v  = &dst->v[j];
+                    v->x[i]         = src->v[j].x;
+                    v->y[i]         = src->v[j].y;
+                    v->z[i]         = src->v[j].z;
+                }
+            }
+        }
+
+        void raw_triangles_from_soa(raw_triangle_t *dst, const raw_triangle_soa_t *src, size_t n)
+        {
+            for (size_t i=0; i<n; ++i, ++dst)
+            {
+                for (size_t j=0; j<3; ++j)
+                {
+                    const point3d_soa_t *v  = &src->v[j];
+                    dst->v[j].x     = v->x[i];
+                    dst->v[j].y     = v->y[i];
+                    dst->v[j].z     = v->z[i];
+                    dst->v[j].w     = 1.0f;
+                }
+            }
+        }
+
+        void calc_distance_soa(float *dst, const point3d_soa_t *p1, const point3d_soa_t *p2, size_t n)
+        {
+            for (size_t i=0; i<n; ++i)
+            {
+                float dx    = p2->x[i] - p1->x[i];
+                float dy    = p2->y[i] - p1->y[i];
+                float dz    = p2->z[i] - p1->z[i];
+                dst[i]      = sqrtf(dx*dx + dy*dy + dz*dz);
+            }
+        }
+
+        void calc_area_soa(float *dst, const raw_triangle_soa_t *t, size_t n)
+        {
+            const point3d_soa_t *p0 = &t->v[0], *p1 = &t->v[1], *p2 = &t->v[2];
+
+            for (size_t i=0; i<n; ++i)
+            {
+                vector3d_t v[2], r;
+                v[0].dx     = p1->x[i] - p0->x[i];
+                v[0].dy     = p1->y[i] - p0->y[i];
+                v[0].dz     = p1->z[i] - p0->z[i];
+
+                v[1].dx     = p2->x[i] - p0->x[i];
+                v[1].dy     = p2->y[i] - p0->y[i];
+                v[1].dz     = p2->z[i] - p0->z[i];
+
+                // Calculate vector multiplication
+                r.dx        = v[0].dy * v[1].dz - v[0].dz * v[1].dy;
+                r.dy        = v[0].dz * v[1].dx - v[0].dx * v[1].dz;
+                r.dz        = v[0].dx * v[1].dy - v[0].dy * v[1].dx;
+
+                dst[i]      = sqrtf(r.dx*r.dx + r.dy*r.dy + r.dz*r.dz);
+            }
+        }
+
+        void calc_normal3d_soa(vector3d_soa_t *dst, const raw_triangle_soa_t *t, size_t n)
+        {
+            const point3d_soa_t *p0 = &t->v[0], *p1 = &t->v[1], *p2 = &t->v[2];
+
+            for (size_t i=0; i<n; ++i)
+            {
+                vector3d_t d[2], r;
+                d[0].dx     = p1->x[i] - p0->x[i];
+                d[0].dy     = p1->y[i] - p0->y[i];
+                d[0].dz     = p1->z[i] - p0->z[i];
+
+                d[1].dx     = p2->x[i] - p1->x[i];
+                d[1].dy     = p2->y[i] - p1->y[i];
+                d[1].dz     = p2->z[i] - p1->z[i];
+
+                // Calculate vector multiplication
+                r.dx        = d[0].dy * d[1].dz - d[0].dz * d[1].dy;
+                r.dy        = d[0].dz * d[1].dx - d[0].dx * d[1].dz;
+                r.dz        = d[0].dx * d[1].dy - d[0].dy * d[1].dx;
+
+                float l     = sqrtf(r.dx*r.dx + r.dy*r.dy + r.dz*r.dz);
+                if (l > 0.0f)
+                {
+                    l           = 1.0f / l;
+                    r.dx       *= l;
+                    r.dy       *= l;
+                    r.dz       *= l;
+                }
+
+                dst->dx[i]  = r.dx;
+                dst->dy[i]  = r.dy;
+                dst->dz[i]  = r.dz;
+            }
+        }
+
+        void colocation_x3_v1_soa(uint32_t *dst, const vector3d_t *pl, const raw_triangle_soa_t *t, size_t n)
+        {
+            const point3d_soa_t *p0 = &t->v[0], *p1 = &t->v[1], *p2 = &t->v[2];
+
+            for (size_t i=0; i<n; ++i)
+            {
+                float k[3];
+
+                k[0]    = p0->x[i] * pl->dx + p0->y[i] * pl->dy + p0->z[i] * pl->dz + pl->dw;
+                k[1]    = p1->x[i] * pl->dx + p1->y[i] * pl->dy + p1->z[i] * pl->dz + pl->dw;
+                k[2]    = p2->x[i] * pl->dx + p2->y[i] * pl->dy + p2->z[i] * pl->dz + pl->dw;
+
+                uint32_t tag    = (k[0] > DSP_3D_TOLERANCE) ? 0x00 : (k[0] < -DSP_3D_TOLERANCE) ? 0x02 : 0x01;
+                tag            |= (k[1] > DSP_3D_TOLERANCE) ? 0x00 : (k[1] < -DSP_3D_TOLERANCE) ? 0x08 : 0x04;
+                tag            |= (k[2] > DSP_3D_TOLERANCE) ? 0x00 : (k[2] < -DSP_3D_TOLERANCE) ? 0x20 : 0x10;
+
+                dst[i]          = tag;
+            }
+        }
+
+        void calc_distance_p1n(float *dst, const point3d_t *sp, const point3d_t *p, size_t n)
+        {
+            for (size_t i=0; i<n; ++i)
+                dst[i]      = calc_distance_p2(sp, &p[i]);
+        }
+
+        void calc_sqr_distance_p1n(float *dst, const point3d_t *sp, const point3d_t *p, size_t n)
+        {
+            for (size_t i=0; i<n; ++i)
+                dst[i]      = calc_sqr_distance_p2(sp, &p[i]);
+        }
+
+        void calc_avg_distance_pvn(float *dst, const point3d_t *sp, const point3d_t *pv, size_t n)
+        {
+            for (size_t i=0; i<n; ++i, pv += 3)
+                dst[i]      = calc_avg_distance_p3(sp, &pv[0], &pv[1], &pv[2]);
+        }
+
+        void unit_vector_p1pvn(vector3d_t *v, const point3d_t *sp, const point3d_t *pv, size_t n)
+        {
+            for (size_t i=0; i<n; ++i, pv += 3)
+                unit_vector_p1pv(&v[i], sp, pv);
+        }
+
+        void calc_oriented_plane_pvn(vector3d_t *v, const point3d_t *sp, const point3d_t *pv, size_t n)
+        {
+            for (size_t i=0; i<n; ++i, pv += 3)
+                calc_oriented_plane_pv(&v[i], sp, pv);
+        }
+
+        void vector_mul_v2n(vector3d_t *r, const vector3d_t *v1, const vector3d_t *v2, size_t n)
+        {
+            for (size_t i=0; i<n; ++i)
+                vector_mul_v2(&r[i], &v1[i], &v2[i]);
+        }
     }
 }
 
@@ -42,6 +42,16 @@ namespace lsp
 //                lsp_warn("DSP context is not empty");
         }
 
+        uint32_t denormal_mode()
+        {
+            return 0;
+        }
+
+        uint32_t denormal_sample()
+        {
+            return 0;
+        }
+
         dsp::info_t *info()
         {
             size_t size     =
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_CQT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_CQT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        typedef struct cqt_kernel_t
+        {
+            double      freq;       // Center frequency
+            size_t      length;     // Length of the window
+            size_t      first;      // First FFT bin
+            size_t      count;      // Number of FFT bins
+        } cqt_kernel_t;
+
+        static void cqt_kernel(cqt_kernel_t *k, const dsp::cqt_params_t *p, size_t index)
+        {
+            size_t fft_size = size_t(1) << p->rank;
+            double q        = 1.0 / (pow(2.0, 1.0 / p->bpo) - 1.0);
+
+            k->freq         = p->fmin * pow(2.0, double(index) / p->bpo);
+            k->length       = q / k->freq + 0.5;
+            if (k->length > fft_size)
+                k->length       = fft_size;
+            else if (k->length < 2)
+                k->length       = 2;
+
+            // Main lobe of the Hann window has width of 4 bins of the window length
+            ssize_t hw      = ceil(2.0 * fft_size / k->length) + 1;
+            ssize_t center  = k->freq * fft_size + 0.5;
+            ssize_t first   = center - hw;
+            ssize_t last    = center + hw;
+            if (first < 0)
+                first           = 0;
+            if (last >= ssize_t(fft_size))
+                last            = fft_size - 1;
+
+            k->first        = first;
+            k->count        = (last >= first) ? last - first + 1 : 0;
+        }
+
+        size_t cqt_bins(const dsp::cqt_params_t *p)
+        {
+            if ((p->bpo == 0) || (p->rank == 0))
+                return 0;
+            if ((p->fmin <= 0.0f) || (p->fmax < p->fmin) || (p->fmin > 0.5f))
+                return 0;
+
+            float fmax      = (p->fmax > 0.5f) ? 0.5f : p->fmax;
+            return size_t(p->bpo * log(double(fmax) / p->fmin) / M_LN2 + 1e-6) + 1;
+        }
+
+        size_t cqt_kernel_size(const dsp::cqt_params_t *p)
+        {
+            cqt_kernel_t k;
+            size_t bins     = dsp::cqt_bins(p);
+            size_t size     = 0;
+
+            for (size_t i=0; i<bins; ++i)
+            {
+                cqt_kernel(&k, p, i);
+                size           += k.count * 2;
+            }
+
+            return size;
+        }
+
+        void cqt_init(dsp::cqt_bin_t *bins, float *kernel, float *tmp, const dsp::cqt_params_t *p)
+        {
+            cqt_kernel_t k;
+            size_t count    = dsp::cqt_bins(p);
+            size_t fft_size = size_t(1) << p->rank;
+            size_t offset   = 0;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                cqt_kernel(&k, p, i);
+
+                // Generate Hann-windowed complex exponential at the center of the frame
+                double sum      = 0.0;
+                double dw       = 2.0 * M_PI / k.length;
+                double df       = 2.0 * M_PI * k.freq;
+                float *dst      = &tmp[(fft_size - k.length) & ~size_t(1)];
+
+                dsp::fill_zero(tmp, fft_size * 2);
+                for (size_t j=0; j<k.length; ++j)
+                {
+                    double w        = 0.5 - 0.5 * cos(dw * j);
+                    dst[j*2]        = w * cos(df * j);
+                    dst[j*2+1]      = w * sin(df * j);
+                    sum            += w;
+                }
+
+                // Compute the spectrum and store the conjugated main lobe
+                dsp::packed_direct_fft(tmp, tmp, p->rank);
+
+                float norm      = 2.0 / (sum * fft_size);
+                const float *src= &tmp[k.first * 2];
+                float *kd       = &kernel[offset];
+                for (size_t j=0; j<k.count; ++j)
+                {
+                    kd[j*2]         = src[j*2] * norm;
+                    kd[j*2+1]       = -src[j*2+1] * norm;
+                }
+
+                bins[i].first   = k.first;
+                bins[i].count   = k.count;
+                bins[i].offset  = offset;
+                bins[i].freq    = k.freq;
+
+                offset         += k.count * 2;
+            }
+        }
+
+        void cqt_apply(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                const dsp::cqt_bin_t *b = &bins[i];
+                const float *x  = &fft[b->first * 2];
+                const float *k  = &kernel[b->offset];
+                float re        = 0.0f;
+                float im        = 0.0f;
+
+                for (size_t j=0; j < b->count; ++j, x += 2, k += 2)
+                {
+                    re             += x[0]*k[0] - x[1]*k[1];
+                    im             += x[0]*k[1] + x[1]*k[0];
+                }
+
+                dst[i]          = sqrtf(re*re + im*im);
+            }
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_CQT_H_ */
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_DYNAMICS_H_
+#define PRIVATE_DSP_ARCH_GENERIC_DYNAMICS_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#define DYNAMICS_BUF_SIZE           0x200
+#define DYNAMICS_GAIN_MIN           -80.0f
+#define DYNAMICS_LEVEL_MIN          -88.0f
+#define DYNAMICS_SIGNAL_MIN         1.17549435e-38f     /* The smallest normalized float */
+
+namespace lsp
+{
+    namespace generic
+    {
+        void envelope_init(dsp::envelope_t *env, float attack, float release)
+        {
+            env->attack     = (attack > 0.0f) ? 1.0f - expf(-1.0f / attack) : 1.0f;
+            env->release    = (release > 0.0f) ? 1.0f - expf(-1.0f / release) : 1.0f;
+            env->env        = 0.0f;
+            env->__pad      = 0.0f;
+        }
+
+        void gain_curve_init(dsp::gain_curve_t *c, float threshold, float ratio, float knee, dsp::gain_curve_type_t type)
+        {
+            float w         = (knee < 1.0f) ? -logf(knee) : 0.0f;
+            if (ratio < 1.0f)
+                ratio           = 1.0f;
+
+            if (type == dsp::GAIN_CURVE_EXPANDER)
+            {
+                c->dir          = -1.0f;
+                c->thresh       = logf(threshold);
+                c->slope        = 1.0f - ratio;
+            }
+            else
+            {
+                c->dir          = 1.0f;
+                c->thresh       = -logf(threshold);
+                c->slope        = 1.0f / ratio - 1.0f;
+            }
+
+            c->knee         = w;
+            c->kscale       = (w > 0.0f) ? 0.25f / w : 0.0f;
+            c->__pad[0]     = 0.0f;
+            c->__pad[1]     = 0.0f;
+            c->__pad[2]     = 0.0f;
+        }
+
+        /**
+         * Follow the envelope of the rectified detector signal
+         * @param dst destination buffer
+         * @param src detector signal
+         * @param env envelope follower state
+         * @param count number of samples
+         */
+        static inline void envelope_follow(float *dst, const float *src, dsp::envelope_t *env, size_t count)
+        {
+            float e = env->env;
+            for (size_t i=0; i<count; ++i)
+            {
+                float d     = src[i] - e;
+                e          += ((d > 0.0f) ? env->attack : env->release) * d;
+                dst[i]      = e;
+            }
+            env->env    = e;
+        }
+
+        void envelope_peak(float *dst, const float *src, dsp::envelope_t *env, size_t count)
+        {
+            float e = env->env;
+            for (size_t i=0; i<count; ++i)
+            {
+                float d     = fabsf(src[i]) - e;
+                e          += ((d > 0.0f) ? env->attack : env->release) * d;
+                dst[i]      = e;
+            }
+            env->env    = e;
+        }
+
+        void envelope_rms(float *dst, const float *src, dsp::envelope_t *env, size_t count)
+        {
+            float e = env->env;
+            for (size_t i=0; i<count; ++i)
+            {
+                float d     = src[i] * src[i] - e;
+                e          += ((d > 0.0f) ? env->attack : env->release) * d;
+                dst[i]      = sqrtf(e);
+            }
+            env->env    = e;
+        }
+
+        void envelope_peak_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count)
+        {
+            for (size_t i=0; i<channels; ++i)
+                envelope_peak(dst[i], src[i], &env[i], count);
+        }
+
+        void envelope_rms_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count)
+        {
+            for (size_t i=0; i<channels; ++i)
+                envelope_rms(dst[i], src[i], &env[i], count);
+        }
+
+        void envelope_peak_linked(float *dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count)
+        {
+            if (channels <= 1)
+            {
+                if (channels > 0)
+                    dsp::envelope_peak(dst, src[0], env, count);
+                return;
+            }
+
+            float buf[DYNAMICS_BUF_SIZE] __lsp_aligned16;
+            for (size_t off=0; off < count; )
+            {
+                size_t to_do    = count - off;
+                if (to_do > DYNAMICS_BUF_SIZE)
+                    to_do           = DYNAMICS_BUF_SIZE;
+
+                // Detector: the loudest channel
+                dsp::pamax3(buf, &src[0][off], &src[1][off], to_do);
+                for (size_t i=2; i<channels; ++i)
+                    dsp::pamax2(buf, &src[i][off], to_do);
+                envelope_follow(&dst[off], buf, env, to_do);
+
+                off            += to_do;
+            }
+        }
+
+        void envelope_rms_linked(float *dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count)
+        {
+            if (channels <= 1)
+            {
+                if (channels > 0)
+                    dsp::envelope_rms(dst, src[0], env, count);
+                return;
+            }
+
+            float buf[DYNAMICS_BUF_SIZE] __lsp_aligned16;
+            float k         = 1.0f / channels;
+            for (size_t off=0; off < count; )
+            {
+                size_t to_do    = count - off;
+                if (to_do > DYNAMICS_BUF_SIZE)
+                    to_do           = DYNAMICS_BUF_SIZE;
+
+                // Detector: the mean power of channels
+                dsp::mul3(buf, &src[0][off], &src[0][off], to_do);
+                for (size_t i=1; i<channels; ++i)
+                    dsp::fmadd3(buf, &src[i][off], &src[i][off], to_do);
+                dsp::mul_k2(buf, k, to_do);
+                envelope_follow(&dst[off], buf, env, to_do);
+                for (size_t i=0; i<to_do; ++i)
+                    dst[off + i]    = sqrtf(dst[off + i]);
+
+                off            += to_do;
+            }
+        }
+
+        void gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count)
+        {
+            float w2        = c->knee * 2.0f;
+            for (size_t i=0; i<count; ++i)
+            {
+                // Soft-knee hinge of the level relative to the threshold
+                float l     = (src[i] >= DYNAMICS_SIGNAL_MIN) ? logf(src[i]) : DYNAMICS_LEVEL_MIN;
+                float s     = c->dir * l + c->thresh;
+                float a     = s + c->knee;
+                a           = (a < 0.0f) ? 0.0f : (a > w2) ? w2 : a;
+                float b     = s - c->knee;
+                b           = (b < 0.0f) ? 0.0f : b;
+
+                float g     = c->slope * (a * a * c->kscale + b);
+                dst[i]      = expf((g < DYNAMICS_GAIN_MIN) ? DYNAMICS_GAIN_MIN : g);
+            }
+        }
+    }
+}
+
+#undef DYNAMICS_LEVEL_MIN
+#undef DYNAMICS_SIGNAL_MIN
+#undef DYNAMICS_GAIN_MIN
+#undef DYNAMICS_BUF_SIZE
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_DYNAMICS_H_ */
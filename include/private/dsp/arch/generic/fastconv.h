@@ -1092,6 +1092,75 @@ namespace lsp
             // Do reverse FFT transformation
             fastconv_restore_internal(dst, tmp, rank);
         }
+
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank + 1);
+            float re[4], im[4];
+
+            for (size_t i=0; i<items; i += 8)
+            {
+                // Complex multiplication and accumulation:
+                // dst' = dst + c1 * c2
+                re[0]           = c1[0] * c2[0] - c1[4] * c2[4];
+                re[1]           = c1[1] * c2[1] - c1[5] * c2[5];
+                re[2]           = c1[2] * c2[2] - c1[6] * c2[6];
+                re[3]           = c1[3] * c2[3] - c1[7] * c2[7];
+
+                im[0]           = c1[0] * c2[4] + c1[4] * c2[0];
+                im[1]           = c1[1] * c2[5] + c1[5] * c2[1];
+                im[2]           = c1[2] * c2[6] + c1[6] * c2[2];
+                im[3]           = c1[3] * c2[7] + c1[7] * c2[3];
+
+                dst[0]         += re[0];
+                dst[1]         += re[1];
+                dst[2]         += re[2];
+                dst[3]         += re[3];
+
+                dst[4]         += im[0];
+                dst[5]         += im[1];
+                dst[6]         += im[2];
+                dst[7]         += im[3];
+
+                dst            += 8;
+                c1             += 8;
+                c2             += 8;
+            }
+        }
+
+        void fastconv_matrix_apply(float * const *dst, float *tmp, const float * const *c, const float * const *src, size_t rank, size_t inputs, size_t outputs)
+        {
+            size_t items    = size_t(1) << (rank + 1);
+            float *acc      = &tmp[inputs * items];
+            float *out      = &acc[items];
+
+            // Parse each input block only once
+            for (size_t i=0; i<inputs; ++i)
+                dsp::fastconv_parse(&tmp[i * items], src[i], rank);
+
+            // Accumulate the spectrum of each output and restore it once
+            for (size_t o=0; o<outputs; ++o, c += inputs)
+            {
+                bool empty      = true;
+                for (size_t i=0; i<inputs; ++i)
+                {
+                    if (c[i] == NULL)
+                        continue;
+                    if (empty)
+                    {
+                        dsp::fill_zero(acc, items);
+                        empty           = false;
+                    }
+                    dsp::fastconv_fmadd(acc, &tmp[i * items], c[i], rank);
+                }
+
+                if (empty)
+                    continue;
+
+                dsp::fastconv_restore(out, acc, rank);
+                dsp::add2(dst[o], out, items >> 1);
+            }
+        }
     }
 }
 
@@ -887,10 +887,10 @@ namespace lsp
                     // s1' = s0 - s1
                     float s1_re     = src[2];
                     float s1_im     = src[3];
-                    dst[2]          = src[0] - s1_re;
-                    dst[3]          = src[1] - s1_im;
-                    dst[0]          = src[0] + s1_re;
-                    dst[1]          = src[1] + s1_im;
+                    dst[2]          = (src[0] - s1_re) * 0.5f;
+                    dst[3]          = (src[1] - s1_im) * 0.5f;
+                    dst[0]          = (src[0] + s1_re) * 0.5f;
+                    dst[1]          = (src[1] + s1_im) * 0.5f;
                 }
                 else
                 {
@@ -1007,6 +1007,30 @@ namespace lsp
             repack_normalize_fft(dst, rank);
         }
 
+        void direct_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+                direct_fft(dst_re[i], dst_im[i], src_re[i], src_im[i], rank);
+        }
+
+        void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+                packed_direct_fft(dst[i], src[i], rank);
+        }
+
+        void reverse_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+                reverse_fft(dst_re[i], dst_im[i], src_re[i], src_im[i], rank);
+        }
+
+        void packed_reverse_fft_batch(float **dst, const float * const *src, size_t rank, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+                packed_reverse_fft(dst[i], src[i], rank);
+        }
+
         static void center_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
         {
             if (rank == 0)
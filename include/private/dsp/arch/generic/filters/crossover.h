@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FILTERS_CROSSOVER_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FILTERS_CROSSOVER_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        // Quality factors of Butterworth sections
+        static const double crossover_q_lr4[]   = { 0.70710678118654752 };
+        static const double crossover_q_lr8[]   = { 0.54119610014619698, 1.3065629648763766 };
+
+        typedef enum crossover_section_t
+        {
+            XOVER_LP,
+            XOVER_HP,
+            XOVER_AP
+        } crossover_section_t;
+
+        typedef struct crossover_builder_t
+        {
+            dsp::crossover_t   *c;
+            const float        *freq;
+            const double       *q;
+            size_t              nq;
+            bool                phase;
+            size_t              len[LSP_DSP_CROSSOVER_MAX_BANDS];
+        } crossover_builder_t;
+
+        static void crossover_add_section(crossover_builder_t *b, size_t band, crossover_section_t type, float freq, double q)
+        {
+            size_t idx          = b->len[band]++;
+            dsp::biquad_x8_t *f = &b->c->stage[idx];
+
+            double f0           = freq;
+            if (f0 < 1e-6)
+                f0                  = 1e-6;
+            else if (f0 > 0.499)
+                f0                  = 0.499;
+
+            // Bilinear transform of the analog prototype with frequency pre-warping
+            double k            = tan(M_PI * f0);
+            double k2           = k * k;
+            double n            = 1.0 / (1.0 + k/q + k2);
+            double a1           = 2.0 * (k2 - 1.0) * n;
+            double a2           = (1.0 - k/q + k2) * n;
+
+            switch (type)
+            {
+                case XOVER_LP:
+                    f->b0[band]         = k2 * n;
+                    f->b1[band]         = 2.0 * k2 * n;
+                    f->b2[band]         = k2 * n;
+                    break;
+                case XOVER_HP:
+                    f->b0[band]         = n;
+                    f->b1[band]         = -2.0 * n;
+                    f->b2[band]         = n;
+                    break;
+                default:
+                    f->b0[band]         = a2;
+                    f->b1[band]         = a1;
+                    f->b2[band]         = 1.0f;
+                    break;
+            }
+
+            // Poles are stored with negative sign as for other biquad filters
+            f->a1[band]         = -a1;
+            f->a2[band]         = -a2;
+        }
+
+        static void crossover_add_filter(crossover_builder_t *b, size_t lo, size_t hi, crossover_section_t type, size_t split)
+        {
+            float freq          = b->freq[split];
+            for (size_t k=lo; k<hi; ++k)
+            {
+                // LP and HP are squared Butterworth filters, AP has the same poles as Butterworth filter
+                if (type == XOVER_AP)
+                {
+                    for (size_t i=0; i<b->nq; ++i)
+                        crossover_add_section(b, k, type, freq, b->q[i]);
+                }
+                else
+                {
+                    for (size_t i=0; i<b->nq*2; ++i)
+                        crossover_add_section(b, k, type, freq, b->q[i % b->nq]);
+                }
+            }
+        }
+
+        static void crossover_build(crossover_builder_t *b, size_t lo, size_t hi)
+        {
+            if ((hi - lo) <= 1)
+                return;
+
+            // Split the bands [lo, hi) at the frequency between bands m-1 and m
+            size_t m            = (lo + hi) >> 1;
+            crossover_add_filter(b, lo, m, XOVER_LP, m - 1);
+            crossover_add_filter(b, m, hi, XOVER_HP, m - 1);
+
+            // Compensate the phase shift of splits in the other branch
+            if (b->phase)
+            {
+                for (size_t j=m; j<hi-1; ++j)
+                    crossover_add_filter(b, lo, m, XOVER_AP, j);
+                for (size_t j=lo; j<m-1; ++j)
+                    crossover_add_filter(b, m, hi, XOVER_AP, j);
+            }
+
+            crossover_build(b, lo, m);
+            crossover_build(b, m, hi);
+        }
+
+        void crossover_reset(dsp::crossover_t *c)
+        {
+            for (size_t i=0; i<LSP_DSP_CROSSOVER_MAX_STAGES * 16; ++i)
+                c->d[i]         = 0.0f;
+        }
+
+        void crossover_init(dsp::crossover_t *c, const dsp::crossover_params_t *p)
+        {
+            size_t bands        = p->bands;
+            if (bands < 1)
+                bands               = 1;
+            else if (bands > LSP_DSP_CROSSOVER_MAX_BANDS)
+                bands               = LSP_DSP_CROSSOVER_MAX_BANDS;
+
+            // Fill all sections with identity filters
+            for (size_t i=0; i<LSP_DSP_CROSSOVER_MAX_STAGES; ++i)
+            {
+                dsp::biquad_x8_t *f = &c->stage[i];
+                for (size_t k=0; k<LSP_DSP_CROSSOVER_MAX_BANDS; ++k)
+                {
+                    f->b0[k]            = 1.0f;
+                    f->b1[k]            = 0.0f;
+                    f->b2[k]            = 0.0f;
+                    f->a1[k]            = 0.0f;
+                    f->a2[k]            = 0.0f;
+                }
+            }
+
+            // Build the tree
+            crossover_builder_t b;
+            b.c                 = c;
+            b.freq              = p->freq;
+            b.q                 = (p->type == dsp::CROSSOVER_LR8) ? crossover_q_lr8 : crossover_q_lr4;
+            b.nq                = (p->type == dsp::CROSSOVER_LR8) ? 2 : 1;
+            b.phase             = p->phase != 0;
+            for (size_t k=0; k<LSP_DSP_CROSSOVER_MAX_BANDS; ++k)
+                b.len[k]            = 0;
+            crossover_build(&b, 0, bands);
+
+            // The number of stages is the length of the longest chain, at least one
+            size_t stages       = 1;
+            for (size_t k=0; k<bands; ++k)
+                stages              = (b.len[k] > stages) ? b.len[k] : stages;
+
+            c->bands            = bands;
+            c->stages           = stages;
+            crossover_reset(c);
+        }
+
+        void crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c)
+        {
+            float x[LSP_DSP_CROSSOVER_MAX_BANDS];
+            size_t bands        = c->bands;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                float s             = src[i];
+                for (size_t k=0; k<bands; ++k)
+                    x[k]                = s;
+
+                float *d            = c->d;
+                for (size_t j=0; j<c->stages; ++j, d += 16)
+                {
+                    const dsp::biquad_x8_t *f = &c->stage[j];
+                    for (size_t k=0; k<bands; ++k)
+                    {
+                        float y             = f->b0[k]*x[k] + d[k];
+                        float p1            = f->b1[k]*x[k] + f->a1[k]*y;
+                        float p2            = f->b2[k]*x[k] + f->a2[k]*y;
+                        d[k]                = d[k + 8] + p1;
+                        d[k + 8]            = p2;
+                        x[k]                = y;
+                    }
+                }
+
+                for (size_t k=0; k<bands; ++k)
+                    dst[k][i]           = x[k];
+            }
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FILTERS_CROSSOVER_H_ */
@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FILTERS_FIR_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FILTERS_FIR_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+/*
+    The kernel is generated by blocks of FIR_BLK_SIZE samples. All harmonic functions are
+    computed by rotating the precomputed table of sin(w*j) and cos(w*j) by the phase of the
+    block:
+
+      sin(w*(i0 + j) + phi) = sin(w*j)*cos(w*i0 + phi) + cos(w*j)*sin(w*i0 + phi)
+      cos(w*(i0 + j) + phi) = cos(w*j)*cos(w*i0 + phi) - sin(w*j)*sin(w*i0 + phi)
+
+    The table itself is built by doubling it's size with the same rotation, so
+    all the work is done by the vectorized dsp:: functions and only a few phases
+    are computed in double precision.
+ */
+
+namespace lsp
+{
+    namespace generic
+    {
+        #define FIR_BLK_SIZE            0x100
+
+        #define FIR_SINC_TERMS          10
+
+        // Taylor series of sin(z)/z as a polynom of z^2 starting with the highest power
+        static const float fir_sinc_taylor[FIR_SINC_TERMS] =
+        {
+            -1.0 / 121645100408832000.0,    // -1/19!
+            1.0 / 355687428096000.0,        // 1/17!
+            -1.0 / 1307674368000.0,         // -1/15!
+            1.0 / 6227020800.0,             // 1/13!
+            -1.0 / 39916800.0,              // -1/11!
+            1.0 / 362880.0,                 // 1/9!
+            -1.0 / 5040.0,                  // -1/7!
+            1.0 / 120.0,                    // 1/5!
+            -1.0 / 6.0,                     // -1/3!
+            1.0                             // 1/1!
+        };
+
+        typedef struct fir_osc_t
+        {
+            float   vsin[FIR_BLK_SIZE];
+            float   vcos[FIR_BLK_SIZE];
+            double  w;
+        } fir_osc_t;
+
+        // dst[j] = sin(w*j + phi)
+        static inline void fir_osc_sin(float *dst, const fir_osc_t *o, double phi, size_t count)
+        {
+            dsp::mul_k3(dst, o->vsin, cos(phi), count);
+            dsp::fmadd_k3(dst, o->vcos, sin(phi), count);
+        }
+
+        // dst[j] = cos(w*j + phi)
+        static inline void fir_osc_cos(float *dst, const fir_osc_t *o, double phi, size_t count)
+        {
+            dsp::mul_k3(dst, o->vcos, cos(phi), count);
+            dsp::fmsub_k3(dst, o->vsin, sin(phi), count);
+        }
+
+        static void fir_osc_init(fir_osc_t *o, double w)
+        {
+            o->w        = w;
+            o->vsin[0]  = 0.0f;
+            o->vcos[0]  = 1.0f;
+
+            for (size_t n=1; n < FIR_BLK_SIZE; n <<= 1)
+            {
+                fir_osc_sin(&o->vsin[n], o, w * n, n);
+                fir_osc_cos(&o->vcos[n], o, w * n, n);
+            }
+        }
+
+        // Get the highest bit of the value
+        static inline size_t fir_pow_mask(size_t value)
+        {
+            size_t mask = 1;
+            while ((mask << 1) <= value)
+                mask  <<= 1;
+            return mask;
+        }
+
+        // Polynom coefficients of cosine-sum windows expressed as a polynom of cos(2*pi*i/(N-1))
+        static void fir_window_poly(float *k, size_t method)
+        {
+            double a0, a1, a2, a3;
+
+            switch (method)
+            {
+                case dsp::FIR_HANN:             a0 = 0.5;       a1 = 0.5;       a2 = 0.0;       a3 = 0.0;       break;
+                case dsp::FIR_HAMMING:          a0 = 0.54;      a1 = 0.46;      a2 = 0.0;       a3 = 0.0;       break;
+                case dsp::FIR_BLACKMAN:         a0 = 0.42;      a1 = 0.5;       a2 = 0.08;      a3 = 0.0;       break;
+                case dsp::FIR_BLACKMAN_HARRIS:  a0 = 0.35875;   a1 = 0.48829;   a2 = 0.14128;   a3 = 0.01168;   break;
+                default:                        a0 = 1.0;       a1 = 0.0;       a2 = 0.0;       a3 = 0.0;       break;
+            }
+
+            // cos(2t) = 2*cos(t)^2 - 1, cos(3t) = 4*cos(t)^3 - 3*cos(t)
+            k[0]        = a0 - a2;
+            k[1]        = 3.0 * a3 - a1;
+            k[2]        = 2.0 * a2;
+            k[3]        = -4.0 * a3;
+        }
+
+        /**
+         * Design linear-phase kernel of odd or even length without spectral inversion
+         */
+        static void fir_design_kernel(float *dst, const dsp::fir_params_t *p, size_t count)
+        {
+            fir_osc_t o1, o2, ow;
+            float vx[FIR_BLK_SIZE], vt[FIR_BLK_SIZE], vw[FIR_BLK_SIZE];
+            float wk[4];
+
+            bool band       = (p->type == dsp::FIR_BANDPASS) || (p->type == dsp::FIR_BANDSTOP);
+            bool hilbert    = p->type == dsp::FIR_HILBERT;
+            bool lsq        = p->method == dsp::FIR_LSQ;
+            bool window     = (!lsq) && (p->method != dsp::FIR_RECTANGULAR) && (count > 1);
+            double center   = (count - 1) * 0.5;
+            double f1       = p->f1;
+            double f2       = p->f2;
+            if ((band) && (f1 > f2))
+            {
+                f1              = p->f2;
+                f2              = p->f1;
+            }
+
+            // Value of the kernel at the center point
+            double hc       = (hilbert) ? 0.0 : (band) ? 2.0 * (f2 - f1) : 2.0 * f1;
+
+            // Initialize oscillators
+            if (!hilbert)
+            {
+                fir_osc_init(&o1, 2.0 * M_PI * f1);
+                if (band)
+                    fir_osc_init(&o2, 2.0 * M_PI * f2);
+            }
+
+            size_t order    = 0;
+            if (lsq)
+            {
+                order           = 0.62 * count * p->transition + 0.5;
+                if (order < 1)
+                    order           = 1;
+                ow.w            = M_PI * p->transition / order;
+            }
+            else if (window)
+            {
+                fir_window_poly(wk, p->method);
+                fir_osc_init(&ow, 2.0 * M_PI / (count - 1));
+            }
+
+            for (size_t i0=0; i0 < count; i0 += FIR_BLK_SIZE)
+            {
+                size_t n        = count - i0;
+                if (n > FIR_BLK_SIZE)
+                    n               = FIR_BLK_SIZE;
+                float *h        = &dst[i0];
+                double x0       = i0 - center;
+
+                for (size_t j=0; j<n; ++j)
+                    vx[j]           = x0 + j;
+
+                // Compute numerator
+                if (hilbert)
+                {
+                    // 1 - cos(pi*x) for integer x
+                    for (size_t j=0; j<n; ++j)
+                        h[j]            = ((i0 + j + (count >> 1)) & 1) ? 2.0f : 0.0f;
+                }
+                else
+                {
+                    fir_osc_sin(h, &o1, o1.w * x0, n);
+                    if (band)
+                    {
+                        fir_osc_sin(vt, &o2, o2.w * x0, n);
+                        dsp::sub3(h, vt, h, n);
+                    }
+                }
+
+                // Divide by pi*x
+                dsp::div2(h, vx, n);
+                dsp::mul_k2(h, M_1_PI, n);
+
+                // Apply window or spline transition
+                if (lsq)
+                {
+                    // (sin(a*x)/(a*x))^p, the argument is less than pi/1.24 for p > 1 and
+                    // less than 3.8 for p = 1 so the Taylor series give good relative
+                    // precision near zero where sin(a*x) computed by the oscillator does not
+                    dsp::mul_k3(vt, vx, ow.w, n);
+                    dsp::mul2(vt, vt, n);
+                    dsp::mul_k3(vw, vt, fir_sinc_taylor[0], n);
+                    for (size_t k=1; k<FIR_SINC_TERMS; ++k)
+                    {
+                        dsp::add_k2(vw, fir_sinc_taylor[k], n);
+                        if (k < (FIR_SINC_TERMS - 1))
+                            dsp::mul2(vw, vt, n);
+                    }
+
+                    // Raise to the power of p by squaring
+                    dsp::copy(vt, vw, n);
+                    for (size_t k=fir_pow_mask(order) >> 1; k > 0; k >>= 1)
+                    {
+                        dsp::mul2(vw, vw, n);
+                        if (order & k)
+                            dsp::mul2(vw, vt, n);
+                    }
+                    dsp::mul2(h, vw, n);
+                }
+                else if (window)
+                {
+                    // Compute polynom of cos(2*pi*i/(N-1))
+                    fir_osc_cos(vt, &ow, ow.w * i0, n);
+                    dsp::mul_k3(vw, vt, wk[3], n);
+                    dsp::add_k2(vw, wk[2], n);
+                    dsp::mul2(vw, vt, n);
+                    dsp::add_k2(vw, wk[1], n);
+                    dsp::mul2(vw, vt, n);
+                    dsp::add_k2(vw, wk[0], n);
+                    dsp::mul2(h, vw, n);
+                }
+
+                // Patch the center point
+                if ((count & 1) && (i0 <= center) && (center < i0 + n))
+                {
+                    size_t j        = size_t(center) - i0;
+                    h[j]            = (window) ? hc * vw[j] : hc;
+                }
+            }
+        }
+
+        void fir_design(float *dst, const dsp::fir_params_t *p, size_t count)
+        {
+            if (count <= 0)
+                return;
+
+            // High-pass, band-stop and Hilbert require odd number of taps
+            bool invert     = (p->type == dsp::FIR_HIGHPASS) || (p->type == dsp::FIR_BANDSTOP);
+            if ((invert) || (p->type == dsp::FIR_HILBERT))
+            {
+                if (!(count & 1))
+                    dst[--count]    = 0.0f;
+                if (count <= 0)
+                    return;
+            }
+
+            fir_design_kernel(dst, p, count);
+
+            // Normalize the gain at zero frequency
+            if ((p->type == dsp::FIR_LOWPASS) || (p->type == dsp::FIR_HIGHPASS))
+            {
+                float sum       = dsp::h_sum(dst, count);
+                if (sum != 0.0f)
+                    dsp::mul_k2(dst, 1.0f / sum, count);
+            }
+
+            // Perform spectral inversion
+            if (invert)
+            {
+                dsp::mul_k2(dst, -1.0f, count);
+                dst[count >> 1]    += 1.0f;
+            }
+        }
+
+        void fir_design_fastconv(float *dst, const dsp::fir_params_t *p, size_t count, size_t rank)
+        {
+            if (rank < 3)
+                return;
+
+            size_t half     = size_t(1) << (rank - 1);
+            if (count > half)
+                count           = half;
+
+            // Design the kernel into the last quarter of the buffer: fastconv_parse() reads each
+            // block of source samples before it writes the two times larger block of the output
+            // at the same relative position, so the source is never overwritten before it is read
+            float *h        = &dst[half * 3];
+            dsp::fir_design(h, p, count);
+            dsp::fill_zero(&h[count], half - count);
+            dsp::fastconv_parse(dst, h, rank);
+        }
+
+        #undef FIR_SINC_TERMS
+        #undef FIR_BLK_SIZE
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FILTERS_FIR_H_ */
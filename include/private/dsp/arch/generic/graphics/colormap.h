@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_GRAPHICS_COLORMAP_H_
+#define PRIVATE_DSP_ARCH_GENERIC_GRAPHICS_COLORMAP_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count)
+        {
+            const uint32_t *l   = reinterpret_cast<const uint32_t *>(lut);
+            uint32_t *d         = reinterpret_cast<uint32_t *>(dst);
+
+            // The index is computed as k * log2(|src|) + b, 0.5 is added for rounding
+            float range         = 255.0f / (dbmax - dbmin);
+            float k             = 6.02059991f * range;         // 20 * log10(2) dB per octave
+            float b             = 0.5f - dbmin * range;
+
+            union { float f; uint32_t i; } v;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                // Take absolute value, replace denormals, zeros and NaNs with FLT_MIN
+                v.f             = src[i];
+                v.i            &= 0x7fffffff;
+                if ((v.i < 0x00800000) || (v.i > 0x7f800000))
+                    v.i             = 0x00800000;
+
+                // log2(x) = E + log2(1 + M), log2(1 + M) ~ M*(C1 + M*(C2 + M*C3)), P(0) = 0, P(1) = 1
+                float e         = int32_t(v.i >> 23) - 127;
+                v.i             = (v.i & 0x007fffff) | 0x3f800000;
+                float m         = v.f - 1.0f;
+                float p         = m * 0.159213066f;
+                p              += -0.582073808f;
+                p              *= m;
+                p              += 1.42286074f;
+                p              *= m;
+                e              += p;
+
+                // Compute the index and store the pixel
+                float x         = e * k;
+                x              += b;
+                x               = (x > 0.0f) ? x : 0.0f;
+                x               = (x < 255.0f) ? x : 255.0f;
+                d[i]            = l[size_t(x)];
+            }
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_GRAPHICS_COLORMAP_H_ */
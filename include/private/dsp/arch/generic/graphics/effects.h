@@ -128,6 +128,154 @@ namespace lsp
                 }
             }
         }
+
+        /*
+         * Fused effects rely on the fact that HSL->RGB conversion can be written as:
+         *   R = T1 + (T2 - T1) * W(H + 1/3)
+         *   G = T1 + (T2 - T1) * W(H)
+         *   B = T1 + (T2 - T1) * W(H - 1/3)
+         * where W(t) = min(max(min(6*t, 4 - 6*t), 0), 1), T2 - L = L - T1 = S * min(L, 1 - L),
+         * so only the varying components of HSLA have to be computed for each pixel.
+         */
+        static inline float eff_hsla_weight(float t)
+        {
+            float k     = 6.0f * t;
+            float r     = 4.0f - k;
+            k           = (k < r) ? k : r;
+            k           = (k > 0.0f) ? k : 0.0f;
+            return (k < 1.0f) ? k : 1.0f;
+        }
+
+        static inline void eff_hsla_weights(float *w, float h)
+        {
+            float tr    = h + HSL_RGB_1_3;
+            float tb    = h - HSL_RGB_1_3;
+            if (tr > 1.0f)
+                tr         -= 1.0f;
+            if (tb < 0.0f)
+                tb         += 1.0f;
+
+            w[0]        = eff_hsla_weight(tr);
+            w[1]        = eff_hsla_weight(h);
+            w[2]        = eff_hsla_weight(tb);
+        }
+
+        static inline void eff_hsla_pixel(uint8_t *p, float t1, float d, const float *w, float a)
+        {
+            float A     = 255.0f - a * 255.0f;
+            float R     = (t1 + d * w[0]) * A;
+            float G     = (t1 + d * w[1]) * A;
+            float B     = (t1 + d * w[2]) * A;
+
+            // Saturate and store
+            p[0]        = (B > 0.0f) ? ((B < 255.0f) ? B : 255.0f) : 0.0f;
+            p[1]        = (G > 0.0f) ? ((G < 255.0f) ? G : 255.0f) : 0.0f;
+            p[2]        = (R > 0.0f) ? ((R < 255.0f) ? R : 255.0f) : 0.0f;
+            p[3]        = (A > 0.0f) ? ((A < 255.0f) ? A : 255.0f) : 0.0f;
+        }
+
+        void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count)
+        {
+            uint8_t *p  = reinterpret_cast<uint8_t *>(dst);
+            float value, hue, alpha, w[3];
+            float t     = 1.0f - eff->thresh;
+            float kt    = 1.0f / eff->thresh;
+            float x     = eff->s * ((eff->l < HSL_RGB_0_5) ? eff->l : 1.0f - eff->l);
+            float t1    = eff->l - x;
+            float d     = x + x;
+
+            for (size_t i=0; i<count; ++i, p += 4)
+            {
+                value   = v[i];
+                value   = (value >= 0.0f) ? 1.0f - value : 1.0f + value;
+
+                if (value < t)
+                {
+                    hue         = eff->h + value;
+                    alpha       = 0.0f;
+                }
+                else
+                {
+                    hue         = eff->h + t;
+                    alpha       = ((value - t) * kt);
+                }
+
+                eff_hsla_weights(w, (hue > 1.0f) ? hue - 1.0f : hue);
+                eff_hsla_pixel(p, t1, d, w, alpha);
+            }
+        }
+
+        void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count)
+        {
+            uint8_t *p  = reinterpret_cast<uint8_t *>(dst);
+            float value, w[3];
+            float x     = eff->s * ((eff->l < HSL_RGB_0_5) ? eff->l : 1.0f - eff->l);
+            float t1    = eff->l - x;
+            float d     = x + x;
+            eff_hsla_weights(w, eff->h);
+
+            for (size_t i=0; i<count; ++i, p += 4)
+            {
+                value   = v[i];
+                value   = (value >= 0.0f) ? 1.0f - value : 1.0f + value;
+
+                eff_hsla_pixel(p, t1, d, w, value);
+            }
+        }
+
+        void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count)
+        {
+            uint8_t *p  = reinterpret_cast<uint8_t *>(dst);
+            float value, x, w[3];
+            float kt    = 1.0f / eff->thresh;
+            float ms    = eff->s * ((eff->l < HSL_RGB_0_5) ? eff->l : 1.0f - eff->l);
+            eff_hsla_weights(w, eff->h);
+
+            for (size_t i=0; i<count; ++i, p += 4)
+            {
+                value   = v[i];
+                value   = (value >= 0.0f) ? value : -value;
+
+                if (value >= eff->thresh)
+                {
+                    x           = value * ms;
+                    eff_hsla_pixel(p, eff->l - x, x + x, w, 0.0f);
+                }
+                else
+                {
+                    x           = eff->thresh * ms;
+                    eff_hsla_pixel(p, eff->l - x, x + x, w, (eff->thresh - value) * kt);
+                }
+            }
+        }
+
+        void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count)
+        {
+            uint8_t *p  = reinterpret_cast<uint8_t *>(dst);
+            float value, l, alpha, x, w[3];
+            float kt    = 1.0f / eff->thresh;
+            eff_hsla_weights(w, eff->h);
+
+            for (size_t i=0; i<count; ++i, p += 4)
+            {
+                value   = v[i];
+                value   = (value >= 0.0f) ? value : -value;
+
+                if (value >= eff->thresh)
+                {
+                    l           = eff->l * value;
+                    alpha       = 0.0f;
+                }
+                else
+                {
+                    l           = eff->l * eff->thresh;
+                    alpha       = (eff->thresh - value) * kt;
+                }
+
+                x       = eff->s * ((l < HSL_RGB_0_5) ? l : 1.0f - l);
+                eff_hsla_pixel(p, l - x, x + x, w, alpha);
+            }
+        }
     }
 }
 
@@ -44,6 +44,13 @@ namespace lsp
 
         void smooth_cubic_log(float *dst, float start, float stop, size_t count)
         {
+            // The logarithmic scale requires non-zero values of the same sign
+            if (start * stop <= 0.0f)
+            {
+                smooth_cubic_linear(dst, start, stop, count);
+                return;
+            }
+
             float dy = logf(stop/start);
             float nx = 1.0f / (count + 1); // Normalizing x
 
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_HMATH_HCSUM_H_
+#define PRIVATE_DSP_ARCH_GENERIC_HMATH_HCSUM_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /* Kahan summation step: the compensation c keeps the low-order part lost by s */
+        #define HCSUM_KAHAN(s, c, x) \
+        { \
+            float y         = (x) - c; \
+            float t         = s + y; \
+            c               = (t - s) - y; \
+            s               = t; \
+        }
+
+        float h_csum(const float *src, size_t count)
+        {
+            float s = 0.0f, c = 0.0f;
+            for (size_t i=0; i<count; ++i)
+                HCSUM_KAHAN(s, c, src[i]);
+            return s;
+        }
+
+        float h_sqr_csum(const float *src, size_t count)
+        {
+            float s = 0.0f, c = 0.0f;
+            for (size_t i=0; i<count; ++i)
+                HCSUM_KAHAN(s, c, src[i] * src[i]);
+            return s;
+        }
+
+        float h_abs_csum(const float *src, size_t count)
+        {
+            float s = 0.0f, c = 0.0f;
+            for (size_t i=0; i<count; ++i)
+                HCSUM_KAHAN(s, c, fabsf(src[i]));
+            return s;
+        }
+
+        float h_cdotp(const float *a, const float *b, size_t count)
+        {
+            float s = 0.0f, c = 0.0f;
+            for (size_t i=0; i<count; ++i)
+                HCSUM_KAHAN(s, c, a[i] * b[i]);
+            return s;
+        }
+
+        #undef HCSUM_KAHAN
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_HMATH_HCSUM_H_ */
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_INTERPOLATION_DELAY_H_
+#define PRIVATE_DSP_ARCH_GENERIC_INTERPOLATION_DELAY_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        void delay_init(float *buf, dsp::delay_t *d, size_t rank)
+        {
+            size_t size     = size_t(1) << rank;
+            d->mask         = size - 1;
+            d->head         = 0;
+
+            for (size_t i=0; i < size + LSP_DSP_DELAY_GUARD; ++i)
+                buf[i]          = 0.0f;
+        }
+
+        void delay_write(float *buf, dsp::delay_t *d, const float *src, size_t count)
+        {
+            const uint32_t mask = d->mask;
+            uint32_t head       = d->head;
+
+            while (count > 0)
+            {
+                // Write the contiguous part of the ring
+                uint32_t off        = head & mask;
+                size_t n            = mask + 1 - off;
+                if (n > count)
+                    n                   = count;
+                for (size_t i=0; i<n; ++i)
+                    buf[off + i]        = src[i];
+
+                // Update the mirrored guard zone, rings shorter than the guard are repeated in it
+                if (off < LSP_DSP_DELAY_GUARD)
+                {
+                    size_t k            = LSP_DSP_DELAY_GUARD - off;
+                    if (k > n)
+                        k                   = n;
+                    for (size_t i=0; i<k; ++i)
+                        for (size_t j=off + i; j < LSP_DSP_DELAY_GUARD; j += mask + 1)
+                            buf[mask + 1 + j]   = src[i];
+                }
+
+                head               += n;
+                src                += n;
+                count              -= n;
+            }
+
+            d->head         = head;
+        }
+
+        /*
+         * The interpolation is computed over 4 points x[k-1] .. x[k+2], for the
+         * delay line buf[j] = x[k-1]. Cubic interpolators share the same form:
+         *   h  = 0.5 * (x[k+1] - x[k-1])
+         *   q  = 0.5 * (x[k-1] + x[k+1]) - x[k]
+         *   c3 = K1 * (x[k+2] - x[k-1]) + K2 * (x[k] - x[k+1])
+         *   hermite:  K1 = 1/2, K2 = 3/2, c1 = h,      c2 = q - c3
+         *   lagrange: K1 = 1/6, K2 = 1/2, c1 = h - c3, c2 = q
+         *   y  = ((c3*f + c2)*f + c1)*f + x[k]
+         */
+        #define DELAY_READ_LOOP(INTERP) \
+            const uint32_t mask     = d->mask; \
+            const uint32_t start    = d->head - count - 1; \
+            for (size_t i=0; i<count; ++i) \
+            { \
+                float p             = float(i) - delay[i]; \
+                float t             = floorf(p); \
+                float f             = p - t; \
+                const float *x      = &buf[(start + int32_t(t)) & mask]; \
+                INTERP; \
+            }
+
+        void delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            DELAY_READ_LOOP(
+                dst[i]              = x[1] + (x[2] - x[1]) * f
+            );
+        }
+
+        void delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            DELAY_READ_LOOP(
+                float h             = (x[2] - x[0]) * 0.5f;
+                float q             = (x[0] + x[2]) * 0.5f - x[1];
+                float c3            = (x[3] - x[0]) * 0.5f + (x[1] - x[2]) * 1.5f;
+                float c2            = q - c3;
+                dst[i]              = ((c3 * f + c2) * f + h) * f + x[1]
+            );
+        }
+
+        void delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            DELAY_READ_LOOP(
+                float h             = (x[2] - x[0]) * 0.5f;
+                float q             = (x[0] + x[2]) * 0.5f - x[1];
+                float c3            = (x[3] - x[0]) * (1.0f/6.0f) + (x[1] - x[2]) * 0.5f;
+                float c1            = h - c3;
+                dst[i]              = ((c3 * f + q) * f + c1) * f + x[1]
+            );
+        }
+
+        void delay_read_allpass(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, float *state, size_t count)
+        {
+            float y                 = *state;
+            DELAY_READ_LOOP(
+                float e             = f / (2.0f - f);
+                y                   = x[1] + (x[2] - y) * e;
+                dst[i]              = y
+            );
+            *state                  = y;
+        }
+
+        #undef DELAY_READ_LOOP
+
+        /**
+         * Compute weights of the 4 points x[k-1] .. x[k+2] of the tap
+         * @param w weights of points
+         * @param tap tap descriptor
+         * @return offset of the x[k-1] point relative to the sample being read
+         */
+        static int32_t delay_tap_weights(float *w, const dsp::delay_tap_t *tap)
+        {
+            float p             = -tap->delay;
+            float t             = floorf(p);
+            float f             = p - t;
+            float g             = tap->gain;
+
+            switch (tap->interp)
+            {
+                case dsp::DELAY_HERMITE:
+                {
+                    float f2            = f * f;
+                    float f3            = f2 * f;
+                    w[0]                = (-0.5f*f3 + f2 - 0.5f*f) * g;
+                    w[1]                = (1.5f*f3 - 2.5f*f2 + 1.0f) * g;
+                    w[2]                = (-1.5f*f3 + 2.0f*f2 + 0.5f*f) * g;
+                    w[3]                = (0.5f*f3 - 0.5f*f2) * g;
+                    break;
+                }
+                case dsp::DELAY_LAGRANGE:
+                {
+                    float fp            = f + 1.0f;
+                    float fm            = f - 1.0f;
+                    float fm2           = f - 2.0f;
+                    w[0]                = (-f * fm * fm2 * (1.0f/6.0f)) * g;
+                    w[1]                = (fp * fm * fm2 * 0.5f) * g;
+                    w[2]                = (-fp * f * fm2 * 0.5f) * g;
+                    w[3]                = (fp * f * fm * (1.0f/6.0f)) * g;
+                    break;
+                }
+                default:
+                    w[0]                = 0.0f;
+                    w[1]                = (1.0f - f) * g;
+                    w[2]                = f * g;
+                    w[3]                = 0.0f;
+                    break;
+            }
+
+            return int32_t(t) - 1;
+        }
+
+        void delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count)
+        {
+            float w[4];
+            const uint32_t mask     = d->mask;
+            const uint32_t start    = d->head - count;
+
+            for (size_t i=0; i<count; ++i)
+                dst[i]                  = 0.0f;
+
+            for (size_t k=0; k<ntaps; ++k)
+            {
+                uint32_t j              = start + delay_tap_weights(w, &taps[k]);
+                for (size_t i=0; i<count; ++i, ++j)
+                {
+                    const float *x          = &buf[j & mask];
+                    dst[i]                 += ((x[0]*w[0] + x[1]*w[1]) + x[2]*w[2]) + x[3]*w[3];
+                }
+            }
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_INTERPOLATION_DELAY_H_ */
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_INTERPOLATION_RAMP_H_
+#define PRIVATE_DSP_ARCH_GENERIC_INTERPOLATION_RAMP_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        typedef struct ramp_params_t
+        {
+            float       x;          // Position of the first sample
+            float       k;          // Normalizing multiplier: 1 / length
+            float       a;          // Start value
+            float       b;          // Difference between stop and start values or logarithm of their ratio
+            uint32_t    shape;      // Effective shape of the ramp
+        } ramp_params_t;
+
+        /**
+         * Prepare parameters for the next portion of the ramp and advance the ramp
+         * @param p parameters to initialize
+         * @param r ramp descriptor
+         * @param count number of samples requested
+         * @return number of samples that belong to the ramp, the rest should be processed with the stop value
+         */
+        static size_t ramp_init(ramp_params_t *p, dsp::ramp_t *r, size_t count)
+        {
+            if (r->offset >= r->length)
+                return 0;
+            size_t n        = r->length - r->offset;
+            if (n > count)
+                n               = count;
+
+            p->x            = r->offset;
+            p->k            = 1.0f / r->length;
+            p->a            = r->start;
+            p->shape        = r->shape;
+            if ((p->shape == dsp::RAMP_EXP) || (p->shape == dsp::RAMP_LOG))
+            {
+                if (r->start * r->stop > 0.0f)
+                    p->b            = logf(r->stop / r->start);
+                else
+                    p->shape        = (p->shape == dsp::RAMP_EXP) ? dsp::RAMP_LINEAR : dsp::RAMP_CUBIC;
+            }
+            if ((p->shape != dsp::RAMP_EXP) && (p->shape != dsp::RAMP_LOG))
+                p->b            = r->stop - r->start;
+
+            r->offset      += n;
+            return n;
+        }
+
+        static inline float ramp_value(const ramp_params_t *p, size_t i)
+        {
+            float x = (p->x + i) * p->k;
+
+            switch (p->shape)
+            {
+                case dsp::RAMP_CUBIC:
+                    return p->a + p->b * x*x * (3.0f - 2.0f * x);
+                case dsp::RAMP_EXP:
+                    return p->a * expf(p->b * x);
+                case dsp::RAMP_LOG:
+                    return p->a * expf(p->b * x*x * (3.0f - 2.0f * x));
+                default:
+                    break;
+            }
+
+            return p->a + p->b * x;
+        }
+
+        void ramp_set(float *dst, dsp::ramp_t *r, size_t count)
+        {
+            ramp_params_t p;
+            size_t n    = ramp_init(&p, r, count);
+
+            for (size_t i=0; i<n; ++i)
+                dst[i]      = ramp_value(&p, i);
+            for (size_t i=n; i<count; ++i)
+                dst[i]      = r->stop;
+        }
+
+        void ramp_mul2(float *dst, dsp::ramp_t *r, size_t count)
+        {
+            ramp_params_t p;
+            size_t n    = ramp_init(&p, r, count);
+
+            for (size_t i=0; i<n; ++i)
+                dst[i]     *= ramp_value(&p, i);
+            for (size_t i=n; i<count; ++i)
+                dst[i]     *= r->stop;
+        }
+
+        void ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count)
+        {
+            ramp_params_t p;
+            size_t n    = ramp_init(&p, r, count);
+
+            for (size_t i=0; i<n; ++i)
+                dst[i]      = src[i] * ramp_value(&p, i);
+            for (size_t i=n; i<count; ++i)
+                dst[i]      = src[i] * r->stop;
+        }
+
+        void ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count)
+        {
+            ramp_params_t p;
+            size_t n    = ramp_init(&p, r, count);
+
+            for (size_t i=0; i<n; ++i)
+                dst[i]     += src[i] * ramp_value(&p, i);
+            for (size_t i=n; i<count; ++i)
+                dst[i]     += src[i] * r->stop;
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_INTERPOLATION_RAMP_H_ */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IR_H_
+#define PRIVATE_DSP_ARCH_GENERIC_IR_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        static void ir_kernel_phase(double *dst, double f)
+        {
+            double sum      = 0.0;
+            double hw       = LSP_DSP_IR_POINTS / 2;
+
+            for (size_t j=0; j<LSP_DSP_IR_POINTS; ++j)
+            {
+                double x        = double(j) - (hw - 1) - f;
+                double s        = (fabs(x) < 1e-12) ? 1.0 : sin(M_PI * x) / (M_PI * x);
+                double a        = M_PI * x / hw;
+                double w        = 0.42 + 0.5 * cos(a) + 0.08 * cos(2.0 * a);
+                dst[j]          = s * w;
+                sum            += dst[j];
+            }
+
+            for (size_t j=0; j<LSP_DSP_IR_POINTS; ++j)
+                dst[j]         /= sum;
+        }
+
+        void ir_kernel_init(float *kernel)
+        {
+            double curr[LSP_DSP_IR_POINTS], next[LSP_DSP_IR_POINTS];
+
+            ir_kernel_phase(curr, 0.0);
+            for (size_t i=0; i<LSP_DSP_IR_PHASES; ++i, kernel += LSP_DSP_IR_POINTS * 2)
+            {
+                ir_kernel_phase(next, double(i + 1) / LSP_DSP_IR_PHASES);
+                for (size_t j=0; j<LSP_DSP_IR_POINTS; ++j)
+                {
+                    kernel[j]                       = curr[j];
+                    kernel[j + LSP_DSP_IR_POINTS]   = next[j] - curr[j];
+                    curr[j]                         = next[j];
+                }
+            }
+        }
+
+        static inline size_t ir_tap_block(const dsp::ir_tap_t *t, size_t length)
+        {
+            if (!(t->position > 0.0f))
+                return 0;
+            size_t pos      = (t->position < float(length)) ? size_t(t->position) : length;
+            return pos >> LSP_DSP_IR_BLOCK_RANK;
+        }
+
+        void ir_bin_taps(dsp::ir_tap_t *dst, const dsp::ir_tap_t *src, uint32_t *bins, size_t count, size_t length)
+        {
+            size_t nbins    = ((length + (1 << LSP_DSP_IR_BLOCK_RANK) - 1) >> LSP_DSP_IR_BLOCK_RANK) + 1;
+
+            // Count taps in each block and compute offsets of blocks
+            for (size_t i=0; i<nbins; ++i)
+                bins[i]         = 0;
+            for (size_t i=0; i<count; ++i)
+                ++bins[ir_tap_block(&src[i], length)];
+            for (size_t i=0, offset=0; i<nbins; ++i)
+            {
+                size_t n        = bins[i];
+                bins[i]         = offset;
+                offset         += n;
+            }
+
+            // Scatter taps
+            for (size_t i=0; i<count; ++i)
+                dst[bins[ir_tap_block(&src[i], length)]++] = src[i];
+        }
+
+        void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length)
+        {
+            const ssize_t hw    = LSP_DSP_IR_POINTS / 2;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                const dsp::ir_tap_t *t  = &taps[i];
+
+                // Skip taps that do not touch the buffer
+                float p         = t->position;
+                if (!((p > float(-hw)) && (p < float(length + hw - 1))))
+                    continue;
+
+                // Compute the table row and the interpolation factor
+                ssize_t k       = floorf(p);
+                float u         = (p - k) * LSP_DSP_IR_PHASES;
+                ssize_t ph      = u;
+                if (ph >= LSP_DSP_IR_PHASES)
+                    ph              = LSP_DSP_IR_PHASES - 1;
+                float f         = u - ph;
+                const float *c  = &kernel[ph * LSP_DSP_IR_POINTS * 2];
+
+                // Clip the kernel at the edges of the buffer
+                ssize_t first   = k - (hw - 1);
+                size_t j        = (first < 0) ? -first : 0;
+                size_t last     = (first + LSP_DSP_IR_POINTS > ssize_t(length)) ? length - first : LSP_DSP_IR_POINTS;
+                float *d        = &dst[first];
+
+                for (; j < last; ++j)
+                    d[j]           += t->gain * (c[j] + c[j + LSP_DSP_IR_POINTS] * f);
+            }
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IR_H_ */
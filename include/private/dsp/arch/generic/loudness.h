@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_LOUDNESS_H_
+#define PRIVATE_DSP_ARCH_GENERIC_LOUDNESS_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#define LOUDNESS_OFFSET             -0.691f
+#define LOUDNESS_ABS_GATE           -70.0f
+#define LOUDNESS_INT_GATE           -10.0f
+#define LOUDNESS_LRA_GATE           -20.0f
+#define LOUDNESS_LRA_LOW            0.10f
+#define LOUDNESS_LRA_HIGH           0.95f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void loudness_reset(dsp::loudness_t *l)
+        {
+            for (size_t i=0; i<4 * LSP_DSP_LOUDNESS_MAX_CHANNELS; ++i)
+                l->d[i]         = 0.0f;
+            for (size_t i=0; i<LSP_DSP_LOUDNESS_MAX_CHANNELS; ++i)
+                l->ms[i]        = 0.0f;
+            for (size_t i=0; i<LSP_DSP_LOUDNESS_SHORT_BLOCKS; ++i)
+                l->power[i]     = 0.0f;
+            for (size_t i=0; i<LSP_DSP_LOUDNESS_HIST_BINS; ++i)
+            {
+                l->hist_i[i]    = 0;
+                l->hist_s[i]    = 0;
+            }
+
+            l->offset       = 0;
+            l->head         = 0;
+            l->blocks       = 0;
+        }
+
+        void loudness_init(dsp::loudness_t *l, size_t channels, size_t sample_rate)
+        {
+            // High-shelf stage of K-weighting filter
+            double k        = tan(M_PI * 1681.974450955533 / sample_rate);
+            double vh       = pow(10.0, 3.999843853973347 / 20.0);
+            double vb       = pow(vh, 0.4996667741545416);
+            double q        = 0.7071752369554196;
+            double a0       = 1.0 + k/q + k*k;
+            l->kw[0]        = (vh + vb*k/q + k*k) / a0;     // b0
+            l->kw[1]        = 2.0 * (k*k - vh) / a0;        // b1
+            l->kw[2]        = (vh - vb*k/q + k*k) / a0;     // b2
+            l->kw[3]        = -2.0 * (k*k - 1.0) / a0;      // a1
+            l->kw[4]        = -(1.0 - k/q + k*k) / a0;      // a2
+
+            // High-pass stage of K-weighting filter
+            k               = tan(M_PI * 38.13547087602444 / sample_rate);
+            q               = 0.5003270373238773;
+            a0              = 1.0 + k/q + k*k;
+            l->kw[5]        = 1.0f;                         // b0
+            l->kw[6]        = -2.0f;                        // b1
+            l->kw[7]        = 1.0f;                         // b2
+            l->kw[8]        = -2.0 * (k*k - 1.0) / a0;      // a1
+            l->kw[9]        = -(1.0 - k/q + k*k) / a0;      // a2
+            l->kw[10]       = 0.0f;
+            l->kw[11]       = 0.0f;
+
+            for (size_t i=0; i<LSP_DSP_LOUDNESS_MAX_CHANNELS; ++i)
+                l->weight[i]    = 1.0f;
+            for (size_t i=0; i<3; ++i)
+                l->__pad[i]     = 0;
+
+            if (channels < 1)
+                channels        = 1;
+            else if (channels > LSP_DSP_LOUDNESS_MAX_CHANNELS)
+                channels        = LSP_DSP_LOUDNESS_MAX_CHANNELS;
+            l->channels     = channels;
+            l->block_size   = (sample_rate + 5) / 10;
+
+            loudness_reset(l);
+        }
+
+        void loudness_accumulate(dsp::loudness_t *l, const float **src, size_t count)
+        {
+            const float *kw = l->kw;
+
+            for (size_t i=0; i<l->channels; ++i)
+            {
+                const float *s  = src[i];
+                float d0        = l->d[i];
+                float d1        = l->d[i + LSP_DSP_LOUDNESS_MAX_CHANNELS];
+                float e0        = l->d[i + LSP_DSP_LOUDNESS_MAX_CHANNELS*2];
+                float e1        = l->d[i + LSP_DSP_LOUDNESS_MAX_CHANNELS*3];
+                float ms        = l->ms[i];
+
+                for (size_t j=0; j<count; ++j)
+                {
+                    // High-shelf stage
+                    float x         = s[j];
+                    float y         = kw[0]*x + d0;
+                    d0              = kw[1]*x + kw[3]*y + d1;
+                    d1              = kw[2]*x + kw[4]*y;
+
+                    // High-pass stage
+                    x               = y;
+                    y               = kw[5]*x + e0;
+                    e0              = kw[6]*x + kw[8]*y + e1;
+                    e1              = kw[7]*x + kw[9]*y;
+
+                    ms             += y*y;
+                }
+
+                l->d[i]                                     = d0;
+                l->d[i + LSP_DSP_LOUDNESS_MAX_CHANNELS]     = d1;
+                l->d[i + LSP_DSP_LOUDNESS_MAX_CHANNELS*2]   = e0;
+                l->d[i + LSP_DSP_LOUDNESS_MAX_CHANNELS*3]   = e1;
+                l->ms[i]                                    = ms;
+            }
+        }
+
+        static inline float loudness_value(float p)
+        {
+            return (p > 0.0f) ? LOUDNESS_OFFSET + 10.0f * log10f(p) : LSP_DSP_LOUDNESS_SILENCE;
+        }
+
+        static inline float loudness_bin_value(size_t bin)
+        {
+            return LSP_DSP_LOUDNESS_HIST_MIN + (bin + 0.5f) * LSP_DSP_LOUDNESS_HIST_STEP;
+        }
+
+        static inline float loudness_bin_power(size_t bin)
+        {
+            return powf(10.0f, (loudness_bin_value(bin) - LOUDNESS_OFFSET) * 0.1f);
+        }
+
+        /**
+         * Add loudness value above the absolute gate to the histogram
+         * @param hist histogram
+         * @param p power of the block
+         */
+        static inline void loudness_hist_add(uint32_t *hist, float p)
+        {
+            float v         = loudness_value(p);
+            if (v <= LOUDNESS_ABS_GATE)
+                return;
+            ssize_t bin     = (v - LSP_DSP_LOUDNESS_HIST_MIN) * (1.0f / LSP_DSP_LOUDNESS_HIST_STEP);
+            if (bin >= LSP_DSP_LOUDNESS_HIST_BINS)
+                bin             = LSP_DSP_LOUDNESS_HIST_BINS - 1;
+            ++hist[bin];
+        }
+
+        /**
+         * Compute the relative gate of the histogram
+         * @param hist histogram
+         * @param gate offset of the relative gate
+         * @return index of the first bin above the relative gate, LSP_DSP_LOUDNESS_HIST_BINS if histogram is empty
+         */
+        static size_t loudness_hist_gate(const uint32_t *hist, float gate)
+        {
+            double p        = 0.0;
+            size_t n        = 0;
+            for (size_t i=0; i<LSP_DSP_LOUDNESS_HIST_BINS; ++i)
+            {
+                if (hist[i] <= 0)
+                    continue;
+                p              += double(hist[i]) * loudness_bin_power(i);
+                n              += hist[i];
+            }
+            if (n <= 0)
+                return LSP_DSP_LOUDNESS_HIST_BINS;
+
+            float v         = loudness_value(p / n) + gate;
+            size_t i        = 0;
+            while ((i < LSP_DSP_LOUDNESS_HIST_BINS) && (loudness_bin_value(i) <= v))
+                ++i;
+            return i;
+        }
+
+        /**
+         * Compute the mean power of the last sub-blocks
+         * @param l loudness meter
+         * @param blocks number of sub-blocks
+         * @return mean power
+         */
+        static float loudness_window_power(const dsp::loudness_t *l, size_t blocks)
+        {
+            float p         = 0.0f;
+            size_t idx      = l->head;
+            for (size_t i=0; i<blocks; ++i)
+            {
+                idx             = (idx + LSP_DSP_LOUDNESS_SHORT_BLOCKS - 1) % LSP_DSP_LOUDNESS_SHORT_BLOCKS;
+                p              += l->power[idx];
+            }
+            return p / blocks;
+        }
+
+        /**
+         * Close the sub-block: compute the power and update the ring buffer and histograms
+         * @param l loudness meter
+         */
+        static void loudness_close_block(dsp::loudness_t *l)
+        {
+            float p         = 0.0f;
+            for (size_t i=0; i<l->channels; ++i)
+            {
+                p              += l->weight[i] * l->ms[i];
+                l->ms[i]        = 0.0f;
+            }
+
+            l->power[l->head]   = p / l->block_size;
+            l->head         = (l->head + 1) % LSP_DSP_LOUDNESS_SHORT_BLOCKS;
+            l->offset       = 0;
+            ++l->blocks;
+
+            // 400 ms gating block with 75% overlap
+            if (l->blocks >= LSP_DSP_LOUDNESS_MOMENTARY_BLOCKS)
+                loudness_hist_add(l->hist_i, loudness_window_power(l, LSP_DSP_LOUDNESS_MOMENTARY_BLOCKS));
+            // Short-term value for the loudness range
+            if (l->blocks >= LSP_DSP_LOUDNESS_SHORT_BLOCKS)
+                loudness_hist_add(l->hist_s, loudness_window_power(l, LSP_DSP_LOUDNESS_SHORT_BLOCKS));
+        }
+
+        void loudness_process(dsp::loudness_t *l, const float **src, size_t count)
+        {
+            const float *s[LSP_DSP_LOUDNESS_MAX_CHANNELS];
+            for (size_t i=0; i<l->channels; ++i)
+                s[i]            = src[i];
+
+            while (count > 0)
+            {
+                size_t to_do    = l->block_size - l->offset;
+                if (to_do > count)
+                    to_do           = count;
+
+                dsp::loudness_accumulate(l, s, to_do);
+                for (size_t i=0; i<l->channels; ++i)
+                    s[i]           += to_do;
+                l->offset      += to_do;
+                count          -= to_do;
+
+                if (l->offset >= l->block_size)
+                    loudness_close_block(l);
+            }
+        }
+
+        float loudness_momentary(const dsp::loudness_t *l)
+        {
+            return loudness_value(loudness_window_power(l, LSP_DSP_LOUDNESS_MOMENTARY_BLOCKS));
+        }
+
+        float loudness_short_term(const dsp::loudness_t *l)
+        {
+            return loudness_value(loudness_window_power(l, LSP_DSP_LOUDNESS_SHORT_BLOCKS));
+        }
+
+        float loudness_integrated(const dsp::loudness_t *l)
+        {
+            size_t first    = loudness_hist_gate(l->hist_i, LOUDNESS_INT_GATE);
+
+            double p        = 0.0;
+            size_t n        = 0;
+            for (size_t i=first; i<LSP_DSP_LOUDNESS_HIST_BINS; ++i)
+            {
+                if (l->hist_i[i] <= 0)
+                    continue;
+                p              += double(l->hist_i[i]) * loudness_bin_power(i);
+                n              += l->hist_i[i];
+            }
+
+            return (n > 0) ? loudness_value(p / n) : LSP_DSP_LOUDNESS_SILENCE;
+        }
+
+        float loudness_range(const dsp::loudness_t *l)
+        {
+            size_t first    = loudness_hist_gate(l->hist_s, LOUDNESS_LRA_GATE);
+
+            size_t n        = 0;
+            for (size_t i=first; i<LSP_DSP_LOUDNESS_HIST_BINS; ++i)
+                n              += l->hist_s[i];
+            if (n <= 0)
+                return 0.0f;
+
+            // Find 10th and 95th percentiles
+            size_t lo_n     = n * LOUDNESS_LRA_LOW;
+            size_t hi_n     = n * LOUDNESS_LRA_HIGH;
+            size_t lo       = LSP_DSP_LOUDNESS_HIST_BINS;
+            size_t hi       = first;
+            for (size_t i=first, k=0; i<LSP_DSP_LOUDNESS_HIST_BINS; ++i)
+            {
+                k              += l->hist_s[i];
+                if ((lo >= LSP_DSP_LOUDNESS_HIST_BINS) && (k > lo_n))
+                    lo              = i;
+                if (k > hi_n)
+                {
+                    hi              = i;
+                    break;
+                }
+            }
+
+            return loudness_bin_value(hi) - loudness_bin_value(lo);
+        }
+    }
+}
+
+#undef LOUDNESS_LRA_HIGH
+#undef LOUDNESS_LRA_LOW
+#undef LOUDNESS_LRA_GATE
+#undef LOUDNESS_INT_GATE
+#undef LOUDNESS_ABS_GATE
+#undef LOUDNESS_OFFSET
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_LOUDNESS_H_ */
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_NOISE_H_
+#define PRIVATE_DSP_ARCH_GENERIC_NOISE_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /**
+         * Bijective hash of the 32-bit word (finalizer of MurmurHash3)
+         * @param x word to hash
+         * @return hashed word
+         */
+        static inline uint32_t noise_hash(uint32_t x)
+        {
+            x              ^= x >> 16;
+            x              *= 0x85ebca6b;
+            x              ^= x >> 13;
+            x              *= 0xc2b2ae35;
+            x              ^= x >> 16;
+            return x;
+        }
+
+        /**
+         * Convert the random word to the float in the range [1, 2)
+         * @param x random word
+         * @return float value
+         */
+        static inline float noise_float(uint32_t x)
+        {
+            union { float f; uint32_t i; } v;
+            v.i             = (x >> 9) | 0x3f800000;
+            return v.f;
+        }
+
+        /**
+         * Make one step of all lanes of the generator
+         * @param n noise generator
+         * @return pointer to the generated state row
+         */
+        static inline const uint32_t *noise_step(dsp::noise_t *n)
+        {
+            uint32_t *x         = n->s[n->index];
+            const uint32_t *w   = n->s[(n->index + 3) & 3];
+
+            for (size_t i=0; i<LSP_DSP_NOISE_LANES; ++i)
+            {
+                uint32_t t          = x[i] ^ (x[i] << 11);
+                x[i]                = w[i] ^ (w[i] >> 19) ^ t ^ (t >> 8);
+            }
+            n->index            = (n->index + 1) & 3;
+
+            return x;
+        }
+
+        /**
+         * Generate white noise: each output sample is the sum of values u in
+         * the range [1, 2) of the same lane over several steps, dst = sum * K - B
+         */
+        static void noise_generate(float *dst, dsp::noise_t *n, size_t steps, float K, float B, size_t count)
+        {
+            float v[LSP_DSP_NOISE_LANES];
+
+            for (size_t off=0; off < count; off += LSP_DSP_NOISE_LANES)
+            {
+                const uint32_t *x   = noise_step(n);
+                for (size_t i=0; i<LSP_DSP_NOISE_LANES; ++i)
+                    v[i]                = noise_float(x[i]);
+                for (size_t j=1; j<steps; ++j)
+                {
+                    x                   = noise_step(n);
+                    for (size_t i=0; i<LSP_DSP_NOISE_LANES; ++i)
+                        v[i]               += noise_float(x[i]);
+                }
+
+                size_t m            = count - off;
+                if (m > LSP_DSP_NOISE_LANES)
+                    m                   = LSP_DSP_NOISE_LANES;
+                for (size_t i=0; i<m; ++i)
+                    dst[off + i]        = v[i] * K - B;
+            }
+        }
+
+        void noise_init(dsp::noise_t *n, uint32_t seed)
+        {
+            uint32_t v      = seed;
+
+            // Zero state of a lane is the only one that xorshift can not leave
+            for (size_t i=0; i<4; ++i)
+                for (size_t j=0; j<LSP_DSP_NOISE_LANES; ++j)
+                {
+                    v              += 0x9e3779b9;
+                    uint32_t x      = noise_hash(v);
+                    n->s[i][j]      = (x != 0) ? x : 0x6a09e667;
+                }
+
+            // Start the pink noise generator with random rows to avoid the settling
+            for (size_t i=0; i<LSP_DSP_NOISE_PINK_ROWS; ++i)
+            {
+                v              += 0x9e3779b9;
+                n->rows[i]      = 2.0f * noise_float(noise_hash(v)) - 3.0f;
+            }
+
+            n->index        = 0;
+            n->counter      = 0;
+        }
+
+        void noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count)
+        {
+            noise_generate(dst, n, 1, 2.0f * k, 3.0f * k, count);
+        }
+
+        void noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count)
+        {
+            noise_generate(dst, n, 2, k, 3.0f * k, count);
+        }
+
+        void noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count)
+        {
+            const float K   = 1.7320508f * s; // sqrt(3) * s
+            noise_generate(dst, n, 4, K, 6.0f * K, count);
+        }
+
+        /*
+         * Each 8-sample block takes the white noise from the first step and the new
+         * row values from the second step. Rows 0, 1, 2 are updated inside of the
+         * block at positions 1-7 with the trailing zero count of the position, one
+         * of the rows 3 .. N-1 is updated at position 0 with the trailing zero count
+         * of the block counter.
+         */
+        void noise_pink(float *dst, dsp::noise_t *n, float k, size_t count)
+        {
+            float buf[LSP_DSP_NOISE_LANES * 2 * 16];
+            float *rows         = n->rows;
+            const float norm    = k / sqrtf(LSP_DSP_NOISE_PINK_ROWS + 1);
+
+            while (count > 0)
+            {
+                size_t blocks       = (count + LSP_DSP_NOISE_LANES - 1) / LSP_DSP_NOISE_LANES;
+                if (blocks > 16)
+                    blocks              = 16;
+                dsp::noise_uniform(buf, n, 1.0f, blocks * LSP_DSP_NOISE_LANES * 2);
+
+                for (size_t b=0; b<blocks; ++b)
+                {
+                    const float *w      = &buf[b * LSP_DSP_NOISE_LANES * 2];
+                    const float *r      = &w[LSP_DSP_NOISE_LANES];
+
+                    // Update one of the high rows
+                    uint32_t c          = n->counter++ | (1 << (LSP_DSP_NOISE_PINK_ROWS - 4));
+                    size_t row          = 3;
+                    for ( ; !(c & 1); c >>= 1)
+                        ++row;
+                    rows[row]           = r[0];
+
+                    float high          = 0.0f;
+                    for (size_t i=3; i<LSP_DSP_NOISE_PINK_ROWS; ++i)
+                        high               += rows[i];
+
+                    // Update low rows and emit samples
+                    size_t m            = (count > LSP_DSP_NOISE_LANES) ? LSP_DSP_NOISE_LANES : count;
+                    for (size_t i=0; i<m; ++i)
+                    {
+                        if (i > 0)
+                            rows[(i & 1) ? 0 : (i & 2) ? 1 : 2] = r[i];
+                        dst[i]              = (w[i] + rows[0] + rows[1] + rows[2] + high) * norm;
+                    }
+
+                    dst                += m;
+                    count              -= m;
+                }
+            }
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_NOISE_H_ */
@@ -0,0 +1,530 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_PARALLEL_H_
+#define PRIVATE_DSP_ARCH_GENERIC_PARALLEL_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#include <lsp-plug.in/common/alloc.h>
+
+#include <pthread.h>
+
+#ifdef PLATFORM_WINDOWS
+    #include <windows.h>
+#else
+    #include <unistd.h>
+#endif /* PLATFORM_WINDOWS */
+
+/*
+    The job is split into chunks of fixed size that depends only on the size of the data.
+    Each thread (including the caller) atomically claims the next unprocessed chunk until
+    all chunks are taken, so faster threads take more chunks and the chunk boundaries
+    (and the result) do not depend on the number of threads and the scheduling.
+ */
+
+#define MT_MAX_THREADS          64
+#define MT_CHUNK_SIZE           0x4000      /* Number of floats in the chunk, should be multiple of 64 */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /**
+         * Process the range of items
+         * @param args task arguments
+         * @param worker index of the worker thread, 0 is the calling thread, may be ignored
+         *   by tasks that do not need per-worker resources
+         * @param first the first item of the range
+         * @param count number of items in the range
+         */
+        typedef void (* mt_task_t)(void *args, size_t worker, size_t first, size_t count);
+
+        typedef struct mt_worker_t
+        {
+            size_t              nIndex;                     // Index of the worker, starting with 1
+            size_t              nGeneration;                // Generation of the last job seen at start
+        } mt_worker_t;
+
+        typedef struct mt_pool_t
+        {
+            pthread_mutex_t     sBusy;                      // Serializes jobs and reconfiguration
+            pthread_mutex_t     sLock;                      // Protects the state of the pool
+            pthread_cond_t      sWake;                      // Signals new job or shutdown to workers
+            pthread_cond_t      sDone;                      // Signals completion of job to the caller
+            pthread_t           vThreads[MT_MAX_THREADS];
+            mt_worker_t         vWorkers[MT_MAX_THREADS];
+            size_t              nThreads;                   // Number of workers excluding caller
+            size_t              nGeneration;                // Incremented for each new job
+            size_t              nActive;                    // Number of workers still processing the job
+            bool                bStop;                      // Shutdown request
+
+            // Current job
+            mt_task_t           pTask;
+            void               *pArgs;
+            size_t              nItems;
+            size_t              nChunk;
+            size_t              nChunks;
+            size_t              nWorkers;                   // Maximum number of threads to process the job
+            size_t              nNext;                      // The next chunk to process, updated atomically
+            uint32_t            nMode;                      // Denormal mode of the caller
+        } mt_pool_t;
+
+        static mt_pool_t mt_pool =
+        {
+            PTHREAD_MUTEX_INITIALIZER,
+            PTHREAD_MUTEX_INITIALIZER,
+            PTHREAD_COND_INITIALIZER,
+            PTHREAD_COND_INITIALIZER,
+            { },
+            { },
+            0, 0, 0, false,
+            NULL, NULL, 0, 0, 0, 0, 0, 0
+        };
+
+        static void mt_execute(mt_pool_t *pool, size_t worker)
+        {
+            while (true)
+            {
+                size_t chunk    = __sync_fetch_and_add(&pool->nNext, 1);
+                if (chunk >= pool->nChunks)
+                    break;
+
+                size_t first    = chunk * pool->nChunk;
+                size_t count    = pool->nItems - first;
+                if (count > pool->nChunk)
+                    count           = pool->nChunk;
+
+                pool->pTask(pool->pArgs, worker, first, count);
+            }
+        }
+
+        static void *mt_worker(void *arg)
+        {
+            mt_pool_t *pool     = &mt_pool;
+            mt_worker_t *w      = static_cast<mt_worker_t *>(arg);
+
+            // The generation is captured by set_threads(), a job submitted before
+            // the worker gets scheduled is not missed
+            pthread_mutex_lock(&pool->sLock);
+            size_t worker       = w->nIndex;
+            size_t generation   = w->nGeneration;
+
+            while (!pool->bStop)
+            {
+                if (generation == pool->nGeneration)
+                {
+                    pthread_cond_wait(&pool->sWake, &pool->sLock);
+                    continue;
+                }
+                generation          = pool->nGeneration;
+                pthread_mutex_unlock(&pool->sLock);
+
+                // Process the job with the same floating-point mode as the caller
+                dsp::context_t ctx;
+                if (pool->nMode)
+                    dsp::start(&ctx);
+                if (worker < pool->nWorkers)
+                    mt_execute(pool, worker);
+                if (pool->nMode)
+                    dsp::finish(&ctx);
+
+                pthread_mutex_lock(&pool->sLock);
+                if ((--pool->nActive) <= 0)
+                    pthread_cond_signal(&pool->sDone);
+            }
+
+            pthread_mutex_unlock(&pool->sLock);
+            return NULL;
+        }
+
+        static void mt_shutdown(mt_pool_t *pool)
+        {
+            if (pool->nThreads <= 0)
+                return;
+
+            pthread_mutex_lock(&pool->sLock);
+            pool->bStop     = true;
+            pthread_cond_broadcast(&pool->sWake);
+            pthread_mutex_unlock(&pool->sLock);
+
+            for (size_t i=0; i<pool->nThreads; ++i)
+                pthread_join(pool->vThreads[i], NULL);
+
+            pool->nThreads  = 0;
+            pool->bStop     = false;
+        }
+
+        static size_t mt_cpu_count()
+        {
+        #ifdef PLATFORM_WINDOWS
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            ssize_t count   = info.dwNumberOfProcessors;
+        #else
+            ssize_t count   = sysconf(_SC_NPROCESSORS_ONLN);
+        #endif /* PLATFORM_WINDOWS */
+            return (count > 0) ? count : 1;
+        }
+
+        static void mt_run_inline(mt_task_t task, void *args, size_t items, size_t chunk)
+        {
+            for (size_t first=0; first < items; first += chunk)
+                task(args, 0, first, (items - first > chunk) ? chunk : items - first);
+        }
+
+        /**
+         * Run the task over the items
+         * @param task task to execute for each chunk of items
+         * @param args task arguments
+         * @param items number of items
+         * @param chunk number of items in one chunk
+         * @param workers maximum number of threads to use including the caller
+         */
+        static void mt_run(mt_task_t task, void *args, size_t items, size_t chunk, size_t workers = MT_MAX_THREADS)
+        {
+            mt_pool_t *pool     = &mt_pool;
+            size_t chunks       = (items + chunk - 1) / chunk;
+
+            // Execute the task by the caller if there is nothing to parallel or the pool is busy
+            if ((chunks <= 1) || (workers <= 1) || (pthread_mutex_trylock(&pool->sBusy) != 0))
+            {
+                mt_run_inline(task, args, items, chunk);
+                return;
+            }
+            if (pool->nThreads <= 0)
+            {
+                pthread_mutex_unlock(&pool->sBusy);
+                mt_run_inline(task, args, items, chunk);
+                return;
+            }
+
+            // Submit the job
+            pthread_mutex_lock(&pool->sLock);
+            pool->pTask         = task;
+            pool->pArgs         = args;
+            pool->nItems        = items;
+            pool->nChunk        = chunk;
+            pool->nChunks       = chunks;
+            pool->nWorkers      = workers;
+            pool->nNext         = 0;
+            pool->nMode         = dsp::denormal_mode();
+            pool->nActive       = pool->nThreads;
+            ++pool->nGeneration;
+            pthread_cond_broadcast(&pool->sWake);
+            pthread_mutex_unlock(&pool->sLock);
+
+            // Participate in the job and wait for workers
+            mt_execute(pool, 0);
+
+            pthread_mutex_lock(&pool->sLock);
+            while (pool->nActive > 0)
+                pthread_cond_wait(&pool->sDone, &pool->sLock);
+            pthread_mutex_unlock(&pool->sLock);
+
+            pthread_mutex_unlock(&pool->sBusy);
+        }
+
+        size_t set_threads(size_t count)
+        {
+            mt_pool_t *pool     = &mt_pool;
+
+            if (count <= 0)
+                count           = mt_cpu_count();
+            if (count > MT_MAX_THREADS)
+                count           = MT_MAX_THREADS;
+
+            pthread_mutex_lock(&pool->sBusy);
+
+            if (pool->nThreads != (count - 1))
+            {
+                mt_shutdown(pool);
+
+                pthread_mutex_lock(&pool->sLock);
+                for (size_t i=1; i<count; ++i)
+                {
+                    mt_worker_t *w      = &pool->vWorkers[pool->nThreads];
+                    w->nIndex           = i;
+                    w->nGeneration      = pool->nGeneration;
+                    if (pthread_create(&pool->vThreads[pool->nThreads], NULL, mt_worker, w) != 0)
+                        break;
+                    ++pool->nThreads;
+                }
+                pthread_mutex_unlock(&pool->sLock);
+            }
+
+            count               = pool->nThreads + 1;
+            pthread_mutex_unlock(&pool->sBusy);
+
+            return count;
+        }
+
+        size_t get_threads()
+        {
+            return mt_pool.nThreads + 1;
+        }
+
+        /**
+         * Stops worker threads on library unload
+         */
+        static class mt_cleanup_t
+        {
+            public:
+                ~mt_cleanup_t()
+                {
+                    pthread_mutex_lock(&mt_pool.sBusy);
+                    mt_shutdown(&mt_pool);
+                    pthread_mutex_unlock(&mt_pool.sBusy);
+                }
+        } mt_cleanup;
+
+        //---------------------------------------------------------------------
+        // Packed math
+        typedef struct mt_vv_t
+        {
+            float          *dst;
+            const float    *a;
+            const float    *b;
+            const float    *c;
+        } mt_vv_t;
+
+        #define MT_OP2(op) \
+            static void mt_##op(void *args, size_t /* worker */, size_t first, size_t count) \
+            { \
+                mt_vv_t *v = static_cast<mt_vv_t *>(args); \
+                dsp::op(&v->dst[first], &v->a[first], count); \
+            } \
+            \
+            void op##_mt(float *dst, const float *src, size_t count) \
+            { \
+                mt_vv_t v = { dst, src, NULL, NULL }; \
+                mt_run(mt_##op, &v, count, MT_CHUNK_SIZE); \
+            }
+
+        #define MT_OP3(op) \
+            static void mt_##op(void *args, size_t /* worker */, size_t first, size_t count) \
+            { \
+                mt_vv_t *v = static_cast<mt_vv_t *>(args); \
+                dsp::op(&v->dst[first], &v->a[first], &v->b[first], count); \
+            } \
+            \
+            void op##_mt(float *dst, const float *a, const float *b, size_t count) \
+            { \
+                mt_vv_t v = { dst, a, b, NULL }; \
+                mt_run(mt_##op, &v, count, MT_CHUNK_SIZE); \
+            }
+
+        #define MT_OP4(op) \
+            static void mt_##op(void *args, size_t /* worker */, size_t first, size_t count) \
+            { \
+                mt_vv_t *v = static_cast<mt_vv_t *>(args); \
+                dsp::op(&v->dst[first], &v->a[first], &v->b[first], &v->c[first], count); \
+            } \
+            \
+            void op##_mt(float *dst, const float *a, const float *b, const float *c, size_t count) \
+            { \
+                mt_vv_t v = { dst, a, b, c }; \
+                mt_run(mt_##op, &v, count, MT_CHUNK_SIZE); \
+            }
+
+        MT_OP2(add2)
+        MT_OP2(sub2)
+        MT_OP2(mul2)
+        MT_OP2(div2)
+        MT_OP3(add3)
+        MT_OP3(sub3)
+        MT_OP3(mul3)
+        MT_OP3(div3)
+        MT_OP3(fmadd3)
+        MT_OP4(fmadd4)
+
+        #undef MT_OP2
+        #undef MT_OP3
+        #undef MT_OP4
+
+        //---------------------------------------------------------------------
+        // Batched FFT
+        typedef struct mt_fft_t
+        {
+            float             **dst_re;
+            float             **dst_im;
+            const float * const *src_re;
+            const float * const *src_im;
+            size_t              rank;
+        } mt_fft_t;
+
+        // Number of transforms of 2^rank samples in one chunk, at least one
+        static inline size_t mt_rank_chunk(size_t rank)
+        {
+            size_t chunk        = MT_CHUNK_SIZE >> rank;
+            return (chunk > 0) ? chunk : 1;
+        }
+
+        #define MT_FFT(op) \
+            static void mt_##op(void *args, size_t /* worker */, size_t first, size_t count) \
+            { \
+                mt_fft_t *f = static_cast<mt_fft_t *>(args); \
+                dsp::op(&f->dst_re[first], &f->dst_im[first], &f->src_re[first], &f->src_im[first], f->rank, count); \
+            } \
+            \
+            void op##_mt(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count) \
+            { \
+                mt_fft_t f = { dst_re, dst_im, src_re, src_im, rank }; \
+                mt_run(mt_##op, &f, count, mt_rank_chunk(rank)); \
+            }
+
+        #define MT_PFFT(op) \
+            static void mt_##op(void *args, size_t /* worker */, size_t first, size_t count) \
+            { \
+                mt_fft_t *f = static_cast<mt_fft_t *>(args); \
+                dsp::op(&f->dst_re[first], &f->src_re[first], f->rank, count); \
+            } \
+            \
+            void op##_mt(float **dst, const float * const *src, size_t rank, size_t count) \
+            { \
+                mt_fft_t f = { dst, NULL, src, NULL, rank }; \
+                mt_run(mt_##op, &f, count, mt_rank_chunk(rank)); \
+            }
+
+        MT_FFT(direct_fft_batch)
+        MT_FFT(reverse_fft_batch)
+        MT_PFFT(packed_direct_fft_batch)
+        MT_PFFT(packed_reverse_fft_batch)
+
+        #undef MT_FFT
+        #undef MT_PFFT
+
+        //---------------------------------------------------------------------
+        // Fast convolution
+        typedef struct mt_fastconv_t
+        {
+            float          *dst;
+            float          *tmp;            // Temporary buffer of 2^(rank+1) floats for each worker
+            const float    *c;
+            const float    *src;
+            size_t          rank;
+            size_t          odd;            // Parity of blocks in current pass
+        } mt_fastconv_t;
+
+        static void mt_fastconv_convolve(void *args, size_t worker, size_t first, size_t count)
+        {
+            mt_fastconv_t *f    = static_cast<mt_fastconv_t *>(args);
+            size_t half         = 1 << (f->rank - 1);
+            float *tmp          = &f->tmp[worker << (f->rank + 1)];
+
+            for (size_t i=first, n=first+count; i<n; ++i)
+            {
+                size_t off          = ((i << 1) + f->odd) * half;
+                dsp::fastconv_parse_apply(&f->dst[off], tmp, f->c, &f->src[off], f->rank);
+            }
+        }
+
+        /*
+            Each block produces 2^rank samples that overlap with outputs of previous and
+            next blocks, blocks of the same parity do not overlap and can be processed
+            in parallel. Each output sample is the sum of at most two values added to
+            zero, so the result does not depend on the order of the passes.
+         */
+        void fastconv_convolve_mt(float *dst, const float *c, const float *src, size_t rank, size_t count)
+        {
+            size_t half         = 1 << (rank - 1);
+            size_t blocks       = count >> (rank - 1);
+            size_t tail         = count - (blocks << (rank - 1));
+
+            dsp::fill_zero(dst, count + half);
+
+            // Allocate temporary buffers
+            size_t workers      = mt_pool.nThreads + 1;
+            uint8_t *data       = NULL;
+            float *tmp          = alloc_aligned<float>(data, (workers + 1) << (rank + 1), 64);
+            if (tmp == NULL)
+                return;
+
+            // Process even and odd blocks
+            mt_fastconv_t f     = { dst, tmp, c, src, rank, 0 };
+            size_t chunk        = mt_rank_chunk(rank);
+            mt_run(mt_fastconv_convolve, &f, (blocks + 1) >> 1, chunk, workers);
+            f.odd               = 1;
+            mt_run(mt_fastconv_convolve, &f, blocks >> 1, chunk, workers);
+
+            // Process the incomplete block
+            if (tail > 0)
+            {
+                float *buf          = &tmp[workers << (rank + 1)];
+                float *out          = &buf[half];
+                size_t off          = blocks << (rank - 1);
+
+                dsp::copy(buf, &src[off], tail);
+                dsp::fill_zero(&buf[tail], half * 3 - tail);
+                dsp::fastconv_parse_apply(out, tmp, c, buf, rank);
+                dsp::add2(&dst[off], out, tail + half);
+            }
+
+            free_aligned(data);
+        }
+
+        //---------------------------------------------------------------------
+        // 3D math
+        #define MT_BOUND_BOXES          64
+
+        typedef struct mt_bound_box_t
+        {
+            dsp::bound_box3d_t  *b;
+            const dsp::point3d_t *p;
+            size_t               chunk;
+        } mt_bound_box_t;
+
+        static void mt_calc_bound_box(void *args, size_t /* worker */, size_t first, size_t count)
+        {
+            mt_bound_box_t *bb  = static_cast<mt_bound_box_t *>(args);
+            dsp::calc_bound_box(&bb->b[first / bb->chunk], &bb->p[first], count);
+        }
+
+        void calc_bound_box_mt(dsp::bound_box3d_t *b, const dsp::point3d_t *p, size_t n)
+        {
+            size_t chunk        = (n + MT_BOUND_BOXES - 1) / MT_BOUND_BOXES;
+            if (chunk < (MT_CHUNK_SIZE >> 2))
+                chunk               = MT_CHUNK_SIZE >> 2;
+            size_t chunks       = (n + chunk - 1) / chunk;
+            if (chunks <= 1)
+            {
+                dsp::calc_bound_box(b, p, n);
+                return;
+            }
+
+            // Compute bounding box for each chunk and then for all their vertices
+            dsp::bound_box3d_t boxes[MT_BOUND_BOXES];
+            mt_bound_box_t bb   = { boxes, p, chunk };
+            mt_run(mt_calc_bound_box, &bb, n, chunk);
+
+            dsp::calc_bound_box(b, boxes[0].p, chunks * 8);
+        }
+
+        #undef MT_BOUND_BOXES
+    }
+}
+
+#undef MT_CHUNK_SIZE
+#undef MT_MAX_THREADS
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_PARALLEL_H_ */
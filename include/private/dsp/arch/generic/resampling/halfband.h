@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_RESAMPLING_HALFBAND_H_
+#define PRIVATE_DSP_ARCH_GENERIC_RESAMPLING_HALFBAND_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+/*
+    The halfband filter is designed as an elliptic filter with equal passband
+    and stopband ripple which is decomposed into two paths of allpass sections:
+
+               1   ┌                        ┐
+      H(z)  = ───  │ A0(z^2) + z^-1 A1(z^2) │
+               2   └                        ┘
+
+                          a[i] + z^-2
+      A0(z) = Π(i=0,2,4,6) ─────────────
+                          1 + a[i]*z^-2
+
+                          a[i] + z^-2
+      A1(z) = Π(i=1,3,5,7) ─────────────
+                          1 + a[i]*z^-2
+
+    For 2x upsampling both paths receive the same input sample and their outputs
+    give the even and the odd output samples. For 2x downsampling the even input
+    sample is passed to the path 1, the odd input sample is passed to the path 0
+    and the outputs of both paths are averaged.
+ */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /** Size of temporary buffer (in samples) used by multi-stage oversampling
+         */
+        #define HALFBAND_BUF_SIZE           0x100
+
+        static double halfband_calc_num(double q, size_t order, size_t c)
+        {
+            double acc = 0.0, v;
+            double sign = 1.0;
+            size_t i = 0;
+
+            do
+            {
+                v       = pow(q, double(i * (i + 1))) * sin(double((i*2 + 1) * c) * M_PI / double(order)) * sign;
+                acc    += v;
+                sign    = -sign;
+                ++i;
+            } while (fabs(v) > 1e-100);
+
+            return acc;
+        }
+
+        static double halfband_calc_den(double q, size_t order, size_t c)
+        {
+            double acc = 0.0, v;
+            double sign = -1.0;
+            size_t i = 1;
+
+            do
+            {
+                v       = pow(q, double(i * i)) * cos(double(i * 2 * c) * M_PI / double(order)) * sign;
+                acc    += v;
+                sign    = -sign;
+                ++i;
+            } while (fabs(v) > 1e-100);
+
+            return acc;
+        }
+
+        void halfband_reset(halfband_t *f)
+        {
+            for (size_t i=0; i<LSP_DSP_HALFBAND_ITEMS; ++i)
+            {
+                f->x[i]     = 0.0f;
+                f->y[i]     = 0.0f;
+            }
+        }
+
+        void halfband_init(halfband_t *f, float transition)
+        {
+            // Limit the transition band
+            double t    = (transition < 1e-4f) ? 1e-4f :
+                          (transition > 0.49f) ? 0.49f : transition;
+
+            // Compute the selectivity factor and the nome of the elliptic filter
+            double k    = tan((1.0 - t * 2.0) * M_PI * 0.25);
+            k          *= k;
+            double kk   = sqrt(sqrt(1.0 - k * k));
+            double e    = 0.5 * (1.0 - kk) / (1.0 + kk);
+            double e4   = e * e;
+            e4         *= e4;
+            double q    = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+            double q4   = sqrt(sqrt(q));
+
+            // Compute coefficients of allpass sections
+            size_t order = LSP_DSP_HALFBAND_ITEMS * 2 + 1;
+            for (size_t i=0; i<LSP_DSP_HALFBAND_ITEMS; ++i)
+            {
+                double ww   = halfband_calc_num(q, order, i + 1) * q4 / (halfband_calc_den(q, order, i + 1) + 0.5);
+                double w2   = ww * ww;
+                double x    = sqrt((1.0 - w2 * k) * (1.0 - w2 / k)) / (1.0 + w2);
+
+                f->a[i]     = (1.0 - x) / (1.0 + x);
+                f->__pad[i] = 0.0f;
+            }
+
+            halfband_reset(f);
+        }
+
+        void halfband_upsample_2x(float *dst, const float *src, size_t count, halfband_t *f)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                float s0    = src[i];
+                float s1    = s0;
+
+                for (size_t j=0; j<LSP_DSP_HALFBAND_ITEMS; j += 2)
+                {
+                    float t0    = (s0 - f->y[j]) * f->a[j] + f->x[j];
+                    float t1    = (s1 - f->y[j+1]) * f->a[j+1] + f->x[j+1];
+
+                    f->x[j]     = s0;
+                    f->x[j+1]   = s1;
+                    f->y[j]     = t0;
+                    f->y[j+1]   = t1;
+
+                    s0          = t0;
+                    s1          = t1;
+                }
+
+                dst[0]      = s0;
+                dst[1]      = s1;
+                dst        += 2;
+            }
+        }
+
+        void halfband_downsample_2x(float *dst, const float *src, size_t count, halfband_t *f)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                float s0    = src[1];
+                float s1    = src[0];
+
+                for (size_t j=0; j<LSP_DSP_HALFBAND_ITEMS; j += 2)
+                {
+                    float t0    = (s0 - f->y[j]) * f->a[j] + f->x[j];
+                    float t1    = (s1 - f->y[j+1]) * f->a[j+1] + f->x[j+1];
+
+                    f->x[j]     = s0;
+                    f->x[j+1]   = s1;
+                    f->y[j]     = t0;
+                    f->y[j+1]   = t1;
+
+                    s0          = t0;
+                    s1          = t1;
+                }
+
+                dst[i]      = (s0 + s1) * 0.5f;
+                src        += 2;
+            }
+        }
+
+        void halfband_upsample_4x(float *dst, const float *src, size_t count, halfband_t *f)
+        {
+            float buf[HALFBAND_BUF_SIZE*2] __lsp_aligned16;
+
+            for (size_t n=0; n<count; )
+            {
+                size_t to_do    = count - n;
+                if (to_do > HALFBAND_BUF_SIZE)
+                    to_do           = HALFBAND_BUF_SIZE;
+
+                dsp::halfband_upsample_2x(buf, &src[n], to_do, &f[0]);
+                dsp::halfband_upsample_2x(dst, buf, to_do*2, &f[1]);
+
+                dst            += to_do*4;
+                n              += to_do;
+            }
+        }
+
+        void halfband_upsample_8x(float *dst, const float *src, size_t count, halfband_t *f)
+        {
+            float buf[HALFBAND_BUF_SIZE*6] __lsp_aligned16;
+            float *b2x      = buf;
+            float *b4x      = &buf[HALFBAND_BUF_SIZE*2];
+
+            for (size_t n=0; n<count; )
+            {
+                size_t to_do    = count - n;
+                if (to_do > HALFBAND_BUF_SIZE)
+                    to_do           = HALFBAND_BUF_SIZE;
+
+                dsp::halfband_upsample_2x(b2x, &src[n], to_do, &f[0]);
+                dsp::halfband_upsample_2x(b4x, b2x, to_do*2, &f[1]);
+                dsp::halfband_upsample_2x(dst, b4x, to_do*4, &f[2]);
+
+                dst            += to_do*8;
+                n              += to_do;
+            }
+        }
+
+        void halfband_downsample_4x(float *dst, const float *src, size_t count, halfband_t *f)
+        {
+            float buf[HALFBAND_BUF_SIZE*2] __lsp_aligned16;
+
+            for (size_t n=0; n<count; )
+            {
+                size_t to_do    = count - n;
+                if (to_do > HALFBAND_BUF_SIZE)
+                    to_do           = HALFBAND_BUF_SIZE;
+
+                dsp::halfband_downsample_2x(buf, src, to_do*2, &f[1]);
+                dsp::halfband_downsample_2x(&dst[n], buf, to_do, &f[0]);
+
+                src            += to_do*4;
+                n              += to_do;
+            }
+        }
+
+        void halfband_downsample_8x(float *dst, const float *src, size_t count, halfband_t *f)
+        {
+            float buf[HALFBAND_BUF_SIZE*6] __lsp_aligned16;
+            float *b2x      = buf;
+            float *b4x      = &buf[HALFBAND_BUF_SIZE*2];
+
+            for (size_t n=0; n<count; )
+            {
+                size_t to_do    = count - n;
+                if (to_do > HALFBAND_BUF_SIZE)
+                    to_do           = HALFBAND_BUF_SIZE;
+
+                dsp::halfband_downsample_2x(b4x, src, to_do*4, &f[2]);
+                dsp::halfband_downsample_2x(b2x, b4x, to_do*2, &f[1]);
+                dsp::halfband_downsample_2x(&dst[n], b2x, to_do, &f[0]);
+
+                src            += to_do*8;
+                n              += to_do;
+            }
+        }
+
+        #undef HALFBAND_BUF_SIZE
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_RESAMPLING_HALFBAND_H_ */
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_SHAPER_H_
+#define PRIVATE_DSP_ARCH_GENERIC_SHAPER_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        void shaper_init(float *buf, dsp::shaper_t *s, const float *curve, size_t size, float xmin, float xmax)
+        {
+            s->scale        = (size - 1) / (xmax - xmin);
+            s->offset       = -xmin * s->scale;
+            s->last         = size - 1;
+            s->size         = size;
+
+            // Copy the curve and extrapolate guard points linearly
+            for (size_t i=0; i<size; ++i)
+                buf[i + 1]      = curve[i];
+            buf[0]          = 2.0f * curve[0] - curve[1];
+            buf[size + 1]   = 2.0f * curve[size - 1] - curve[size - 2];
+            buf[size + 2]   = 2.0f * buf[size + 1] - curve[size - 1];
+        }
+
+        /*
+         * For the table position u = k + f, x = &buf[k] points to c[k-1], so the
+         * points x[0] .. x[3] are c[k-1] .. c[k+2]. Comparisons are written to map
+         * NaN input to the first point of the curve.
+         */
+        #define SHAPER_LOOP(INTERP) \
+            const float scale   = s->scale; \
+            const float offset  = s->offset; \
+            const float last    = s->last; \
+            for (size_t i=0; i<count; ++i) \
+            { \
+                float u             = src[i] * scale + offset; \
+                u                   = (u > 0.0f) ? u : 0.0f; \
+                u                   = (u < last) ? u : last; \
+                int32_t k           = u; \
+                float f             = u - k; \
+                const float *x      = &buf[k]; \
+                INTERP; \
+            }
+
+        void shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count)
+        {
+            SHAPER_LOOP(
+                dst[i]              = x[1] + (x[2] - x[1]) * f
+            );
+        }
+
+        void shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count)
+        {
+            SHAPER_LOOP(
+                float h             = (x[2] - x[0]) * 0.5f;
+                float q             = (x[0] + x[2]) * 0.5f - x[1];
+                float c3            = (x[3] - x[0]) * 0.5f + (x[1] - x[2]) * 1.5f;
+                float c2            = q - c3;
+                dst[i]              = ((c3 * f + c2) * f + h) * f + x[1]
+            );
+        }
+
+        #undef SHAPER_LOOP
+
+        void shaper_oversampled(float *dst, const float *src, float *tmp,
+                const float *buf, const dsp::shaper_t *s, size_t interp, size_t factor,
+                dsp::halfband_t *up, dsp::halfband_t *down, size_t count)
+        {
+            void (* shape)(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count) =
+                (interp == dsp::SHAPER_CUBIC) ? dsp::shaper_cubic : dsp::shaper_linear;
+
+            switch (factor)
+            {
+                case 2:
+                    dsp::halfband_upsample_2x(tmp, src, count, up);
+                    shape(tmp, tmp, buf, s, count * 2);
+                    dsp::halfband_downsample_2x(dst, tmp, count, down);
+                    break;
+                case 4:
+                    dsp::halfband_upsample_4x(tmp, src, count, up);
+                    shape(tmp, tmp, buf, s, count * 4);
+                    dsp::halfband_downsample_4x(dst, tmp, count, down);
+                    break;
+                default:
+                    shape(dst, src, buf, s, count);
+                    break;
+            }
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_SHAPER_H_ */
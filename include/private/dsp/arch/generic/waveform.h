@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_WAVEFORM_H_
+#define PRIVATE_DSP_ARCH_GENERIC_WAVEFORM_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#define WAVEFORM_MAX_SHIFT          16
+#define WAVEFORM_MAX_CAPACITY       0x7fffffff
+
+namespace lsp
+{
+    namespace generic
+    {
+        static inline void waveform_peak_merge(dsp::waveform_peak_t *dst, const dsp::waveform_peak_t *src)
+        {
+            if (dst->min > src->min)
+                dst->min        = src->min;
+            if (dst->max < src->max)
+                dst->max        = src->max;
+            dst->sqr       += src->sqr;
+        }
+
+        size_t waveform_mipmap_init(dsp::waveform_mipmap_t *m, size_t capacity, size_t shift)
+        {
+            if ((capacity <= 0) || (capacity > WAVEFORM_MAX_CAPACITY) || (shift > WAVEFORM_MAX_SHIFT))
+                return 0;
+
+            size_t total    = 0;
+            size_t levels   = 0;
+
+            // Each next level is twice smaller than previous, the last level has one entry
+            for (size_t k=shift; ; ++k)
+            {
+                size_t n            = ((capacity - 1) >> k) + 1;
+                m->offset[levels++] = total;
+                total              += n;
+                if (n <= 1)
+                    break;
+            }
+            for (size_t i=levels; i<LSP_DSP_WAVEFORM_MAX_LEVELS; ++i)
+                m->offset[i]    = total;
+
+            m->shift        = shift;
+            m->levels       = levels;
+            m->capacity     = capacity;
+            m->count        = 0;
+
+            return total;
+        }
+
+        size_t waveform_mipmap_append(dsp::waveform_mipmap_t *m, dsp::waveform_peak_t *data, const float *src, size_t count)
+        {
+            size_t avail    = m->capacity - m->count;
+            if (count > avail)
+                count           = avail;
+            if (count <= 0)
+                return 0;
+
+            size_t shift    = m->shift;
+            size_t bs       = size_t(1) << shift;
+            size_t start    = m->count;
+            size_t end      = start + count;
+            size_t left     = count;
+            dsp::waveform_peak_t *p = &data[m->offset[0] + (start >> shift)];
+            float vmin, vmax;
+
+            // Update the last incomplete entry of the first level
+            size_t head     = start & (bs - 1);
+            if (head > 0)
+            {
+                size_t n        = (left < (bs - head)) ? left : bs - head;
+                dsp::minmax(src, n, &vmin, &vmax);
+                if (p->min > vmin)
+                    p->min          = vmin;
+                if (p->max < vmax)
+                    p->max          = vmax;
+                p->sqr         += dsp::h_sqr_sum(src, n);
+
+                src            += n;
+                left           -= n;
+                ++p;
+            }
+
+            // Compute new entries of the first level
+            while (left > 0)
+            {
+                size_t n        = (left < bs) ? left : bs;
+                dsp::minmax(src, n, &p->min, &p->max);
+                p->sqr          = dsp::h_sqr_sum(src, n);
+
+                src            += n;
+                left           -= n;
+                ++p;
+            }
+
+            // Update affected entries of other levels
+            size_t first    = start >> shift;
+            size_t last     = (end - 1) >> shift;
+            size_t items    = last + 1;
+
+            for (size_t l=1; l<m->levels; ++l)
+            {
+                const dsp::waveform_peak_t *s   = &data[m->offset[l-1]];
+                dsp::waveform_peak_t *d         = &data[m->offset[l]];
+
+                first         >>= 1;
+                last          >>= 1;
+
+                for (size_t i=first; i<=last; ++i)
+                {
+                    size_t j        = i << 1;
+                    d[i]            = s[j];
+                    if ((j + 1) < items)
+                        waveform_peak_merge(&d[i], &s[j + 1]);
+                }
+
+                items           = last + 1;
+            }
+
+            m->count        = end;
+
+            return count;
+        }
+
+        void waveform_mipmap_query(float *min, float *max, float *rms,
+                const dsp::waveform_mipmap_t *m, const dsp::waveform_peak_t *data,
+                const float *src, size_t first, float step, size_t count)
+        {
+            size_t total    = m->count;
+            if (!(step > 0.0f))
+                total           = 0;
+
+            // Select the level with the largest entries that are not larger than the column
+            ssize_t level   = 0;
+            if (step < float(size_t(1) << m->shift))
+            {
+                if (src != NULL)
+                    level           = -1;
+            }
+            else
+            {
+                while ((size_t(level + 1) < m->levels) &&
+                       (float(size_t(1) << (m->shift + level + 1)) <= step))
+                    ++level;
+            }
+
+            size_t k        = m->shift + level;
+            const dsp::waveform_peak_t *p   = (level >= 0) ? &data[m->offset[level]] : NULL;
+
+            for (size_t c=0; c<count; ++c)
+            {
+                size_t s0       = first + size_t(double(c) * step);
+                size_t s1       = first + size_t(double(c + 1) * step);
+
+                if (s0 >= total)
+                {
+                    min[c]          = 0.0f;
+                    max[c]          = 0.0f;
+                    if (rms != NULL)
+                        rms[c]          = 0.0f;
+                    continue;
+                }
+                if (s1 <= s0)
+                    s1              = s0 + 1;
+                if (s1 > total)
+                    s1              = total;
+
+                // Compute envelope directly from the signal
+                if (p == NULL)
+                {
+                    size_t n        = s1 - s0;
+                    dsp::minmax(&src[s0], n, &min[c], &max[c]);
+                    if (rms != NULL)
+                        rms[c]          = sqrtf(dsp::h_sqr_sum(&src[s0], n) / n);
+                    continue;
+                }
+
+                // Compute envelope from the entries of the selected level
+                size_t i0       = s0 >> k;
+                size_t i1       = (s1 - 1) >> k;
+                dsp::waveform_peak_t v = p[i0];
+                for (size_t i=i0+1; i<=i1; ++i)
+                    waveform_peak_merge(&v, &p[i]);
+
+                min[c]          = v.min;
+                max[c]          = v.max;
+                if (rms != NULL)
+                {
+                    size_t tail     = total - (i1 << k);
+                    if (tail > (size_t(1) << k))
+                        tail            = size_t(1) << k;
+                    rms[c]          = sqrtf(v.sqr / (tail + ((i1 - i0) << k)));
+                }
+            }
+        }
+    }
+}
+
+#undef WAVEFORM_MAX_SHIFT
+#undef WAVEFORM_MAX_CAPACITY
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_WAVEFORM_H_ */
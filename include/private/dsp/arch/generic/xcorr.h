@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_XCORR_H_
+#define PRIVATE_DSP_ARCH_GENERIC_XCORR_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        void xcorr_spectrum(float *dst, const float *src, size_t rank)
+        {
+            size_t half     = (size_t(1) << rank) >> 1;
+
+            dsp::pcomplex_r2c(dst, src, half);
+            dsp::fill_zero(&dst[half * 2], half * 2);
+            dsp::packed_direct_fft(dst, dst, rank);
+        }
+
+        void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count)
+        {
+            for (size_t i=0; i<count; ++i, acc += 2, a += 2, b += 2)
+            {
+                // G = conj(a) * b
+                float re        = a[0]*b[0] + a[1]*b[1];
+                float im        = a[0]*b[1] - a[1]*b[0];
+
+                if (weight == dsp::XCORR_PHAT)
+                {
+                    float w         = 1.0f / (sqrtf(re*re + im*im) + 1e-20f);
+                    re             *= w;
+                    im             *= w;
+                }
+
+                acc[0]         += (re - acc[0]) * k;
+                acc[1]         += (im - acc[1]) * k;
+            }
+        }
+
+        float xcorr_peak(float *value, float *tmp, const float *acc, size_t max_lag, size_t rank)
+        {
+            size_t size     = size_t(1) << rank;
+            size_t mask     = size - 1;
+            size_t half     = size >> 1;
+            if (max_lag >= half)
+                max_lag         = (half > 0) ? half - 1 : 0;
+
+            dsp::packed_reverse_fft(tmp, acc, rank);
+
+            // Find the maximum over lags -max_lag .. max_lag, the negative lags are at the end
+            ssize_t lag     = 0;
+            float vmax      = tmp[0];
+            for (size_t i=1; i<=max_lag; ++i)
+            {
+                float v1        = tmp[i*2];
+                float v2        = tmp[(size - i)*2];
+                if (v1 > vmax)
+                {
+                    vmax            = v1;
+                    lag             = i;
+                }
+                if (v2 > vmax)
+                {
+                    vmax            = v2;
+                    lag             = -ssize_t(i);
+                }
+            }
+
+            // Refine the position of the peak with the parabola over neighbour samples
+            float shift     = 0.0f;
+            if (size >= 4)
+            {
+                float ym        = tmp[((lag - 1) & mask) * 2];
+                float yp        = tmp[((lag + 1) & mask) * 2];
+                float d         = ym - 2.0f*vmax + yp;
+                if (d < 0.0f)
+                {
+                    shift           = 0.5f * (ym - yp) / d;
+                    vmax           -= 0.25f * (ym - yp) * shift;
+                }
+            }
+
+            if (value != NULL)
+                *value          = vmax;
+            return lag + shift;
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_XCORR_H_ */
@@ -0,0 +1,841 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_3DMATH_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_3DMATH_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+        IF_ARCH_X86(
+            static const float matrix3d_const[] __lsp_aligned32 =
+            {
+                LSP_DSP_VEC8(1.0f)
+            };
+        )
+
+        /* V is the register prefix: "y" for two points, "x" for one point
+         * V0 = rx ry rz rw
+         */
+        #define MATRIX3D_HOMOGENIZE(V) \
+            __ASM_EMIT("vshufps         $0xff, %%" V "mm0, %%" V "mm0, %%" V "mm1")     /* V1 = rw rw rw rw */ \
+            __ASM_EMIT("vxorps          %%" V "mm2, %%" V "mm2, %%" V "mm2")            /* V2 = 0 */ \
+            __ASM_EMIT("vcmpps          $0, %%" V "mm2, %%" V "mm1, %%" V "mm2")        /* V2 = [rw == 0] */ \
+            __ASM_EMIT("vandps          %[ONE], %%" V "mm2, %%" V "mm2")                /* V2 = [rw == 0] & 1 */ \
+            __ASM_EMIT("vaddps          %%" V "mm2, %%" V "mm1, %%" V "mm1")            /* V1 = d = (rw == 0) ? 1 : rw */ \
+            __ASM_EMIT("vdivps          %%" V "mm1, %%" V "mm0, %%" V "mm0")            /* V0 = rx/d ry/d rz/d rw/d */
+
+        #define MATRIX3D_AOS_CORE(V, MV, TRANSLATE) \
+            __ASM_EMIT(MV "         (%[src]), %%" V "mm0")                               /* V0 = x y z w */ \
+            __ASM_EMIT("vshufps         $0x55, %%" V "mm0, %%" V "mm0, %%" V "mm1")     /* V1 = y y y y */ \
+            __ASM_EMIT("vshufps         $0xaa, %%" V "mm0, %%" V "mm0, %%" V "mm2")     /* V2 = z z z z */ \
+            __ASM_EMIT("vshufps         $0x00, %%" V "mm0, %%" V "mm0, %%" V "mm0")     /* V0 = x x x x */ \
+            __ASM_EMIT("vmulps          %%" V "mm4, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm1, %%" V "mm1") \
+            __ASM_EMIT("vmulps          %%" V "mm6, %%" V "mm2, %%" V "mm2") \
+            __ASM_EMIT("vaddps          %%" V "mm1, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vaddps          %%" V "mm2, %%" V "mm0, %%" V "mm0") \
+            TRANSLATE(V)                                                                /* V0 = rx ry rz rw */ \
+            MATRIX3D_HOMOGENIZE(V) \
+            __ASM_EMIT(MV "         %%" V "mm0, (%[dst])")
+
+        #define MATRIX3D_AOS_TRANSLATE(V) \
+            __ASM_EMIT("vaddps          %%" V "mm7, %%" V "mm0, %%" V "mm0")
+
+        #define MATRIX3D_AOS_NONE(V)
+
+        #define MATRIX3D_AOS_KERNEL(TRANSLATE) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("vbroadcastf128  0x00(%[m]), %%ymm4")        /* ymm4 = m0  m1  m2  m3  */ \
+                __ASM_EMIT("vbroadcastf128  0x10(%[m]), %%ymm5")        /* ymm5 = m4  m5  m6  m7  */ \
+                __ASM_EMIT("vbroadcastf128  0x20(%[m]), %%ymm6")        /* ymm6 = m8  m9  m10 m11 */ \
+                __ASM_EMIT("vbroadcastf128  0x30(%[m]), %%ymm7")        /* ymm7 = m12 m13 m14 m15 */ \
+                /* 2x blocks */ \
+                __ASM_EMIT("sub             $2, %[n]") \
+                __ASM_EMIT("jb              2f") \
+                __ASM_EMIT("1:") \
+                MATRIX3D_AOS_CORE("y", "vmovups", TRANSLATE) \
+                __ASM_EMIT("add             $0x20, %[src]") \
+                __ASM_EMIT("add             $0x20, %[dst]") \
+                __ASM_EMIT("sub             $2, %[n]") \
+                __ASM_EMIT("jae             1b") \
+                /* 1x block */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("add             $1, %[n]") \
+                __ASM_EMIT("jl              4f") \
+                MATRIX3D_AOS_CORE("x", "vmovups", TRANSLATE) \
+                __ASM_EMIT("4:") \
+                : [dst] "+r" (r), [src] "+r" (src), [n] "+r" (n) \
+                : [m] "r" (m), \
+                  [ONE] "m" (matrix3d_const) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            )
+
+        void apply_matrix3d_mvn(dsp::vector3d_t *r, const dsp::vector3d_t *v, const dsp::matrix3d_t *m, size_t n)
+        {
+            const dsp::vector3d_t *src = v;
+            MATRIX3D_AOS_KERNEL(MATRIX3D_AOS_NONE);
+        }
+
+        void apply_matrix3d_mpn(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n)
+        {
+            const dsp::point3d_t *src = p;
+            MATRIX3D_AOS_KERNEL(MATRIX3D_AOS_TRANSLATE);
+        }
+
+        #undef MATRIX3D_AOS_KERNEL
+        #undef MATRIX3D_AOS_NONE
+        #undef MATRIX3D_AOS_TRANSLATE
+        #undef MATRIX3D_AOS_CORE
+        #undef MATRIX3D_HOMOGENIZE
+
+        /* Calculate one component of the transformed SoA point
+         * V0 = x, V1 = y, V2 = z, V3 = d
+         * Output: V4 = (m[c0]*x + m[c1]*y + m[c2]*z [+ m[c3]]) / d
+         */
+        #define MATRIX3D_SOA_COMP(V, c0, c1, c2, c3, TRANSLATE) \
+            __ASM_EMIT("vbroadcastss    " c0 "(%[m]), %%" V "mm4") \
+            __ASM_EMIT("vbroadcastss    " c1 "(%[m]), %%" V "mm5") \
+            __ASM_EMIT("vmulps          %%" V "mm0, %%" V "mm4, %%" V "mm4") \
+            __ASM_EMIT("vmulps          %%" V "mm1, %%" V "mm5, %%" V "mm5") \
+            __ASM_EMIT("vaddps          %%" V "mm5, %%" V "mm4, %%" V "mm4") \
+            __ASM_EMIT("vbroadcastss    " c2 "(%[m]), %%" V "mm5") \
+            __ASM_EMIT("vmulps          %%" V "mm2, %%" V "mm5, %%" V "mm5") \
+            __ASM_EMIT("vaddps          %%" V "mm5, %%" V "mm4, %%" V "mm4") \
+            TRANSLATE(V, c3, "4") \
+            __ASM_EMIT("vdivps          %%" V "mm3, %%" V "mm4, %%" V "mm4")
+
+        #define MATRIX3D_SOA_TRANSLATE(V, c, R) \
+            __ASM_EMIT("vbroadcastss    " c "(%[m]), %%" V "mm5") \
+            __ASM_EMIT("vaddps          %%" V "mm5, %%" V "mm" R ", %%" V "mm" R)
+
+        #define MATRIX3D_SOA_NONE(V, c, R)
+
+        #define MATRIX3D_SOA_CORE(V, MV, TRANSLATE) \
+            __ASM_EMIT("mov             %[sx], %[t]") \
+            __ASM_EMIT(MV "         (%[t], %[off]), %%" V "mm0")                         /* V0 = x */ \
+            __ASM_EMIT("mov             %[sy], %[t]") \
+            __ASM_EMIT(MV "         (%[t], %[off]), %%" V "mm1")                         /* V1 = y */ \
+            __ASM_EMIT("mov             %[sz], %[t]") \
+            __ASM_EMIT(MV "         (%[t], %[off]), %%" V "mm2")                         /* V2 = z */ \
+            /* Compute the divisor */ \
+            __ASM_EMIT("vbroadcastss    0x0c(%[m]), %%" V "mm3") \
+            __ASM_EMIT("vbroadcastss    0x1c(%[m]), %%" V "mm4") \
+            __ASM_EMIT("vmulps          %%" V "mm0, %%" V "mm3, %%" V "mm3") \
+            __ASM_EMIT("vmulps          %%" V "mm1, %%" V "mm4, %%" V "mm4") \
+            __ASM_EMIT("vaddps          %%" V "mm4, %%" V "mm3, %%" V "mm3") \
+            __ASM_EMIT("vbroadcastss    0x2c(%[m]), %%" V "mm4") \
+            __ASM_EMIT("vmulps          %%" V "mm2, %%" V "mm4, %%" V "mm4") \
+            __ASM_EMIT("vaddps          %%" V "mm4, %%" V "mm3, %%" V "mm3") \
+            TRANSLATE(V, "0x3c", "3")                                                   /* V3 = rw */ \
+            __ASM_EMIT("vxorps          %%" V "mm4, %%" V "mm4, %%" V "mm4") \
+            __ASM_EMIT("vcmpps          $0, %%" V "mm4, %%" V "mm3, %%" V "mm4")        /* V4 = [rw == 0] */ \
+            __ASM_EMIT("vandps          %[ONE], %%" V "mm4, %%" V "mm4") \
+            __ASM_EMIT("vaddps          %%" V "mm4, %%" V "mm3, %%" V "mm3")            /* V3 = d = (rw == 0) ? 1 : rw */ \
+            /* Compute components */ \
+            MATRIX3D_SOA_COMP(V, "0x00", "0x10", "0x20", "0x30", TRANSLATE) \
+            __ASM_EMIT("mov             %[dx], %[t]") \
+            __ASM_EMIT(MV "         %%" V "mm4, (%[t], %[off])") \
+            MATRIX3D_SOA_COMP(V, "0x04", "0x14", "0x24", "0x34", TRANSLATE) \
+            __ASM_EMIT("mov             %[dy], %[t]") \
+            __ASM_EMIT(MV "         %%" V "mm4, (%[t], %[off])") \
+            MATRIX3D_SOA_COMP(V, "0x08", "0x18", "0x28", "0x38", TRANSLATE) \
+            __ASM_EMIT("mov             %[dz], %[t]") \
+            __ASM_EMIT(MV "         %%" V "mm4, (%[t], %[off])")
+
+        #define MATRIX3D_SOA_KERNEL(TRANSLATE) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("xor             %[off], %[off]") \
+                /* 8x blocks */ \
+                __ASM_EMIT("sub             $8, %[n]") \
+                __ASM_EMIT("jb              2f") \
+                __ASM_EMIT("1:") \
+                MATRIX3D_SOA_CORE("y", "vmovups", TRANSLATE) \
+                __ASM_EMIT("add             $0x20, %[off]") \
+                __ASM_EMIT("sub             $8, %[n]") \
+                __ASM_EMIT("jae             1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("add             $7, %[n]") \
+                __ASM_EMIT("jl              4f") \
+                __ASM_EMIT("3:") \
+                MATRIX3D_SOA_CORE("x", "vmovss ", TRANSLATE) \
+                __ASM_EMIT("add             $0x04, %[off]") \
+                __ASM_EMIT("dec             %[n]") \
+                __ASM_EMIT("jge             3b") \
+                __ASM_EMIT("4:") \
+                : [n] "+r" (n), [off] "=&r" (off), [t] "=&r" (t) \
+                : [m] "r" (m), \
+                  [dx] "m" (dx), [dy] "m" (dy), [dz] "m" (dz), \
+                  [sx] "m" (sx), [sy] "m" (sy), [sz] "m" (sz), \
+                  [ONE] "m" (matrix3d_const) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5" \
+            )
+
+        void apply_matrix3d_mv_soa(dsp::vector3d_soa_t *dst, const dsp::vector3d_soa_t *src, const dsp::matrix3d_t *m, size_t n)
+        {
+            IF_ARCH_X86(
+                size_t off, t;
+                float *dx = dst->dx, *dy = dst->dy, *dz = dst->dz;
+                const float *sx = src->dx, *sy = src->dy, *sz = src->dz;
+            );
+            MATRIX3D_SOA_KERNEL(MATRIX3D_SOA_NONE);
+        }
+
+        void apply_matrix3d_mp_soa(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n)
+        {
+            IF_ARCH_X86(
+                size_t off, t;
+                float *dx = dst->x, *dy = dst->y, *dz = dst->z;
+                const float *sx = src->x, *sy = src->y, *sz = src->z;
+            );
+            MATRIX3D_SOA_KERNEL(MATRIX3D_SOA_TRANSLATE);
+        }
+
+        #undef MATRIX3D_SOA_KERNEL
+        #undef MATRIX3D_SOA_CORE
+        #undef MATRIX3D_SOA_NONE
+        #undef MATRIX3D_SOA_TRANSLATE
+        #undef MATRIX3D_SOA_COMP
+
+        IF_ARCH_X86(
+            static const float soa3d_const[] __lsp_aligned32 =
+            {
+                LSP_DSP_VEC8(1.0f),                     // 1.0
+                LSP_DSP_VEC8(DSP_3D_TOLERANCE),         // +TOL
+                LSP_DSP_VEC8(-DSP_3D_TOLERANCE)         // -TOL
+            };
+        )
+
+        /* Load the value from the array at the current offset */
+        #define SOA3D_LOAD(MV, A, R) \
+            __ASM_EMIT("mov             " A ", %[t]") \
+            __ASM_EMIT(MV "         (%[t], %[off]), " R)
+
+        #define SOA3D_STORE(MV, R, A) \
+            __ASM_EMIT("mov             " A ", %[t]") \
+            __ASM_EMIT(MV "         " R ", (%[t], %[off])")
+
+        /* The generic loop over SoA elements with 8x, 4x and 1x blocks,
+         * BODY(V, MV) is called with the register prefix and the move instruction
+         */
+        #define SOA3D_LOOP(BODY) \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("sub             $8, %[n]") \
+            __ASM_EMIT("jb              2f") \
+            /* 8x blocks */ \
+            __ASM_EMIT("1:") \
+            BODY("y", "vmovups") \
+            __ASM_EMIT("add             $0x20, %[off]") \
+            __ASM_EMIT("sub             $8, %[n]") \
+            __ASM_EMIT("jae             1b") \
+            /* 4x block */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add             $4, %[n]") \
+            __ASM_EMIT("jl              4f") \
+            BODY("x", "vmovups") \
+            __ASM_EMIT("add             $0x10, %[off]") \
+            __ASM_EMIT("sub             $4, %[n]") \
+            /* 1x blocks */ \
+            __ASM_EMIT("4:") \
+            __ASM_EMIT("add             $3, %[n]") \
+            __ASM_EMIT("jl              6f") \
+            __ASM_EMIT("5:") \
+            BODY("x", "vmovss ") \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("dec             %[n]") \
+            __ASM_EMIT("jge             5b") \
+            __ASM_EMIT("6:")
+
+        #define SOA3D_DISTANCE(V, MV) \
+            SOA3D_LOAD(MV, "%[x1]", "%%" V "mm0") \
+            SOA3D_LOAD(MV, "%[y1]", "%%" V "mm1") \
+            SOA3D_LOAD(MV, "%[z1]", "%%" V "mm2") \
+            SOA3D_LOAD(MV, "%[x2]", "%%" V "mm3") \
+            SOA3D_LOAD(MV, "%[y2]", "%%" V "mm4") \
+            SOA3D_LOAD(MV, "%[z2]", "%%" V "mm5") \
+            __ASM_EMIT("vsubps          %%" V "mm0, %%" V "mm3, %%" V "mm3")            /* V3 = dx */ \
+            __ASM_EMIT("vsubps          %%" V "mm1, %%" V "mm4, %%" V "mm4")            /* V4 = dy */ \
+            __ASM_EMIT("vsubps          %%" V "mm2, %%" V "mm5, %%" V "mm5")            /* V5 = dz */ \
+            __ASM_EMIT("vmulps          %%" V "mm3, %%" V "mm3, %%" V "mm3")            /* V3 = dx*dx */ \
+            __ASM_EMIT("vmulps          %%" V "mm4, %%" V "mm4, %%" V "mm4")            /* V4 = dy*dy */ \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm5, %%" V "mm5")            /* V5 = dz*dz */ \
+            __ASM_EMIT("vaddps          %%" V "mm4, %%" V "mm3, %%" V "mm3") \
+            __ASM_EMIT("vaddps          %%" V "mm5, %%" V "mm3, %%" V "mm3") \
+            __ASM_EMIT("vsqrtps         %%" V "mm3, %%" V "mm3")                        /* V3 = sqrt(dx*dx + dy*dy + dz*dz) */ \
+            SOA3D_STORE(MV, "%%" V "mm3", "%[dst]")
+
+        void calc_distance_soa(float *dst, const dsp::point3d_soa_t *p1, const dsp::point3d_soa_t *p2, size_t n)
+        {
+            IF_ARCH_X86(size_t off; float *ptr);
+
+            ARCH_X86_ASM
+            (
+                SOA3D_LOOP(SOA3D_DISTANCE)
+                : [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [dst] "m" (dst),
+                  [x1] "m" (p1->x), [y1] "m" (p1->y), [z1] "m" (p1->z),
+                  [x2] "m" (p2->x), [y2] "m" (p2->y), [z2] "m" (p2->z)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5"
+            );
+        }
+
+        #undef SOA3D_DISTANCE
+
+        /* Compute the cross product of two triangle edges:
+         *   d0 = v1 - v0, d1 = v2 - A, where A is v0 (V0..V2) or v1 (V3..V5)
+         * Output: V1 = nx, V2 = ny, V3 = nz, V4 = l = sqrt(nx*nx + ny*ny + nz*nz)
+         */
+        #define SOA3D_CROSS(V, MV, A0, A1, A2) \
+            SOA3D_LOAD(MV, "%[x0]", "%%" V "mm0")                                       /* V0 = x0 */ \
+            SOA3D_LOAD(MV, "%[y0]", "%%" V "mm1")                                       /* V1 = y0 */ \
+            SOA3D_LOAD(MV, "%[z0]", "%%" V "mm2")                                       /* V2 = z0 */ \
+            SOA3D_LOAD(MV, "%[x1]", "%%" V "mm3")                                       /* V3 = x1 */ \
+            SOA3D_LOAD(MV, "%[y1]", "%%" V "mm4")                                       /* V4 = y1 */ \
+            SOA3D_LOAD(MV, "%[z1]", "%%" V "mm5")                                       /* V5 = z1 */ \
+            SOA3D_LOAD(MV, "%[x2]", "%%" V "mm6")                                       /* V6 = x2 */ \
+            SOA3D_LOAD(MV, "%[y2]", "%%" V "mm7")                                       /* V7 = y2 */ \
+            __ASM_EMIT("vsubps          %%" V "mm" A0 ", %%" V "mm6, %%" V "mm6")       /* V6 = d1x */ \
+            __ASM_EMIT("vsubps          %%" V "mm" A1 ", %%" V "mm7, %%" V "mm7")       /* V7 = d1y */ \
+            __ASM_EMIT("vsubps          %%" V "mm0, %%" V "mm3, %%" V "mm3")            /* V3 = d0x */ \
+            __ASM_EMIT("vsubps          %%" V "mm1, %%" V "mm4, %%" V "mm4")            /* V4 = d0y */ \
+            __ASM_EMIT("vmovaps         %%" V "mm" A2 ", %%" V "mm1")                   /* V1 = z0 or z1 */ \
+            SOA3D_LOAD(MV, "%[z2]", "%%" V "mm0")                                       /* V0 = z2 */ \
+            __ASM_EMIT("vsubps          %%" V "mm2, %%" V "mm5, %%" V "mm5")            /* V5 = d0z */ \
+            __ASM_EMIT("vsubps          %%" V "mm1, %%" V "mm0, %%" V "mm0")            /* V0 = d1z */ \
+            __ASM_EMIT("vmulps          %%" V "mm0, %%" V "mm4, %%" V "mm1")            /* V1 = d0y*d1z */ \
+            __ASM_EMIT("vmulps          %%" V "mm7, %%" V "mm5, %%" V "mm2")            /* V2 = d0z*d1y */ \
+            __ASM_EMIT("vsubps          %%" V "mm2, %%" V "mm1, %%" V "mm1")            /* V1 = nx = d0y*d1z - d0z*d1y */ \
+            __ASM_EMIT("vmulps          %%" V "mm6, %%" V "mm5, %%" V "mm2")            /* V2 = d0z*d1x */ \
+            __ASM_EMIT("vmulps          %%" V "mm3, %%" V "mm0, %%" V "mm0")            /* V0 = d0x*d1z */ \
+            __ASM_EMIT("vsubps          %%" V "mm0, %%" V "mm2, %%" V "mm2")            /* V2 = ny = d0z*d1x - d0x*d1z */ \
+            __ASM_EMIT("vmulps          %%" V "mm7, %%" V "mm3, %%" V "mm3")            /* V3 = d0x*d1y */ \
+            __ASM_EMIT("vmulps          %%" V "mm6, %%" V "mm4, %%" V "mm4")            /* V4 = d0y*d1x */ \
+            __ASM_EMIT("vsubps          %%" V "mm4, %%" V "mm3, %%" V "mm3")            /* V3 = nz = d0x*d1y - d0y*d1x */ \
+            /* Compute the length */ \
+            __ASM_EMIT("vmulps          %%" V "mm1, %%" V "mm1, %%" V "mm4")            /* V4 = nx*nx */ \
+            __ASM_EMIT("vmulps          %%" V "mm2, %%" V "mm2, %%" V "mm5")            /* V5 = ny*ny */ \
+            __ASM_EMIT("vmulps          %%" V "mm3, %%" V "mm3, %%" V "mm6")            /* V6 = nz*nz */ \
+            __ASM_EMIT("vaddps          %%" V "mm5, %%" V "mm4, %%" V "mm4") \
+            __ASM_EMIT("vaddps          %%" V "mm6, %%" V "mm4, %%" V "mm4") \
+            __ASM_EMIT("vsqrtps         %%" V "mm4, %%" V "mm4")                        /* V4 = l */
+
+        #define SOA3D_AREA(V, MV) \
+            SOA3D_CROSS(V, MV, "0", "1", "2") \
+            SOA3D_STORE(MV, "%%" V "mm4", "%[dst]")
+
+        void calc_area_soa(float *dst, const dsp::raw_triangle_soa_t *t, size_t n)
+        {
+            IF_ARCH_X86(size_t off; float *ptr);
+
+            ARCH_X86_ASM
+            (
+                SOA3D_LOOP(SOA3D_AREA)
+                : [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [dst] "m" (dst),
+                  [x0] "m" (t->v[0].x), [y0] "m" (t->v[0].y), [z0] "m" (t->v[0].z),
+                  [x1] "m" (t->v[1].x), [y1] "m" (t->v[1].y), [z1] "m" (t->v[1].z),
+                  [x2] "m" (t->v[2].x), [y2] "m" (t->v[2].y), [z2] "m" (t->v[2].z)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #define SOA3D_NORMAL(V, MV) \
+            SOA3D_CROSS(V, MV, "3", "4", "5") \
+            __ASM_EMIT("vxorps          %%" V "mm6, %%" V "mm6, %%" V "mm6")            /* V6 = 0 */ \
+            __ASM_EMIT("vmovaps         0x00 + %[C], %%" V "mm5")                       /* V5 = 1 */ \
+            __ASM_EMIT("vcmpps          $1, %%" V "mm4, %%" V "mm6, %%" V "mm6")        /* V6 = [l > 0] */ \
+            __ASM_EMIT("vdivps          %%" V "mm4, %%" V "mm5, %%" V "mm5")            /* V5 = 1/l */ \
+            __ASM_EMIT("vandps          %%" V "mm6, %%" V "mm5, %%" V "mm5")            /* V5 = 1/l & [l > 0] */ \
+            __ASM_EMIT("vandnps         0x00 + %[C], %%" V "mm6, %%" V "mm6")           /* V6 = 1 & [l <= 0] */ \
+            __ASM_EMIT("vorps           %%" V "mm6, %%" V "mm5, %%" V "mm5")            /* V5 = k = (l > 0) ? 1/l : 1 */ \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm1, %%" V "mm1") \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm2, %%" V "mm2") \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm3, %%" V "mm3") \
+            SOA3D_STORE(MV, "%%" V "mm1", "%[dx]") \
+            SOA3D_STORE(MV, "%%" V "mm2", "%[dy]") \
+            SOA3D_STORE(MV, "%%" V "mm3", "%[dz]")
+
+        void calc_normal3d_soa(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n)
+        {
+            IF_ARCH_X86(
+                size_t off; float *ptr;
+                // Local copy keeps the destination operands frame-relative at -O0
+                float *D[3] = { dst->dx, dst->dy, dst->dz };
+            );
+
+            ARCH_X86_ASM
+            (
+                SOA3D_LOOP(SOA3D_NORMAL)
+                : [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [dx] "m" (D[0]), [dy] "m" (D[1]), [dz] "m" (D[2]),
+                  [x0] "m" (t->v[0].x), [y0] "m" (t->v[0].y), [z0] "m" (t->v[0].z),
+                  [x1] "m" (t->v[1].x), [y1] "m" (t->v[1].y), [z1] "m" (t->v[1].z),
+                  [x2] "m" (t->v[2].x), [y2] "m" (t->v[2].y), [z2] "m" (t->v[2].z),
+                  [C] "o" (soa3d_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef SOA3D_NORMAL
+        #undef SOA3D_AREA
+        #undef SOA3D_CROSS
+
+        /* Compute the colocation tag of the vertex and the plane as float:
+         *   k = x*dx + y*dy + z*dz + dw, tag = [k <= +TOL] + [k < -TOL]
+         * V4 = dx, V5 = dy, V6 = dz, V7 = dw
+         * Output: V0 = tag
+         */
+        #define SOA3D_COLOCATE(V, MV, X, Y, Z) \
+            SOA3D_LOAD(MV, X, "%%" V "mm0")                                             /* V0 = x */ \
+            SOA3D_LOAD(MV, Y, "%%" V "mm1")                                             /* V1 = y */ \
+            SOA3D_LOAD(MV, Z, "%%" V "mm2")                                             /* V2 = z */ \
+            __ASM_EMIT("vmulps          %%" V "mm4, %%" V "mm0, %%" V "mm0")            /* V0 = x*dx */ \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm1, %%" V "mm1")            /* V1 = y*dy */ \
+            __ASM_EMIT("vmulps          %%" V "mm6, %%" V "mm2, %%" V "mm2")            /* V2 = z*dz */ \
+            __ASM_EMIT("vaddps          %%" V "mm1, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vaddps          %%" V "mm2, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vaddps          %%" V "mm7, %%" V "mm0, %%" V "mm0")            /* V0 = k */ \
+            __ASM_EMIT("vcmpps          $2, 0x20 + %[C], %%" V "mm0, %%" V "mm1")       /* V1 = [k <= +TOL] */ \
+            __ASM_EMIT("vcmpps          $1, 0x40 + %[C], %%" V "mm0, %%" V "mm2")       /* V2 = [k < -TOL] */ \
+            __ASM_EMIT("vandps          0x00 + %[C], %%" V "mm1, %%" V "mm1") \
+            __ASM_EMIT("vandps          0x00 + %[C], %%" V "mm2, %%" V "mm2") \
+            __ASM_EMIT("vaddps          %%" V "mm2, %%" V "mm1, %%" V "mm0")            /* V0 = tag */
+
+        /* The tags are accumulated as floats, all values are exact integers */
+        #define SOA3D_COLOCATION(V, MV) \
+            SOA3D_COLOCATE(V, MV, "%[x2]", "%[y2]", "%[z2]") \
+            __ASM_EMIT("vaddps          %%" V "mm0, %%" V "mm0, %%" V "mm3")            /* V3 = tag2*2 */ \
+            SOA3D_COLOCATE(V, MV, "%[x1]", "%[y1]", "%[z1]") \
+            __ASM_EMIT("vaddps          %%" V "mm3, %%" V "mm3, %%" V "mm3")            /* V3 = tag2*4 */ \
+            __ASM_EMIT("vaddps          %%" V "mm0, %%" V "mm3, %%" V "mm3")            /* V3 = tag2*4 + tag1 */ \
+            __ASM_EMIT("vaddps          %%" V "mm3, %%" V "mm3, %%" V "mm3") \
+            __ASM_EMIT("vaddps          %%" V "mm3, %%" V "mm3, %%" V "mm3")            /* V3 = tag2*16 + tag1*4 */ \
+            SOA3D_COLOCATE(V, MV, "%[x0]", "%[y0]", "%[z0]") \
+            __ASM_EMIT("vaddps          %%" V "mm0, %%" V "mm3, %%" V "mm3")            /* V3 = tag2*16 + tag1*4 + tag0 */ \
+            __ASM_EMIT("vcvttps2dq      %%" V "mm3, %%" V "mm3") \
+            SOA3D_STORE(MV, "%%" V "mm3", "%[dst]")
+
+        void colocation_x3_v1_soa(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n)
+        {
+            IF_ARCH_X86(size_t off; float *ptr);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vbroadcastss    0x00(%[pl]), %%ymm4")                       /* ymm4 = dx */
+                __ASM_EMIT("vbroadcastss    0x04(%[pl]), %%ymm5")                       /* ymm5 = dy */
+                __ASM_EMIT("vbroadcastss    0x08(%[pl]), %%ymm6")                       /* ymm6 = dz */
+                __ASM_EMIT("vbroadcastss    0x0c(%[pl]), %%ymm7")                       /* ymm7 = dw */
+                SOA3D_LOOP(SOA3D_COLOCATION)
+                : [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [dst] "m" (dst), [pl] "r" (pl),
+                  [x0] "m" (t->v[0].x), [y0] "m" (t->v[0].y), [z0] "m" (t->v[0].z),
+                  [x1] "m" (t->v[1].x), [y1] "m" (t->v[1].y), [z1] "m" (t->v[1].z),
+                  [x2] "m" (t->v[2].x), [y2] "m" (t->v[2].y), [z2] "m" (t->v[2].z),
+                  [C] "o" (soa3d_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef SOA3D_COLOCATION
+        #undef SOA3D_COLOCATE
+        #undef SOA3D_LOOP
+        #undef SOA3D_STORE
+        #undef SOA3D_LOAD
+
+        IF_ARCH_X86(
+            static const float aos3d_const[] __lsp_aligned32 =
+            {
+                LSP_DSP_VEC8(1.0f),                     // 1.0
+                LSP_DSP_VEC8(1.0f / 3.0f)               // 1/3
+            };
+
+            static const uint32_t aos3d_mask[] __lsp_aligned32 =
+            {
+                0xffffffff, 0xffffffff, 0xffffffff, 0,
+                0xffffffff, 0xffffffff, 0xffffffff, 0
+            };
+        )
+
+        /* Load the vector at the offset OFF from PTR into register R,
+         * the 'y' variant also loads the vector at the offset OFF + STEP into the upper half of R
+         */
+        #define AOS3D_LOAD_Y(OFF, STEP, PTR, R) \
+            __ASM_EMIT("vmovups         " OFF "(%[" PTR "]), %%xmm" R) \
+            __ASM_EMIT("vinsertf128     $1, " OFF " + " STEP "(%[" PTR "]), %%ymm" R ", %%ymm" R)
+
+        #define AOS3D_LOAD_X(OFF, STEP, PTR, R) \
+            __ASM_EMIT("vmovups         " OFF "(%[" PTR "]), %%xmm" R)
+
+        #define AOS3D_STORE_Y(R, OFF, STEP, PTR) \
+            __ASM_EMIT("vmovups         %%xmm" R ", " OFF "(%[" PTR "])") \
+            __ASM_EMIT("vextractf128    $1, %%ymm" R ", " OFF " + " STEP "(%[" PTR "])")
+
+        #define AOS3D_STORE_X(R, OFF, STEP, PTR) \
+            __ASM_EMIT("vmovups         %%xmm" R ", " OFF "(%[" PTR "])")
+
+        /* Compute squared lengths of vectors V0..V3 with dw = 0:
+         * V0 = |V0|^2 |V1|^2 |V2|^2 |V3|^2 for each 128-bit lane
+         */
+        #define AOS3D_SQR_LENGTH(V) \
+            __ASM_EMIT("vmulps          %%" V "mm0, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vmulps          %%" V "mm1, %%" V "mm1, %%" V "mm1") \
+            __ASM_EMIT("vmulps          %%" V "mm2, %%" V "mm2, %%" V "mm2") \
+            __ASM_EMIT("vmulps          %%" V "mm3, %%" V "mm3, %%" V "mm3") \
+            __ASM_EMIT("vhaddps         %%" V "mm1, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vhaddps         %%" V "mm3, %%" V "mm2, %%" V "mm2") \
+            __ASM_EMIT("vhaddps         %%" V "mm2, %%" V "mm0, %%" V "mm0")
+
+        /* Compute distances between sp (V7) and 4 points with stride STEP for each 128-bit lane */
+        #define DISTANCE_P1N_CORE(V, LOAD, STEP, SQRT) \
+            LOAD("0x00", STEP, "p", "0") \
+            LOAD("0x10", STEP, "p", "1") \
+            LOAD("0x20", STEP, "p", "2") \
+            LOAD("0x30", STEP, "p", "3") \
+            __ASM_EMIT("vsubps          %%" V "mm7, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vsubps          %%" V "mm7, %%" V "mm1, %%" V "mm1") \
+            __ASM_EMIT("vsubps          %%" V "mm7, %%" V "mm2, %%" V "mm2") \
+            __ASM_EMIT("vsubps          %%" V "mm7, %%" V "mm3, %%" V "mm3") \
+            __ASM_EMIT("vandps          %%" V "mm6, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vandps          %%" V "mm6, %%" V "mm1, %%" V "mm1") \
+            __ASM_EMIT("vandps          %%" V "mm6, %%" V "mm2, %%" V "mm2") \
+            __ASM_EMIT("vandps          %%" V "mm6, %%" V "mm3, %%" V "mm3")            /* V0..V3 = d = p - sp */ \
+            AOS3D_SQR_LENGTH(V) \
+            __ASM_EMIT(SQRT) \
+            __ASM_EMIT("vmovups         %%" V "mm0, (%[dst])")
+
+        #define DISTANCE_P1N(SQRT_Y, SQRT_X) \
+            __ASM_EMIT("vbroadcastf128  %[sp], %%ymm7")                                 /* ymm7 = sp */ \
+            __ASM_EMIT("vmovaps         %[MASK], %%ymm6")                               /* ymm6 = 3D mask */ \
+            /* 8x blocks */ \
+            __ASM_EMIT("sub             $8, %[n]") \
+            __ASM_EMIT("jb              2f") \
+            __ASM_EMIT("1:") \
+            DISTANCE_P1N_CORE("y", AOS3D_LOAD_Y, "0x40", SQRT_Y) \
+            __ASM_EMIT("add             $0x80, %[p]") \
+            __ASM_EMIT("add             $0x20, %[dst]") \
+            __ASM_EMIT("sub             $8, %[n]") \
+            __ASM_EMIT("jae             1b") \
+            /* 4x block */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add             $4, %[n]") \
+            __ASM_EMIT("jl              4f") \
+            DISTANCE_P1N_CORE("x", AOS3D_LOAD_X, "0x40", SQRT_X) \
+            __ASM_EMIT("add             $0x40, %[p]") \
+            __ASM_EMIT("add             $0x10, %[dst]") \
+            __ASM_EMIT("sub             $4, %[n]") \
+            /* 1x blocks */ \
+            __ASM_EMIT("4:") \
+            __ASM_EMIT("add             $3, %[n]") \
+            __ASM_EMIT("jl              6f") \
+            __ASM_EMIT("5:") \
+            __ASM_EMIT("vmovups         (%[p]), %%xmm0") \
+            __ASM_EMIT("vsubps          %%xmm7, %%xmm0, %%xmm0") \
+            __ASM_EMIT("vandps          %%xmm6, %%xmm0, %%xmm0")                        /* xmm0 = d = p - sp */ \
+            __ASM_EMIT("vmulps          %%xmm0, %%xmm0, %%xmm0") \
+            __ASM_EMIT("vhaddps         %%xmm0, %%xmm0, %%xmm0") \
+            __ASM_EMIT("vhaddps         %%xmm0, %%xmm0, %%xmm0")                        /* xmm0 = dx*dx + dy*dy + dz*dz */ \
+            __ASM_EMIT(SQRT_X) \
+            __ASM_EMIT("vmovss          %%xmm0, (%[dst])") \
+            __ASM_EMIT("add             $0x10, %[p]") \
+            __ASM_EMIT("add             $0x04, %[dst]") \
+            __ASM_EMIT("dec             %[n]") \
+            __ASM_EMIT("jge             5b") \
+            __ASM_EMIT("6:")
+
+        void calc_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                DISTANCE_P1N("vsqrtps         %%ymm0, %%ymm0", "vsqrtps         %%xmm0, %%xmm0")
+                : [dst] "+r" (dst), [p] "+r" (p), [n] "+r" (n)
+                : [sp] "m" (*sp),
+                  [MASK] "m" (aos3d_mask)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6", "%xmm7"
+            );
+        }
+
+        void calc_sqr_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                DISTANCE_P1N("", "")
+                : [dst] "+r" (dst), [p] "+r" (p), [n] "+r" (n)
+                : [sp] "m" (*sp),
+                  [MASK] "m" (aos3d_mask)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef DISTANCE_P1N
+        #undef DISTANCE_P1N_CORE
+
+        /* Compute R = (pv[0] + pv[1] + pv[2]) / 3 - sp for the triangle at offset OFF
+         * V4 is used as temporary, V7 = sp
+         */
+        #define TRIANGLE_CENTER(V, LOAD, OFF, STEP, R) \
+            LOAD(OFF " + 0x00", STEP, "pv", R) \
+            LOAD(OFF " + 0x10", STEP, "pv", "4") \
+            __ASM_EMIT("vaddps          %%" V "mm4, %%" V "mm" R ", %%" V "mm" R) \
+            LOAD(OFF " + 0x20", STEP, "pv", "4") \
+            __ASM_EMIT("vaddps          %%" V "mm4, %%" V "mm" R ", %%" V "mm" R) \
+            __ASM_EMIT("vmulps          0x20 + %[C], %%" V "mm" R ", %%" V "mm" R) \
+            __ASM_EMIT("vsubps          %%" V "mm7, %%" V "mm" R ", %%" V "mm" R) \
+            __ASM_EMIT("vandps          %[MASK], %%" V "mm" R ", %%" V "mm" R)
+
+        #define TRIANGLE_CENTER_X4(V, LOAD, STEP) \
+            TRIANGLE_CENTER(V, LOAD, "0x00", STEP, "0") \
+            TRIANGLE_CENTER(V, LOAD, "0x30", STEP, "1") \
+            TRIANGLE_CENTER(V, LOAD, "0x60", STEP, "2") \
+            TRIANGLE_CENTER(V, LOAD, "0x90", STEP, "3")
+
+        #define AVG_DISTANCE_CORE(V, LOAD) \
+            TRIANGLE_CENTER_X4(V, LOAD, "0xc0") \
+            AOS3D_SQR_LENGTH(V) \
+            __ASM_EMIT("vsqrtps         %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vmovups         %%" V "mm0, (%[dst])")
+
+        void calc_avg_distance_pvn(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vbroadcastf128  %[sp], %%ymm7")                             /* ymm7 = sp */
+                /* 8x blocks */
+                __ASM_EMIT("sub             $8, %[n]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                AVG_DISTANCE_CORE("y", AOS3D_LOAD_Y)
+                __ASM_EMIT("add             $0x180, %[pv]")
+                __ASM_EMIT("add             $0x20, %[dst]")
+                __ASM_EMIT("sub             $8, %[n]")
+                __ASM_EMIT("jae             1b")
+                /* 4x block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add             $4, %[n]")
+                __ASM_EMIT("jl              4f")
+                AVG_DISTANCE_CORE("x", AOS3D_LOAD_X)
+                __ASM_EMIT("add             $0xc0, %[pv]")
+                __ASM_EMIT("add             $0x10, %[dst]")
+                __ASM_EMIT("sub             $4, %[n]")
+                /* 1x blocks */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add             $3, %[n]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("5:")
+                TRIANGLE_CENTER("x", AOS3D_LOAD_X, "0x00", "0x30", "0")
+                __ASM_EMIT("vmulps          %%xmm0, %%xmm0, %%xmm0")
+                __ASM_EMIT("vhaddps         %%xmm0, %%xmm0, %%xmm0")
+                __ASM_EMIT("vhaddps         %%xmm0, %%xmm0, %%xmm0")                    /* xmm0 = dx*dx + dy*dy + dz*dz */
+                __ASM_EMIT("vsqrtss         %%xmm0, %%xmm0, %%xmm0")
+                __ASM_EMIT("vmovss          %%xmm0, (%[dst])")
+                __ASM_EMIT("add             $0x30, %[pv]")
+                __ASM_EMIT("add             $0x04, %[dst]")
+                __ASM_EMIT("dec             %[n]")
+                __ASM_EMIT("jge             5b")
+                __ASM_EMIT("6:")
+                : [dst] "+r" (dst), [pv] "+r" (pv), [n] "+r" (n)
+                : [sp] "m" (*sp),
+                  [C] "o" (aos3d_const),
+                  [MASK] "m" (aos3d_mask)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm7"
+            );
+        }
+
+        #undef AVG_DISTANCE_CORE
+
+        /* Normalize vectors V0..V3 with dw = 0, V4, V5 and V6 are used as temporaries */
+        #define UNIT_VECTOR_CORE(V) \
+            __ASM_EMIT("vmulps          %%" V "mm0, %%" V "mm0, %%" V "mm4") \
+            __ASM_EMIT("vmulps          %%" V "mm1, %%" V "mm1, %%" V "mm5") \
+            __ASM_EMIT("vhaddps         %%" V "mm5, %%" V "mm4, %%" V "mm4") \
+            __ASM_EMIT("vmulps          %%" V "mm2, %%" V "mm2, %%" V "mm5") \
+            __ASM_EMIT("vmulps          %%" V "mm3, %%" V "mm3, %%" V "mm6") \
+            __ASM_EMIT("vhaddps         %%" V "mm6, %%" V "mm5, %%" V "mm5") \
+            __ASM_EMIT("vhaddps         %%" V "mm5, %%" V "mm4, %%" V "mm4")            /* V4 = W2 */ \
+            __ASM_EMIT("vxorps          %%" V "mm6, %%" V "mm6, %%" V "mm6")            /* V6 = 0 */ \
+            __ASM_EMIT("vsqrtps         %%" V "mm4, %%" V "mm4")                        /* V4 = W */ \
+            __ASM_EMIT("vmovaps         0x00 + %[C], %%" V "mm5")                       /* V5 = 1 */ \
+            __ASM_EMIT("vcmpps          $4, %%" V "mm6, %%" V "mm4, %%" V "mm6")        /* V6 = [W != 0] */ \
+            __ASM_EMIT("vandps          %%" V "mm6, %%" V "mm4, %%" V "mm4")            /* V4 = W & [W != 0] */ \
+            __ASM_EMIT("vandnps         %%" V "mm5, %%" V "mm6, %%" V "mm6")            /* V6 = 1 & [W == 0] */ \
+            __ASM_EMIT("vorps           %%" V "mm6, %%" V "mm4, %%" V "mm4")            /* V4 = (W != 0) ? W : 1 */ \
+            __ASM_EMIT("vdivps          %%" V "mm4, %%" V "mm5, %%" V "mm4")            /* V4 = k = 1/W */ \
+            __ASM_EMIT("vshufps         $0x00, %%" V "mm4, %%" V "mm4, %%" V "mm5") \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vshufps         $0x55, %%" V "mm4, %%" V "mm4, %%" V "mm5") \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm1, %%" V "mm1") \
+            __ASM_EMIT("vshufps         $0xaa, %%" V "mm4, %%" V "mm4, %%" V "mm5") \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm2, %%" V "mm2") \
+            __ASM_EMIT("vshufps         $0xff, %%" V "mm4, %%" V "mm4, %%" V "mm5") \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm3, %%" V "mm3")
+
+        #define UNIT_VECTOR_P1PVN_CORE(V, LOAD, STORE) \
+            TRIANGLE_CENTER_X4(V, LOAD, "0xc0") \
+            UNIT_VECTOR_CORE(V) \
+            STORE("0", "0x00", "0x40", "v") \
+            STORE("1", "0x10", "0x40", "v") \
+            STORE("2", "0x20", "0x40", "v") \
+            STORE("3", "0x30", "0x40", "v")
+
+        void unit_vector_p1pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vbroadcastf128  %[sp], %%ymm7")                             /* ymm7 = sp */
+                /* 8x blocks */
+                __ASM_EMIT("sub             $8, %[n]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                UNIT_VECTOR_P1PVN_CORE("y", AOS3D_LOAD_Y, AOS3D_STORE_Y)
+                __ASM_EMIT("add             $0x180, %[pv]")
+                __ASM_EMIT("add             $0x80, %[v]")
+                __ASM_EMIT("sub             $8, %[n]")
+                __ASM_EMIT("jae             1b")
+                /* 4x block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add             $4, %[n]")
+                __ASM_EMIT("jl              4f")
+                UNIT_VECTOR_P1PVN_CORE("x", AOS3D_LOAD_X, AOS3D_STORE_X)
+                __ASM_EMIT("add             $0xc0, %[pv]")
+                __ASM_EMIT("add             $0x40, %[v]")
+                __ASM_EMIT("sub             $4, %[n]")
+                /* 1x blocks */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add             $3, %[n]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("5:")
+                TRIANGLE_CENTER("x", AOS3D_LOAD_X, "0x00", "0x30", "0")
+                __ASM_EMIT("vmulps          %%xmm0, %%xmm0, %%xmm4")
+                __ASM_EMIT("vhaddps         %%xmm4, %%xmm4, %%xmm4")
+                __ASM_EMIT("vhaddps         %%xmm4, %%xmm4, %%xmm4")                    /* xmm4 = W2 */
+                __ASM_EMIT("vxorps          %%xmm6, %%xmm6, %%xmm6")                    /* xmm6 = 0 */
+                __ASM_EMIT("vsqrtps         %%xmm4, %%xmm4")                            /* xmm4 = W */
+                __ASM_EMIT("vmovaps         0x00 + %[C], %%xmm5")                       /* xmm5 = 1 */
+                __ASM_EMIT("vcmpps          $4, %%xmm6, %%xmm4, %%xmm6")                /* xmm6 = [W != 0] */
+                __ASM_EMIT("vandps          %%xmm6, %%xmm4, %%xmm4")                    /* xmm4 = W & [W != 0] */
+                __ASM_EMIT("vandnps         %%xmm5, %%xmm6, %%xmm6")                    /* xmm6 = 1 & [W == 0] */
+                __ASM_EMIT("vorps           %%xmm6, %%xmm4, %%xmm4")                    /* xmm4 = (W != 0) ? W : 1 */
+                __ASM_EMIT("vdivps          %%xmm4, %%xmm5, %%xmm4")                    /* xmm4 = k = 1/W */
+                __ASM_EMIT("vmulps          %%xmm4, %%xmm0, %%xmm0")
+                __ASM_EMIT("vmovups         %%xmm0, (%[v])")
+                __ASM_EMIT("add             $0x30, %[pv]")
+                __ASM_EMIT("add             $0x10, %[v]")
+                __ASM_EMIT("dec             %[n]")
+                __ASM_EMIT("jge             5b")
+                __ASM_EMIT("6:")
+                : [v] "+r" (v), [pv] "+r" (pv), [n] "+r" (n)
+                : [sp] "m" (*sp),
+                  [C] "o" (aos3d_const),
+                  [MASK] "m" (aos3d_mask)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef UNIT_VECTOR_P1PVN_CORE
+        #undef UNIT_VECTOR_CORE
+        #undef TRIANGLE_CENTER_X4
+        #undef TRIANGLE_CENTER
+        #undef AOS3D_SQR_LENGTH
+        #undef AOS3D_STORE_X
+        #undef AOS3D_STORE_Y
+        #undef AOS3D_LOAD_X
+        #undef AOS3D_LOAD_Y
+
+        /* Compute the vector product of V0 and V1 for each 128-bit lane: V0 = V0 x V1 */
+        #define VECTOR_MUL_CORE(V) \
+            __ASM_EMIT("vshufps         $0xc9, %%" V "mm0, %%" V "mm0, %%" V "mm2")     /* V2 = dy1 dz1 dx1 dw1 */ \
+            __ASM_EMIT("vshufps         $0xc9, %%" V "mm1, %%" V "mm1, %%" V "mm3")     /* V3 = dy2 dz2 dx2 dw2 */ \
+            __ASM_EMIT("vmulps          %%" V "mm2, %%" V "mm1, %%" V "mm1")            /* V1 = dx2*dy1 dy2*dz1 dz2*dx1 dw2*dw1 */ \
+            __ASM_EMIT("vmulps          %%" V "mm3, %%" V "mm0, %%" V "mm0")            /* V0 = dx1*dy2 dy1*dz2 dz1*dx2 dw1*dw2 */ \
+            __ASM_EMIT("vsubps          %%" V "mm1, %%" V "mm0, %%" V "mm0")            /* V0 = NZ NX NY NW */ \
+            __ASM_EMIT("vshufps         $0xc9, %%" V "mm0, %%" V "mm0, %%" V "mm0")     /* V0 = NX NY NZ NW */
+
+        void vector_mul_v2n(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                /* 2x blocks */
+                __ASM_EMIT("sub             $2, %[n]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         (%[v1]), %%ymm0")
+                __ASM_EMIT("vmovups         (%[v2]), %%ymm1")
+                VECTOR_MUL_CORE("y")
+                __ASM_EMIT("vandps          %[MASK], %%ymm0, %%ymm0")
+                __ASM_EMIT("vmovups         %%ymm0, (%[r])")
+                __ASM_EMIT("add             $0x20, %[v1]")
+                __ASM_EMIT("add             $0x20, %[v2]")
+                __ASM_EMIT("add             $0x20, %[r]")
+                __ASM_EMIT("sub             $2, %[n]")
+                __ASM_EMIT("jae             1b")
+                /* 1x block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add             $1, %[n]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("vmovups         (%[v1]), %%xmm0")
+                __ASM_EMIT("vmovups         (%[v2]), %%xmm1")
+                VECTOR_MUL_CORE("x")
+                __ASM_EMIT("vandps          %[MASK], %%xmm0, %%xmm0")
+                __ASM_EMIT("vmovups         %%xmm0, (%[r])")
+                __ASM_EMIT("4:")
+                : [r] "+r" (r), [v1] "+r" (v1), [v2] "+r" (v2), [n] "+r" (n)
+                : [MASK] "m" (aos3d_mask)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3"
+            );
+        }
+
+        #undef VECTOR_MUL_CORE
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_3DMATH_H_ */
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_FASTCONV_FMADD_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_FASTCONV_FMADD_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t blocks   = size_t(1) << (rank - 3);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         0x00(%[c1]), %%ymm0")               /* ymm0 = ar */
+                __ASM_EMIT("vmovups         0x20(%[c1]), %%ymm1")               /* ymm1 = ai */
+                __ASM_EMIT("vmovups         0x00(%[c2]), %%ymm2")               /* ymm2 = br */
+                __ASM_EMIT("vmovups         0x20(%[c2]), %%ymm3")               /* ymm3 = bi */
+                __ASM_EMIT("vmulps          %%ymm2, %%ymm0, %%ymm4")            /* ymm4 = ar*br */
+                __ASM_EMIT("vmulps          %%ymm3, %%ymm1, %%ymm5")            /* ymm5 = ai*bi */
+                __ASM_EMIT("vmulps          %%ymm3, %%ymm0, %%ymm6")            /* ymm6 = ar*bi */
+                __ASM_EMIT("vmulps          %%ymm2, %%ymm1, %%ymm7")            /* ymm7 = ai*br */
+                __ASM_EMIT("vsubps          %%ymm5, %%ymm4, %%ymm4")            /* ymm4 = ar*br - ai*bi */
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm6, %%ymm6")            /* ymm6 = ar*bi + ai*br */
+                __ASM_EMIT("vaddps          0x00(%[dst]), %%ymm4, %%ymm4")      /* ymm4 = dr + ar*br - ai*bi */
+                __ASM_EMIT("vaddps          0x20(%[dst]), %%ymm6, %%ymm6")      /* ymm6 = di + ar*bi + ai*br */
+                __ASM_EMIT("vmovups         %%ymm4, 0x00(%[dst])")
+                __ASM_EMIT("vmovups         %%ymm6, 0x20(%[dst])")
+                __ASM_EMIT("add             $0x40, %[c1]")
+                __ASM_EMIT("add             $0x40, %[c2]")
+                __ASM_EMIT("add             $0x40, %[dst]")
+                __ASM_EMIT("dec             %[blocks]")
+                __ASM_EMIT("jnz             1b")
+
+                : [dst] "+r" (dst), [c1] "+r" (c1), [c2] "+r" (c2),
+                  [blocks] "+r" (blocks)
+                :
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void fastconv_fmadd_fma3(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t blocks   = size_t(1) << (rank - 3);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         0x00(%[c1]), %%ymm0")               /* ymm0 = ar */
+                __ASM_EMIT("vmovups         0x20(%[c1]), %%ymm1")               /* ymm1 = ai */
+                __ASM_EMIT("vmovups         0x00(%[c2]), %%ymm2")               /* ymm2 = br */
+                __ASM_EMIT("vmovups         0x20(%[c2]), %%ymm3")               /* ymm3 = bi */
+                __ASM_EMIT("vmovups         0x00(%[dst]), %%ymm4")              /* ymm4 = dr */
+                __ASM_EMIT("vmovups         0x20(%[dst]), %%ymm5")              /* ymm5 = di */
+                __ASM_EMIT("vfmadd231ps     %%ymm2, %%ymm0, %%ymm4")            /* ymm4 = dr + ar*br */
+                __ASM_EMIT("vfmadd231ps     %%ymm3, %%ymm0, %%ymm5")            /* ymm5 = di + ar*bi */
+                __ASM_EMIT("vfnmadd231ps    %%ymm3, %%ymm1, %%ymm4")            /* ymm4 = dr + ar*br - ai*bi */
+                __ASM_EMIT("vfmadd231ps     %%ymm2, %%ymm1, %%ymm5")            /* ymm5 = di + ar*bi + ai*br */
+                __ASM_EMIT("vmovups         %%ymm4, 0x00(%[dst])")
+                __ASM_EMIT("vmovups         %%ymm5, 0x20(%[dst])")
+                __ASM_EMIT("add             $0x40, %[c1]")
+                __ASM_EMIT("add             $0x40, %[c2]")
+                __ASM_EMIT("add             $0x40, %[dst]")
+                __ASM_EMIT("dec             %[blocks]")
+                __ASM_EMIT("jnz             1b")
+
+                : [dst] "+r" (dst), [c1] "+r" (c1), [c2] "+r" (c2),
+                  [blocks] "+r" (blocks)
+                :
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5"
+            );
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_FASTCONV_FMADD_H_ */
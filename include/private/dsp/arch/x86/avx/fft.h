@@ -23,6 +23,7 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
 
+#include <private/dsp/fft.h>
 #include <private/dsp/arch/x86/avx/fft/const.h>
 #include <private/dsp/arch/x86/avx/fft/butterfly.h>
 #include <private/dsp/arch/x86/avx/fft/normalize.h>
@@ -67,15 +68,15 @@ namespace lsp
         {
             if (rank == 2)
             {
-                float s0_re     = src_re[0] + src_re[1];
-                float s1_re     = src_re[0] - src_re[1];
-                float s2_re     = src_re[2] + src_re[3];
-                float s3_re     = src_re[2] - src_re[3];
+                float s0_re     = src_re[0] + src_re[2];
+                float s1_re     = src_re[0] - src_re[2];
+                float s2_re     = src_re[1] + src_re[3];
+                float s3_re     = src_re[1] - src_re[3];
 
-                float s0_im     = src_im[0] + src_im[1];
-                float s1_im     = src_im[0] - src_im[1];
-                float s2_im     = src_im[2] + src_im[3];
-                float s3_im     = src_im[2] - src_im[3];
+                float s0_im     = src_im[0] + src_im[2];
+                float s1_im     = src_im[0] - src_im[2];
+                float s2_im     = src_im[1] + src_im[3];
+                float s3_im     = src_im[1] - src_im[3];
 
                 dst_re[0]       = s0_re + s2_re;
                 dst_re[1]       = s1_re + s3_im;
@@ -109,25 +110,25 @@ namespace lsp
         {
             if (rank == 2)
             {
-                float s0_re     = src_re[0] + src_re[1];
-                float s1_re     = src_re[0] - src_re[1];
-                float s2_re     = src_re[2] + src_re[3];
-                float s3_re     = src_re[2] - src_re[3];
+                float s0_re     = src_re[0] + src_re[2];
+                float s1_re     = src_re[0] - src_re[2];
+                float s2_re     = src_re[1] + src_re[3];
+                float s3_re     = src_re[1] - src_re[3];
 
-                float s0_im     = src_im[0] + src_im[1];
-                float s1_im     = src_im[0] - src_im[1];
-                float s2_im     = src_im[2] + src_im[3];
-                float s3_im     = src_im[2] - src_im[3];
+                float s0_im     = src_im[0] + src_im[2];
+                float s1_im     = src_im[0] - src_im[2];
+                float s2_im     = src_im[1] + src_im[3];
+                float s3_im     = src_im[1] - src_im[3];
 
-                dst_re[0]       = s0_re + s2_re;
-                dst_re[1]       = s1_re + s3_im;
-                dst_re[2]       = s0_re - s2_re;
-                dst_re[3]       = s1_re - s3_im;
+                dst_re[0]       = (s0_re + s2_re)*0.25f;
+                dst_re[1]       = (s1_re - s3_im)*0.25f;
+                dst_re[2]       = (s0_re - s2_re)*0.25f;
+                dst_re[3]       = (s1_re + s3_im)*0.25f;
 
-                dst_im[0]       = s0_im + s2_im;
-                dst_im[1]       = s1_im - s3_re;
-                dst_im[2]       = s0_im - s2_im;
-                dst_im[3]       = s1_im + s3_re;
+                dst_im[0]       = (s0_im + s2_im)*0.25f;
+                dst_im[1]       = (s1_im + s3_re)*0.25f;
+                dst_im[2]       = (s0_im - s2_im)*0.25f;
+                dst_im[3]       = (s1_im - s3_re)*0.25f;
             }
             else if (rank == 1)
             {
@@ -135,10 +136,10 @@ namespace lsp
                 // s1' = s0 - s1
                 float s1_re     = src_re[1];
                 float s1_im     = src_im[1];
-                dst_re[1]       = src_re[0] - s1_re;
-                dst_im[1]       = src_im[0] - s1_im;
-                dst_re[0]       = src_re[0] + s1_re;
-                dst_im[0]       = src_im[0] + s1_im;
+                dst_re[1]       = (src_re[0] - s1_re) * 0.5f;
+                dst_im[1]       = (src_im[0] - s1_im) * 0.5f;
+                dst_re[0]       = (src_re[0] + s1_re) * 0.5f;
+                dst_im[0]       = (src_im[0] + s1_im) * 0.5f;
             }
             else
             {
@@ -147,15 +148,8 @@ namespace lsp
             }
         }
 
-        void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        static inline void scramble_direct(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
         {
-            // Check bounds
-            if (rank <= 2)
-            {
-                small_direct_fft(dst_re, dst_im, src_re, src_im, rank);
-                return;
-            }
-
             if ((dst_re == src_re) || (dst_im == src_im) || (rank < 4))
             {
                 dsp::move(dst_re, src_re, 1 << rank);
@@ -172,20 +166,10 @@ namespace lsp
                 else
                     scramble_copy_direct16(dst_re, dst_im, src_re, src_im, rank-4);
             }
-
-            for (size_t i=3; i < rank; ++i)
-                butterfly_direct8p(dst_re, dst_im, i, 1 << (rank - i - 1));
         }
 
-        void direct_fft_fma3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        static inline void scramble_direct_fma3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
         {
-            // Check bounds
-            if (rank <= 2)
-            {
-                small_direct_fft(dst_re, dst_im, src_re, src_im, rank);
-                return;
-            }
-
             if ((dst_re == src_re) || (dst_im == src_im) || (rank < 4))
             {
                 dsp::move(dst_re, src_re, 1 << rank);
@@ -202,20 +186,10 @@ namespace lsp
                 else
                     scramble_copy_direct16_fma3(dst_re, dst_im, src_re, src_im, rank-4);
             }
-
-            for (size_t i=3; i < rank; ++i)
-                butterfly_direct8p_fma3(dst_re, dst_im, i, 1 << (rank - i - 1));
         }
 
-        void reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        static inline void scramble_reverse(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
         {
-            // Check bounds
-            if (rank <= 2)
-            {
-                small_reverse_fft(dst_re, dst_im, src_re, src_im, rank);
-                return;
-            }
-
             if ((dst_re == src_re) || (dst_im == src_im) || (rank < 4))
             {
                 dsp::move(dst_re, src_re, 1 << rank);
@@ -232,22 +206,10 @@ namespace lsp
                 else
                     scramble_copy_reverse16(dst_re, dst_im, src_re, src_im, rank-4);
             }
-
-            for (size_t i=3; i < rank; ++i)
-                butterfly_reverse8p(dst_re, dst_im, i, 1 << (rank - i - 1));
-
-            dsp::normalize_fft2(dst_re, dst_im, rank);
         }
 
-        void reverse_fft_fma3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        static inline void scramble_reverse_fma3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
         {
-            // Check bounds
-            if (rank <= 2)
-            {
-                small_reverse_fft(dst_re, dst_im, src_re, src_im, rank);
-                return;
-            }
-
             if ((dst_re == src_re) || (dst_im == src_im) || (rank < 4))
             {
                 dsp::move(dst_re, src_re, 1 << rank);
@@ -264,11 +226,184 @@ namespace lsp
                 else
                     scramble_copy_reverse16_fma3(dst_re, dst_im, src_re, src_im, rank-4);
             }
+        }
+
+        void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        {
+            // Check bounds
+            if (rank <= 2)
+            {
+                small_direct_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            scramble_direct(dst_re, dst_im, src_re, src_im, rank);
+
+            for (size_t i=3; i < rank; ++i)
+                butterfly_direct8p(dst_re, dst_im, i, 1 << (rank - i - 1));
+        }
+
+        void direct_fft_fma3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        {
+            // Check bounds
+            if (rank <= 2)
+            {
+                small_direct_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            scramble_direct_fma3(dst_re, dst_im, src_re, src_im, rank);
+
+            for (size_t i=3; i < rank; ++i)
+                butterfly_direct8p_fma3(dst_re, dst_im, i, 1 << (rank - i - 1));
+        }
+
+        void reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        {
+            // Check bounds
+            if (rank <= 2)
+            {
+                small_reverse_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            scramble_reverse(dst_re, dst_im, src_re, src_im, rank);
+
+            for (size_t i=3; i < rank; ++i)
+                butterfly_reverse8p(dst_re, dst_im, i, 1 << (rank - i - 1));
+
+            dsp::normalize_fft2(dst_re, dst_im, rank);
+        }
+
+        void reverse_fft_fma3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        {
+            // Check bounds
+            if (rank <= 2)
+            {
+                small_reverse_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            scramble_reverse_fma3(dst_re, dst_im, src_re, src_im, rank);
 
             for (size_t i=3; i < rank; ++i)
                 butterfly_reverse8p_fma3(dst_re, dst_im, i, 1 << (rank - i - 1));
 
             dsp::normalize_fft2(dst_re, dst_im, rank);
         }
+
+        void direct_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    small_direct_fft(dst_re[i], dst_im[i], src_re[i], src_im[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    scramble_direct(dst_re[j], dst_im[j], src_re[j], src_im[j], rank);
+
+                for (size_t i=3; i < rank; ++i)
+                    butterfly_direct8p_batch(dst_re, dst_im, i, 1 << (rank - i - 1), n);
+
+                dst_re         += n;
+                dst_im         += n;
+                src_re         += n;
+                src_im         += n;
+                count          -= n;
+            }
+        }
+
+        void direct_fft_batch_fma3(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    small_direct_fft(dst_re[i], dst_im[i], src_re[i], src_im[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    scramble_direct_fma3(dst_re[j], dst_im[j], src_re[j], src_im[j], rank);
+
+                for (size_t i=3; i < rank; ++i)
+                    butterfly_direct8p_batch_fma3(dst_re, dst_im, i, 1 << (rank - i - 1), n);
+
+                dst_re         += n;
+                dst_im         += n;
+                src_re         += n;
+                src_im         += n;
+                count          -= n;
+            }
+        }
+
+        void reverse_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    small_reverse_fft(dst_re[i], dst_im[i], src_re[i], src_im[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    scramble_reverse(dst_re[j], dst_im[j], src_re[j], src_im[j], rank);
+
+                for (size_t i=3; i < rank; ++i)
+                    butterfly_reverse8p_batch(dst_re, dst_im, i, 1 << (rank - i - 1), n);
+
+                for (size_t j=0; j<n; ++j)
+                    dsp::normalize_fft2(dst_re[j], dst_im[j], rank);
+
+                dst_re         += n;
+                dst_im         += n;
+                src_re         += n;
+                src_im         += n;
+                count          -= n;
+            }
+        }
+
+        void reverse_fft_batch_fma3(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    small_reverse_fft(dst_re[i], dst_im[i], src_re[i], src_im[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    scramble_reverse_fma3(dst_re[j], dst_im[j], src_re[j], src_im[j], rank);
+
+                for (size_t i=3; i < rank; ++i)
+                    butterfly_reverse8p_batch_fma3(dst_re, dst_im, i, 1 << (rank - i - 1), n);
+
+                for (size_t j=0; j<n; ++j)
+                    dsp::normalize_fft2(dst_re[j], dst_im[j], rank);
+
+                dst_re         += n;
+                dst_im         += n;
+                src_re         += n;
+                src_im         += n;
+                count          -= n;
+            }
+        }
     }
 }
@@ -93,6 +93,103 @@ namespace lsp
                 "%xmm4", "%xmm5", "%xmm6", "%xmm7"  \
             );
 
+        #define FFT_BATCH_BUTTERFLY_BODY8(add_b, add_a, FMA_SEL) \
+            float **v_re    = dst_re; \
+            float **v_im    = dst_im; \
+            size_t off      = 0; \
+            size_t j, k; \
+            float *a_re, *a_im; \
+            \
+            ARCH_X86_ASM \
+            ( \
+                /* Prepare angle */ \
+                __ASM_EMIT("mov             %[fft_a], %[a_re]") \
+                __ASM_EMIT("vmovaps         0x00(%[a_re]), %%ymm6")             /* ymm6 = x_re */ \
+                __ASM_EMIT("vmovaps         0x20(%[a_re]), %%ymm7")             /* ymm7 = x_im */ \
+                /* Loop over groups of 8 pairs */ \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("mov             %[dst_re], %[a_re]") \
+                __ASM_EMIT("mov             %[dst_im], %[a_im]") \
+                __ASM_EMIT("mov             %[a_re], %[v_re]")                  /* v_re = dst_re */ \
+                __ASM_EMIT("mov             %[a_im], %[v_im]")                  /* v_im = dst_im */ \
+                __ASM_EMIT("mov             %[count], %[k]") \
+                __ASM_EMIT("mov             %[k], %[j]")                        /* j = count */ \
+                /* Loop over transforms */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("mov             %[v_re], %[a_re]") \
+                __ASM_EMIT("mov             %[v_im], %[a_im]") \
+                __ASM_EMIT("mov             (%[a_re]), %[a_re]")                /* a_re = *v_re */ \
+                __ASM_EMIT("mov             (%[a_im]), %[a_im]")                /* a_im = *v_im */ \
+                __ASM_EMIT("add             %[off], %[a_re]") \
+                __ASM_EMIT("add             %[off], %[a_im]") \
+                __ASM_EMIT("mov             %[blocks], %[k]") \
+                /* Loop over blocks */ \
+                __ASM_EMIT("3:") \
+                    __ASM_EMIT("vmovups         0x00(%[a_re]), %%ymm0")             /* ymm0 = a_re */ \
+                    __ASM_EMIT("vmovups         0x00(%[a_re], %[shift]), %%ymm2")   /* ymm2 = b_re */ \
+                    __ASM_EMIT("vmovups         0x00(%[a_im]), %%ymm1")             /* ymm1 = a_im */ \
+                    __ASM_EMIT("vmovups         0x00(%[a_im], %[shift]), %%ymm3")   /* ymm3 = b_im */ \
+                    /* Calculate complex multiplication */ \
+                    __ASM_EMIT("vmulps          %%ymm7, %%ymm2, %%ymm4")            /* ymm4 = x_im * b_re */ \
+                    __ASM_EMIT("vmulps          %%ymm7, %%ymm3, %%ymm5")            /* ymm5 = x_im * b_im */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  %%ymm6, %%ymm2, %%ymm2", ""))       /* ymm2 = x_re * b_re */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  %%ymm6, %%ymm3, %%ymm3", ""))       /* ymm3 = x_re * b_im */ \
+                    __ASM_EMIT(FMA_SEL(add_b "  %%ymm5, %%ymm2, %%ymm5", add_b " %%ymm6, %%ymm2, %%ymm5")) /* ymm5 = c_re = x_re * b_re +- x_im * b_im */ \
+                    __ASM_EMIT(FMA_SEL(add_a "  %%ymm4, %%ymm3, %%ymm4", add_a " %%ymm6, %%ymm3, %%ymm4")) /* ymm4 = c_im = x_re * b_im -+ x_im * b_re */ \
+                    /* Perform butterfly */ \
+                    __ASM_EMIT("vsubps          %%ymm5, %%ymm0, %%ymm2")            /* ymm2 = a_re - c_re */ \
+                    __ASM_EMIT("vsubps          %%ymm4, %%ymm1, %%ymm3")            /* ymm3 = a_im - c_im */ \
+                    __ASM_EMIT("vaddps          %%ymm5, %%ymm0, %%ymm0")            /* ymm0 = a_re + c_re */ \
+                    __ASM_EMIT("vaddps          %%ymm4, %%ymm1, %%ymm1")            /* ymm1 = a_im + c_im */ \
+                    /* Store values */ \
+                    __ASM_EMIT("vmovups         %%ymm0, 0x00(%[a_re])") \
+                    __ASM_EMIT("vmovups         %%ymm2, 0x00(%[a_re], %[shift])") \
+                    __ASM_EMIT("vmovups         %%ymm1, 0x00(%[a_im])") \
+                    __ASM_EMIT("vmovups         %%ymm3, 0x00(%[a_im], %[shift])") \
+                    __ASM_EMIT("add             %[stride], %[a_re]") \
+                    __ASM_EMIT("add             %[stride], %[a_im]") \
+                    __ASM_EMIT("dec             %[k]") \
+                __ASM_EMIT("jnz             3b") \
+                /* Move to the next transform */ \
+                __ASM_EMIT32("addl          $4, %[v_re]") \
+                __ASM_EMIT32("addl          $4, %[v_im]") \
+                __ASM_EMIT32("decl          %[j]") \
+                __ASM_EMIT64("addq          $8, %[v_re]") \
+                __ASM_EMIT64("addq          $8, %[v_im]") \
+                __ASM_EMIT64("decq          %[j]") \
+                __ASM_EMIT("jnz             2b") \
+                /* Move to the next group of pairs */ \
+                __ASM_EMIT32("addl          $0x20, %[off]") \
+                __ASM_EMIT32("subl          $8, %[np]") \
+                __ASM_EMIT64("addq          $0x20, %[off]") \
+                __ASM_EMIT64("subq          $8, %[np]") \
+                __ASM_EMIT("jz              4f") \
+                    /* Rotate angle */ \
+                    __ASM_EMIT("mov             %[fft_w], %[a_re]") \
+                    __ASM_EMIT("vmovaps         0x00(%[a_re]), %%ymm4")             /* xmm4 = w_re */ \
+                    __ASM_EMIT("vmovaps         0x20(%[a_re]), %%ymm5")             /* xmm5 = w_im */ \
+                    __ASM_EMIT("vmulps          %%ymm5, %%ymm6, %%ymm2")            /* ymm2 = w_im * x_re */ \
+                    __ASM_EMIT("vmulps          %%ymm5, %%ymm7, %%ymm3")            /* ymm3 = w_im * x_im */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  %%ymm4, %%ymm6, %%ymm6", ""))       /* ymm6 = w_re * x_re */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  %%ymm4, %%ymm7, %%ymm7", ""))       /* ymm7 = w_re * x_im */ \
+                    __ASM_EMIT(FMA_SEL("vsubps  %%ymm3, %%ymm6, %%ymm6", "vfmsub132ps %%ymm4, %%ymm3, %%ymm6")) /* ymm6 = x_re' = w_re * x_re - w_im * x_im */ \
+                    __ASM_EMIT(FMA_SEL("vaddps  %%ymm2, %%ymm7, %%ymm7", "vfmadd132ps %%ymm4, %%ymm2, %%ymm7")) /* ymm7 = x_im' = w_re * x_im + w_im * x_re */ \
+                    /* Repeat loop */ \
+                __ASM_EMIT("jmp             1b") \
+                __ASM_EMIT("4:") \
+                \
+                : [a_re] "=&r" (a_re), [a_im] "=&r" (a_im), [k] "=&r" (k), \
+                  [v_re] "+m" (v_re), [v_im] "+m" (v_im), [j] "=m" (j), \
+                  [off] "+m" (off), [np] "+m" (np) \
+                : [dst_re] "m" (dst_re), [dst_im] "m" (dst_im), \
+                  [count] "g" (count), [blocks] "g" (blocks), \
+                  [shift] "r" (shift), [stride] "g" (stride), \
+                  [fft_a] "g" (fft_a), [fft_w] "g" (fft_w) \
+                : "cc", "memory",  \
+                "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                "%xmm4", "%xmm5", "%xmm6", "%xmm7"  \
+            );
+
     #define FMA_OFF(a, b)       a
     #define FMA_ON(a, b)        b
 
@@ -168,9 +265,54 @@ namespace lsp
             }
         }
 
+        /**
+         * Batch butterflies: each group of 8 angles is computed once and applied
+         * to all blocks of all transforms in the batch before it gets rotated
+         */
+        static inline void butterfly_direct8p_batch(float **dst_re, float **dst_im, size_t rank, size_t blocks, size_t count)
+        {
+            size_t np = 1 << rank;
+            size_t shift = 4 << rank, stride = shift << 1;
+            const float *fft_a = &FFT_A[(rank - 2) << 4];
+            const float *fft_w = &FFT_DW[(rank - 2) << 4];
+
+            FFT_BATCH_BUTTERFLY_BODY8("vaddps", "vsubps", FMA_OFF);
+        }
+
+        static inline void butterfly_reverse8p_batch(float **dst_re, float **dst_im, size_t rank, size_t blocks, size_t count)
+        {
+            size_t np = 1 << rank;
+            size_t shift = 4 << rank, stride = shift << 1;
+            const float *fft_a = &FFT_A[(rank - 2) << 4];
+            const float *fft_w = &FFT_DW[(rank - 2) << 4];
+
+            FFT_BATCH_BUTTERFLY_BODY8("vsubps", "vaddps", FMA_OFF);
+        }
+
+        static inline void butterfly_direct8p_batch_fma3(float **dst_re, float **dst_im, size_t rank, size_t blocks, size_t count)
+        {
+            size_t np = 1 << rank;
+            size_t shift = 4 << rank, stride = shift << 1;
+            const float *fft_a = &FFT_A[(rank - 2) << 4];
+            const float *fft_w = &FFT_DW[(rank - 2) << 4];
+
+            FFT_BATCH_BUTTERFLY_BODY8("vfmadd231ps", "vfmsub231ps", FMA_ON);
+        }
+
+        static inline void butterfly_reverse8p_batch_fma3(float **dst_re, float **dst_im, size_t rank, size_t blocks, size_t count)
+        {
+            size_t np = 1 << rank;
+            size_t shift = 4 << rank, stride = shift << 1;
+            const float *fft_a = &FFT_A[(rank - 2) << 4];
+            const float *fft_w = &FFT_DW[(rank - 2) << 4];
+
+            FFT_BATCH_BUTTERFLY_BODY8("vfmsub231ps", "vfmadd231ps", FMA_ON);
+        }
+
     #undef FMA_OFF
     #undef FMA_ON
     #undef FFT_BUTTERFLY_BODY8
+    #undef FFT_BATCH_BUTTERFLY_BODY8
     }
 }
 
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_FILTERS_CROSSOVER_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_FILTERS_CROSSOVER_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+/*
+    All 8 bands are processed in parallel lanes. For each block of 4 samples all
+    sections of the crossover are applied to 4 broadcasted samples, then the block
+    is transposed and stored to 8 destination buffers.
+
+    Lanes that do not match any band have identity sections and store the data to
+    the buffer of the first band. Stores are performed in descending order of lanes,
+    so the valid data is always written last.
+
+    Register allocation:
+      ymm0-ymm3     = samples of 4 time steps
+      ymm4-ymm5     = memory of the section d0, d1
+      ymm6-ymm7     = temporaries
+      ymm8-ymm12    = coefficients of the section b0, b1, b2, a1, a2
+ */
+
+// Load coefficients and memory of the section
+#define XO_LOAD \
+    __ASM_EMIT("vmovups     0x00(%[f]), %%ymm8")                /* ymm8  = b0 */ \
+    __ASM_EMIT("vmovups     0x20(%[f]), %%ymm9")                /* ymm9  = b1 */ \
+    __ASM_EMIT("vmovups     0x40(%[f]), %%ymm10")               /* ymm10 = b2 */ \
+    __ASM_EMIT("vmovups     0x60(%[f]), %%ymm11")               /* ymm11 = a1 */ \
+    __ASM_EMIT("vmovups     0x80(%[f]), %%ymm12")               /* ymm12 = a2 */ \
+    __ASM_EMIT("vmovups     0x00(%[d]), %%ymm4")                /* ymm4  = d0 */ \
+    __ASM_EMIT("vmovups     0x20(%[d]), %%ymm5")                /* ymm5  = d1 */
+
+// Store memory of the section and move to the next one
+#define XO_STORE \
+    __ASM_EMIT("vmovups     %%ymm4, 0x00(%[d])") \
+    __ASM_EMIT("vmovups     %%ymm5, 0x20(%[d])") \
+    __ASM_EMIT("add         $0xa0, %[f]")                       /* f     = next biquad_x8_t */ \
+    __ASM_EMIT("add         $0x40, %[d]")                       /* d     = next d0[8], d1[8] */
+
+// Apply the section to the register x
+#define XO_BIQUAD(x) \
+    __ASM_EMIT("vmulps      %%ymm9, %%" x ", %%ymm6")           /* ymm6  = b1*x */ \
+    __ASM_EMIT("vmulps      %%ymm10, %%" x ", %%ymm7")          /* ymm7  = b2*x */ \
+    __ASM_EMIT("vmulps      %%ymm8, %%" x ", %%" x)             /* x     = b0*x */ \
+    __ASM_EMIT("vaddps      %%ymm4, %%" x ", %%" x)             /* x     = y = b0*x + d0 */ \
+    __ASM_EMIT("vmulps      %%ymm11, %%" x ", %%ymm4")          /* ymm4  = a1*y */ \
+    __ASM_EMIT("vaddps      %%ymm6, %%ymm4, %%ymm4")            /* ymm4  = b1*x + a1*y */ \
+    __ASM_EMIT("vaddps      %%ymm5, %%ymm4, %%ymm4")            /* ymm4  = d0' = b1*x + a1*y + d1 */ \
+    __ASM_EMIT("vmulps      %%ymm12, %%" x ", %%ymm5")          /* ymm5  = a2*y */ \
+    __ASM_EMIT("vaddps      %%ymm7, %%ymm5, %%ymm5")            /* ymm5  = d1' = b2*x + a2*y */
+
+// Store the lane from xmm register
+#define XO_STORE1(lane, x) \
+    __ASM_EMIT("mov         " lane "(%[dst]), %[t]") \
+    __ASM_EMIT("vmovss      %%" x ", (%[t], %[off])")
+
+// Store 4 lanes from xmm register
+#define XO_STORE4(lane, x) \
+    __ASM_EMIT("mov         " lane "(%[dst]), %[t]") \
+    __ASM_EMIT("vmovups     %%" x ", (%[t], %[off])")
+
+namespace lsp
+{
+    namespace avx
+    {
+        void x64_crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c)
+        {
+            float *vd[8];
+            const float *fb     = &c->stage[0].b0[0];
+            float *db           = &c->d[0];
+            size_t n            = c->stages;
+            IF_ARCH_X86_64(size_t off, f, d, i, t);
+
+            for (size_t j=0; j<8; ++j)
+                vd[j]           = (j < c->bands) ? dst[j] : dst[0];
+
+            ARCH_X86_64_ASM(
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("jb          2f")
+
+                // 4x blocks
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vbroadcastss 0x00(%[src], %[off]), %%ymm0")     /* ymm0  = s0 */
+                __ASM_EMIT("vbroadcastss 0x04(%[src], %[off]), %%ymm1")     /* ymm1  = s1 */
+                __ASM_EMIT("vbroadcastss 0x08(%[src], %[off]), %%ymm2")     /* ymm2  = s2 */
+                __ASM_EMIT("vbroadcastss 0x0c(%[src], %[off]), %%ymm3")     /* ymm3  = s3 */
+                __ASM_EMIT("mov         %[FB], %[f]")
+                __ASM_EMIT("mov         %[DB], %[d]")
+                __ASM_EMIT("mov         %[N], %[i]")
+                __ASM_EMIT("3:")
+                XO_LOAD
+                XO_BIQUAD("ymm0")
+                XO_BIQUAD("ymm1")
+                XO_BIQUAD("ymm2")
+                XO_BIQUAD("ymm3")
+                XO_STORE
+                __ASM_EMIT("dec         %[i]")
+                __ASM_EMIT("jnz         3b")
+                // Transpose: ymm0 = a0 .. a7, ymm1 = b0 .. b7, ...
+                __ASM_EMIT("vunpcklps   %%ymm1, %%ymm0, %%ymm4")            /* ymm4  = a0 b0 a1 b1 a4 b4 a5 b5 */
+                __ASM_EMIT("vunpckhps   %%ymm1, %%ymm0, %%ymm0")            /* ymm0  = a2 b2 a3 b3 a6 b6 a7 b7 */
+                __ASM_EMIT("vunpcklps   %%ymm3, %%ymm2, %%ymm5")            /* ymm5  = c0 d0 c1 d1 c4 d4 c5 d5 */
+                __ASM_EMIT("vunpckhps   %%ymm3, %%ymm2, %%ymm2")            /* ymm2  = c2 d2 c3 d3 c6 d6 c7 d7 */
+                __ASM_EMIT("vunpcklpd   %%ymm5, %%ymm4, %%ymm1")            /* ymm1  = a0 b0 c0 d0 a4 b4 c4 d4 */
+                __ASM_EMIT("vunpckhpd   %%ymm5, %%ymm4, %%ymm3")            /* ymm3  = a1 b1 c1 d1 a5 b5 c5 d5 */
+                __ASM_EMIT("vunpcklpd   %%ymm2, %%ymm0, %%ymm4")            /* ymm4  = a2 b2 c2 d2 a6 b6 c6 d6 */
+                __ASM_EMIT("vunpckhpd   %%ymm2, %%ymm0, %%ymm5")            /* ymm5  = a3 b3 c3 d3 a7 b7 c7 d7 */
+                // Store in descending order
+                __ASM_EMIT("vextractf128 $1, %%ymm5, %%xmm0")
+                __ASM_EMIT("vextractf128 $1, %%ymm4, %%xmm2")
+                __ASM_EMIT("vextractf128 $1, %%ymm3, %%xmm6")
+                __ASM_EMIT("vextractf128 $1, %%ymm1, %%xmm7")
+                XO_STORE4("0x38", "xmm0")
+                XO_STORE4("0x30", "xmm2")
+                XO_STORE4("0x28", "xmm6")
+                XO_STORE4("0x20", "xmm7")
+                XO_STORE4("0x18", "xmm5")
+                XO_STORE4("0x10", "xmm4")
+                XO_STORE4("0x08", "xmm3")
+                XO_STORE4("0x00", "xmm1")
+                __ASM_EMIT("add         $0x10, %[off]")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("jae         1b")
+
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $3, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vbroadcastss (%[src], %[off]), %%ymm0")         /* ymm0  = s0 */
+                __ASM_EMIT("mov         %[FB], %[f]")
+                __ASM_EMIT("mov         %[DB], %[d]")
+                __ASM_EMIT("mov         %[N], %[i]")
+                __ASM_EMIT("6:")
+                XO_LOAD
+                XO_BIQUAD("ymm0")
+                XO_STORE
+                __ASM_EMIT("dec         %[i]")
+                __ASM_EMIT("jnz         6b")
+                // Store in descending order
+                __ASM_EMIT("vextractf128 $1, %%ymm0, %%xmm1")               /* xmm1  = a4 a5 a6 a7 */
+                __ASM_EMIT("vshufps     $0xff, %%xmm1, %%xmm1, %%xmm2")     /* xmm2  = a7 */
+                __ASM_EMIT("vmovhlps    %%xmm1, %%xmm1, %%xmm3")            /* xmm3  = a6 */
+                __ASM_EMIT("vshufps     $0x55, %%xmm1, %%xmm1, %%xmm4")     /* xmm4  = a5 */
+                XO_STORE1("0x38", "xmm2")
+                XO_STORE1("0x30", "xmm3")
+                XO_STORE1("0x28", "xmm4")
+                XO_STORE1("0x20", "xmm1")
+                __ASM_EMIT("vshufps     $0xff, %%xmm0, %%xmm0, %%xmm2")     /* xmm2  = a3 */
+                __ASM_EMIT("vmovhlps    %%xmm0, %%xmm0, %%xmm3")            /* xmm3  = a2 */
+                __ASM_EMIT("vshufps     $0x55, %%xmm0, %%xmm0, %%xmm4")     /* xmm4  = a1 */
+                XO_STORE1("0x18", "xmm2")
+                XO_STORE1("0x10", "xmm3")
+                XO_STORE1("0x08", "xmm4")
+                XO_STORE1("0x00", "xmm0")
+                __ASM_EMIT("add         $4, %[off]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jge         5b")
+
+                __ASM_EMIT("4:")
+                : [count] "+r" (count),
+                  [off] "=&r" (off), [f] "=&r" (f), [d] "=&r" (d),
+                  [i] "=&r" (i), [t] "=&r" (t)
+                : [src] "r" (src), [dst] "r" (&vd[0]),
+                  [FB] "m" (fb), [DB] "m" (db), [N] "m" (n)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                  "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+                  "%xmm12"
+            );
+        }
+    }
+}
+
+#undef XO_STORE4
+#undef XO_STORE1
+#undef XO_BIQUAD
+#undef XO_STORE
+#undef XO_LOAD
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_FILTERS_CROSSOVER_H_ */
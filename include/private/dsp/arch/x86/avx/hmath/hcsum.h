@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_HMATH_HCSUM_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_HMATH_HCSUM_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+        IF_ARCH_X86(
+            static const uint32_t hcsum_const[] __lsp_aligned32 =
+            {
+                LSP_DSP_VEC8(0x7fffffff)
+            };
+        );
+
+        /* Kahan summation step for two accumulators:
+         *   ymm0, ymm1 = sums, ymm2, ymm3 = compensations, ymm4, ymm5 = terms
+         */
+        #define HCSUM_KAHAN_X2 \
+            __ASM_EMIT("vsubps          %%ymm2, %%ymm4, %%ymm4")            /* ymm4 = y = x - c */ \
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm5, %%ymm5") \
+            __ASM_EMIT("vaddps          %%ymm4, %%ymm0, %%ymm6")            /* ymm6 = t = s + y */ \
+            __ASM_EMIT("vaddps          %%ymm5, %%ymm1, %%ymm7") \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm6, %%ymm2")            /* ymm2 = t - s */ \
+            __ASM_EMIT("vsubps          %%ymm1, %%ymm7, %%ymm3") \
+            __ASM_EMIT("vsubps          %%ymm4, %%ymm2, %%ymm2")            /* ymm2 = c = (t - s) - y */ \
+            __ASM_EMIT("vsubps          %%ymm5, %%ymm3, %%ymm3") \
+            __ASM_EMIT("vmovaps         %%ymm6, %%ymm0")                    /* ymm0 = s = t */ \
+            __ASM_EMIT("vmovaps         %%ymm7, %%ymm1")
+
+        /* Kahan summation step for the first accumulator, ymm4 = terms */
+        #define HCSUM_KAHAN_X1 \
+            __ASM_EMIT("vsubps          %%ymm2, %%ymm4, %%ymm4")            /* ymm4 = y = x - c */ \
+            __ASM_EMIT("vaddps          %%ymm4, %%ymm0, %%ymm6")            /* ymm6 = t = s + y */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm6, %%ymm2")            /* ymm2 = t - s */ \
+            __ASM_EMIT("vsubps          %%ymm4, %%ymm2, %%ymm2")            /* ymm2 = c = (t - s) - y */ \
+            __ASM_EMIT("vmovaps         %%ymm6, %%ymm0")                    /* ymm0 = s = t */
+
+        /* Term loaders: MOV = load instruction, V = register width, OFF = offset, X = register for the term,
+         * T = temporary register. VEX-encoded 128-bit and scalar loads zero the upper lanes, so the x4 and
+         * 1x blocks may reuse the 256-bit Kahan step
+         */
+        #define HCSUM_SUM(MOV, V, OFF, X, T) \
+            __ASM_EMIT(MOV OFF "(%[src], %[off]), %%" V "mm" X)
+        #define HCSUM_SQR(MOV, V, OFF, X, T) \
+            __ASM_EMIT(MOV OFF "(%[src], %[off]), %%" V "mm" X) \
+            __ASM_EMIT("vmulps          %%ymm" X ", %%ymm" X ", %%ymm" X)
+        #define HCSUM_ABS(MOV, V, OFF, X, T) \
+            __ASM_EMIT(MOV OFF "(%[src], %[off]), %%" V "mm" X) \
+            __ASM_EMIT("vandps          %[X_SIGN], %%ymm" X ", %%ymm" X)
+        #define HCSUM_DOTP(MOV, V, OFF, X, T) \
+            __ASM_EMIT(MOV OFF "(%[a], %[off]), %%" V "mm" X) \
+            __ASM_EMIT(MOV OFF "(%[b], %[off]), %%" V "mm" T) \
+            __ASM_EMIT("vmulps          %%ymm" T ", %%ymm" X ", %%ymm" X)
+
+        #define HCSUM_CORE(OP) \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0") \
+            __ASM_EMIT("vxorps          %%ymm1, %%ymm1, %%ymm1") \
+            __ASM_EMIT("vxorps          %%ymm2, %%ymm2, %%ymm2") \
+            __ASM_EMIT("vxorps          %%ymm3, %%ymm3, %%ymm3") \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("sub             $16, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            /* x16 blocks */ \
+            __ASM_EMIT("1:") \
+            OP("vmovups         ", "y", "0x00", "4", "6") \
+            OP("vmovups         ", "y", "0x20", "5", "7") \
+            HCSUM_KAHAN_X2 \
+            __ASM_EMIT("add             $0x40, %[off]") \
+            __ASM_EMIT("sub             $16, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            /* x8 block */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add             $8, %[count]") \
+            __ASM_EMIT("jl              4f") \
+            OP("vmovups         ", "y", "0x00", "4", "6") \
+            HCSUM_KAHAN_X1 \
+            __ASM_EMIT("add             $0x20, %[off]") \
+            __ASM_EMIT("sub             $8, %[count]") \
+            /* x4 block */ \
+            __ASM_EMIT("4:") \
+            __ASM_EMIT("add             $4, %[count]") \
+            __ASM_EMIT("jl              6f") \
+            OP("vmovups         ", "x", "0x00", "4", "6") \
+            HCSUM_KAHAN_X1 \
+            __ASM_EMIT("add             $0x10, %[off]") \
+            __ASM_EMIT("sub             $4, %[count]") \
+            /* x1 blocks */ \
+            __ASM_EMIT("6:") \
+            __ASM_EMIT("add             $3, %[count]") \
+            __ASM_EMIT("jl              8f") \
+            __ASM_EMIT("7:") \
+            OP("vmovss          ", "x", "0x00", "4", "6") \
+            HCSUM_KAHAN_X1 \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jge             7b") \
+            /* merge lanes */ \
+            __ASM_EMIT("8:") \
+            __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm0")            /* ymm0 = s - c */ \
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm1") \
+            __ASM_EMIT("vaddps          %%ymm1, %%ymm0, %%ymm0") \
+            __ASM_EMIT("vextractf128    $0x01, %%ymm0, %%xmm1") \
+            __ASM_EMIT("vaddps          %%xmm1, %%xmm0, %%xmm0") \
+            __ASM_EMIT("vhaddps         %%xmm0, %%xmm0, %%xmm0") \
+            __ASM_EMIT("vhaddps         %%xmm0, %%xmm0, %%xmm0")
+
+        float h_csum(const float *src, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                HCSUM_CORE(HCSUM_SUM)
+                : [count] "+r" (count), [off] "=&r" (off),
+                  [res] "=Yz" (result)
+                : [src] "r" (src)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+
+        float h_sqr_csum(const float *src, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                HCSUM_CORE(HCSUM_SQR)
+                : [count] "+r" (count), [off] "=&r" (off),
+                  [res] "=Yz" (result)
+                : [src] "r" (src)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+
+        float h_abs_csum(const float *src, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                HCSUM_CORE(HCSUM_ABS)
+                : [count] "+r" (count), [off] "=&r" (off),
+                  [res] "=Yz" (result)
+                : [src] "r" (src),
+                  [X_SIGN] "m" (hcsum_const)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+
+        float h_cdotp(const float *a, const float *b, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                HCSUM_CORE(HCSUM_DOTP)
+                : [count] "+r" (count), [off] "=&r" (off),
+                  [res] "=Yz" (result)
+                : [a] "r" (a), [b] "r" (b)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+
+        #undef HCSUM_CORE
+        #undef HCSUM_DOTP
+        #undef HCSUM_ABS
+        #undef HCSUM_SQR
+        #undef HCSUM_SUM
+        #undef HCSUM_KAHAN_X1
+        #undef HCSUM_KAHAN_X2
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_HMATH_HCSUM_H_ */
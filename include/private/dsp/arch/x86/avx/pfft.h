@@ -26,6 +26,7 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
 
+#include <private/dsp/fft.h>
 #include <private/dsp/arch/x86/avx/fft/const.h>
 #include <private/dsp/arch/x86/avx/fft/p_repack.h>
 #include <private/dsp/arch/x86/avx/fft/p_butterfly.h>
@@ -71,15 +72,15 @@ namespace lsp
         {
             if (rank == 2)
             {
-                float s0_re     = dst[0] + dst[2];
-                float s1_re     = dst[0] - dst[2];
-                float s0_im     = dst[1] + dst[3];
-                float s1_im     = dst[1] - dst[3];
+                float s0_re     = src[0] + src[4];
+                float s1_re     = src[0] - src[4];
+                float s0_im     = src[1] + src[5];
+                float s1_im     = src[1] - src[5];
 
-                float s2_re     = dst[4] + dst[6];
-                float s3_re     = dst[4] - dst[6];
-                float s2_im     = dst[5] + dst[7];
-                float s3_im     = dst[5] - dst[7];
+                float s2_re     = src[2] + src[6];
+                float s3_re     = src[2] - src[6];
+                float s2_im     = src[3] + src[7];
+                float s3_im     = src[3] - src[7];
 
                 dst[0]          = s0_re + s2_re;
                 dst[1]          = s0_im + s2_im;
@@ -113,15 +114,15 @@ namespace lsp
         {
             if (rank == 2)
             {
-                float s0_re     = src[0] + src[2];
-                float s1_re     = src[0] - src[2];
-                float s2_re     = src[4] + src[6];
-                float s3_re     = src[4] - src[6];
+                float s0_re     = src[0] + src[4];
+                float s1_re     = src[0] - src[4];
+                float s2_re     = src[2] + src[6];
+                float s3_re     = src[2] - src[6];
 
-                float s0_im     = src[1] + src[3];
-                float s1_im     = src[1] - src[3];
-                float s2_im     = src[5] + src[7];
-                float s3_im     = src[5] - src[7];
+                float s0_im     = src[1] + src[5];
+                float s1_im     = src[1] - src[5];
+                float s2_im     = src[3] + src[7];
+                float s3_im     = src[3] - src[7];
 
                 dst[0]          = (s0_re + s2_re)*0.25f;
                 dst[1]          = (s0_im + s2_im)*0.25f;
@@ -139,10 +140,10 @@ namespace lsp
                 // s1' = s0 - s1
                 float s1_re     = src[2];
                 float s1_im     = src[3];
-                dst[2]          = src[0] - s1_re;
-                dst[3]          = src[1] - s1_im;
-                dst[0]          = src[0] + s1_re;
-                dst[1]          = src[1] + s1_im;
+                dst[2]          = (src[0] - s1_re) * 0.5f;
+                dst[3]          = (src[1] - s1_im) * 0.5f;
+                dst[0]          = (src[0] + s1_re) * 0.5f;
+                dst[1]          = (src[1] + s1_im) * 0.5f;
             }
             else
             {
@@ -152,14 +153,8 @@ namespace lsp
             return;
         }
 
-        void packed_direct_fft(float *dst, const float *src, size_t rank)
+        static inline void packed_scramble_direct(float *dst, const float *src, size_t rank)
         {
-            if (rank <= 2)
-            {
-                packed_small_direct_fft(dst, src, rank);
-                return;
-            }
-
             if ((dst == src) || (rank < 4))
             {
                 dsp::move(dst, src, 2 << rank); // 1 << rank + 1
@@ -175,21 +170,10 @@ namespace lsp
                 else
                     packed_scramble_copy_direct16(dst, src, rank-4);
             }
-
-            for (size_t i=3; i < rank; ++i)
-                packed_butterfly_direct8p(dst, i, 1 << (rank - i - 1));
-
-            packed_fft_repack(dst, rank);
         }
 
-        void packed_reverse_fft(float *dst, const float *src, size_t rank)
+        static inline void packed_scramble_reverse(float *dst, const float *src, size_t rank)
         {
-            if (rank <= 2)
-            {
-                packed_small_reverse_fft(dst, src, rank);
-                return;
-            }
-
             if ((dst == src) || (rank < 4))
             {
                 dsp::move(dst, src, 2 << rank); // 1 << rank + 1
@@ -205,21 +189,10 @@ namespace lsp
                 else
                     packed_scramble_copy_reverse16(dst, src, rank-4);
             }
-
-            for (size_t i=3; i < rank; ++i)
-                packed_butterfly_reverse8p(dst, i, 1 << (rank - i - 1));
-
-            packed_fft_repack_normalize(dst, rank);
         }
 
-        void packed_direct_fft_fma3(float *dst, const float *src, size_t rank)
+        static inline void packed_scramble_direct_fma3(float *dst, const float *src, size_t rank)
         {
-            if (rank <= 2)
-            {
-                packed_small_direct_fft(dst, src, rank);
-                return;
-            }
-
             if ((dst == src) || (rank < 4))
             {
                 dsp::move(dst, src, 2 << rank); // 1 << rank + 1
@@ -235,21 +208,10 @@ namespace lsp
                 else
                     packed_scramble_copy_direct16_fma3(dst, src, rank-4);
             }
-
-            for (size_t i=3; i < rank; ++i)
-                packed_butterfly_direct8p_fma3(dst, i, 1 << (rank - i - 1));
-
-            packed_fft_repack(dst, rank);
         }
 
-        void packed_reverse_fft_fma3(float *dst, const float *src, size_t rank)
+        static inline void packed_scramble_reverse_fma3(float *dst, const float *src, size_t rank)
         {
-            if (rank <= 2)
-            {
-                packed_small_reverse_fft(dst, src, rank);
-                return;
-            }
-
             if ((dst == src) || (rank < 4))
             {
                 dsp::move(dst, src, 2 << rank); // 1 << rank + 1
@@ -265,12 +227,183 @@ namespace lsp
                 else
                     packed_scramble_copy_reverse16_fma3(dst, src, rank-4);
             }
+        }
+
+        void packed_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 2)
+            {
+                packed_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            packed_scramble_direct(dst, src, rank);
+
+            for (size_t i=3; i < rank; ++i)
+                packed_butterfly_direct8p(dst, i, 1 << (rank - i - 1));
+
+            packed_fft_repack(dst, rank);
+        }
+
+        void packed_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 2)
+            {
+                packed_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            packed_scramble_reverse(dst, src, rank);
+
+            for (size_t i=3; i < rank; ++i)
+                packed_butterfly_reverse8p(dst, i, 1 << (rank - i - 1));
+
+            packed_fft_repack_normalize(dst, rank);
+        }
+
+        void packed_direct_fft_fma3(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 2)
+            {
+                packed_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            packed_scramble_direct_fma3(dst, src, rank);
+
+            for (size_t i=3; i < rank; ++i)
+                packed_butterfly_direct8p_fma3(dst, i, 1 << (rank - i - 1));
+
+            packed_fft_repack(dst, rank);
+        }
+
+        void packed_reverse_fft_fma3(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 2)
+            {
+                packed_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            packed_scramble_reverse_fma3(dst, src, rank);
 
             for (size_t i=3; i < rank; ++i)
                 packed_butterfly_reverse8p_fma3(dst, i, 1 << (rank - i - 1));
 
             packed_fft_repack_normalize(dst, rank);
         }
+
+        void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    packed_small_direct_fft(dst[i], src[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    packed_scramble_direct(dst[j], src[j], rank);
+
+                for (size_t i=3; i < rank; ++i)
+                    packed_butterfly_direct8p_batch(dst, i, 1 << (rank - i - 1), n);
+
+                for (size_t j=0; j<n; ++j)
+                    packed_fft_repack(dst[j], rank);
+
+                dst            += n;
+                src            += n;
+                count          -= n;
+            }
+        }
+
+        void packed_reverse_fft_batch(float **dst, const float * const *src, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    packed_small_reverse_fft(dst[i], src[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    packed_scramble_reverse(dst[j], src[j], rank);
+
+                for (size_t i=3; i < rank; ++i)
+                    packed_butterfly_reverse8p_batch(dst, i, 1 << (rank - i - 1), n);
+
+                for (size_t j=0; j<n; ++j)
+                    packed_fft_repack_normalize(dst[j], rank);
+
+                dst            += n;
+                src            += n;
+                count          -= n;
+            }
+        }
+
+        void packed_direct_fft_batch_fma3(float **dst, const float * const *src, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    packed_small_direct_fft(dst[i], src[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    packed_scramble_direct_fma3(dst[j], src[j], rank);
+
+                for (size_t i=3; i < rank; ++i)
+                    packed_butterfly_direct8p_batch_fma3(dst, i, 1 << (rank - i - 1), n);
+
+                for (size_t j=0; j<n; ++j)
+                    packed_fft_repack(dst[j], rank);
+
+                dst            += n;
+                src            += n;
+                count          -= n;
+            }
+        }
+
+        void packed_reverse_fft_batch_fma3(float **dst, const float * const *src, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    packed_small_reverse_fft(dst[i], src[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    packed_scramble_reverse_fma3(dst[j], src[j], rank);
+
+                for (size_t i=3; i < rank; ++i)
+                    packed_butterfly_reverse8p_batch_fma3(dst, i, 1 << (rank - i - 1), n);
+
+                for (size_t j=0; j<n; ++j)
+                    packed_fft_repack_normalize(dst[j], rank);
+
+                dst            += n;
+                src            += n;
+                count          -= n;
+            }
+        }
     }
 }
 
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_XCORR_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_XCORR_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+        /* Deinterleaving shuffles work inside 128-bit lanes, so bins are stored back in the original order */
+        #define XCORR_LOAD8 \
+            __ASM_EMIT("vmovups         0x00(%[a]), %%ymm0")                /* ymm0 = ar0 ai0 ar1 ai1 ... */ \
+            __ASM_EMIT("vmovups         0x20(%[a]), %%ymm1")                /* ymm1 = ar4 ai4 ar5 ai5 ... */ \
+            __ASM_EMIT("vmovups         0x00(%[b]), %%ymm2")                /* ymm2 = br0 bi0 br1 bi1 ... */ \
+            __ASM_EMIT("vmovups         0x20(%[b]), %%ymm3")                /* ymm3 = br4 bi4 br5 bi5 ... */ \
+            __ASM_EMIT("vshufps         $0xdd, %%ymm1, %%ymm0, %%ymm4")     /* ymm4 = ai */ \
+            __ASM_EMIT("vshufps         $0x88, %%ymm1, %%ymm0, %%ymm0")     /* ymm0 = ar */ \
+            __ASM_EMIT("vshufps         $0xdd, %%ymm3, %%ymm2, %%ymm5")     /* ymm5 = bi */ \
+            __ASM_EMIT("vshufps         $0x88, %%ymm3, %%ymm2, %%ymm2")     /* ymm2 = br */ \
+            __ASM_EMIT("vmovups         0x00(%[acc]), %%ymm6")              /* ymm6 = sr0 si0 sr1 si1 ... */ \
+            __ASM_EMIT("vmovups         0x20(%[acc]), %%ymm1")              /* ymm1 = sr4 si4 sr5 si5 ... */ \
+            __ASM_EMIT("vshufps         $0xdd, %%ymm1, %%ymm6, %%ymm7")     /* ymm7 = si */ \
+            __ASM_EMIT("vshufps         $0x88, %%ymm1, %%ymm6, %%ymm6")     /* ymm6 = sr */
+
+        #define XCORR_LOAD1 \
+            __ASM_EMIT("vmovss          0x00(%[a]), %%xmm0")                /* xmm0 = ar */ \
+            __ASM_EMIT("vmovss          0x04(%[a]), %%xmm4")                /* xmm4 = ai */ \
+            __ASM_EMIT("vmovss          0x00(%[b]), %%xmm2")                /* xmm2 = br */ \
+            __ASM_EMIT("vmovss          0x04(%[b]), %%xmm5")                /* xmm5 = bi */ \
+            __ASM_EMIT("vmovss          0x00(%[acc]), %%xmm6")              /* xmm6 = sr */ \
+            __ASM_EMIT("vmovss          0x04(%[acc]), %%xmm7")              /* xmm7 = si */
+
+        /* V is the register prefix: "y" for 8x blocks, "x" for 1x blocks */
+        #define XCORR_MUL(V) \
+            __ASM_EMIT("vmulps          %%" V "mm2, %%" V "mm0, %%" V "mm1")   /* V1 = ar*br */ \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm4, %%" V "mm3")   /* V3 = ai*bi */ \
+            __ASM_EMIT("vmulps          %%" V "mm5, %%" V "mm0, %%" V "mm0")   /* V0 = ar*bi */ \
+            __ASM_EMIT("vmulps          %%" V "mm2, %%" V "mm4, %%" V "mm4")   /* V4 = ai*br */ \
+            __ASM_EMIT("vaddps          %%" V "mm3, %%" V "mm1, %%" V "mm1")   /* V1 = gr = ar*br + ai*bi */ \
+            __ASM_EMIT("vsubps          %%" V "mm4, %%" V "mm0, %%" V "mm0")   /* V0 = gi = ar*bi - ai*br */
+
+        #define XCORR_WEIGHT_PLAIN(V)
+
+        #define XCORR_WEIGHT_PHAT(V) \
+            __ASM_EMIT("vmulps          %%" V "mm1, %%" V "mm1, %%" V "mm2")   /* V2 = gr*gr */ \
+            __ASM_EMIT("vmulps          %%" V "mm0, %%" V "mm0, %%" V "mm3")   /* V3 = gi*gi */ \
+            __ASM_EMIT("vaddps          %%" V "mm3, %%" V "mm2, %%" V "mm2")   /* V2 = gr*gr + gi*gi */ \
+            __ASM_EMIT("vsqrtps         %%" V "mm2, %%" V "mm2")               /* V2 = |g| */ \
+            __ASM_EMIT("vaddps          0x20(%[C]), %%" V "mm2, %%" V "mm2")   /* V2 = |g| + eps */ \
+            __ASM_EMIT("vmovaps         0x40(%[C]), %%" V "mm3")               /* V3 = 1 */ \
+            __ASM_EMIT("vdivps          %%" V "mm2, %%" V "mm3, %%" V "mm3")   /* V3 = w = 1 / (|g| + eps) */ \
+            __ASM_EMIT("vmulps          %%" V "mm3, %%" V "mm1, %%" V "mm1")   /* V1 = gr*w */ \
+            __ASM_EMIT("vmulps          %%" V "mm3, %%" V "mm0, %%" V "mm0")   /* V0 = gi*w */
+
+        #define XCORR_SMOOTH(V) \
+            __ASM_EMIT("vsubps          %%" V "mm6, %%" V "mm1, %%" V "mm1")   /* V1 = gr - sr */ \
+            __ASM_EMIT("vsubps          %%" V "mm7, %%" V "mm0, %%" V "mm0")   /* V0 = gi - si */ \
+            __ASM_EMIT("vmulps          0x00(%[C]), %%" V "mm1, %%" V "mm1")   /* V1 = (gr - sr)*k */ \
+            __ASM_EMIT("vmulps          0x00(%[C]), %%" V "mm0, %%" V "mm0")   /* V0 = (gi - si)*k */ \
+            __ASM_EMIT("vaddps          %%" V "mm6, %%" V "mm1, %%" V "mm1")   /* V1 = sr' = sr + (gr - sr)*k */ \
+            __ASM_EMIT("vaddps          %%" V "mm7, %%" V "mm0, %%" V "mm0")   /* V0 = si' = si + (gi - si)*k */
+
+        #define XCORR_STORE8 \
+            __ASM_EMIT("vunpcklps       %%ymm0, %%ymm1, %%ymm2")            /* ymm2 = sr0 si0 sr1 si1 ... */ \
+            __ASM_EMIT("vunpckhps       %%ymm0, %%ymm1, %%ymm3")            /* ymm3 = sr4 si4 sr5 si5 ... */ \
+            __ASM_EMIT("vmovups         %%ymm2, 0x00(%[acc])") \
+            __ASM_EMIT("vmovups         %%ymm3, 0x20(%[acc])")
+
+        #define XCORR_STORE1 \
+            __ASM_EMIT("vmovss          %%xmm1, 0x00(%[acc])") \
+            __ASM_EMIT("vmovss          %%xmm0, 0x04(%[acc])")
+
+        #define XCORR_KERNEL(WEIGHT) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jb              2f") \
+                /* 8x blocks */ \
+                __ASM_EMIT("1:") \
+                XCORR_LOAD8 \
+                XCORR_MUL("y") \
+                WEIGHT("y") \
+                XCORR_SMOOTH("y") \
+                XCORR_STORE8 \
+                __ASM_EMIT("add             $0x40, %[a]") \
+                __ASM_EMIT("add             $0x40, %[b]") \
+                __ASM_EMIT("add             $0x40, %[acc]") \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jae             1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("add             $7, %[count]") \
+                __ASM_EMIT("jl              4f") \
+                __ASM_EMIT("3:") \
+                XCORR_LOAD1 \
+                XCORR_MUL("x") \
+                WEIGHT("x") \
+                XCORR_SMOOTH("x") \
+                XCORR_STORE1 \
+                __ASM_EMIT("add             $0x08, %[a]") \
+                __ASM_EMIT("add             $0x08, %[b]") \
+                __ASM_EMIT("add             $0x08, %[acc]") \
+                __ASM_EMIT("dec             %[count]") \
+                __ASM_EMIT("jge             3b") \
+                __ASM_EMIT("4:") \
+                : [acc] "+r" (acc), [a] "+r" (a), [b] "+r" (b), \
+                  [count] "+r" (count) \
+                : [C] "r" (&c[0]) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            )
+
+        void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count)
+        {
+            float c[24] __lsp_aligned32;
+            for (size_t i=0; i<8; ++i)
+            {
+                c[i]            = k;                // Smoothing factor
+                c[i + 8]        = 1e-20f;           // Bias of the magnitude
+                c[i + 16]       = 1.0f;
+            }
+
+            if (weight == dsp::XCORR_PHAT)
+                XCORR_KERNEL(XCORR_WEIGHT_PHAT);
+            else
+                XCORR_KERNEL(XCORR_WEIGHT_PLAIN);
+        }
+
+        #undef XCORR_KERNEL
+        #undef XCORR_STORE1
+        #undef XCORR_STORE8
+        #undef XCORR_SMOOTH
+        #undef XCORR_WEIGHT_PHAT
+        #undef XCORR_WEIGHT_PLAIN
+        #undef XCORR_MUL
+        #undef XCORR_LOAD1
+        #undef XCORR_LOAD8
+
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_XCORR_H_ */
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_DYNAMICS_H_
+#define PRIVATE_DSP_ARCH_X86_AVX2_DYNAMICS_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_IMPL */
+
+#include <private/dsp/arch/x86/avx2/pmath/exp.h>
+#include <private/dsp/arch/x86/avx2/pmath/log.h>
+
+namespace lsp
+{
+    namespace avx2
+    {
+        /**
+         * Prepare parameters of the gain curve
+         * @param p parameters to initialize, 8 vectors
+         * @param c gain curve
+         */
+        static void gain_curve_params(float *p, const dsp::gain_curve_t *c)
+        {
+            for (size_t i=0; i<8; ++i)
+            {
+                p[i]            = 2.0f * c->dir;                    // K1 = 2*dir
+                p[i + 8]        = c->dir * M_LN2;                   // K2 = dir*ln(2)
+                p[i + 16]       = c->thresh + c->knee;              // T = thresh + knee
+                p[i + 24]       = 2.0f * c->knee;                   // W = 2*knee
+                p[i + 32]       = c->kscale;                        // KS = 1/(4*knee)
+                p[i + 40]       = c->slope * M_LOG2E;               // SL = slope*log2(e)
+                p[i + 48]       = -80.0f * M_LOG2E;                 // GM = minimum gain in log2 domain
+                p[i + 56]       = 0.0f;
+            }
+        }
+
+        /* V is the register prefix: "y" for 8x blocks, "x" for 1x blocks */
+        #define GAIN_CURVE_CORE(V, LOGN, POW2) \
+            LOGN                                                                        /* V0 = y*L, V1 = R */ \
+            __ASM_EMIT("vmulps          0x00(%[P]), %%" V "mm0, %%" V "mm0")            /* V0 = 2*dir*y*L */ \
+            __ASM_EMIT("vmulps          0x20(%[P]), %%" V "mm1, %%" V "mm1")            /* V1 = dir*R*ln(2) */ \
+            __ASM_EMIT("vaddps          %%" V "mm1, %%" V "mm0, %%" V "mm0")            /* V0 = dir*ln(x) */ \
+            __ASM_EMIT("vaddps          0x40(%[P]), %%" V "mm0, %%" V "mm0")            /* V0 = t = dir*ln(x) + thresh + knee */ \
+            __ASM_EMIT("vsubps          0x60(%[P]), %%" V "mm0, %%" V "mm1")            /* V1 = t - W */ \
+            __ASM_EMIT("vmaxps          0xe0(%[P]), %%" V "mm0, %%" V "mm0")            /* V0 = max(t, 0) */ \
+            __ASM_EMIT("vmaxps          0xe0(%[P]), %%" V "mm1, %%" V "mm1")            /* V1 = b = max(t - W, 0) */ \
+            __ASM_EMIT("vminps          0x60(%[P]), %%" V "mm0, %%" V "mm0")            /* V0 = a = min(max(t, 0), W) */ \
+            __ASM_EMIT("vmulps          %%" V "mm0, %%" V "mm0, %%" V "mm0")            /* V0 = a*a */ \
+            __ASM_EMIT("vmulps          0x80(%[P]), %%" V "mm0, %%" V "mm0")            /* V0 = a*a*KS */ \
+            __ASM_EMIT("vaddps          %%" V "mm1, %%" V "mm0, %%" V "mm0")            /* V0 = h = a*a*KS + b */ \
+            __ASM_EMIT("vmulps          0xa0(%[P]), %%" V "mm0, %%" V "mm0")            /* V0 = g = h*SL */ \
+            __ASM_EMIT("vmaxps          0xc0(%[P]), %%" V "mm0, %%" V "mm0")            /* V0 = max(g, GM) */ \
+            POW2                                                                        /* V0 = 2^g */
+
+        void x64_gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count)
+        {
+            float p[8*8] __lsp_aligned32;
+            gain_curve_params(p, c);
+
+            ARCH_X86_64_ASM(
+                __ASM_EMIT("sub             $8, %[count]")
+                __ASM_EMIT("jb              2f")
+                // 8x blocks
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         0x00(%[src]), %%ymm0")
+                GAIN_CURVE_CORE("y", LOGN_CORE_X8, POW2_CORE_X8)
+                __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+                __ASM_EMIT("add             $0x20, %[src]")
+                __ASM_EMIT("add             $0x20, %[dst]")
+                __ASM_EMIT("sub             $8, %[count]")
+                __ASM_EMIT("jae             1b")
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add             $7, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vmovss          0x00(%[src]), %%xmm0")
+                GAIN_CURVE_CORE("x", LOGN_CORE_X4, POW2_CORE_X4)
+                __ASM_EMIT("vmovss          %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("add             $0x04, %[src]")
+                __ASM_EMIT("add             $0x04, %[dst]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jge             3b")
+                __ASM_EMIT("4:")
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [P] "r" (&p[0]),
+                  [L2C] "o" (LOG2_CONST),
+                  [E2C] "o" (EXP2_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3"
+            );
+        }
+
+        #undef GAIN_CURVE_CORE
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_DYNAMICS_H_ */
@@ -25,5 +25,6 @@
 #include <private/dsp/arch/x86/avx2/graphics/transpose.h>
 #include <private/dsp/arch/x86/avx2/graphics/effects.h>
 #include <private/dsp/arch/x86/avx2/graphics/pixelfmt.h>
+#include <private/dsp/arch/x86/avx2/graphics/colormap.h>
 
 #endif /* PRIVATE_DSP_ARCH_X86_AVX2_GRAPHICS_H_ */
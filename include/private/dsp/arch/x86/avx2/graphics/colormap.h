@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_GRAPHICS_COLORMAP_H_
+#define PRIVATE_DSP_ARCH_X86_AVX2_GRAPHICS_COLORMAP_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_IMPL */
+
+namespace lsp
+{
+    namespace avx2
+    {
+        IF_ARCH_X86(
+            static const uint32_t SPECTROGRAM_CONST[] __lsp_aligned32 =
+            {
+                LSP_DSP_VEC8(0x7fffffff),           // X_SIGN
+                LSP_DSP_VEC8(0x00800000),           // X_MIN    = FLT_MIN
+                LSP_DSP_VEC8(0x007fffff),           // X_MANT
+                LSP_DSP_VEC8(0x0000007f),           // X_BIAS   = 127
+                LSP_DSP_VEC8(0x3f800000),           // ONE
+                LSP_DSP_VEC8(0x3e2308c0),           // C3
+                LSP_DSP_VEC8(0xbf1502ca),           // C2
+                LSP_DSP_VEC8(0x3fb6204d),           // C1
+                LSP_DSP_VEC8(0x00000000),           // ZERO
+                LSP_DSP_VEC8(0x437f0000)            // MAX      = 255.0
+            };
+        )
+
+        // Input: v = magnitudes, K = k, B = b
+        // Output: e = colormap indices
+        #define SPECTROGRAM_CORE(v, e, p, K, B) \
+            __ASM_EMIT("vandps          0x000 + %[SC], " v ", " v)      /* v = abs(s) */ \
+            __ASM_EMIT("vmaxps          0x020 + %[SC], " v ", " v)      /* v = max(abs(s), X_MIN), NaN -> X_MIN */ \
+            __ASM_EMIT("vpsrld          $23, " v ", " e)                /* e = ilog2(v) + 127 */ \
+            __ASM_EMIT("vandps          0x040 + %[SC], " v ", " v)      /* v = mant(v) */ \
+            __ASM_EMIT("vpsubd          0x060 + %[SC], " e ", " e)      /* e = ilog2(v) */ \
+            __ASM_EMIT("vorps           0x080 + %[SC], " v ", " v)      /* v = 1 + M */ \
+            __ASM_EMIT("vcvtdq2ps       " e ", " e)                     /* e = E = float(ilog2(v)) */ \
+            __ASM_EMIT("vsubps          0x080 + %[SC], " v ", " v)      /* v = M */ \
+            __ASM_EMIT("vmulps          0x0a0 + %[SC], " v ", " p)      /* p = M*C3 */ \
+            __ASM_EMIT("vaddps          0x0c0 + %[SC], " p ", " p)      /* p = C2+M*C3 */ \
+            __ASM_EMIT("vmulps          " v ", " p ", " p)              /* p = M*(C2+M*C3) */ \
+            __ASM_EMIT("vaddps          0x0e0 + %[SC], " p ", " p)      /* p = C1+M*(C2+M*C3) */ \
+            __ASM_EMIT("vmulps          " v ", " p ", " p)              /* p = M*(C1+M*(C2+M*C3)) = log2(1 + M) */ \
+            __ASM_EMIT("vaddps          " p ", " e ", " e)              /* e = E + log2(1 + M) = log2(v) */ \
+            __ASM_EMIT("vmulps          " K ", " e ", " e)              /* e = k*log2(v) */ \
+            __ASM_EMIT("vaddps          " B ", " e ", " e)              /* e = k*log2(v) + b */ \
+            __ASM_EMIT("vmaxps          0x100 + %[SC], " e ", " e)      /* e = max(k*log2(v) + b, 0) */ \
+            __ASM_EMIT("vminps          0x120 + %[SC], " e ", " e)      /* e = min(max(k*log2(v) + b, 0), 255) */ \
+            __ASM_EMIT("vcvttps2dq      " e ", " e)                     /* e = int(min(max(k*log2(v) + b, 0), 255)) */
+
+        // Input: e = colormap indices
+        // Output: v = pixels, p is destroyed
+        #define SPECTROGRAM_GATHER(v, e, p) \
+            __ASM_EMIT("vpcmpeqd        " p ", " p ", " p)              /* p = mask */ \
+            __ASM_EMIT("vpgatherdd      " p ", (%[lut], " e ", 4), " v) /* v = lut[e] */
+
+        void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count)
+        {
+            float range         = 255.0f / (dbmax - dbmin);
+            float k             = 6.02059991f * range;         // 20 * log10(2) dB per octave
+            float b             = 0.5f - dbmin * range;
+            IF_ARCH_X86(size_t t);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vbroadcastss    %[k], %%ymm6")                  // ymm6 = k
+                __ASM_EMIT("vbroadcastss    %[b], %%ymm7")                  // ymm7 = b
+
+                // x16 blocks
+                __ASM_EMIT("sub             $16, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         0x00(%[src]), %%ymm0")
+                __ASM_EMIT("vmovups         0x20(%[src]), %%ymm3")
+                SPECTROGRAM_CORE("%%ymm0", "%%ymm1", "%%ymm2", "%%ymm6", "%%ymm7")
+                SPECTROGRAM_CORE("%%ymm3", "%%ymm4", "%%ymm5", "%%ymm6", "%%ymm7")
+                SPECTROGRAM_GATHER("%%ymm0", "%%ymm1", "%%ymm2")
+                SPECTROGRAM_GATHER("%%ymm3", "%%ymm4", "%%ymm5")
+                __ASM_EMIT("vmovdqu         %%ymm0, 0x00(%[dst])")
+                __ASM_EMIT("vmovdqu         %%ymm3, 0x20(%[dst])")
+                __ASM_EMIT("add             $0x40, %[src]")
+                __ASM_EMIT("add             $0x40, %[dst]")
+                __ASM_EMIT("sub             $16, %[count]")
+                __ASM_EMIT("jae             1b")
+
+                // x8 block
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add             $8, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("vmovups         0x00(%[src]), %%ymm0")
+                SPECTROGRAM_CORE("%%ymm0", "%%ymm1", "%%ymm2", "%%ymm6", "%%ymm7")
+                SPECTROGRAM_GATHER("%%ymm0", "%%ymm1", "%%ymm2")
+                __ASM_EMIT("vmovdqu         %%ymm0, 0x00(%[dst])")
+                __ASM_EMIT("add             $0x20, %[src]")
+                __ASM_EMIT("add             $0x20, %[dst]")
+                __ASM_EMIT("sub             $8, %[count]")
+
+                // x4 block
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add             $4, %[count]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("vmovups         0x00(%[src]), %%xmm0")
+                SPECTROGRAM_CORE("%%xmm0", "%%xmm1", "%%xmm2", "%%xmm6", "%%xmm7")
+                SPECTROGRAM_GATHER("%%xmm0", "%%xmm1", "%%xmm2")
+                __ASM_EMIT("vmovdqu         %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("add             $0x10, %[src]")
+                __ASM_EMIT("add             $0x10, %[dst]")
+                __ASM_EMIT("sub             $4, %[count]")
+
+                // x1 blocks
+                __ASM_EMIT("6:")
+                __ASM_EMIT("add             $3, %[count]")
+                __ASM_EMIT("jl              8f")
+                __ASM_EMIT("7:")
+                __ASM_EMIT("vmovss          0x00(%[src]), %%xmm0")
+                SPECTROGRAM_CORE("%%xmm0", "%%xmm1", "%%xmm2", "%%xmm6", "%%xmm7")
+                __ASM_EMIT("vmovd           %%xmm1, %k[t]")                 // t = index
+                __ASM_EMIT("mov             (%[lut], %[t], 4), %k[t]")      // t = lut[index]
+                __ASM_EMIT("mov             %k[t], 0x00(%[dst])")
+                __ASM_EMIT("add             $0x04, %[src]")
+                __ASM_EMIT("add             $0x04, %[dst]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jge             7b")
+
+                // End
+                __ASM_EMIT("8:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+                  [t] "=&r" (t)
+                : [lut] "r" (lut),
+                  [k] "m" (k), [b] "m" (b),
+                  [SC] "o" (SPECTROGRAM_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef SPECTROGRAM_GATHER
+        #undef SPECTROGRAM_CORE
+
+    } /* namespace avx2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_GRAPHICS_COLORMAP_H_ */
@@ -766,6 +766,290 @@ namespace lsp
                       "%xmm12", "%xmm13", "%xmm14", "%xmm15"
                 );
             }
+
+        IF_ARCH_X86(
+            static const uint32_t EFF_HSLA_BGRA32_XC[] __lsp_aligned32 =
+            {
+                LSP_DSP_VEC8(0x7fffffff),               // SIGN
+                LSP_DSP_VEC8(0x3f800000),               // 1.0
+                LSP_DSP_VEC8(0x437f0000),               // 255.0
+                LSP_DSP_VEC8(0x3eaaaaab),               // 1/3
+                LSP_DSP_VEC8(0x40c00000),               // 6.0
+                LSP_DSP_VEC8(0x40800000)                // 4.0
+            };
+        )
+
+        /*
+         * Fused effects use the closed form of HSL->RGB conversion:
+         *   R = T1 + D * W(H + 1/3), G = T1 + D * W(H), B = T1 + D * W(H - 1/3)
+         * where W(t) = min(max(min(6*t, 4 - 6*t), 0), 1), D = 2 * S * min(L, 1 - L), T1 = L - D/2
+         */
+        #define EFF_HSLA_WEIGHT(t) \
+            __ASM_EMIT("vmulps          0x80 + %[XC], " t ", " t)               /* t    = 6*t */ \
+            __ASM_EMIT("vmovaps         0xa0 + %[XC], %%ymm4")                  /* ymm4 = 4 */ \
+            __ASM_EMIT("vsubps          " t ", %%ymm4, %%ymm4")                 /* ymm4 = 4 - 6*t */ \
+            __ASM_EMIT("vminps          %%ymm4, " t ", " t)                     /* t    = min(6*t, 4 - 6*t) */ \
+            __ASM_EMIT("vxorps          %%ymm4, %%ymm4, %%ymm4")                /* ymm4 = 0 */ \
+            __ASM_EMIT("vmaxps          %%ymm4, " t ", " t)                     /* t    = max(min(6*t, 4 - 6*t), 0) */ \
+            __ASM_EMIT("vminps          0x20 + %[XC], " t ", " t)               /* t    = W(t) */
+
+        #define EFF_HSLA_WEIGHTS_CORE \
+            /* ymm2 = H */ \
+            __ASM_EMIT("vmovaps         %%ymm2, %%ymm1")                        /* ymm1 = TG = H */ \
+            __ASM_EMIT("vaddps          0x60 + %[XC], %%ymm2, %%ymm0")          /* ymm0 = H + 1/3 */ \
+            __ASM_EMIT("vsubps          0x60 + %[XC], %%ymm2, %%ymm2")          /* ymm2 = H - 1/3 */ \
+            __ASM_EMIT("vxorps          %%ymm5, %%ymm5, %%ymm5")                /* ymm5 = 0 */ \
+            __ASM_EMIT("vcmpps          $14, 0x20 + %[XC], %%ymm0, %%ymm4")     /* ymm4 = [ H + 1/3 > 1 ] */ \
+            __ASM_EMIT("vcmpps          $1, %%ymm5, %%ymm2, %%ymm5")            /* ymm5 = [ H - 1/3 < 0 ] */ \
+            __ASM_EMIT("vandps          0x20 + %[XC], %%ymm4, %%ymm4")          /* ymm4 = 1 & [ H + 1/3 > 1 ] */ \
+            __ASM_EMIT("vandps          0x20 + %[XC], %%ymm5, %%ymm5")          /* ymm5 = 1 & [ H - 1/3 < 0 ] */ \
+            __ASM_EMIT("vsubps          %%ymm4, %%ymm0, %%ymm0")                /* ymm0 = TR */ \
+            __ASM_EMIT("vaddps          %%ymm5, %%ymm2, %%ymm2")                /* ymm2 = TB */ \
+            EFF_HSLA_WEIGHT("%%ymm0")                                           /* ymm0 = WR */ \
+            EFF_HSLA_WEIGHT("%%ymm1")                                           /* ymm1 = WG */ \
+            EFF_HSLA_WEIGHT("%%ymm2")                                           /* ymm2 = WB */
+
+        #define EFF_HSLA_PIXEL_CORE(T1, D, WR, WG, WB) \
+            /* ymm3 = alpha */ \
+            __ASM_EMIT("vmovaps         0x40 + %[XC], %%ymm7")                  /* ymm7 = 255 */ \
+            __ASM_EMIT("vmulps          %%ymm7, %%ymm3, %%ymm3")                /* ymm3 = alpha * 255 */ \
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm7, %%ymm7")                /* ymm7 = A = 255 - alpha * 255 */ \
+            __ASM_EMIT("vmovaps         " D ", %%ymm3")                         /* ymm3 = D */ \
+            __ASM_EMIT("vmulps          " WB ", %%ymm3, %%ymm4")                /* ymm4 = D*WB */ \
+            __ASM_EMIT("vmulps          " WG ", %%ymm3, %%ymm5")                /* ymm5 = D*WG */ \
+            __ASM_EMIT("vmulps          " WR ", %%ymm3, %%ymm6")                /* ymm6 = D*WR */ \
+            __ASM_EMIT("vaddps          " T1 ", %%ymm4, %%ymm4")                /* ymm4 = b = T1 + D*WB */ \
+            __ASM_EMIT("vaddps          " T1 ", %%ymm5, %%ymm5")                /* ymm5 = g = T1 + D*WG */ \
+            __ASM_EMIT("vaddps          " T1 ", %%ymm6, %%ymm6")                /* ymm6 = r = T1 + D*WR */ \
+            __ASM_EMIT("vmulps          %%ymm7, %%ymm4, %%ymm4")                /* ymm4 = B = b * A */ \
+            __ASM_EMIT("vmulps          %%ymm7, %%ymm5, %%ymm5")                /* ymm5 = G = g * A */ \
+            __ASM_EMIT("vmulps          %%ymm7, %%ymm6, %%ymm6")                /* ymm6 = R = r * A */ \
+            __ASM_EMIT("vxorps          %%ymm3, %%ymm3, %%ymm3")                /* ymm3 = 0 */ \
+            __ASM_EMIT("vmaxps          %%ymm3, %%ymm4, %%ymm4")                /* ymm4 = max(B, 0) */ \
+            __ASM_EMIT("vmaxps          %%ymm3, %%ymm5, %%ymm5")                /* ymm5 = max(G, 0) */ \
+            __ASM_EMIT("vmaxps          %%ymm3, %%ymm6, %%ymm6")                /* ymm6 = max(R, 0) */ \
+            __ASM_EMIT("vmaxps          %%ymm3, %%ymm7, %%ymm7")                /* ymm7 = max(A, 0) */ \
+            __ASM_EMIT("vminps          0x40 + %[XC], %%ymm4, %%ymm4")          /* ymm4 = min(max(B, 0), 255) */ \
+            __ASM_EMIT("vminps          0x40 + %[XC], %%ymm5, %%ymm5")          /* ymm5 = min(max(G, 0), 255) */ \
+            __ASM_EMIT("vminps          0x40 + %[XC], %%ymm6, %%ymm6")          /* ymm6 = min(max(R, 0), 255) */ \
+            __ASM_EMIT("vminps          0x40 + %[XC], %%ymm7, %%ymm7")          /* ymm7 = min(max(A, 0), 255) */ \
+            __ASM_EMIT("vcvttps2dq      %%ymm4, %%ymm4")                        /* ymm4 = int(B) */ \
+            __ASM_EMIT("vcvttps2dq      %%ymm5, %%ymm5")                        /* ymm5 = int(G) */ \
+            __ASM_EMIT("vcvttps2dq      %%ymm6, %%ymm6")                        /* ymm6 = int(R) */ \
+            __ASM_EMIT("vcvttps2dq      %%ymm7, %%ymm7")                        /* ymm7 = int(A) */ \
+            __ASM_EMIT("vpslld          $8, %%ymm5, %%ymm5")                    /* ymm5 = int(G) << 8 */ \
+            __ASM_EMIT("vpslld          $16, %%ymm6, %%ymm6")                   /* ymm6 = int(R) << 16 */ \
+            __ASM_EMIT("vpslld          $24, %%ymm7, %%ymm7")                   /* ymm7 = int(A) << 24 */ \
+            __ASM_EMIT("vpor            %%ymm5, %%ymm4, %%ymm4") \
+            __ASM_EMIT("vpor            %%ymm7, %%ymm6, %%ymm6") \
+            __ASM_EMIT("vpor            %%ymm6, %%ymm4, %%ymm4")                /* ymm4 = B G R A */
+
+        #define EFF_HSLA_BGRA32_LOOP(CORE) \
+            __ASM_EMIT("sub             $8, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            /* 8x blocks */ \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("vmovups         0x00(%[src]), %%ymm0")                  /* ymm0 = v */ \
+            CORE \
+            __ASM_EMIT("vmovdqu         %%ymm4, 0x00(%[dst])") \
+            __ASM_EMIT("add             $0x20, %[src]") \
+            __ASM_EMIT("add             $0x20, %[dst]") \
+            __ASM_EMIT("sub             $8, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            /* 1x blocks */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add             $7, %[count]") \
+            __ASM_EMIT("jl              4f") \
+            __ASM_EMIT("3:") \
+            __ASM_EMIT("vmovss          0x00(%[src]), %%xmm0")                  /* xmm0 = v */ \
+            CORE \
+            __ASM_EMIT("vmovd           %%xmm4, 0x00(%[dst])") \
+            __ASM_EMIT("add             $0x04, %[src]") \
+            __ASM_EMIT("add             $0x04, %[dst]") \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jge             3b") \
+            __ASM_EMIT("4:")
+
+        #define EFF_HSLA_BGRA32_WEIGHTS(off) \
+            __ASM_EMIT("vbroadcastss    0x00(%[eff]), %%ymm2")                  /* ymm2 = H */ \
+            EFF_HSLA_WEIGHTS_CORE \
+            __ASM_EMIT("vmovaps         %%ymm0, " off " + 0x00(%[P])") \
+            __ASM_EMIT("vmovaps         %%ymm1, " off " + 0x20(%[P])") \
+            __ASM_EMIT("vmovaps         %%ymm2, " off " + 0x40(%[P])")
+
+        #define EFF_HSLA_HUE_BGRA32_CORE \
+            /* ymm0 = v */ \
+            __ASM_EMIT("vandps          0x00 + %[XC], %%ymm0, %%ymm0")          /* ymm0 = abs(v) */ \
+            __ASM_EMIT("vmovaps         0x20 + %[XC], %%ymm1")                  /* ymm1 = 1 */ \
+            __ASM_EMIT("vxorps          %%ymm4, %%ymm4, %%ymm4")                /* ymm4 = 0 */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm1, %%ymm1")                /* ymm1 = V = 1 - abs(v) */ \
+            __ASM_EMIT("vsubps          0x20(%[P]), %%ymm1, %%ymm3")            /* ymm3 = V - T */ \
+            __ASM_EMIT("vminps          0x20(%[P]), %%ymm1, %%ymm1")            /* ymm1 = min(V, T) */ \
+            __ASM_EMIT("vmaxps          %%ymm4, %%ymm3, %%ymm3")                /* ymm3 = max(V - T, 0) */ \
+            __ASM_EMIT("vaddps          0x00(%[P]), %%ymm1, %%ymm2")            /* ymm2 = NH = EH + min(V, T) */ \
+            __ASM_EMIT("vmulps          0x40(%[P]), %%ymm3, %%ymm3")            /* ymm3 = alpha = max(V - T, 0) * KT */ \
+            __ASM_EMIT("vcmpps          $14, 0x20 + %[XC], %%ymm2, %%ymm4")     /* ymm4 = [ NH > 1 ] */ \
+            __ASM_EMIT("vandps          0x20 + %[XC], %%ymm4, %%ymm4")          /* ymm4 = 1 & [ NH > 1 ] */ \
+            __ASM_EMIT("vsubps          %%ymm4, %%ymm2, %%ymm2")                /* ymm2 = H = NH - (1 & [ NH > 1 ]) */ \
+            EFF_HSLA_WEIGHTS_CORE \
+            EFF_HSLA_PIXEL_CORE("0x60(%[P])", "0x80(%[P])", "%%ymm0", "%%ymm1", "%%ymm2")
+
+        void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count)
+        {
+            IF_ARCH_X86(
+                float p[5*8] __lsp_aligned32;
+                float x     = eff->s * ((eff->l < 0.5f) ? eff->l : 1.0f - eff->l);
+                for (size_t i=0; i<8; ++i)
+                {
+                    p[i]        = eff->h;               // EH
+                    p[i + 8]    = 1.0f - eff->thresh;   // T
+                    p[i + 16]   = 1.0f / eff->thresh;   // KT
+                    p[i + 24]   = eff->l - x;           // T1
+                    p[i + 32]   = x + x;                // D
+                }
+            );
+
+            ARCH_X86_ASM(
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_HUE_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]),
+                  [XC] "o" (EFF_HSLA_BGRA32_XC)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef EFF_HSLA_HUE_BGRA32_CORE
+
+        #define EFF_HSLA_ALPHA_BGRA32_CORE \
+            /* ymm0 = v */ \
+            __ASM_EMIT("vandps          0x00 + %[XC], %%ymm0, %%ymm0")          /* ymm0 = abs(v) */ \
+            __ASM_EMIT("vmovaps         0x20 + %[XC], %%ymm3")                  /* ymm3 = 1 */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm3, %%ymm3")                /* ymm3 = alpha = 1 - abs(v) */ \
+            EFF_HSLA_PIXEL_CORE("0x00(%[P])", "0x20(%[P])", "0x40(%[P])", "0x60(%[P])", "0x80(%[P])")
+
+        void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count)
+        {
+            IF_ARCH_X86(
+                float p[5*8] __lsp_aligned32;
+                float x     = eff->s * ((eff->l < 0.5f) ? eff->l : 1.0f - eff->l);
+                for (size_t i=0; i<8; ++i)
+                {
+                    p[i]        = eff->l - x;           // T1
+                    p[i + 8]    = x + x;                // D
+                }
+            );
+
+            ARCH_X86_ASM(
+                EFF_HSLA_BGRA32_WEIGHTS("0x40")
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_ALPHA_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]), [eff] "r" (eff),
+                  [XC] "o" (EFF_HSLA_BGRA32_XC)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef EFF_HSLA_ALPHA_BGRA32_CORE
+
+        #define EFF_HSLA_SAT_BGRA32_CORE \
+            /* ymm0 = v */ \
+            __ASM_EMIT("vandps          0x00 + %[XC], %%ymm0, %%ymm0")          /* ymm0 = V = abs(v) */ \
+            __ASM_EMIT("vxorps          %%ymm4, %%ymm4, %%ymm4")                /* ymm4 = 0 */ \
+            __ASM_EMIT("vmovaps         0x40(%[P]), %%ymm3")                    /* ymm3 = t */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm3, %%ymm3")                /* ymm3 = t - V */ \
+            __ASM_EMIT("vmaxps          0x40(%[P]), %%ymm0, %%ymm0")            /* ymm0 = max(V, t) */ \
+            __ASM_EMIT("vmaxps          %%ymm4, %%ymm3, %%ymm3")                /* ymm3 = max(t - V, 0) */ \
+            __ASM_EMIT("vmulps          0x20(%[P]), %%ymm0, %%ymm0")            /* ymm0 = X = max(V, t) * MS */ \
+            __ASM_EMIT("vmulps          0x60(%[P]), %%ymm3, %%ymm3")            /* ymm3 = alpha = max(t - V, 0) * KT */ \
+            __ASM_EMIT("vmovaps         0x00(%[P]), %%ymm2")                    /* ymm2 = L */ \
+            __ASM_EMIT("vaddps          %%ymm0, %%ymm0, %%ymm1")                /* ymm1 = D = X + X */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm2, %%ymm2")                /* ymm2 = T1 = L - X */ \
+            EFF_HSLA_PIXEL_CORE("%%ymm2", "%%ymm1", "0x80(%[P])", "0xa0(%[P])", "0xc0(%[P])")
+
+        void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count)
+        {
+            IF_ARCH_X86(
+                float p[7*8] __lsp_aligned32;
+                for (size_t i=0; i<8; ++i)
+                {
+                    p[i]        = eff->l;               // L
+                    p[i + 8]    = eff->s * ((eff->l < 0.5f) ? eff->l : 1.0f - eff->l); // MS
+                    p[i + 16]   = eff->thresh;          // t
+                    p[i + 24]   = 1.0f / eff->thresh;   // KT
+                }
+            );
+
+            ARCH_X86_ASM(
+                EFF_HSLA_BGRA32_WEIGHTS("0x80")
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_SAT_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]), [eff] "r" (eff),
+                  [XC] "o" (EFF_HSLA_BGRA32_XC)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef EFF_HSLA_SAT_BGRA32_CORE
+
+        #define EFF_HSLA_LIGHT_BGRA32_CORE \
+            /* ymm0 = v */ \
+            __ASM_EMIT("vandps          0x00 + %[XC], %%ymm0, %%ymm0")          /* ymm0 = V = abs(v) */ \
+            __ASM_EMIT("vxorps          %%ymm4, %%ymm4, %%ymm4")                /* ymm4 = 0 */ \
+            __ASM_EMIT("vmovaps         0x40(%[P]), %%ymm3")                    /* ymm3 = t */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm3, %%ymm3")                /* ymm3 = t - V */ \
+            __ASM_EMIT("vmaxps          0x40(%[P]), %%ymm0, %%ymm0")            /* ymm0 = max(V, t) */ \
+            __ASM_EMIT("vmaxps          %%ymm4, %%ymm3, %%ymm3")                /* ymm3 = max(t - V, 0) */ \
+            __ASM_EMIT("vmulps          0x20(%[P]), %%ymm0, %%ymm2")            /* ymm2 = L = max(V, t) * EL */ \
+            __ASM_EMIT("vmulps          0x60(%[P]), %%ymm3, %%ymm3")            /* ymm3 = alpha = max(t - V, 0) * KT */ \
+            __ASM_EMIT("vmovaps         0x20 + %[XC], %%ymm1")                  /* ymm1 = 1 */ \
+            __ASM_EMIT("vsubps          %%ymm2, %%ymm1, %%ymm1")                /* ymm1 = 1 - L */ \
+            __ASM_EMIT("vminps          %%ymm2, %%ymm1, %%ymm1")                /* ymm1 = min(L, 1 - L) */ \
+            __ASM_EMIT("vmulps          0x00(%[P]), %%ymm1, %%ymm1")            /* ymm1 = X = ES * min(L, 1 - L) */ \
+            __ASM_EMIT("vsubps          %%ymm1, %%ymm2, %%ymm2")                /* ymm2 = T1 = L - X */ \
+            __ASM_EMIT("vaddps          %%ymm1, %%ymm1, %%ymm1")                /* ymm1 = D = X + X */ \
+            EFF_HSLA_PIXEL_CORE("%%ymm2", "%%ymm1", "0x80(%[P])", "0xa0(%[P])", "0xc0(%[P])")
+
+        void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count)
+        {
+            IF_ARCH_X86(
+                float p[7*8] __lsp_aligned32;
+                for (size_t i=0; i<8; ++i)
+                {
+                    p[i]        = eff->s;               // ES
+                    p[i + 8]    = eff->l;               // EL
+                    p[i + 16]   = eff->thresh;          // t
+                    p[i + 24]   = 1.0f / eff->thresh;   // KT
+                }
+            );
+
+            ARCH_X86_ASM(
+                EFF_HSLA_BGRA32_WEIGHTS("0x80")
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_LIGHT_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]), [eff] "r" (eff),
+                  [XC] "o" (EFF_HSLA_BGRA32_XC)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef EFF_HSLA_LIGHT_BGRA32_CORE
+        #undef EFF_HSLA_BGRA32_WEIGHTS
+        #undef EFF_HSLA_BGRA32_LOOP
+        #undef EFF_HSLA_PIXEL_CORE
+        #undef EFF_HSLA_WEIGHTS_CORE
+        #undef EFF_HSLA_WEIGHT
     }
 }
 
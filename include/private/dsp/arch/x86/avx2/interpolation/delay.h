@@ -0,0 +1,365 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_INTERPOLATION_DELAY_H_
+#define PRIVATE_DSP_ARCH_X86_AVX2_INTERPOLATION_DELAY_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_IMPL */
+
+#define DELAY_TAPS_BLOCK        16
+
+namespace lsp
+{
+    namespace avx2
+    {
+        /**
+         * Prepare parameters for reading the delay line
+         * @param p parameters to initialize, 7 vectors
+         * @param d delay line descriptor
+         * @param count number of samples to read
+         * @param k1 multiplier of (x[k+2] - x[k-1]) for the cubic term
+         * @param k2 multiplier of (x[k] - x[k+1]) for the cubic term
+         */
+        static void delay_read_init(float *p, const dsp::delay_t *d, size_t count, float k1, float k2)
+        {
+            uint32_t *u     = reinterpret_cast<uint32_t *>(p);
+            for (size_t i=0; i<8; ++i)
+            {
+                p[i]            = i;                        // I = positions
+                p[i + 8]        = 8.0f;                     // Step for 8x block
+                u[i + 16]       = d->head - count - 1;      // S = start of the block
+                u[i + 24]       = d->mask;                  // M = mask
+                p[i + 32]       = 0.5f;
+                p[i + 40]       = k1;
+                p[i + 48]       = k2;
+            }
+        }
+
+        /*
+         * Compute positions of 8 samples, split them into integer and fractional parts
+         * and gather points x[k] and x[k+1] of each sample into ymm3 and ymm2
+         */
+        #define DELAY_POINTS \
+            __ASM_EMIT("vsubps          0x00(%[delay]), %%ymm7, %%ymm1")        /* ymm1 = P = I - D */ \
+            __ASM_EMIT("vroundps        $1, %%ymm1, %%ymm3")                    /* ymm3 = floor(P) */ \
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm1")                /* ymm1 = F = P - floor(P) */ \
+            __ASM_EMIT("vcvttps2dq      %%ymm3, %%ymm4")                        /* ymm4 = T = int(floor(P)) */ \
+            __ASM_EMIT("vpaddd          0x40(%[P]), %%ymm4, %%ymm4")            /* ymm4 = S + T */ \
+            __ASM_EMIT("vpand           0x60(%[P]), %%ymm4, %%ymm4")            /* ymm4 = J = (S + T) & M */ \
+            __ASM_EMIT("vpcmpeqd        %%ymm6, %%ymm6, %%ymm6") \
+            __ASM_EMIT("vgatherdps      %%ymm6, 0x04(%[buf], %%ymm4, 4), %%ymm3")   /* ymm3 = x[k] */ \
+            __ASM_EMIT("vpcmpeqd        %%ymm6, %%ymm6, %%ymm6") \
+            __ASM_EMIT("vgatherdps      %%ymm6, 0x08(%[buf], %%ymm4, 4), %%ymm2")   /* ymm2 = x[k+1] */
+
+        /* ymm4 = J, ymm3 = x[k], ymm2 = x[k+1], ymm1 = F, result in ymm5 */
+        #define DELAY_LINEAR_CORE \
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm2, %%ymm5")                /* ymm5 = x[k+1] - x[k] */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm5, %%ymm5")                /* ymm5 = (x[k+1] - x[k])*F */ \
+            __ASM_EMIT("vaddps          %%ymm3, %%ymm5, %%ymm5")                /* ymm5 = x[k] + (x[k+1] - x[k])*F */
+
+        #define DELAY_CUBIC_TERMS \
+            __ASM_EMIT("vpcmpeqd        %%ymm6, %%ymm6, %%ymm6") \
+            __ASM_EMIT("vgatherdps      %%ymm6, 0x00(%[buf], %%ymm4, 4), %%ymm0")   /* ymm0 = x[k-1] */ \
+            __ASM_EMIT("vpcmpeqd        %%ymm6, %%ymm6, %%ymm6") \
+            __ASM_EMIT("vgatherdps      %%ymm6, 0x0c(%[buf], %%ymm4, 4), %%ymm5")   /* ymm5 = x[k+2] */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm2, %%ymm4")                /* ymm4 = x[k+1] - x[k-1] */ \
+            __ASM_EMIT("vaddps          %%ymm0, %%ymm2, %%ymm6")                /* ymm6 = x[k-1] + x[k+1] */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm5, %%ymm5")                /* ymm5 = x[k+2] - x[k-1] */ \
+            __ASM_EMIT("vsubps          %%ymm2, %%ymm3, %%ymm0")                /* ymm0 = x[k] - x[k+1] */ \
+            __ASM_EMIT("vmulps          0x80(%[P]), %%ymm4, %%ymm4")            /* ymm4 = h = 0.5*(x[k+1] - x[k-1]) */ \
+            __ASM_EMIT("vmulps          0x80(%[P]), %%ymm6, %%ymm6")            /* ymm6 = 0.5*(x[k-1] + x[k+1]) */ \
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm6, %%ymm6")                /* ymm6 = q = 0.5*(x[k-1] + x[k+1]) - x[k] */ \
+            __ASM_EMIT("vmulps          0xa0(%[P]), %%ymm5, %%ymm5")            /* ymm5 = K1*(x[k+2] - x[k-1]) */ \
+            __ASM_EMIT("vmulps          0xc0(%[P]), %%ymm0, %%ymm0")            /* ymm0 = K2*(x[k] - x[k+1]) */ \
+            __ASM_EMIT("vaddps          %%ymm0, %%ymm5, %%ymm5")                /* ymm5 = c3 */
+
+        #define DELAY_CUBIC_POLY \
+            /* ymm5 = c3, ymm6 = c2, ymm4 = c1 */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm5, %%ymm5")                /* ymm5 = c3*F */ \
+            __ASM_EMIT("vaddps          %%ymm6, %%ymm5, %%ymm5")                /* ymm5 = c3*F + c2 */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm5, %%ymm5")                /* ymm5 = (c3*F + c2)*F */ \
+            __ASM_EMIT("vaddps          %%ymm4, %%ymm5, %%ymm5")                /* ymm5 = (c3*F + c2)*F + c1 */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm5, %%ymm5")                /* ymm5 = ((c3*F + c2)*F + c1)*F */ \
+            __ASM_EMIT("vaddps          %%ymm3, %%ymm5, %%ymm5")                /* ymm5 = ((c3*F + c2)*F + c1)*F + x[k] */
+
+        #define DELAY_HERMITE_CORE \
+            DELAY_CUBIC_TERMS \
+            __ASM_EMIT("vsubps          %%ymm5, %%ymm6, %%ymm6")                /* ymm6 = c2 = q - c3 */ \
+            DELAY_CUBIC_POLY
+
+        #define DELAY_LAGRANGE_CORE \
+            DELAY_CUBIC_TERMS \
+            __ASM_EMIT("vsubps          %%ymm5, %%ymm4, %%ymm4")                /* ymm4 = c1 = h - c3 */ \
+            DELAY_CUBIC_POLY
+
+        #define DELAY_READ_KERNEL(CORE) \
+            ARCH_X86_64_ASM( \
+                __ASM_EMIT("vmovaps         0x00(%[P]), %%ymm7")                    /* ymm7 = I */ \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jb              2f") \
+                __ASM_EMIT("1:") \
+                DELAY_POINTS \
+                CORE \
+                __ASM_EMIT("vmovups         %%ymm5, 0x00(%[dst])") \
+                __ASM_EMIT("vaddps          0x20(%[P]), %%ymm7, %%ymm7")            /* ymm7 = I + 8 */ \
+                __ASM_EMIT("add             $0x20, %[delay]") \
+                __ASM_EMIT("add             $0x20, %[dst]") \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jae             1b") \
+                __ASM_EMIT("2:") \
+                : [dst] "+r" (vd), [delay] "+r" (vs), [count] "+r" (n) \
+                : [P] "r" (&p[0]), [buf] "r" (buf) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            )
+
+        /*
+         * The last incomplete block is processed as the full block with delays padded
+         * by a safe value, so the kernel does not need scalar code
+         */
+        #define DELAY_READ_APPLY(CORE) \
+            float *vd           = dst; \
+            const float *vs     = delay; \
+            size_t n            = count; \
+            DELAY_READ_KERNEL(CORE); \
+            \
+            size_t done         = count & ~size_t(7); \
+            if (done < count) \
+            { \
+                float xd[8] __lsp_aligned32; \
+                float xs[8] __lsp_aligned32; \
+                for (size_t i=0; i<8; ++i) \
+                { \
+                    p[i]                = done + i; \
+                    xs[i]               = (done + i < count) ? delay[done + i] : 2.0f; \
+                } \
+                vd                  = xd; \
+                vs                  = xs; \
+                n                   = 8; \
+                DELAY_READ_KERNEL(CORE); \
+                for (size_t i=done; i<count; ++i) \
+                    dst[i]              = xd[i - done]; \
+            }
+
+        void x64_delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            float p[7*8] __lsp_aligned32;
+            delay_read_init(p, d, count, 0.0f, 0.0f);
+            DELAY_READ_APPLY(DELAY_LINEAR_CORE);
+        }
+
+        void x64_delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            float p[7*8] __lsp_aligned32;
+            delay_read_init(p, d, count, 0.5f, 1.5f);
+            DELAY_READ_APPLY(DELAY_HERMITE_CORE);
+        }
+
+        void x64_delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            float p[7*8] __lsp_aligned32;
+            delay_read_init(p, d, count, 1.0f/6.0f, 0.5f);
+            DELAY_READ_APPLY(DELAY_LAGRANGE_CORE);
+        }
+
+        #undef DELAY_READ_APPLY
+        #undef DELAY_READ_KERNEL
+        #undef DELAY_LAGRANGE_CORE
+        #undef DELAY_HERMITE_CORE
+        #undef DELAY_CUBIC_POLY
+        #undef DELAY_CUBIC_TERMS
+        #undef DELAY_LINEAR_CORE
+        #undef DELAY_POINTS
+
+        /**
+         * Compute weights of the 4 points x[k-1] .. x[k+2] of the tap
+         * @param w weights of points, 4 vectors
+         * @param tap tap descriptor
+         * @return offset of the x[k-1] point relative to the sample being read
+         */
+        static int32_t delay_tap_weights(float *w, const dsp::delay_tap_t *tap)
+        {
+            float v[4];
+            float p             = -tap->delay;
+            float t             = floorf(p);
+            float f             = p - t;
+            float g             = tap->gain;
+
+            switch (tap->interp)
+            {
+                case dsp::DELAY_HERMITE:
+                {
+                    float f2            = f * f;
+                    float f3            = f2 * f;
+                    v[0]                = (-0.5f*f3 + f2 - 0.5f*f) * g;
+                    v[1]                = (1.5f*f3 - 2.5f*f2 + 1.0f) * g;
+                    v[2]                = (-1.5f*f3 + 2.0f*f2 + 0.5f*f) * g;
+                    v[3]                = (0.5f*f3 - 0.5f*f2) * g;
+                    break;
+                }
+                case dsp::DELAY_LAGRANGE:
+                {
+                    float fp            = f + 1.0f;
+                    float fm            = f - 1.0f;
+                    float fm2           = f - 2.0f;
+                    v[0]                = (-f * fm * fm2 * (1.0f/6.0f)) * g;
+                    v[1]                = (fp * fm * fm2 * 0.5f) * g;
+                    v[2]                = (-fp * f * fm2 * 0.5f) * g;
+                    v[3]                = (fp * f * fm * (1.0f/6.0f)) * g;
+                    break;
+                }
+                default:
+                    v[0]                = 0.0f;
+                    v[1]                = (1.0f - f) * g;
+                    v[2]                = f * g;
+                    v[3]                = 0.0f;
+                    break;
+            }
+
+            for (size_t i=0; i<8; ++i)
+            {
+                w[i]                = v[0];
+                w[i + 8]            = v[1];
+                w[i + 16]           = v[2];
+                w[i + 24]           = v[3];
+            }
+
+            return int32_t(t) - 1;
+        }
+
+        /* V is the register prefix: "y" for 8x blocks, "x" for 1x blocks */
+        #define DELAY_TAP_SUM(V, MV, MUL) \
+            __ASM_EMIT("mov             (%[J], %[k], 4), %k[idx]")              /* idx = J[k] */ \
+            __ASM_EMIT("add             %k[i], %k[idx]")                        /* idx = J[k] + i */ \
+            __ASM_EMIT("and             %[mask], %k[idx]")                      /* idx = (J[k] + i) & M */ \
+            __ASM_EMIT(MV "         0x00(%[buf], %[idx], 4), %%" V "mm1")      /* V1 = x[k-1] */ \
+            __ASM_EMIT(MV "         0x04(%[buf], %[idx], 4), %%" V "mm2")      /* V2 = x[k] */ \
+            __ASM_EMIT(MV "         0x08(%[buf], %[idx], 4), %%" V "mm3")      /* V3 = x[k+1] */ \
+            __ASM_EMIT(MV "         0x0c(%[buf], %[idx], 4), %%" V "mm4")      /* V4 = x[k+2] */ \
+            __ASM_EMIT(MUL "          0x00(%[w]), %%" V "mm1, %%" V "mm1")    /* V1 = w0*x[k-1] */ \
+            __ASM_EMIT(MUL "          0x20(%[w]), %%" V "mm2, %%" V "mm2")    /* V2 = w1*x[k] */ \
+            __ASM_EMIT(MUL "          0x40(%[w]), %%" V "mm3, %%" V "mm3")    /* V3 = w2*x[k+1] */ \
+            __ASM_EMIT(MUL "          0x60(%[w]), %%" V "mm4, %%" V "mm4")    /* V4 = w3*x[k+2] */ \
+            __ASM_EMIT("vaddps          %%" V "mm2, %%" V "mm1, %%" V "mm1") \
+            __ASM_EMIT("vaddps          %%" V "mm3, %%" V "mm1, %%" V "mm1") \
+            __ASM_EMIT("vaddps          %%" V "mm4, %%" V "mm1, %%" V "mm1") \
+            __ASM_EMIT("vaddps          %%" V "mm1, %%" V "mm0, %%" V "mm0")   /* V0 = S + sum(w*x) */ \
+            __ASM_EMIT("add             $0x80, %[w]") \
+            __ASM_EMIT("inc             %[k]") \
+            __ASM_EMIT("cmp             %[nt], %[k]")
+
+        #define DELAY_TAPS_ZERO(V, MV) \
+            __ASM_EMIT("vxorps          %%" V "mm0, %%" V "mm0, %%" V "mm0")
+
+        #define DELAY_TAPS_LOAD(V, MV) \
+            __ASM_EMIT(MV "         0x00(%[dst]), %%" V "mm0")
+
+        #define DELAY_TAPS_KERNEL(INIT) \
+            ARCH_X86_64_ASM( \
+                __ASM_EMIT("xor             %[i], %[i]") \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jb              3f") \
+                /* 8x blocks */ \
+                __ASM_EMIT("1:") \
+                INIT("y", "vmovups") \
+                __ASM_EMIT("xor             %[k], %[k]") \
+                __ASM_EMIT("mov             %[W], %[w]") \
+                __ASM_EMIT("2:") \
+                DELAY_TAP_SUM("y", "vmovups", "vmulps") \
+                __ASM_EMIT("jb              2b") \
+                __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])") \
+                __ASM_EMIT("add             $0x20, %[dst]") \
+                __ASM_EMIT("add             $8, %[i]") \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jae             1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("3:") \
+                __ASM_EMIT("add             $7, %[count]") \
+                __ASM_EMIT("jl              6f") \
+                __ASM_EMIT("4:") \
+                INIT("x", "vmovss ") \
+                __ASM_EMIT("xor             %[k], %[k]") \
+                __ASM_EMIT("mov             %[W], %[w]") \
+                __ASM_EMIT("5:") \
+                DELAY_TAP_SUM("x", "vmovss ", "vmulss") \
+                __ASM_EMIT("jb              5b") \
+                __ASM_EMIT("vmovss          %%xmm0, 0x00(%[dst])") \
+                __ASM_EMIT("add             $0x04, %[dst]") \
+                __ASM_EMIT("inc             %[i]") \
+                __ASM_EMIT("dec             %[count]") \
+                __ASM_EMIT("jge             4b") \
+                __ASM_EMIT("6:") \
+                : [dst] "+r" (vd), [count] "+r" (n), \
+                  [i] "=&r" (i), [k] "=&r" (k), [w] "=&r" (pw), [idx] "=&r" (idx) \
+                : [buf] "r" (buf), [W] "r" (&w[0]), [J] "r" (&j[0]), \
+                  [mask] "m" (mask), [nt] "m" (nt) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4" \
+            )
+
+        void x64_delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count)
+        {
+            float w[DELAY_TAPS_BLOCK*32] __lsp_aligned32;
+            uint32_t j[DELAY_TAPS_BLOCK];
+            const uint32_t mask     = d->mask;
+            const uint32_t start    = d->head - count;
+
+            if (ntaps == 0)
+            {
+                dsp::fill_zero(dst, count);
+                return;
+            }
+
+            for (size_t off=0; off < ntaps; off += DELAY_TAPS_BLOCK)
+            {
+                // Prepare the block of taps
+                size_t nt               = ntaps - off;
+                if (nt > DELAY_TAPS_BLOCK)
+                    nt                      = DELAY_TAPS_BLOCK;
+                for (size_t k=0; k<nt; ++k)
+                    j[k]                    = start + delay_tap_weights(&w[k*32], &taps[off + k]);
+
+                // Process all samples with the block of taps
+                float *vd               = dst;
+                size_t n                = count;
+                IF_ARCH_X86_64(size_t i, k, idx; float *pw);
+                if (off == 0)
+                    DELAY_TAPS_KERNEL(DELAY_TAPS_ZERO);
+                else
+                    DELAY_TAPS_KERNEL(DELAY_TAPS_LOAD);
+            }
+        }
+
+        #undef DELAY_TAPS_KERNEL
+        #undef DELAY_TAPS_LOAD
+        #undef DELAY_TAPS_ZERO
+        #undef DELAY_TAP_SUM
+
+    } /* namespace avx2 */
+} /* namespace lsp */
+
+#undef DELAY_TAPS_BLOCK
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_INTERPOLATION_DELAY_H_ */
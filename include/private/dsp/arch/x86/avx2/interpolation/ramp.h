@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_INTERPOLATION_RAMP_H_
+#define PRIVATE_DSP_ARCH_X86_AVX2_INTERPOLATION_RAMP_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_IMPL */
+
+#include <private/dsp/arch/x86/avx2/pmath/exp.h>
+
+namespace lsp
+{
+    namespace avx2
+    {
+        /**
+         * Prepare parameters for the next portion of the ramp and advance the ramp
+         * @param p parameters to initialize, 8 vectors
+         * @param shape pointer to store effective shape of the ramp
+         * @param r ramp descriptor
+         * @param count number of samples requested
+         * @return number of samples that belong to the ramp, the rest should be processed with the stop value
+         */
+        static size_t ramp_init(float *p, size_t *shape, dsp::ramp_t *r, size_t count)
+        {
+            *shape          = r->shape;
+            if (r->offset >= r->length)
+                return 0;
+            size_t n        = r->length - r->offset;
+            if (n > count)
+                n               = count;
+
+            float b         = 0.0f;
+            if ((r->shape == dsp::RAMP_EXP) || (r->shape == dsp::RAMP_LOG))
+            {
+                if (r->start * r->stop > 0.0f)
+                    b               = logf(r->stop / r->start) * M_LOG2E;
+                else
+                    *shape          = (r->shape == dsp::RAMP_EXP) ? dsp::RAMP_LINEAR : dsp::RAMP_CUBIC;
+            }
+            if ((*shape != dsp::RAMP_EXP) && (*shape != dsp::RAMP_LOG))
+                b               = r->stop - r->start;
+
+            float k         = 1.0f / r->length;
+            for (size_t i=0; i<8; ++i)
+            {
+                p[i]            = r->offset + i;    // P = positions
+                p[i + 8]        = k;                // K = 1/length
+                p[i + 16]       = r->start;         // A = start
+                p[i + 24]       = b;                // B = stop - start or log2(stop/start)
+                p[i + 32]       = 8.0f;             // Step for 8x block
+                p[i + 40]       = 1.0f;             // Step for 1x block
+                p[i + 48]       = 3.0f;
+                p[i + 56]       = 2.0f;
+            }
+
+            r->offset      += n;
+            return n;
+        }
+
+        /* V is the register prefix: "y" for 8x blocks, "x" for 1x blocks */
+        #define RAMP_X(V, POW2) \
+            /* V4 = P */ \
+            __ASM_EMIT("vmulps          0x20(%[P]), %%" V "mm4, %%" V "mm0")         /* V0 = x = P * K */
+
+        #define RAMP_SMOOTH(V, POW2) \
+            __ASM_EMIT("vmulps          0xe0(%[P]), %%" V "mm0, %%" V "mm1")         /* V1 = 2*x */ \
+            __ASM_EMIT("vmovaps         0xc0(%[P]), %%" V "mm2")                     /* V2 = 3 */ \
+            __ASM_EMIT("vsubps          %%" V "mm1, %%" V "mm2, %%" V "mm2")         /* V2 = 3 - 2*x */ \
+            __ASM_EMIT("vmulps          %%" V "mm0, %%" V "mm2, %%" V "mm2")         /* V2 = x*(3 - 2*x) */ \
+            __ASM_EMIT("vmulps          %%" V "mm2, %%" V "mm0, %%" V "mm0")         /* V0 = x^2*(3 - 2*x) */
+
+        #define RAMP_AFFINE(V, POW2) \
+            __ASM_EMIT("vmulps          0x60(%[P]), %%" V "mm0, %%" V "mm0")         /* V0 = B*x */ \
+            __ASM_EMIT("vaddps          0x40(%[P]), %%" V "mm0, %%" V "mm0")         /* V0 = A + B*x */
+
+        #define RAMP_POWER(V, POW2) \
+            __ASM_EMIT("vmulps          0x60(%[P]), %%" V "mm0, %%" V "mm0")         /* V0 = B*x */ \
+            POW2                                                                    /* V0 = 2^(B*x) */ \
+            __ASM_EMIT("vmulps          0x40(%[P]), %%" V "mm0, %%" V "mm0")         /* V0 = A * 2^(B*x) */
+
+        #define RAMP_LINEAR_CORE(V, POW2)   RAMP_X(V, POW2) RAMP_AFFINE(V, POW2)
+        #define RAMP_CUBIC_CORE(V, POW2)    RAMP_X(V, POW2) RAMP_SMOOTH(V, POW2) RAMP_AFFINE(V, POW2)
+        #define RAMP_EXP_CORE(V, POW2)      RAMP_X(V, POW2) RAMP_POWER(V, POW2)
+        #define RAMP_LOG_CORE(V, POW2)      RAMP_X(V, POW2) RAMP_SMOOTH(V, POW2) RAMP_POWER(V, POW2)
+
+        #define RAMP_SET_OP(V, MV) \
+            __ASM_EMIT(MV "         %%" V "mm0, 0x00(%[dst])")
+
+        #define RAMP_MUL_OP(V, MV) \
+            __ASM_EMIT(MV "         0x00(%[src]), %%" V "mm1") \
+            __ASM_EMIT("vmulps          %%" V "mm1, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT(MV "         %%" V "mm0, 0x00(%[dst])")
+
+        #define RAMP_FMADD_OP(V, MV) \
+            __ASM_EMIT(MV "         0x00(%[src]), %%" V "mm1") \
+            __ASM_EMIT(MV "         0x00(%[dst]), %%" V "mm2") \
+            __ASM_EMIT("vmulps          %%" V "mm1, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT("vaddps          %%" V "mm2, %%" V "mm0, %%" V "mm0") \
+            __ASM_EMIT(MV "         %%" V "mm0, 0x00(%[dst])")
+
+        #define RAMP_KERNEL(CORE, OP) \
+            ARCH_X86_64_ASM( \
+                __ASM_EMIT("vmovaps         0x00(%[P]), %%ymm4")        /* ymm4 = P */ \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jb              2f") \
+                /* 8x blocks */ \
+                __ASM_EMIT("1:") \
+                CORE("y", POW2_CORE_X8) \
+                OP("y", "vmovups") \
+                __ASM_EMIT("vaddps          0x80(%[P]), %%ymm4, %%ymm4")    /* ymm4 = P + 8 */ \
+                __ASM_EMIT("add             $0x20, %[src]") \
+                __ASM_EMIT("add             $0x20, %[dst]") \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jae             1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("add             $7, %[count]") \
+                __ASM_EMIT("jl              4f") \
+                __ASM_EMIT("3:") \
+                CORE("x", POW2_CORE_X4) \
+                OP("x", "vmovss ") \
+                __ASM_EMIT("vaddps          0xa0(%[P]), %%xmm4, %%xmm4")    /* xmm4 = P + 1 */ \
+                __ASM_EMIT("add             $0x04, %[src]") \
+                __ASM_EMIT("add             $0x04, %[dst]") \
+                __ASM_EMIT("dec             %[count]") \
+                __ASM_EMIT("jge             3b") \
+                __ASM_EMIT("4:") \
+                : [dst] "+r" (d), [src] "+r" (s), [count] "+r" (n) \
+                : [P] "r" (&p[0]), \
+                  [E2C] "o" (EXP2_CONST) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4" \
+            )
+
+        #define RAMP_APPLY(OP) \
+            switch (shape) \
+            { \
+                case dsp::RAMP_CUBIC:   RAMP_KERNEL(RAMP_CUBIC_CORE, OP); break; \
+                case dsp::RAMP_EXP:     RAMP_KERNEL(RAMP_EXP_CORE, OP); break; \
+                case dsp::RAMP_LOG:     RAMP_KERNEL(RAMP_LOG_CORE, OP); break; \
+                default:                RAMP_KERNEL(RAMP_LINEAR_CORE, OP); break; \
+            }
+
+        void x64_ramp_set(float *dst, dsp::ramp_t *r, size_t count)
+        {
+            float p[8*8] __lsp_aligned32;
+            size_t shape;
+            size_t n        = ramp_init(p, &shape, r, count);
+            float *d        = dst;
+            const float *s  = dst;
+            size_t done     = n;
+
+            if (n > 0)
+                RAMP_APPLY(RAMP_SET_OP);
+            if (done < count)
+                dsp::fill(&dst[done], r->stop, count - done);
+        }
+
+        void x64_ramp_mul2(float *dst, dsp::ramp_t *r, size_t count)
+        {
+            float p[8*8] __lsp_aligned32;
+            size_t shape;
+            size_t n        = ramp_init(p, &shape, r, count);
+            float *d        = dst;
+            const float *s  = dst;
+            size_t done     = n;
+
+            if (n > 0)
+                RAMP_APPLY(RAMP_MUL_OP);
+            if (done < count)
+                dsp::mul_k2(&dst[done], r->stop, count - done);
+        }
+
+        void x64_ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count)
+        {
+            float p[8*8] __lsp_aligned32;
+            size_t shape;
+            size_t n        = ramp_init(p, &shape, r, count);
+            float *d        = dst;
+            const float *s  = src;
+            size_t done     = n;
+
+            if (n > 0)
+                RAMP_APPLY(RAMP_MUL_OP);
+            if (done < count)
+                dsp::mul_k3(&dst[done], &src[done], r->stop, count - done);
+        }
+
+        void x64_ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count)
+        {
+            float p[8*8] __lsp_aligned32;
+            size_t shape;
+            size_t n        = ramp_init(p, &shape, r, count);
+            float *d        = dst;
+            const float *s  = src;
+            size_t done     = n;
+
+            if (n > 0)
+                RAMP_APPLY(RAMP_FMADD_OP);
+            if (done < count)
+                dsp::fmadd_k3(&dst[done], &src[done], r->stop, count - done);
+        }
+
+        #undef RAMP_APPLY
+        #undef RAMP_KERNEL
+        #undef RAMP_FMADD_OP
+        #undef RAMP_MUL_OP
+        #undef RAMP_SET_OP
+        #undef RAMP_LOG_CORE
+        #undef RAMP_EXP_CORE
+        #undef RAMP_CUBIC_CORE
+        #undef RAMP_LINEAR_CORE
+        #undef RAMP_POWER
+        #undef RAMP_AFFINE
+        #undef RAMP_SMOOTH
+        #undef RAMP_X
+
+        void x64_smooth_cubic_linear(float *dst, float start, float stop, size_t count)
+        {
+            dsp::ramp_t r;
+            r.start     = start;
+            r.stop      = stop;
+            r.shape     = dsp::RAMP_CUBIC;
+            r.length    = count + 1;
+            r.offset    = 0;
+
+            x64_ramp_set(dst, &r, count);
+        }
+
+        void x64_smooth_cubic_log(float *dst, float start, float stop, size_t count)
+        {
+            dsp::ramp_t r;
+            r.start     = start;
+            r.stop      = stop;
+            r.shape     = dsp::RAMP_LOG;
+            r.length    = count + 1;
+            r.offset    = 0;
+
+            x64_ramp_set(dst, &r, count);
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_INTERPOLATION_RAMP_H_ */
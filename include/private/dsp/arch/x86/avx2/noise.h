@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_NOISE_H_
+#define PRIVATE_DSP_ARCH_X86_AVX2_NOISE_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_IMPL */
+
+namespace lsp
+{
+    namespace avx2
+    {
+        /**
+         * Prepare parameters of the noise generator
+         * @param p parameters to initialize, 3 vectors
+         * @param K multiplier of the sum of values
+         * @param B bias of the result
+         */
+        static inline void noise_init_params(float *p, float K, float B)
+        {
+            for (size_t i=0; i<8; ++i)
+            {
+                p[i]            = 1.0f;                     // Exponent bits of the values in the range [1, 2)
+                p[i + 8]        = K;
+                p[i + 16]       = B;
+            }
+        }
+
+        /*
+         * All eight lanes of the state row fit one register, rows of the ring are
+         * ymm0-ymm3 in order of age. The step replaces the oldest row X with the new
+         * one, so the roles of registers rotate each step and return back after four steps.
+         */
+        #define NOISE_STEP(X, W) \
+            __ASM_EMIT("vpslld          $11, %%ymm" X ", %%ymm4") \
+            __ASM_EMIT("vpxor           %%ymm4, %%ymm" X ", %%ymm" X)           /* x = t = x ^ (x << 11) */ \
+            __ASM_EMIT("vpsrld          $8, %%ymm" X ", %%ymm4") \
+            __ASM_EMIT("vpxor           %%ymm4, %%ymm" X ", %%ymm" X)           /* x = t ^ (t >> 8) */ \
+            __ASM_EMIT("vpsrld          $19, %%ymm" W ", %%ymm4") \
+            __ASM_EMIT("vpxor           %%ymm" W ", %%ymm" X ", %%ymm" X) \
+            __ASM_EMIT("vpxor           %%ymm4, %%ymm" X ", %%ymm" X)           /* x = w ^ (w >> 19) ^ t ^ (t >> 8) */
+
+        #define NOISE_FIRST(X) \
+            __ASM_EMIT("vpsrld          $9, %%ymm" X ", %%ymm5") \
+            __ASM_EMIT("vpor            %%ymm6, %%ymm5, %%ymm5")                /* ymm5 = S = u */
+
+        #define NOISE_NEXT(X) \
+            __ASM_EMIT("vpsrld          $9, %%ymm" X ", %%ymm4") \
+            __ASM_EMIT("vpor            %%ymm6, %%ymm4, %%ymm4")                /* ymm4 = u */ \
+            __ASM_EMIT("vaddps          %%ymm4, %%ymm5, %%ymm5")                /* ymm5 = S + u */
+
+        #define NOISE_STORE \
+            __ASM_EMIT("vmulps          %%ymm7, %%ymm5, %%ymm5")                /* ymm5 = S*K */ \
+            __ASM_EMIT("vsubps          %%ymm8, %%ymm5, %%ymm5")                /* ymm5 = S*K - B */ \
+            __ASM_EMIT("vmovups         %%ymm5, 0x00(%[dst])") \
+            __ASM_EMIT("add             $0x20, %[dst]")
+
+        /* 1 step per block */
+        #define NOISE_UNIFORM \
+            __ASM_EMIT("sub             $4, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            __ASM_EMIT("1:") \
+            NOISE_STEP("0", "3") \
+            NOISE_FIRST("0") \
+            NOISE_STORE \
+            NOISE_STEP("1", "0") \
+            NOISE_FIRST("1") \
+            NOISE_STORE \
+            NOISE_STEP("2", "1") \
+            NOISE_FIRST("2") \
+            NOISE_STORE \
+            NOISE_STEP("3", "2") \
+            NOISE_FIRST("3") \
+            NOISE_STORE \
+            __ASM_EMIT("sub             $4, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add             $4, %[count]") \
+            __ASM_EMIT("jz              3f") \
+            NOISE_STEP("0", "3") \
+            NOISE_FIRST("0") \
+            NOISE_STORE \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jz              3f") \
+            NOISE_STEP("1", "0") \
+            NOISE_FIRST("1") \
+            NOISE_STORE \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jz              3f") \
+            NOISE_STEP("2", "1") \
+            NOISE_FIRST("2") \
+            NOISE_STORE \
+            __ASM_EMIT("3:")
+
+        /* 2 steps per block */
+        #define NOISE_TPDF \
+            __ASM_EMIT("sub             $2, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            __ASM_EMIT("1:") \
+            NOISE_STEP("0", "3") \
+            NOISE_FIRST("0") \
+            NOISE_STEP("1", "0") \
+            NOISE_NEXT("1") \
+            NOISE_STORE \
+            NOISE_STEP("2", "1") \
+            NOISE_FIRST("2") \
+            NOISE_STEP("3", "2") \
+            NOISE_NEXT("3") \
+            NOISE_STORE \
+            __ASM_EMIT("sub             $2, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add             $2, %[count]") \
+            __ASM_EMIT("jz              3f") \
+            NOISE_STEP("0", "3") \
+            NOISE_FIRST("0") \
+            NOISE_STEP("1", "0") \
+            NOISE_NEXT("1") \
+            NOISE_STORE \
+            __ASM_EMIT("3:")
+
+        /* 4 steps per block */
+        #define NOISE_GAUSSIAN \
+            __ASM_EMIT("test            %[count], %[count]") \
+            __ASM_EMIT("jz              2f") \
+            __ASM_EMIT("1:") \
+            NOISE_STEP("0", "3") \
+            NOISE_FIRST("0") \
+            NOISE_STEP("1", "0") \
+            NOISE_NEXT("1") \
+            NOISE_STEP("2", "1") \
+            NOISE_NEXT("2") \
+            NOISE_STEP("3", "2") \
+            NOISE_NEXT("3") \
+            NOISE_STORE \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jnz             1b") \
+            __ASM_EMIT("2:")
+
+        /*
+         * Generate BLOCKS blocks of 8 samples: load the ring in order of age starting
+         * from the oldest row, run the generator and store the rows back in place
+         */
+        #define NOISE_KERNEL(BODY, DST, BLOCKS) \
+        { \
+            IF_ARCH_X86_64(float *vd = DST; size_t nb = BLOCKS); \
+            ARCH_X86_64_ASM( \
+                __ASM_EMIT("vmovdqu         0x00(%[s0]), %%ymm0") \
+                __ASM_EMIT("vmovdqu         0x00(%[s1]), %%ymm1") \
+                __ASM_EMIT("vmovdqu         0x00(%[s2]), %%ymm2") \
+                __ASM_EMIT("vmovdqu         0x00(%[s3]), %%ymm3") \
+                __ASM_EMIT("vmovaps         0x00(%[P]), %%ymm6")                    /* ymm6 = 1 */ \
+                __ASM_EMIT("vmovaps         0x20(%[P]), %%ymm7")                    /* ymm7 = K */ \
+                __ASM_EMIT("vmovaps         0x40(%[P]), %%ymm8")                    /* ymm8 = B */ \
+                BODY \
+                __ASM_EMIT("vmovdqu         %%ymm0, 0x00(%[s0])") \
+                __ASM_EMIT("vmovdqu         %%ymm1, 0x00(%[s1])") \
+                __ASM_EMIT("vmovdqu         %%ymm2, 0x00(%[s2])") \
+                __ASM_EMIT("vmovdqu         %%ymm3, 0x00(%[s3])") \
+                : [dst] "+r" (vd), [count] "+r" (nb) \
+                : [s0] "r" (n->s[n->index]), [s1] "r" (n->s[(n->index + 1) & 3]), \
+                  [s2] "r" (n->s[(n->index + 2) & 3]), [s3] "r" (n->s[(n->index + 3) & 3]), \
+                  [P] "r" (&p[0]) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7", \
+                  "%xmm8" \
+            ); \
+        }
+
+        #define NOISE_GENERATE(BODY, STEPS, K, B) \
+            float p[24] __lsp_aligned32; \
+            float xd[8] __lsp_aligned32; \
+            size_t blocks = count >> 3; \
+            noise_init_params(p, K, B); \
+            if (blocks > 0) \
+            { \
+                NOISE_KERNEL(BODY, dst, blocks); \
+                n->index        = (n->index + blocks * STEPS) & 3; \
+                dst            += blocks << 3; \
+            } \
+            if (count & 7) \
+            { \
+                NOISE_KERNEL(BODY, xd, 1); \
+                n->index        = (n->index + STEPS) & 3; \
+                for (size_t i=0; i < (count & 7); ++i) \
+                    dst[i]          = xd[i]; \
+            }
+
+        void x64_noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count)
+        {
+            NOISE_GENERATE(NOISE_UNIFORM, 1, 2.0f * k, 3.0f * k);
+        }
+
+        void x64_noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count)
+        {
+            NOISE_GENERATE(NOISE_TPDF, 2, k, 3.0f * k);
+        }
+
+        void x64_noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count)
+        {
+            const float K   = 1.7320508f * s; // sqrt(3) * s
+            NOISE_GENERATE(NOISE_GAUSSIAN, 4, K, 6.0f * K);
+        }
+
+        #undef NOISE_GENERATE
+        #undef NOISE_KERNEL
+        #undef NOISE_GAUSSIAN
+        #undef NOISE_TPDF
+        #undef NOISE_UNIFORM
+        #undef NOISE_STORE
+        #undef NOISE_NEXT
+        #undef NOISE_FIRST
+        #undef NOISE_STEP
+
+    } /* namespace avx2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_NOISE_H_ */
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_SHAPER_H_
+#define PRIVATE_DSP_ARCH_X86_AVX2_SHAPER_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_IMPL */
+
+namespace lsp
+{
+    namespace avx2
+    {
+        /**
+         * Prepare parameters of the waveshaper
+         * @param p parameters to initialize, 6 vectors
+         * @param s waveshaper descriptor
+         */
+        static void shaper_init_params(float *p, const dsp::shaper_t *s)
+        {
+            for (size_t i=0; i<8; ++i)
+            {
+                p[i]            = s->scale;
+                p[i + 8]        = s->offset;
+                p[i + 16]       = s->last;
+                p[i + 24]       = 0.5f;
+                p[i + 32]       = 0.5f;                     // K1 of the Hermite spline
+                p[i + 40]       = 1.5f;                     // K2 of the Hermite spline
+            }
+        }
+
+        /*
+         * Compute table positions of 8 samples, clamp them, split into integer and
+         * fractional parts and gather points c[k] and c[k+1] of each sample into ymm3 and ymm2
+         */
+        #define SHAPER_POINTS \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                /* ymm0 = 0 */ \
+            __ASM_EMIT("vmulps          0x00(%[src]), %%ymm7, %%ymm1")          /* ymm1 = x*scale */ \
+            __ASM_EMIT("vaddps          0x20(%[P]), %%ymm1, %%ymm1")            /* ymm1 = u = x*scale + offset */ \
+            __ASM_EMIT("vmaxps          %%ymm0, %%ymm1, %%ymm1")                /* ymm1 = (u > 0) ? u : 0 */ \
+            __ASM_EMIT("vminps          0x40(%[P]), %%ymm1, %%ymm1")            /* ymm1 = U = (u < last) ? u : last */ \
+            __ASM_EMIT("vcvttps2dq      %%ymm1, %%ymm4")                        /* ymm4 = K = int(U) */ \
+            __ASM_EMIT("vcvtdq2ps       %%ymm4, %%ymm3")                        /* ymm3 = float(K) */ \
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm1")                /* ymm1 = F = U - K */ \
+            __ASM_EMIT("vpcmpeqd        %%ymm6, %%ymm6, %%ymm6") \
+            __ASM_EMIT("vgatherdps      %%ymm6, 0x04(%[buf], %%ymm4, 4), %%ymm3")   /* ymm3 = c[k] */ \
+            __ASM_EMIT("vpcmpeqd        %%ymm6, %%ymm6, %%ymm6") \
+            __ASM_EMIT("vgatherdps      %%ymm6, 0x08(%[buf], %%ymm4, 4), %%ymm2")   /* ymm2 = c[k+1] */
+
+        /* ymm4 = K, ymm3 = c[k], ymm2 = c[k+1], ymm1 = F, result in ymm5 */
+        #define SHAPER_LINEAR_CORE \
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm2, %%ymm5")                /* ymm5 = c[k+1] - c[k] */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm5, %%ymm5")                /* ymm5 = (c[k+1] - c[k])*F */ \
+            __ASM_EMIT("vaddps          %%ymm3, %%ymm5, %%ymm5")                /* ymm5 = c[k] + (c[k+1] - c[k])*F */
+
+        #define SHAPER_CUBIC_CORE \
+            __ASM_EMIT("vpcmpeqd        %%ymm6, %%ymm6, %%ymm6") \
+            __ASM_EMIT("vgatherdps      %%ymm6, 0x00(%[buf], %%ymm4, 4), %%ymm0")   /* ymm0 = c[k-1] */ \
+            __ASM_EMIT("vpcmpeqd        %%ymm6, %%ymm6, %%ymm6") \
+            __ASM_EMIT("vgatherdps      %%ymm6, 0x0c(%[buf], %%ymm4, 4), %%ymm5")   /* ymm5 = c[k+2] */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm2, %%ymm4")                /* ymm4 = c[k+1] - c[k-1] */ \
+            __ASM_EMIT("vaddps          %%ymm0, %%ymm2, %%ymm6")                /* ymm6 = c[k-1] + c[k+1] */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm5, %%ymm5")                /* ymm5 = c[k+2] - c[k-1] */ \
+            __ASM_EMIT("vsubps          %%ymm2, %%ymm3, %%ymm0")                /* ymm0 = c[k] - c[k+1] */ \
+            __ASM_EMIT("vmulps          0x60(%[P]), %%ymm4, %%ymm4")            /* ymm4 = h = 0.5*(c[k+1] - c[k-1]) */ \
+            __ASM_EMIT("vmulps          0x60(%[P]), %%ymm6, %%ymm6")            /* ymm6 = 0.5*(c[k-1] + c[k+1]) */ \
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm6, %%ymm6")                /* ymm6 = q = 0.5*(c[k-1] + c[k+1]) - c[k] */ \
+            __ASM_EMIT("vmulps          0x80(%[P]), %%ymm5, %%ymm5")            /* ymm5 = K1*(c[k+2] - c[k-1]) */ \
+            __ASM_EMIT("vmulps          0xa0(%[P]), %%ymm0, %%ymm0")            /* ymm0 = K2*(c[k] - c[k+1]) */ \
+            __ASM_EMIT("vaddps          %%ymm0, %%ymm5, %%ymm5")                /* ymm5 = c3 */ \
+            __ASM_EMIT("vsubps          %%ymm5, %%ymm6, %%ymm6")                /* ymm6 = c2 = q - c3 */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm5, %%ymm5")                /* ymm5 = c3*F */ \
+            __ASM_EMIT("vaddps          %%ymm6, %%ymm5, %%ymm5")                /* ymm5 = c3*F + c2 */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm5, %%ymm5")                /* ymm5 = (c3*F + c2)*F */ \
+            __ASM_EMIT("vaddps          %%ymm4, %%ymm5, %%ymm5")                /* ymm5 = (c3*F + c2)*F + h */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm5, %%ymm5")                /* ymm5 = ((c3*F + c2)*F + h)*F */ \
+            __ASM_EMIT("vaddps          %%ymm3, %%ymm5, %%ymm5")                /* ymm5 = ((c3*F + c2)*F + h)*F + c[k] */
+
+        #define SHAPER_KERNEL(CORE) \
+            ARCH_X86_64_ASM( \
+                __ASM_EMIT("vmovaps         0x00(%[P]), %%ymm7")                    /* ymm7 = scale */ \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jb              2f") \
+                __ASM_EMIT("1:") \
+                SHAPER_POINTS \
+                CORE \
+                __ASM_EMIT("vmovups         %%ymm5, 0x00(%[dst])") \
+                __ASM_EMIT("add             $0x20, %[src]") \
+                __ASM_EMIT("add             $0x20, %[dst]") \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jae             1b") \
+                __ASM_EMIT("2:") \
+                : [dst] "+r" (vd), [src] "+r" (vs), [count] "+r" (n) \
+                : [P] "r" (&p[0]), [buf] "r" (buf) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            )
+
+        /*
+         * The last incomplete block is processed as the full block padded by zeros,
+         * so the kernel does not need scalar code
+         */
+        #define SHAPER_APPLY(CORE) \
+            float *vd           = dst; \
+            const float *vs     = src; \
+            size_t n            = count; \
+            SHAPER_KERNEL(CORE); \
+            \
+            size_t done         = count & ~size_t(7); \
+            if (done < count) \
+            { \
+                float xd[8] __lsp_aligned32; \
+                float xs[8] __lsp_aligned32; \
+                for (size_t i=0; i<8; ++i) \
+                    xs[i]               = (done + i < count) ? src[done + i] : 0.0f; \
+                vd                  = xd; \
+                vs                  = xs; \
+                n                   = 8; \
+                SHAPER_KERNEL(CORE); \
+                for (size_t i=done; i<count; ++i) \
+                    dst[i]              = xd[i - done]; \
+            }
+
+        void x64_shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count)
+        {
+            float p[6*8] __lsp_aligned32;
+            shaper_init_params(p, s);
+            SHAPER_APPLY(SHAPER_LINEAR_CORE);
+        }
+
+        void x64_shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count)
+        {
+            float p[6*8] __lsp_aligned32;
+            shaper_init_params(p, s);
+            SHAPER_APPLY(SHAPER_CUBIC_CORE);
+        }
+
+        #undef SHAPER_APPLY
+        #undef SHAPER_KERNEL
+        #undef SHAPER_CUBIC_CORE
+        #undef SHAPER_LINEAR_CORE
+        #undef SHAPER_POINTS
+
+    } /* namespace avx2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_SHAPER_H_ */
@@ -339,6 +339,7 @@ namespace lsp
 
             static const float ONE[] __lsp_aligned16            = { LSP_DSP_VEC4(1.0f) };
             static const float X_MINUS_ONE[] __lsp_aligned16    = { LSP_DSP_VEC4(-1.0f) };
+            static const float X_THIRD[] __lsp_aligned16        = { LSP_DSP_VEC4(1.0f / 3.0f) };
             static const uint32_t IONE[] __lsp_aligned16        = { LSP_DSP_VEC4(1) };
             static const uint32_t X_ISIGN[] __lsp_aligned16     = { LSP_DSP_VEC4(0x80000000) };
 
@@ -1008,6 +1009,182 @@ namespace lsp
         }
 
 
+        void init_triangle3d_p3(
+                triangle3d_t *t,
+                const point3d_t *p1,
+                const point3d_t *p2,
+                const point3d_t *p3
+            )
+        {
+            float x0, x1, x2, x3;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      (%[p1]), %[x0]")
+                __ASM_EMIT("movups      (%[p2]), %[x1]")
+                __ASM_EMIT("movups      (%[p3]), %[x2]")
+                __ASM_EMIT("xorps       %[x3], %[x3]")
+                __ASM_EMIT("movups      %[x0], 0x00(%[t])")
+                __ASM_EMIT("movups      %[x1], 0x10(%[t])")
+                __ASM_EMIT("movups      %[x2], 0x20(%[t])")
+                __ASM_EMIT("movups      %[x3], 0x30(%[t])")
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3)
+                : [t] "r" (t), [p1] "r" (p1), [p2] "r" (p2), [p3] "r" (p3)
+                : "memory"
+            );
+        }
+
+        void init_triangle3d_pv(
+                triangle3d_t *t,
+                const point3d_t *p
+            )
+        {
+            float x0, x1, x2, x3;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      0x00(%[p]), %[x0]")
+                __ASM_EMIT("movups      0x10(%[p]), %[x1]")
+                __ASM_EMIT("movups      0x20(%[p]), %[x2]")
+                __ASM_EMIT("xorps       %[x3], %[x3]")
+                __ASM_EMIT("movups      %[x0], 0x00(%[t])")
+                __ASM_EMIT("movups      %[x1], 0x10(%[t])")
+                __ASM_EMIT("movups      %[x2], 0x20(%[t])")
+                __ASM_EMIT("movups      %[x3], 0x30(%[t])")
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3)
+                : [t] "r" (t), [p] "r" (p)
+                : "memory"
+            );
+        }
+
+        void init_triangle3d(triangle3d_t *dst, const triangle3d_t *src)
+        {
+            float x0, x1, x2, x3;
+
+            ARCH_X86_ASM
+            (
+                MATRIX_LOAD("src", "[x0]", "[x1]", "[x2]", "[x3]")
+                MATRIX_STORE("dst", "[x0]", "[x1]", "[x2]", "[x3]")
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3)
+                : [dst] "r" (dst), [src] "r" (src)
+                : "memory"
+            );
+        }
+
+        /*
+         * Input:
+         *   x0 = p0, x1 = p1, x2 = p2
+         *
+         * Output:
+         *   points with lengths of edges stored in w components and the normal are stored to t
+         */
+        #define TRIANGLE3D_PARAMS \
+            __ASM_EMIT("movups      %[x0], 0x00(%[t])") \
+            __ASM_EMIT("movups      %[x1], 0x10(%[t])") \
+            __ASM_EMIT("movups      %[x2], 0x20(%[t])") \
+            __ASM_EMIT("movaps      %[x1], %[x3]") \
+            __ASM_EMIT("movaps      %[x2], %[x4]") \
+            __ASM_EMIT("movaps      %[x2], %[x5]") \
+            __ASM_EMIT("subps       %[x0], %[x3]")          /* xmm3 = d0 = p1 - p0 */ \
+            __ASM_EMIT("subps       %[x1], %[x4]")          /* xmm4 = d1 = p2 - p1 */ \
+            __ASM_EMIT("subps       %[x0], %[x5]")          /* xmm5 = d2 = p2 - p0 */ \
+            __ASM_EMIT("movaps      %[x3], %[x1]") \
+            __ASM_EMIT("movaps      %[x5], %[x2]") \
+            VECTOR_MUL("[x1]", "[x2]", "[x6]", "[x7]")      /* xmm1 = NZ NX NY ? */ \
+            __ASM_EMIT("shufps      $0x09, %[x1], %[x1]")   /* xmm1 = NX NY NZ NZ */ \
+            __ASM_EMIT("mulps       %[x3], %[x3]") \
+            __ASM_EMIT("mulps       %[x4], %[x4]") \
+            __ASM_EMIT("movaps      %[x1], %[x2]") \
+            __ASM_EMIT("mulps       %[x5], %[x5]") \
+            __ASM_EMIT("mulps       %[x2], %[x2]") \
+            MAT4_TRANSPOSE("[x3]", "[x4]", "[x5]", "[x2]", "[x6]") \
+            __ASM_EMIT("addps       %[x4], %[x3]") \
+            __ASM_EMIT("addps       %[x5], %[x3]")          /* xmm3 = l0*l0 l1*l1 l2*l2 l3*l3 */ \
+            __ASM_EMIT("sqrtps      %[x3], %[x3]")          /* xmm3 = l0 l1 l2 l3 */ \
+            __ASM_EMIT("movaps      %[x3], %[x4]") \
+            __ASM_EMIT("shufps      $0xff, %[x4], %[x4]")   /* xmm4 = l3 l3 l3 l3 */ \
+            __ASM_EMIT("divps       %[x4], %[x1]")          /* xmm1 = nx ny nz nz */ \
+            __ASM_EMIT("movaps      %[x1], %[x2]")          /* xmm2 = nx ny nz nz */ \
+            __ASM_EMIT("xorps       %[X_ISIGN], %[x1]")     /* xmm1 = -nx -ny -nz -nz */ \
+            VECTOR_DPPS3("[x1]", "[x0]", "[x4]")            /* xmm1 = -(nx*x0 + ny*y0 + nz*z0) = dw ? */ \
+            __ASM_EMIT("shufps      $0xf0, %[x2], %[x1]")   /* xmm1 = dw dw nz nz */ \
+            __ASM_EMIT("shufps      $0x24, %[x1], %[x2]")   /* xmm2 = nx ny nz dw */ \
+            __ASM_EMIT("movups      %[x2], 0x30(%[t])") \
+            __ASM_EMIT("movss       %[x3], 0x0c(%[t])") \
+            __ASM_EMIT("shufps      $0x39, %[x3], %[x3]")   /* xmm3 = l1 l2 l3 l0 */ \
+            __ASM_EMIT("movss       %[x3], 0x1c(%[t])") \
+            __ASM_EMIT("shufps      $0x39, %[x3], %[x3]")   /* xmm3 = l2 l3 l0 l1 */ \
+            __ASM_EMIT("movss       %[x3], 0x2c(%[t])")
+
+        void calc_triangle3d_params(triangle3d_t *t)
+        {
+            float x0, x1, x2, x3, x4, x5, x6, x7;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      0x00(%[t]), %[x0]")
+                __ASM_EMIT("movups      0x10(%[t]), %[x1]")
+                __ASM_EMIT("movups      0x20(%[t]), %[x2]")
+                TRIANGLE3D_PARAMS
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3),
+                  [x4] "=&x" (x4), [x5] "=&x" (x5), [x6] "=&x" (x6), [x7] "=&x" (x7)
+                : [t] "r" (t),
+                  [X_ISIGN] "m" (X_ISIGN)
+                : "memory"
+            );
+        }
+
+        void calc_triangle3d_p3(
+                triangle3d_t *t,
+                const point3d_t *p1,
+                const point3d_t *p2,
+                const point3d_t *p3
+            )
+        {
+            float x0, x1, x2, x3, x4, x5, x6, x7;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      (%[p1]), %[x0]")
+                __ASM_EMIT("movups      (%[p2]), %[x1]")
+                __ASM_EMIT("movups      (%[p3]), %[x2]")
+                TRIANGLE3D_PARAMS
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3),
+                  [x4] "=&x" (x4), [x5] "=&x" (x5), [x6] "=&x" (x6), [x7] "=&x" (x7)
+                : [t] "r" (t), [p1] "r" (p1), [p2] "r" (p2), [p3] "r" (p3),
+                  [X_ISIGN] "m" (X_ISIGN)
+                : "memory"
+            );
+        }
+
+        void calc_triangle3d_pv(
+                triangle3d_t *t,
+                const point3d_t *p
+            )
+        {
+            float x0, x1, x2, x3, x4, x5, x6, x7;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      0x00(%[p]), %[x0]")
+                __ASM_EMIT("movups      0x10(%[p]), %[x1]")
+                __ASM_EMIT("movups      0x20(%[p]), %[x2]")
+                TRIANGLE3D_PARAMS
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3),
+                  [x4] "=&x" (x4), [x5] "=&x" (x5), [x6] "=&x" (x6), [x7] "=&x" (x7)
+                : [t] "r" (t), [p] "r" (p),
+                  [X_ISIGN] "m" (X_ISIGN)
+                : "memory"
+            );
+        }
+
+        void calc_triangle3d(triangle3d_t *dst, const triangle3d_t *src)
+        {
+            calc_triangle3d_pv(dst, src->p);
+        }
+
+        #undef TRIANGLE3D_PARAMS
+
         void init_matrix3d(matrix3d_t *dst, const matrix3d_t *src)
         {
             ARCH_X86_ASM
@@ -1517,6 +1694,293 @@ namespace lsp
             );
         }
 
+        #define MATRIX3D_HOMOGENIZE \
+            /* xmm0 = rx ry rz rw */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1") \
+            __ASM_EMIT("xorps       %%xmm2, %%xmm2")        /* xmm2 = 0 0 0 0 */ \
+            __ASM_EMIT("shufps      $0xff, %%xmm1, %%xmm1") /* xmm1 = rw rw rw rw */ \
+            __ASM_EMIT("cmpeqps     %%xmm1, %%xmm2")        /* xmm2 = [rw == 0] */ \
+            __ASM_EMIT("andps       %[ONE], %%xmm2")        /* xmm2 = [rw == 0] & 1 */ \
+            __ASM_EMIT("addps       %%xmm2, %%xmm1")        /* xmm1 = d = (rw == 0) ? 1 : rw */ \
+            __ASM_EMIT("divps       %%xmm1, %%xmm0")        /* xmm0 = rx/d ry/d rz/d rw/d */
+
+        void apply_matrix3d_mvn(vector3d_t *r, const vector3d_t *v, const matrix3d_t *m, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("test        %[n], %[n]")
+                __ASM_EMIT("jz          2f")
+                __ASM_EMIT("movups      0x00(%[m]), %%xmm4")    // xmm4 = m0  m1  m2  m3
+                __ASM_EMIT("movups      0x10(%[m]), %%xmm5")    // xmm5 = m4  m5  m6  m7
+                __ASM_EMIT("movups      0x20(%[m]), %%xmm6")    // xmm6 = m8  m9  m10 m11
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      (%[v]), %%xmm0")        // xmm0 = vx vy vz vw
+                __ASM_EMIT("movaps      %%xmm0, %%xmm1")        // xmm1 = vx vy vz vw
+                __ASM_EMIT("movaps      %%xmm0, %%xmm2")        // xmm2 = vx vy vz vw
+                __ASM_EMIT("shufps      $0x00, %%xmm0, %%xmm0") // xmm0 = vx vx vx vx
+                __ASM_EMIT("shufps      $0x55, %%xmm1, %%xmm1") // xmm1 = vy vy vy vy
+                __ASM_EMIT("shufps      $0xaa, %%xmm2, %%xmm2") // xmm2 = vz vz vz vz
+                __ASM_EMIT("mulps       %%xmm4, %%xmm0")
+                __ASM_EMIT("mulps       %%xmm5, %%xmm1")
+                __ASM_EMIT("mulps       %%xmm6, %%xmm2")
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")
+                __ASM_EMIT("addps       %%xmm2, %%xmm0")        // xmm0 = rx ry rz rw
+                MATRIX3D_HOMOGENIZE
+                __ASM_EMIT("movups      %%xmm0, (%[r])")
+                __ASM_EMIT("add         $0x10, %[v]")
+                __ASM_EMIT("add         $0x10, %[r]")
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jnz         1b")
+                __ASM_EMIT("2:")
+                : [r] "+r" (r), [v] "+r" (v), [n] "+r" (n)
+                : [m] "r" (m),
+                  [ONE] "m" (ONE)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2",
+                  "%xmm4", "%xmm5", "%xmm6"
+            );
+        }
+
+        void apply_matrix3d_mpn(point3d_t *r, const point3d_t *p, const matrix3d_t *m, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("test        %[n], %[n]")
+                __ASM_EMIT("jz          2f")
+                __ASM_EMIT("movups      0x00(%[m]), %%xmm4")    // xmm4 = m0  m1  m2  m3
+                __ASM_EMIT("movups      0x10(%[m]), %%xmm5")    // xmm5 = m4  m5  m6  m7
+                __ASM_EMIT("movups      0x20(%[m]), %%xmm6")    // xmm6 = m8  m9  m10 m11
+                __ASM_EMIT("movups      0x30(%[m]), %%xmm7")    // xmm7 = m12 m13 m14 m15
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      (%[p]), %%xmm0")        // xmm0 = px py pz pw
+                __ASM_EMIT("movaps      %%xmm0, %%xmm1")        // xmm1 = px py pz pw
+                __ASM_EMIT("movaps      %%xmm0, %%xmm2")        // xmm2 = px py pz pw
+                __ASM_EMIT("shufps      $0x00, %%xmm0, %%xmm0") // xmm0 = px px px px
+                __ASM_EMIT("shufps      $0x55, %%xmm1, %%xmm1") // xmm1 = py py py py
+                __ASM_EMIT("shufps      $0xaa, %%xmm2, %%xmm2") // xmm2 = pz pz pz pz
+                __ASM_EMIT("mulps       %%xmm4, %%xmm0")
+                __ASM_EMIT("mulps       %%xmm5, %%xmm1")
+                __ASM_EMIT("mulps       %%xmm6, %%xmm2")
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")
+                __ASM_EMIT("addps       %%xmm2, %%xmm0")
+                __ASM_EMIT("addps       %%xmm7, %%xmm0")        // xmm0 = rx ry rz rw
+                MATRIX3D_HOMOGENIZE
+                __ASM_EMIT("movups      %%xmm0, (%[r])")
+                __ASM_EMIT("add         $0x10, %[p]")
+                __ASM_EMIT("add         $0x10, %[r]")
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jnz         1b")
+                __ASM_EMIT("2:")
+                : [r] "+r" (r), [p] "+r" (p), [n] "+r" (n)
+                : [m] "r" (m),
+                  [ONE] "m" (ONE)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #define MATRIX3D_AOS_POINT \
+            __ASM_EMIT("movups      (%[p]), %%xmm0")        /* xmm0 = px py pz pw */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1")        /* xmm1 = px py pz pw */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm2")        /* xmm2 = px py pz pw */ \
+            __ASM_EMIT("shufps      $0x00, %%xmm0, %%xmm0") /* xmm0 = px px px px */ \
+            __ASM_EMIT("shufps      $0x55, %%xmm1, %%xmm1") /* xmm1 = py py py py */ \
+            __ASM_EMIT("shufps      $0xaa, %%xmm2, %%xmm2") /* xmm2 = pz pz pz pz */ \
+            __ASM_EMIT("mulps       0x00(%[M]), %%xmm0") \
+            __ASM_EMIT("mulps       0x10(%[M]), %%xmm1") \
+            __ASM_EMIT("mulps       0x20(%[M]), %%xmm2") \
+            __ASM_EMIT("addps       %%xmm1, %%xmm0") \
+            __ASM_EMIT("addps       %%xmm2, %%xmm0") \
+            __ASM_EMIT("addps       0x30(%[M]), %%xmm0")    /* xmm0 = rx ry rz rw */ \
+            MATRIX3D_HOMOGENIZE \
+            __ASM_EMIT("movups      %%xmm0, (%[r])") \
+            __ASM_EMIT("add         $0x10, %[p]") \
+            __ASM_EMIT("add         $0x10, %[r]")
+
+        void apply_matrix3d_mpn_bound_box(bound_box3d_t *b, point3d_t *r, const point3d_t *p, const matrix3d_t *m, size_t n)
+        {
+            if (n <= 0)
+            {
+                dsp::calc_bound_box(b, r, 0);
+                return;
+            }
+
+            // Matrix columns followed by min and max values
+            float M[4*6] __lsp_aligned16;
+            for (size_t i=0; i<16; ++i)
+                M[i]        = m->m[i];
+
+            point3d_t *dst  = r;
+            ARCH_X86_ASM
+            (
+                // Initialize bounds with the first point
+                MATRIX3D_AOS_POINT
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")        // xmm4 = min
+                __ASM_EMIT("movaps      %%xmm0, %%xmm5")        // xmm5 = max
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jz          2f")
+                __ASM_EMIT("1:")
+                MATRIX3D_AOS_POINT
+                __ASM_EMIT("minps       %%xmm0, %%xmm4")
+                __ASM_EMIT("maxps       %%xmm0, %%xmm5")
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jnz         1b")
+                __ASM_EMIT("2:")
+                __ASM_EMIT("movaps      %%xmm4, 0x40(%[M])")
+                __ASM_EMIT("movaps      %%xmm5, 0x50(%[M])")
+                : [r] "+r" (dst), [p] "+r" (p), [n] "+r" (n)
+                : [M] "r" (&M[0]),
+                  [ONE] "m" (ONE)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2",
+                  "%xmm4", "%xmm5"
+            );
+
+            // Build the box in the same order as calc_bound_box() does
+            const float *min = &M[16], *max = &M[20];
+            float w         = r[0].w;
+            init_point_xyz(&b->p[0], min[0], max[1], max[2]);
+            init_point_xyz(&b->p[1], min[0], min[1], max[2]);
+            init_point_xyz(&b->p[2], max[0], min[1], max[2]);
+            init_point_xyz(&b->p[3], max[0], max[1], max[2]);
+            init_point_xyz(&b->p[4], min[0], max[1], min[2]);
+            init_point_xyz(&b->p[5], min[0], min[1], min[2]);
+            init_point_xyz(&b->p[6], max[0], min[1], min[2]);
+            init_point_xyz(&b->p[7], max[0], max[1], min[2]);
+            for (size_t i=0; i<8; ++i)
+                b->p[i].w       = w;
+        }
+
+        #undef MATRIX3D_AOS_POINT
+
+        /* Calculate one component of the transformed SoA point
+         * xmm0 = x, xmm1 = y, xmm2 = z, xmm3 = d
+         * Output: xmm4 = (M[c0]*x + M[c1]*y + M[c2]*z [+ M[c3]]) / d
+         */
+        #define MATRIX3D_SOA_COMP(c0, c1, c2, TRANSLATE) \
+            __ASM_EMIT("movaps      " c0 "(%[M]), %%xmm4") \
+            __ASM_EMIT("movaps      " c1 "(%[M]), %%xmm5") \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm4") \
+            __ASM_EMIT("mulps       %%xmm1, %%xmm5") \
+            __ASM_EMIT("addps       %%xmm5, %%xmm4") \
+            __ASM_EMIT("movaps      " c2 "(%[M]), %%xmm5") \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm5") \
+            __ASM_EMIT("addps       %%xmm5, %%xmm4") \
+            TRANSLATE \
+            __ASM_EMIT("divps       %%xmm3, %%xmm4")
+
+        #define MATRIX3D_SOA_CORE(MV, T0, T1, T2, T3) \
+            __ASM_EMIT("mov         %[sx], %[t]") \
+            __ASM_EMIT(MV "      (%[t], %[off]), %%xmm0")       /* xmm0 = x */ \
+            __ASM_EMIT("mov         %[sy], %[t]") \
+            __ASM_EMIT(MV "      (%[t], %[off]), %%xmm1")       /* xmm1 = y */ \
+            __ASM_EMIT("mov         %[sz], %[t]") \
+            __ASM_EMIT(MV "      (%[t], %[off]), %%xmm2")       /* xmm2 = z */ \
+            /* Compute the divisor */ \
+            __ASM_EMIT("movaps      0x30(%[M]), %%xmm3") \
+            __ASM_EMIT("movaps      0x70(%[M]), %%xmm4") \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm3") \
+            __ASM_EMIT("mulps       %%xmm1, %%xmm4") \
+            __ASM_EMIT("addps       %%xmm4, %%xmm3") \
+            __ASM_EMIT("movaps      0xb0(%[M]), %%xmm4") \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm4") \
+            __ASM_EMIT("addps       %%xmm4, %%xmm3") \
+            T3                                                  /* xmm3 = rw */ \
+            __ASM_EMIT("xorps       %%xmm4, %%xmm4") \
+            __ASM_EMIT("cmpeqps     %%xmm3, %%xmm4")            /* xmm4 = [rw == 0] */ \
+            __ASM_EMIT("andps       0x100(%[M]), %%xmm4") \
+            __ASM_EMIT("addps       %%xmm4, %%xmm3")            /* xmm3 = d = (rw == 0) ? 1 : rw */ \
+            /* Compute components */ \
+            MATRIX3D_SOA_COMP("0x00", "0x40", "0x80", T0) \
+            __ASM_EMIT("mov         %[dx], %[t]") \
+            __ASM_EMIT(MV "      %%xmm4, (%[t], %[off])") \
+            MATRIX3D_SOA_COMP("0x10", "0x50", "0x90", T1) \
+            __ASM_EMIT("mov         %[dy], %[t]") \
+            __ASM_EMIT(MV "      %%xmm4, (%[t], %[off])") \
+            MATRIX3D_SOA_COMP("0x20", "0x60", "0xa0", T2) \
+            __ASM_EMIT("mov         %[dz], %[t]") \
+            __ASM_EMIT(MV "      %%xmm4, (%[t], %[off])")
+
+        #define MATRIX3D_SOA_KERNEL(T0, T1, T2, T3) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("xor         %[off], %[off]") \
+                __ASM_EMIT("sub         $4, %[n]") \
+                __ASM_EMIT("jb          2f") \
+                /* 4x blocks */ \
+                __ASM_EMIT("1:") \
+                MATRIX3D_SOA_CORE("movups", T0, T1, T2, T3) \
+                __ASM_EMIT("add         $0x10, %[off]") \
+                __ASM_EMIT("sub         $4, %[n]") \
+                __ASM_EMIT("jae         1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("add         $3, %[n]") \
+                __ASM_EMIT("jl          4f") \
+                __ASM_EMIT("3:") \
+                MATRIX3D_SOA_CORE("movss ", T0, T1, T2, T3) \
+                __ASM_EMIT("add         $0x04, %[off]") \
+                __ASM_EMIT("dec         %[n]") \
+                __ASM_EMIT("jge         3b") \
+                __ASM_EMIT("4:") \
+                : [n] "+r" (n), [off] "=&r" (off), [t] "=&r" (t) \
+                : [M] "r" (&M[0]), \
+                  [dx] "m" (dx), [dy] "m" (dy), [dz] "m" (dz), \
+                  [sx] "m" (sx), [sy] "m" (sy), [sz] "m" (sz) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5" \
+            )
+
+        /**
+         * Prepare the table of broadcasted matrix elements followed by vector of 1.0
+         * @param M table of 17 vectors to initialize
+         * @param m matrix
+         */
+        static inline void matrix3d_soa_init(float *M, const matrix3d_t *m)
+        {
+            for (size_t i=0; i<16; ++i, M += 4)
+                M[0] = M[1] = M[2] = M[3] = m->m[i];
+            M[0] = M[1] = M[2] = M[3] = 1.0f;
+        }
+
+        void apply_matrix3d_mv_soa(vector3d_soa_t *dst, const vector3d_soa_t *src, const matrix3d_t *m, size_t n)
+        {
+            float M[17*4] __lsp_aligned16;
+            IF_ARCH_X86(
+                size_t off, t;
+                float *dx = dst->dx, *dy = dst->dy, *dz = dst->dz;
+                const float *sx = src->dx, *sy = src->dy, *sz = src->dz;
+            );
+
+            matrix3d_soa_init(M, m);
+            MATRIX3D_SOA_KERNEL("", "", "", "");
+        }
+
+        void apply_matrix3d_mp_soa(point3d_soa_t *dst, const point3d_soa_t *src, const matrix3d_t *m, size_t n)
+        {
+            float M[17*4] __lsp_aligned16;
+            IF_ARCH_X86(
+                size_t off, t;
+                float *dx = dst->x, *dy = dst->y, *dz = dst->z;
+                const float *sx = src->x, *sy = src->y, *sz = src->z;
+            );
+
+            matrix3d_soa_init(M, m);
+            MATRIX3D_SOA_KERNEL(
+                __ASM_EMIT("addps       0xc0(%[M]), %%xmm4"),
+                __ASM_EMIT("addps       0xd0(%[M]), %%xmm4"),
+                __ASM_EMIT("addps       0xe0(%[M]), %%xmm4"),
+                __ASM_EMIT("addps       0xf0(%[M]), %%xmm3")
+            );
+        }
+
+        #undef MATRIX3D_SOA_KERNEL
+        #undef MATRIX3D_SOA_CORE
+        #undef MATRIX3D_SOA_COMP
+        #undef MATRIX3D_HOMOGENIZE
+
         void transpose_matrix3d1(matrix3d_t *r)
         {
             ARCH_X86_ASM
@@ -2135,6 +2599,46 @@ namespace lsp
             );
         }
 
+        void vector_mul_v2(vector3d_t *r, const vector3d_t *v1, const vector3d_t *v2)
+        {
+            float x0, x1, x2, x3;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      (%[v1]), %[x0]")        /* xmm0 = dx1 dy1 dz1 dw1 */
+                __ASM_EMIT("movups      (%[v2]), %[x1]")        /* xmm1 = dx2 dy2 dz2 dw2 */
+                VECTOR_MUL("[x0]", "[x1]", "[x2]", "[x3]")      /* xmm0 = NZ NX NY NW */
+                __ASM_EMIT("shufps      $0xc9, %[x0], %[x0]")   /* xmm0 = NX NY NZ NW */
+                __ASM_EMIT("andps       %[X_3DMASK], %[x0]")    /* xmm0 = NX NY NZ 0 */
+                __ASM_EMIT("movups      %[x0], (%[r])")
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3)
+                : [r] "r" (r), [v1] "r" (v1), [v2] "r" (v2),
+                  [X_3DMASK] "m" (X_3DMASK)
+                : "memory"
+            );
+        }
+
+        void vector_mul_vv(vector3d_t *r, const vector3d_t *vv)
+        {
+            float x0, x1, x2, x3;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      0x00(%[vv]), %[x0]")    /* xmm0 = dx1 dy1 dz1 dw1 */
+                __ASM_EMIT("movups      0x10(%[vv]), %[x1]")    /* xmm1 = dx2 dy2 dz2 dw2 */
+                VECTOR_MUL("[x0]", "[x1]", "[x2]", "[x3]")      /* xmm0 = NZ NX NY NW */
+                __ASM_EMIT("shufps      $0xc9, %[x0], %[x0]")   /* xmm0 = NX NY NZ NW */
+                __ASM_EMIT("andps       %[X_3DMASK], %[x0]")    /* xmm0 = NX NY NZ 0 */
+                __ASM_EMIT("movups      %[x0], (%[r])")
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3)
+                : [r] "r" (r), [vv] "r" (vv),
+                  [X_3DMASK] "m" (X_3DMASK)
+                : "memory"
+            );
+        }
+
         void move_point3d_p2(point3d_t *p, const point3d_t *p1, const point3d_t *p2, float k)
         {
             float x0, x1;
@@ -2340,6 +2844,112 @@ namespace lsp
             return x0;
         }
 
+        /*
+         * Input:
+         *   x0 = p1 - p0
+         *   x1 = p2 - p1
+         *   P0 = address of p0
+         *   M, CMP = register and instruction to compute the mask of plane flip
+         *
+         * Output:
+         *   x0 = reciprocal length of the original normal vector or 0
+         *   plane equation is stored to v
+         */
+        #define ORIENTED_PLANE_CORE(P0, M, CMP) \
+            VECTOR_MUL("[x0]", "[x1]", "[x2]", "[x3]")      /* xmm0 = NZ NX NY ? */ \
+            __ASM_EMIT("movaps      %[x0], %[x1]")          /* xmm1 = NZ NX NY ? */ \
+            VECTOR_DPPS3("[x0]", "[x0]", "[x2]")            /* xmm0 = NX*NX + NY*NY + NZ*NZ = W2 */ \
+            __ASM_EMIT("shufps      $0x09, %[x1], %[x1]")   /* xmm1 = NX NY NZ NZ */ \
+            __ASM_EMIT("sqrtss      %[x0], %[x0]")          /* xmm0 = sqrtf(W2) = W */ \
+            __ASM_EMIT("xorps       %[x3], %[x3]")          /* xmm3 = 0 */ \
+            __ASM_EMIT("shufps      $0x00, %[x0], %[x0]")   /* xmm0 = W W W W */ \
+            __ASM_EMIT("movaps      %[ONE], %[x2]")         /* xmm2 = 1 */ \
+            __ASM_EMIT("cmpps       $4, %[x0], %[x3]")      /* xmm3 = W != 0 */ \
+            __ASM_EMIT("divps       %[x0], %[x2]")          /* xmm2 = 1/W */ \
+            __ASM_EMIT("andps       %[x3], %[x2]")          /* xmm2 = k = (1/W) & [W != 0] */ \
+            __ASM_EMIT("mulps       %[x2], %[x1]")          /* xmm1 = NX*k NY*k NZ*k NZ*k = nx ny nz nz */ \
+            __ASM_EMIT("movaps      %[x2], %[x0]")          /* xmm0 = k */ \
+            __ASM_EMIT("movaps      %[x1], %[x2]")          /* xmm2 = nx ny nz nz */ \
+            __ASM_EMIT("movups      " P0 ", %[x3]")         /* xmm3 = x0 y0 z0 w0 */ \
+            __ASM_EMIT("xorps       %[X_ISIGN], %[x1]")     /* xmm1 = -nx -ny -nz -nz */ \
+            VECTOR_DPPS3("[x1]", "[x3]", "[x3]")            /* xmm1 = -(nx*x0 + ny*y0 + nz*z0) = dw ? */ \
+            __ASM_EMIT("shufps      $0xf0, %[x2], %[x1]")   /* xmm1 = dw dw nz nz */ \
+            __ASM_EMIT("shufps      $0x24, %[x1], %[x2]")   /* xmm2 = nx ny nz dw */ \
+            __ASM_EMIT("movups      (%[sp]), %[x3]")        /* xmm3 = sx sy sz sw */ \
+            __ASM_EMIT("movaps      %[x2], %[x1]")          /* xmm1 = nx ny nz dw */ \
+            VECTOR_DPPS3("[x3]", "[x1]", "[x1]")            /* xmm3 = sx*nx + sy*ny + sz*nz */ \
+            __ASM_EMIT("movaps      %[x2], %[x1]")          /* xmm1 = nx ny nz dw */ \
+            __ASM_EMIT("shufps      $0xff, %[x1], %[x1]")   /* xmm1 = dw dw dw dw */ \
+            __ASM_EMIT("addss       %[x1], %[x3]")          /* xmm3 = a = sx*nx + sy*ny + sz*nz + dw */ \
+            __ASM_EMIT("xorps       %[x1], %[x1]")          /* xmm1 = 0 */ \
+            __ASM_EMIT(CMP)                                 /* M = flip plane */ \
+            __ASM_EMIT("shufps      $0x00, %[" M "], %[" M "]") \
+            __ASM_EMIT("andps       %[X_ISIGN], %[" M "]")  /* M = sign mask to flip plane */ \
+            __ASM_EMIT("xorps       %[" M "], %[x2]")       /* xmm2 = oriented plane equation */ \
+            __ASM_EMIT("movups      %[x2], (%[v])")
+
+        #define ORIENTED_PLANE_FLIP         "x1", "cmpltss     %[x3], %[x1]"   /* xmm1 = [0 < a] */
+        #define ORIENTED_PLANE_REV_FLIP     "x3", "cmpltss     %[x1], %[x3]"   /* xmm3 = [a < 0] */
+
+        #define ORIENTED_PLANE_P3(FLIP) \
+            float x0, x1, x2, x3; \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("movups      (%[p0]), %[x2]")        /* xmm2 = x0 y0 z0 w0 */ \
+                __ASM_EMIT("movups      (%[p1]), %[x0]")        /* xmm0 = x1 y1 z1 w1 */ \
+                __ASM_EMIT("movups      (%[p2]), %[x1]")        /* xmm1 = x2 y2 z2 w2 */ \
+                __ASM_EMIT("subps       %[x0], %[x1]")          /* xmm1 = p2 - p1 */ \
+                __ASM_EMIT("subps       %[x2], %[x0]")          /* xmm0 = p1 - p0 */ \
+                ORIENTED_PLANE_CORE("(%[p0])", FLIP) \
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3) \
+                : [v] "r" (v), [sp] "r" (sp), [p0] "r" (p0), [p1] "r" (p1), [p2] "r" (p2), \
+                  [ONE] "m" (ONE), \
+                  [X_ISIGN] "m" (X_ISIGN) \
+                : "memory" \
+            ); \
+            return x0;
+
+        #define ORIENTED_PLANE_PV(FLIP) \
+            float x0, x1, x2, x3; \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("movups      0x00(%[pv]), %[x2]")    /* xmm2 = x0 y0 z0 w0 */ \
+                __ASM_EMIT("movups      0x10(%[pv]), %[x0]")    /* xmm0 = x1 y1 z1 w1 */ \
+                __ASM_EMIT("movups      0x20(%[pv]), %[x1]")    /* xmm1 = x2 y2 z2 w2 */ \
+                __ASM_EMIT("subps       %[x0], %[x1]")          /* xmm1 = p2 - p1 */ \
+                __ASM_EMIT("subps       %[x2], %[x0]")          /* xmm0 = p1 - p0 */ \
+                ORIENTED_PLANE_CORE("0x00(%[pv])", FLIP) \
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3) \
+                : [v] "r" (v), [sp] "r" (sp), [pv] "r" (pv), \
+                  [ONE] "m" (ONE), \
+                  [X_ISIGN] "m" (X_ISIGN) \
+                : "memory" \
+            ); \
+            return x0;
+
+        float calc_oriented_plane_p3(vector3d_t *v, const point3d_t *sp, const point3d_t *p0, const point3d_t *p1, const point3d_t *p2)
+        {
+            ORIENTED_PLANE_P3(ORIENTED_PLANE_FLIP);
+        }
+
+        float calc_oriented_plane_pv(vector3d_t *v, const point3d_t *sp, const point3d_t *pv)
+        {
+            ORIENTED_PLANE_PV(ORIENTED_PLANE_FLIP);
+        }
+
+        float calc_rev_oriented_plane_p3(vector3d_t *v, const point3d_t *sp, const point3d_t *p0, const point3d_t *p1, const point3d_t *p2)
+        {
+            ORIENTED_PLANE_P3(ORIENTED_PLANE_REV_FLIP);
+        }
+
+        float calc_rev_oriented_plane_pv(vector3d_t *v, const point3d_t *sp, const point3d_t *pv)
+        {
+            ORIENTED_PLANE_PV(ORIENTED_PLANE_REV_FLIP);
+        }
+
+        #undef ORIENTED_PLANE_P3
+        #undef ORIENTED_PLANE_PV
+
         void calc_split_point_p2v1(point3d_t *sp, const point3d_t *l0, const point3d_t *l1, const vector3d_t *pl)
         {
             float x0, x1, x2, x3, x4, x5, x6;
@@ -2803,6 +3413,262 @@ namespace lsp
             return x0;
         }
 
+        float calc_avg_distance_p3(const point3d_t *sp, const point3d_t *p0, const point3d_t *p1, const point3d_t *p2)
+        {
+            float x0, x1, x2;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      (%[p0]), %[x0]")        /* xmm0 = p0 */
+                __ASM_EMIT("movups      (%[p1]), %[x1]")        /* xmm1 = p1 */
+                __ASM_EMIT("movups      (%[p2]), %[x2]")        /* xmm2 = p2 */
+                __ASM_EMIT("addps       %[x1], %[x0]")
+                __ASM_EMIT("movups      (%[sp]), %[x1]")        /* xmm1 = sp */
+                __ASM_EMIT("addps       %[x2], %[x0]")          /* xmm0 = p0 + p1 + p2 */
+                __ASM_EMIT("mulps       %[X_THIRD], %[x0]")     /* xmm0 = p = (p0 + p1 + p2) / 3 */
+                __ASM_EMIT("subps       %[x1], %[x0]")          /* xmm0 = d = p - sp */
+                VECTOR_DPPS3("[x0]", "[x0]", "[x1]")            /* xmm0 = dx*dx + dy*dy + dz*dz */
+                __ASM_EMIT("sqrtss      %[x0], %[x0]")
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2)
+                : [sp] "r" (sp), [p0] "r" (p0), [p1] "r" (p1), [p2] "r" (p2),
+                  [X_THIRD] "m" (X_THIRD)
+                :
+            );
+
+            return x0;
+        }
+
+        float calc_distance_p2(const point3d_t *p1, const point3d_t *p2)
+        {
+            float x0, x1;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      (%[p2]), %[x0]")        /* xmm0 = x2 y2 z2 w2 */
+                __ASM_EMIT("movups      (%[p1]), %[x1]")        /* xmm1 = x1 y1 z1 w1 */
+                __ASM_EMIT("subps       %[x1], %[x0]")          /* xmm0 = dx dy dz dw */
+                VECTOR_DPPS3("[x0]", "[x0]", "[x1]")            /* xmm0 = dx*dx + dy*dy + dz*dz */
+                __ASM_EMIT("sqrtss      %[x0], %[x0]")
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1)
+                : [p1] "r" (p1), [p2] "r" (p2)
+                :
+            );
+
+            return x0;
+        }
+
+        float calc_distance_v1(const vector3d_t *v)
+        {
+            float x0, x1;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      (%[v]), %[x0]")         /* xmm0 = dx dy dz dw */
+                VECTOR_DPPS3("[x0]", "[x0]", "[x1]")            /* xmm0 = dx*dx + dy*dy + dz*dz */
+                __ASM_EMIT("sqrtss      %[x0], %[x0]")
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1)
+                : [v] "r" (v)
+                :
+            );
+
+            return x0;
+        }
+
+        float calc_sqr_distance_p2(const point3d_t *p1, const point3d_t *p2)
+        {
+            float x0, x1;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      (%[p2]), %[x0]")        /* xmm0 = x2 y2 z2 w2 */
+                __ASM_EMIT("movups      (%[p1]), %[x1]")        /* xmm1 = x1 y1 z1 w1 */
+                __ASM_EMIT("subps       %[x1], %[x0]")          /* xmm0 = dx dy dz dw */
+                VECTOR_DPPS3("[x0]", "[x0]", "[x1]")            /* xmm0 = dx*dx + dy*dy + dz*dz */
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1)
+                : [p1] "r" (p1), [p2] "r" (p2)
+                :
+            );
+
+            return x0;
+        }
+
+        float calc_distance_pv(const point3d_t *pv)
+        {
+            float x0, x1;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      0x10(%[pv]), %[x0]")    /* xmm0 = x2 y2 z2 w2 */
+                __ASM_EMIT("movups      0x00(%[pv]), %[x1]")    /* xmm1 = x1 y1 z1 w1 */
+                __ASM_EMIT("subps       %[x1], %[x0]")          /* xmm0 = dx dy dz dw */
+                VECTOR_DPPS3("[x0]", "[x0]", "[x1]")            /* xmm0 = dx*dx + dy*dy + dz*dz */
+                __ASM_EMIT("sqrtss      %[x0], %[x0]")
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1)
+                : [pv] "r" (pv)
+                :
+            );
+
+            return x0;
+        }
+
+        float calc_sqr_distance_pv(const point3d_t *pv)
+        {
+            float x0, x1;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      0x10(%[pv]), %[x0]")    /* xmm0 = x2 y2 z2 w2 */
+                __ASM_EMIT("movups      0x00(%[pv]), %[x1]")    /* xmm1 = x1 y1 z1 w1 */
+                __ASM_EMIT("subps       %[x1], %[x0]")          /* xmm0 = dx dy dz dw */
+                VECTOR_DPPS3("[x0]", "[x0]", "[x1]")            /* xmm0 = dx*dx + dy*dy + dz*dz */
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1)
+                : [pv] "r" (pv)
+                :
+            );
+
+            return x0;
+        }
+
+        /*
+         * Input:
+         *   x0 = projection vector v
+         *   x1 = projected vector pv
+         *
+         * Output:
+         *   x1 = (v * pv) / (pv * pv)
+         */
+        #define PROJECTION_LENGTH \
+            __ASM_EMIT("mulps       %[x1], %[x0]")          /* xmm0 = v*pv = a0 a1 a2 a3 */ \
+            __ASM_EMIT("mulps       %[x1], %[x1]")          /* xmm1 = pv*pv = b0 b1 b2 b3 */ \
+            __ASM_EMIT("movaps      %[x1], %[x2]")          /* xmm2 = b0 b1 b2 b3 */ \
+            __ASM_EMIT("unpcklps    %[x0], %[x1]")          /* xmm1 = b0 a0 b1 a1 */ \
+            __ASM_EMIT("unpckhps    %[x0], %[x2]")          /* xmm2 = b2 a2 b3 a3 */ \
+            __ASM_EMIT("movhlps     %[x1], %[x3]")          /* xmm3 = b1 a1 ? ? */ \
+            __ASM_EMIT("addps       %[x2], %[x1]")          /* xmm1 = b0+b2 a0+a2 ? ? */ \
+            __ASM_EMIT("addps       %[x3], %[x1]")          /* xmm1 = k0 k1 ? ? */ \
+            __ASM_EMIT("movaps      %[x1], %[x0]")          /* xmm0 = k0 k1 ? ? */ \
+            __ASM_EMIT("shufps      $0x55, %[x1], %[x1]")   /* xmm1 = k1 k1 k1 k1 */ \
+            __ASM_EMIT("divss       %[x0], %[x1]")          /* xmm1 = k1 / k0 */
+
+        float projection_length_p2(const point3d_t *p0, const point3d_t *p1, const point3d_t *pp)
+        {
+            float x0, x1, x2, x3;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      (%[p0]), %[x2]")        /* xmm2 = p0 */
+                __ASM_EMIT("movups      (%[pp]), %[x0]")        /* xmm0 = pp */
+                __ASM_EMIT("movups      (%[p1]), %[x1]")        /* xmm1 = p1 */
+                __ASM_EMIT("subps       %[x2], %[x0]")          /* xmm0 = pp - p0 */
+                __ASM_EMIT("subps       %[x2], %[x1]")          /* xmm1 = p1 - p0 */
+                PROJECTION_LENGTH
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3)
+                : [p0] "r" (p0), [p1] "r" (p1), [pp] "r" (pp)
+                :
+            );
+
+            return x1;
+        }
+
+        float projection_length_v2(const vector3d_t *v, const vector3d_t *pv)
+        {
+            float x0, x1, x2, x3;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      (%[v]), %[x0]")         /* xmm0 = v */
+                __ASM_EMIT("movups      (%[pv]), %[x1]")        /* xmm1 = pv */
+                PROJECTION_LENGTH
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3)
+                : [v] "r" (v), [pv] "r" (pv)
+                :
+            );
+
+            return x1;
+        }
+
+        #undef PROJECTION_LENGTH
+
+        /*
+         * Input:
+         *   x0 = p0 + p1 + p2
+         *
+         * Output:
+         *   unit vector from sp to the center of triangle is stored to v
+         */
+        #define UNIT_VECTOR_CORE \
+            __ASM_EMIT("movups      (%[sp]), %[x1]")        /* xmm1 = sp */ \
+            __ASM_EMIT("mulps       %[X_THIRD], %[x0]")     /* xmm0 = p = (p0 + p1 + p2) / 3 */ \
+            __ASM_EMIT("subps       %[x1], %[x0]")          /* xmm0 = d = p - sp */ \
+            __ASM_EMIT("andps       %[X_3DMASK], %[x0]")    /* xmm0 = dx dy dz 0 */ \
+            __ASM_EMIT("movaps      %[x0], %[x1]") \
+            VECTOR_DPPS3("[x1]", "[x1]", "[x2]")            /* xmm1 = dx*dx + dy*dy + dz*dz */ \
+            __ASM_EMIT("sqrtss      %[x1], %[x1]")          /* xmm1 = W */ \
+            __ASM_EMIT("xorps       %[x2], %[x2]")          /* xmm2 = 0 */ \
+            __ASM_EMIT("cmpss       $4, %[x1], %[x2]")      /* xmm2 = W != 0 */ \
+            __ASM_EMIT("andps       %[x2], %[x1]")          /* xmm1 = W & [W != 0] */ \
+            __ASM_EMIT("andnps      %[ONE], %[x2]")         /* xmm2 = 1 & [W == 0] */ \
+            __ASM_EMIT("orps        %[x2], %[x1]")          /* xmm1 = (W != 0) ? W : 1 */ \
+            __ASM_EMIT("movaps      %[ONE], %[x2]")         /* xmm2 = 1 */ \
+            __ASM_EMIT("divss       %[x1], %[x2]")          /* xmm2 = k = 1/W */ \
+            __ASM_EMIT("shufps      $0x00, %[x2], %[x2]")   /* xmm2 = k k k k */ \
+            __ASM_EMIT("mulps       %[x2], %[x0]")          /* xmm0 = dx*k dy*k dz*k 0 */ \
+            __ASM_EMIT("movups      %[x0], (%[v])")
+
+        void unit_vector_p1p3(vector3d_t *v, const point3d_t *sp, const point3d_t *p0, const point3d_t *p1, const point3d_t *p2)
+        {
+            float x0, x1, x2;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      (%[p0]), %[x0]")        /* xmm0 = p0 */
+                __ASM_EMIT("movups      (%[p1]), %[x1]")        /* xmm1 = p1 */
+                __ASM_EMIT("movups      (%[p2]), %[x2]")        /* xmm2 = p2 */
+                __ASM_EMIT("addps       %[x1], %[x0]")
+                __ASM_EMIT("addps       %[x2], %[x0]")          /* xmm0 = p0 + p1 + p2 */
+                UNIT_VECTOR_CORE
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2)
+                : [v] "r" (v), [sp] "r" (sp), [p0] "r" (p0), [p1] "r" (p1), [p2] "r" (p2),
+                  [X_THIRD] "m" (X_THIRD),
+                  [X_3DMASK] "m" (X_3DMASK),
+                  [ONE] "m" (ONE)
+                : "memory"
+            );
+        }
+
+        void unit_vector_p1pv(vector3d_t *v, const point3d_t *sp, const point3d_t *pv)
+        {
+            float x0, x1, x2;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      0x00(%[pv]), %[x0]")    /* xmm0 = p0 */
+                __ASM_EMIT("movups      0x10(%[pv]), %[x1]")    /* xmm1 = p1 */
+                __ASM_EMIT("movups      0x20(%[pv]), %[x2]")    /* xmm2 = p2 */
+                __ASM_EMIT("addps       %[x1], %[x0]")
+                __ASM_EMIT("addps       %[x2], %[x0]")          /* xmm0 = p0 + p1 + p2 */
+                UNIT_VECTOR_CORE
+
+                : [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2)
+                : [v] "r" (v), [sp] "r" (sp), [pv] "r" (pv),
+                  [X_THIRD] "m" (X_THIRD),
+                  [X_3DMASK] "m" (X_3DMASK),
+                  [ONE] "m" (ONE)
+                : "memory"
+            );
+        }
+
+        #undef UNIT_VECTOR_CORE
+
         void split_triangle_raw(
                 raw_triangle_t *out,
                 size_t *n_out,
@@ -3487,6 +4353,720 @@ namespace lsp
             #undef STR_SPLIT_1P
             #undef STR_SPLIT_2P
         }
+
+        /* Load four points at the specified offsets from src, transpose them
+         * and store x, y and z components to the arrays
+         */
+        #define SOA3D_TO_X4(O0, O1, O2, O3, X, Y, Z) \
+            __ASM_EMIT("movups      " O0 "(%[src]), %%xmm0")    /* xmm0 = x0 y0 z0 w0 */ \
+            __ASM_EMIT("movups      " O1 "(%[src]), %%xmm1")    /* xmm1 = x1 y1 z1 w1 */ \
+            __ASM_EMIT("movups      " O2 "(%[src]), %%xmm2")    /* xmm2 = x2 y2 z2 w2 */ \
+            __ASM_EMIT("movups      " O3 "(%[src]), %%xmm3")    /* xmm3 = x3 y3 z3 w3 */ \
+            MAT4_TRANSPOSE("%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4") \
+            __ASM_EMIT("mov         " X ", %[t]") \
+            __ASM_EMIT("movups      %%xmm0, (%[t], %[off])") \
+            __ASM_EMIT("mov         " Y ", %[t]") \
+            __ASM_EMIT("movups      %%xmm1, (%[t], %[off])") \
+            __ASM_EMIT("mov         " Z ", %[t]") \
+            __ASM_EMIT("movups      %%xmm2, (%[t], %[off])")
+
+        #define SOA3D_TO_X1(O, X, Y, Z) \
+            __ASM_EMIT("movss       0x00 + " O "(%[src]), %%xmm0") \
+            __ASM_EMIT("movss       0x04 + " O "(%[src]), %%xmm1") \
+            __ASM_EMIT("movss       0x08 + " O "(%[src]), %%xmm2") \
+            __ASM_EMIT("mov         " X ", %[t]") \
+            __ASM_EMIT("movss       %%xmm0, (%[t], %[off])") \
+            __ASM_EMIT("mov         " Y ", %[t]") \
+            __ASM_EMIT("movss       %%xmm1, (%[t], %[off])") \
+            __ASM_EMIT("mov         " Z ", %[t]") \
+            __ASM_EMIT("movss       %%xmm2, (%[t], %[off])")
+
+        /* Load x, y and z components from the arrays, transpose them and store
+         * four points with w = 1 at the specified offsets from dst
+         */
+        #define SOA3D_FROM_X4(O0, O1, O2, O3, X, Y, Z) \
+            __ASM_EMIT("mov         " X ", %[t]") \
+            __ASM_EMIT("movups      (%[t], %[off]), %%xmm0")    /* xmm0 = x0 x1 x2 x3 */ \
+            __ASM_EMIT("mov         " Y ", %[t]") \
+            __ASM_EMIT("movups      (%[t], %[off]), %%xmm1")    /* xmm1 = y0 y1 y2 y3 */ \
+            __ASM_EMIT("mov         " Z ", %[t]") \
+            __ASM_EMIT("movups      (%[t], %[off]), %%xmm2")    /* xmm2 = z0 z1 z2 z3 */ \
+            __ASM_EMIT("movaps      %[ONE], %%xmm3")            /* xmm3 = 1 1 1 1 */ \
+            MAT4_TRANSPOSE("%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4") \
+            __ASM_EMIT("movups      %%xmm0, " O0 "(%[dst])") \
+            __ASM_EMIT("movups      %%xmm1, " O1 "(%[dst])") \
+            __ASM_EMIT("movups      %%xmm2, " O2 "(%[dst])") \
+            __ASM_EMIT("movups      %%xmm3, " O3 "(%[dst])")
+
+        #define SOA3D_FROM_X1(O, X, Y, Z) \
+            __ASM_EMIT("mov         " X ", %[t]") \
+            __ASM_EMIT("movss       (%[t], %[off]), %%xmm0")    /* xmm0 = x 0 0 0 */ \
+            __ASM_EMIT("mov         " Y ", %[t]") \
+            __ASM_EMIT("movss       (%[t], %[off]), %%xmm1")    /* xmm1 = y 0 0 0 */ \
+            __ASM_EMIT("mov         " Z ", %[t]") \
+            __ASM_EMIT("movss       (%[t], %[off]), %%xmm2")    /* xmm2 = z 0 0 0 */ \
+            __ASM_EMIT("movss       %[ONE], %%xmm3")            /* xmm3 = 1 0 0 0 */ \
+            __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")            /* xmm0 = x y 0 0 */ \
+            __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")            /* xmm2 = z 1 0 0 */ \
+            __ASM_EMIT("movlhps     %%xmm2, %%xmm0")            /* xmm0 = x y z 1 */ \
+            __ASM_EMIT("movups      %%xmm0, " O "(%[dst])")
+
+        void points3d_to_soa(const point3d_soa_t *dst, const point3d_t *src, size_t n)
+        {
+            IF_ARCH_X86(size_t off; float *ptr);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jb          2f")
+                // 4x blocks
+                __ASM_EMIT("1:")
+                SOA3D_TO_X4("0x00", "0x10", "0x20", "0x30", "%[x]", "%[y]", "%[z]")
+                __ASM_EMIT("add         $0x40, %[src]")
+                __ASM_EMIT("add         $0x10, %[off]")
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jae         1b")
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $3, %[n]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("3:")
+                SOA3D_TO_X1("0x00", "%[x]", "%[y]", "%[z]")
+                __ASM_EMIT("add         $0x10, %[src]")
+                __ASM_EMIT("add         $0x04, %[off]")
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jge         3b")
+                __ASM_EMIT("4:")
+                : [src] "+r" (src), [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [x] "m" (dst->x), [y] "m" (dst->y), [z] "m" (dst->z)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4"
+            );
+        }
+
+        void points3d_from_soa(point3d_t *dst, const point3d_soa_t *src, size_t n)
+        {
+            IF_ARCH_X86(size_t off; float *ptr);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jb          2f")
+                // 4x blocks
+                __ASM_EMIT("1:")
+                SOA3D_FROM_X4("0x00", "0x10", "0x20", "0x30", "%[x]", "%[y]", "%[z]")
+                __ASM_EMIT("add         $0x40, %[dst]")
+                __ASM_EMIT("add         $0x10, %[off]")
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jae         1b")
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $3, %[n]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("3:")
+                SOA3D_FROM_X1("0x00", "%[x]", "%[y]", "%[z]")
+                __ASM_EMIT("add         $0x10, %[dst]")
+                __ASM_EMIT("add         $0x04, %[off]")
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jge         3b")
+                __ASM_EMIT("4:")
+                : [dst] "+r" (dst), [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [x] "m" (src->x), [y] "m" (src->y), [z] "m" (src->z),
+                  [ONE] "m" (ONE)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4"
+            );
+        }
+
+        void raw_triangles_to_soa(const raw_triangle_soa_t *dst, const raw_triangle_t *src, size_t n)
+        {
+            IF_ARCH_X86(size_t off; float *ptr);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jb          2f")
+                // 4x blocks
+                __ASM_EMIT("1:")
+                SOA3D_TO_X4("0x00", "0x30", "0x60", "0x90", "%[x0]", "%[y0]", "%[z0]")
+                SOA3D_TO_X4("0x10", "0x40", "0x70", "0xa0", "%[x1]", "%[y1]", "%[z1]")
+                SOA3D_TO_X4("0x20", "0x50", "0x80", "0xb0", "%[x2]", "%[y2]", "%[z2]")
+                __ASM_EMIT("add         $0xc0, %[src]")
+                __ASM_EMIT("add         $0x10, %[off]")
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jae         1b")
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $3, %[n]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("3:")
+                SOA3D_TO_X1("0x00", "%[x0]", "%[y0]", "%[z0]")
+                SOA3D_TO_X1("0x10", "%[x1]", "%[y1]", "%[z1]")
+                SOA3D_TO_X1("0x20", "%[x2]", "%[y2]", "%[z2]")
+                __ASM_EMIT("add         $0x30, %[src]")
+                __ASM_EMIT("add         $0x04, %[off]")
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jge         3b")
+                __ASM_EMIT("4:")
+                : [src] "+r" (src), [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [x0] "m" (dst->v[0].x), [y0] "m" (dst->v[0].y), [z0] "m" (dst->v[0].z),
+                  [x1] "m" (dst->v[1].x), [y1] "m" (dst->v[1].y), [z1] "m" (dst->v[1].z),
+                  [x2] "m" (dst->v[2].x), [y2] "m" (dst->v[2].y), [z2] "m" (dst->v[2].z)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4"
+            );
+        }
+
+        void raw_triangles_from_soa(raw_triangle_t *dst, const raw_triangle_soa_t *src, size_t n)
+        {
+            IF_ARCH_X86(size_t off; float *ptr);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jb          2f")
+                // 4x blocks
+                __ASM_EMIT("1:")
+                SOA3D_FROM_X4("0x00", "0x30", "0x60", "0x90", "%[x0]", "%[y0]", "%[z0]")
+                SOA3D_FROM_X4("0x10", "0x40", "0x70", "0xa0", "%[x1]", "%[y1]", "%[z1]")
+                SOA3D_FROM_X4("0x20", "0x50", "0x80", "0xb0", "%[x2]", "%[y2]", "%[z2]")
+                __ASM_EMIT("add         $0xc0, %[dst]")
+                __ASM_EMIT("add         $0x10, %[off]")
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jae         1b")
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $3, %[n]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("3:")
+                SOA3D_FROM_X1("0x00", "%[x0]", "%[y0]", "%[z0]")
+                SOA3D_FROM_X1("0x10", "%[x1]", "%[y1]", "%[z1]")
+                SOA3D_FROM_X1("0x20", "%[x2]", "%[y2]", "%[z2]")
+                __ASM_EMIT("add         $0x30, %[dst]")
+                __ASM_EMIT("add         $0x04, %[off]")
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jge         3b")
+                __ASM_EMIT("4:")
+                : [dst] "+r" (dst), [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [x0] "m" (src->v[0].x), [y0] "m" (src->v[0].y), [z0] "m" (src->v[0].z),
+                  [x1] "m" (src->v[1].x), [y1] "m" (src->v[1].y), [z1] "m" (src->v[1].z),
+                  [x2] "m" (src->v[2].x), [y2] "m" (src->v[2].y), [z2] "m" (src->v[2].z),
+                  [ONE] "m" (ONE)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4"
+            );
+        }
+
+        #undef SOA3D_FROM_X1
+        #undef SOA3D_FROM_X4
+        #undef SOA3D_TO_X1
+        #undef SOA3D_TO_X4
+
+        /* Load the value from the array at the current offset */
+        #define SOA3D_LOAD(MV, A, R) \
+            __ASM_EMIT("mov         " A ", %[t]") \
+            __ASM_EMIT(MV "      (%[t], %[off]), " R)
+
+        #define SOA3D_STORE(MV, R, A) \
+            __ASM_EMIT("mov         " A ", %[t]") \
+            __ASM_EMIT(MV "      " R ", (%[t], %[off])")
+
+        /* The generic loop over SoA elements with 4x and 1x blocks */
+        #define SOA3D_LOOP(BODY) \
+            __ASM_EMIT("xor         %[off], %[off]") \
+            __ASM_EMIT("sub         $4, %[n]") \
+            __ASM_EMIT("jb          2f") \
+            /* 4x blocks */ \
+            __ASM_EMIT("1:") \
+            BODY("movups") \
+            __ASM_EMIT("add         $0x10, %[off]") \
+            __ASM_EMIT("sub         $4, %[n]") \
+            __ASM_EMIT("jae         1b") \
+            /* 1x blocks */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add         $3, %[n]") \
+            __ASM_EMIT("jl          4f") \
+            __ASM_EMIT("3:") \
+            BODY("movss ") \
+            __ASM_EMIT("add         $0x04, %[off]") \
+            __ASM_EMIT("dec         %[n]") \
+            __ASM_EMIT("jge         3b") \
+            __ASM_EMIT("4:")
+
+        #define SOA3D_DISTANCE(MV) \
+            SOA3D_LOAD(MV, "%[x1]", "%%xmm0") \
+            SOA3D_LOAD(MV, "%[y1]", "%%xmm1") \
+            SOA3D_LOAD(MV, "%[z1]", "%%xmm2") \
+            SOA3D_LOAD(MV, "%[x2]", "%%xmm3") \
+            SOA3D_LOAD(MV, "%[y2]", "%%xmm4") \
+            SOA3D_LOAD(MV, "%[z2]", "%%xmm5") \
+            __ASM_EMIT("subps       %%xmm0, %%xmm3")            /* xmm3 = dx */ \
+            __ASM_EMIT("subps       %%xmm1, %%xmm4")            /* xmm4 = dy */ \
+            __ASM_EMIT("subps       %%xmm2, %%xmm5")            /* xmm5 = dz */ \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm3")            /* xmm3 = dx*dx */ \
+            __ASM_EMIT("mulps       %%xmm4, %%xmm4")            /* xmm4 = dy*dy */ \
+            __ASM_EMIT("mulps       %%xmm5, %%xmm5")            /* xmm5 = dz*dz */ \
+            __ASM_EMIT("addps       %%xmm4, %%xmm3") \
+            __ASM_EMIT("addps       %%xmm5, %%xmm3") \
+            __ASM_EMIT("sqrtps      %%xmm3, %%xmm3")            /* xmm3 = sqrt(dx*dx + dy*dy + dz*dz) */ \
+            SOA3D_STORE(MV, "%%xmm3", "%[dst]")
+
+        void calc_distance_soa(float *dst, const point3d_soa_t *p1, const point3d_soa_t *p2, size_t n)
+        {
+            IF_ARCH_X86(size_t off; float *ptr);
+
+            ARCH_X86_ASM
+            (
+                SOA3D_LOOP(SOA3D_DISTANCE)
+                : [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [dst] "m" (dst),
+                  [x1] "m" (p1->x), [y1] "m" (p1->y), [z1] "m" (p1->z),
+                  [x2] "m" (p2->x), [y2] "m" (p2->y), [z2] "m" (p2->z)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5"
+            );
+        }
+
+        #undef SOA3D_DISTANCE
+
+        /* Compute the cross product of two triangle edges:
+         *   d0 = v1 - v0, d1 = v2 - A, where A is v0 or v1
+         * Output: xmm1 = nx, xmm2 = ny, xmm3 = nz
+         */
+        #define SOA3D_CROSS(MV, A0, A1, A2) \
+            SOA3D_LOAD(MV, "%[x0]", "%%xmm0")                   /* xmm0 = x0 */ \
+            SOA3D_LOAD(MV, "%[y0]", "%%xmm1")                   /* xmm1 = y0 */ \
+            SOA3D_LOAD(MV, "%[z0]", "%%xmm2")                   /* xmm2 = z0 */ \
+            SOA3D_LOAD(MV, "%[x1]", "%%xmm3")                   /* xmm3 = x1 */ \
+            SOA3D_LOAD(MV, "%[y1]", "%%xmm4")                   /* xmm4 = y1 */ \
+            SOA3D_LOAD(MV, "%[z1]", "%%xmm5")                   /* xmm5 = z1 */ \
+            SOA3D_LOAD(MV, "%[x2]", "%%xmm6")                   /* xmm6 = x2 */ \
+            SOA3D_LOAD(MV, "%[y2]", "%%xmm7")                   /* xmm7 = y2 */ \
+            __ASM_EMIT("subps       " A0 ", %%xmm6")            /* xmm6 = d1x */ \
+            __ASM_EMIT("subps       " A1 ", %%xmm7")            /* xmm7 = d1y */ \
+            __ASM_EMIT("subps       %%xmm0, %%xmm3")            /* xmm3 = d0x */ \
+            __ASM_EMIT("subps       %%xmm1, %%xmm4")            /* xmm4 = d0y */ \
+            __ASM_EMIT("movaps      " A2 ", %%xmm1")            /* xmm1 = z0 or z1 */ \
+            SOA3D_LOAD(MV, "%[z2]", "%%xmm0")                   /* xmm0 = z2 */ \
+            __ASM_EMIT("subps       %%xmm2, %%xmm5")            /* xmm5 = d0z */ \
+            __ASM_EMIT("subps       %%xmm1, %%xmm0")            /* xmm0 = d1z */ \
+            __ASM_EMIT("movaps      %%xmm4, %%xmm1") \
+            __ASM_EMIT("movaps      %%xmm5, %%xmm2") \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm1")            /* xmm1 = d0y*d1z */ \
+            __ASM_EMIT("mulps       %%xmm7, %%xmm2")            /* xmm2 = d0z*d1y */ \
+            __ASM_EMIT("subps       %%xmm2, %%xmm1")            /* xmm1 = nx = d0y*d1z - d0z*d1y */ \
+            __ASM_EMIT("movaps      %%xmm5, %%xmm2") \
+            __ASM_EMIT("mulps       %%xmm6, %%xmm2")            /* xmm2 = d0z*d1x */ \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm0")            /* xmm0 = d0x*d1z */ \
+            __ASM_EMIT("subps       %%xmm0, %%xmm2")            /* xmm2 = ny = d0z*d1x - d0x*d1z */ \
+            __ASM_EMIT("mulps       %%xmm7, %%xmm3")            /* xmm3 = d0x*d1y */ \
+            __ASM_EMIT("mulps       %%xmm6, %%xmm4")            /* xmm4 = d0y*d1x */ \
+            __ASM_EMIT("subps       %%xmm4, %%xmm3")            /* xmm3 = nz = d0x*d1y - d0y*d1x */ \
+            /* Compute the length */ \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm4") \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5") \
+            __ASM_EMIT("movaps      %%xmm3, %%xmm6") \
+            __ASM_EMIT("mulps       %%xmm4, %%xmm4")            /* xmm4 = nx*nx */ \
+            __ASM_EMIT("mulps       %%xmm5, %%xmm5")            /* xmm5 = ny*ny */ \
+            __ASM_EMIT("mulps       %%xmm6, %%xmm6")            /* xmm6 = nz*nz */ \
+            __ASM_EMIT("addps       %%xmm5, %%xmm4") \
+            __ASM_EMIT("addps       %%xmm6, %%xmm4") \
+            __ASM_EMIT("sqrtps      %%xmm4, %%xmm4")            /* xmm4 = l = sqrt(nx*nx + ny*ny + nz*nz) */
+
+        #define SOA3D_AREA(MV) \
+            SOA3D_CROSS(MV, "%%xmm0", "%%xmm1", "%%xmm2") \
+            SOA3D_STORE(MV, "%%xmm4", "%[dst]")
+
+        void calc_area_soa(float *dst, const raw_triangle_soa_t *t, size_t n)
+        {
+            IF_ARCH_X86(size_t off; float *ptr);
+
+            ARCH_X86_ASM
+            (
+                SOA3D_LOOP(SOA3D_AREA)
+                : [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [dst] "m" (dst),
+                  [x0] "m" (t->v[0].x), [y0] "m" (t->v[0].y), [z0] "m" (t->v[0].z),
+                  [x1] "m" (t->v[1].x), [y1] "m" (t->v[1].y), [z1] "m" (t->v[1].z),
+                  [x2] "m" (t->v[2].x), [y2] "m" (t->v[2].y), [z2] "m" (t->v[2].z)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #define SOA3D_NORMAL(MV) \
+            SOA3D_CROSS(MV, "%%xmm3", "%%xmm4", "%%xmm5") \
+            __ASM_EMIT("movaps      %[ONE], %%xmm5")            /* xmm5 = 1 */ \
+            __ASM_EMIT("xorps       %%xmm6, %%xmm6")            /* xmm6 = 0 */ \
+            __ASM_EMIT("divps       %%xmm4, %%xmm5")            /* xmm5 = 1/l */ \
+            __ASM_EMIT("cmpltps     %%xmm4, %%xmm6")            /* xmm6 = [l > 0] */ \
+            __ASM_EMIT("andps       %%xmm6, %%xmm5")            /* xmm5 = 1/l & [l > 0] */ \
+            __ASM_EMIT("andnps      %[ONE], %%xmm6")            /* xmm6 = 1 & [l <= 0] */ \
+            __ASM_EMIT("orps        %%xmm6, %%xmm5")            /* xmm5 = k = (l > 0) ? 1/l : 1 */ \
+            __ASM_EMIT("mulps       %%xmm5, %%xmm1") \
+            __ASM_EMIT("mulps       %%xmm5, %%xmm2") \
+            __ASM_EMIT("mulps       %%xmm5, %%xmm3") \
+            SOA3D_STORE(MV, "%%xmm1", "%[dx]") \
+            SOA3D_STORE(MV, "%%xmm2", "%[dy]") \
+            SOA3D_STORE(MV, "%%xmm3", "%[dz]")
+
+        void calc_normal3d_soa(vector3d_soa_t *dst, const raw_triangle_soa_t *t, size_t n)
+        {
+            IF_ARCH_X86(
+                size_t off; float *ptr;
+                // Local copy keeps the destination operands frame-relative at -O0
+                float *D[3] = { dst->dx, dst->dy, dst->dz };
+            );
+
+            ARCH_X86_ASM
+            (
+                SOA3D_LOOP(SOA3D_NORMAL)
+                : [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [dx] "m" (D[0]), [dy] "m" (D[1]), [dz] "m" (D[2]),
+                  [x0] "m" (t->v[0].x), [y0] "m" (t->v[0].y), [z0] "m" (t->v[0].z),
+                  [x1] "m" (t->v[1].x), [y1] "m" (t->v[1].y), [z1] "m" (t->v[1].z),
+                  [x2] "m" (t->v[2].x), [y2] "m" (t->v[2].y), [z2] "m" (t->v[2].z),
+                  [ONE] "m" (ONE)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef SOA3D_NORMAL
+        #undef SOA3D_AREA
+        #undef SOA3D_CROSS
+
+        /* Compute the colocation tag of the vertex and the plane:
+         *   k = x*dx + y*dy + z*dz + dw, tag = [k <= +TOL] + [k < -TOL]
+         */
+        #define SOA3D_COLOCATE(MV, X, Y, Z) \
+            SOA3D_LOAD(MV, X, "%%xmm0")                         /* xmm0 = x */ \
+            SOA3D_LOAD(MV, Y, "%%xmm1")                         /* xmm1 = y */ \
+            SOA3D_LOAD(MV, Z, "%%xmm2")                         /* xmm2 = z */ \
+            __ASM_EMIT("mulps       0x00(%[P]), %%xmm0")        /* xmm0 = x*dx */ \
+            __ASM_EMIT("mulps       0x10(%[P]), %%xmm1")        /* xmm1 = y*dy */ \
+            __ASM_EMIT("mulps       0x20(%[P]), %%xmm2")        /* xmm2 = z*dz */ \
+            __ASM_EMIT("addps       %%xmm1, %%xmm0") \
+            __ASM_EMIT("addps       %%xmm2, %%xmm0") \
+            __ASM_EMIT("addps       0x30(%[P]), %%xmm0")        /* xmm0 = k */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1") \
+            __ASM_EMIT("cmpps       $2, %[PTOL], %%xmm0")       /* xmm0 = [k <= +TOL] */ \
+            __ASM_EMIT("cmpps       $1, %[MTOL], %%xmm1")       /* xmm1 = [k < -TOL] */ \
+            __ASM_EMIT("andps       %[IONE], %%xmm0") \
+            __ASM_EMIT("andps       %[IONE], %%xmm1") \
+            __ASM_EMIT("paddd       %%xmm1, %%xmm0")            /* xmm0 = tag */
+
+        #define SOA3D_COLOCATION(MV) \
+            SOA3D_COLOCATE(MV, "%[x0]", "%[y0]", "%[z0]") \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm3")            /* xmm3 = tag0 */ \
+            SOA3D_COLOCATE(MV, "%[x1]", "%[y1]", "%[z1]") \
+            __ASM_EMIT("pslld       $2, %%xmm0") \
+            __ASM_EMIT("por         %%xmm0, %%xmm3")            /* xmm3 = tag0 | (tag1 << 2) */ \
+            SOA3D_COLOCATE(MV, "%[x2]", "%[y2]", "%[z2]") \
+            __ASM_EMIT("pslld       $4, %%xmm0") \
+            __ASM_EMIT("por         %%xmm0, %%xmm3")            /* xmm3 = tag0 | (tag1 << 2) | (tag2 << 4) */ \
+            SOA3D_STORE(MV, "%%xmm3", "%[dst]")
+
+        void colocation_x3_v1_soa(uint32_t *dst, const vector3d_t *pl, const raw_triangle_soa_t *t, size_t n)
+        {
+            float P[16] __lsp_aligned16;
+            IF_ARCH_X86(size_t off; float *ptr);
+
+            P[0]  = P[1]  = P[2]  = P[3]    = pl->dx;
+            P[4]  = P[5]  = P[6]  = P[7]    = pl->dy;
+            P[8]  = P[9]  = P[10] = P[11]   = pl->dz;
+            P[12] = P[13] = P[14] = P[15]   = pl->dw;
+
+            ARCH_X86_ASM
+            (
+                SOA3D_LOOP(SOA3D_COLOCATION)
+                : [n] "+r" (n),
+                  [off] "=&r" (off), [t] "=&r" (ptr)
+                : [dst] "m" (dst), [P] "r" (&P[0]),
+                  [x0] "m" (t->v[0].x), [y0] "m" (t->v[0].y), [z0] "m" (t->v[0].z),
+                  [x1] "m" (t->v[1].x), [y1] "m" (t->v[1].y), [z1] "m" (t->v[1].z),
+                  [x2] "m" (t->v[2].x), [y2] "m" (t->v[2].y), [z2] "m" (t->v[2].z),
+                  [PTOL] "m" (X_3D_TOLERANCE),
+                  [MTOL] "m" (X_3D_MTOLERANCE),
+                  [IONE] "m" (IONE)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3"
+            );
+        }
+
+        #undef SOA3D_COLOCATION
+        #undef SOA3D_COLOCATE
+        #undef SOA3D_LOOP
+        #undef SOA3D_STORE
+        #undef SOA3D_LOAD
+
+        /*
+         * Compute 4 distances between sp and p[0..3]
+         * Input:
+         *   xmm7 = sp
+         *   SQRT = instruction to apply to the squared distance
+         */
+        #define DISTANCE_P1N(SQRT) \
+            __ASM_EMIT("movups      %[sp], %%xmm7")             /* xmm7 = sp */ \
+            __ASM_EMIT("sub         $4, %[n]") \
+            __ASM_EMIT("jb          2f") \
+            __ASM_EMIT("1:") \
+            MATRIX_LOAD("p", "%xmm0", "%xmm1", "%xmm2", "%xmm3") /* xmm0..3 = p[0..3] */ \
+            __ASM_EMIT("subps       %%xmm7, %%xmm0") \
+            __ASM_EMIT("subps       %%xmm7, %%xmm1") \
+            __ASM_EMIT("subps       %%xmm7, %%xmm2") \
+            __ASM_EMIT("subps       %%xmm7, %%xmm3")            /* xmm0..3 = d[0..3] = p[0..3] - sp */ \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm0") \
+            __ASM_EMIT("mulps       %%xmm1, %%xmm1") \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm2") \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm3")            /* xmm0..3 = d[0..3]*d[0..3] */ \
+            MAT4_TRANSPOSE("%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4") /* xmm0 = dx*dx, xmm1 = dy*dy, xmm2 = dz*dz */ \
+            __ASM_EMIT("addps       %%xmm1, %%xmm0") \
+            __ASM_EMIT("addps       %%xmm2, %%xmm0")            /* xmm0 = dx*dx + dy*dy + dz*dz */ \
+            __ASM_EMIT(SQRT) \
+            __ASM_EMIT("movups      %%xmm0, (%[dst])") \
+            __ASM_EMIT("add         $0x40, %[p]") \
+            __ASM_EMIT("add         $0x10, %[dst]") \
+            __ASM_EMIT("sub         $4, %[n]") \
+            __ASM_EMIT("jae         1b") \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add         $4, %[n]")
+
+        void calc_distance_p1n(float *dst, const point3d_t *sp, const point3d_t *p, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                DISTANCE_P1N("sqrtps      %%xmm0, %%xmm0")
+                : [dst] "+r" (dst), [p] "+r" (p), [n] "+r" (n)
+                : [sp] "m" (*sp)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm7"
+            );
+
+            for (; n > 0; --n)
+                *(dst++)    = calc_distance_p2(sp, p++);
+        }
+
+        void calc_sqr_distance_p1n(float *dst, const point3d_t *sp, const point3d_t *p, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                DISTANCE_P1N("")
+                : [dst] "+r" (dst), [p] "+r" (p), [n] "+r" (n)
+                : [sp] "m" (*sp)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm7"
+            );
+
+            for (; n > 0; --n)
+                *(dst++)    = calc_sqr_distance_p2(sp, p++);
+        }
+
+        #undef DISTANCE_P1N
+
+        /* Compute the sum of triangle vertices: R = pv[0] + pv[1] + pv[2] */
+        #define TRIANGLE_SUM(OFF, R) \
+            __ASM_EMIT("movups      " OFF " + 0x00(%[pv]), " R) \
+            __ASM_EMIT("movups      " OFF " + 0x10(%[pv]), %%xmm4") \
+            __ASM_EMIT("addps       %%xmm4, " R) \
+            __ASM_EMIT("movups      " OFF " + 0x20(%[pv]), %%xmm4") \
+            __ASM_EMIT("addps       %%xmm4, " R)
+
+        /* Compute the vectors from sp to the centers of 4 triangles: xmm0..3 = d[0..3] */
+        #define TRIANGLE_CENTER_X4 \
+            TRIANGLE_SUM("0x00", "%%xmm0") \
+            TRIANGLE_SUM("0x30", "%%xmm1") \
+            TRIANGLE_SUM("0x60", "%%xmm2") \
+            TRIANGLE_SUM("0x90", "%%xmm3") \
+            __ASM_EMIT("mulps       %[X_THIRD], %%xmm0") \
+            __ASM_EMIT("mulps       %[X_THIRD], %%xmm1") \
+            __ASM_EMIT("mulps       %[X_THIRD], %%xmm2") \
+            __ASM_EMIT("mulps       %[X_THIRD], %%xmm3")        /* xmm0..3 = p[0..3] = centers of triangles */ \
+            __ASM_EMIT("subps       %%xmm7, %%xmm0") \
+            __ASM_EMIT("subps       %%xmm7, %%xmm1") \
+            __ASM_EMIT("subps       %%xmm7, %%xmm2") \
+            __ASM_EMIT("subps       %%xmm7, %%xmm3")            /* xmm0..3 = d[0..3] = p[0..3] - sp */
+
+        /* Compute the lengths of 4 vectors: xmm0 = sqrt(d[0..3]*d[0..3]) */
+        #define VECTOR_LENGTH_X4 \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm0") \
+            __ASM_EMIT("mulps       %%xmm1, %%xmm1") \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm2") \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm3") \
+            MAT4_TRANSPOSE("%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4") \
+            __ASM_EMIT("addps       %%xmm1, %%xmm0") \
+            __ASM_EMIT("addps       %%xmm2, %%xmm0")            /* xmm0 = dx*dx + dy*dy + dz*dz */ \
+            __ASM_EMIT("sqrtps      %%xmm0, %%xmm0")            /* xmm0 = W[0..3] */
+
+        void calc_avg_distance_pvn(float *dst, const point3d_t *sp, const point3d_t *pv, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      %[sp], %%xmm7")             /* xmm7 = sp */
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                TRIANGLE_CENTER_X4
+                VECTOR_LENGTH_X4
+                __ASM_EMIT("movups      %%xmm0, (%[dst])")
+                __ASM_EMIT("add         $0xc0, %[pv]")
+                __ASM_EMIT("add         $0x10, %[dst]")
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jae         1b")
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $4, %[n]")
+                : [dst] "+r" (dst), [pv] "+r" (pv), [n] "+r" (n)
+                : [sp] "m" (*sp),
+                  [X_THIRD] "m" (X_THIRD)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm7"
+            );
+
+            for (; n > 0; --n, pv += 3)
+                *(dst++)    = calc_avg_distance_p3(sp, &pv[0], &pv[1], &pv[2]);
+        }
+
+        /* Scale the vector stored at v[I] by the lane I of k */
+        #define UNIT_VECTOR_SCALE(OFF, SHUF) \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm3") \
+            __ASM_EMIT("movups      " OFF "(%[v]), %%xmm0") \
+            __ASM_EMIT("shufps      $" SHUF ", %%xmm3, %%xmm3") \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm0") \
+            __ASM_EMIT("movups      %%xmm0, " OFF "(%[v])")
+
+        void unit_vector_p1pvn(vector3d_t *v, const point3d_t *sp, const point3d_t *pv, size_t n)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      %[sp], %%xmm7")             /* xmm7 = sp */
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                TRIANGLE_CENTER_X4
+                __ASM_EMIT("movaps      %[X_3DMASK], %%xmm4")
+                __ASM_EMIT("andps       %%xmm4, %%xmm0")
+                __ASM_EMIT("andps       %%xmm4, %%xmm1")
+                __ASM_EMIT("andps       %%xmm4, %%xmm2")
+                __ASM_EMIT("andps       %%xmm4, %%xmm3")            /* xmm0..3 = dx dy dz 0 */
+                MATRIX_STORE("v", "%xmm0", "%xmm1", "%xmm2", "%xmm3")
+                VECTOR_LENGTH_X4
+                __ASM_EMIT("xorps       %%xmm1, %%xmm1")            /* xmm1 = 0 */
+                __ASM_EMIT("movaps      %[ONE], %%xmm2")            /* xmm2 = 1 */
+                __ASM_EMIT("cmpneqps    %%xmm0, %%xmm1")            /* xmm1 = [W != 0] */
+                __ASM_EMIT("andps       %%xmm1, %%xmm0")            /* xmm0 = W & [W != 0] */
+                __ASM_EMIT("andnps      %%xmm2, %%xmm1")            /* xmm1 = 1 & [W == 0] */
+                __ASM_EMIT("orps        %%xmm1, %%xmm0")            /* xmm0 = (W != 0) ? W : 1 */
+                __ASM_EMIT("divps       %%xmm0, %%xmm2")            /* xmm2 = k = 1/W */
+                UNIT_VECTOR_SCALE("0x00", "0x00")
+                UNIT_VECTOR_SCALE("0x10", "0x55")
+                UNIT_VECTOR_SCALE("0x20", "0xaa")
+                UNIT_VECTOR_SCALE("0x30", "0xff")
+                __ASM_EMIT("add         $0xc0, %[pv]")
+                __ASM_EMIT("add         $0x40, %[v]")
+                __ASM_EMIT("sub         $4, %[n]")
+                __ASM_EMIT("jae         1b")
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $4, %[n]")
+                : [v] "+r" (v), [pv] "+r" (pv), [n] "+r" (n)
+                : [sp] "m" (*sp),
+                  [X_THIRD] "m" (X_THIRD),
+                  [X_3DMASK] "m" (X_3DMASK),
+                  [ONE] "m" (ONE)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm7"
+            );
+
+            for (; n > 0; --n, pv += 3)
+                unit_vector_p1pv(v++, sp, pv);
+        }
+
+        #undef UNIT_VECTOR_SCALE
+        #undef VECTOR_LENGTH_X4
+        #undef TRIANGLE_CENTER_X4
+        #undef TRIANGLE_SUM
+
+        void calc_oriented_plane_pvn(vector3d_t *v, const point3d_t *sp, const point3d_t *pv, size_t n)
+        {
+            if (n == 0)
+                return;
+
+            float x0, x1, x2, x3;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      0x00(%[pv]), %[x2]")    /* xmm2 = x0 y0 z0 w0 */
+                __ASM_EMIT("movups      0x10(%[pv]), %[x0]")    /* xmm0 = x1 y1 z1 w1 */
+                __ASM_EMIT("movups      0x20(%[pv]), %[x1]")    /* xmm1 = x2 y2 z2 w2 */
+                __ASM_EMIT("subps       %[x0], %[x1]")          /* xmm1 = p2 - p1 */
+                __ASM_EMIT("subps       %[x2], %[x0]")          /* xmm0 = p1 - p0 */
+                ORIENTED_PLANE_CORE("0x00(%[pv])", "x1", "cmpltss     %[x3], %[x1]")
+                __ASM_EMIT("add         $0x30, %[pv]")
+                __ASM_EMIT("add         $0x10, %[v]")
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jnz         1b")
+                : [v] "+r" (v), [pv] "+r" (pv), [n] "+r" (n),
+                  [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3)
+                : [sp] "r" (sp),
+                  [ONE] "m" (ONE),
+                  [X_ISIGN] "m" (X_ISIGN)
+                : "cc", "memory"
+            );
+        }
+
+        #undef ORIENTED_PLANE_CORE
+        #undef ORIENTED_PLANE_FLIP
+        #undef ORIENTED_PLANE_REV_FLIP
+
+        void vector_mul_v2n(vector3d_t *r, const vector3d_t *v1, const vector3d_t *v2, size_t n)
+        {
+            if (n == 0)
+                return;
+
+            float x0, x1, x2, x3;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      (%[v1]), %[x0]")        /* xmm0 = dx1 dy1 dz1 dw1 */
+                __ASM_EMIT("movups      (%[v2]), %[x1]")        /* xmm1 = dx2 dy2 dz2 dw2 */
+                VECTOR_MUL("[x0]", "[x1]", "[x2]", "[x3]")      /* xmm0 = NZ NX NY NW */
+                __ASM_EMIT("shufps      $0xc9, %[x0], %[x0]")   /* xmm0 = NX NY NZ NW */
+                __ASM_EMIT("andps       %[X_3DMASK], %[x0]")    /* xmm0 = NX NY NZ 0 */
+                __ASM_EMIT("movups      %[x0], (%[r])")
+                __ASM_EMIT("add         $0x10, %[v1]")
+                __ASM_EMIT("add         $0x10, %[v2]")
+                __ASM_EMIT("add         $0x10, %[r]")
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jnz         1b")
+                : [r] "+r" (r), [v1] "+r" (v1), [v2] "+r" (v2), [n] "+r" (n),
+                  [x0] "=&x" (x0), [x1] "=&x" (x1), [x2] "=&x" (x2), [x3] "=&x" (x3)
+                : [X_3DMASK] "m" (X_3DMASK)
+                : "cc", "memory"
+            );
+        }
     }
 }
 
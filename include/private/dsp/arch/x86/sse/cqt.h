@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_CQT_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_CQT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+namespace lsp
+{
+    namespace sse
+    {
+        IF_ARCH_X86(
+            static const uint32_t cqt_sign[] __lsp_aligned16 =
+            {
+                0x80000000, 0x00000000, 0x80000000, 0x00000000
+            };
+        )
+
+        void cqt_apply(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count)
+        {
+            for (size_t i=0; i<count; ++i, ++dst)
+            {
+                const dsp::cqt_bin_t *b = &bins[i];
+                const float *x  = &fft[b->first * 2];
+                const float *k  = &kernel[b->offset];
+                size_t n        = b->count;
+
+                ARCH_X86_ASM
+                (
+                    __ASM_EMIT("xorps       %%xmm0, %%xmm0")            /* xmm0 = sum(xr*kr) sum(xi*ki) */
+                    __ASM_EMIT("xorps       %%xmm1, %%xmm1")            /* xmm1 = sum(xr*ki) sum(xi*kr) */
+                    __ASM_EMIT("sub         $4, %[n]")
+                    __ASM_EMIT("jb          2f")
+
+                    /* x4 blocks */
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("movups      0x00(%[x]), %%xmm2")        /* xmm2 = xr0 xi0 xr1 xi1 */
+                    __ASM_EMIT("movups      0x10(%[x]), %%xmm3")        /* xmm3 = xr2 xi2 xr3 xi3 */
+                    __ASM_EMIT("movups      0x00(%[k]), %%xmm4")        /* xmm4 = kr0 ki0 kr1 ki1 */
+                    __ASM_EMIT("movups      0x10(%[k]), %%xmm5")        /* xmm5 = kr2 ki2 kr3 ki3 */
+                    __ASM_EMIT("movaps      %%xmm4, %%xmm6")
+                    __ASM_EMIT("movaps      %%xmm5, %%xmm7")
+                    __ASM_EMIT("shufps      $0xb1, %%xmm6, %%xmm6")     /* xmm6 = ki0 kr0 ki1 kr1 */
+                    __ASM_EMIT("shufps      $0xb1, %%xmm7, %%xmm7")     /* xmm7 = ki2 kr2 ki3 kr3 */
+                    __ASM_EMIT("mulps       %%xmm2, %%xmm4")
+                    __ASM_EMIT("mulps       %%xmm3, %%xmm5")
+                    __ASM_EMIT("mulps       %%xmm2, %%xmm6")
+                    __ASM_EMIT("mulps       %%xmm3, %%xmm7")
+                    __ASM_EMIT("addps       %%xmm4, %%xmm0")
+                    __ASM_EMIT("addps       %%xmm6, %%xmm1")
+                    __ASM_EMIT("addps       %%xmm5, %%xmm0")
+                    __ASM_EMIT("addps       %%xmm7, %%xmm1")
+                    __ASM_EMIT("add         $0x20, %[x]")
+                    __ASM_EMIT("add         $0x20, %[k]")
+                    __ASM_EMIT("sub         $4, %[n]")
+                    __ASM_EMIT("jae         1b")
+
+                    /* x2 block */
+                    __ASM_EMIT("2:")
+                    __ASM_EMIT("add         $2, %[n]")
+                    __ASM_EMIT("jl          4f")
+                    __ASM_EMIT("movups      0x00(%[x]), %%xmm2")
+                    __ASM_EMIT("movups      0x00(%[k]), %%xmm4")
+                    __ASM_EMIT("movaps      %%xmm4, %%xmm6")
+                    __ASM_EMIT("shufps      $0xb1, %%xmm6, %%xmm6")
+                    __ASM_EMIT("mulps       %%xmm2, %%xmm4")
+                    __ASM_EMIT("mulps       %%xmm2, %%xmm6")
+                    __ASM_EMIT("addps       %%xmm4, %%xmm0")
+                    __ASM_EMIT("addps       %%xmm6, %%xmm1")
+                    __ASM_EMIT("add         $0x10, %[x]")
+                    __ASM_EMIT("add         $0x10, %[k]")
+                    __ASM_EMIT("sub         $2, %[n]")
+
+                    /* x1 block */
+                    __ASM_EMIT("4:")
+                    __ASM_EMIT("add         $1, %[n]")
+                    __ASM_EMIT("jl          6f")
+                    __ASM_EMIT("xorps       %%xmm2, %%xmm2")
+                    __ASM_EMIT("xorps       %%xmm4, %%xmm4")
+                    __ASM_EMIT("movlps      0x00(%[x]), %%xmm2")        /* xmm2 = xr0 xi0 0 0 */
+                    __ASM_EMIT("movlps      0x00(%[k]), %%xmm4")        /* xmm4 = kr0 ki0 0 0 */
+                    __ASM_EMIT("movaps      %%xmm4, %%xmm6")
+                    __ASM_EMIT("shufps      $0xb1, %%xmm6, %%xmm6")
+                    __ASM_EMIT("mulps       %%xmm2, %%xmm4")
+                    __ASM_EMIT("mulps       %%xmm2, %%xmm6")
+                    __ASM_EMIT("addps       %%xmm4, %%xmm0")
+                    __ASM_EMIT("addps       %%xmm6, %%xmm1")
+
+                    /* Compute magnitude */
+                    __ASM_EMIT("6:")
+                    __ASM_EMIT("xorps       %[sign], %%xmm0")           /* xmm0 = -xr*kr xi*ki ... */
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm2")
+                    __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")            /* xmm0 = a0 b0 a1 b1 */
+                    __ASM_EMIT("unpckhps    %%xmm1, %%xmm2")            /* xmm2 = a2 b2 a3 b3 */
+                    __ASM_EMIT("addps       %%xmm2, %%xmm0")            /* xmm0 = a0+a2 b0+b2 a1+a3 b1+b3 */
+                    __ASM_EMIT("movhlps     %%xmm0, %%xmm2")            /* xmm2 = a1+a3 b1+b3 */
+                    __ASM_EMIT("addps       %%xmm2, %%xmm0")            /* xmm0 = -re im */
+                    __ASM_EMIT("mulps       %%xmm0, %%xmm0")            /* xmm0 = re*re im*im */
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm2")
+                    __ASM_EMIT("shufps      $0x55, %%xmm2, %%xmm2")     /* xmm2 = im*im */
+                    __ASM_EMIT("addss       %%xmm2, %%xmm0")            /* xmm0 = re*re + im*im */
+                    __ASM_EMIT("sqrtss      %%xmm0, %%xmm0")
+                    __ASM_EMIT("movss       %%xmm0, (%[dst])")
+
+                    : [x] "+r" (x), [k] "+r" (k), [n] "+r" (n)
+                    : [dst] "r" (dst),
+                      [sign] "m" (cqt_sign)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                );
+            }
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_CQT_H_ */
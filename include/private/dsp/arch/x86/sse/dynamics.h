@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_DYNAMICS_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_DYNAMICS_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+/*
+    Envelope followers of 4 channels are computed in parallel lanes. Each
+    4x4 block of samples is transposed so that every register holds one
+    time step of all channels, the recurrence is applied step by step and
+    the block is transposed back.
+
+    Register allocation:
+      xmm0-xmm3     = samples / envelope values of 4 time steps
+      xmm4          = temporary
+      xmm5          = release coefficients
+      xmm6          = attack - release coefficients
+      xmm7          = envelope state
+ */
+
+// Load 4 samples of 4 channels
+#define DYN_LOAD4(ptr, x) \
+    __ASM_EMIT("mov         " ptr "(%[src]), %[ptr]") \
+    __ASM_EMIT("movups      (%[ptr], %[off]), %%" x)
+
+// Store 4 samples of 4 channels
+#define DYN_STORE4(ptr, x) \
+    __ASM_EMIT("mov         " ptr "(%[dst]), %[ptr]") \
+    __ASM_EMIT("movups      %%" x ", (%[ptr], %[off])")
+
+#define DYN_PTR0    "0x00"
+#define DYN_PTR1    __IF_32_64("0x04", "0x08")
+#define DYN_PTR2    __IF_32_64("0x08", "0x10")
+#define DYN_PTR3    __IF_32_64("0x0c", "0x18")
+
+// Transpose 4x4 matrix in xmm0-xmm3 using xmm4 as temporary
+#define DYN_TRANSPOSE \
+    __ASM_EMIT("movaps      %%xmm0, %%xmm4")            /* xmm4 = a0 a1 a2 a3 */ \
+    __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")            /* xmm0 = a0 b0 a1 b1 */ \
+    __ASM_EMIT("unpckhps    %%xmm1, %%xmm4")            /* xmm4 = a2 b2 a3 b3 */ \
+    __ASM_EMIT("movaps      %%xmm2, %%xmm1")            /* xmm1 = c0 c1 c2 c3 */ \
+    __ASM_EMIT("unpcklps    %%xmm3, %%xmm1")            /* xmm1 = c0 d0 c1 d1 */ \
+    __ASM_EMIT("unpckhps    %%xmm3, %%xmm2")            /* xmm2 = c2 d2 c3 d3 */ \
+    __ASM_EMIT("movaps      %%xmm0, %%xmm3")            /* xmm3 = a0 b0 a1 b1 */ \
+    __ASM_EMIT("movlhps     %%xmm1, %%xmm0")            /* xmm0 = a0 b0 c0 d0 */ \
+    __ASM_EMIT("movhlps     %%xmm3, %%xmm1")            /* xmm1 = a1 b1 c1 d1 */ \
+    __ASM_EMIT("movaps      %%xmm4, %%xmm3")            /* xmm3 = a2 b2 a3 b3 */ \
+    __ASM_EMIT("movlhps     %%xmm2, %%xmm4")            /* xmm4 = a2 b2 c2 d2 */ \
+    __ASM_EMIT("movhlps     %%xmm3, %%xmm2")            /* xmm2 = a3 b3 c3 d3 */ \
+    __ASM_EMIT("movaps      %%xmm2, %%xmm3")            /* xmm3 = a3 b3 c3 d3 */ \
+    __ASM_EMIT("movaps      %%xmm4, %%xmm2")            /* xmm2 = a2 b2 c2 d2 */
+
+// Perform one step of the envelope follower for the detector in register x
+#define DYN_STEP(x) \
+    __ASM_EMIT("movaps      %%" x ", %%xmm4")           /* xmm4 = x */ \
+    __ASM_EMIT("subps       %%xmm7, %%xmm4")            /* xmm4 = d = x - e */ \
+    __ASM_EMIT("cmpnleps    %%xmm7, %%" x)              /* x    = [x > e] */ \
+    __ASM_EMIT("andps       %%xmm6, %%" x)              /* x    = [x > e] & (A - R) */ \
+    __ASM_EMIT("addps       %%xmm5, %%" x)              /* x    = k = [x > e] ? A : R */ \
+    __ASM_EMIT("mulps       %%xmm4, %%" x)              /* x    = k*d */ \
+    __ASM_EMIT("addps       %%" x ", %%xmm7")           /* xmm7 = e' = e + k*d */ \
+    __ASM_EMIT("movaps      %%xmm7, %%" x)              /* x    = e' */
+
+#define DYN_PEAK_PRE(x) \
+    __ASM_EMIT("andps       %[X_ABS], %%" x)            /* x    = |x| */
+
+#define DYN_RMS_PRE(x) \
+    __ASM_EMIT("mulps       %%" x ", %%" x)             /* x    = x*x */
+
+#define DYN_PEAK_POST(x)
+
+#define DYN_RMS_POST(x) \
+    __ASM_EMIT("sqrtps      %%" x ", %%" x)             /* x    = sqrt(e) */
+
+#define DYN_ENVELOPE_KERNEL(PRE, POST) \
+    ARCH_X86_ASM( \
+        __ASM_EMIT("movaps      0x00(%[P]), %%xmm5")    /* xmm5 = R */ \
+        __ASM_EMIT("movaps      0x10(%[P]), %%xmm6")    /* xmm6 = A - R */ \
+        __ASM_EMIT("movaps      0x20(%[P]), %%xmm7")    /* xmm7 = e */ \
+        __ASM_EMIT("xor         %[off], %[off]") \
+        __ASM_EMIT("sub         $4, %[count]") \
+        __ASM_EMIT("jb          2f") \
+        /* 4x blocks */ \
+        __ASM_EMIT("1:") \
+        DYN_LOAD4(DYN_PTR0, "xmm0") \
+        DYN_LOAD4(DYN_PTR1, "xmm1") \
+        DYN_LOAD4(DYN_PTR2, "xmm2") \
+        DYN_LOAD4(DYN_PTR3, "xmm3") \
+        PRE("xmm0") \
+        PRE("xmm1") \
+        PRE("xmm2") \
+        PRE("xmm3") \
+        DYN_TRANSPOSE \
+        DYN_STEP("xmm0") \
+        DYN_STEP("xmm1") \
+        DYN_STEP("xmm2") \
+        DYN_STEP("xmm3") \
+        DYN_TRANSPOSE \
+        POST("xmm0") \
+        POST("xmm1") \
+        POST("xmm2") \
+        POST("xmm3") \
+        DYN_STORE4(DYN_PTR0, "xmm0") \
+        DYN_STORE4(DYN_PTR1, "xmm1") \
+        DYN_STORE4(DYN_PTR2, "xmm2") \
+        DYN_STORE4(DYN_PTR3, "xmm3") \
+        __ASM_EMIT("add         $0x10, %[off]") \
+        __ASM_EMIT("sub         $4, %[count]") \
+        __ASM_EMIT("jae         1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("add         $3, %[count]") \
+        __ASM_EMIT("jl          4f") \
+        __ASM_EMIT("3:") \
+        __ASM_EMIT("mov         " DYN_PTR0 "(%[src]), %[ptr]") \
+        __ASM_EMIT("movss       (%[ptr], %[off]), %%xmm0")      /* xmm0 = a 0 0 0 */ \
+        __ASM_EMIT("mov         " DYN_PTR1 "(%[src]), %[ptr]") \
+        __ASM_EMIT("movss       (%[ptr], %[off]), %%xmm1")      /* xmm1 = b 0 0 0 */ \
+        __ASM_EMIT("mov         " DYN_PTR2 "(%[src]), %[ptr]") \
+        __ASM_EMIT("movss       (%[ptr], %[off]), %%xmm2")      /* xmm2 = c 0 0 0 */ \
+        __ASM_EMIT("mov         " DYN_PTR3 "(%[src]), %[ptr]") \
+        __ASM_EMIT("movss       (%[ptr], %[off]), %%xmm3")      /* xmm3 = d 0 0 0 */ \
+        __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                /* xmm0 = a b 0 0 */ \
+        __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                /* xmm2 = c d 0 0 */ \
+        __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                /* xmm0 = a b c d */ \
+        PRE("xmm0") \
+        DYN_STEP("xmm0") \
+        POST("xmm0") \
+        __ASM_EMIT("mov         " DYN_PTR0 "(%[dst]), %[ptr]") \
+        __ASM_EMIT("movss       %%xmm0, (%[ptr], %[off])") \
+        __ASM_EMIT("shufps      $0x39, %%xmm0, %%xmm0")         /* xmm0 = b c d a */ \
+        __ASM_EMIT("mov         " DYN_PTR1 "(%[dst]), %[ptr]") \
+        __ASM_EMIT("movss       %%xmm0, (%[ptr], %[off])") \
+        __ASM_EMIT("shufps      $0x39, %%xmm0, %%xmm0")         /* xmm0 = c d a b */ \
+        __ASM_EMIT("mov         " DYN_PTR2 "(%[dst]), %[ptr]") \
+        __ASM_EMIT("movss       %%xmm0, (%[ptr], %[off])") \
+        __ASM_EMIT("shufps      $0x39, %%xmm0, %%xmm0")         /* xmm0 = d a b c */ \
+        __ASM_EMIT("mov         " DYN_PTR3 "(%[dst]), %[ptr]") \
+        __ASM_EMIT("movss       %%xmm0, (%[ptr], %[off])") \
+        __ASM_EMIT("add         $0x04, %[off]") \
+        __ASM_EMIT("dec         %[count]") \
+        __ASM_EMIT("jge         3b") \
+        __ASM_EMIT("4:") \
+        __ASM_EMIT("movaps      %%xmm7, 0x20(%[P])")    /* e = xmm7 */ \
+        : [count] "+r" (k), \
+          [ptr] "=&r" (ptr), [off] "=&r" (off) \
+        : [src] "r" (&s[0]), [dst] "r" (&d[0]), \
+          [P] "r" (&p[0]), \
+          [X_ABS] "m" (dyn_abs) \
+        : "cc", "memory", \
+          "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+          "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+    )
+
+namespace lsp
+{
+    namespace sse
+    {
+        IF_ARCH_X86(
+            static const uint32_t dyn_abs[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0x7fffffff)
+            };
+        )
+
+        /**
+         * Prepare the group of up to 4 channels for the parallel processing. Missing
+         * channels are substituted by the first channel of the group, so they produce
+         * the same values as the first channel.
+         * @param p parameters to initialize, 3 vectors
+         * @param d destination pointers to initialize
+         * @param s source pointers to initialize
+         * @param dst destination buffers of the group
+         * @param src source buffers of the group
+         * @param env envelope states of the group
+         * @param n number of channels in the group, 2..4
+         */
+        static inline void envelope_group_init(float *p, float **d, const float **s,
+            float **dst, const float **src, const dsp::envelope_t *env, size_t n)
+        {
+            for (size_t i=0; i<4; ++i)
+            {
+                size_t j        = (i < n) ? i : 0;
+                d[i]            = dst[j];
+                s[i]            = src[j];
+                p[i]            = env[j].release;
+                p[i + 4]        = env[j].attack - env[j].release;
+                p[i + 8]        = env[j].env;
+            }
+        }
+
+        void envelope_peak_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count)
+        {
+            float p[3*4] __lsp_aligned16;
+            float *d[4];
+            const float *s[4];
+            IF_ARCH_X86(size_t ptr, off);
+
+            for (size_t i=0; i<channels; i += 4)
+            {
+                size_t n        = channels - i;
+                if (n <= 1)
+                {
+                    dsp::envelope_peak(dst[i], src[i], &env[i], count);
+                    break;
+                }
+                else if (n > 4)
+                    n               = 4;
+
+                envelope_group_init(p, d, s, &dst[i], &src[i], &env[i], n);
+                size_t k        = count;
+                DYN_ENVELOPE_KERNEL(DYN_PEAK_PRE, DYN_PEAK_POST);
+                for (size_t j=0; j<n; ++j)
+                    env[i + j].env  = p[j + 8];
+            }
+        }
+
+        void envelope_rms_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count)
+        {
+            float p[3*4] __lsp_aligned16;
+            float *d[4];
+            const float *s[4];
+            IF_ARCH_X86(size_t ptr, off);
+
+            for (size_t i=0; i<channels; i += 4)
+            {
+                size_t n        = channels - i;
+                if (n <= 1)
+                {
+                    dsp::envelope_rms(dst[i], src[i], &env[i], count);
+                    break;
+                }
+                else if (n > 4)
+                    n               = 4;
+
+                envelope_group_init(p, d, s, &dst[i], &src[i], &env[i], n);
+                size_t k        = count;
+                DYN_ENVELOPE_KERNEL(DYN_RMS_PRE, DYN_RMS_POST);
+                for (size_t j=0; j<n; ++j)
+                    env[i + j].env  = p[j + 8];
+            }
+        }
+    }
+}
+
+#undef DYN_ENVELOPE_KERNEL
+#undef DYN_RMS_POST
+#undef DYN_PEAK_POST
+#undef DYN_RMS_PRE
+#undef DYN_PEAK_PRE
+#undef DYN_STEP
+#undef DYN_TRANSPOSE
+#undef DYN_PTR3
+#undef DYN_PTR2
+#undef DYN_PTR1
+#undef DYN_PTR0
+#undef DYN_STORE4
+#undef DYN_LOAD4
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_DYNAMICS_H_ */
@@ -31,6 +31,7 @@
 #include <private/dsp/arch/x86/sse/fastconv/apply.h>
 #include <private/dsp/arch/x86/sse/fastconv/irestore.h>
 #include <private/dsp/arch/x86/sse/fastconv/restore.h>
+#include <private/dsp/arch/x86/sse/fastconv/fmadd.h>
 
 namespace lsp
 {
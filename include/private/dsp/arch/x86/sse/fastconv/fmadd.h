@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_FASTCONV_FMADD_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_FASTCONV_FMADD_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+namespace lsp
+{
+    namespace sse
+    {
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t blocks   = size_t(1) << (rank - 2);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      0x00(%[c1]), %%xmm0")       /* xmm0 = ar */
+                __ASM_EMIT("movups      0x10(%[c1]), %%xmm1")       /* xmm1 = ai */
+                __ASM_EMIT("movups      0x00(%[c2]), %%xmm2")       /* xmm2 = br */
+                __ASM_EMIT("movups      0x10(%[c2]), %%xmm3")       /* xmm3 = bi */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")            /* xmm4 = ar */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")            /* xmm5 = ai */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm0")            /* xmm0 = ar*br */
+                __ASM_EMIT("mulps       %%xmm3, %%xmm1")            /* xmm1 = ai*bi */
+                __ASM_EMIT("mulps       %%xmm3, %%xmm4")            /* xmm4 = ar*bi */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm5")            /* xmm5 = ai*br */
+                __ASM_EMIT("movups      0x00(%[dst]), %%xmm6")      /* xmm6 = dr */
+                __ASM_EMIT("movups      0x10(%[dst]), %%xmm7")      /* xmm7 = di */
+                __ASM_EMIT("subps       %%xmm1, %%xmm0")            /* xmm0 = ar*br - ai*bi */
+                __ASM_EMIT("addps       %%xmm5, %%xmm4")            /* xmm4 = ar*bi + ai*br */
+                __ASM_EMIT("addps       %%xmm0, %%xmm6")            /* xmm6 = dr + ar*br - ai*bi */
+                __ASM_EMIT("addps       %%xmm4, %%xmm7")            /* xmm7 = di + ar*bi + ai*br */
+                __ASM_EMIT("movups      %%xmm6, 0x00(%[dst])")
+                __ASM_EMIT("movups      %%xmm7, 0x10(%[dst])")
+                __ASM_EMIT("add         $0x20, %[c1]")
+                __ASM_EMIT("add         $0x20, %[c2]")
+                __ASM_EMIT("add         $0x20, %[dst]")
+                __ASM_EMIT("dec         %[blocks]")
+                __ASM_EMIT("jnz         1b")
+
+                : [dst] "+r" (dst), [c1] "+r" (c1), [c2] "+r" (c2),
+                  [blocks] "+r" (blocks)
+                :
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_FASTCONV_FMADD_H_ */
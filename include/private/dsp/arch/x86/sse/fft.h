@@ -26,6 +26,7 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
 
+#include <private/dsp/fft.h>
 #include <private/dsp/arch/x86/sse/fft/const.h>
 #include <private/dsp/arch/x86/sse/fft/butterfly.h>
 #include <private/dsp/arch/x86/sse/fft/p_butterfly.h>
@@ -92,15 +93,15 @@ namespace lsp
             {
                 if (rank == 2)
                 {
-                    float s0_re     = src_re[0] + src_re[1];
-                    float s1_re     = src_re[0] - src_re[1];
-                    float s2_re     = src_re[2] + src_re[3];
-                    float s3_re     = src_re[2] - src_re[3];
+                    float s0_re     = src_re[0] + src_re[2];
+                    float s1_re     = src_re[0] - src_re[2];
+                    float s2_re     = src_re[1] + src_re[3];
+                    float s3_re     = src_re[1] - src_re[3];
 
-                    float s0_im     = src_im[0] + src_im[1];
-                    float s1_im     = src_im[0] - src_im[1];
-                    float s2_im     = src_im[2] + src_im[3];
-                    float s3_im     = src_im[2] - src_im[3];
+                    float s0_im     = src_im[0] + src_im[2];
+                    float s1_im     = src_im[0] - src_im[2];
+                    float s2_im     = src_im[1] + src_im[3];
+                    float s3_im     = src_im[1] - src_im[3];
 
                     dst_re[0]       = s0_re + s2_re;
                     dst_re[1]       = s1_re + s3_im;
@@ -144,15 +145,15 @@ namespace lsp
             {
                 if (rank == 2)
                 {
-                    float s0_re     = dst[0] + dst[2];
-                    float s1_re     = dst[0] - dst[2];
-                    float s0_im     = dst[1] + dst[3];
-                    float s1_im     = dst[1] - dst[3];
+                    float s0_re     = src[0] + src[4];
+                    float s1_re     = src[0] - src[4];
+                    float s0_im     = src[1] + src[5];
+                    float s1_im     = src[1] - src[5];
 
-                    float s2_re     = dst[4] + dst[6];
-                    float s3_re     = dst[4] - dst[6];
-                    float s2_im     = dst[5] + dst[7];
-                    float s3_im     = dst[5] - dst[7];
+                    float s2_re     = src[2] + src[6];
+                    float s3_re     = src[2] - src[6];
+                    float s2_im     = src[3] + src[7];
+                    float s3_im     = src[3] - src[7];
 
                     dst[0]          = s0_re + s2_re;
                     dst[1]          = s0_im + s2_im;
@@ -199,15 +200,15 @@ namespace lsp
             {
                 if (rank == 2)
                 {
-                    float s0_re     = src_re[0] + src_re[1];
-                    float s1_re     = src_re[0] - src_re[1];
-                    float s2_re     = src_re[2] + src_re[3];
-                    float s3_re     = src_re[2] - src_re[3];
+                    float s0_re     = src_re[0] + src_re[2];
+                    float s1_re     = src_re[0] - src_re[2];
+                    float s2_re     = src_re[1] + src_re[3];
+                    float s3_re     = src_re[1] - src_re[3];
 
-                    float s0_im     = src_im[0] + src_im[1];
-                    float s1_im     = src_im[0] - src_im[1];
-                    float s2_im     = src_im[2] + src_im[3];
-                    float s3_im     = src_im[2] - src_im[3];
+                    float s0_im     = src_im[0] + src_im[2];
+                    float s1_im     = src_im[0] - src_im[2];
+                    float s2_im     = src_im[1] + src_im[3];
+                    float s3_im     = src_im[1] - src_im[3];
 
                     dst_re[0]       = (s0_re + s2_re)*0.25f;
                     dst_re[1]       = (s1_re - s3_im)*0.25f;
@@ -254,15 +255,15 @@ namespace lsp
             {
                 if (rank == 2)
                 {
-                    float s0_re     = src[0] + src[2];
-                    float s1_re     = src[0] - src[2];
-                    float s2_re     = src[4] + src[6];
-                    float s3_re     = src[4] - src[6];
+                    float s0_re     = src[0] + src[4];
+                    float s1_re     = src[0] - src[4];
+                    float s2_re     = src[2] + src[6];
+                    float s3_re     = src[2] - src[6];
 
-                    float s0_im     = src[1] + src[3];
-                    float s1_im     = src[1] - src[3];
-                    float s2_im     = src[5] + src[7];
-                    float s3_im     = src[5] - src[7];
+                    float s0_im     = src[1] + src[5];
+                    float s1_im     = src[1] - src[5];
+                    float s2_im     = src[3] + src[7];
+                    float s3_im     = src[3] - src[7];
 
                     dst[0]          = (s0_re + s2_re)*0.25f;
                     dst[1]          = (s0_im + s2_im)*0.25f;
@@ -280,10 +281,10 @@ namespace lsp
                     // s1' = s0 - s1
                     float s1_re     = src[2];
                     float s1_im     = src[3];
-                    dst[2]          = src[0] - s1_re;
-                    dst[3]          = src[1] - s1_im;
-                    dst[0]          = src[0] + s1_re;
-                    dst[1]          = src[1] + s1_im;
+                    dst[2]          = (src[0] - s1_re) * 0.5f;
+                    dst[3]          = (src[1] - s1_im) * 0.5f;
+                    dst[0]          = (src[0] + s1_re) * 0.5f;
+                    dst[1]          = (src[1] + s1_im) * 0.5f;
                 }
                 else
                 {
@@ -301,6 +302,119 @@ namespace lsp
 
             packed_fft_repack_normalize(dst, rank);
         }
+
+        void direct_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    direct_fft(dst_re[i], dst_im[i], src_re[i], src_im[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    scramble_direct(dst_re[j], dst_im[j], src_re[j], src_im[j], rank);
+
+                for (size_t i=2; i < rank; ++i)
+                    butterfly_direct_batch(dst_re, dst_im, i, 1 << (rank - i - 1), n);
+
+                dst_re         += n;
+                dst_im         += n;
+                src_re         += n;
+                src_im         += n;
+                count          -= n;
+            }
+        }
+
+        void reverse_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    reverse_fft(dst_re[i], dst_im[i], src_re[i], src_im[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    scramble_reverse(dst_re[j], dst_im[j], src_re[j], src_im[j], rank);
+
+                for (size_t i=2; i < rank; ++i)
+                    butterfly_reverse_batch(dst_re, dst_im, i, 1 << (rank - i - 1), n);
+
+                for (size_t j=0; j<n; ++j)
+                    dsp::normalize_fft2(dst_re[j], dst_im[j], rank);
+
+                dst_re         += n;
+                dst_im         += n;
+                src_re         += n;
+                src_im         += n;
+                count          -= n;
+            }
+        }
+
+        void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    packed_direct_fft(dst[i], src[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    packed_scramble_direct(dst[j], src[j], rank);
+
+                for (size_t i=2; i < rank; ++i)
+                    packed_butterfly_direct_batch(dst, i, 1 << (rank - i - 1), n);
+
+                for (size_t j=0; j<n; ++j)
+                    packed_fft_repack(dst[j], rank);
+
+                dst            += n;
+                src            += n;
+                count          -= n;
+            }
+        }
+
+        void packed_reverse_fft_batch(float **dst, const float * const *src, size_t rank, size_t count)
+        {
+            if (rank <= 2)
+            {
+                for (size_t i=0; i<count; ++i)
+                    packed_reverse_fft(dst[i], src[i], rank);
+                return;
+            }
+
+            for (size_t group=FFT_BATCH_GROUP(rank); count > 0; )
+            {
+                size_t n        = (count > group) ? group : count;
+
+                for (size_t j=0; j<n; ++j)
+                    packed_scramble_reverse(dst[j], src[j], rank);
+
+                for (size_t i=2; i < rank; ++i)
+                    packed_butterfly_reverse_batch(dst, i, 1 << (rank - i - 1), n);
+
+                for (size_t j=0; j<n; ++j)
+                    packed_fft_repack_normalize(dst[j], rank);
+
+                dst            += n;
+                src            += n;
+                count          -= n;
+            }
+        }
     }
 }
 
@@ -350,10 +350,153 @@ namespace lsp
             }
         }
 
+        #define FFT_BATCH_BUTTERFLY_BODY(add_b, add_a) \
+            /* Init pointers */ \
+            float **v_re    = dst_re; \
+            float **v_im    = dst_im; \
+            size_t p        = pairs; \
+            size_t off      = 0; \
+            size_t j, k; \
+            float *a_re, *a_im; \
+            \
+            ARCH_X86_ASM \
+            ( \
+                /* Prepare angle */ \
+                __ASM_EMIT("mov         %[XFFT_A_RE], %[a_re]") \
+                __ASM_EMIT("mov         %[XFFT_A_IM], %[a_im]") \
+                __ASM_EMIT("movaps      (%[a_re]), %%xmm6")                     /* xmm6 = angle_re[0..3] */ \
+                __ASM_EMIT("movaps      (%[a_im]), %%xmm7")                     /* xmm7 = angle_im[0..3] */ \
+                /* Loop over groups of 4 pairs */ \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("mov         %[dst_re], %[a_re]") \
+                __ASM_EMIT("mov         %[dst_im], %[a_im]") \
+                __ASM_EMIT("mov         %[a_re], %[v_re]")                      /* v_re = dst_re */ \
+                __ASM_EMIT("mov         %[a_im], %[v_im]")                      /* v_im = dst_im */ \
+                __ASM_EMIT("mov         %[count], %[k]") \
+                __ASM_EMIT("mov         %[k], %[j]")                            /* j = count */ \
+                /* Loop over transforms */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("mov         %[v_re], %[a_re]") \
+                __ASM_EMIT("mov         %[v_im], %[a_im]") \
+                __ASM_EMIT("mov         (%[a_re]), %[a_re]")                    /* a_re = *v_re */ \
+                __ASM_EMIT("mov         (%[a_im]), %[a_im]")                    /* a_im = *v_im */ \
+                __ASM_EMIT("add         %[off], %[a_re]") \
+                __ASM_EMIT("add         %[off], %[a_im]") \
+                __ASM_EMIT("mov         %[blocks], %[k]") \
+                /* Loop over blocks */ \
+                __ASM_EMIT(".align 16") \
+                __ASM_EMIT("3:") \
+                /* Load complex values */ \
+                /* predicate: xmm6 = w_re[0..3] */ \
+                /* predicate: xmm7 = w_im[0..3] */ \
+                __ASM_EMIT("movups      (%[a_re]), %%xmm0")                     /* xmm0 = a_re[0..3] */ \
+                __ASM_EMIT("movups      (%[a_im]), %%xmm1")                     /* xmm1 = a_im[0..3] */ \
+                __ASM_EMIT("movups      (%[a_re], %[shift]), %%xmm2")           /* xmm2 = b_re[0..3] */ \
+                __ASM_EMIT("movups      (%[a_im], %[shift]), %%xmm3")           /* xmm3 = b_im[0..3] */ \
+                \
+                /* Calculate complex multiplication */ \
+                __ASM_EMIT("movaps      %%xmm2, %%xmm4") /* xmm4 = b_re[0..3] */ \
+                __ASM_EMIT("movaps      %%xmm3, %%xmm5") /* xmm5 = b_im[0..3] */ \
+                __ASM_EMIT("mulps       %%xmm6, %%xmm2") /* xmm2 = w_re[0..3] * b_re[0..3] */ \
+                __ASM_EMIT("mulps       %%xmm6, %%xmm3") /* xmm3 = w_re[0..3] * b_im[0..3] */ \
+                __ASM_EMIT("mulps       %%xmm7, %%xmm4") /* xmm4 = w_im[0..3] * b_re[0..3] */ \
+                __ASM_EMIT("mulps       %%xmm7, %%xmm5") /* xmm5 = w_im[0..3] * b_im[0..3] */ \
+                __ASM_EMIT(add_b "      %%xmm5, %%xmm2") /* xmm2 = c_re[0..3] = w_re[0..3] * b_re[0..3] +- w_im[0..3] * b_im[0..3] */ \
+                __ASM_EMIT(add_a "      %%xmm4, %%xmm3") /* xmm3 = c_im[0..3] = w_re[0..3] * b_im[0..3] -+ w_im[0..3] * b_re[0..3] */ \
+                \
+                /* Perform butterfly */ \
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4") /* xmm4 = a_re[0..3] */ \
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5") /* xmm5 = a_im[0..3] */ \
+                __ASM_EMIT("subps       %%xmm2, %%xmm0") /* xmm0 = a_re[0..3] - c_re[0..3] */ \
+                __ASM_EMIT("subps       %%xmm3, %%xmm1") /* xmm1 = a_im[0..3] - c_im[0..3] */ \
+                __ASM_EMIT("addps       %%xmm4, %%xmm2") /* xmm2 = a_re[0..3] + c_re[0..3] */ \
+                __ASM_EMIT("addps       %%xmm5, %%xmm3") /* xmm3 = a_im[0..3] + c_im[0..3] */ \
+                \
+                /* Store values */ \
+                __ASM_EMIT("movups      %%xmm2, (%[a_re])") \
+                __ASM_EMIT("movups      %%xmm3, (%[a_im])") \
+                __ASM_EMIT("movups      %%xmm0, (%[a_re], %[shift])") \
+                __ASM_EMIT("movups      %%xmm1, (%[a_im], %[shift])") \
+                /* Move to the next block */ \
+                __ASM_EMIT("add         %[stride], %[a_re]") \
+                __ASM_EMIT("add         %[stride], %[a_im]") \
+                __ASM_EMIT("dec         %[k]") \
+                __ASM_EMIT("jnz         3b") \
+                /* Move to the next transform */ \
+                __ASM_EMIT32("addl      $4, %[v_re]") \
+                __ASM_EMIT32("addl      $4, %[v_im]") \
+                __ASM_EMIT32("decl      %[j]") \
+                __ASM_EMIT64("addq      $8, %[v_re]") \
+                __ASM_EMIT64("addq      $8, %[v_im]") \
+                __ASM_EMIT64("decq      %[j]") \
+                __ASM_EMIT("jnz         2b") \
+                /* Move to the next group of pairs */ \
+                __ASM_EMIT32("addl      $0x10, %[off]") \
+                __ASM_EMIT32("subl      $4, %[p]") \
+                __ASM_EMIT64("addq      $0x10, %[off]") \
+                __ASM_EMIT64("subq      $4, %[p]") \
+                __ASM_EMIT("jz          4f") \
+                \
+                /* Rotate angle */ \
+                __ASM_EMIT("mov         %[XFFT_W_RE], %[a_re]") \
+                __ASM_EMIT("mov         %[XFFT_W_IM], %[a_im]") \
+                __ASM_EMIT("movaps      (%[a_im]), %%xmm1")                     /* xmm1 = w_im[0..3] */ \
+                __ASM_EMIT("movaps      (%[a_re]), %%xmm0")                     /* xmm0 = w_re[0..3] */ \
+                __ASM_EMIT("movaps      %%xmm1, %%xmm3")                        /* xmm3 = w_im[0..3] */ \
+                __ASM_EMIT("movaps      %%xmm0, %%xmm2")                        /* xmm2 = w_re[0..3] */ \
+                __ASM_EMIT("mulps       %%xmm6, %%xmm3")                        /* xmm3 = a_re[0..3] * w_im[0..3] */ \
+                __ASM_EMIT("mulps       %%xmm7, %%xmm1")                        /* xmm1 = a_im[0..3] * w_im[0..3] */ \
+                __ASM_EMIT("mulps       %%xmm0, %%xmm6")                        /* xmm6 = a_re[0..3] * w_re[0..3] */ \
+                __ASM_EMIT("mulps       %%xmm2, %%xmm7")                        /* xmm7 = a_im[0..3] * w_re[0..3] */ \
+                __ASM_EMIT("subps       %%xmm1, %%xmm6")                        /* xmm6 = a_re[0..3] * w_re[0..3] + a_im[0..3] * w_im[0..3] */ \
+                __ASM_EMIT("addps       %%xmm3, %%xmm7")                        /* xmm7 = a_im[0..3] * w_re[0..3] - a_re[0..3] * w_im[0..3] */ \
+                \
+                /* Repeat loop */ \
+                __ASM_EMIT("jmp         1b") \
+                __ASM_EMIT("4:") \
+                \
+                : [a_re] "=&r" (a_re), [a_im] "=&r" (a_im), [k] "=&r" (k), \
+                  [v_re] "+m" (v_re), [v_im] "+m" (v_im), [j] "=m" (j), \
+                  [off] "+m" (off), [p] "+m" (p) \
+                : [dst_re] "m" (dst_re), [dst_im] "m" (dst_im), \
+                  [count] "g" (count), [blocks] "g" (blocks), \
+                  [shift] "r" (shift), [stride] "g" (stride), \
+                  [XFFT_A_RE] "g" (&XFFT_A_RE[rank]), [XFFT_A_IM] "g" (&XFFT_A_IM[rank]), \
+                  [XFFT_W_RE] "g" (&XFFT_W_RE[rank]), [XFFT_W_IM] "g" (&XFFT_W_IM[rank]) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        /**
+         * Batch butterflies: each group of 4 angles is computed once and applied
+         * to all blocks of all transforms in the batch before it gets rotated
+         */
+        static inline void butterfly_direct_batch(float **dst_re, float **dst_im, size_t rank, size_t blocks, size_t count)
+        {
+            size_t pairs    = 1 << rank;
+            size_t shift    = pairs * sizeof(float);
+            size_t stride   = shift << 1;
+            rank            = (rank - 2) << 2;
+
+            FFT_BATCH_BUTTERFLY_BODY("addps", "subps");
+        }
+
+        static inline void butterfly_reverse_batch(float **dst_re, float **dst_im, size_t rank, size_t blocks, size_t count)
+        {
+            size_t pairs    = 1 << rank;
+            size_t shift    = pairs * sizeof(float);
+            size_t stride   = shift << 1;
+            rank            = (rank - 2) << 2;
+
+            FFT_BATCH_BUTTERFLY_BODY("subps", "addps");
+        }
+
 
         #undef FFT_ANGLE_INIT
         #undef FFT_ANGLE_ROTATE
         #undef FFT_BUTTERFLY_BODY
+        #undef FFT_BATCH_BUTTERFLY_BODY
 
     } /* namespace sse */
 } /* namespace lsp */
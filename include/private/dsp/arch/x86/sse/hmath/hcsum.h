@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_HMATH_HCSUM_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_HMATH_HCSUM_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+namespace lsp
+{
+    namespace sse
+    {
+        IF_ARCH_X86(
+            static const uint32_t hcsum_const[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0x7fffffff)
+            };
+        );
+
+        /* Kahan summation step for two accumulators:
+         *   xmm0, xmm1 = sums, xmm2, xmm3 = compensations, xmm4, xmm5 = terms
+         */
+        #define HCSUM_KAHAN_X2 \
+            __ASM_EMIT("subps       %%xmm2, %%xmm4")            /* xmm4 = y = x - c */ \
+            __ASM_EMIT("subps       %%xmm3, %%xmm5") \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm6")            /* xmm6 = s */ \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm7") \
+            __ASM_EMIT("addps       %%xmm4, %%xmm0")            /* xmm0 = t = s + y */ \
+            __ASM_EMIT("addps       %%xmm5, %%xmm1") \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm2") \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm3") \
+            __ASM_EMIT("subps       %%xmm6, %%xmm2")            /* xmm2 = t - s */ \
+            __ASM_EMIT("subps       %%xmm7, %%xmm3") \
+            __ASM_EMIT("subps       %%xmm4, %%xmm2")            /* xmm2 = c = (t - s) - y */ \
+            __ASM_EMIT("subps       %%xmm5, %%xmm3")
+
+        /* Kahan summation step for the first accumulator, xmm4 = terms */
+        #define HCSUM_KAHAN_X1 \
+            __ASM_EMIT("subps       %%xmm2, %%xmm4")            /* xmm4 = y = x - c */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm6")            /* xmm6 = s */ \
+            __ASM_EMIT("addps       %%xmm4, %%xmm0")            /* xmm0 = t = s + y */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm2") \
+            __ASM_EMIT("subps       %%xmm6, %%xmm2")            /* xmm2 = t - s */ \
+            __ASM_EMIT("subps       %%xmm4, %%xmm2")            /* xmm2 = c = (t - s) - y */
+
+        /* Term loaders: MOV = load instruction, OFF = offset, X = register for the term, T = temporary register.
+         * Scalar loads zero the upper lanes, so the 1x block may reuse the packed Kahan step
+         */
+        #define HCSUM_SUM(MOV, OFF, X, T) \
+            __ASM_EMIT(MOV OFF "(%[src], %[off]), %%xmm" X)
+        #define HCSUM_SQR(MOV, OFF, X, T) \
+            __ASM_EMIT(MOV OFF "(%[src], %[off]), %%xmm" X) \
+            __ASM_EMIT("mulps       %%xmm" X ", %%xmm" X)
+        #define HCSUM_ABS(MOV, OFF, X, T) \
+            __ASM_EMIT(MOV OFF "(%[src], %[off]), %%xmm" X) \
+            __ASM_EMIT("andps       %[X_SIGN], %%xmm" X)
+        #define HCSUM_DOTP(MOV, OFF, X, T) \
+            __ASM_EMIT(MOV OFF "(%[a], %[off]), %%xmm" X) \
+            __ASM_EMIT(MOV OFF "(%[b], %[off]), %%xmm" T) \
+            __ASM_EMIT("mulps       %%xmm" T ", %%xmm" X)
+
+        #define HCSUM_CORE(OP) \
+            __ASM_EMIT("xorps       %%xmm0, %%xmm0") \
+            __ASM_EMIT("xorps       %%xmm1, %%xmm1") \
+            __ASM_EMIT("xorps       %%xmm2, %%xmm2") \
+            __ASM_EMIT("xorps       %%xmm3, %%xmm3") \
+            __ASM_EMIT("xor         %[off], %[off]") \
+            __ASM_EMIT("sub         $8, %[count]") \
+            __ASM_EMIT("jb          2f") \
+            /* x8 blocks */ \
+            __ASM_EMIT("1:") \
+            OP("movups      ", "0x00", "4", "6") \
+            OP("movups      ", "0x10", "5", "7") \
+            HCSUM_KAHAN_X2 \
+            __ASM_EMIT("add         $0x20, %[off]") \
+            __ASM_EMIT("sub         $8, %[count]") \
+            __ASM_EMIT("jae         1b") \
+            /* x4 block */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add         $4, %[count]") \
+            __ASM_EMIT("jl          4f") \
+            OP("movups      ", "0x00", "4", "6") \
+            HCSUM_KAHAN_X1 \
+            __ASM_EMIT("add         $0x10, %[off]") \
+            __ASM_EMIT("sub         $4, %[count]") \
+            /* x1 blocks */ \
+            __ASM_EMIT("4:") \
+            __ASM_EMIT("add         $3, %[count]") \
+            __ASM_EMIT("jl          6f") \
+            __ASM_EMIT("5:") \
+            OP("movss       ", "0x00", "4", "6") \
+            HCSUM_KAHAN_X1 \
+            __ASM_EMIT("add         $0x04, %[off]") \
+            __ASM_EMIT("dec         %[count]") \
+            __ASM_EMIT("jge         5b") \
+            /* merge lanes */ \
+            __ASM_EMIT("6:") \
+            __ASM_EMIT("subps       %%xmm2, %%xmm0")            /* xmm0 = s - c */ \
+            __ASM_EMIT("subps       %%xmm3, %%xmm1") \
+            __ASM_EMIT("addps       %%xmm1, %%xmm0") \
+            __ASM_EMIT("movhlps     %%xmm0, %%xmm1") \
+            __ASM_EMIT("addps       %%xmm1, %%xmm0") \
+            __ASM_EMIT("unpcklps    %%xmm1, %%xmm0") \
+            __ASM_EMIT("movhlps     %%xmm0, %%xmm1") \
+            __ASM_EMIT("addss       %%xmm1, %%xmm0")
+
+        float h_csum(const float *src, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                HCSUM_CORE(HCSUM_SUM)
+                : [count] "+r" (count), [off] "=&r" (off),
+                  "=Yz" (result)
+                : [src] "r" (src)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+
+        float h_sqr_csum(const float *src, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                HCSUM_CORE(HCSUM_SQR)
+                : [count] "+r" (count), [off] "=&r" (off),
+                  "=Yz" (result)
+                : [src] "r" (src)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+
+        float h_abs_csum(const float *src, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                HCSUM_CORE(HCSUM_ABS)
+                : [count] "+r" (count), [off] "=&r" (off),
+                  "=Yz" (result)
+                : [src] "r" (src),
+                  [X_SIGN] "m" (hcsum_const)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+
+        float h_cdotp(const float *a, const float *b, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                HCSUM_CORE(HCSUM_DOTP)
+                : [count] "+r" (count), [off] "=&r" (off),
+                  "=Yz" (result)
+                : [a] "r" (a), [b] "r" (b)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+
+        #undef HCSUM_CORE
+        #undef HCSUM_DOTP
+        #undef HCSUM_ABS
+        #undef HCSUM_SQR
+        #undef HCSUM_SUM
+        #undef HCSUM_KAHAN_X1
+        #undef HCSUM_KAHAN_X2
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_HMATH_HCSUM_H_ */
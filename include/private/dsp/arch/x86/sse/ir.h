@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IR_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_IR_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+namespace lsp
+{
+    namespace sse
+    {
+        void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length)
+        {
+            const ssize_t hw    = LSP_DSP_IR_POINTS / 2;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                const dsp::ir_tap_t *t  = &taps[i];
+
+                // Skip taps that do not touch the buffer
+                float p         = t->position;
+                if (!((p > float(-hw)) && (p < float(length + hw - 1))))
+                    continue;
+
+                // Compute the table row and the interpolation factor
+                ssize_t k       = floorf(p);
+                float u         = (p - k) * LSP_DSP_IR_PHASES;
+                ssize_t ph      = u;
+                if (ph >= LSP_DSP_IR_PHASES)
+                    ph              = LSP_DSP_IR_PHASES - 1;
+                float f         = u - ph;
+                const float *c  = &kernel[ph * LSP_DSP_IR_POINTS * 2];
+                ssize_t first   = k - (hw - 1);
+                float *d        = &dst[first];
+
+                if ((first >= 0) && (first + LSP_DSP_IR_POINTS <= ssize_t(length)))
+                {
+                    // The kernel is completely inside the buffer
+                    float s[2]      = { t->gain, t->gain * f };
+
+                    ARCH_X86_ASM
+                    (
+                        __ASM_EMIT("movss       0x00(%[s]), %%xmm0")            /* xmm0 = g */
+                        __ASM_EMIT("movss       0x04(%[s]), %%xmm1")            /* xmm1 = g*f */
+                        __ASM_EMIT("shufps      $0x00, %%xmm0, %%xmm0")
+                        __ASM_EMIT("shufps      $0x00, %%xmm1, %%xmm1")
+                        __ASM_EMIT("movups      0x00(%[c]), %%xmm2")            /* xmm2 = t0 t1 t2 t3 */
+                        __ASM_EMIT("movups      0x10(%[c]), %%xmm3")            /* xmm3 = t4 t5 t6 t7 */
+                        __ASM_EMIT("movups      0x20(%[c]), %%xmm4")            /* xmm4 = d0 d1 d2 d3 */
+                        __ASM_EMIT("movups      0x30(%[c]), %%xmm5")            /* xmm5 = d4 d5 d6 d7 */
+                        __ASM_EMIT("mulps       %%xmm0, %%xmm2")                /* xmm2 = g*t */
+                        __ASM_EMIT("mulps       %%xmm0, %%xmm3")
+                        __ASM_EMIT("mulps       %%xmm1, %%xmm4")                /* xmm4 = g*f*d */
+                        __ASM_EMIT("mulps       %%xmm1, %%xmm5")
+                        __ASM_EMIT("movups      0x00(%[d]), %%xmm0")            /* xmm0 = x0 x1 x2 x3 */
+                        __ASM_EMIT("movups      0x10(%[d]), %%xmm1")            /* xmm1 = x4 x5 x6 x7 */
+                        __ASM_EMIT("addps       %%xmm4, %%xmm2")                /* xmm2 = g*(t + f*d) */
+                        __ASM_EMIT("addps       %%xmm5, %%xmm3")
+                        __ASM_EMIT("addps       %%xmm2, %%xmm0")                /* xmm0 = x + g*(t + f*d) */
+                        __ASM_EMIT("addps       %%xmm3, %%xmm1")
+                        __ASM_EMIT("movups      %%xmm0, 0x00(%[d])")
+                        __ASM_EMIT("movups      %%xmm1, 0x10(%[d])")
+                        :
+                        : [c] "r" (c), [d] "r" (d), [s] "r" (&s[0])
+                        : "memory",
+                          "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                          "%xmm4", "%xmm5"
+                    );
+                }
+                else
+                {
+                    // Clip the kernel at the edges of the buffer
+                    size_t j        = (first < 0) ? -first : 0;
+                    size_t last     = (first + LSP_DSP_IR_POINTS > ssize_t(length)) ? length - first : LSP_DSP_IR_POINTS;
+                    for (; j < last; ++j)
+                        d[j]           += t->gain * (c[j] + c[j + LSP_DSP_IR_POINTS] * f);
+                }
+            }
+        }
+    } /* namespace sse */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IR_H_ */
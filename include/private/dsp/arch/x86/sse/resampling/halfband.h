@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_RESAMPLING_HALFBAND_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_RESAMPLING_HALFBAND_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+/*
+    All 8 allpass sections are processed at once in a pipeline mode: the
+    section pair k (lanes 2*k, 2*k+1) processes the sample that was passed
+    to the input k steps ago. The pipeline is filled and flushed by mask
+    the same way as it is done for biquad filter banks, so there is no
+    additional latency introduced.
+
+    Register allocation:
+      xmm0, xmm4    = section inputs  X
+      xmm1, xmm5    = section outputs T
+      xmm2, xmm3    = input memory    x[]
+      xmm6, xmm7    = output memory   y[]
+ */
+
+// Compute all sections, input samples should be in xmm0 lanes 0, 1
+#define HALFBAND_SSE_CALC \
+    __ASM_EMIT("movaps      %%xmm6, %%xmm4")                /* xmm4     = y0 y1 y2 y3 */ \
+    __ASM_EMIT("movlhps     %%xmm6, %%xmm0")                /* xmm0     = s0 s1 y0 y1 = X0 */ \
+    __ASM_EMIT("shufps      $0x4e, %%xmm7, %%xmm4")         /* xmm4     = y2 y3 y4 y5 = X1 */ \
+    __ASM_EMIT("movaps      %%xmm0, %%xmm1")                /* xmm1     = X0 */ \
+    __ASM_EMIT("movaps      %%xmm4, %%xmm5")                /* xmm5     = X1 */ \
+    __ASM_EMIT("subps       %%xmm6, %%xmm1")                /* xmm1     = X0 - Y0 */ \
+    __ASM_EMIT("subps       %%xmm7, %%xmm5")                /* xmm5     = X1 - Y1 */ \
+    __ASM_EMIT("mulps       0x40(%[f]), %%xmm1")            /* xmm1     = (X0 - Y0)*A0 */ \
+    __ASM_EMIT("mulps       0x50(%[f]), %%xmm5")            /* xmm5     = (X1 - Y1)*A1 */ \
+    __ASM_EMIT("addps       %%xmm2, %%xmm1")                /* xmm1     = (X0 - Y0)*A0 + XM0 = T0 */ \
+    __ASM_EMIT("addps       %%xmm3, %%xmm5")                /* xmm5     = (X1 - Y1)*A1 + XM1 = T1 */
+
+// Update memory of all sections
+#define HALFBAND_SSE_UPDATE \
+    __ASM_EMIT("movaps      %%xmm0, %%xmm2")                /* xmm2     = XM0' = X0 */ \
+    __ASM_EMIT("movaps      %%xmm4, %%xmm3")                /* xmm3     = XM1' = X1 */ \
+    __ASM_EMIT("movaps      %%xmm1, %%xmm6")                /* xmm6     = Y0' = T0 */ \
+    __ASM_EMIT("movaps      %%xmm5, %%xmm7")                /* xmm7     = Y1' = T1 */
+
+// Update memory of sections enabled by mask
+#define HALFBAND_SSE_UPDATE_MASKED \
+    __ASM_EMIT("xorps       %%xmm6, %%xmm1")                /* xmm1     = T0 ^ Y0 */ \
+    __ASM_EMIT("xorps       %%xmm7, %%xmm5")                /* xmm5     = T1 ^ Y1 */ \
+    __ASM_EMIT("xorps       %%xmm2, %%xmm0")                /* xmm0     = X0 ^ XM0 */ \
+    __ASM_EMIT("xorps       %%xmm3, %%xmm4")                /* xmm4     = X1 ^ XM1 */ \
+    __ASM_EMIT("andps       %[MASK0], %%xmm1")              /* xmm1     = (T0 ^ Y0) & M0 */ \
+    __ASM_EMIT("andps       %[MASK1], %%xmm5")              /* xmm5     = (T1 ^ Y1) & M1 */ \
+    __ASM_EMIT("andps       %[MASK0], %%xmm0")              /* xmm0     = (X0 ^ XM0) & M0 */ \
+    __ASM_EMIT("andps       %[MASK1], %%xmm4")              /* xmm4     = (X1 ^ XM1) & M1 */ \
+    __ASM_EMIT("xorps       %%xmm1, %%xmm6")                /* xmm6     = Y0' = (T0 & M0) | (Y0 & ~M0) */ \
+    __ASM_EMIT("xorps       %%xmm5, %%xmm7")                /* xmm7     = Y1' = (T1 & M1) | (Y1 & ~M1) */ \
+    __ASM_EMIT("xorps       %%xmm0, %%xmm2")                /* xmm2     = XM0' = (X0 & M0) | (XM0 & ~M0) */ \
+    __ASM_EMIT("xorps       %%xmm4, %%xmm3")                /* xmm3     = XM1' = (X1 & M1) | (XM1 & ~M1) */
+
+// Shift the mask by one section, xmm0 lanes 0, 1 should contain the new section mask
+#define HALFBAND_SSE_SHIFT_MASK \
+    __ASM_EMIT("movaps      %[MASK0], %%xmm1")              /* xmm1     = m0 m1 m2 m3 */ \
+    __ASM_EMIT("movaps      %%xmm1, %%xmm5")                /* xmm5     = m0 m1 m2 m3 */ \
+    __ASM_EMIT("movlhps     %%xmm1, %%xmm0")                /* xmm0     = n n m0 m1 */ \
+    __ASM_EMIT("shufps      $0x4e, %[MASK1], %%xmm5")       /* xmm5     = m2 m3 m4 m5 */ \
+    __ASM_EMIT("movaps      %%xmm0, %[MASK0]") \
+    __ASM_EMIT("movaps      %%xmm5, %[MASK1]")
+
+#define HALFBAND_SSE_PROCESS(LOAD, STORE) \
+    __ASM_EMIT("test        %[count], %[count]") \
+    __ASM_EMIT("jz          8f") \
+    \
+    /* Initialize mask */ \
+    __ASM_EMIT("mov         $1, %[mask]") \
+    __ASM_EMIT("movaps      %[X_MASK], %%xmm0")             /* xmm0     = -1 -1 0 0 */ \
+    __ASM_EMIT("xorps       %%xmm1, %%xmm1")                /* xmm1     = 0 */ \
+    __ASM_EMIT("movaps      %%xmm0, %[MASK0]") \
+    __ASM_EMIT("movaps      %%xmm1, %[MASK1]") \
+    \
+    /* Load filter memory */ \
+    __ASM_EMIT("movaps      0x00(%[f]), %%xmm2")            /* xmm2     = XM0 */ \
+    __ASM_EMIT("movaps      0x10(%[f]), %%xmm3")            /* xmm3     = XM1 */ \
+    __ASM_EMIT("movaps      0x20(%[f]), %%xmm6")            /* xmm6     = Y0 */ \
+    __ASM_EMIT("movaps      0x30(%[f]), %%xmm7")            /* xmm7     = Y1 */ \
+    \
+    /* Fill the pipeline */ \
+    __ASM_EMIT(".align 16") \
+    __ASM_EMIT("1:") \
+    LOAD \
+    HALFBAND_SSE_CALC \
+    HALFBAND_SSE_UPDATE_MASKED \
+    __ASM_EMIT("dec         %[count]") \
+    __ASM_EMIT("jz          4f")                            /* jump to completion */ \
+    __ASM_EMIT("lea         0x01(,%[mask], 2), %[mask]")    /* mask     = (mask << 1) | 1 */ \
+    __ASM_EMIT("movaps      %[X_MASK], %%xmm0")             /* xmm0     = -1 -1 0 0 */ \
+    HALFBAND_SSE_SHIFT_MASK \
+    __ASM_EMIT("cmp         $0x0f, %[mask]") \
+    __ASM_EMIT("jne         1b") \
+    \
+    /* Process without mask */ \
+    __ASM_EMIT(".align 16") \
+    __ASM_EMIT("3:") \
+    LOAD \
+    HALFBAND_SSE_CALC \
+    HALFBAND_SSE_UPDATE \
+    STORE \
+    __ASM_EMIT("dec         %[count]") \
+    __ASM_EMIT("jnz         3b") \
+    \
+    /* Flush the pipeline */ \
+    __ASM_EMIT("4:") \
+    __ASM_EMIT("shl         $1, %[mask]")                   /* mask     = mask << 1 */ \
+    __ASM_EMIT("xorps       %%xmm0, %%xmm0")                /* xmm0     = 0 */ \
+    __ASM_EMIT("and         $0x0f, %[mask]")                /* mask     = (mask << 1) & 0x0f */ \
+    HALFBAND_SSE_SHIFT_MASK \
+    \
+    __ASM_EMIT(".align 16") \
+    __ASM_EMIT("5:") \
+    HALFBAND_SSE_CALC \
+    HALFBAND_SSE_UPDATE_MASKED \
+    __ASM_EMIT("test        $0x8, %[mask]") \
+    __ASM_EMIT("jz          7f") \
+    STORE \
+    __ASM_EMIT("7:") \
+    __ASM_EMIT("shl         $1, %[mask]")                   /* mask     = mask << 1 */ \
+    __ASM_EMIT("xorps       %%xmm0, %%xmm0")                /* xmm0     = 0 */ \
+    __ASM_EMIT("and         $0x0f, %[mask]")                /* mask     = (mask << 1) & 0x0f */ \
+    __ASM_EMIT("jz          6f") \
+    HALFBAND_SSE_SHIFT_MASK \
+    __ASM_EMIT("jmp         5b") \
+    \
+    /* Store filter memory */ \
+    __ASM_EMIT("6:") \
+    __ASM_EMIT("movaps      %%xmm2, 0x00(%[f])") \
+    __ASM_EMIT("movaps      %%xmm3, 0x10(%[f])") \
+    __ASM_EMIT("movaps      %%xmm6, 0x20(%[f])") \
+    __ASM_EMIT("movaps      %%xmm7, 0x30(%[f])") \
+    \
+    __ASM_EMIT("8:")
+
+namespace lsp
+{
+    namespace sse
+    {
+        IF_ARCH_X86(
+            static const uint32_t halfband_mask[] __lsp_aligned16 =
+            {
+                0xffffffff, 0xffffffff, 0, 0
+            };
+
+            static const float halfband_half[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0.5f)
+            };
+        )
+
+        void halfband_upsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f)
+        {
+            IF_ARCH_X86(
+                float   MASK0[4] __lsp_aligned16;
+                float   MASK1[4] __lsp_aligned16;
+                size_t  mask;
+            )
+
+            ARCH_X86_ASM
+            (
+                HALFBAND_SSE_PROCESS(
+                    __ASM_EMIT("movss       (%[src]), %%xmm0")          /* xmm0     = s */
+                    __ASM_EMIT("add         $4, %[src]")                /* src      ++ */
+                    __ASM_EMIT("shufps      $0x00, %%xmm0, %%xmm0"),    /* xmm0     = s s s s */
+
+                    __ASM_EMIT("movhps      %%xmm7, (%[dst])")          /* dst[0]   = y6, dst[1] = y7 */
+                    __ASM_EMIT("add         $8, %[dst]")                /* dst      += 2 */
+                )
+
+                : [dst] "+r" (dst), [src] "+r" (src), [mask] "=&r"(mask), [count] "+r" (count),
+                  [MASK0] "+m" (MASK0), [MASK1] "+m" (MASK1)
+                : [f] "r" (f),
+                  [X_MASK] "m" (halfband_mask)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void halfband_downsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f)
+        {
+            IF_ARCH_X86(
+                float   MASK0[4] __lsp_aligned16;
+                float   MASK1[4] __lsp_aligned16;
+                size_t  mask;
+            )
+
+            ARCH_X86_ASM
+            (
+                HALFBAND_SSE_PROCESS(
+                    __ASM_EMIT("movlps      (%[src]), %%xmm0")          /* xmm0     = s0 s1 ? ? */
+                    __ASM_EMIT("add         $8, %[src]")                /* src      += 2 */
+                    __ASM_EMIT("shufps      $0xe1, %%xmm0, %%xmm0"),    /* xmm0     = s1 s0 ? ? */
+
+                    __ASM_EMIT("movhlps     %%xmm7, %%xmm1")            /* xmm1     = y6 y7 ? ? */
+                    __ASM_EMIT("movaps      %%xmm1, %%xmm5")            /* xmm5     = y6 y7 ? ? */
+                    __ASM_EMIT("shufps      $0x55, %%xmm5, %%xmm5")     /* xmm5     = y7 y7 y7 y7 */
+                    __ASM_EMIT("addss       %%xmm5, %%xmm1")            /* xmm1     = y6 + y7 */
+                    __ASM_EMIT("mulss       %[X_HALF], %%xmm1")        /* xmm1     = (y6 + y7) * 0.5 */
+                    __ASM_EMIT("movss       %%xmm1, (%[dst])")          /* *dst     = (y6 + y7) * 0.5 */
+                    __ASM_EMIT("add         $4, %[dst]")                /* dst      ++ */
+                )
+
+                : [dst] "+r" (dst), [src] "+r" (src), [mask] "=&r"(mask), [count] "+r" (count),
+                  [MASK0] "+m" (MASK0), [MASK1] "+m" (MASK1)
+                : [f] "r" (f),
+                  [X_MASK] "m" (halfband_mask),
+                  [X_HALF] "m" (halfband_half)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+    }
+}
+
+#undef HALFBAND_SSE_PROCESS
+#undef HALFBAND_SSE_SHIFT_MASK
+#undef HALFBAND_SSE_UPDATE_MASKED
+#undef HALFBAND_SSE_UPDATE
+#undef HALFBAND_SSE_CALC
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_RESAMPLING_HALFBAND_H_ */
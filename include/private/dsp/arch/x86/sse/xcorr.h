@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_XCORR_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_XCORR_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+namespace lsp
+{
+    namespace sse
+    {
+        #define XCORR_LOAD4 \
+            __ASM_EMIT("movups      0x00(%[a]), %%xmm0")            /* xmm0 = ar0 ai0 ar1 ai1 */ \
+            __ASM_EMIT("movups      0x10(%[a]), %%xmm1")            /* xmm1 = ar2 ai2 ar3 ai3 */ \
+            __ASM_EMIT("movups      0x00(%[b]), %%xmm2")            /* xmm2 = br0 bi0 br1 bi1 */ \
+            __ASM_EMIT("movups      0x10(%[b]), %%xmm3")            /* xmm3 = br2 bi2 br3 bi3 */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4") \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5") \
+            __ASM_EMIT("shufps      $0x88, %%xmm1, %%xmm0")         /* xmm0 = ar */ \
+            __ASM_EMIT("shufps      $0xdd, %%xmm1, %%xmm4")         /* xmm4 = ai */ \
+            __ASM_EMIT("shufps      $0x88, %%xmm3, %%xmm2")         /* xmm2 = br */ \
+            __ASM_EMIT("shufps      $0xdd, %%xmm3, %%xmm5")         /* xmm5 = bi */ \
+            __ASM_EMIT("movups      0x00(%[acc]), %%xmm6")          /* xmm6 = sr0 si0 sr1 si1 */ \
+            __ASM_EMIT("movups      0x10(%[acc]), %%xmm1")          /* xmm1 = sr2 si2 sr3 si3 */ \
+            __ASM_EMIT("movaps      %%xmm6, %%xmm7") \
+            __ASM_EMIT("shufps      $0x88, %%xmm1, %%xmm6")         /* xmm6 = sr */ \
+            __ASM_EMIT("shufps      $0xdd, %%xmm1, %%xmm7")         /* xmm7 = si */
+
+        #define XCORR_LOAD1 \
+            __ASM_EMIT("movss       0x00(%[a]), %%xmm0")            /* xmm0 = ar */ \
+            __ASM_EMIT("movss       0x04(%[a]), %%xmm4")            /* xmm4 = ai */ \
+            __ASM_EMIT("movss       0x00(%[b]), %%xmm2")            /* xmm2 = br */ \
+            __ASM_EMIT("movss       0x04(%[b]), %%xmm5")            /* xmm5 = bi */ \
+            __ASM_EMIT("movss       0x00(%[acc]), %%xmm6")          /* xmm6 = sr */ \
+            __ASM_EMIT("movss       0x04(%[acc]), %%xmm7")          /* xmm7 = si */
+
+        #define XCORR_MUL \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1") \
+            __ASM_EMIT("movaps      %%xmm4, %%xmm3") \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm1")                /* xmm1 = ar*br */ \
+            __ASM_EMIT("mulps       %%xmm5, %%xmm3")                /* xmm3 = ai*bi */ \
+            __ASM_EMIT("mulps       %%xmm5, %%xmm0")                /* xmm0 = ar*bi */ \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm4")                /* xmm4 = ai*br */ \
+            __ASM_EMIT("addps       %%xmm3, %%xmm1")                /* xmm1 = gr = ar*br + ai*bi */ \
+            __ASM_EMIT("subps       %%xmm4, %%xmm0")                /* xmm0 = gi = ar*bi - ai*br */
+
+        #define XCORR_WEIGHT_PLAIN
+
+        #define XCORR_WEIGHT_PHAT \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm2") \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm3") \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm2")                /* xmm2 = gr*gr */ \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm3")                /* xmm3 = gi*gi */ \
+            __ASM_EMIT("addps       %%xmm3, %%xmm2")                /* xmm2 = gr*gr + gi*gi */ \
+            __ASM_EMIT("sqrtps      %%xmm2, %%xmm2")                /* xmm2 = |g| */ \
+            __ASM_EMIT("addps       0x10(%[C]), %%xmm2")            /* xmm2 = |g| + eps */ \
+            __ASM_EMIT("movaps      0x20(%[C]), %%xmm3")            /* xmm3 = 1 */ \
+            __ASM_EMIT("divps       %%xmm2, %%xmm3")                /* xmm3 = w = 1 / (|g| + eps) */ \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm1")                /* xmm1 = gr*w */ \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm0")                /* xmm0 = gi*w */
+
+        #define XCORR_SMOOTH \
+            __ASM_EMIT("subps       %%xmm6, %%xmm1")                /* xmm1 = gr - sr */ \
+            __ASM_EMIT("subps       %%xmm7, %%xmm0")                /* xmm0 = gi - si */ \
+            __ASM_EMIT("mulps       0x00(%[C]), %%xmm1")            /* xmm1 = (gr - sr)*k */ \
+            __ASM_EMIT("mulps       0x00(%[C]), %%xmm0")            /* xmm0 = (gi - si)*k */ \
+            __ASM_EMIT("addps       %%xmm6, %%xmm1")                /* xmm1 = sr' = sr + (gr - sr)*k */ \
+            __ASM_EMIT("addps       %%xmm7, %%xmm0")                /* xmm0 = si' = si + (gi - si)*k */
+
+        #define XCORR_STORE4 \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm2") \
+            __ASM_EMIT("unpcklps    %%xmm0, %%xmm1")                /* xmm1 = sr0 si0 sr1 si1 */ \
+            __ASM_EMIT("unpckhps    %%xmm0, %%xmm2")                /* xmm2 = sr2 si2 sr3 si3 */ \
+            __ASM_EMIT("movups      %%xmm1, 0x00(%[acc])") \
+            __ASM_EMIT("movups      %%xmm2, 0x10(%[acc])")
+
+        #define XCORR_STORE1 \
+            __ASM_EMIT("movss       %%xmm1, 0x00(%[acc])") \
+            __ASM_EMIT("movss       %%xmm0, 0x04(%[acc])")
+
+        #define XCORR_KERNEL(WEIGHT) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("sub         $4, %[count]") \
+                __ASM_EMIT("jb          2f") \
+                /* 4x blocks */ \
+                __ASM_EMIT("1:") \
+                XCORR_LOAD4 \
+                XCORR_MUL \
+                WEIGHT \
+                XCORR_SMOOTH \
+                XCORR_STORE4 \
+                __ASM_EMIT("add         $0x20, %[a]") \
+                __ASM_EMIT("add         $0x20, %[b]") \
+                __ASM_EMIT("add         $0x20, %[acc]") \
+                __ASM_EMIT("sub         $4, %[count]") \
+                __ASM_EMIT("jae         1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("add         $3, %[count]") \
+                __ASM_EMIT("jl          4f") \
+                __ASM_EMIT("3:") \
+                XCORR_LOAD1 \
+                XCORR_MUL \
+                WEIGHT \
+                XCORR_SMOOTH \
+                XCORR_STORE1 \
+                __ASM_EMIT("add         $0x08, %[a]") \
+                __ASM_EMIT("add         $0x08, %[b]") \
+                __ASM_EMIT("add         $0x08, %[acc]") \
+                __ASM_EMIT("dec         %[count]") \
+                __ASM_EMIT("jge         3b") \
+                __ASM_EMIT("4:") \
+                : [acc] "+r" (acc), [a] "+r" (a), [b] "+r" (b), \
+                  [count] "+r" (count) \
+                : [C] "r" (&c[0]) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            )
+
+        void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count)
+        {
+            float c[12] __lsp_aligned16;
+            for (size_t i=0; i<4; ++i)
+            {
+                c[i]            = k;                // Smoothing factor
+                c[i + 4]        = 1e-20f;           // Bias of the magnitude
+                c[i + 8]        = 1.0f;
+            }
+
+            if (weight == dsp::XCORR_PHAT)
+                XCORR_KERNEL(XCORR_WEIGHT_PHAT);
+            else
+                XCORR_KERNEL(XCORR_WEIGHT_PLAIN);
+        }
+
+        #undef XCORR_KERNEL
+        #undef XCORR_STORE1
+        #undef XCORR_STORE4
+        #undef XCORR_SMOOTH
+        #undef XCORR_WEIGHT_PHAT
+        #undef XCORR_WEIGHT_PLAIN
+        #undef XCORR_MUL
+        #undef XCORR_LOAD1
+        #undef XCORR_LOAD4
+
+    } /* namespace sse */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_XCORR_H_ */
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_GRAPHICS_COLORMAP_H_
+#define PRIVATE_DSP_ARCH_X86_SSE2_GRAPHICS_COLORMAP_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_IMPL */
+
+namespace lsp
+{
+    namespace sse2
+    {
+        IF_ARCH_X86(
+            static const uint32_t SPECTROGRAM_CONST[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0x7fffffff),           // X_SIGN
+                LSP_DSP_VEC4(0x00800000),           // X_MIN    = FLT_MIN
+                LSP_DSP_VEC4(0x007fffff),           // X_MANT
+                LSP_DSP_VEC4(0x0000007f),           // X_BIAS   = 127
+                LSP_DSP_VEC4(0x3f800000),           // ONE
+                LSP_DSP_VEC4(0x3e2308c0),           // C3
+                LSP_DSP_VEC4(0xbf1502ca),           // C2
+                LSP_DSP_VEC4(0x3fb6204d),           // C1
+                LSP_DSP_VEC4(0x00000000),           // ZERO
+                LSP_DSP_VEC4(0x437f0000)            // MAX      = 255.0
+            };
+        )
+
+        // Input: v = magnitudes, xmm6 = k, xmm7 = b
+        // Output: e = colormap indices
+        #define SPECTROGRAM_CORE_X4(v, e, p) \
+            __ASM_EMIT("andps       0x00 + %[SC], " v)          /* v = abs(s) */ \
+            __ASM_EMIT("maxps       0x10 + %[SC], " v)          /* v = max(abs(s), X_MIN), NaN -> X_MIN */ \
+            __ASM_EMIT("movdqa      " v ", " e)                 /* e = v */ \
+            __ASM_EMIT("psrld       $23, " e)                   /* e = ilog2(v) + 127 */ \
+            __ASM_EMIT("andps       0x20 + %[SC], " v)          /* v = mant(v) */ \
+            __ASM_EMIT("psubd       0x30 + %[SC], " e)          /* e = ilog2(v) */ \
+            __ASM_EMIT("orps        0x40 + %[SC], " v)          /* v = 1 + M */ \
+            __ASM_EMIT("cvtdq2ps    " e ", " e)                 /* e = E = float(ilog2(v)) */ \
+            __ASM_EMIT("subps       0x40 + %[SC], " v)          /* v = M */ \
+            __ASM_EMIT("movaps      0x50 + %[SC], " p)          /* p = C3 */ \
+            __ASM_EMIT("mulps       " v ", " p)                 /* p = M*C3 */ \
+            __ASM_EMIT("addps       0x60 + %[SC], " p)          /* p = C2+M*C3 */ \
+            __ASM_EMIT("mulps       " v ", " p)                 /* p = M*(C2+M*C3) */ \
+            __ASM_EMIT("addps       0x70 + %[SC], " p)          /* p = C1+M*(C2+M*C3) */ \
+            __ASM_EMIT("mulps       " v ", " p)                 /* p = M*(C1+M*(C2+M*C3)) = log2(1 + M) */ \
+            __ASM_EMIT("addps       " p ", " e)                 /* e = E + log2(1 + M) = log2(v) */ \
+            __ASM_EMIT("mulps       %%xmm6, " e)                /* e = k*log2(v) */ \
+            __ASM_EMIT("addps       %%xmm7, " e)                /* e = k*log2(v) + b */ \
+            __ASM_EMIT("maxps       0x80 + %[SC], " e)          /* e = max(k*log2(v) + b, 0) */ \
+            __ASM_EMIT("minps       0x90 + %[SC], " e)          /* e = min(max(k*log2(v) + b, 0), 255) */ \
+            __ASM_EMIT("cvttps2dq   " e ", " e)                 /* e = int(min(max(k*log2(v) + b, 0), 255)) */
+
+        #define SPECTROGRAM_STORE_X1(e, off) \
+            __ASM_EMIT("movd        " e ", %k[t]")              /* t = index */ \
+            __ASM_EMIT("mov         (%[lut], %[t], 4), %k[t]")  /* t = lut[index] */ \
+            __ASM_EMIT("mov         %k[t], " off "(%[dst])")
+
+        #define SPECTROGRAM_STORE_X4(e, off) \
+            SPECTROGRAM_STORE_X1(e, off " + 0x00") \
+            __ASM_EMIT("psrldq      $4, " e) \
+            SPECTROGRAM_STORE_X1(e, off " + 0x04") \
+            __ASM_EMIT("psrldq      $4, " e) \
+            SPECTROGRAM_STORE_X1(e, off " + 0x08") \
+            __ASM_EMIT("psrldq      $4, " e) \
+            SPECTROGRAM_STORE_X1(e, off " + 0x0c")
+
+        void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count)
+        {
+            float range         = 255.0f / (dbmax - dbmin);
+            float k             = 6.02059991f * range;         // 20 * log10(2) dB per octave
+            float b             = 0.5f - dbmin * range;
+            IF_ARCH_X86(size_t t);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movss       %[k], %%xmm6")
+                __ASM_EMIT("movss       %[b], %%xmm7")
+                __ASM_EMIT("shufps      $0x00, %%xmm6, %%xmm6")         // xmm6 = k
+                __ASM_EMIT("shufps      $0x00, %%xmm7, %%xmm7")         // xmm7 = b
+
+                // x8 blocks
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      0x00(%[src]), %%xmm0")
+                __ASM_EMIT("movups      0x10(%[src]), %%xmm3")
+                SPECTROGRAM_CORE_X4("%%xmm0", "%%xmm1", "%%xmm2")
+                SPECTROGRAM_CORE_X4("%%xmm3", "%%xmm4", "%%xmm5")
+                SPECTROGRAM_STORE_X4("%%xmm1", "0x00")
+                SPECTROGRAM_STORE_X4("%%xmm4", "0x10")
+                __ASM_EMIT("add         $0x20, %[src]")
+                __ASM_EMIT("add         $0x20, %[dst]")
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jae         1b")
+
+                // x4 block
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $4, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("movups      0x00(%[src]), %%xmm0")
+                SPECTROGRAM_CORE_X4("%%xmm0", "%%xmm1", "%%xmm2")
+                SPECTROGRAM_STORE_X4("%%xmm1", "0x00")
+                __ASM_EMIT("add         $0x10, %[src]")
+                __ASM_EMIT("add         $0x10, %[dst]")
+                __ASM_EMIT("sub         $4, %[count]")
+
+                // x1 blocks
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add         $3, %[count]")
+                __ASM_EMIT("jl          6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("movss       0x00(%[src]), %%xmm0")
+                SPECTROGRAM_CORE_X4("%%xmm0", "%%xmm1", "%%xmm2")
+                SPECTROGRAM_STORE_X1("%%xmm1", "0x00")
+                __ASM_EMIT("add         $0x04, %[src]")
+                __ASM_EMIT("add         $0x04, %[dst]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jge         5b")
+
+                // End
+                __ASM_EMIT("6:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+                  [t] "=&r" (t)
+                : [lut] "r" (lut),
+                  [k] "m" (k), [b] "m" (b),
+                  [SC] "o" (SPECTROGRAM_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef SPECTROGRAM_STORE_X4
+        #undef SPECTROGRAM_STORE_X1
+        #undef SPECTROGRAM_CORE_X4
+
+    } /* namespace sse2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_GRAPHICS_COLORMAP_H_ */
@@ -542,6 +542,303 @@ namespace lsp
         }
 
     #undef EFF_HSLA_LIGHT_CORE
+
+        IF_ARCH_X86(
+            static const uint32_t EFF_HSLA_BGRA32_XC[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0x7fffffff),               // SIGN
+                LSP_DSP_VEC4(0x3f800000),               // 1.0
+                LSP_DSP_VEC4(0x437f0000),               // 255.0
+                LSP_DSP_VEC4(0x3eaaaaab),               // 1/3
+                LSP_DSP_VEC4(0x40c00000),               // 6.0
+                LSP_DSP_VEC4(0x40800000)                // 4.0
+            };
+        )
+
+    /*
+     * Fused effects rely on the fact that HSL->RGB conversion can be written as:
+     *   R = T1 + (T2 - T1) * W(H + 1/3)
+     *   G = T1 + (T2 - T1) * W(H)
+     *   B = T1 + (T2 - T1) * W(H - 1/3)
+     * where W(t) = min(max(min(6*t, 4 - 6*t), 0), 1), T2 - L = L - T1 = S * min(L, 1 - L)
+     */
+    #define EFF_HSLA_WEIGHT(t) \
+        __ASM_EMIT("mulps           0x40 + %[XC], " t)          /* t    = 6*t */ \
+        __ASM_EMIT("movaps          0x50 + %[XC], %%xmm4")      /* xmm4 = 4 */ \
+        __ASM_EMIT("subps           " t ", %%xmm4")             /* xmm4 = 4 - 6*t */ \
+        __ASM_EMIT("minps           %%xmm4, " t)                /* t    = min(6*t, 4 - 6*t) */ \
+        __ASM_EMIT("xorps           %%xmm4, %%xmm4")            /* xmm4 = 0 */ \
+        __ASM_EMIT("maxps           %%xmm4, " t)                /* t    = max(min(6*t, 4 - 6*t), 0) */ \
+        __ASM_EMIT("minps           0x10 + %[XC], " t)          /* t    = W(t) = min(max(min(6*t, 4 - 6*t), 0), 1) */
+
+    #define EFF_HSLA_WEIGHTS_CORE \
+        /* xmm2 = H */ \
+        __ASM_EMIT("movaps          %%xmm2, %%xmm0")            /* xmm0 = H */ \
+        __ASM_EMIT("movaps          %%xmm2, %%xmm1")            /* xmm1 = TG = H */ \
+        __ASM_EMIT("addps           0x30 + %[XC], %%xmm0")      /* xmm0 = H + 1/3 */ \
+        __ASM_EMIT("subps           0x30 + %[XC], %%xmm2")      /* xmm2 = H - 1/3 */ \
+        __ASM_EMIT("movaps          0x10 + %[XC], %%xmm4")      /* xmm4 = 1 */ \
+        __ASM_EMIT("movaps          %%xmm2, %%xmm5")            /* xmm5 = H - 1/3 */ \
+        __ASM_EMIT("cmpltps         %%xmm0, %%xmm4")            /* xmm4 = [ 1 < H + 1/3 ] */ \
+        __ASM_EMIT("andps           0x10 + %[XC], %%xmm4")      /* xmm4 = 1 & [ 1 < H + 1/3 ] */ \
+        __ASM_EMIT("subps           %%xmm4, %%xmm0")            /* xmm0 = TR = H + 1/3 - (1 & [ 1 < H + 1/3 ]) */ \
+        __ASM_EMIT("xorps           %%xmm4, %%xmm4")            /* xmm4 = 0 */ \
+        __ASM_EMIT("cmpltps         %%xmm4, %%xmm5")            /* xmm5 = [ H - 1/3 < 0 ] */ \
+        __ASM_EMIT("andps           0x10 + %[XC], %%xmm5")      /* xmm5 = 1 & [ H - 1/3 < 0 ] */ \
+        __ASM_EMIT("addps           %%xmm5, %%xmm2")            /* xmm2 = TB = H - 1/3 + (1 & [ H - 1/3 < 0 ]) */ \
+        EFF_HSLA_WEIGHT("%%xmm0")                               /* xmm0 = WR */ \
+        EFF_HSLA_WEIGHT("%%xmm1")                               /* xmm1 = WG */ \
+        EFF_HSLA_WEIGHT("%%xmm2")                               /* xmm2 = WB */
+
+    #define EFF_HSLA_PIXEL_CORE(T1, D, WR, WG, WB) \
+        /* xmm3 = alpha */ \
+        __ASM_EMIT("movaps          0x20 + %[XC], %%xmm7")      /* xmm7 = 255 */ \
+        __ASM_EMIT("mulps           %%xmm7, %%xmm3")            /* xmm3 = alpha * 255 */ \
+        __ASM_EMIT("subps           %%xmm3, %%xmm7")            /* xmm7 = A = 255 - alpha * 255 */ \
+        __ASM_EMIT("movaps          " D ", %%xmm4")             /* xmm4 = D */ \
+        __ASM_EMIT("movaps          " D ", %%xmm5")             /* xmm5 = D */ \
+        __ASM_EMIT("movaps          " D ", %%xmm6")             /* xmm6 = D */ \
+        __ASM_EMIT("mulps           " WB ", %%xmm4")            /* xmm4 = D*WB */ \
+        __ASM_EMIT("mulps           " WG ", %%xmm5")            /* xmm5 = D*WG */ \
+        __ASM_EMIT("mulps           " WR ", %%xmm6")            /* xmm6 = D*WR */ \
+        __ASM_EMIT("addps           " T1 ", %%xmm4")            /* xmm4 = b = T1 + D*WB */ \
+        __ASM_EMIT("addps           " T1 ", %%xmm5")            /* xmm5 = g = T1 + D*WG */ \
+        __ASM_EMIT("addps           " T1 ", %%xmm6")            /* xmm6 = r = T1 + D*WR */ \
+        __ASM_EMIT("mulps           %%xmm7, %%xmm4")            /* xmm4 = B = b * A */ \
+        __ASM_EMIT("mulps           %%xmm7, %%xmm5")            /* xmm5 = G = g * A */ \
+        __ASM_EMIT("mulps           %%xmm7, %%xmm6")            /* xmm6 = R = r * A */ \
+        __ASM_EMIT("xorps           %%xmm3, %%xmm3")            /* xmm3 = 0 */ \
+        __ASM_EMIT("maxps           %%xmm3, %%xmm4")            /* xmm4 = max(B, 0) */ \
+        __ASM_EMIT("maxps           %%xmm3, %%xmm5")            /* xmm5 = max(G, 0) */ \
+        __ASM_EMIT("maxps           %%xmm3, %%xmm6")            /* xmm6 = max(R, 0) */ \
+        __ASM_EMIT("maxps           %%xmm3, %%xmm7")            /* xmm7 = max(A, 0) */ \
+        __ASM_EMIT("minps           0x20 + %[XC], %%xmm4")      /* xmm4 = min(max(B, 0), 255) */ \
+        __ASM_EMIT("minps           0x20 + %[XC], %%xmm5")      /* xmm5 = min(max(G, 0), 255) */ \
+        __ASM_EMIT("minps           0x20 + %[XC], %%xmm6")      /* xmm6 = min(max(R, 0), 255) */ \
+        __ASM_EMIT("minps           0x20 + %[XC], %%xmm7")      /* xmm7 = min(max(A, 0), 255) */ \
+        __ASM_EMIT("cvttps2dq       %%xmm4, %%xmm4")            /* xmm4 = int(B) */ \
+        __ASM_EMIT("cvttps2dq       %%xmm5, %%xmm5")            /* xmm5 = int(G) */ \
+        __ASM_EMIT("cvttps2dq       %%xmm6, %%xmm6")            /* xmm6 = int(R) */ \
+        __ASM_EMIT("cvttps2dq       %%xmm7, %%xmm7")            /* xmm7 = int(A) */ \
+        __ASM_EMIT("pslld           $8, %%xmm5")                /* xmm5 = int(G) << 8 */ \
+        __ASM_EMIT("pslld           $16, %%xmm6")               /* xmm6 = int(R) << 16 */ \
+        __ASM_EMIT("pslld           $24, %%xmm7")               /* xmm7 = int(A) << 24 */ \
+        __ASM_EMIT("por             %%xmm5, %%xmm4") \
+        __ASM_EMIT("por             %%xmm7, %%xmm6") \
+        __ASM_EMIT("por             %%xmm6, %%xmm4")            /* xmm4 = B G R A */
+
+    #define EFF_HSLA_BGRA32_LOOP(CORE) \
+        __ASM_EMIT("sub             $4, %[count]") \
+        __ASM_EMIT("jb              2f") \
+        /* 4x blocks */ \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("movups          0x00(%[src]), %%xmm0")      /* xmm0 = v */ \
+        CORE \
+        __ASM_EMIT("movdqu          %%xmm4, 0x00(%[dst])") \
+        __ASM_EMIT("add             $0x10, %[src]") \
+        __ASM_EMIT("add             $0x10, %[dst]") \
+        __ASM_EMIT("sub             $4, %[count]") \
+        __ASM_EMIT("jae             1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("add             $3, %[count]") \
+        __ASM_EMIT("jl              4f") \
+        __ASM_EMIT("3:") \
+        __ASM_EMIT("movss           0x00(%[src]), %%xmm0")      /* xmm0 = v */ \
+        CORE \
+        __ASM_EMIT("movd            %%xmm4, 0x00(%[dst])") \
+        __ASM_EMIT("add             $0x04, %[src]") \
+        __ASM_EMIT("add             $0x04, %[dst]") \
+        __ASM_EMIT("dec             %[count]") \
+        __ASM_EMIT("jge             3b") \
+        __ASM_EMIT("4:")
+
+    #define EFF_HSLA_HUE_BGRA32_CORE \
+        /* xmm0 = v */ \
+        __ASM_EMIT("andps           0x00 + %[XC], %%xmm0")      /* xmm0 = abs(v) */ \
+        __ASM_EMIT("movaps          0x10 + %[XC], %%xmm1")      /* xmm1 = 1 */ \
+        __ASM_EMIT("subps           %%xmm0, %%xmm1")            /* xmm1 = V = 1 - abs(v) */ \
+        __ASM_EMIT("movaps          %%xmm1, %%xmm3")            /* xmm3 = V */ \
+        __ASM_EMIT("subps           0x10(%[P]), %%xmm3")        /* xmm3 = V - T */ \
+        __ASM_EMIT("xorps           %%xmm4, %%xmm4")            /* xmm4 = 0 */ \
+        __ASM_EMIT("maxps           %%xmm4, %%xmm3")            /* xmm3 = max(V - T, 0) */ \
+        __ASM_EMIT("mulps           0x20(%[P]), %%xmm3")        /* xmm3 = alpha = max(V - T, 0) * KT */ \
+        __ASM_EMIT("minps           0x10(%[P]), %%xmm1")        /* xmm1 = min(V, T) */ \
+        __ASM_EMIT("addps           0x00(%[P]), %%xmm1")        /* xmm1 = NH = EH + min(V, T) */ \
+        __ASM_EMIT("movaps          0x10 + %[XC], %%xmm4")      /* xmm4 = 1 */ \
+        __ASM_EMIT("cmpltps         %%xmm1, %%xmm4")            /* xmm4 = [ 1 < NH ] */ \
+        __ASM_EMIT("andps           0x10 + %[XC], %%xmm4")      /* xmm4 = 1 & [ 1 < NH ] */ \
+        __ASM_EMIT("subps           %%xmm4, %%xmm1")            /* xmm1 = H = NH - (1 & [ 1 < NH ]) */ \
+        __ASM_EMIT("movaps          %%xmm1, %%xmm2")            /* xmm2 = H */ \
+        EFF_HSLA_WEIGHTS_CORE \
+        EFF_HSLA_PIXEL_CORE("0x30(%[P])", "0x40(%[P])", "%%xmm0", "%%xmm1", "%%xmm2")
+
+        void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count)
+        {
+            IF_ARCH_X86(
+                float p[5*4] __lsp_aligned16;
+                float x     = eff->s * ((eff->l < 0.5f) ? eff->l : 1.0f - eff->l);
+                for (size_t i=0; i<4; ++i)
+                {
+                    p[i]        = eff->h;               // EH
+                    p[i + 4]    = 1.0f - eff->thresh;   // T
+                    p[i + 8]    = 1.0f / eff->thresh;   // KT
+                    p[i + 12]   = eff->l - x;           // T1
+                    p[i + 16]   = x + x;                // D
+                }
+            );
+
+            ARCH_X86_ASM(
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_HUE_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]),
+                  [XC] "o" (EFF_HSLA_BGRA32_XC)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+    #undef EFF_HSLA_HUE_BGRA32_CORE
+
+    #define EFF_HSLA_ALPHA_BGRA32_CORE \
+        /* xmm0 = v */ \
+        __ASM_EMIT("andps           0x00 + %[XC], %%xmm0")      /* xmm0 = abs(v) */ \
+        __ASM_EMIT("movaps          0x10 + %[XC], %%xmm3")      /* xmm3 = 1 */ \
+        __ASM_EMIT("subps           %%xmm0, %%xmm3")            /* xmm3 = alpha = 1 - abs(v) */ \
+        EFF_HSLA_PIXEL_CORE("0x00(%[P])", "0x10(%[P])", "0x20(%[P])", "0x30(%[P])", "0x40(%[P])")
+
+    #define EFF_HSLA_BGRA32_WEIGHTS(off) \
+        __ASM_EMIT("movss           0x00(%[eff]), %%xmm2")      /* xmm2 = h */ \
+        __ASM_EMIT("shufps          $0x00, %%xmm2, %%xmm2")     /* xmm2 = H */ \
+        EFF_HSLA_WEIGHTS_CORE \
+        __ASM_EMIT("movaps          %%xmm0, " off " + 0x00(%[P])") \
+        __ASM_EMIT("movaps          %%xmm1, " off " + 0x10(%[P])") \
+        __ASM_EMIT("movaps          %%xmm2, " off " + 0x20(%[P])")
+
+        void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count)
+        {
+            IF_ARCH_X86(
+                float p[5*4] __lsp_aligned16;
+                float x     = eff->s * ((eff->l < 0.5f) ? eff->l : 1.0f - eff->l);
+                for (size_t i=0; i<4; ++i)
+                {
+                    p[i]        = eff->l - x;           // T1
+                    p[i + 4]    = x + x;                // D
+                }
+            );
+
+            ARCH_X86_ASM(
+                EFF_HSLA_BGRA32_WEIGHTS("0x20")
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_ALPHA_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]), [eff] "r" (eff),
+                  [XC] "o" (EFF_HSLA_BGRA32_XC)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+    #undef EFF_HSLA_ALPHA_BGRA32_CORE
+
+    #define EFF_HSLA_SAT_BGRA32_CORE \
+        /* xmm0 = v */ \
+        __ASM_EMIT("andps           0x00 + %[XC], %%xmm0")      /* xmm0 = V = abs(v) */ \
+        __ASM_EMIT("movaps          0x20(%[P]), %%xmm3")        /* xmm3 = t */ \
+        __ASM_EMIT("subps           %%xmm0, %%xmm3")            /* xmm3 = t - V */ \
+        __ASM_EMIT("xorps           %%xmm4, %%xmm4")            /* xmm4 = 0 */ \
+        __ASM_EMIT("maxps           %%xmm4, %%xmm3")            /* xmm3 = max(t - V, 0) */ \
+        __ASM_EMIT("mulps           0x30(%[P]), %%xmm3")        /* xmm3 = alpha = max(t - V, 0) * KT */ \
+        __ASM_EMIT("maxps           0x20(%[P]), %%xmm0")        /* xmm0 = max(V, t) */ \
+        __ASM_EMIT("mulps           0x10(%[P]), %%xmm0")        /* xmm0 = X = max(V, t) * MS */ \
+        __ASM_EMIT("movaps          0x00(%[P]), %%xmm2")        /* xmm2 = L */ \
+        __ASM_EMIT("movaps          %%xmm0, %%xmm1")            /* xmm1 = X */ \
+        __ASM_EMIT("subps           %%xmm0, %%xmm2")            /* xmm2 = T1 = L - X */ \
+        __ASM_EMIT("addps           %%xmm0, %%xmm1")            /* xmm1 = D = X + X */ \
+        EFF_HSLA_PIXEL_CORE("%%xmm2", "%%xmm1", "0x40(%[P])", "0x50(%[P])", "0x60(%[P])")
+
+        void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count)
+        {
+            IF_ARCH_X86(
+                float p[7*4] __lsp_aligned16;
+                for (size_t i=0; i<4; ++i)
+                {
+                    p[i]        = eff->l;               // L
+                    p[i + 4]    = eff->s * ((eff->l < 0.5f) ? eff->l : 1.0f - eff->l); // MS
+                    p[i + 8]    = eff->thresh;          // t
+                    p[i + 12]   = 1.0f / eff->thresh;   // KT
+                }
+            );
+
+            ARCH_X86_ASM(
+                EFF_HSLA_BGRA32_WEIGHTS("0x40")
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_SAT_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]), [eff] "r" (eff),
+                  [XC] "o" (EFF_HSLA_BGRA32_XC)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+    #undef EFF_HSLA_SAT_BGRA32_CORE
+
+    #define EFF_HSLA_LIGHT_BGRA32_CORE \
+        /* xmm0 = v */ \
+        __ASM_EMIT("andps           0x00 + %[XC], %%xmm0")      /* xmm0 = V = abs(v) */ \
+        __ASM_EMIT("movaps          0x20(%[P]), %%xmm3")        /* xmm3 = t */ \
+        __ASM_EMIT("subps           %%xmm0, %%xmm3")            /* xmm3 = t - V */ \
+        __ASM_EMIT("xorps           %%xmm4, %%xmm4")            /* xmm4 = 0 */ \
+        __ASM_EMIT("maxps           %%xmm4, %%xmm3")            /* xmm3 = max(t - V, 0) */ \
+        __ASM_EMIT("mulps           0x30(%[P]), %%xmm3")        /* xmm3 = alpha = max(t - V, 0) * KT */ \
+        __ASM_EMIT("maxps           0x20(%[P]), %%xmm0")        /* xmm0 = max(V, t) */ \
+        __ASM_EMIT("mulps           0x10(%[P]), %%xmm0")        /* xmm0 = L = max(V, t) * EL */ \
+        __ASM_EMIT("movaps          0x10 + %[XC], %%xmm1")      /* xmm1 = 1 */ \
+        __ASM_EMIT("movaps          %%xmm0, %%xmm2")            /* xmm2 = L */ \
+        __ASM_EMIT("subps           %%xmm0, %%xmm1")            /* xmm1 = 1 - L */ \
+        __ASM_EMIT("minps           %%xmm0, %%xmm1")            /* xmm1 = min(L, 1 - L) */ \
+        __ASM_EMIT("mulps           0x00(%[P]), %%xmm1")        /* xmm1 = X = ES * min(L, 1 - L) */ \
+        __ASM_EMIT("subps           %%xmm1, %%xmm2")            /* xmm2 = T1 = L - X */ \
+        __ASM_EMIT("addps           %%xmm1, %%xmm1")            /* xmm1 = D = X + X */ \
+        EFF_HSLA_PIXEL_CORE("%%xmm2", "%%xmm1", "0x40(%[P])", "0x50(%[P])", "0x60(%[P])")
+
+        void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count)
+        {
+            IF_ARCH_X86(
+                float p[7*4] __lsp_aligned16;
+                for (size_t i=0; i<4; ++i)
+                {
+                    p[i]        = eff->s;               // ES
+                    p[i + 4]    = eff->l;               // EL
+                    p[i + 8]    = eff->thresh;          // t
+                    p[i + 12]   = 1.0f / eff->thresh;   // KT
+                }
+            );
+
+            ARCH_X86_ASM(
+                EFF_HSLA_BGRA32_WEIGHTS("0x40")
+                EFF_HSLA_BGRA32_LOOP(EFF_HSLA_LIGHT_BGRA32_CORE)
+
+                : [dst] "+r" (dst), [src] "+r" (v), [count] "+r" (count)
+                : [P] "r" (&p[0]), [eff] "r" (eff),
+                  [XC] "o" (EFF_HSLA_BGRA32_XC)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+    #undef EFF_HSLA_LIGHT_BGRA32_CORE
+    #undef EFF_HSLA_BGRA32_WEIGHTS
+    #undef EFF_HSLA_BGRA32_LOOP
+    #undef EFF_HSLA_PIXEL_CORE
+    #undef EFF_HSLA_WEIGHTS_CORE
+    #undef EFF_HSLA_WEIGHT
     }
 }
 
@@ -0,0 +1,399 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_INTERPOLATION_DELAY_H_
+#define PRIVATE_DSP_ARCH_X86_SSE2_INTERPOLATION_DELAY_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_IMPL */
+
+#define DELAY_TAPS_BLOCK        16
+
+namespace lsp
+{
+    namespace sse2
+    {
+        /**
+         * Prepare parameters for reading the delay line
+         * @param p parameters to initialize, 9 vectors
+         * @param d delay line descriptor
+         * @param count number of samples to read
+         * @param k1 multiplier of (x[k+2] - x[k-1]) for the cubic term
+         * @param k2 multiplier of (x[k] - x[k+1]) for the cubic term
+         */
+        static void delay_read_init(float *p, const dsp::delay_t *d, size_t count, float k1, float k2)
+        {
+            uint32_t *u     = reinterpret_cast<uint32_t *>(p);
+            for (size_t i=0; i<4; ++i)
+            {
+                p[i]            = i;                        // I = positions
+                p[i + 4]        = 4.0f;                     // Step for 4x block
+                u[i + 8]        = d->head - count - 1;      // S = start of the block
+                u[i + 12]       = d->mask;                  // M = mask
+                p[i + 16]       = 1.0f;
+                p[i + 20]       = 0.5f;
+                p[i + 24]       = k1;
+                p[i + 28]       = k2;
+                u[i + 32]       = 0;                        // J = byte offsets of rows
+            }
+        }
+
+        /*
+         * Compute positions of 4 samples, split them into integer and fractional parts
+         * and load rows x[k-1] .. x[k+2] of each sample into xmm2..xmm5
+         */
+        #define DELAY_ROWS \
+            __ASM_EMIT("movups          0x00(%[delay]), %%xmm0")        /* xmm0 = D */ \
+            __ASM_EMIT("movaps          %%xmm7, %%xmm1")                /* xmm1 = I */ \
+            __ASM_EMIT("subps           %%xmm0, %%xmm1")                /* xmm1 = P = I - D */ \
+            __ASM_EMIT("cvttps2dq       %%xmm1, %%xmm2")                /* xmm2 = T = int(P) */ \
+            __ASM_EMIT("cvtdq2ps        %%xmm2, %%xmm3")                /* xmm3 = float(T) */ \
+            __ASM_EMIT("movaps          %%xmm1, %%xmm4")                /* xmm4 = P */ \
+            __ASM_EMIT("cmpltps         %%xmm3, %%xmm4")                /* xmm4 = [P < T] */ \
+            __ASM_EMIT("paddd           %%xmm4, %%xmm2")                /* xmm2 = T = floor(P) */ \
+            __ASM_EMIT("andps           0x40(%[P]), %%xmm4")            /* xmm4 = 1 & [P < T] */ \
+            __ASM_EMIT("subps           %%xmm4, %%xmm3")                /* xmm3 = float(floor(P)) */ \
+            __ASM_EMIT("subps           %%xmm3, %%xmm1")                /* xmm1 = F = P - floor(P) */ \
+            __ASM_EMIT("paddd           0x20(%[P]), %%xmm2")            /* xmm2 = S + T */ \
+            __ASM_EMIT("pand            0x30(%[P]), %%xmm2")            /* xmm2 = J = (S + T) & M */ \
+            __ASM_EMIT("pslld           $2, %%xmm2")                    /* xmm2 = J * sizeof(float) */ \
+            __ASM_EMIT("movdqa          %%xmm2, 0x80(%[P])") \
+            __ASM_EMIT("mov             0x80(%[P]), %k[t]") \
+            __ASM_EMIT("add             %[buf], %[t]") \
+            __ASM_EMIT("movups          0x00(%[t]), %%xmm2")            /* xmm2 = a0 a1 a2 a3 */ \
+            __ASM_EMIT("mov             0x84(%[P]), %k[t]") \
+            __ASM_EMIT("add             %[buf], %[t]") \
+            __ASM_EMIT("movups          0x00(%[t]), %%xmm3")            /* xmm3 = b0 b1 b2 b3 */ \
+            __ASM_EMIT("mov             0x88(%[P]), %k[t]") \
+            __ASM_EMIT("add             %[buf], %[t]") \
+            __ASM_EMIT("movups          0x00(%[t]), %%xmm4")            /* xmm4 = c0 c1 c2 c3 */ \
+            __ASM_EMIT("mov             0x8c(%[P]), %k[t]") \
+            __ASM_EMIT("add             %[buf], %[t]") \
+            __ASM_EMIT("movups          0x00(%[t]), %%xmm5")            /* xmm5 = d0 d1 d2 d3 */ \
+            /* Transpose */ \
+            __ASM_EMIT("movaps          %%xmm2, %%xmm0")                /* xmm0 = a0 a1 a2 a3 */ \
+            __ASM_EMIT("unpcklps        %%xmm3, %%xmm0")                /* xmm0 = a0 b0 a1 b1 */ \
+            __ASM_EMIT("unpckhps        %%xmm3, %%xmm2")                /* xmm2 = a2 b2 a3 b3 */ \
+            __ASM_EMIT("movaps          %%xmm4, %%xmm6")                /* xmm6 = c0 c1 c2 c3 */ \
+            __ASM_EMIT("unpcklps        %%xmm5, %%xmm6")                /* xmm6 = c0 d0 c1 d1 */ \
+            __ASM_EMIT("unpckhps        %%xmm5, %%xmm4")                /* xmm4 = c2 d2 c3 d3 */ \
+            __ASM_EMIT("movaps          %%xmm4, %%xmm5")                /* xmm5 = c2 d2 c3 d3 */ \
+            __ASM_EMIT("movhlps         %%xmm2, %%xmm5")                /* xmm5 = a3 b3 c3 d3 = x[k+2] */ \
+            __ASM_EMIT("movlhps         %%xmm4, %%xmm2")                /* xmm2 = a2 b2 c2 d2 = x[k+1] */ \
+            __ASM_EMIT("movaps          %%xmm6, %%xmm3")                /* xmm3 = c0 d0 c1 d1 */ \
+            __ASM_EMIT("movhlps         %%xmm0, %%xmm3")                /* xmm3 = a1 b1 c1 d1 = x[k] */ \
+            __ASM_EMIT("movlhps         %%xmm6, %%xmm0")                /* xmm0 = a0 b0 c0 d0 = x[k-1] */
+
+        /* xmm0 = x[k-1], xmm3 = x[k], xmm2 = x[k+1], xmm5 = x[k+2], xmm1 = F, result in xmm5 */
+        #define DELAY_LINEAR_CORE \
+            __ASM_EMIT("movaps          %%xmm2, %%xmm5")                /* xmm5 = x[k+1] */ \
+            __ASM_EMIT("subps           %%xmm3, %%xmm5")                /* xmm5 = x[k+1] - x[k] */ \
+            __ASM_EMIT("mulps           %%xmm1, %%xmm5")                /* xmm5 = (x[k+1] - x[k])*F */ \
+            __ASM_EMIT("addps           %%xmm3, %%xmm5")                /* xmm5 = x[k] + (x[k+1] - x[k])*F */
+
+        #define DELAY_CUBIC_TERMS \
+            __ASM_EMIT("movaps          %%xmm2, %%xmm4")                /* xmm4 = x[k+1] */ \
+            __ASM_EMIT("movaps          %%xmm2, %%xmm6")                /* xmm6 = x[k+1] */ \
+            __ASM_EMIT("subps           %%xmm0, %%xmm4")                /* xmm4 = x[k+1] - x[k-1] */ \
+            __ASM_EMIT("addps           %%xmm0, %%xmm6")                /* xmm6 = x[k-1] + x[k+1] */ \
+            __ASM_EMIT("subps           %%xmm0, %%xmm5")                /* xmm5 = x[k+2] - x[k-1] */ \
+            __ASM_EMIT("movaps          %%xmm3, %%xmm0")                /* xmm0 = x[k] */ \
+            __ASM_EMIT("subps           %%xmm2, %%xmm0")                /* xmm0 = x[k] - x[k+1] */ \
+            __ASM_EMIT("mulps           0x50(%[P]), %%xmm4")            /* xmm4 = h = 0.5*(x[k+1] - x[k-1]) */ \
+            __ASM_EMIT("mulps           0x50(%[P]), %%xmm6")            /* xmm6 = 0.5*(x[k-1] + x[k+1]) */ \
+            __ASM_EMIT("subps           %%xmm3, %%xmm6")                /* xmm6 = q = 0.5*(x[k-1] + x[k+1]) - x[k] */ \
+            __ASM_EMIT("mulps           0x60(%[P]), %%xmm5")            /* xmm5 = K1*(x[k+2] - x[k-1]) */ \
+            __ASM_EMIT("mulps           0x70(%[P]), %%xmm0")            /* xmm0 = K2*(x[k] - x[k+1]) */ \
+            __ASM_EMIT("addps           %%xmm0, %%xmm5")                /* xmm5 = c3 */
+
+        #define DELAY_CUBIC_POLY \
+            /* xmm5 = c3, xmm6 = c2, xmm4 = c1 */ \
+            __ASM_EMIT("mulps           %%xmm1, %%xmm5")                /* xmm5 = c3*F */ \
+            __ASM_EMIT("addps           %%xmm6, %%xmm5")                /* xmm5 = c3*F + c2 */ \
+            __ASM_EMIT("mulps           %%xmm1, %%xmm5")                /* xmm5 = (c3*F + c2)*F */ \
+            __ASM_EMIT("addps           %%xmm4, %%xmm5")                /* xmm5 = (c3*F + c2)*F + c1 */ \
+            __ASM_EMIT("mulps           %%xmm1, %%xmm5")                /* xmm5 = ((c3*F + c2)*F + c1)*F */ \
+            __ASM_EMIT("addps           %%xmm3, %%xmm5")                /* xmm5 = ((c3*F + c2)*F + c1)*F + x[k] */
+
+        #define DELAY_HERMITE_CORE \
+            DELAY_CUBIC_TERMS \
+            __ASM_EMIT("subps           %%xmm5, %%xmm6")                /* xmm6 = c2 = q - c3 */ \
+            DELAY_CUBIC_POLY
+
+        #define DELAY_LAGRANGE_CORE \
+            DELAY_CUBIC_TERMS \
+            __ASM_EMIT("subps           %%xmm5, %%xmm4")                /* xmm4 = c1 = h - c3 */ \
+            DELAY_CUBIC_POLY
+
+        #define DELAY_READ_KERNEL(CORE) \
+            ARCH_X86_ASM( \
+                __ASM_EMIT("movaps          0x00(%[P]), %%xmm7")        /* xmm7 = I */ \
+                __ASM_EMIT("sub             $4, %[count]") \
+                __ASM_EMIT("jb              2f") \
+                __ASM_EMIT("1:") \
+                DELAY_ROWS \
+                CORE \
+                __ASM_EMIT("movups          %%xmm5, 0x00(%[dst])") \
+                __ASM_EMIT("addps           0x10(%[P]), %%xmm7")        /* xmm7 = I + 4 */ \
+                __ASM_EMIT("add             $0x10, %[delay]") \
+                __ASM_EMIT("add             $0x10, %[dst]") \
+                __ASM_EMIT("sub             $4, %[count]") \
+                __ASM_EMIT("jae             1b") \
+                __ASM_EMIT("2:") \
+                : [dst] "+r" (vd), [delay] "+r" (vs), [count] "+r" (n), \
+                  [t] "=&r" (t) \
+                : [P] "r" (&p[0]), [buf] "m" (buf) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            )
+
+        /*
+         * The last incomplete block is processed as the full block with delays padded
+         * by a safe value, so the kernel does not need scalar code
+         */
+        #define DELAY_READ_APPLY(CORE) \
+            float *vd           = dst; \
+            const float *vs     = delay; \
+            size_t n            = count; \
+            size_t t; \
+            DELAY_READ_KERNEL(CORE); \
+            \
+            size_t done         = count & ~size_t(3); \
+            if (done < count) \
+            { \
+                float xd[4] __lsp_aligned16; \
+                float xs[4] __lsp_aligned16; \
+                for (size_t i=0; i<4; ++i) \
+                { \
+                    p[i]                = done + i; \
+                    xs[i]               = (done + i < count) ? delay[done + i] : 2.0f; \
+                } \
+                vd                  = xd; \
+                vs                  = xs; \
+                n                   = 4; \
+                DELAY_READ_KERNEL(CORE); \
+                for (size_t i=done; i<count; ++i) \
+                    dst[i]              = xd[i - done]; \
+            }
+
+        void delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            float p[9*4] __lsp_aligned16;
+            delay_read_init(p, d, count, 0.0f, 0.0f);
+            DELAY_READ_APPLY(DELAY_LINEAR_CORE);
+        }
+
+        void delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            float p[9*4] __lsp_aligned16;
+            delay_read_init(p, d, count, 0.5f, 1.5f);
+            DELAY_READ_APPLY(DELAY_HERMITE_CORE);
+        }
+
+        void delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count)
+        {
+            float p[9*4] __lsp_aligned16;
+            delay_read_init(p, d, count, 1.0f/6.0f, 0.5f);
+            DELAY_READ_APPLY(DELAY_LAGRANGE_CORE);
+        }
+
+        #undef DELAY_READ_APPLY
+        #undef DELAY_READ_KERNEL
+        #undef DELAY_LAGRANGE_CORE
+        #undef DELAY_HERMITE_CORE
+        #undef DELAY_CUBIC_POLY
+        #undef DELAY_CUBIC_TERMS
+        #undef DELAY_LINEAR_CORE
+        #undef DELAY_ROWS
+
+        /**
+         * Compute weights of the 4 points x[k-1] .. x[k+2] of the tap
+         * @param w weights of points, 4 vectors
+         * @param tap tap descriptor
+         * @return offset of the x[k-1] point relative to the sample being read
+         */
+        static int32_t delay_tap_weights(float *w, const dsp::delay_tap_t *tap)
+        {
+            float v[4];
+            float p             = -tap->delay;
+            float t             = floorf(p);
+            float f             = p - t;
+            float g             = tap->gain;
+
+            switch (tap->interp)
+            {
+                case dsp::DELAY_HERMITE:
+                {
+                    float f2            = f * f;
+                    float f3            = f2 * f;
+                    v[0]                = (-0.5f*f3 + f2 - 0.5f*f) * g;
+                    v[1]                = (1.5f*f3 - 2.5f*f2 + 1.0f) * g;
+                    v[2]                = (-1.5f*f3 + 2.0f*f2 + 0.5f*f) * g;
+                    v[3]                = (0.5f*f3 - 0.5f*f2) * g;
+                    break;
+                }
+                case dsp::DELAY_LAGRANGE:
+                {
+                    float fp            = f + 1.0f;
+                    float fm            = f - 1.0f;
+                    float fm2           = f - 2.0f;
+                    v[0]                = (-f * fm * fm2 * (1.0f/6.0f)) * g;
+                    v[1]                = (fp * fm * fm2 * 0.5f) * g;
+                    v[2]                = (-fp * f * fm2 * 0.5f) * g;
+                    v[3]                = (fp * f * fm * (1.0f/6.0f)) * g;
+                    break;
+                }
+                default:
+                    v[0]                = 0.0f;
+                    v[1]                = (1.0f - f) * g;
+                    v[2]                = f * g;
+                    v[3]                = 0.0f;
+                    break;
+            }
+
+            for (size_t i=0; i<4; ++i)
+            {
+                w[i]                = v[0];
+                w[i + 4]            = v[1];
+                w[i + 8]            = v[2];
+                w[i + 12]           = v[3];
+            }
+
+            return int32_t(t) - 1;
+        }
+
+        /* MV and MUL are load and multiply instructions: "movups" and "mulps" for 4x blocks, "movss" and "mulss" for 1x blocks */
+        #define DELAY_TAP_SUM(MV, MUL) \
+            __ASM_EMIT("mov             (%[J], %[k], 4), %k[idx]")      /* idx = J[k] */ \
+            __ASM_EMIT("add             %k[i], %k[idx]")                /* idx = J[k] + i */ \
+            __ASM_EMIT("and             %[mask], %k[idx]")              /* idx = (J[k] + i) & M */ \
+            __ASM_EMIT(MV "          0x00(%[buf], %[idx], 4), %%xmm1") /* xmm1 = x[k-1] */ \
+            __ASM_EMIT(MV "          0x04(%[buf], %[idx], 4), %%xmm2") /* xmm2 = x[k] */ \
+            __ASM_EMIT(MV "          0x08(%[buf], %[idx], 4), %%xmm3") /* xmm3 = x[k+1] */ \
+            __ASM_EMIT(MV "          0x0c(%[buf], %[idx], 4), %%xmm4") /* xmm4 = x[k+2] */ \
+            __ASM_EMIT(MUL "           0x00(%[w]), %%xmm1")          /* xmm1 = w0*x[k-1] */ \
+            __ASM_EMIT(MUL "           0x10(%[w]), %%xmm2")          /* xmm2 = w1*x[k] */ \
+            __ASM_EMIT(MUL "           0x20(%[w]), %%xmm3")          /* xmm3 = w2*x[k+1] */ \
+            __ASM_EMIT(MUL "           0x30(%[w]), %%xmm4")          /* xmm4 = w3*x[k+2] */ \
+            __ASM_EMIT("addps           %%xmm2, %%xmm1") \
+            __ASM_EMIT("addps           %%xmm3, %%xmm1") \
+            __ASM_EMIT("addps           %%xmm4, %%xmm1") \
+            __ASM_EMIT("addps           %%xmm1, %%xmm0")                /* xmm0 = S + sum(w*x) */ \
+            __ASM_EMIT("add             $0x40, %[w]") \
+            __ASM_EMIT("inc             %[k]") \
+            __ASM_EMIT("cmp             %[nt], %[k]")
+
+        #define DELAY_TAPS_ZERO(MV) \
+            __ASM_EMIT("xorps           %%xmm0, %%xmm0")
+
+        #define DELAY_TAPS_LOAD(MV) \
+            __ASM_EMIT(MV "          0x00(%[dst]), %%xmm0")
+
+        #define DELAY_TAPS_KERNEL(INIT) \
+            ARCH_X86_64_ASM( \
+                __ASM_EMIT("xor             %[i], %[i]") \
+                __ASM_EMIT("sub             $4, %[count]") \
+                __ASM_EMIT("jb              3f") \
+                /* 4x blocks */ \
+                __ASM_EMIT("1:") \
+                INIT("movups") \
+                __ASM_EMIT("xor             %[k], %[k]") \
+                __ASM_EMIT("mov             %[W], %[w]") \
+                __ASM_EMIT("2:") \
+                DELAY_TAP_SUM("movups", "mulps") \
+                __ASM_EMIT("jb              2b") \
+                __ASM_EMIT("movups          %%xmm0, 0x00(%[dst])") \
+                __ASM_EMIT("add             $0x10, %[dst]") \
+                __ASM_EMIT("add             $4, %[i]") \
+                __ASM_EMIT("sub             $4, %[count]") \
+                __ASM_EMIT("jae             1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("3:") \
+                __ASM_EMIT("add             $3, %[count]") \
+                __ASM_EMIT("jl              6f") \
+                __ASM_EMIT("4:") \
+                INIT("movss ") \
+                __ASM_EMIT("xor             %[k], %[k]") \
+                __ASM_EMIT("mov             %[W], %[w]") \
+                __ASM_EMIT("5:") \
+                DELAY_TAP_SUM("movss ", "mulss") \
+                __ASM_EMIT("jb              5b") \
+                __ASM_EMIT("movss           %%xmm0, 0x00(%[dst])") \
+                __ASM_EMIT("add             $0x04, %[dst]") \
+                __ASM_EMIT("inc             %[i]") \
+                __ASM_EMIT("dec             %[count]") \
+                __ASM_EMIT("jge             4b") \
+                __ASM_EMIT("6:") \
+                : [dst] "+r" (vd), [count] "+r" (n), \
+                  [i] "=&r" (i), [k] "=&r" (k), [w] "=&r" (pw), [idx] "=&r" (idx) \
+                : [buf] "r" (buf), [W] "r" (&w[0]), [J] "r" (&j[0]), \
+                  [mask] "m" (mask), [nt] "m" (nt) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4" \
+            )
+
+        void x64_delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count)
+        {
+            float w[DELAY_TAPS_BLOCK*16] __lsp_aligned16;
+            uint32_t j[DELAY_TAPS_BLOCK];
+            const uint32_t mask     = d->mask;
+            const uint32_t start    = d->head - count;
+
+            if (ntaps == 0)
+            {
+                dsp::fill_zero(dst, count);
+                return;
+            }
+
+            for (size_t off=0; off < ntaps; off += DELAY_TAPS_BLOCK)
+            {
+                // Prepare the block of taps
+                size_t nt               = ntaps - off;
+                if (nt > DELAY_TAPS_BLOCK)
+                    nt                      = DELAY_TAPS_BLOCK;
+                for (size_t k=0; k<nt; ++k)
+                    j[k]                    = start + delay_tap_weights(&w[k*16], &taps[off + k]);
+
+                // Process all samples with the block of taps
+                float *vd               = dst;
+                size_t n                = count;
+                IF_ARCH_X86_64(size_t i, k, idx; float *pw);
+                if (off == 0)
+                    DELAY_TAPS_KERNEL(DELAY_TAPS_ZERO);
+                else
+                    DELAY_TAPS_KERNEL(DELAY_TAPS_LOAD);
+            }
+        }
+
+        #undef DELAY_TAPS_KERNEL
+        #undef DELAY_TAPS_LOAD
+        #undef DELAY_TAPS_ZERO
+        #undef DELAY_TAP_SUM
+
+    } /* namespace sse2 */
+} /* namespace lsp */
+
+#undef DELAY_TAPS_BLOCK
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_INTERPOLATION_DELAY_H_ */
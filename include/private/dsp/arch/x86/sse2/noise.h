@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_NOISE_H_
+#define PRIVATE_DSP_ARCH_X86_SSE2_NOISE_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_IMPL */
+
+namespace lsp
+{
+    namespace sse2
+    {
+        /**
+         * Prepare parameters of the noise generator
+         * @param p parameters to initialize, 3 vectors
+         * @param K multiplier of the sum of values
+         * @param B bias of the result
+         */
+        static inline void noise_init_params(float *p, float K, float B)
+        {
+            for (size_t i=0; i<4; ++i)
+            {
+                p[i]            = 1.0f;                     // Exponent bits of the values in the range [1, 2)
+                p[i + 4]        = K;
+                p[i + 8]        = B;
+            }
+        }
+
+        /*
+         * Eight lanes of the state row are kept in a pair of registers, rows of the ring
+         * are xmm0-xmm1, xmm2-xmm3, xmm4-xmm5, xmm6-xmm7 in order of age. The step replaces
+         * the oldest row X with the new one, so the roles of registers rotate each step
+         * and return back after four steps.
+         */
+        #define NOISE_R0        "%%xmm0", "%%xmm1"
+        #define NOISE_R1        "%%xmm2", "%%xmm3"
+        #define NOISE_R2        "%%xmm4", "%%xmm5"
+        #define NOISE_R3        "%%xmm6", "%%xmm7"
+
+        #define NOISE_STEP(X, W)    NOISE_STEP_X(X, W)
+        #define NOISE_STEP_X(X0, X1, W0, W1) \
+            __ASM_EMIT("movdqa          " X0 ", %%xmm8") \
+            __ASM_EMIT("movdqa          " X1 ", %%xmm9") \
+            __ASM_EMIT("pslld           $11, %%xmm8") \
+            __ASM_EMIT("pslld           $11, %%xmm9") \
+            __ASM_EMIT("pxor            %%xmm8, " X0)                   /* x = t = x ^ (x << 11) */ \
+            __ASM_EMIT("pxor            %%xmm9, " X1) \
+            __ASM_EMIT("movdqa          " X0 ", %%xmm8") \
+            __ASM_EMIT("movdqa          " X1 ", %%xmm9") \
+            __ASM_EMIT("psrld           $8, %%xmm8") \
+            __ASM_EMIT("psrld           $8, %%xmm9") \
+            __ASM_EMIT("pxor            %%xmm8, " X0)                   /* x = t ^ (t >> 8) */ \
+            __ASM_EMIT("pxor            %%xmm9, " X1) \
+            __ASM_EMIT("movdqa          " W0 ", %%xmm8") \
+            __ASM_EMIT("movdqa          " W1 ", %%xmm9") \
+            __ASM_EMIT("psrld           $19, %%xmm8") \
+            __ASM_EMIT("psrld           $19, %%xmm9") \
+            __ASM_EMIT("pxor            " W0 ", " X0) \
+            __ASM_EMIT("pxor            " W1 ", " X1) \
+            __ASM_EMIT("pxor            %%xmm8, " X0)                   /* x = w ^ (w >> 19) ^ t ^ (t >> 8) */ \
+            __ASM_EMIT("pxor            %%xmm9, " X1)
+
+        #define NOISE_FIRST(X)      NOISE_FIRST_X(X)
+        #define NOISE_FIRST_X(X0, X1) \
+            __ASM_EMIT("movdqa          " X0 ", %%xmm10") \
+            __ASM_EMIT("movdqa          " X1 ", %%xmm11") \
+            __ASM_EMIT("psrld           $9, %%xmm10") \
+            __ASM_EMIT("psrld           $9, %%xmm11") \
+            __ASM_EMIT("por             %%xmm12, %%xmm10")              /* xmm10 = S = u */ \
+            __ASM_EMIT("por             %%xmm12, %%xmm11")
+
+        #define NOISE_NEXT(X)       NOISE_NEXT_X(X)
+        #define NOISE_NEXT_X(X0, X1) \
+            __ASM_EMIT("movdqa          " X0 ", %%xmm8") \
+            __ASM_EMIT("movdqa          " X1 ", %%xmm9") \
+            __ASM_EMIT("psrld           $9, %%xmm8") \
+            __ASM_EMIT("psrld           $9, %%xmm9") \
+            __ASM_EMIT("por             %%xmm12, %%xmm8")               /* xmm8 = u */ \
+            __ASM_EMIT("por             %%xmm12, %%xmm9") \
+            __ASM_EMIT("addps           %%xmm8, %%xmm10")               /* xmm10 = S + u */ \
+            __ASM_EMIT("addps           %%xmm9, %%xmm11")
+
+        #define NOISE_STORE \
+            __ASM_EMIT("mulps           %%xmm13, %%xmm10")              /* xmm10 = S*K */ \
+            __ASM_EMIT("mulps           %%xmm13, %%xmm11") \
+            __ASM_EMIT("subps           %%xmm14, %%xmm10")              /* xmm10 = S*K - B */ \
+            __ASM_EMIT("subps           %%xmm14, %%xmm11") \
+            __ASM_EMIT("movups          %%xmm10, 0x00(%[dst])") \
+            __ASM_EMIT("movups          %%xmm11, 0x10(%[dst])") \
+            __ASM_EMIT("add             $0x20, %[dst]")
+
+        /* 1 step per block */
+        #define NOISE_UNIFORM \
+            __ASM_EMIT("sub             $4, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            __ASM_EMIT("1:") \
+            NOISE_STEP(NOISE_R0, NOISE_R3) \
+            NOISE_FIRST(NOISE_R0) \
+            NOISE_STORE \
+            NOISE_STEP(NOISE_R1, NOISE_R0) \
+            NOISE_FIRST(NOISE_R1) \
+            NOISE_STORE \
+            NOISE_STEP(NOISE_R2, NOISE_R1) \
+            NOISE_FIRST(NOISE_R2) \
+            NOISE_STORE \
+            NOISE_STEP(NOISE_R3, NOISE_R2) \
+            NOISE_FIRST(NOISE_R3) \
+            NOISE_STORE \
+            __ASM_EMIT("sub             $4, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add             $4, %[count]") \
+            __ASM_EMIT("jz              3f") \
+            NOISE_STEP(NOISE_R0, NOISE_R3) \
+            NOISE_FIRST(NOISE_R0) \
+            NOISE_STORE \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jz              3f") \
+            NOISE_STEP(NOISE_R1, NOISE_R0) \
+            NOISE_FIRST(NOISE_R1) \
+            NOISE_STORE \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jz              3f") \
+            NOISE_STEP(NOISE_R2, NOISE_R1) \
+            NOISE_FIRST(NOISE_R2) \
+            NOISE_STORE \
+            __ASM_EMIT("3:")
+
+        /* 2 steps per block */
+        #define NOISE_TPDF \
+            __ASM_EMIT("sub             $2, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            __ASM_EMIT("1:") \
+            NOISE_STEP(NOISE_R0, NOISE_R3) \
+            NOISE_FIRST(NOISE_R0) \
+            NOISE_STEP(NOISE_R1, NOISE_R0) \
+            NOISE_NEXT(NOISE_R1) \
+            NOISE_STORE \
+            NOISE_STEP(NOISE_R2, NOISE_R1) \
+            NOISE_FIRST(NOISE_R2) \
+            NOISE_STEP(NOISE_R3, NOISE_R2) \
+            NOISE_NEXT(NOISE_R3) \
+            NOISE_STORE \
+            __ASM_EMIT("sub             $2, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add             $2, %[count]") \
+            __ASM_EMIT("jz              3f") \
+            NOISE_STEP(NOISE_R0, NOISE_R3) \
+            NOISE_FIRST(NOISE_R0) \
+            NOISE_STEP(NOISE_R1, NOISE_R0) \
+            NOISE_NEXT(NOISE_R1) \
+            NOISE_STORE \
+            __ASM_EMIT("3:")
+
+        /* 4 steps per block */
+        #define NOISE_GAUSSIAN \
+            __ASM_EMIT("test            %[count], %[count]") \
+            __ASM_EMIT("jz              2f") \
+            __ASM_EMIT("1:") \
+            NOISE_STEP(NOISE_R0, NOISE_R3) \
+            NOISE_FIRST(NOISE_R0) \
+            NOISE_STEP(NOISE_R1, NOISE_R0) \
+            NOISE_NEXT(NOISE_R1) \
+            NOISE_STEP(NOISE_R2, NOISE_R1) \
+            NOISE_NEXT(NOISE_R2) \
+            NOISE_STEP(NOISE_R3, NOISE_R2) \
+            NOISE_NEXT(NOISE_R3) \
+            NOISE_STORE \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jnz             1b") \
+            __ASM_EMIT("2:")
+
+        /*
+         * Generate BLOCKS blocks of 8 samples: load the ring in order of age starting
+         * from the oldest row, run the generator and store the rows back in place
+         */
+        #define NOISE_KERNEL(BODY, DST, BLOCKS) \
+        { \
+            IF_ARCH_X86_64(float *vd = DST; size_t nb = BLOCKS); \
+            ARCH_X86_64_ASM( \
+                __ASM_EMIT("movdqu          0x00(%[s0]), %%xmm0") \
+                __ASM_EMIT("movdqu          0x10(%[s0]), %%xmm1") \
+                __ASM_EMIT("movdqu          0x00(%[s1]), %%xmm2") \
+                __ASM_EMIT("movdqu          0x10(%[s1]), %%xmm3") \
+                __ASM_EMIT("movdqu          0x00(%[s2]), %%xmm4") \
+                __ASM_EMIT("movdqu          0x10(%[s2]), %%xmm5") \
+                __ASM_EMIT("movdqu          0x00(%[s3]), %%xmm6") \
+                __ASM_EMIT("movdqu          0x10(%[s3]), %%xmm7") \
+                __ASM_EMIT("movaps          0x00(%[P]), %%xmm12")           /* xmm12 = 1 */ \
+                __ASM_EMIT("movaps          0x10(%[P]), %%xmm13")           /* xmm13 = K */ \
+                __ASM_EMIT("movaps          0x20(%[P]), %%xmm14")           /* xmm14 = B */ \
+                BODY \
+                __ASM_EMIT("movdqu          %%xmm0, 0x00(%[s0])") \
+                __ASM_EMIT("movdqu          %%xmm1, 0x10(%[s0])") \
+                __ASM_EMIT("movdqu          %%xmm2, 0x00(%[s1])") \
+                __ASM_EMIT("movdqu          %%xmm3, 0x10(%[s1])") \
+                __ASM_EMIT("movdqu          %%xmm4, 0x00(%[s2])") \
+                __ASM_EMIT("movdqu          %%xmm5, 0x10(%[s2])") \
+                __ASM_EMIT("movdqu          %%xmm6, 0x00(%[s3])") \
+                __ASM_EMIT("movdqu          %%xmm7, 0x10(%[s3])") \
+                : [dst] "+r" (vd), [count] "+r" (nb) \
+                : [s0] "r" (n->s[n->index]), [s1] "r" (n->s[(n->index + 1) & 3]), \
+                  [s2] "r" (n->s[(n->index + 2) & 3]), [s3] "r" (n->s[(n->index + 3) & 3]), \
+                  [P] "r" (&p[0]) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7", \
+                  "%xmm8", "%xmm9", "%xmm10", "%xmm11", \
+                  "%xmm12", "%xmm13", "%xmm14" \
+            ); \
+        }
+
+        #define NOISE_GENERATE(BODY, STEPS, K, B) \
+            float p[12] __lsp_aligned16; \
+            float xd[8] __lsp_aligned16; \
+            size_t blocks = count >> 3; \
+            noise_init_params(p, K, B); \
+            if (blocks > 0) \
+            { \
+                NOISE_KERNEL(BODY, dst, blocks); \
+                n->index        = (n->index + blocks * STEPS) & 3; \
+                dst            += blocks << 3; \
+            } \
+            if (count & 7) \
+            { \
+                NOISE_KERNEL(BODY, xd, 1); \
+                n->index        = (n->index + STEPS) & 3; \
+                for (size_t i=0; i < (count & 7); ++i) \
+                    dst[i]          = xd[i]; \
+            }
+
+        void x64_noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count)
+        {
+            NOISE_GENERATE(NOISE_UNIFORM, 1, 2.0f * k, 3.0f * k);
+        }
+
+        void x64_noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count)
+        {
+            NOISE_GENERATE(NOISE_TPDF, 2, k, 3.0f * k);
+        }
+
+        void x64_noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count)
+        {
+            const float K   = 1.7320508f * s; // sqrt(3) * s
+            NOISE_GENERATE(NOISE_GAUSSIAN, 4, K, 6.0f * K);
+        }
+
+        #undef NOISE_GENERATE
+        #undef NOISE_KERNEL
+        #undef NOISE_GAUSSIAN
+        #undef NOISE_TPDF
+        #undef NOISE_UNIFORM
+        #undef NOISE_STORE
+        #undef NOISE_NEXT_X
+        #undef NOISE_NEXT
+        #undef NOISE_FIRST_X
+        #undef NOISE_FIRST
+        #undef NOISE_STEP_X
+        #undef NOISE_STEP
+        #undef NOISE_R3
+        #undef NOISE_R2
+        #undef NOISE_R1
+        #undef NOISE_R0
+
+    } /* namespace sse2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_NOISE_H_ */
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_SHAPER_H_
+#define PRIVATE_DSP_ARCH_X86_SSE2_SHAPER_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_IMPL */
+
+namespace lsp
+{
+    namespace sse2
+    {
+        /**
+         * Prepare parameters of the waveshaper
+         * @param p parameters to initialize, 7 vectors
+         * @param s waveshaper descriptor
+         */
+        static void shaper_init_params(float *p, const dsp::shaper_t *s)
+        {
+            for (size_t i=0; i<4; ++i)
+            {
+                p[i]            = s->scale;
+                p[i + 4]        = s->offset;
+                p[i + 8]        = s->last;
+                p[i + 12]       = 0.5f;
+                p[i + 16]       = 0.5f;                     // K1 of the Hermite spline
+                p[i + 20]       = 1.5f;                     // K2 of the Hermite spline
+                p[i + 24]       = 0.0f;                     // J = byte offsets of rows
+            }
+        }
+
+        /*
+         * Compute table positions of 4 samples, clamp them, split into integer and
+         * fractional parts and load rows c[k-1] .. c[k+2] of each sample into xmm0, xmm3, xmm2, xmm5
+         */
+        #define SHAPER_ROWS \
+            __ASM_EMIT("movups          0x00(%[src]), %%xmm1")          /* xmm1 = x */ \
+            __ASM_EMIT("xorps           %%xmm0, %%xmm0")                /* xmm0 = 0 */ \
+            __ASM_EMIT("mulps           0x00(%[P]), %%xmm1")            /* xmm1 = x*scale */ \
+            __ASM_EMIT("addps           0x10(%[P]), %%xmm1")            /* xmm1 = u = x*scale + offset */ \
+            __ASM_EMIT("maxps           %%xmm0, %%xmm1")                /* xmm1 = (u > 0) ? u : 0 */ \
+            __ASM_EMIT("minps           0x20(%[P]), %%xmm1")            /* xmm1 = U = (u < last) ? u : last */ \
+            __ASM_EMIT("cvttps2dq       %%xmm1, %%xmm2")                /* xmm2 = K = int(U) */ \
+            __ASM_EMIT("cvtdq2ps        %%xmm2, %%xmm3")                /* xmm3 = float(K) */ \
+            __ASM_EMIT("subps           %%xmm3, %%xmm1")                /* xmm1 = F = U - K */ \
+            __ASM_EMIT("pslld           $2, %%xmm2")                    /* xmm2 = K * sizeof(float) */ \
+            __ASM_EMIT("movdqa          %%xmm2, 0x60(%[P])") \
+            __ASM_EMIT("mov             0x60(%[P]), %k[t]") \
+            __ASM_EMIT("add             %[buf], %[t]") \
+            __ASM_EMIT("movups          0x00(%[t]), %%xmm2")            /* xmm2 = a0 a1 a2 a3 */ \
+            __ASM_EMIT("mov             0x64(%[P]), %k[t]") \
+            __ASM_EMIT("add             %[buf], %[t]") \
+            __ASM_EMIT("movups          0x00(%[t]), %%xmm3")            /* xmm3 = b0 b1 b2 b3 */ \
+            __ASM_EMIT("mov             0x68(%[P]), %k[t]") \
+            __ASM_EMIT("add             %[buf], %[t]") \
+            __ASM_EMIT("movups          0x00(%[t]), %%xmm4")            /* xmm4 = c0 c1 c2 c3 */ \
+            __ASM_EMIT("mov             0x6c(%[P]), %k[t]") \
+            __ASM_EMIT("add             %[buf], %[t]") \
+            __ASM_EMIT("movups          0x00(%[t]), %%xmm5")            /* xmm5 = d0 d1 d2 d3 */ \
+            /* Transpose */ \
+            __ASM_EMIT("movaps          %%xmm2, %%xmm0")                /* xmm0 = a0 a1 a2 a3 */ \
+            __ASM_EMIT("unpcklps        %%xmm3, %%xmm0")                /* xmm0 = a0 b0 a1 b1 */ \
+            __ASM_EMIT("unpckhps        %%xmm3, %%xmm2")                /* xmm2 = a2 b2 a3 b3 */ \
+            __ASM_EMIT("movaps          %%xmm4, %%xmm6")                /* xmm6 = c0 c1 c2 c3 */ \
+            __ASM_EMIT("unpcklps        %%xmm5, %%xmm6")                /* xmm6 = c0 d0 c1 d1 */ \
+            __ASM_EMIT("unpckhps        %%xmm5, %%xmm4")                /* xmm4 = c2 d2 c3 d3 */ \
+            __ASM_EMIT("movaps          %%xmm4, %%xmm5")                /* xmm5 = c2 d2 c3 d3 */ \
+            __ASM_EMIT("movhlps         %%xmm2, %%xmm5")                /* xmm5 = a3 b3 c3 d3 = c[k+2] */ \
+            __ASM_EMIT("movlhps         %%xmm4, %%xmm2")                /* xmm2 = a2 b2 c2 d2 = c[k+1] */ \
+            __ASM_EMIT("movaps          %%xmm6, %%xmm3")                /* xmm3 = c0 d0 c1 d1 */ \
+            __ASM_EMIT("movhlps         %%xmm0, %%xmm3")                /* xmm3 = a1 b1 c1 d1 = c[k] */ \
+            __ASM_EMIT("movlhps         %%xmm6, %%xmm0")                /* xmm0 = a0 b0 c0 d0 = c[k-1] */
+
+        /* xmm0 = c[k-1], xmm3 = c[k], xmm2 = c[k+1], xmm5 = c[k+2], xmm1 = F, result in xmm5 */
+        #define SHAPER_LINEAR_CORE \
+            __ASM_EMIT("movaps          %%xmm2, %%xmm5")                /* xmm5 = c[k+1] */ \
+            __ASM_EMIT("subps           %%xmm3, %%xmm5")                /* xmm5 = c[k+1] - c[k] */ \
+            __ASM_EMIT("mulps           %%xmm1, %%xmm5")                /* xmm5 = (c[k+1] - c[k])*F */ \
+            __ASM_EMIT("addps           %%xmm3, %%xmm5")                /* xmm5 = c[k] + (c[k+1] - c[k])*F */
+
+        #define SHAPER_CUBIC_CORE \
+            __ASM_EMIT("movaps          %%xmm2, %%xmm4")                /* xmm4 = c[k+1] */ \
+            __ASM_EMIT("movaps          %%xmm2, %%xmm6")                /* xmm6 = c[k+1] */ \
+            __ASM_EMIT("subps           %%xmm0, %%xmm4")                /* xmm4 = c[k+1] - c[k-1] */ \
+            __ASM_EMIT("addps           %%xmm0, %%xmm6")                /* xmm6 = c[k-1] + c[k+1] */ \
+            __ASM_EMIT("subps           %%xmm0, %%xmm5")                /* xmm5 = c[k+2] - c[k-1] */ \
+            __ASM_EMIT("movaps          %%xmm3, %%xmm0")                /* xmm0 = c[k] */ \
+            __ASM_EMIT("subps           %%xmm2, %%xmm0")                /* xmm0 = c[k] - c[k+1] */ \
+            __ASM_EMIT("mulps           0x30(%[P]), %%xmm4")            /* xmm4 = h = 0.5*(c[k+1] - c[k-1]) */ \
+            __ASM_EMIT("mulps           0x30(%[P]), %%xmm6")            /* xmm6 = 0.5*(c[k-1] + c[k+1]) */ \
+            __ASM_EMIT("subps           %%xmm3, %%xmm6")                /* xmm6 = q = 0.5*(c[k-1] + c[k+1]) - c[k] */ \
+            __ASM_EMIT("mulps           0x40(%[P]), %%xmm5")            /* xmm5 = K1*(c[k+2] - c[k-1]) */ \
+            __ASM_EMIT("mulps           0x50(%[P]), %%xmm0")            /* xmm0 = K2*(c[k] - c[k+1]) */ \
+            __ASM_EMIT("addps           %%xmm0, %%xmm5")                /* xmm5 = c3 */ \
+            __ASM_EMIT("subps           %%xmm5, %%xmm6")                /* xmm6 = c2 = q - c3 */ \
+            __ASM_EMIT("mulps           %%xmm1, %%xmm5")                /* xmm5 = c3*F */ \
+            __ASM_EMIT("addps           %%xmm6, %%xmm5")                /* xmm5 = c3*F + c2 */ \
+            __ASM_EMIT("mulps           %%xmm1, %%xmm5")                /* xmm5 = (c3*F + c2)*F */ \
+            __ASM_EMIT("addps           %%xmm4, %%xmm5")                /* xmm5 = (c3*F + c2)*F + h */ \
+            __ASM_EMIT("mulps           %%xmm1, %%xmm5")                /* xmm5 = ((c3*F + c2)*F + h)*F */ \
+            __ASM_EMIT("addps           %%xmm3, %%xmm5")                /* xmm5 = ((c3*F + c2)*F + h)*F + c[k] */
+
+        #define SHAPER_KERNEL(CORE) \
+            ARCH_X86_ASM( \
+                __ASM_EMIT("sub             $4, %[count]") \
+                __ASM_EMIT("jb              2f") \
+                __ASM_EMIT("1:") \
+                SHAPER_ROWS \
+                CORE \
+                __ASM_EMIT("movups          %%xmm5, 0x00(%[dst])") \
+                __ASM_EMIT("add             $0x10, %[src]") \
+                __ASM_EMIT("add             $0x10, %[dst]") \
+                __ASM_EMIT("sub             $4, %[count]") \
+                __ASM_EMIT("jae             1b") \
+                __ASM_EMIT("2:") \
+                : [dst] "+r" (vd), [src] "+r" (vs), [count] "+r" (n), \
+                  [t] "=&r" (t) \
+                : [P] "r" (&p[0]), [buf] "m" (buf) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6" \
+            )
+
+        /*
+         * The last incomplete block is processed as the full block padded by zeros,
+         * so the kernel does not need scalar code
+         */
+        #define SHAPER_APPLY(CORE) \
+            float *vd           = dst; \
+            const float *vs     = src; \
+            size_t n            = count; \
+            size_t t; \
+            SHAPER_KERNEL(CORE); \
+            \
+            size_t done         = count & ~size_t(3); \
+            if (done < count) \
+            { \
+                float xd[4] __lsp_aligned16; \
+                float xs[4] __lsp_aligned16; \
+                for (size_t i=0; i<4; ++i) \
+                    xs[i]               = (done + i < count) ? src[done + i] : 0.0f; \
+                vd                  = xd; \
+                vs                  = xs; \
+                n                   = 4; \
+                SHAPER_KERNEL(CORE); \
+                for (size_t i=done; i<count; ++i) \
+                    dst[i]              = xd[i - done]; \
+            }
+
+        void shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count)
+        {
+            float p[7*4] __lsp_aligned16;
+            shaper_init_params(p, s);
+            SHAPER_APPLY(SHAPER_LINEAR_CORE);
+        }
+
+        void shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count)
+        {
+            float p[7*4] __lsp_aligned16;
+            shaper_init_params(p, s);
+            SHAPER_APPLY(SHAPER_CUBIC_CORE);
+        }
+
+        #undef SHAPER_APPLY
+        #undef SHAPER_KERNEL
+        #undef SHAPER_CUBIC_CORE
+        #undef SHAPER_LINEAR_CORE
+        #undef SHAPER_ROWS
+
+    } /* namespace sse2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_SHAPER_H_ */
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE3_FILTERS_CROSSOVER_H_
+#define PRIVATE_DSP_ARCH_X86_SSE3_FILTERS_CROSSOVER_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE3_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE3_IMPL */
+
+/*
+    Bands are processed by groups of 4 in parallel lanes. For each block of 4 samples
+    all sections of the crossover are applied to 4 broadcasted samples, so the memory
+    and coefficients of the section are loaded once per block. Then the block is
+    transposed and stored to 4 destination buffers.
+
+    Lanes of the group that do not match any band have identity sections and store
+    the data to the buffer of the first band of the group. Stores are performed in
+    descending order of lanes, so the valid data is always written last.
+
+    Register allocation:
+      xmm0-xmm3     = samples of 4 time steps
+      xmm4-xmm5     = memory of the section d0, d1
+      xmm6-xmm7     = temporaries
+      xmm8-xmm12    = coefficients of the section b0, b1, b2, a1, a2
+ */
+
+// Load coefficients and memory of the section
+#define XO_LOAD \
+    __ASM_EMIT("movups      0x00(%[f]), %%xmm8")                /* xmm8  = b0 */ \
+    __ASM_EMIT("movups      0x20(%[f]), %%xmm9")                /* xmm9  = b1 */ \
+    __ASM_EMIT("movups      0x40(%[f]), %%xmm10")               /* xmm10 = b2 */ \
+    __ASM_EMIT("movups      0x60(%[f]), %%xmm11")               /* xmm11 = a1 */ \
+    __ASM_EMIT("movups      0x80(%[f]), %%xmm12")               /* xmm12 = a2 */ \
+    __ASM_EMIT("movups      0x00(%[d]), %%xmm4")                /* xmm4  = d0 */ \
+    __ASM_EMIT("movups      0x20(%[d]), %%xmm5")                /* xmm5  = d1 */
+
+// Store memory of the section and move to the next one
+#define XO_STORE \
+    __ASM_EMIT("movups      %%xmm4, 0x00(%[d])") \
+    __ASM_EMIT("movups      %%xmm5, 0x20(%[d])") \
+    __ASM_EMIT("add         $0xa0, %[f]")                       /* f     = next biquad_x8_t */ \
+    __ASM_EMIT("add         $0x40, %[d]")                       /* d     = next d0[8], d1[8] */
+
+// Apply the section to the register x
+#define XO_BIQUAD(x) \
+    __ASM_EMIT("movaps      %%" x ", %%xmm6")                   /* xmm6  = x */ \
+    __ASM_EMIT("movaps      %%" x ", %%xmm7")                   /* xmm7  = x */ \
+    __ASM_EMIT("mulps       %%xmm9, %%xmm6")                    /* xmm6  = b1*x */ \
+    __ASM_EMIT("mulps       %%xmm10, %%xmm7")                   /* xmm7  = b2*x */ \
+    __ASM_EMIT("mulps       %%xmm8, %%" x)                      /* x     = b0*x */ \
+    __ASM_EMIT("addps       %%xmm4, %%" x)                      /* x     = y = b0*x + d0 */ \
+    __ASM_EMIT("movaps      %%" x ", %%xmm4")                   /* xmm4  = y */ \
+    __ASM_EMIT("mulps       %%xmm11, %%xmm4")                   /* xmm4  = a1*y */ \
+    __ASM_EMIT("addps       %%xmm6, %%xmm4")                    /* xmm4  = b1*x + a1*y */ \
+    __ASM_EMIT("addps       %%xmm5, %%xmm4")                    /* xmm4  = d0' = b1*x + a1*y + d1 */ \
+    __ASM_EMIT("movaps      %%" x ", %%xmm5")                   /* xmm5  = y */ \
+    __ASM_EMIT("mulps       %%xmm12, %%xmm5")                   /* xmm5  = a2*y */ \
+    __ASM_EMIT("addps       %%xmm7, %%xmm5")                    /* xmm5  = d1' = b2*x + a2*y */
+
+namespace lsp
+{
+    namespace sse3
+    {
+        void x64_crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c)
+        {
+            float *vd[4];
+            const float *fb;
+            float *db;
+            size_t n, k;
+            IF_ARCH_X86_64(size_t off, f, d, i, t);
+
+            for (size_t g=0; g<c->bands; g += 4)
+            {
+                for (size_t j=0; j<4; ++j)
+                    vd[j]           = (g + j < c->bands) ? dst[g + j] : dst[g];
+                fb              = &c->stage[0].b0[g];
+                db              = &c->d[g];
+                n               = c->stages;
+                k               = count;
+
+                ARCH_X86_64_ASM(
+                    __ASM_EMIT("xor         %[off], %[off]")
+                    __ASM_EMIT("sub         $4, %[count]")
+                    __ASM_EMIT("jb          2f")
+
+                    // 4x blocks
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("movups      (%[src], %[off]), %%xmm0")      /* xmm0  = s0 s1 s2 s3 */
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm2")
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm3")
+                    __ASM_EMIT("shufps      $0x00, %%xmm0, %%xmm0")         /* xmm0  = s0 s0 s0 s0 */
+                    __ASM_EMIT("shufps      $0x55, %%xmm1, %%xmm1")         /* xmm1  = s1 s1 s1 s1 */
+                    __ASM_EMIT("shufps      $0xaa, %%xmm2, %%xmm2")         /* xmm2  = s2 s2 s2 s2 */
+                    __ASM_EMIT("shufps      $0xff, %%xmm3, %%xmm3")         /* xmm3  = s3 s3 s3 s3 */
+                    __ASM_EMIT("mov         %[FB], %[f]")
+                    __ASM_EMIT("mov         %[DB], %[d]")
+                    __ASM_EMIT("mov         %[N], %[i]")
+                    __ASM_EMIT("3:")
+                    XO_LOAD
+                    XO_BIQUAD("xmm0")
+                    XO_BIQUAD("xmm1")
+                    XO_BIQUAD("xmm2")
+                    XO_BIQUAD("xmm3")
+                    XO_STORE
+                    __ASM_EMIT("dec         %[i]")
+                    __ASM_EMIT("jnz         3b")
+                    // Transpose: xmm0 = a0 a1 a2 a3, xmm1 = b0 b1 b2 b3, ...
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+                    __ASM_EMIT("unpcklps    %%xmm1, %%xmm4")                /* xmm4  = a0 b0 a1 b1 */
+                    __ASM_EMIT("unpckhps    %%xmm1, %%xmm0")                /* xmm0  = a2 b2 a3 b3 */
+                    __ASM_EMIT("movaps      %%xmm2, %%xmm5")
+                    __ASM_EMIT("unpcklps    %%xmm3, %%xmm5")                /* xmm5  = c0 d0 c1 d1 */
+                    __ASM_EMIT("unpckhps    %%xmm3, %%xmm2")                /* xmm2  = c2 d2 c3 d3 */
+                    __ASM_EMIT("movaps      %%xmm4, %%xmm1")
+                    __ASM_EMIT("movlhps     %%xmm5, %%xmm1")                /* xmm1  = a0 b0 c0 d0 */
+                    __ASM_EMIT("movhlps     %%xmm4, %%xmm5")                /* xmm5  = a1 b1 c1 d1 */
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm3")
+                    __ASM_EMIT("movlhps     %%xmm2, %%xmm3")                /* xmm3  = a2 b2 c2 d2 */
+                    __ASM_EMIT("movhlps     %%xmm0, %%xmm2")                /* xmm2  = a3 b3 c3 d3 */
+                    // Store in descending order
+                    __ASM_EMIT("mov         0x18(%[dst]), %[t]")
+                    __ASM_EMIT("movups      %%xmm2, (%[t], %[off])")
+                    __ASM_EMIT("mov         0x10(%[dst]), %[t]")
+                    __ASM_EMIT("movups      %%xmm3, (%[t], %[off])")
+                    __ASM_EMIT("mov         0x08(%[dst]), %[t]")
+                    __ASM_EMIT("movups      %%xmm5, (%[t], %[off])")
+                    __ASM_EMIT("mov         0x00(%[dst]), %[t]")
+                    __ASM_EMIT("movups      %%xmm1, (%[t], %[off])")
+                    __ASM_EMIT("add         $0x10, %[off]")
+                    __ASM_EMIT("sub         $4, %[count]")
+                    __ASM_EMIT("jae         1b")
+
+                    // 1x blocks
+                    __ASM_EMIT("2:")
+                    __ASM_EMIT("add         $3, %[count]")
+                    __ASM_EMIT("jl          4f")
+                    __ASM_EMIT("5:")
+                    __ASM_EMIT("movss       (%[src], %[off]), %%xmm0")      /* xmm0  = s0 */
+                    __ASM_EMIT("shufps      $0x00, %%xmm0, %%xmm0")         /* xmm0  = s0 s0 s0 s0 */
+                    __ASM_EMIT("mov         %[FB], %[f]")
+                    __ASM_EMIT("mov         %[DB], %[d]")
+                    __ASM_EMIT("mov         %[N], %[i]")
+                    __ASM_EMIT("6:")
+                    XO_LOAD
+                    XO_BIQUAD("xmm0")
+                    XO_STORE
+                    __ASM_EMIT("dec         %[i]")
+                    __ASM_EMIT("jnz         6b")
+                    // Store in descending order
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+                    __ASM_EMIT("movhlps     %%xmm0, %%xmm2")                /* xmm2  = a2 a3 ? ? */
+                    __ASM_EMIT("movaps      %%xmm2, %%xmm3")
+                    __ASM_EMIT("shufps      $0x55, %%xmm3, %%xmm3")         /* xmm3  = a3 */
+                    __ASM_EMIT("shufps      $0x55, %%xmm1, %%xmm1")         /* xmm1  = a1 */
+                    __ASM_EMIT("mov         0x18(%[dst]), %[t]")
+                    __ASM_EMIT("movss       %%xmm3, (%[t], %[off])")
+                    __ASM_EMIT("mov         0x10(%[dst]), %[t]")
+                    __ASM_EMIT("movss       %%xmm2, (%[t], %[off])")
+                    __ASM_EMIT("mov         0x08(%[dst]), %[t]")
+                    __ASM_EMIT("movss       %%xmm1, (%[t], %[off])")
+                    __ASM_EMIT("mov         0x00(%[dst]), %[t]")
+                    __ASM_EMIT("movss       %%xmm0, (%[t], %[off])")
+                    __ASM_EMIT("add         $4, %[off]")
+                    __ASM_EMIT("dec         %[count]")
+                    __ASM_EMIT("jge         5b")
+
+                    __ASM_EMIT("4:")
+                    : [count] "+r" (k),
+                      [off] "=&r" (off), [f] "=&r" (f), [d] "=&r" (d),
+                      [i] "=&r" (i), [t] "=&r" (t)
+                    : [src] "r" (src), [dst] "r" (&vd[0]),
+                      [FB] "m" (fb), [DB] "m" (db), [N] "m" (n)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                      "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+                      "%xmm12"
+                );
+            }
+        }
+    }
+}
+
+#undef XO_BIQUAD
+#undef XO_STORE
+#undef XO_LOAD
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE3_FILTERS_CROSSOVER_H_ */
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE3_LOUDNESS_H_
+#define PRIVATE_DSP_ARCH_X86_SSE3_LOUDNESS_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE3_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE3_IMPL */
+
+/*
+    K-weighting filters of 4 channels are computed in parallel lanes. Each 4x4
+    block of samples is transposed so that every register holds one time step
+    of all channels, the output of the filter is squared and accumulated, so
+    there is no need to transpose the block back.
+
+    Register allocation:
+      xmm0-xmm3     = samples of 4 time steps
+      xmm4          = temporary for the transpose
+      xmm8-xmm9     = memory of the high-shelf stage
+      xmm10-xmm11   = memory of the high-pass stage
+      xmm12         = sums of squares
+      xmm13-xmm14   = temporaries
+ */
+
+// Transpose 4x4 matrix in xmm0-xmm3 using xmm4 as temporary
+#define LDN_TRANSPOSE \
+    __ASM_EMIT("movaps      %%xmm0, %%xmm4")            /* xmm4 = a0 a1 a2 a3 */ \
+    __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")            /* xmm0 = a0 b0 a1 b1 */ \
+    __ASM_EMIT("unpckhps    %%xmm1, %%xmm4")            /* xmm4 = a2 b2 a3 b3 */ \
+    __ASM_EMIT("movaps      %%xmm2, %%xmm1")            /* xmm1 = c0 c1 c2 c3 */ \
+    __ASM_EMIT("unpcklps    %%xmm3, %%xmm1")            /* xmm1 = c0 d0 c1 d1 */ \
+    __ASM_EMIT("unpckhps    %%xmm3, %%xmm2")            /* xmm2 = c2 d2 c3 d3 */ \
+    __ASM_EMIT("movaps      %%xmm0, %%xmm3")            /* xmm3 = a0 b0 a1 b1 */ \
+    __ASM_EMIT("movlhps     %%xmm1, %%xmm0")            /* xmm0 = a0 b0 c0 d0 */ \
+    __ASM_EMIT("movhlps     %%xmm3, %%xmm1")            /* xmm1 = a1 b1 c1 d1 */ \
+    __ASM_EMIT("movaps      %%xmm4, %%xmm3")            /* xmm3 = a2 b2 a3 b3 */ \
+    __ASM_EMIT("movlhps     %%xmm2, %%xmm4")            /* xmm4 = a2 b2 c2 d2 */ \
+    __ASM_EMIT("movhlps     %%xmm3, %%xmm2")            /* xmm2 = a3 b3 c3 d3 */ \
+    __ASM_EMIT("movaps      %%xmm2, %%xmm3")            /* xmm3 = a3 b3 c3 d3 */ \
+    __ASM_EMIT("movaps      %%xmm4, %%xmm2")            /* xmm2 = a2 b2 c2 d2 */
+
+// One biquad stage: x = input/output, d0, d1 = filter memory, OFF = offset of coefficients
+#define LDN_BIQUAD(x, d0, d1, OFF) \
+    __ASM_EMIT("movaps      %%" x ", %%xmm13")                  /* xmm13 = x */ \
+    __ASM_EMIT("movaps      %%" x ", %%xmm14")                  /* xmm14 = x */ \
+    __ASM_EMIT("mulps       " OFF " + 0x00(%[P]), %%" x)        /* x     = b0*x */ \
+    __ASM_EMIT("mulps       " OFF " + 0x10(%[P]), %%xmm13")     /* xmm13 = b1*x */ \
+    __ASM_EMIT("mulps       " OFF " + 0x20(%[P]), %%xmm14")     /* xmm14 = b2*x */ \
+    __ASM_EMIT("addps       %%" d0 ", %%" x)                    /* x     = y = b0*x + d0 */ \
+    __ASM_EMIT("movaps      %%" x ", %%" d0)                    /* d0    = y */ \
+    __ASM_EMIT("mulps       " OFF " + 0x30(%[P]), %%" d0)       /* d0    = a1*y */ \
+    __ASM_EMIT("addps       %%xmm13, %%" d0)                    /* d0    = b1*x + a1*y */ \
+    __ASM_EMIT("addps       %%" d1 ", %%" d0)                   /* d0'   = b1*x + a1*y + d1 */ \
+    __ASM_EMIT("movaps      %%" x ", %%" d1)                    /* d1    = y */ \
+    __ASM_EMIT("mulps       " OFF " + 0x40(%[P]), %%" d1)       /* d1    = a2*y */ \
+    __ASM_EMIT("addps       %%xmm14, %%" d1)                    /* d1'   = b2*x + a2*y */
+
+// Filter one time step of 4 channels in register x and accumulate the square
+#define LDN_STEP(x) \
+    LDN_BIQUAD(x, "xmm8", "xmm9", "0x00") \
+    LDN_BIQUAD(x, "xmm10", "xmm11", "0x50") \
+    __ASM_EMIT("mulps       %%" x ", %%" x)                     /* x     = y*y */ \
+    __ASM_EMIT("addps       %%" x ", %%xmm12")                  /* xmm12 = ms + y*y */
+
+namespace lsp
+{
+    namespace sse3
+    {
+        void x64_loudness_accumulate(dsp::loudness_t *l, const float **src, size_t count)
+        {
+            float p[10*4] __lsp_aligned16;
+            const float *s[4];
+
+            for (size_t i=0; i<10; ++i)
+                for (size_t j=0; j<4; ++j)
+                    p[i*4 + j]      = l->kw[i];
+
+            // Process groups of 4 channels, missing channels of the group are substituted by
+            // the first channel of the group, the results are stored to the unused entries
+            for (size_t i=0; i<l->channels; i += 4)
+            {
+                for (size_t j=0; j<4; ++j)
+                    s[j]            = (i + j < l->channels) ? src[i + j] : src[i];
+                size_t k        = count;
+
+                ARCH_X86_64_ASM(
+                    __ASM_EMIT("movups      0x00(%[D]), %%xmm8")            /* xmm8  = d0 */
+                    __ASM_EMIT("movups      0x20(%[D]), %%xmm9")            /* xmm9  = d1 */
+                    __ASM_EMIT("movups      0x40(%[D]), %%xmm10")           /* xmm10 = e0 */
+                    __ASM_EMIT("movups      0x60(%[D]), %%xmm11")           /* xmm11 = e1 */
+                    __ASM_EMIT("movups      (%[M]), %%xmm12")               /* xmm12 = ms */
+                    __ASM_EMIT("sub         $4, %[count]")
+                    __ASM_EMIT("jb          2f")
+                    // 4x blocks
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("movups      (%[s0]), %%xmm0")
+                    __ASM_EMIT("movups      (%[s1]), %%xmm1")
+                    __ASM_EMIT("movups      (%[s2]), %%xmm2")
+                    __ASM_EMIT("movups      (%[s3]), %%xmm3")
+                    LDN_TRANSPOSE
+                    LDN_STEP("xmm0")
+                    LDN_STEP("xmm1")
+                    LDN_STEP("xmm2")
+                    LDN_STEP("xmm3")
+                    __ASM_EMIT("add         $0x10, %[s0]")
+                    __ASM_EMIT("add         $0x10, %[s1]")
+                    __ASM_EMIT("add         $0x10, %[s2]")
+                    __ASM_EMIT("add         $0x10, %[s3]")
+                    __ASM_EMIT("sub         $4, %[count]")
+                    __ASM_EMIT("jae         1b")
+                    // 1x blocks
+                    __ASM_EMIT("2:")
+                    __ASM_EMIT("add         $3, %[count]")
+                    __ASM_EMIT("jl          4f")
+                    __ASM_EMIT("3:")
+                    __ASM_EMIT("movss       (%[s0]), %%xmm0")               /* xmm0 = a 0 0 0 */
+                    __ASM_EMIT("movss       (%[s1]), %%xmm1")               /* xmm1 = b 0 0 0 */
+                    __ASM_EMIT("movss       (%[s2]), %%xmm2")               /* xmm2 = c 0 0 0 */
+                    __ASM_EMIT("movss       (%[s3]), %%xmm3")               /* xmm3 = d 0 0 0 */
+                    __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                /* xmm0 = a b 0 0 */
+                    __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                /* xmm2 = c d 0 0 */
+                    __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                /* xmm0 = a b c d */
+                    LDN_STEP("xmm0")
+                    __ASM_EMIT("add         $0x04, %[s0]")
+                    __ASM_EMIT("add         $0x04, %[s1]")
+                    __ASM_EMIT("add         $0x04, %[s2]")
+                    __ASM_EMIT("add         $0x04, %[s3]")
+                    __ASM_EMIT("dec         %[count]")
+                    __ASM_EMIT("jge         3b")
+                    // Store the state
+                    __ASM_EMIT("4:")
+                    __ASM_EMIT("movups      %%xmm8, 0x00(%[D])")
+                    __ASM_EMIT("movups      %%xmm9, 0x20(%[D])")
+                    __ASM_EMIT("movups      %%xmm10, 0x40(%[D])")
+                    __ASM_EMIT("movups      %%xmm11, 0x60(%[D])")
+                    __ASM_EMIT("movups      %%xmm12, (%[M])")
+                    : [count] "+r" (k),
+                      [s0] "+r" (s[0]), [s1] "+r" (s[1]), [s2] "+r" (s[2]), [s3] "+r" (s[3])
+                    : [D] "r" (&l->d[i]), [M] "r" (&l->ms[i]),
+                      [P] "r" (&p[0])
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4",
+                      "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+                      "%xmm12", "%xmm13", "%xmm14"
+                );
+            }
+        }
+    }
+}
+
+#undef LDN_STEP
+#undef LDN_BIQUAD
+#undef LDN_TRANSPOSE
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE3_LOUDNESS_H_ */
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_FFT_H_
+#define PRIVATE_DSP_FFT_H_
+
+/**
+ * Number of transforms processed by one pass of butterflies in batch mode:
+ * as many transforms of the specified rank as fit into the 32 KiB L1 data cache,
+ * but at least one transform
+ */
+#define FFT_BATCH_GROUP(rank)   \
+    (((0x8000 >> ((rank) + 3)) > 0) ? (0x8000 >> ((rank) + 3)) : 1)
+
+#endif /* PRIVATE_DSP_FFT_H_ */
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+#           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+#
+# This file is part of lsp-dsp-lib
+#
+# lsp-dsp-lib is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# any later version.
+#
+# lsp-dsp-lib is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with lsp-dsp-lib.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+"""
+Compare performance test results against a stored baseline.
+
+Both files may be either JSON produced by ptest_export.py or raw output of the test binary.
+Cases are matched by (test, case). A case is reported as a regression when its time per
+call grows by more than the threshold. The exit code is 1 if any regression was found.
+
+Usage:
+    ptest_compare.py baseline.json current.json --threshold 10
+"""
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from ptest_export import load
+
+
+def index(records):
+    result = {}
+    for rec in records:
+        result[(rec.get('test'), rec.get('case'))] = rec
+    return result
+
+
+def host_of(records):
+    for rec in records:
+        return (rec.get('arch'), rec.get('cpu'), rec.get('model'))
+    return (None, None, None)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare performance test results against a baseline')
+    parser.add_argument('baseline', help='baseline results')
+    parser.add_argument('current', help='current results')
+    parser.add_argument('-t', '--threshold', type=float, default=5.0,
+                        help='allowed slowdown in percent (default: 5)')
+    parser.add_argument('-v', '--verbose', action='store_true', help='report all matched cases')
+    args = parser.parse_args()
+
+    base = load(args.baseline)
+    curr = load(args.current)
+
+    if host_of(base) != host_of(curr):
+        print('Warning: results were obtained on different hosts:')
+        print('  baseline: %s' % ' / '.join(str(x) for x in host_of(base)))
+        print('  current:  %s' % ' / '.join(str(x) for x in host_of(curr)))
+
+    base_idx = index(base)
+    curr_idx = index(curr)
+    regressions = 0
+    improvements = 0
+    matched = 0
+
+    for key, rec in curr_idx.items():
+        ref = base_idx.get(key)
+        if ref is None:
+            if args.verbose:
+                print('NEW         %s: %s' % key)
+            continue
+
+        matched += 1
+        t0 = ref['ns_per_call']
+        t1 = rec['ns_per_call']
+        delta = (t1 - t0) * 100.0 / t0
+        if delta > args.threshold:
+            status = 'REGRESSION'
+            regressions += 1
+        elif delta < -args.threshold:
+            status = 'IMPROVED'
+            improvements += 1
+        else:
+            status = 'OK'
+
+        if (status != 'OK') or args.verbose:
+            print('%-11s %s: %s: %.1f ns -> %.1f ns (%+.1f%%)' % (status, key[0], key[1], t0, t1, delta))
+
+    for key in base_idx:
+        if (key not in curr_idx) and args.verbose:
+            print('MISSING     %s: %s' % key)
+
+    print('Matched %d cases: %d regressions, %d improvements (threshold %.1f%%)' %
+          (matched, regressions, improvements, args.threshold))
+
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+#           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+#
+# This file is part of lsp-dsp-lib
+#
+# lsp-dsp-lib is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# any later version.
+#
+# lsp-dsp-lib is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with lsp-dsp-lib.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+"""
+Convert the output of performance tests into machine-readable JSON or CSV.
+
+The test binary prints the CPU information obtained from dsp::info() at startup
+and one line (or table row) per PTEST_LOOP case. Each case is converted into a record:
+
+    test             name of the performance test, e.g. 'dsp.hmath.hsum'
+    case             label passed to PTEST_LOOP, e.g. 'sse::h_sum x 1024'
+    backend          backend namespace of the case ('generic', 'sse', 'avx', ...)
+    size             buffer size parsed from the ' x N' suffix of the label, or null
+    ns_per_call      nanoseconds per call
+    calls_per_sec    calls per second
+    samples_per_sec  calls per second multiplied by the buffer size, or null
+    gb_per_sec       memory traffic in GB/s when the label carries '[<bytes>B <flops>F]', or null
+    gflop_per_sec    arithmetic rate in GFLOP/s for the same labels, or null
+    arch, cpu, model, features   CPU information from dsp::info()
+
+Usage:
+    lsp-dsp-lib-test ptest dsp.hmath.* | ptest_export.py --format json -o bench.json
+"""
+
+import argparse
+import csv
+import json
+import re
+import sys
+
+FIELDS = [
+    'test', 'case', 'backend', 'size',
+    'ns_per_call', 'calls_per_sec', 'samples_per_sec',
+    'gb_per_sec', 'gflop_per_sec',
+    'arch', 'cpu', 'model', 'features'
+]
+
+INFO_KEYS = {
+    'Architecture': 'arch',
+    'Processor': 'cpu',
+    'Model': 'model',
+    'Features': 'features',
+}
+
+RE_INFO = re.compile(r'^(Architecture|Processor|Model|Features):\s*(.*?)\s*$')
+RE_TEST = re.compile(r'(?:PTEST|performance test)\s+\'?([\w.\-]+)\'?', re.IGNORECASE)
+RE_SIMPLE = re.compile(r'^\s*(\S.*?)\s*:\s*([0-9.eE+\-]+)\s*calls/s\s*$')
+RE_SIZE = re.compile(r'\sx\s*(\d+)\b')
+RE_COST = re.compile(r'\[\s*(\d+(?:\.\d+)?)B\s+(\d+(?:\.\d+)?)F\s*\]')
+RE_TABLE_SPLIT = re.compile(r'\s*[|│]\s*')
+
+
+def make_record(info, test, case, calls_per_sec=None, us_per_call=None):
+    if (calls_per_sec is None) and (us_per_call is not None) and (us_per_call > 0):
+        calls_per_sec = 1e6 / us_per_call
+    if (calls_per_sec is None) or (calls_per_sec <= 0):
+        return None
+
+    m = RE_SIZE.search(case)
+    size = int(m.group(1)) if m else None
+    backend = case.split('::', 1)[0].strip() if '::' in case else None
+    samples = calls_per_sec * size if size is not None else None
+
+    # Per-sample traffic and arithmetic declared by the test
+    gbps = gflops = None
+    m = RE_COST.search(case)
+    if m and (samples is not None):
+        gbps = samples * float(m.group(1)) * 1e-9
+        gflops = samples * float(m.group(2)) * 1e-9
+
+    rec = {
+        'test': test,
+        'case': case,
+        'backend': backend,
+        'size': size,
+        'ns_per_call': 1e9 / calls_per_sec,
+        'calls_per_sec': calls_per_sec,
+        'samples_per_sec': samples,
+        'gb_per_sec': gbps,
+        'gflop_per_sec': gflops,
+    }
+    for key in INFO_KEYS.values():
+        rec[key] = info.get(key)
+    return rec
+
+
+def to_float(s):
+    try:
+        return float(s)
+    except (TypeError, ValueError):
+        return None
+
+
+def parse(lines):
+    """Parse the test output, return the list of records"""
+    info = {}
+    test = None
+    columns = None
+    records = []
+
+    for line in lines:
+        line = line.rstrip('\n')
+
+        m = RE_INFO.match(line)
+        if m:
+            info[INFO_KEYS[m.group(1)]] = m.group(2)
+            continue
+
+        m = RE_TEST.search(line)
+        if m:
+            test = m.group(1)
+            columns = None
+            continue
+
+        # Plain 'label : N calls/s' output
+        m = RE_SIMPLE.match(line)
+        if m:
+            rec = make_record(info, test, m.group(1), calls_per_sec=to_float(m.group(2)))
+            if rec is not None:
+                records.append(rec)
+            continue
+
+        # Statistics table: locate columns by the header row
+        cells = RE_TABLE_SPLIT.split(line.strip(' |│'))
+        if len(cells) < 2:
+            continue
+        if cells[0].startswith('Case'):
+            columns = {}
+            for i, name in enumerate(cells):
+                if name.startswith('Perf'):
+                    columns['perf'] = i
+                elif name.startswith('Cost'):
+                    columns['cost'] = i
+            continue
+        if (columns is None) or (len(columns) <= 0):
+            continue
+
+        perf = to_float(cells[columns['perf']]) if 'perf' in columns and columns['perf'] < len(cells) else None
+        cost = to_float(cells[columns['cost']]) if 'cost' in columns and columns['cost'] < len(cells) else None
+        rec = make_record(info, test, cells[0], calls_per_sec=perf, us_per_call=cost)
+        if rec is not None:
+            records.append(rec)
+
+    return records
+
+
+def load(path):
+    """Load records either from a JSON file produced by this tool or from raw test output"""
+    with open(path, 'r', encoding='utf-8', errors='replace') as fd:
+        text = fd.read()
+    try:
+        data = json.loads(text)
+        if isinstance(data, dict):
+            data = data.get('results', [])
+        return data
+    except ValueError:
+        return parse(text.splitlines())
+
+
+def write_json(records, fd):
+    json.dump({'results': records}, fd, indent=2)
+    fd.write('\n')
+
+
+def write_csv(records, fd):
+    writer = csv.DictWriter(fd, fieldnames=FIELDS)
+    writer.writeheader()
+    for rec in records:
+        writer.writerow({k: ('' if rec.get(k) is None else rec.get(k)) for k in FIELDS})
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert performance test output into JSON or CSV')
+    parser.add_argument('input', nargs='*', help='files with the test output (default: stdin)')
+    parser.add_argument('-f', '--format', choices=['json', 'csv'], default='json', help='output format')
+    parser.add_argument('-o', '--output', help='output file (default: stdout)')
+    args = parser.parse_args()
+
+    records = []
+    if len(args.input) > 0:
+        for path in args.input:
+            with open(path, 'r', encoding='utf-8', errors='replace') as fd:
+                records += parse(fd)
+    else:
+        records = parse(sys.stdin)
+
+    out = open(args.output, 'w', encoding='utf-8', newline='') if args.output else sys.stdout
+    try:
+        if args.format == 'csv':
+            write_csv(records, out)
+        else:
+            write_json(records, out)
+    finally:
+        if out is not sys.stdout:
+            out.close()
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
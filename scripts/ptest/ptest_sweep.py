@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+#           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+#
+# This file is part of lsp-dsp-lib
+#
+# lsp-dsp-lib is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# any later version.
+#
+# lsp-dsp-lib is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with lsp-dsp-lib.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+"""
+Print the memory hierarchy sweep ('dsp.sweep' performance test) as per-kernel tables.
+
+For each kernel and working set size the table shows the achieved bandwidth (GB/s),
+the arithmetic rate (GFLOP/s) and their ratio to the machine peak measured in the same run:
+
+    %BW     bandwidth relative to the fastest copy kernel at the same working set size
+    %FLOP   arithmetic rate relative to the fastest register-resident peak kernel
+
+Kernels that stay close to 100 %BW while the working set leaves the cache are memory-bound,
+kernels with high %FLOP are compute-bound.
+
+Usage:
+    lsp-dsp-lib-test ptest dsp.sweep > sweep.log
+    ptest_sweep.py sweep.log
+"""
+
+import argparse
+import math
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from ptest_export import load, RE_COST, RE_SIZE
+
+
+def wset_bucket(rec):
+    """Working set size in bytes rounded to the nearest power of two"""
+    m = RE_COST.search(rec['case'])
+    if (m is None) or (rec.get('size') is None):
+        return None
+    wset = rec['size'] * float(m.group(1))
+    return 1 << int(round(math.log2(wset))) if wset > 0 else None
+
+
+def kernel_name(case):
+    m = RE_SIZE.search(case)
+    return case[:m.start()].strip() if m else case.strip()
+
+
+def is_peak(name):
+    """Register-resident arithmetic kernel: '<backend>::peak[_<variant>]'"""
+    return name.rsplit('::', 1)[-1].startswith('peak')
+
+
+def format_size(size):
+    for unit in ('B', 'KiB', 'MiB', 'GiB'):
+        if size < 1024:
+            return '%d %s' % (size, unit)
+        size >>= 10
+    return '%d TiB' % size
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Print bandwidth and FLOP rate tables of the memory hierarchy sweep')
+    parser.add_argument('input', nargs='+', help='test output or JSON produced by ptest_export.py')
+    args = parser.parse_args()
+
+    records = []
+    for path in args.input:
+        records += [r for r in load(path) if r.get('gb_per_sec') is not None]
+    if len(records) <= 0:
+        sys.stderr.write('No cases with declared bytes/flops found\n')
+        return 1
+
+    # Measured peaks: copy bandwidth per working set, best register-resident arithmetic rate
+    roof = {}
+    peak_flops = 0.0
+    for r in records:
+        name = kernel_name(r['case'])
+        if name.endswith('::copy'):
+            ws = wset_bucket(r)
+            roof[ws] = max(roof.get(ws, 0.0), r['gb_per_sec'])
+        elif is_peak(name):
+            peak_flops = max(peak_flops, r['gflop_per_sec'])
+
+    kernels = {}
+    for r in records:
+        kernels.setdefault(kernel_name(r['case']), []).append(r)
+
+    if peak_flops > 0:
+        print('Peak GFLOP/s: %.2f' % peak_flops)
+    else:
+        print('Peak GFLOP/s: - (no peak kernels in the input)')
+    for name, items in kernels.items():
+        print()
+        print(name)
+        print('  %-10s %10s %10s %8s %8s' % ('Wset', 'GB/s', 'GFLOP/s', '%BW', '%FLOP'))
+        for r in sorted(items, key=lambda x: wset_bucket(x) or 0):
+            ws = wset_bucket(r)
+            bw = roof.get(ws)
+            pbw = '%.1f' % (100.0 * r['gb_per_sec'] / bw) if bw else '-'
+            pfl = '%.1f' % (100.0 * r['gflop_per_sec'] / peak_flops) if peak_flops > 0 else '-'
+            print('  %-10s %10.2f %10.2f %8s %8s' % (
+                format_size(ws) if ws else '-', r['gb_per_sec'], r['gflop_per_sec'], pbw, pfl))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
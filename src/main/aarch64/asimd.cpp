@@ -50,11 +50,15 @@
 
     // Include ASIMD-specific definitions
     #define PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+        #include <private/dsp/arch/aarch64/asimd/3dmath.h>
         #include <private/dsp/arch/aarch64/asimd/complex.h>
         #include <private/dsp/arch/aarch64/asimd/convolution.h>
         #include <private/dsp/arch/aarch64/asimd/copy.h>
+        #include <private/dsp/arch/aarch64/asimd/cqt.h>
+        #include <private/dsp/arch/aarch64/asimd/dynamics.h>
         #include <private/dsp/arch/aarch64/asimd/fastconv.h>
         #include <private/dsp/arch/aarch64/asimd/fft.h>
+        #include <private/dsp/arch/aarch64/asimd/filters/crossover.h>
         #include <private/dsp/arch/aarch64/asimd/filters/dynamic.h>
         #include <private/dsp/arch/aarch64/asimd/filters/static.h>
         #include <private/dsp/arch/aarch64/asimd/filters/transfer.h>
@@ -62,13 +66,20 @@
         #include <private/dsp/arch/aarch64/asimd/float.h>
         #include <private/dsp/arch/aarch64/asimd/graphics/axis.h>
         #include <private/dsp/arch/aarch64/asimd/graphics/colors.h>
+        #include <private/dsp/arch/aarch64/asimd/graphics/colormap.h>
         #include <private/dsp/arch/aarch64/asimd/graphics/effects.h>
         #include <private/dsp/arch/aarch64/asimd/graphics/pixelfmt.h>
         #include <private/dsp/arch/aarch64/asimd/hmath/hsum.h>
         #include <private/dsp/arch/aarch64/asimd/hmath/hdotp.h>
+        #include <private/dsp/arch/aarch64/asimd/hmath/hcsum.h>
+        #include <private/dsp/arch/aarch64/asimd/interpolation/delay.h>
         #include <private/dsp/arch/aarch64/asimd/interpolation/linear.h>
+        #include <private/dsp/arch/aarch64/asimd/interpolation/ramp.h>
+        #include <private/dsp/arch/aarch64/asimd/ir.h>
+        #include <private/dsp/arch/aarch64/asimd/loudness.h>
         #include <private/dsp/arch/aarch64/asimd/mix.h>
         #include <private/dsp/arch/aarch64/asimd/msmatrix.h>
+        #include <private/dsp/arch/aarch64/asimd/noise.h>
         #include <private/dsp/arch/aarch64/asimd/pcomplex.h>
         #include <private/dsp/arch/aarch64/asimd/pfft.h>
         #include <private/dsp/arch/aarch64/asimd/pmath/abs_vv.h>
@@ -81,8 +92,11 @@
         #include <private/dsp/arch/aarch64/asimd/pmath/op_vv.h>
         #include <private/dsp/arch/aarch64/asimd/pmath/pow.h>
         #include <private/dsp/arch/aarch64/asimd/resampling.h>
+        #include <private/dsp/arch/aarch64/asimd/resampling/halfband.h>
         #include <private/dsp/arch/aarch64/asimd/search/minmax.h>
         #include <private/dsp/arch/aarch64/asimd/search/iminmax.h>
+        #include <private/dsp/arch/aarch64/asimd/shaper.h>
+        #include <private/dsp/arch/aarch64/asimd/xcorr.h>
     #undef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
 
     #define EXPORT2(function, export) \
@@ -120,6 +134,25 @@
                 dsp_finish(ctx);
             }
 
+            uint32_t denormal_mode()
+            {
+                // FZ flag flushes both denormal inputs and outputs
+                return (read_fpcr() & FPCR_FZ) ? dsp::DENORMAL_FTZ | dsp::DENORMAL_DAZ : 0;
+            }
+
+            uint32_t denormal_sample()
+            {
+                uint64_t fpsr           = read_fpsr();
+                uint32_t flags          = 0;
+                if (fpsr & FPSR_IDC)
+                    flags                  |= dsp::DENORMAL_INPUT;
+                if (fpsr & FPSR_UFC)
+                    flags                  |= dsp::DENORMAL_OUTPUT;
+                if (flags)
+                    write_fpsr(fpsr & ~uint64_t(FPSR_IDC | FPSR_UFC));
+                return flags;
+            }
+
             void dsp_init(const aarch64::cpu_features_t *f)
             {
                 if ((f->hwcap & (HWCAP_AARCH64_ASIMD)) != (HWCAP_AARCH64_ASIMD))
@@ -132,6 +165,8 @@
                 // Export basic functions
                 EXPORT1(start);
                 EXPORT1(finish);
+                EXPORT1(denormal_mode);
+                EXPORT1(denormal_sample);
 
                 // Export functions
                 EXPORT1(copy);
@@ -259,6 +294,11 @@
                 EXPORT1(h_abs_dotp);
                 EXPORT1(h_sqr_dotp);
 
+                EXPORT1(h_csum);
+                EXPORT1(h_sqr_csum);
+                EXPORT1(h_abs_csum);
+                EXPORT1(h_cdotp);
+
                 EXPORT1(logb1);
                 EXPORT1(logb2);
                 EXPORT1(loge1);
@@ -335,11 +375,20 @@
 
                 EXPORT1(packed_direct_fft);
                 EXPORT1(packed_reverse_fft);
+                EXPORT1(direct_fft_batch);
+                EXPORT1(reverse_fft_batch);
+                EXPORT1(packed_direct_fft_batch);
+                EXPORT1(packed_reverse_fft_batch);
+
+                EXPORT1(cqt_apply);
+                EXPORT1(xcorr_accumulate);
+                EXPORT1(ir_render_taps);
 
                 EXPORT1(fastconv_parse);
                 EXPORT1(fastconv_restore);
                 EXPORT1(fastconv_apply);
                 EXPORT1(fastconv_parse_apply);
+                EXPORT1(fastconv_fmadd);
 
                 EXPORT1(biquad_process_x1);
                 EXPORT1(biquad_process_x2);
@@ -366,6 +415,8 @@
                 EXPORT1(bilinear_transform_x4);
                 EXPORT1(bilinear_transform_x8);
 
+                EXPORT1(crossover_process);
+
                 EXPORT1(lanczos_resample_2x2);
                 EXPORT1(lanczos_resample_2x3);
                 EXPORT1(lanczos_resample_2x4);
@@ -388,6 +439,16 @@
                 EXPORT1(downsample_6x);
                 EXPORT1(downsample_8x);
 
+                EXPORT1(halfband_upsample_2x);
+                EXPORT1(halfband_downsample_2x);
+
+                EXPORT1(shaper_linear);
+                EXPORT1(shaper_cubic);
+
+                EXPORT1(noise_uniform);
+                EXPORT1(noise_tpdf);
+                EXPORT1(noise_gaussian);
+
                 EXPORT1(convolve);
 
                 EXPORT1(abgr32_to_bgrff32);
@@ -402,6 +463,70 @@
                 EXPORT1(lin_inter_frmadd2);
                 EXPORT1(lin_inter_fmadd3);
 
+                EXPORT1(smooth_cubic_linear);
+                EXPORT1(smooth_cubic_log);
+                EXPORT1(ramp_set);
+                EXPORT1(ramp_mul2);
+                EXPORT1(ramp_mul3);
+                EXPORT1(ramp_fmadd2);
+
+                EXPORT1(delay_read_linear);
+                EXPORT1(delay_read_hermite);
+                EXPORT1(delay_read_lagrange);
+                EXPORT1(delay_read_taps);
+
+                EXPORT1(envelope_peak_mc);
+                EXPORT1(envelope_rms_mc);
+                EXPORT1(gain_curve);
+
+                EXPORT1(loudness_accumulate);
+
+                EXPORT1(apply_matrix3d_mvn);
+                EXPORT1(apply_matrix3d_mpn);
+                EXPORT1(apply_matrix3d_mv_soa);
+                EXPORT1(apply_matrix3d_mp_soa);
+                EXPORT1(apply_matrix3d_mpn_bound_box);
+
+                EXPORT1(points3d_to_soa);
+                EXPORT1(points3d_from_soa);
+                EXPORT1(raw_triangles_to_soa);
+                EXPORT1(raw_triangles_from_soa);
+                EXPORT1(calc_distance_soa);
+                EXPORT1(calc_area_soa);
+                EXPORT1(calc_normal3d_soa);
+                EXPORT1(colocation_x3_v1_soa);
+
+                EXPORT1(calc_triangle3d_params);
+                EXPORT1(calc_triangle3d_p3);
+                EXPORT1(calc_triangle3d_pv);
+                EXPORT1(calc_triangle3d);
+
+                EXPORT1(vector_mul_v2);
+                EXPORT1(vector_mul_vv);
+
+                EXPORT1(calc_oriented_plane_p3);
+                EXPORT1(calc_oriented_plane_pv);
+                EXPORT1(calc_rev_oriented_plane_p3);
+                EXPORT1(calc_rev_oriented_plane_pv);
+
+                EXPORT1(calc_distance_p2);
+                EXPORT1(calc_distance_pv);
+                EXPORT1(calc_distance_v1);
+                EXPORT1(calc_sqr_distance_p2);
+                EXPORT1(calc_sqr_distance_pv);
+                EXPORT1(projection_length_p2);
+                EXPORT1(projection_length_v2);
+                EXPORT1(calc_avg_distance_p3);
+                EXPORT1(unit_vector_p1p3);
+                EXPORT1(unit_vector_p1pv);
+
+                EXPORT1(calc_distance_p1n);
+                EXPORT1(calc_sqr_distance_p1n);
+                EXPORT1(calc_avg_distance_pvn);
+                EXPORT1(unit_vector_p1pvn);
+                EXPORT1(calc_oriented_plane_pvn);
+                EXPORT1(vector_mul_v2n);
+
                 EXPORT1(axis_apply_log1);
                 EXPORT1(axis_apply_log2);
                 EXPORT1(fill_rgba);
@@ -409,11 +534,16 @@
                 EXPORT1(hsla_to_rgba);
                 EXPORT1(rgba_to_hsla);
                 EXPORT1(rgba_to_bgra32);
+                EXPORT1(spectrogram_bgra32);
 
                 EXPORT1(eff_hsla_hue);
                 EXPORT1(eff_hsla_sat);
                 EXPORT1(eff_hsla_light);
                 EXPORT1(eff_hsla_alpha);
+                EXPORT1(eff_hsla_hue_bgra32);
+                EXPORT1(eff_hsla_sat_bgra32);
+                EXPORT1(eff_hsla_light_bgra32);
+                EXPORT1(eff_hsla_alpha_bgra32);
             }
         } /* namespace asimd */
     } /* namespace lsp */
@@ -290,6 +290,25 @@
                 dsp_finish(ctx);
             }
 
+            uint32_t denormal_mode()
+            {
+                // FZ flag flushes both denormal inputs and outputs
+                return (read_fpscr() & FPSCR_FZ) ? dsp::DENORMAL_FTZ | dsp::DENORMAL_DAZ : 0;
+            }
+
+            uint32_t denormal_sample()
+            {
+                uint32_t fpscr          = read_fpscr();
+                uint32_t flags          = 0;
+                if (fpscr & FPSCR_IDC)
+                    flags                  |= dsp::DENORMAL_INPUT;
+                if (fpscr & FPSCR_UFC)
+                    flags                  |= dsp::DENORMAL_OUTPUT;
+                if (flags)
+                    write_fpscr(fpscr & ~(FPSCR_IDC | FPSCR_UFC));
+                return flags;
+            }
+
             dsp::info_t *info()
             {
                 cpu_features_t f;
@@ -354,6 +373,8 @@
                     // Export routines
                     EXPORT1(start);
                     EXPORT1(finish);
+                    EXPORT1(denormal_mode);
+                    EXPORT1(denormal_sample);
                 }
 
                 // Initialize support of NEON functions with D-32 registers
@@ -355,6 +355,7 @@
                 EXPORT1(fastconv_restore);
                 EXPORT1(fastconv_apply);
                 EXPORT1(fastconv_parse_apply);
+                EXPORT1(fastconv_fmadd);
 
                 EXPORT1(mix2);
                 EXPORT1(mix3);
@@ -48,6 +48,7 @@ namespace lsp
     #include <private/dsp/arch/generic/graphics.h>
     #include <private/dsp/arch/generic/graphics/effects.h>
     #include <private/dsp/arch/generic/graphics/interpolation.h>
+    #include <private/dsp/arch/generic/graphics/colormap.h>
 
     #include <private/dsp/arch/generic/pmath.h>
     #include <private/dsp/arch/generic/pmath/op_kx.h>
@@ -62,6 +63,7 @@ namespace lsp
 
     #include <private/dsp/arch/generic/hmath/hsum.h>
     #include <private/dsp/arch/generic/hmath/hdotp.h>
+    #include <private/dsp/arch/generic/hmath/hcsum.h>
 
     #include <private/dsp/arch/generic/search.h>
 
@@ -69,12 +71,20 @@ namespace lsp
     #include <private/dsp/arch/generic/filters/dynamic.h>
     #include <private/dsp/arch/generic/filters/transform.h>
     #include <private/dsp/arch/generic/filters/transfer.h>
+    #include <private/dsp/arch/generic/filters/fir.h>
+    #include <private/dsp/arch/generic/filters/crossover.h>
 
     #include <private/dsp/arch/generic/fft.h>
     #include <private/dsp/arch/generic/fastconv.h>
+    #include <private/dsp/arch/generic/cqt.h>
+    #include <private/dsp/arch/generic/xcorr.h>
+    #include <private/dsp/arch/generic/ir.h>
     #include <private/dsp/arch/generic/float.h>
     #include <private/dsp/arch/generic/resampling.h>
+    #include <private/dsp/arch/generic/resampling/halfband.h>
+    #include <private/dsp/arch/generic/shaper.h>
     #include <private/dsp/arch/generic/msmatrix.h>
+    #include <private/dsp/arch/generic/noise.h>
     #include <private/dsp/arch/generic/smath.h>
     #include <private/dsp/arch/generic/mix.h>
     #include <private/dsp/arch/generic/3dmath.h>
@@ -82,6 +92,14 @@ namespace lsp
     #include <private/dsp/arch/generic/coding.h>
 
     #include <private/dsp/arch/generic/interpolation/linear.h>
+    #include <private/dsp/arch/generic/interpolation/ramp.h>
+    #include <private/dsp/arch/generic/interpolation/delay.h>
+
+    #include <private/dsp/arch/generic/dynamics.h>
+    #include <private/dsp/arch/generic/loudness.h>
+
+    #include <private/dsp/arch/generic/parallel.h>
+    #include <private/dsp/arch/generic/waveform.h>
 
 #undef PRIVATE_DSP_ARCH_GENERIC_IMPL
 
@@ -105,6 +123,8 @@ namespace lsp
             // Generic init
             EXPORT1(start);
             EXPORT1(finish);
+            EXPORT1(denormal_mode);
+            EXPORT1(denormal_sample);
             EXPORT1(info);
 
             EXPORT1(copy);
@@ -227,6 +247,10 @@ namespace lsp
             EXPORT1(h_dotp);
             EXPORT1(h_sqr_dotp);
             EXPORT1(h_abs_dotp);
+            EXPORT1(h_csum);
+            EXPORT1(h_sqr_csum);
+            EXPORT1(h_abs_csum);
+            EXPORT1(h_cdotp);
 
             EXPORT1(fmadd_k3);
             EXPORT1(fmsub_k3);
@@ -281,16 +305,35 @@ namespace lsp
             EXPORT1(packed_direct_fft);
             EXPORT1(reverse_fft);
             EXPORT1(packed_reverse_fft);
+            EXPORT1(direct_fft_batch);
+            EXPORT1(packed_direct_fft_batch);
+            EXPORT1(reverse_fft_batch);
+            EXPORT1(packed_reverse_fft_batch);
             EXPORT1(normalize_fft3);
             EXPORT1(normalize_fft2);
             EXPORT1(center_fft);
             EXPORT1(combine_fft);
             EXPORT1(packed_combine_fft);
 
+            EXPORT1(cqt_bins);
+            EXPORT1(cqt_kernel_size);
+            EXPORT1(cqt_init);
+            EXPORT1(cqt_apply);
+
+            EXPORT1(xcorr_spectrum);
+            EXPORT1(xcorr_accumulate);
+            EXPORT1(xcorr_peak);
+
+            EXPORT1(ir_kernel_init);
+            EXPORT1(ir_bin_taps);
+            EXPORT1(ir_render_taps);
+
             EXPORT1(fastconv_parse);
             EXPORT1(fastconv_parse_apply);
             EXPORT1(fastconv_restore);
             EXPORT1(fastconv_apply);
+            EXPORT1(fastconv_fmadd);
+            EXPORT1(fastconv_matrix_apply);
 
             EXPORT1(complex_mul2);
             EXPORT1(complex_mul3);
@@ -358,6 +401,13 @@ namespace lsp
             EXPORT1(matched_transform_x4);
             EXPORT1(matched_transform_x8);
 
+            EXPORT1(fir_design);
+            EXPORT1(fir_design_fastconv);
+
+            EXPORT1(crossover_init);
+            EXPORT1(crossover_reset);
+            EXPORT1(crossover_process);
+
             EXPORT1(axis_apply_log1);
             EXPORT1(axis_apply_log2);
             EXPORT1(rgba32_to_bgra32);
@@ -371,11 +421,16 @@ namespace lsp
             EXPORT1(rgba_to_hsla);
             EXPORT1(hsla_to_rgba);
             EXPORT1(rgba_to_bgra32);
+            EXPORT1(spectrogram_bgra32);
 
             EXPORT1(eff_hsla_hue);
             EXPORT1(eff_hsla_sat);
             EXPORT1(eff_hsla_light);
             EXPORT1(eff_hsla_alpha);
+            EXPORT1(eff_hsla_hue_bgra32);
+            EXPORT1(eff_hsla_sat_bgra32);
+            EXPORT1(eff_hsla_light_bgra32);
+            EXPORT1(eff_hsla_alpha_bgra32);
 
             EXPORT1(smooth_cubic_linear);
             EXPORT1(smooth_cubic_log);
@@ -402,6 +457,26 @@ namespace lsp
             EXPORT1(downsample_6x);
             EXPORT1(downsample_8x);
 
+            EXPORT1(halfband_init);
+            EXPORT1(halfband_reset);
+            EXPORT1(halfband_upsample_2x);
+            EXPORT1(halfband_upsample_4x);
+            EXPORT1(halfband_upsample_8x);
+            EXPORT1(halfband_downsample_2x);
+            EXPORT1(halfband_downsample_4x);
+            EXPORT1(halfband_downsample_8x);
+
+            EXPORT1(shaper_init);
+            EXPORT1(shaper_linear);
+            EXPORT1(shaper_cubic);
+            EXPORT1(shaper_oversampled);
+
+            EXPORT1(noise_init);
+            EXPORT1(noise_uniform);
+            EXPORT1(noise_tpdf);
+            EXPORT1(noise_gaussian);
+            EXPORT1(noise_pink);
+
             // 3D math
             EXPORT1(init_point_xyz);
             EXPORT1(init_point);
@@ -460,6 +535,10 @@ namespace lsp
             EXPORT1(apply_matrix3d_mp1);
             EXPORT1(apply_matrix3d_mm2);
             EXPORT1(apply_matrix3d_mm1);
+            EXPORT1(apply_matrix3d_mvn);
+            EXPORT1(apply_matrix3d_mpn);
+            EXPORT1(apply_matrix3d_mv_soa);
+            EXPORT1(apply_matrix3d_mp_soa);
             EXPORT1(transpose_matrix3d1);
             EXPORT1(transpose_matrix3d2);
 
@@ -513,6 +592,7 @@ namespace lsp
             EXPORT1(move_point3d_pv);
 
             EXPORT1(calc_bound_box);
+            EXPORT1(apply_matrix3d_mpn_bound_box);
 
             EXPORT1(calc_plane_p3);
             EXPORT1(calc_plane_pv);
@@ -552,6 +632,22 @@ namespace lsp
             EXPORT1(unit_vector_p1p3);
             EXPORT1(unit_vector_p1pv);
 
+            EXPORT1(points3d_to_soa);
+            EXPORT1(points3d_from_soa);
+            EXPORT1(raw_triangles_to_soa);
+            EXPORT1(raw_triangles_from_soa);
+            EXPORT1(calc_distance_soa);
+            EXPORT1(calc_area_soa);
+            EXPORT1(calc_normal3d_soa);
+            EXPORT1(colocation_x3_v1_soa);
+
+            EXPORT1(calc_distance_p1n);
+            EXPORT1(calc_sqr_distance_p1n);
+            EXPORT1(calc_avg_distance_pvn);
+            EXPORT1(unit_vector_p1pvn);
+            EXPORT1(calc_oriented_plane_pvn);
+            EXPORT1(vector_mul_v2n);
+
             EXPORT1(convolve);
 
             EXPORT1(base64_enc);
@@ -563,6 +659,61 @@ namespace lsp
             EXPORT1(lin_inter_fmadd2);
             EXPORT1(lin_inter_frmadd2);
             EXPORT1(lin_inter_fmadd3);
+
+            EXPORT1(ramp_set);
+            EXPORT1(ramp_mul2);
+            EXPORT1(ramp_mul3);
+            EXPORT1(ramp_fmadd2);
+
+            EXPORT1(delay_init);
+            EXPORT1(delay_write);
+            EXPORT1(delay_read_linear);
+            EXPORT1(delay_read_hermite);
+            EXPORT1(delay_read_lagrange);
+            EXPORT1(delay_read_allpass);
+            EXPORT1(delay_read_taps);
+
+            EXPORT1(set_threads);
+            EXPORT1(get_threads);
+            EXPORT1(add2_mt);
+            EXPORT1(sub2_mt);
+            EXPORT1(mul2_mt);
+            EXPORT1(div2_mt);
+            EXPORT1(add3_mt);
+            EXPORT1(sub3_mt);
+            EXPORT1(mul3_mt);
+            EXPORT1(div3_mt);
+            EXPORT1(fmadd3_mt);
+            EXPORT1(fmadd4_mt);
+            EXPORT1(direct_fft_batch_mt);
+            EXPORT1(reverse_fft_batch_mt);
+            EXPORT1(packed_direct_fft_batch_mt);
+            EXPORT1(packed_reverse_fft_batch_mt);
+            EXPORT1(fastconv_convolve_mt);
+            EXPORT1(calc_bound_box_mt);
+
+            EXPORT1(waveform_mipmap_init);
+            EXPORT1(waveform_mipmap_append);
+            EXPORT1(waveform_mipmap_query);
+
+            EXPORT1(envelope_init);
+            EXPORT1(gain_curve_init);
+            EXPORT1(envelope_peak);
+            EXPORT1(envelope_rms);
+            EXPORT1(envelope_peak_mc);
+            EXPORT1(envelope_rms_mc);
+            EXPORT1(envelope_peak_linked);
+            EXPORT1(envelope_rms_linked);
+            EXPORT1(gain_curve);
+
+            EXPORT1(loudness_init);
+            EXPORT1(loudness_reset);
+            EXPORT1(loudness_accumulate);
+            EXPORT1(loudness_process);
+            EXPORT1(loudness_momentary);
+            EXPORT1(loudness_short_term);
+            EXPORT1(loudness_integrated);
+            EXPORT1(loudness_range);
         }
 
         #undef EXPORT1
@@ -58,6 +58,7 @@
 
         #include <private/dsp/arch/x86/avx/hmath/hsum.h>
         #include <private/dsp/arch/x86/avx/hmath/hdotp.h>
+        #include <private/dsp/arch/x86/avx/hmath/hcsum.h>
 
         #include <private/dsp/arch/x86/avx/mix.h>
         #include <private/dsp/arch/x86/avx/search/minmax.h>
@@ -65,11 +66,14 @@
         #include <private/dsp/arch/x86/avx/fft.h>
         #include <private/dsp/arch/x86/avx/pfft.h>
         #include <private/dsp/arch/x86/avx/fastconv.h>
+        #include <private/dsp/arch/x86/avx/xcorr.h>
+        #include <private/dsp/arch/x86/avx/ir.h>
 
         #include <private/dsp/arch/x86/avx/filters/static.h>
         #include <private/dsp/arch/x86/avx/filters/dynamic.h>
         #include <private/dsp/arch/x86/avx/filters/transform.h>
         #include <private/dsp/arch/x86/avx/filters/transfer.h>
+        #include <private/dsp/arch/x86/avx/filters/crossover.h>
 
         #include <private/dsp/arch/x86/avx/msmatrix.h>
         #include <private/dsp/arch/x86/avx/resampling.h>
@@ -77,6 +81,8 @@
 
         #include <private/dsp/arch/x86/avx/interpolation/linear.h>
 
+        #include <private/dsp/arch/x86/avx/3dmath.h>
+
         #include <private/dsp/arch/x86/avx/graphics/pixelfmt.h>
     #undef PRIVATE_DSP_ARCH_X86_AVX_IMPL
 
@@ -263,6 +269,9 @@
                 CEXPORT1(favx, pcomplex_rcp1);
                 CEXPORT1(favx, pcomplex_rcp2);
 
+                CEXPORT1(favx, xcorr_accumulate);
+                CEXPORT1(favx, ir_render_taps);
+
                 CEXPORT1(favx, biquad_process_x1);
                 CEXPORT1(favx, biquad_process_x2);
                 CEXPORT1(favx, biquad_process_x4);
@@ -278,6 +287,8 @@
                 CEXPORT1(favx, bilinear_transform_x4);
                 CEXPORT2_X64(favx, bilinear_transform_x8, x64_bilinear_transform_x8);
 
+                CEXPORT2_X64(favx, crossover_process, x64_crossover_process);
+
                 CEXPORT1(favx, h_sum);
                 CEXPORT1(favx, h_sqr_sum);
                 CEXPORT1(favx, h_abs_sum);
@@ -286,6 +297,11 @@
                 CEXPORT1(favx, h_sqr_dotp);
                 CEXPORT1(favx, h_abs_dotp);
 
+                CEXPORT1(favx, h_csum);
+                CEXPORT1(favx, h_sqr_csum);
+                CEXPORT1(favx, h_abs_csum);
+                CEXPORT1(favx, h_cdotp);
+
                 CEXPORT1(favx, mix2);
                 CEXPORT1(favx, mix_copy2);
                 CEXPORT1(favx, mix_add2);
@@ -317,11 +333,16 @@
 
                 CEXPORT1(favx, packed_direct_fft);
                 CEXPORT1(favx, packed_reverse_fft);
+                CEXPORT1(favx, direct_fft_batch);
+                CEXPORT1(favx, reverse_fft_batch);
+                CEXPORT1(favx, packed_direct_fft_batch);
+                CEXPORT1(favx, packed_reverse_fft_batch);
 
                 CEXPORT1(favx, fastconv_parse);
                 CEXPORT1(favx, fastconv_restore);
                 CEXPORT1(favx, fastconv_apply);
                 CEXPORT1(favx, fastconv_parse_apply);
+                CEXPORT1(favx, fastconv_fmadd);
 
                 CEXPORT1(favx, filter_transfer_calc_ri);
                 CEXPORT1(favx, filter_transfer_apply_ri);
@@ -359,6 +380,20 @@
                 CEXPORT1(favx, lin_inter_frmadd2);
                 CEXPORT1(favx, lin_inter_fmadd3);
 
+                CEXPORT1(favx, apply_matrix3d_mvn);
+                CEXPORT1(favx, apply_matrix3d_mpn);
+                CEXPORT1(favx, apply_matrix3d_mv_soa);
+                CEXPORT1(favx, apply_matrix3d_mp_soa);
+                CEXPORT1(favx, calc_distance_soa);
+                CEXPORT1(favx, calc_area_soa);
+                CEXPORT1(favx, calc_normal3d_soa);
+                CEXPORT1(favx, colocation_x3_v1_soa);
+                CEXPORT1(favx, calc_distance_p1n);
+                CEXPORT1(favx, calc_sqr_distance_p1n);
+                CEXPORT1(favx, calc_avg_distance_pvn);
+                CEXPORT1(favx, unit_vector_p1pvn);
+                CEXPORT1(favx, vector_mul_v2n);
+
                 CEXPORT2(favx, prgba32_set_alpha, pabc32_set_alpha);
                 CEXPORT2(favx, pbgra32_set_alpha, pabc32_set_alpha);
 
@@ -422,11 +457,16 @@
                     CEXPORT2(favx, reverse_fft, reverse_fft_fma3);
                     CEXPORT2(favx, packed_direct_fft, packed_direct_fft_fma3);
                     CEXPORT2(favx, packed_reverse_fft, packed_reverse_fft_fma3);
+                    CEXPORT2(favx, direct_fft_batch, direct_fft_batch_fma3);
+                    CEXPORT2(favx, reverse_fft_batch, reverse_fft_batch_fma3);
+                    CEXPORT2(favx, packed_direct_fft_batch, packed_direct_fft_batch_fma3);
+                    CEXPORT2(favx, packed_reverse_fft_batch, packed_reverse_fft_batch_fma3);
 
                     CEXPORT2(favx, fastconv_parse, fastconv_parse_fma3);
                     CEXPORT2(favx, fastconv_restore, fastconv_restore_fma3);
                     CEXPORT2(favx, fastconv_apply, fastconv_apply_fma3);
                     CEXPORT2(favx, fastconv_parse_apply, fastconv_parse_apply_fma3);
+                    CEXPORT2(favx, fastconv_fmadd, fastconv_fmadd_fma3);
 
                     CEXPORT2(favx, filter_transfer_calc_ri, filter_transfer_calc_ri_fma3);
                     CEXPORT2(favx, filter_transfer_apply_ri, filter_transfer_apply_ri_fma3);
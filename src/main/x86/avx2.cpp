@@ -51,6 +51,13 @@
 
         #include <private/dsp/arch/x86/avx2/fft/normalize.h>
 
+        #include <private/dsp/arch/x86/avx2/interpolation/ramp.h>
+        #include <private/dsp/arch/x86/avx2/interpolation/delay.h>
+        #include <private/dsp/arch/x86/avx2/shaper.h>
+        #include <private/dsp/arch/x86/avx2/noise.h>
+
+        #include <private/dsp/arch/x86/avx2/dynamics.h>
+
         #include <private/dsp/arch/x86/avx2/search/iminmax.h>
 
         #include <private/dsp/arch/x86/avx2/graphics.h>
@@ -172,9 +179,35 @@
                 CEXPORT2_X64(favx, eff_hsla_sat, x64_eff_hsla_sat);
                 CEXPORT2_X64(favx, eff_hsla_light, x64_eff_hsla_light);
                 CEXPORT2_X64(favx, eff_hsla_alpha, x64_eff_hsla_alpha);
+                CEXPORT1(favx, eff_hsla_hue_bgra32);
+                CEXPORT1(favx, eff_hsla_sat_bgra32);
+                CEXPORT1(favx, eff_hsla_light_bgra32);
+                CEXPORT1(favx, eff_hsla_alpha_bgra32);
+
+                CEXPORT2_X64(favx, smooth_cubic_linear, x64_smooth_cubic_linear);
+                CEXPORT2_X64(favx, smooth_cubic_log, x64_smooth_cubic_log);
+                CEXPORT2_X64(favx, ramp_set, x64_ramp_set);
+                CEXPORT2_X64(favx, ramp_mul2, x64_ramp_mul2);
+                CEXPORT2_X64(favx, ramp_mul3, x64_ramp_mul3);
+                CEXPORT2_X64(favx, ramp_fmadd2, x64_ramp_fmadd2);
+
+                CEXPORT2_X64(favx, delay_read_linear, x64_delay_read_linear);
+                CEXPORT2_X64(favx, delay_read_hermite, x64_delay_read_hermite);
+                CEXPORT2_X64(favx, delay_read_lagrange, x64_delay_read_lagrange);
+                CEXPORT2_X64(favx, delay_read_taps, x64_delay_read_taps);
+
+                CEXPORT2_X64(favx, shaper_linear, x64_shaper_linear);
+                CEXPORT2_X64(favx, shaper_cubic, x64_shaper_cubic);
+
+                CEXPORT2_X64(favx, noise_uniform, x64_noise_uniform);
+                CEXPORT2_X64(favx, noise_tpdf, x64_noise_tpdf);
+                CEXPORT2_X64(favx, noise_gaussian, x64_noise_gaussian);
+
+                CEXPORT2_X64(favx, gain_curve, x64_gain_curve);
 
                 CEXPORT1(favx, normalize_fft2);
                 CEXPORT1(favx, abgr32_to_bgrff32);
+                CEXPORT1(favx, spectrogram_bgra32);
                 CEXPORT2(favx, prgba32_set_alpha, pabc32_set_alpha);
                 CEXPORT2(favx, pbgra32_set_alpha, pabc32_set_alpha);
 
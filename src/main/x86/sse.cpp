@@ -54,6 +54,7 @@
 
         #include <private/dsp/arch/x86/sse/hmath/hsum.h>
         #include <private/dsp/arch/x86/sse/hmath/hdotp.h>
+        #include <private/dsp/arch/x86/sse/hmath/hcsum.h>
 
         #include <private/dsp/arch/x86/sse/mix.h>
 
@@ -63,9 +64,13 @@
 
         #include <private/dsp/arch/x86/sse/fft.h>
         #include <private/dsp/arch/x86/sse/fastconv.h>
+        #include <private/dsp/arch/x86/sse/cqt.h>
+        #include <private/dsp/arch/x86/sse/xcorr.h>
+        #include <private/dsp/arch/x86/sse/ir.h>
         #include <private/dsp/arch/x86/sse/graphics.h>
         #include <private/dsp/arch/x86/sse/msmatrix.h>
         #include <private/dsp/arch/x86/sse/resampling.h>
+        #include <private/dsp/arch/x86/sse/resampling/halfband.h>
 
         #include <private/dsp/arch/x86/sse/complex.h>
         #include <private/dsp/arch/x86/sse/pcomplex.h>
@@ -80,6 +85,8 @@
         #include <private/dsp/arch/x86/sse/3dmath.h>
 
         #include <private/dsp/arch/x86/sse/interpolation/linear.h>
+
+        #include <private/dsp/arch/x86/sse/dynamics.h>
     #undef PRIVATE_DSP_ARCH_X86_SSE_IMPL
 
     namespace lsp
@@ -105,6 +112,31 @@
                 dsp_finish(ctx);
             }
 
+            uint32_t denormal_mode()
+            {
+                uint32_t mxcsr          = read_mxcsr();
+                uint32_t mode           = 0;
+                if (mxcsr & MXCSR_FZ)
+                    mode                   |= dsp::DENORMAL_FTZ;
+                if (mxcsr & MXCSR_DAZ)
+                    mode                   |= dsp::DENORMAL_DAZ;
+                return mode;
+            }
+
+            uint32_t denormal_sample()
+            {
+                uint32_t mxcsr          = read_mxcsr();
+                uint32_t flags          = 0;
+                // DE is not raised for denormal operands while DAZ is set
+                if (mxcsr & MXCSR_DE)
+                    flags                  |= dsp::DENORMAL_INPUT;
+                if (mxcsr & MXCSR_UE)
+                    flags                  |= dsp::DENORMAL_OUTPUT;
+                if (flags)
+                    write_mxcsr(mxcsr & ~(MXCSR_DE | MXCSR_UE));
+                return flags;
+            }
+
             #define EXPORT2(function, export) \
             { \
                 dsp::function                       = sse::export; \
@@ -131,6 +163,8 @@
                 // Export routines
                 EXPORT1(start);
                 EXPORT1(finish);
+                EXPORT1(denormal_mode);
+                EXPORT1(denormal_sample);
 
                 if (!feature_check(f, FEAT_FAST_MOVS))
                 {
@@ -223,6 +257,11 @@
                 EXPORT1(h_sqr_dotp);
                 EXPORT1(h_abs_dotp);
 
+                EXPORT1(h_csum);
+                EXPORT1(h_sqr_csum);
+                EXPORT1(h_abs_csum);
+                EXPORT1(h_cdotp);
+
                 EXPORT1(fmadd_k3);
                 EXPORT1(fmsub_k3);
                 EXPORT1(fmrsub_k3);
@@ -270,13 +309,22 @@
                 EXPORT1(normalize_fft3);
                 EXPORT1(packed_direct_fft);
                 EXPORT1(packed_reverse_fft);
+                EXPORT1(direct_fft_batch);
+                EXPORT1(reverse_fft_batch);
+                EXPORT1(packed_direct_fft_batch);
+                EXPORT1(packed_reverse_fft_batch);
         //            EXPORT1(center_fft);
         //            EXPORT1(combine_fft);
 
+                EXPORT1(cqt_apply);
+                EXPORT1(xcorr_accumulate);
+                EXPORT1(ir_render_taps);
+
                 EXPORT1(fastconv_parse);
                 EXPORT1(fastconv_parse_apply);
                 EXPORT1(fastconv_restore);
                 EXPORT1(fastconv_apply);
+                EXPORT1(fastconv_fmadd);
 
                 EXPORT1(complex_mul2);
                 EXPORT1(complex_mul3);
@@ -353,6 +401,9 @@
                 EXPORT1(downsample_6x);
                 EXPORT1(downsample_8x);
 
+                EXPORT1(halfband_upsample_2x);
+                EXPORT1(halfband_downsample_2x);
+
                 // 3D Math
                 EXPORT1(init_point_xyz);
                 EXPORT1(init_point);
@@ -390,6 +441,13 @@
                 EXPORT1(init_segment_xyz);
                 EXPORT1(init_segment_p2);
                 EXPORT1(init_segment_pv);
+                EXPORT1(init_triangle3d_p3);
+                EXPORT1(init_triangle3d_pv);
+                EXPORT1(init_triangle3d);
+                EXPORT1(calc_triangle3d_params);
+                EXPORT1(calc_triangle3d_p3);
+                EXPORT1(calc_triangle3d_pv);
+                EXPORT1(calc_triangle3d);
 
                 EXPORT1(init_matrix3d);
                 EXPORT1(init_matrix3d_zero);
@@ -407,6 +465,11 @@
                 EXPORT1(apply_matrix3d_mp1);
                 EXPORT1(apply_matrix3d_mm2);
                 EXPORT1(apply_matrix3d_mm1);
+                EXPORT1(apply_matrix3d_mvn);
+                EXPORT1(apply_matrix3d_mpn);
+                EXPORT1(apply_matrix3d_mv_soa);
+                EXPORT1(apply_matrix3d_mp_soa);
+                EXPORT1(apply_matrix3d_mpn_bound_box);
                 EXPORT1(transpose_matrix3d1);
                 EXPORT1(transpose_matrix3d2);
 
@@ -432,6 +495,8 @@
 
                 EXPORT1(calc_normal3d_p3);
                 EXPORT1(calc_normal3d_pv);
+                EXPORT1(vector_mul_v2);
+                EXPORT1(vector_mul_vv);
                 EXPORT1(calc_normal3d_v2);
                 EXPORT1(calc_normal3d_vv);
 
@@ -450,15 +515,44 @@
                 EXPORT1(calc_plane_p3);
                 EXPORT1(calc_plane_pv);
                 EXPORT1(calc_plane_v1p2);
+                EXPORT1(calc_oriented_plane_p3);
+                EXPORT1(calc_oriented_plane_pv);
+                EXPORT1(calc_rev_oriented_plane_p3);
+                EXPORT1(calc_rev_oriented_plane_pv);
 
                 EXPORT1(calc_area_p3);
                 EXPORT1(calc_area_pv);
                 EXPORT1(calc_min_distance_p3);
                 EXPORT1(calc_min_distance_pv);
+                EXPORT1(calc_avg_distance_p3);
+                EXPORT1(calc_distance_p2);
+                EXPORT1(calc_distance_v1);
+                EXPORT1(calc_sqr_distance_p2);
+                EXPORT1(calc_distance_pv);
+                EXPORT1(calc_sqr_distance_pv);
+                EXPORT1(projection_length_p2);
+                EXPORT1(projection_length_v2);
+                EXPORT1(unit_vector_p1p3);
+                EXPORT1(unit_vector_p1pv);
 
                 EXPORT1(split_triangle_raw);
                 EXPORT1(cull_triangle_raw);
 
+                EXPORT1(points3d_to_soa);
+                EXPORT1(points3d_from_soa);
+                EXPORT1(raw_triangles_to_soa);
+                EXPORT1(raw_triangles_from_soa);
+                EXPORT1(calc_distance_soa);
+                EXPORT1(calc_area_soa);
+                EXPORT1(calc_normal3d_soa);
+                EXPORT1(colocation_x3_v1_soa);
+                EXPORT1(calc_distance_p1n);
+                EXPORT1(calc_sqr_distance_p1n);
+                EXPORT1(calc_avg_distance_pvn);
+                EXPORT1(unit_vector_p1pvn);
+                EXPORT1(calc_oriented_plane_pvn);
+                EXPORT1(vector_mul_v2n);
+
                 EXPORT1(convolve);
 
                 EXPORT1(lin_inter_set);
@@ -467,6 +561,9 @@
                 EXPORT1(lin_inter_fmadd2);
                 EXPORT1(lin_inter_frmadd2);
                 EXPORT1(lin_inter_fmadd3);
+
+                EXPORT1(envelope_peak_mc);
+                EXPORT1(envelope_rms_mc);
             }
 
             #undef EXPORT1
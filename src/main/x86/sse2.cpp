@@ -49,6 +49,7 @@
         #include <private/dsp/arch/x86/sse2/graphics.h>
         #include <private/dsp/arch/x86/sse2/graphics/effects.h>
         #include <private/dsp/arch/x86/sse2/graphics/axis.h>
+        #include <private/dsp/arch/x86/sse2/graphics/colormap.h>
 
         #include <private/dsp/arch/x86/sse2/pmath/op_kx.h>
         #include <private/dsp/arch/x86/sse2/pmath/op_vv.h>
@@ -57,6 +58,13 @@
         #include <private/dsp/arch/x86/sse2/pmath/exp.h>
         #include <private/dsp/arch/x86/sse2/pmath/log.h>
         #include <private/dsp/arch/x86/sse2/pmath/pow.h>
+
+        #include <private/dsp/arch/x86/sse2/interpolation/ramp.h>
+        #include <private/dsp/arch/x86/sse2/interpolation/delay.h>
+        #include <private/dsp/arch/x86/sse2/shaper.h>
+        #include <private/dsp/arch/x86/sse2/noise.h>
+
+        #include <private/dsp/arch/x86/sse2/dynamics.h>
     #undef PRIVATE_DSP_ARCH_X86_SSE2_IMPL
 
     namespace lsp
@@ -72,6 +80,7 @@
                 TEST_EXPORT(sse2::export); \
             }
             #define EXPORT1(function)                   EXPORT2(function, function);
+            #define EXPORT2_X64(function, export)       IF_ARCH_X86_64(EXPORT2(function, export));
 
             void dsp_init(const cpu_features_t *f)
             {
@@ -131,11 +140,16 @@
                 EXPORT1(hsla_to_rgba);
                 EXPORT1(rgba_to_hsla);
                 EXPORT1(rgba_to_bgra32);
+                EXPORT1(spectrogram_bgra32);
 
                 EXPORT1(eff_hsla_hue);
                 EXPORT1(eff_hsla_sat);
                 EXPORT1(eff_hsla_light);
                 EXPORT1(eff_hsla_alpha);
+                EXPORT1(eff_hsla_hue_bgra32);
+                EXPORT1(eff_hsla_sat_bgra32);
+                EXPORT1(eff_hsla_light_bgra32);
+                EXPORT1(eff_hsla_alpha_bgra32);
 
                 EXPORT1(axis_apply_log1);
                 EXPORT1(axis_apply_log2);
@@ -143,8 +157,30 @@
                 EXPORT1(abgr32_to_bgrff32);
                 EXPORT2(prgba32_set_alpha, pabc32_set_alpha);
                 EXPORT2(pbgra32_set_alpha, pabc32_set_alpha);
+                EXPORT1(smooth_cubic_linear);
+                EXPORT1(smooth_cubic_log);
+
+                EXPORT1(ramp_set);
+                EXPORT1(ramp_mul2);
+                EXPORT1(ramp_mul3);
+                EXPORT1(ramp_fmadd2);
+
+                EXPORT1(delay_read_linear);
+                EXPORT1(delay_read_hermite);
+                EXPORT1(delay_read_lagrange);
+                EXPORT2_X64(delay_read_taps, x64_delay_read_taps);
+
+                EXPORT1(shaper_linear);
+                EXPORT1(shaper_cubic);
+
+                EXPORT2_X64(noise_uniform, x64_noise_uniform);
+                EXPORT2_X64(noise_tpdf, x64_noise_tpdf);
+                EXPORT2_X64(noise_gaussian, x64_noise_gaussian);
+
+                EXPORT1(gain_curve);
             }
 
+            #undef EXPORT2_X64
             #undef EXPORT1
             #undef EXPORT2
         } /* namespace sse2 */
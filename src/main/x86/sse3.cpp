@@ -46,6 +46,8 @@
         #include <private/dsp/arch/x86/sse3/filters/static.h>
         #include <private/dsp/arch/x86/sse3/filters/dynamic.h>
         #include <private/dsp/arch/x86/sse3/filters/transform.h>
+        #include <private/dsp/arch/x86/sse3/filters/crossover.h>
+        #include <private/dsp/arch/x86/sse3/loudness.h>
         #include <private/dsp/arch/x86/sse3/pcomplex.h>
         #include <private/dsp/arch/x86/sse3/3dmath.h>
     #undef PRIVATE_DSP_ARCH_X86_SSE3_IMPL
@@ -89,6 +91,8 @@
                 EXPORT2_X64(biquad_process_x8, x64_biquad_process_x8);
                 EXPORT2_X64(dyn_biquad_process_x8, x64_dyn_biquad_process_x8);
                 EXPORT2_X64(bilinear_transform_x8, x64_bilinear_transform_x8);
+                EXPORT2_X64(crossover_process, x64_crossover_process);
+                EXPORT2_X64(loudness_accumulate, x64_loudness_accumulate);
                 EXPORT2_X64(axis_apply_log1, x64_axis_apply_log1);
                 EXPORT2_X64(axis_apply_log2, x64_axis_apply_log2);
                 EXPORT2_X64(pcomplex_mul2, x64_pcomplex_mul2);
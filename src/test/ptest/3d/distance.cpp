@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define N_TRIANGLES     0x1000
+
+namespace lsp
+{
+    namespace generic
+    {
+        float calc_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+        float calc_avg_distance_p3(const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+        void unit_vector_p1pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+        float calc_oriented_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+        void vector_mul_v2(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2);
+
+        void calc_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+        void calc_avg_distance_pvn(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+        void unit_vector_p1pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+        void calc_oriented_plane_pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+        void vector_mul_v2n(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            float calc_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            float calc_avg_distance_p3(const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            void unit_vector_p1pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+            float calc_oriented_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+            void vector_mul_v2(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2);
+
+            void calc_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+            void calc_avg_distance_pvn(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void unit_vector_p1pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void calc_oriented_plane_pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void vector_mul_v2n(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n);
+        }
+
+        namespace avx
+        {
+            void calc_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+            void calc_avg_distance_pvn(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void unit_vector_p1pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void vector_mul_v2n(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            float calc_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            float calc_avg_distance_p3(const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            void unit_vector_p1pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+            float calc_oriented_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+            void vector_mul_v2(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2);
+
+            void calc_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+            void calc_avg_distance_pvn(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void unit_vector_p1pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void calc_oriented_plane_pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void vector_mul_v2n(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n);
+        }
+    )
+
+    typedef float (* calc_distance_p2_t)(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+    typedef float (* calc_avg_distance_p3_t)(const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+    typedef void (* unit_vector_p1pv_t)(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+    typedef float (* calc_oriented_plane_pv_t)(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+    typedef void (* vector_mul_v2_t)(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2);
+
+    typedef void (* calc_distance_p1n_t)(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+    typedef void (* unit_vector_p1pvn_t)(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+    typedef void (* vector_mul_v2n_t)(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test: single calls in a loop vs. bulk calls
+PTEST_BEGIN("dsp.3d", distance, 5, 1000)
+
+    typedef struct context_t
+    {
+        dsp::point3d_t         *pv;         // Vertexes of triangles
+        dsp::vector3d_t        *v1;         // First operand vectors
+        dsp::vector3d_t        *v2;         // Second operand vectors
+        dsp::vector3d_t        *vo;         // Output vectors
+        float                  *f;          // Output floats
+        dsp::point3d_t          sp;         // Source point
+    } context_t;
+
+    void call(const char *label, context_t *ctx, calc_distance_p2_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            for (size_t i=0; i<N_TRIANGLES; ++i)
+                ctx->f[i]   = func(&ctx->sp, &ctx->pv[i]);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, calc_avg_distance_p3_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            const dsp::point3d_t *p = ctx->pv;
+            for (size_t i=0; i<N_TRIANGLES; ++i, p += 3)
+                ctx->f[i]   = func(&ctx->sp, &p[0], &p[1], &p[2]);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, unit_vector_p1pv_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            for (size_t i=0; i<N_TRIANGLES; ++i)
+                func(&ctx->vo[i], &ctx->sp, &ctx->pv[i*3]);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, calc_oriented_plane_pv_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            for (size_t i=0; i<N_TRIANGLES; ++i)
+                func(&ctx->vo[i], &ctx->sp, &ctx->pv[i*3]);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, vector_mul_v2_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            for (size_t i=0; i<N_TRIANGLES; ++i)
+                func(&ctx->vo[i], &ctx->v1[i], &ctx->v2[i]);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, calc_distance_p1n_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            func(ctx->f, &ctx->sp, ctx->pv, N_TRIANGLES);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, unit_vector_p1pvn_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            func(ctx->vo, &ctx->sp, ctx->pv, N_TRIANGLES);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, vector_mul_v2n_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            func(ctx->vo, ctx->v1, ctx->v2, N_TRIANGLES);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size     = N_TRIANGLES * (sizeof(dsp::point3d_t) * 3 + sizeof(dsp::vector3d_t) * 3 + sizeof(float));
+        uint8_t *data       = NULL;
+        uint8_t *ptr        = alloc_aligned<uint8_t>(data, buf_size, 64);
+        context_t ctx;
+
+        ctx.pv              = reinterpret_cast<dsp::point3d_t *>(ptr);
+        ctx.v1              = reinterpret_cast<dsp::vector3d_t *>(&ctx.pv[N_TRIANGLES * 3]);
+        ctx.v2              = &ctx.v1[N_TRIANGLES];
+        ctx.vo              = &ctx.v2[N_TRIANGLES];
+        ctx.f               = reinterpret_cast<float *>(&ctx.vo[N_TRIANGLES]);
+
+        for (size_t i=0; i<N_TRIANGLES*3; ++i)
+            dsp::init_point_xyz(&ctx.pv[i], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+        for (size_t i=0; i<N_TRIANGLES; ++i)
+        {
+            dsp::init_vector_dxyz(&ctx.v1[i], randf(-1.0f, 1.0f), randf(-1.0f, 1.0f), randf(-1.0f, 1.0f));
+            dsp::init_vector_dxyz(&ctx.v2[i], randf(-1.0f, 1.0f), randf(-1.0f, 1.0f), randf(-1.0f, 1.0f));
+        }
+        dsp::init_point_xyz(&ctx.sp, randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+
+        #define CALL(func) \
+            call(#func, &ctx, func)
+
+        CALL(generic::calc_distance_p2);
+        IF_ARCH_X86(CALL(sse::calc_distance_p2));
+        IF_ARCH_AARCH64(CALL(asimd::calc_distance_p2));
+        CALL(generic::calc_distance_p1n);
+        IF_ARCH_X86(CALL(sse::calc_distance_p1n));
+        IF_ARCH_X86(CALL(avx::calc_distance_p1n));
+        IF_ARCH_AARCH64(CALL(asimd::calc_distance_p1n));
+        PTEST_SEPARATOR;
+
+        CALL(generic::calc_avg_distance_p3);
+        IF_ARCH_X86(CALL(sse::calc_avg_distance_p3));
+        IF_ARCH_AARCH64(CALL(asimd::calc_avg_distance_p3));
+        CALL(generic::calc_avg_distance_pvn);
+        IF_ARCH_X86(CALL(sse::calc_avg_distance_pvn));
+        IF_ARCH_X86(CALL(avx::calc_avg_distance_pvn));
+        IF_ARCH_AARCH64(CALL(asimd::calc_avg_distance_pvn));
+        PTEST_SEPARATOR;
+
+        CALL(generic::unit_vector_p1pv);
+        IF_ARCH_X86(CALL(sse::unit_vector_p1pv));
+        IF_ARCH_AARCH64(CALL(asimd::unit_vector_p1pv));
+        CALL(generic::unit_vector_p1pvn);
+        IF_ARCH_X86(CALL(sse::unit_vector_p1pvn));
+        IF_ARCH_X86(CALL(avx::unit_vector_p1pvn));
+        IF_ARCH_AARCH64(CALL(asimd::unit_vector_p1pvn));
+        PTEST_SEPARATOR;
+
+        CALL(generic::calc_oriented_plane_pv);
+        IF_ARCH_X86(CALL(sse::calc_oriented_plane_pv));
+        IF_ARCH_AARCH64(CALL(asimd::calc_oriented_plane_pv));
+        CALL(generic::calc_oriented_plane_pvn);
+        IF_ARCH_X86(CALL(sse::calc_oriented_plane_pvn));
+        IF_ARCH_AARCH64(CALL(asimd::calc_oriented_plane_pvn));
+        PTEST_SEPARATOR;
+
+        CALL(generic::vector_mul_v2);
+        IF_ARCH_X86(CALL(sse::vector_mul_v2));
+        IF_ARCH_AARCH64(CALL(asimd::vector_mul_v2));
+        CALL(generic::vector_mul_v2n);
+        IF_ARCH_X86(CALL(sse::vector_mul_v2n));
+        IF_ARCH_X86(CALL(avx::vector_mul_v2n));
+        IF_ARCH_AARCH64(CALL(asimd::vector_mul_v2n));
+        PTEST_SEPARATOR;
+
+        #undef CALL
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        8
+#define MAX_RANK        14
+
+namespace lsp
+{
+    namespace generic
+    {
+        void apply_matrix3d_mp2(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m);
+        void apply_matrix3d_mpn(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+        void apply_matrix3d_mp_soa(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+        void apply_matrix3d_mpn_bound_box(dsp::bound_box3d_t *b, dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void apply_matrix3d_mp2(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m);
+            void apply_matrix3d_mpn(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mp_soa(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mpn_bound_box(dsp::bound_box3d_t *b, dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+        }
+
+        namespace avx
+        {
+            void apply_matrix3d_mpn(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mp_soa(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void apply_matrix3d_mpn(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mp_soa(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mpn_bound_box(dsp::bound_box3d_t *b, dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+        }
+    )
+
+    typedef void (* apply_matrix3d_mp2_t)(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m);
+    typedef void (* apply_matrix3d_mpn_t)(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+    typedef void (* apply_matrix3d_mp_soa_t)(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+    typedef void (* apply_matrix3d_mpn_bound_box_t)(dsp::bound_box3d_t *b, dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test
+PTEST_BEGIN("dsp.3d", matrix_array, 5, 1000)
+
+    void call(const char *label, dsp::point3d_t *dst, const dsp::point3d_t *src, const dsp::matrix3d_t *m, size_t count, apply_matrix3d_mp2_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x%d", label, int(count));
+        printf("Testing %s points...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<count; ++i)
+                func(&dst[i], &src[i], m);
+        );
+    }
+
+    void call(const char *label, dsp::point3d_t *dst, const dsp::point3d_t *src, const dsp::matrix3d_t *m, size_t count, apply_matrix3d_mpn_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x%d", label, int(count));
+        printf("Testing %s points...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, src, m, count);
+        );
+    }
+
+    void call(const char *label, float *dst, float *src, const dsp::matrix3d_t *m, size_t count, apply_matrix3d_mp_soa_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x%d", label, int(count));
+        printf("Testing %s points...\n", buf);
+
+        dsp::point3d_soa_t d = { dst, &dst[count], &dst[count*2] };
+        dsp::point3d_soa_t s = { src, &src[count], &src[count*2] };
+        PTEST_LOOP(buf,
+            func(&d, &s, m, count);
+        );
+    }
+
+    void call(const char *label, dsp::point3d_t *dst, const dsp::point3d_t *src, const dsp::matrix3d_t *m, size_t count, apply_matrix3d_mpn_bound_box_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x%d", label, int(count));
+        printf("Testing %s points...\n", buf);
+
+        dsp::bound_box3d_t b;
+        PTEST_LOOP(buf,
+            func(&b, dst, src, m, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t count        = 1 << MAX_RANK;
+        size_t buf_size     = count * sizeof(dsp::point3d_t) * 2;
+        uint8_t *data       = NULL;
+        uint8_t *ptr        = alloc_aligned<uint8_t>(data, buf_size, 64);
+
+        dsp::point3d_t *src = reinterpret_cast<dsp::point3d_t *>(ptr);
+        dsp::point3d_t *dst = &src[count];
+        float *fsrc         = reinterpret_cast<float *>(src);
+        float *fdst         = reinterpret_cast<float *>(dst);
+
+        dsp::matrix3d_t m;
+        for (size_t i=0; i<16; ++i)
+            m.m[i]              = randf(-1.0f, 1.0f);
+        m.m[15]             = 1.0f;
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            size_t n            = 1 << i;
+            for (size_t j=0; j<n; ++j)
+                dsp::init_point_xyz(&src[j], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+
+            call("generic::apply_matrix3d_mp2", dst, src, &m, n, generic::apply_matrix3d_mp2);
+            IF_ARCH_X86(call("sse::apply_matrix3d_mp2", dst, src, &m, n, sse::apply_matrix3d_mp2));
+            call("generic::apply_matrix3d_mpn", dst, src, &m, n, generic::apply_matrix3d_mpn);
+            IF_ARCH_X86(call("sse::apply_matrix3d_mpn", dst, src, &m, n, sse::apply_matrix3d_mpn));
+            IF_ARCH_X86(call("avx::apply_matrix3d_mpn", dst, src, &m, n, avx::apply_matrix3d_mpn));
+            IF_ARCH_AARCH64(call("asimd::apply_matrix3d_mpn", dst, src, &m, n, asimd::apply_matrix3d_mpn));
+            PTEST_SEPARATOR;
+
+            call("generic::apply_matrix3d_mp_soa", fdst, fsrc, &m, n, generic::apply_matrix3d_mp_soa);
+            IF_ARCH_X86(call("sse::apply_matrix3d_mp_soa", fdst, fsrc, &m, n, sse::apply_matrix3d_mp_soa));
+            IF_ARCH_X86(call("avx::apply_matrix3d_mp_soa", fdst, fsrc, &m, n, avx::apply_matrix3d_mp_soa));
+            IF_ARCH_AARCH64(call("asimd::apply_matrix3d_mp_soa", fdst, fsrc, &m, n, asimd::apply_matrix3d_mp_soa));
+            PTEST_SEPARATOR;
+
+            call("generic::apply_matrix3d_mpn_bound_box", dst, src, &m, n, generic::apply_matrix3d_mpn_bound_box);
+            IF_ARCH_X86(call("sse::apply_matrix3d_mpn_bound_box", dst, src, &m, n, sse::apply_matrix3d_mpn_bound_box));
+            IF_ARCH_AARCH64(call("asimd::apply_matrix3d_mpn_bound_box", dst, src, &m, n, asimd::apply_matrix3d_mpn_bound_box));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define N_TRIANGLES     0x1000
+
+namespace lsp
+{
+    namespace generic
+    {
+        float calc_area_pv(const dsp::point3d_t *pv);
+        void calc_normal3d_pv(dsp::vector3d_t *n, const dsp::point3d_t *pv);
+        size_t colocation_x3_v1pv(const dsp::vector3d_t *pl, const dsp::point3d_t *pv);
+
+        void raw_triangles_to_soa(const dsp::raw_triangle_soa_t *dst, const dsp::raw_triangle_t *src, size_t n);
+        void raw_triangles_from_soa(dsp::raw_triangle_t *dst, const dsp::raw_triangle_soa_t *src, size_t n);
+        void calc_area_soa(float *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+        void calc_normal3d_soa(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+        void colocation_x3_v1_soa(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            float calc_area_pv(const dsp::point3d_t *pv);
+            void calc_normal3d_pv(dsp::vector3d_t *n, const dsp::point3d_t *pv);
+            size_t colocation_x3_v1pv(const dsp::vector3d_t *pl, const dsp::point3d_t *pv);
+
+            void raw_triangles_to_soa(const dsp::raw_triangle_soa_t *dst, const dsp::raw_triangle_t *src, size_t n);
+            void raw_triangles_from_soa(dsp::raw_triangle_t *dst, const dsp::raw_triangle_soa_t *src, size_t n);
+            void calc_area_soa(float *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void calc_normal3d_soa(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void colocation_x3_v1_soa(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n);
+        }
+
+        namespace avx
+        {
+            void calc_area_soa(float *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void calc_normal3d_soa(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void colocation_x3_v1_soa(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void raw_triangles_to_soa(const dsp::raw_triangle_soa_t *dst, const dsp::raw_triangle_t *src, size_t n);
+            void raw_triangles_from_soa(dsp::raw_triangle_t *dst, const dsp::raw_triangle_soa_t *src, size_t n);
+            void calc_area_soa(float *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void calc_normal3d_soa(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void colocation_x3_v1_soa(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n);
+        }
+    )
+
+    typedef float (* calc_area_pv_t)(const dsp::point3d_t *pv);
+    typedef void (* calc_normal3d_pv_t)(dsp::vector3d_t *n, const dsp::point3d_t *pv);
+    typedef size_t (* colocation_x3_v1pv_t)(const dsp::vector3d_t *pl, const dsp::point3d_t *pv);
+
+    typedef void (* raw_triangles_to_soa_t)(const dsp::raw_triangle_soa_t *dst, const dsp::raw_triangle_t *src, size_t n);
+    typedef void (* raw_triangles_from_soa_t)(dsp::raw_triangle_t *dst, const dsp::raw_triangle_soa_t *src, size_t n);
+    typedef void (* calc_area_soa_t)(float *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+    typedef void (* calc_normal3d_soa_t)(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+    typedef void (* colocation_x3_v1_soa_t)(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test
+PTEST_BEGIN("dsp.3d", soa, 5, 1000)
+
+    typedef struct context_t
+    {
+        dsp::raw_triangle_t    *aos;        // Triangles as array of structures
+        dsp::raw_triangle_t    *out;        // Output triangles
+        dsp::raw_triangle_soa_t soa;        // Triangles as structure of arrays
+        dsp::vector3d_soa_t     n;          // Normals as structure of arrays
+        dsp::vector3d_t        *vn;         // Normals as array of structures
+        float                  *f;          // Output floats
+        uint32_t               *tags;       // Output tags
+        dsp::vector3d_t         pl;         // Plane equation
+    } context_t;
+
+    void call(const char *label, context_t *ctx, raw_triangles_to_soa_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            func(&ctx->soa, ctx->aos, N_TRIANGLES);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, raw_triangles_from_soa_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            func(ctx->out, &ctx->soa, N_TRIANGLES);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, calc_area_pv_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            for (size_t i=0; i<N_TRIANGLES; ++i)
+                ctx->f[i]   = func(ctx->aos[i].v);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, calc_area_soa_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            func(ctx->f, &ctx->soa, N_TRIANGLES);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, calc_normal3d_pv_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            for (size_t i=0; i<N_TRIANGLES; ++i)
+                func(&ctx->vn[i], ctx->aos[i].v);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, calc_normal3d_soa_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            func(&ctx->n, &ctx->soa, N_TRIANGLES);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, colocation_x3_v1pv_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            for (size_t i=0; i<N_TRIANGLES; ++i)
+                ctx->tags[i]    = func(&ctx->pl, ctx->aos[i].v);
+        );
+    }
+
+    void call(const char *label, context_t *ctx, colocation_x3_v1_soa_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            func(ctx->tags, &ctx->pl, &ctx->soa, N_TRIANGLES);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size     = N_TRIANGLES * (sizeof(dsp::raw_triangle_t) * 2 + sizeof(dsp::vector3d_t) + sizeof(float) * 13 + sizeof(uint32_t));
+        uint8_t *data       = NULL;
+        uint8_t *ptr        = alloc_aligned<uint8_t>(data, buf_size, 64);
+        context_t ctx;
+
+        ctx.aos             = reinterpret_cast<dsp::raw_triangle_t *>(ptr);
+        ctx.out             = &ctx.aos[N_TRIANGLES];
+        ctx.vn              = reinterpret_cast<dsp::vector3d_t *>(&ctx.out[N_TRIANGLES]);
+        float *f            = reinterpret_cast<float *>(&ctx.vn[N_TRIANGLES]);
+        for (size_t i=0; i<3; ++i)
+        {
+            ctx.soa.v[i].x      = f;    f  += N_TRIANGLES;
+            ctx.soa.v[i].y      = f;    f  += N_TRIANGLES;
+            ctx.soa.v[i].z      = f;    f  += N_TRIANGLES;
+        }
+        ctx.n.dx            = f;    f  += N_TRIANGLES;
+        ctx.n.dy            = f;    f  += N_TRIANGLES;
+        ctx.n.dz            = f;    f  += N_TRIANGLES;
+        ctx.f               = f;    f  += N_TRIANGLES;
+        ctx.tags            = reinterpret_cast<uint32_t *>(f);
+
+        for (size_t i=0; i<N_TRIANGLES; ++i)
+            for (size_t j=0; j<3; ++j)
+                dsp::init_point_xyz(&ctx.aos[i].v[j], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+        dsp::init_normal3d_dxyz(&ctx.pl, randf(-1.0f, 1.0f), randf(-1.0f, 1.0f), randf(-1.0f, 1.0f));
+        ctx.pl.dw           = randf(-1.0f, 1.0f);
+        generic::raw_triangles_to_soa(&ctx.soa, ctx.aos, N_TRIANGLES);
+
+        #define CALL(func) \
+            call(#func, &ctx, func)
+
+        CALL(generic::raw_triangles_to_soa);
+        IF_ARCH_X86(CALL(sse::raw_triangles_to_soa));
+        IF_ARCH_AARCH64(CALL(asimd::raw_triangles_to_soa));
+        PTEST_SEPARATOR;
+
+        CALL(generic::raw_triangles_from_soa);
+        IF_ARCH_X86(CALL(sse::raw_triangles_from_soa));
+        IF_ARCH_AARCH64(CALL(asimd::raw_triangles_from_soa));
+        PTEST_SEPARATOR;
+
+        CALL(generic::calc_area_pv);
+        IF_ARCH_X86(CALL(sse::calc_area_pv));
+        CALL(generic::calc_area_soa);
+        IF_ARCH_X86(CALL(sse::calc_area_soa));
+        IF_ARCH_X86(CALL(avx::calc_area_soa));
+        IF_ARCH_AARCH64(CALL(asimd::calc_area_soa));
+        PTEST_SEPARATOR;
+
+        CALL(generic::calc_normal3d_pv);
+        IF_ARCH_X86(CALL(sse::calc_normal3d_pv));
+        CALL(generic::calc_normal3d_soa);
+        IF_ARCH_X86(CALL(sse::calc_normal3d_soa));
+        IF_ARCH_X86(CALL(avx::calc_normal3d_soa));
+        IF_ARCH_AARCH64(CALL(asimd::calc_normal3d_soa));
+        PTEST_SEPARATOR;
+
+        CALL(generic::colocation_x3_v1pv);
+        IF_ARCH_X86(CALL(sse::colocation_x3_v1pv));
+        CALL(generic::colocation_x3_v1_soa);
+        IF_ARCH_X86(CALL(sse::colocation_x3_v1_soa));
+        IF_ARCH_X86(CALL(avx::colocation_x3_v1_soa));
+        IF_ARCH_AARCH64(CALL(asimd::colocation_x3_v1_soa));
+        PTEST_SEPARATOR;
+
+        #undef CALL
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 16
+#define BANDS    LSP_DSP_CROSSOVER_MAX_BANDS
+
+namespace lsp
+{
+    namespace generic
+    {
+        void crossover_init(dsp::crossover_t *c, const dsp::crossover_params_t *p);
+        void crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c);
+        void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+    }
+
+    IF_ARCH_X86_64(
+        namespace sse3
+        {
+            void x64_crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c);
+        }
+
+        namespace avx
+        {
+            void x64_crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c);
+        }
+    )
+
+    typedef void (* crossover_process_t)(float **dst, const float *src, size_t count, dsp::crossover_t *c);
+}
+
+PTEST_BEGIN("dsp", crossover, 5, 1000)
+
+    void call(const char *label, float **dst, const float *src, dsp::crossover_t *c, size_t bands, size_t count, crossover_process_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s %d bands x %d", label, int(bands), int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        dsp::crossover_params_t p;
+        p.type          = dsp::CROSSOVER_LR4;
+        p.bands         = bands;
+        p.phase         = 1;
+        for (size_t i=0; i<bands-1; ++i)
+            p.freq[i]       = (100.0f * (i + 1) * (i + 1)) / 48000.0f;
+
+        generic::crossover_init(c, &p);
+
+        PTEST_LOOP(buf,
+            func(dst, src, count, c);
+        );
+    }
+
+    // The same split computed by series of biquad_process_x8 passes, one pass per band
+    void call_biquad(const char *label, float **dst, const float *src, dsp::biquad_t *f, size_t bands, size_t count)
+    {
+        char buf[80];
+        sprintf(buf, "%s %d bands x %d", label, int(bands), int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        for (size_t i=0; i<bands*2; ++i)
+        {
+            dsp::biquad_t *bq = &f[i];
+            for (size_t j=0; j<LSP_DSP_BIQUAD_D_ITEMS; ++j)
+                bq->d[j]        = 0.0f;
+            for (size_t j=0; j<8; ++j)
+            {
+                bq->x8.b0[j]    = 1.0f;
+                bq->x8.b1[j]    = 0.0f;
+                bq->x8.b2[j]    = 0.0f;
+                bq->x8.a1[j]    = 0.0f;
+                bq->x8.a2[j]    = 0.0f;
+            }
+        }
+
+        // 10 sections per band for 8-band LR4 crossover require two x8 passes
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<bands; ++i)
+            {
+                dsp::biquad_process_x8(dst[i], src, count, &f[i*2]);
+                dsp::biquad_process_x8(dst[i], dst[i], count, &f[i*2 + 1]);
+            }
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *ptr      = alloc_aligned<float>(data, buf_size * (BANDS + 1), 64);
+        uint8_t *c_data = NULL;
+        uint8_t *f_data = NULL;
+        dsp::crossover_t *c = alloc_aligned<dsp::crossover_t>(c_data, 1, 64);
+        dsp::biquad_t *f    = alloc_aligned<dsp::biquad_t>(f_data, BANDS * 2, 64);
+
+        float *dst[BANDS];
+        const float *src = &ptr[buf_size * BANDS];
+        for (size_t i=0; i<BANDS; ++i)
+            dst[i]          = &ptr[buf_size * i];
+
+        randomize_sign(ptr, buf_size * (BANDS + 1));
+
+        #define CALL(func, bands) \
+            call(#func, dst, src, c, bands, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            size_t count = 1 << i;
+
+            call_biquad("dsp::biquad_process_x8", dst, src, f, 4, count);
+            CALL(generic::crossover_process, 4);
+            IF_ARCH_X86_64(CALL(sse3::x64_crossover_process, 4));
+            IF_ARCH_X86_64(CALL(avx::x64_crossover_process, 4));
+            IF_ARCH_AARCH64(CALL(asimd::crossover_process, 4));
+            PTEST_SEPARATOR;
+
+            call_biquad("dsp::biquad_process_x8", dst, src, f, 8, count);
+            CALL(generic::crossover_process, 8);
+            IF_ARCH_X86_64(CALL(sse3::x64_crossover_process, 8));
+            IF_ARCH_X86_64(CALL(avx::x64_crossover_process, 8));
+            IF_ARCH_AARCH64(CALL(asimd::crossover_process, 8));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(f_data);
+        free_aligned(c_data);
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 16
+#define CHANNELS 4
+
+namespace lsp
+{
+    namespace generic
+    {
+        void envelope_init(dsp::envelope_t *env, float attack, float release);
+        void gain_curve_init(dsp::gain_curve_t *c, float threshold, float ratio, float knee, dsp::gain_curve_type_t type);
+        void envelope_peak_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+        void envelope_rms_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+        void gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void envelope_peak_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+            void envelope_rms_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+        }
+
+        namespace sse2
+        {
+            void gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace avx2
+        {
+            void x64_gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void envelope_peak_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+            void envelope_rms_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+            void gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count);
+        }
+    )
+
+    typedef void (* envelope_mc_t)(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+    typedef void (* gain_curve_func_t)(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count);
+}
+
+PTEST_BEGIN("dsp", dynamics, 5, 5000)
+
+    void call(const char *label, float **dst, const float **src, size_t count, envelope_mc_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        dsp::envelope_t env[CHANNELS];
+        for (size_t i=0; i<CHANNELS; ++i)
+            generic::envelope_init(&env[i], 10.0f, 100.0f);
+
+        PTEST_LOOP(buf,
+            func(dst, src, env, CHANNELS, count);
+        );
+    }
+
+    void call(const char *label, float *dst, const float *src, size_t count, gain_curve_func_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        dsp::gain_curve_t c;
+        generic::gain_curve_init(&c, 0.1f, 4.0f, 0.5f, dsp::GAIN_CURVE_COMPRESSOR);
+
+        PTEST_LOOP(buf,
+            func(dst, src, &c, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *ptr      = alloc_aligned<float>(data, buf_size * CHANNELS * 2, 64);
+
+        float *dst[CHANNELS];
+        const float *src[CHANNELS];
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            dst[i]          = &ptr[buf_size * i];
+            src[i]          = &ptr[buf_size * (i + CHANNELS)];
+        }
+
+        randomize(ptr, buf_size * CHANNELS * 2, 0.0f, 1.0f);
+
+        #define CALL_MC(func) \
+            call(#func, dst, src, count, func)
+        #define CALL(func) \
+            call(#func, dst[0], src[0], count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            size_t count = 1 << i;
+
+            CALL_MC(generic::envelope_peak_mc);
+            IF_ARCH_X86(CALL_MC(sse::envelope_peak_mc));
+            IF_ARCH_AARCH64(CALL_MC(asimd::envelope_peak_mc));
+            PTEST_SEPARATOR;
+
+            CALL_MC(generic::envelope_rms_mc);
+            IF_ARCH_X86(CALL_MC(sse::envelope_rms_mc));
+            IF_ARCH_AARCH64(CALL_MC(asimd::envelope_rms_mc));
+            PTEST_SEPARATOR;
+
+            CALL(generic::gain_curve);
+            IF_ARCH_X86(CALL(sse2::gain_curve));
+            IF_ARCH_X86_64(CALL(avx2::x64_gain_curve));
+            IF_ARCH_AARCH64(CALL(asimd::gain_curve));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        6
+#define MAX_RANK        13
+#define CHANNELS        32
+
+namespace lsp
+{
+    namespace generic
+    {
+        void packed_direct_fft(float *dst, const float *src, size_t rank);
+        void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+        }
+
+        namespace avx
+        {
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void packed_direct_fft_fma3(float *dst, const float *src, size_t rank);
+            void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+            void packed_direct_fft_batch_fma3(float **dst, const float * const *src, size_t rank, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+        }
+    )
+
+    typedef void (* packed_fft_t)(float *dst, const float *src, size_t rank);
+    typedef void (* packed_fft_batch_t)(float **dst, const float * const *src, size_t rank, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for batched FFT
+PTEST_BEGIN("dsp.fft", batch, 10, 1000)
+
+    void call(const char *label, float **dst, const float * const *src, size_t rank, packed_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d x %d", label, int(CHANNELS), int(1 << rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            for (size_t j=0; j<CHANNELS; ++j)
+                fft(dst[j], src[j], rank);
+        )
+    }
+
+    void call(const char *label, float **dst, const float * const *src, size_t rank, packed_fft_batch_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d x %d", label, int(CHANNELS), int(1 << rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            fft(dst, src, rank, CHANNELS);
+        )
+    }
+
+    PTEST_MAIN
+    {
+        size_t fft_size = 2 << MAX_RANK;
+
+        uint8_t *data   = NULL;
+        float *src[CHANNELS], *dst[CHANNELS];
+
+        float *ptr      = alloc_aligned<float>(data, fft_size * CHANNELS * 2, 64);
+        for (size_t j=0; j<CHANNELS; ++j)
+        {
+            src[j]          = ptr;
+            dst[j]          = &ptr[fft_size];
+            ptr            += fft_size * 2;
+
+            for (size_t i=0; i < fft_size; ++i)
+                src[j][i]       = randf(-1.0f, 1.0f);
+        }
+
+        #define CALL(func) \
+            call(#func, dst, src, i, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            CALL(generic::packed_direct_fft);
+            CALL(generic::packed_direct_fft_batch);
+            IF_ARCH_X86(CALL(sse::packed_direct_fft));
+            IF_ARCH_X86(CALL(sse::packed_direct_fft_batch));
+            IF_ARCH_X86(CALL(avx::packed_direct_fft));
+            IF_ARCH_X86(CALL(avx::packed_direct_fft_batch));
+            IF_ARCH_X86(CALL(avx::packed_direct_fft_fma3));
+            IF_ARCH_X86(CALL(avx::packed_direct_fft_batch_fma3));
+            IF_ARCH_AARCH64(CALL(asimd::packed_direct_fft));
+            IF_ARCH_AARCH64(CALL(asimd::packed_direct_fft_batch));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
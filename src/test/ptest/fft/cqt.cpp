@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        10
+#define MAX_RANK        14
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t cqt_bins(const dsp::cqt_params_t *p);
+        size_t cqt_kernel_size(const dsp::cqt_params_t *p);
+        void cqt_init(dsp::cqt_bin_t *bins, float *kernel, float *tmp, const dsp::cqt_params_t *p);
+        void cqt_apply(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void cqt_apply(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void cqt_apply(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count);
+        }
+    )
+
+    typedef void (* cqt_apply_t)(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for constant-Q transform
+PTEST_BEGIN("dsp.fft", cqt, 10, 1000)
+
+    void call(const char *label, float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel,
+            size_t count, size_t rank, cqt_apply_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s rank %d", label, int(rank));
+        printf("Testing %s on %d bins...\n", buf, int(count));
+
+        PTEST_LOOP(buf,
+            func(dst, fft, bins, kernel, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        dsp::cqt_params_t p;
+        p.fmin          = 20.0f / 48000.0f;
+        p.fmax          = 20000.0f / 48000.0f;
+        p.bpo           = 24;
+        p.rank          = MAX_RANK;
+
+        size_t fft_size = 1 << MAX_RANK;
+        size_t nbins    = generic::cqt_bins(&p);
+        size_t ksize    = generic::cqt_kernel_size(&p);
+
+        uint8_t *data   = NULL;
+        uint8_t *bdata  = NULL;
+        float *fft      = alloc_aligned<float>(data, fft_size * 4 + nbins + ksize, 64);
+        float *tmp      = &fft[fft_size * 2];
+        float *dst      = &tmp[fft_size * 2];
+        float *kernel   = &dst[nbins];
+        dsp::cqt_bin_t *bins = alloc_aligned<dsp::cqt_bin_t>(bdata, nbins, 64);
+
+        for (size_t i=0; i < fft_size*2; ++i)
+            fft[i]          = randf(-1.0f, 1.0f);
+
+        #define CALL(func) \
+            call(#func, dst, fft, bins, kernel, nbins, rank, func)
+
+        for (size_t rank=MIN_RANK; rank <= MAX_RANK; ++rank)
+        {
+            p.rank          = rank;
+            generic::cqt_init(bins, kernel, tmp, &p);
+
+            CALL(generic::cqt_apply);
+            IF_ARCH_X86(CALL(sse::cqt_apply));
+            IF_ARCH_AARCH64(CALL(asimd::cqt_apply));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+        free_aligned(bdata);
+    }
+
+PTEST_END
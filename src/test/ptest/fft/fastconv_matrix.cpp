@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        8
+#define MAX_RANK        14
+#define MAX_INPUTS      4
+#define MAX_OUTPUTS     16
+
+//-----------------------------------------------------------------------------
+// Performance test for convolution matrix
+PTEST_BEGIN("dsp.fft", fastconv_matrix, 10, 1000)
+
+    void call_paths(float * const *dst, float *tmp, const float * const *c, const float * const *src,
+            size_t rank, size_t inputs, size_t outputs)
+    {
+        char buf[80];
+        sprintf(buf, "fastconv_parse_apply %dx%d x %d", int(inputs), int(outputs), int(1 << rank));
+        printf("Testing %s samples...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t o=0; o<outputs; ++o)
+                for (size_t i=0; i<inputs; ++i)
+                    dsp::fastconv_parse_apply(dst[o], tmp, c[o*inputs + i], src[i], rank);
+        );
+    }
+
+    void call_matrix(float * const *dst, float *tmp, const float * const *c, const float * const *src,
+            size_t rank, size_t inputs, size_t outputs)
+    {
+        char buf[80];
+        sprintf(buf, "fastconv_matrix_apply %dx%d x %d", int(inputs), int(outputs), int(1 << rank));
+        printf("Testing %s samples...\n", buf);
+
+        PTEST_LOOP(buf,
+            dsp::fastconv_matrix_apply(dst, tmp, c, src, rank, inputs, outputs);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t half     = 1 << (MAX_RANK - 1);
+        size_t items    = 1 << (MAX_RANK + 1);
+        size_t paths    = MAX_INPUTS * MAX_OUTPUTS;
+        size_t alloc    = MAX_INPUTS * half + MAX_OUTPUTS * half * 2 + paths * items + (MAX_INPUTS + 2) * items;
+        uint8_t *data   = NULL;
+        float *src      = alloc_aligned<float>(data, alloc, 64);
+        float *out      = &src[MAX_INPUTS * half];
+        float *conv     = &out[MAX_OUTPUTS * half * 2];
+        float *tmp      = &conv[paths * items];
+
+        for (size_t i=0; i < alloc; ++i)
+            src[i]          = randf(-1.0f, 1.0f);
+
+        const float *vc[MAX_INPUTS * MAX_OUTPUTS];
+        const float *vs[MAX_INPUTS];
+        float *vd[MAX_OUTPUTS];
+
+        for (size_t rank=MIN_RANK; rank<=MAX_RANK; rank += 2)
+        {
+            size_t n        = 1 << (rank - 1);
+            size_t k        = 1 << (rank + 1);
+
+            for (size_t i=0; i<paths; ++i)
+            {
+                vc[i]           = &conv[i * k];
+                dsp::fastconv_parse(&conv[i * k], &src[(i % MAX_INPUTS) * n], rank);
+            }
+            for (size_t i=0; i<MAX_INPUTS; ++i)
+                vs[i]           = &src[i * n];
+            for (size_t i=0; i<MAX_OUTPUTS; ++i)
+                vd[i]           = &out[i * n * 2];
+
+            call_paths(vd, tmp, vc, vs, rank, 2, 2);
+            call_matrix(vd, tmp, vc, vs, rank, 2, 2);
+            PTEST_SEPARATOR;
+
+            call_paths(vd, tmp, vc, vs, rank, MAX_INPUTS, MAX_OUTPUTS);
+            call_matrix(vd, tmp, vc, vs, rank, MAX_INPUTS, MAX_OUTPUTS);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        8
+#define MAX_RANK        14
+
+namespace lsp
+{
+    namespace generic
+    {
+        void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+        }
+
+        namespace avx
+        {
+            void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+        }
+    )
+
+    typedef void (* xcorr_accumulate_t)(float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for cross-spectrum accumulation
+PTEST_BEGIN("dsp.fft", xcorr, 5, 5000)
+
+    void call(const char *label, float *acc, const float *a, const float *b, size_t weight,
+            size_t count, xcorr_accumulate_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s %s x%d", label, (weight == dsp::XCORR_PHAT) ? "phat" : "plain", int(count));
+        printf("Testing %s bins...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(acc, a, b, 0.1f, weight, count);
+        );
+    }
+
+    // Unfused chain of existing functions: complex multiplication and smoothing of the cross-spectrum
+    void call_chain(float *acc, float *tmp, float *a, const float *b, size_t count)
+    {
+        char buf[80];
+        sprintf(buf, "pcomplex chain plain x%d", int(count));
+        printf("Testing %s bins...\n", buf);
+
+        PTEST_LOOP(buf,
+            dsp::pcomplex_mul3(tmp, a, b, count);
+            dsp::mix2(acc, tmp, 0.9f, 0.1f, count*2);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *a        = alloc_aligned<float>(data, buf_size * 8, 64);
+        float *b        = &a[buf_size*2];
+        float *acc      = &b[buf_size*2];
+        float *tmp      = &acc[buf_size*2];
+
+        for (size_t i=0; i < buf_size*8; ++i)
+            a[i]            = randf(-1.0f, 1.0f);
+
+        #define CALL(func, weight) \
+            call(#func, acc, a, b, weight, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            size_t count = 1 << i;
+
+            call_chain(acc, tmp, a, b, count);
+            for (size_t weight=dsp::XCORR_PLAIN; weight <= dsp::XCORR_PHAT; ++weight)
+            {
+                CALL(generic::xcorr_accumulate, weight);
+                IF_ARCH_X86(CALL(sse::xcorr_accumulate, weight));
+                IF_ARCH_X86(CALL(avx::xcorr_accumulate, weight));
+                IF_ARCH_AARCH64(CALL(asimd::xcorr_accumulate, weight));
+                PTEST_SEPARATOR;
+            }
+
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 6
+#define MAX_RANK 12
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_design(float *dst, const dsp::fir_params_t *p, size_t count);
+        void fir_design_fastconv(float *dst, const dsp::fir_params_t *p, size_t count, size_t rank);
+    }
+
+    // Straightforward windowed-sinc design that computes harmonic functions for each tap
+    static void fir_design_naive(float *dst, const dsp::fir_params_t *p, size_t count)
+    {
+        double c        = (count - 1) * 0.5;
+        double sum      = 0.0;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            double x        = i - c;
+            double h        = (x == 0.0) ? 2.0 * p->f1 : sin(2.0 * M_PI * p->f1 * x) / (M_PI * x);
+            double t        = 2.0 * M_PI * i / (count - 1);
+            h              *= 0.42 - 0.5 * cos(t) + 0.08 * cos(2.0 * t);
+            dst[i]          = h;
+            sum            += h;
+        }
+
+        for (size_t i=0; i<count; ++i)
+            dst[i]         /= sum;
+    }
+
+    typedef void (* fir_design_t)(float *dst, const dsp::fir_params_t *p, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for FIR filter design
+PTEST_BEGIN("dsp.filters", fir, 5, 1000)
+
+    void call(const char *label, float *dst, const dsp::fir_params_t *p, size_t count, fir_design_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s taps...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, p, count);
+        );
+    }
+
+    void call_fastconv(const char *label, float *dst, const dsp::fir_params_t *p, size_t rank)
+    {
+        size_t count = 1 << (rank - 1);
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s taps...\n", buf);
+
+        PTEST_LOOP(buf,
+            generic::fir_design_fastconv(dst, p, count, rank);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *dst      = alloc_aligned<float>(data, buf_size * 4, 64);
+
+        dsp::fir_params_t p;
+        p.type          = dsp::FIR_LOWPASS;
+        p.f1            = 0.1f;
+        p.f2            = 0.2f;
+        p.transition    = 0.05f;
+
+        #define CALL(func, type, count) \
+            p.method = type; \
+            call(#func " " #type, dst, &p, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            const size_t count = 1 << i;
+
+            CALL(fir_design_naive, dsp::FIR_BLACKMAN, count);
+            CALL(generic::fir_design, dsp::FIR_BLACKMAN, count);
+            CALL(generic::fir_design, dsp::FIR_LSQ, count);
+            PTEST_SEPARATOR;
+
+            p.method = dsp::FIR_LSQ;
+            call_fastconv("generic::fir_design_fastconv dsp::FIR_LSQ", dst, &p, i + 1);
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 6
+#define MAX_RANK 14
+
+namespace lsp
+{
+    namespace generic
+    {
+        void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count);
+        void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count);
+        void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count);
+        void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count);
+            void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count);
+            void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count);
+            void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count);
+        }
+
+        namespace avx2
+        {
+            void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count);
+            void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count);
+            void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count);
+            void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count);
+            void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count);
+            void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count);
+            void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count);
+        }
+    )
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for fused effect rendering
+PTEST_BEGIN("dsp.graphics", effects_bgra32, 5, 5000)
+
+    template <class eff_t>
+        void call(const char *label, void *dst, const float *src, size_t count,
+                const eff_t *eff,
+                void (* func)(void *dst, const float *v, const eff_t *eff, size_t count)
+            )
+        {
+            if (!PTEST_SUPPORTED(func))
+                return;
+
+            char buf[80];
+            sprintf(buf, "%s x %d", label, int(count));
+            printf("Testing %s pixels...\n", buf);
+
+            PTEST_LOOP(buf,
+                func(dst, src, eff, count);
+            );
+        }
+
+    // Equivalent chain of non-fused functions: effect, color conversion, pixel format conversion
+    template <class eff_t>
+        void call_chain(const char *label, void *dst, const float *src, float *hsla, size_t count,
+                const eff_t *eff,
+                void (* func)(float *dst, const float *v, const eff_t *eff, size_t count)
+            )
+        {
+            char buf[80];
+            sprintf(buf, "%s x %d", label, int(count));
+            printf("Testing %s pixels...\n", buf);
+
+            PTEST_LOOP(buf,
+                func(hsla, src, eff, count);
+                dsp::hsla_to_rgba(hsla, hsla, count);
+                dsp::rgba_to_bgra32(dst, hsla, count);
+            );
+        }
+
+    PTEST_MAIN
+    {
+        size_t buf_size     = 1 << MAX_RANK;
+        uint8_t *data       = NULL;
+        float *src          = alloc_aligned<float>(data, buf_size * 6, 64);
+        float *dst          = &src[buf_size];
+        float *hsla         = &dst[buf_size];
+
+        for (size_t i=0; i<buf_size; ++i)
+            src[i]              = randf(-1.0f, 1.0f);
+
+        dsp::hsla_hue_eff_t hue;
+        hue.h       = 0.0f;
+        hue.s       = 1.0f;
+        hue.l       = 0.5f;
+        hue.a       = 0.0f;
+        hue.thresh  = 0.33333333333f;
+
+        dsp::hsla_alpha_eff_t alpha;
+        alpha.h     = 0.5f;
+        alpha.s     = 1.0f;
+        alpha.l     = 0.5f;
+        alpha.a     = 0.0f;
+
+        dsp::hsla_sat_eff_t sat;
+        sat.h       = 0.0f;
+        sat.s       = 1.0f;
+        sat.l       = 0.5f;
+        sat.a       = 0.0f;
+        sat.thresh  = 0.25f;
+
+        dsp::hsla_light_eff_t light;
+        light.h     = 0.0f;
+        light.s     = 1.0f;
+        light.l     = 0.5f;
+        light.a     = 0.0f;
+        light.thresh= 0.25f;
+
+        #define CALL(eff, params) \
+            call_chain("unfused eff_hsla_" #eff, dst, src, hsla, count, &params, dsp::eff_hsla_##eff); \
+            call("generic::eff_hsla_" #eff "_bgra32", dst, src, count, &params, generic::eff_hsla_##eff##_bgra32); \
+            IF_ARCH_X86(call("sse2::eff_hsla_" #eff "_bgra32", dst, src, count, &params, sse2::eff_hsla_##eff##_bgra32)); \
+            IF_ARCH_X86(call("avx2::eff_hsla_" #eff "_bgra32", dst, src, count, &params, avx2::eff_hsla_##eff##_bgra32)); \
+            IF_ARCH_AARCH64(call("asimd::eff_hsla_" #eff "_bgra32", dst, src, count, &params, asimd::eff_hsla_##eff##_bgra32)); \
+            PTEST_SEPARATOR;
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            size_t count = 1 << i;
+
+            CALL(hue, hue);
+            CALL(sat, sat);
+            CALL(light, light);
+            CALL(alpha, alpha);
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
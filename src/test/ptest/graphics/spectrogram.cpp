@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 6
+#define MAX_RANK 14
+
+namespace lsp
+{
+    namespace generic
+    {
+        void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+        }
+
+        namespace avx2
+        {
+            void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+        }
+    )
+
+    typedef void (* spectrogram_bgra32_t)(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for spectrogram rasterization
+PTEST_BEGIN("dsp.graphics", spectrogram, 5, 5000)
+
+    void call(const char *label, void *dst, const float *src, const void *lut, size_t count, spectrogram_bgra32_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s pixels...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, src, lut, -120.0f, 0.0f, count);
+        );
+    }
+
+    // Equivalent chain of non-fused functions: dB conversion, lightness effect, color conversion
+    void call_chain(void *dst, const float *src, float *tmp, float *hsla, size_t count)
+    {
+        char buf[80];
+        sprintf(buf, "unfused chain x %d", int(count));
+        printf("Testing %s pixels...\n", buf);
+
+        dsp::hsla_light_eff_t eff;
+        eff.h       = 0.0f;
+        eff.s       = 1.0f;
+        eff.l       = 0.5f;
+        eff.a       = 0.0f;
+        eff.thresh  = 0.25f;
+
+        PTEST_LOOP(buf,
+            dsp::logd2(tmp, src, count);
+            dsp::mul_k2(tmp, 20.0f / 120.0f, count);
+            dsp::add_k2(tmp, 1.0f, count);
+            dsp::eff_hsla_light(hsla, tmp, &eff, count);
+            dsp::hsla_to_rgba(hsla, hsla, count);
+            dsp::rgba_to_bgra32(dst, hsla, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size     = 1 << MAX_RANK;
+        uint8_t *data       = NULL;
+
+        uint8_t *dst        = alloc_aligned<uint8_t>(data, buf_size * sizeof(float) * 7 + 256 * sizeof(uint32_t), 64);
+        float *src          = reinterpret_cast<float *>(&dst[buf_size * sizeof(uint32_t)]);
+        float *tmp          = &src[buf_size];
+        float *hsla         = &tmp[buf_size];
+        void *lut           = &hsla[buf_size * 4];
+
+        for (size_t i=0; i<buf_size; ++i)
+            src[i]              = expf(randf(-7.0f, 0.0f) * M_LN10);
+
+        // Build colormap
+        dsp::fill_hsla(hsla, 0.0f, 1.0f, 0.5f, 0.0f, 256);
+        for (size_t i=0; i<256; ++i)
+            hsla[i*4]           = i / 256.0f;
+        dsp::hsla_to_rgba(hsla, hsla, 256);
+        dsp::rgba_to_bgra32(lut, hsla, 256);
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            size_t count = 1 << i;
+
+            call_chain(dst, src, tmp, hsla, count);
+            call("generic::spectrogram_bgra32", dst, src, lut, count, generic::spectrogram_bgra32);
+            IF_ARCH_X86(call("sse2::spectrogram_bgra32", dst, src, lut, count, sse2::spectrogram_bgra32));
+            IF_ARCH_X86(call("avx2::spectrogram_bgra32", dst, src, lut, count, avx2::spectrogram_bgra32));
+            IF_ARCH_AARCH64(call("asimd::spectrogram_bgra32", dst, src, lut, count, asimd::spectrogram_bgra32));
+
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
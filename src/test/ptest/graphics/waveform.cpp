@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        16
+#define MAX_RANK        22
+#define COLUMNS         1920
+#define SHIFT           6
+
+namespace lsp
+{
+    namespace test
+    {
+        static void waveform_minmax(float *min, float *max, const float *src, size_t samples, size_t count)
+        {
+            float step  = float(samples) / count;
+            for (size_t c=0; c<count; ++c)
+            {
+                size_t s0   = size_t(double(c) * step);
+                size_t s1   = size_t(double(c + 1) * step);
+                dsp::minmax(&src[s0], s1 - s0, &min[c], &max[c]);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for waveform mipmap
+PTEST_BEGIN("dsp.graphics", waveform, 5, 1000)
+
+    PTEST_MAIN
+    {
+        size_t samples  = 1 << MAX_RANK;
+        dsp::waveform_mipmap_t m;
+        size_t entries  = dsp::waveform_mipmap_init(&m, samples, SHIFT);
+
+        uint8_t *data   = NULL;
+        float *src      = alloc_aligned<float>(data, samples + COLUMNS * 3 + entries * 3, 64);
+        float *vmin     = &src[samples];
+        float *vmax     = &vmin[COLUMNS];
+        float *vrms     = &vmax[COLUMNS];
+        dsp::waveform_peak_t *peaks = reinterpret_cast<dsp::waveform_peak_t *>(&vrms[COLUMNS]);
+
+        for (size_t i=0; i < samples; ++i)
+            src[i]          = randf(-1.0f, 1.0f);
+
+        char buf[80];
+        for (size_t i=MIN_RANK; i<=MAX_RANK; i += 2)
+        {
+            size_t count    = 1 << i;
+
+            sprintf(buf, "waveform_mipmap_append x %d", int(count));
+            printf("Testing %s samples...\n", buf);
+            PTEST_LOOP(buf,
+                dsp::waveform_mipmap_init(&m, samples, SHIFT);
+                dsp::waveform_mipmap_append(&m, peaks, src, count);
+            );
+
+            sprintf(buf, "minmax %d x %d", int(COLUMNS), int(count));
+            printf("Testing %s samples...\n", buf);
+            PTEST_LOOP(buf,
+                test::waveform_minmax(vmin, vmax, src, count, COLUMNS);
+            );
+
+            sprintf(buf, "waveform_mipmap_query %d x %d", int(COLUMNS), int(count));
+            printf("Testing %s samples...\n", buf);
+            PTEST_LOOP(buf,
+                dsp::waveform_mipmap_query(vmin, vmax, vrms, &m, peaks, src, 0, float(count) / COLUMNS, COLUMNS);
+            );
+
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 20
+
+namespace lsp
+{
+    namespace generic
+    {
+        float h_sum(const float *src, size_t count);
+        float h_csum(const float *src, size_t count);
+        float h_dotp(const float *a, const float *b, size_t count);
+        float h_cdotp(const float *a, const float *b, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            float h_sum(const float *src, size_t count);
+            float h_csum(const float *src, size_t count);
+            float h_dotp(const float *a, const float *b, size_t count);
+            float h_cdotp(const float *a, const float *b, size_t count);
+        }
+
+        namespace avx
+        {
+            float h_sum(const float *src, size_t count);
+            float h_csum(const float *src, size_t count);
+            float h_dotp(const float *a, const float *b, size_t count);
+            float h_cdotp(const float *a, const float *b, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            float h_sum(const float *src, size_t count);
+            float h_csum(const float *src, size_t count);
+            float h_dotp(const float *a, const float *b, size_t count);
+            float h_cdotp(const float *a, const float *b, size_t count);
+        }
+    )
+
+    typedef float (* h_sum_t)(const float *src, size_t count);
+    typedef float (* h_dotp_t)(const float *a, const float *b, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test: plain vs. compensated reductions
+PTEST_BEGIN("dsp.hmath", hcsum, 5, 1000)
+
+    void call(const char *label, float *a, size_t count, h_sum_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(a, count);
+        );
+    }
+
+    void call(const char *label, float *a, float *b, size_t count, h_dotp_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(a, b, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *a        = alloc_aligned<float>(data, buf_size * 2, 64);
+        float *b        = &a[buf_size];
+
+        for (size_t i=0; i < buf_size*2; ++i)
+            a[i]            = randf(0.0f, 1.0f);
+
+        #define CALL1(func) \
+            call(#func, a, count, func)
+        #define CALL2(func) \
+            call(#func, a, b, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 4)
+        {
+            size_t count = 1 << i;
+
+            CALL1(generic::h_sum);
+            CALL1(generic::h_csum);
+            IF_ARCH_X86(CALL1(sse::h_sum));
+            IF_ARCH_X86(CALL1(sse::h_csum));
+            IF_ARCH_X86(CALL1(avx::h_sum));
+            IF_ARCH_X86(CALL1(avx::h_csum));
+            IF_ARCH_AARCH64(CALL1(asimd::h_sum));
+            IF_ARCH_AARCH64(CALL1(asimd::h_csum));
+            PTEST_SEPARATOR;
+
+            CALL2(generic::h_dotp);
+            CALL2(generic::h_cdotp);
+            IF_ARCH_X86(CALL2(sse::h_dotp));
+            IF_ARCH_X86(CALL2(sse::h_cdotp));
+            IF_ARCH_X86(CALL2(avx::h_dotp));
+            IF_ARCH_X86(CALL2(avx::h_cdotp));
+            IF_ARCH_AARCH64(CALL2(asimd::h_dotp));
+            IF_ARCH_AARCH64(CALL2(asimd::h_cdotp));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
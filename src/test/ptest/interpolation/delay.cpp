@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define RING_RANK       16
+#define MIN_RANK        8
+#define MAX_RANK        12
+#define NUM_TAPS        8
+
+namespace lsp
+{
+    namespace generic
+    {
+        void delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+        void delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+        void delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+        void delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace sse2
+        {
+            void x64_delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count);
+        }
+
+        namespace avx2
+        {
+            void x64_delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void x64_delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void x64_delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void x64_delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count);
+        }
+    )
+
+    typedef void (* delay_read_t)(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+    typedef void (* delay_taps_t)(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count);
+}
+
+PTEST_BEGIN("dsp.interpolation", delay, 5, 5000)
+
+    void call(const char *label, float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count, delay_read_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char name[80];
+        sprintf(name, "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", name);
+
+        PTEST_LOOP(name,
+            func(dst, buf, d, delay, count);
+        );
+    }
+
+    void call(const char *label, float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t count, delay_taps_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char name[80];
+        sprintf(name, "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", name);
+
+        PTEST_LOOP(name,
+            func(dst, buf, d, taps, NUM_TAPS, count);
+        );
+    }
+
+    // Separate read of each tap with the constant delay, for comparison with fused delay_read_taps()
+    void call_chain(const char *label, float *dst, const float *buf, const dsp::delay_t *d, float *delay, float *tmp,
+            const dsp::delay_tap_t *taps, size_t count)
+    {
+        char name[80];
+        sprintf(name, "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", name);
+
+        PTEST_LOOP(name,
+            dsp::fill_zero(dst, count);
+            for (size_t k=0; k<NUM_TAPS; ++k)
+            {
+                dsp::fill(delay, taps[k].delay, count);
+                dsp::delay_read_hermite(tmp, buf, d, delay, count);
+                dsp::fmadd_k3(dst, tmp, taps[k].gain, count);
+            }
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t ring     = 1 << RING_RANK;
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *buf      = alloc_aligned<float>(data, ring + LSP_DSP_DELAY_GUARD + buf_size * 3, 64);
+        float *dst      = &buf[ring + LSP_DSP_DELAY_GUARD];
+        float *delay    = &dst[buf_size];
+        float *tmp      = &delay[buf_size];
+
+        dsp::delay_t d;
+        dsp::delay_init(buf, &d, RING_RANK);
+        randomize_sign(dst, buf_size);
+        for (size_t i=0; i < ring + buf_size; i += buf_size)
+            dsp::delay_write(buf, &d, dst, buf_size);
+
+        dsp::delay_tap_t taps[NUM_TAPS];
+        for (size_t i=0; i<NUM_TAPS; ++i)
+        {
+            taps[i].delay   = 2.0f + (float(rand()) / RAND_MAX) * (ring - buf_size - 4);
+            taps[i].gain    = (float(rand()) / RAND_MAX) * 2.0f - 1.0f;
+            taps[i].interp  = dsp::DELAY_HERMITE;
+        }
+
+        #define CALL(func, ...) \
+            call(#func, dst, buf, &d, __VA_ARGS__, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            size_t count = 1 << i;
+            for (size_t j=0; j<count; ++j)
+                delay[j]        = 2.0f + (float(rand()) / RAND_MAX) * (ring - buf_size - 4);
+
+            CALL(generic::delay_read_linear, delay);
+            IF_ARCH_X86(CALL(sse2::delay_read_linear, delay));
+            IF_ARCH_X86_64(CALL(avx2::x64_delay_read_linear, delay));
+            IF_ARCH_AARCH64(CALL(asimd::delay_read_linear, delay));
+            PTEST_SEPARATOR;
+
+            CALL(generic::delay_read_hermite, delay);
+            IF_ARCH_X86(CALL(sse2::delay_read_hermite, delay));
+            IF_ARCH_X86_64(CALL(avx2::x64_delay_read_hermite, delay));
+            IF_ARCH_AARCH64(CALL(asimd::delay_read_hermite, delay));
+            PTEST_SEPARATOR;
+
+            CALL(generic::delay_read_lagrange, delay);
+            IF_ARCH_X86(CALL(sse2::delay_read_lagrange, delay));
+            IF_ARCH_X86_64(CALL(avx2::x64_delay_read_lagrange, delay));
+            IF_ARCH_AARCH64(CALL(asimd::delay_read_lagrange, delay));
+            PTEST_SEPARATOR;
+
+            call_chain("8 x (delay_read_hermite + fmadd_k3)", dst, buf, &d, delay, tmp, taps, count);
+            CALL(generic::delay_read_taps, taps);
+            IF_ARCH_X86_64(CALL(sse2::x64_delay_read_taps, taps));
+            IF_ARCH_X86_64(CALL(avx2::x64_delay_read_taps, taps));
+            IF_ARCH_AARCH64(CALL(asimd::delay_read_taps, taps));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
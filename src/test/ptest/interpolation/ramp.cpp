@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void ramp_set(float *dst, dsp::ramp_t *r, size_t count);
+        void ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+        void ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void ramp_set(float *dst, dsp::ramp_t *r, size_t count);
+            void ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+            void ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace avx2
+        {
+            void x64_ramp_set(float *dst, dsp::ramp_t *r, size_t count);
+            void x64_ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+            void x64_ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void ramp_set(float *dst, dsp::ramp_t *r, size_t count);
+            void ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+            void ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+        }
+    )
+
+    typedef void (* ramp1_t)(float *dst, dsp::ramp_t *r, size_t count);
+    typedef void (* ramp2_t)(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+}
+
+PTEST_BEGIN("dsp.interpolation", ramp, 5, 5000)
+
+    void init_ramp(dsp::ramp_t *r, size_t shape, size_t count)
+    {
+        r->start        = 0.01f;
+        r->stop         = 1.0f;
+        r->shape        = shape;
+        r->length       = count;
+        r->offset       = 0;
+    }
+
+    void call(const char *label, float *dst, size_t shape, size_t count, ramp1_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        dsp::ramp_t r;
+        PTEST_LOOP(buf,
+            init_ramp(&r, shape, count);
+            func(dst, &r, count);
+        );
+    }
+
+    void call(const char *label, float *dst, const float *src, size_t shape, size_t count, ramp2_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        dsp::ramp_t r;
+        PTEST_LOOP(buf,
+            init_ramp(&r, shape, count);
+            func(dst, src, &r, count);
+        );
+    }
+
+    // Materialized ramp followed by a separate multiplication, for comparison with fused ramp_mul3()
+    void call_chain(const char *label, float *dst, const float *src, float *tmp, size_t shape, size_t count)
+    {
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        dsp::ramp_t r;
+        PTEST_LOOP(buf,
+            init_ramp(&r, shape, count);
+            dsp::ramp_set(tmp, &r, count);
+            dsp::mul3(dst, src, tmp, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *dst      = alloc_aligned<float>(data, buf_size * 3, 64);
+        float *src      = &dst[buf_size];
+        float *tmp      = &src[buf_size];
+
+        randomize_sign(dst, buf_size * 3);
+
+        static const char *shapes[] = { "linear", "cubic", "exp", "log" };
+
+        #define CALL1(func) \
+            call(#func, dst, shape, count, func)
+        #define CALL2(func) \
+            call(#func, dst, src, shape, count, func)
+
+        for (size_t shape=dsp::RAMP_LINEAR; shape<=dsp::RAMP_LOG; ++shape)
+        {
+            printf("Ramp shape: %s\n", shapes[shape]);
+
+            for (size_t i=MIN_RANK; i <= MAX_RANK; i += 4)
+            {
+                size_t count = 1 << i;
+
+                CALL1(generic::ramp_set);
+                IF_ARCH_X86(CALL1(sse2::ramp_set));
+                IF_ARCH_X86_64(CALL1(avx2::x64_ramp_set));
+                IF_ARCH_AARCH64(CALL1(asimd::ramp_set));
+                PTEST_SEPARATOR;
+
+                call_chain("ramp_set + mul3", dst, src, tmp, shape, count);
+                CALL2(generic::ramp_mul3);
+                IF_ARCH_X86(CALL2(sse2::ramp_mul3));
+                IF_ARCH_X86_64(CALL2(avx2::x64_ramp_mul3));
+                IF_ARCH_AARCH64(CALL2(asimd::ramp_mul3));
+                PTEST_SEPARATOR;
+
+                CALL2(generic::ramp_fmadd2);
+                IF_ARCH_X86(CALL2(sse2::ramp_fmadd2));
+                IF_ARCH_X86_64(CALL2(avx2::x64_ramp_fmadd2));
+                IF_ARCH_AARCH64(CALL2(asimd::ramp_fmadd2));
+                PTEST_SEPARATOR2;
+            }
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
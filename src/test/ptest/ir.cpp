@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define LENGTH          (1 << 18)
+#define MIN_TAPS        10
+#define MAX_TAPS        16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void ir_kernel_init(float *kernel);
+        void ir_bin_taps(dsp::ir_tap_t *dst, const dsp::ir_tap_t *src, uint32_t *bins, size_t count, size_t length);
+        void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length);
+        }
+
+        namespace avx
+        {
+            void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length);
+        }
+    )
+
+    typedef void (* ir_render_taps_t)(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for rendering of sparse taps
+PTEST_BEGIN("dsp", ir, 5, 1000)
+
+    void call(const char *label, float *dst, const dsp::ir_tap_t *taps, const float *kernel,
+            size_t count, ir_render_taps_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x%d", label, int(count));
+        printf("Testing %s taps...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, taps, kernel, count, LENGTH);
+        );
+    }
+
+    void bin(const char *label, dsp::ir_tap_t *dst, const dsp::ir_tap_t *src, uint32_t *bins, size_t count)
+    {
+        char buf[80];
+        sprintf(buf, "%s x%d", label, int(count));
+        printf("Testing %s taps...\n", buf);
+
+        PTEST_LOOP(buf,
+            generic::ir_bin_taps(dst, src, bins, count, LENGTH);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t max_taps = 1 << MAX_TAPS;
+        size_t nbins    = (LENGTH >> LSP_DSP_IR_BLOCK_RANK) + 1;
+        uint8_t *data   = NULL;
+        uint8_t *tdata  = NULL;
+        float *dst      = alloc_aligned<float>(data, LENGTH + LSP_DSP_IR_KERNEL_SIZE + nbins, 64);
+        float *kernel   = &dst[LENGTH];
+        uint32_t *bins  = reinterpret_cast<uint32_t *>(&kernel[LSP_DSP_IR_KERNEL_SIZE]);
+        dsp::ir_tap_t *src      = alloc_aligned<dsp::ir_tap_t>(tdata, max_taps * 2, 64);
+        dsp::ir_tap_t *binned   = &src[max_taps];
+
+        generic::ir_kernel_init(kernel);
+        dsp::fill_zero(dst, LENGTH);
+        for (size_t i=0; i < max_taps; ++i)
+        {
+            src[i].position = randf(0.0f, LENGTH);
+            src[i].gain     = randf(-1.0f, 1.0f);
+        }
+
+        #define CALL(func, taps) \
+            call(#func, dst, taps, kernel, count, func)
+
+        for (size_t i=MIN_TAPS; i <= MAX_TAPS; i += 2)
+        {
+            size_t count    = 1 << i;
+
+            // Random order of taps
+            CALL(generic::ir_render_taps, src);
+            IF_ARCH_X86(CALL(sse::ir_render_taps, src));
+            IF_ARCH_X86(CALL(avx::ir_render_taps, src));
+            IF_ARCH_AARCH64(CALL(asimd::ir_render_taps, src));
+            PTEST_SEPARATOR;
+
+            // Taps binned by blocks
+            bin("generic::ir_bin_taps", binned, src, bins, count);
+            CALL(generic::ir_render_taps, binned);
+            IF_ARCH_X86(CALL(sse::ir_render_taps, binned));
+            IF_ARCH_X86(CALL(avx::ir_render_taps, binned));
+            IF_ARCH_AARCH64(CALL(asimd::ir_render_taps, binned));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+        free_aligned(tdata);
+    }
+
+PTEST_END
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 16
+#define CHANNELS LSP_DSP_LOUDNESS_MAX_CHANNELS
+
+namespace lsp
+{
+    namespace generic
+    {
+        void loudness_init(dsp::loudness_t *l, size_t channels, size_t sample_rate);
+        void loudness_accumulate(dsp::loudness_t *l, const float **src, size_t count);
+    }
+
+    IF_ARCH_X86_64(
+        namespace sse3
+        {
+            void x64_loudness_accumulate(dsp::loudness_t *l, const float **src, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void loudness_accumulate(dsp::loudness_t *l, const float **src, size_t count);
+        }
+    )
+
+    typedef void (* loudness_accumulate_t)(dsp::loudness_t *l, const float **src, size_t count);
+}
+
+PTEST_BEGIN("dsp", loudness, 5, 5000)
+
+    void call(const char *label, const float **src, size_t channels, size_t count, loudness_accumulate_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s %dch x %d", label, int(channels), int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        dsp::loudness_t l;
+        generic::loudness_init(&l, channels, 48000);
+
+        PTEST_LOOP(buf,
+            func(&l, src, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *ptr      = alloc_aligned<float>(data, buf_size * CHANNELS, 64);
+
+        const float *src[CHANNELS];
+        for (size_t i=0; i<CHANNELS; ++i)
+            src[i]          = &ptr[buf_size * i];
+
+        randomize_sign(ptr, buf_size * CHANNELS);
+
+        #define CALL(func, channels) \
+            call(#func, src, channels, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            size_t count = 1 << i;
+
+            CALL(generic::loudness_accumulate, 2);
+            IF_ARCH_X86_64(CALL(sse3::x64_loudness_accumulate, 2));
+            IF_ARCH_AARCH64(CALL(asimd::loudness_accumulate, 2));
+            PTEST_SEPARATOR;
+
+            CALL(generic::loudness_accumulate, 8);
+            IF_ARCH_X86_64(CALL(sse3::x64_loudness_accumulate, 8));
+            IF_ARCH_AARCH64(CALL(asimd::loudness_accumulate, 8));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        8
+#define MAX_RANK        16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void noise_init(dsp::noise_t *n, uint32_t seed);
+        void noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count);
+        void noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count);
+        void noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count);
+        void noise_pink(float *dst, dsp::noise_t *n, float k, size_t count);
+    }
+
+    IF_ARCH_X86_64(
+        namespace sse2
+        {
+            void x64_noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count);
+            void x64_noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count);
+            void x64_noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count);
+        }
+
+        namespace avx2
+        {
+            void x64_noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count);
+            void x64_noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count);
+            void x64_noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count);
+            void noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count);
+            void noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count);
+        }
+    )
+
+    typedef void (* noise_func_t)(float *dst, dsp::noise_t *n, float k, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for noise generators
+PTEST_BEGIN("dsp", noise, 5, 5000)
+
+    void call(const char *label, float *dst, dsp::noise_t *n, size_t count, noise_func_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char name[80];
+        sprintf(name, "%s x%d", label, int(count));
+        printf("Testing %s numbers...\n", name);
+
+        PTEST_LOOP(name,
+            func(dst, n, 1.0f, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *dst      = alloc_aligned<float>(data, buf_size, 64);
+        dsp::noise_t n;
+
+        generic::noise_init(&n, 1);
+
+        #define CALL(func) \
+            call(#func, dst, &n, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            size_t count = 1 << i;
+
+            CALL(generic::noise_uniform);
+            IF_ARCH_X86_64(CALL(sse2::x64_noise_uniform));
+            IF_ARCH_X86_64(CALL(avx2::x64_noise_uniform));
+            IF_ARCH_AARCH64(CALL(asimd::noise_uniform));
+            PTEST_SEPARATOR;
+
+            CALL(generic::noise_tpdf);
+            IF_ARCH_X86_64(CALL(sse2::x64_noise_tpdf));
+            IF_ARCH_X86_64(CALL(avx2::x64_noise_tpdf));
+            IF_ARCH_AARCH64(CALL(asimd::noise_tpdf));
+            PTEST_SEPARATOR;
+
+            CALL(generic::noise_gaussian);
+            IF_ARCH_X86_64(CALL(sse2::x64_noise_gaussian));
+            IF_ARCH_X86_64(CALL(avx2::x64_noise_gaussian));
+            IF_ARCH_AARCH64(CALL(asimd::noise_gaussian));
+            PTEST_SEPARATOR;
+
+            CALL(generic::noise_pink);
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        16
+#define MAX_RANK        22
+#define CONV_RANK       10
+
+namespace lsp
+{
+    namespace test
+    {
+        static void fastconv_convolve(float *dst, const float *c, const float *src, size_t rank, size_t count)
+        {
+            size_t half     = 1 << (rank - 1);
+            float *tmp      = &dst[count + half];
+
+            dsp::fill_zero(dst, count + half);
+            for (size_t off=0; off < count; off += half)
+                dsp::fastconv_parse_apply(&dst[off], tmp, c, &src[off], rank);
+        }
+    }
+
+    typedef void (* mul3_t)(float *dst, const float *src1, const float *src2, size_t count);
+    typedef void (* fastconv_convolve_t)(float *dst, const float *c, const float *src, size_t rank, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for multi-threaded processing
+PTEST_BEGIN("dsp", parallel, 10, 100)
+
+    void call(const char *label, float *dst, const float *src1, const float *src2, size_t count, mul3_t func)
+    {
+        char buf[80];
+        sprintf(buf, "%s x%d %d", label, int(dsp::get_threads()), int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, src1, src2, count);
+        );
+    }
+
+    void call(const char *label, float *dst, const float *c, const float *src, size_t count, fastconv_convolve_t func)
+    {
+        char buf[80];
+        sprintf(buf, "%s x%d %d", label, int(dsp::get_threads()), int(count));
+        printf("Testing %s samples...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, c, src, CONV_RANK, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        size_t conv_len = 1 << (CONV_RANK + 1);
+        uint8_t *data   = NULL;
+        float *dst      = alloc_aligned<float>(data, buf_size * 3 + conv_len * 3, 64);
+        float *src1     = &dst[buf_size + conv_len * 2];
+        float *src2     = &src1[buf_size];
+        float *c        = &src2[buf_size];
+
+        for (size_t i=0; i < buf_size*3 + conv_len*3; ++i)
+            dst[i]          = randf(-1.0f, 1.0f);
+        dsp::fastconv_parse(c, src2, CONV_RANK);
+
+        size_t cpus     = dsp::set_threads(0);
+
+        for (size_t i=MIN_RANK; i<=MAX_RANK; i += 2)
+        {
+            dsp::set_threads(1);
+            call("mul3", dst, src1, src2, 1 << i, dsp::mul3);
+            for (size_t t=1; t <= cpus; t <<= 1)
+            {
+                dsp::set_threads(t);
+                call("mul3_mt", dst, src1, src2, 1 << i, dsp::mul3_mt);
+            }
+            PTEST_SEPARATOR;
+        }
+
+        for (size_t i=MIN_RANK; i<=MAX_RANK; i += 2)
+        {
+            dsp::set_threads(1);
+            call("fastconv_convolve", dst, c, src1, 1 << i, test::fastconv_convolve);
+            for (size_t t=1; t <= cpus; t <<= 1)
+            {
+                dsp::set_threads(t);
+                call("fastconv_convolve_mt", dst, c, src1, 1 << i, dsp::fastconv_convolve_mt);
+            }
+            PTEST_SEPARATOR;
+        }
+
+        dsp::set_threads(1);
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 12
+
+namespace lsp
+{
+    namespace generic
+    {
+        void halfband_init(dsp::halfband_t *f, float transition);
+        void halfband_upsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+        void halfband_downsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+        void halfband_upsample_4x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+        void halfband_upsample_8x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+        void halfband_downsample_4x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+        void halfband_downsample_8x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void halfband_upsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+            void halfband_downsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void halfband_upsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+            void halfband_downsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+        }
+    )
+
+    typedef void (* halfband_process_t)(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for halfband IIR oversampling
+PTEST_BEGIN("dsp.resampling", halfband, 5, 1000)
+
+    void call(const char *label, float *dst, const float *src, size_t count, dsp::halfband_t *f, halfband_process_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s samples...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, src, count, f);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        uint8_t *fdata  = NULL;
+        float *src      = alloc_aligned<float>(data, buf_size * 9, 64);
+        float *dst      = &src[buf_size];
+        dsp::halfband_t *f  = alloc_aligned<dsp::halfband_t>(fdata, LSP_DSP_HALFBAND_STAGES, LSP_DSP_HALFBAND_ALIGN);
+
+        for (size_t i=0; i < buf_size; ++i)
+            src[i]          = randf(-1.0f, 1.0f);
+        for (size_t i=0; i < LSP_DSP_HALFBAND_STAGES; ++i)
+            generic::halfband_init(&f[i], 0.05f);
+
+        #define CALL(func, count) \
+            call(#func, dst, src, count, f, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            const size_t count = 1 << i;
+
+            CALL(generic::halfband_upsample_2x, count);
+            IF_ARCH_X86(CALL(sse::halfband_upsample_2x, count));
+            IF_ARCH_AARCH64(CALL(asimd::halfband_upsample_2x, count));
+            PTEST_SEPARATOR;
+
+            CALL(generic::halfband_downsample_2x, count >> 1);
+            IF_ARCH_X86(CALL(sse::halfband_downsample_2x, count >> 1));
+            IF_ARCH_AARCH64(CALL(asimd::halfband_downsample_2x, count >> 1));
+            PTEST_SEPARATOR;
+
+            CALL(generic::halfband_upsample_4x, count);
+            CALL(generic::halfband_upsample_8x, count);
+            CALL(generic::halfband_downsample_4x, count >> 2);
+            CALL(generic::halfband_downsample_8x, count >> 3);
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+        free_aligned(fdata);
+    }
+
+PTEST_END
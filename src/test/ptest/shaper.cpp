@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        8
+#define MAX_RANK        16
+#define CURVE_SIZE      1024
+
+namespace lsp
+{
+    namespace generic
+    {
+        void shaper_init(float *buf, dsp::shaper_t *s, const float *curve, size_t size, float xmin, float xmax);
+        void shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+        void shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+            void shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace avx2
+        {
+            void x64_shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+            void x64_shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+            void shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+        }
+    )
+
+    typedef void (* shaper_func_t)(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for table-driven waveshaper
+PTEST_BEGIN("dsp", shaper, 5, 5000)
+
+    void call(const char *label, float *dst, const float *src, const float *buf, const dsp::shaper_t *s,
+            size_t count, shaper_func_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char name[80];
+        sprintf(name, "%s x%d", label, int(count));
+        printf("Testing %s numbers...\n", name);
+
+        PTEST_LOOP(name,
+            func(dst, src, buf, s, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *src      = alloc_aligned<float>(data, buf_size * 2 + CURVE_SIZE * 2 + LSP_DSP_SHAPER_GUARD, 64);
+        float *dst      = &src[buf_size];
+        float *curve    = &dst[buf_size];
+        float *table    = &curve[CURVE_SIZE];
+        dsp::shaper_t s;
+
+        for (size_t i=0; i<CURVE_SIZE; ++i)
+            curve[i]        = tanhf(-3.0f + 6.0f * i / (CURVE_SIZE - 1));
+        generic::shaper_init(table, &s, curve, CURVE_SIZE, -3.0f, 3.0f);
+        for (size_t i=0; i < buf_size; ++i)
+            src[i]          = randf(-4.0f, 4.0f);
+
+        #define CALL(func) \
+            call(#func, dst, src, table, &s, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            size_t count = 1 << i;
+
+            CALL(generic::shaper_linear);
+            IF_ARCH_X86(CALL(sse2::shaper_linear));
+            IF_ARCH_X86_64(CALL(avx2::x64_shaper_linear));
+            IF_ARCH_AARCH64(CALL(asimd::shaper_linear));
+            PTEST_SEPARATOR;
+
+            CALL(generic::shaper_cubic);
+            IF_ARCH_X86(CALL(sse2::shaper_cubic));
+            IF_ARCH_X86_64(CALL(avx2::x64_shaper_cubic));
+            IF_ARCH_AARCH64(CALL(asimd::shaper_cubic));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,703 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+// Working set sweep: 4 KiB .. 64 MiB, step x4, spans L1, L2, L3 and DRAM
+#define MIN_WSET        (1 << 12)
+#define MAX_WSET        (1 << 26)
+#define WSET_STEP       2
+
+// Twiddle factor tables limit the packed FFT to rank 16
+#define FFT_MIN_RANK    8
+#define FFT_MAX_RANK    16
+
+// Loop iterations of the register-resident peak kernels per call
+#define PEAK_ITERATIONS 0x4000
+
+namespace lsp
+{
+    namespace generic
+    {
+        void copy(float *dst, const float *src, size_t count);
+        void mix_add4(float *dst, const float *src1, const float *src2, const float *src3, const float *src4, float k1, float k2, float k3, float k4, size_t count);
+        void fmadd4(float *dst, const float *a, const float *b, const float *c, size_t count);
+        void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void packed_direct_fft(float *dst, const float *src, size_t rank);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void copy(float *dst, const float *src, size_t count);
+            void mix_add4(float *dst, const float *src1, const float *src2, const float *src3, const float *src4, float k1, float k2, float k3, float k4, size_t count);
+            void fmadd4(float *dst, const float *a, const float *b, const float *c, size_t count);
+            void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+        }
+
+        namespace sse3
+        {
+            void x64_biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        }
+
+        namespace avx
+        {
+            void copy(float *dst, const float *src, size_t count);
+            void mix_add4(float *dst, const float *src1, const float *src2, const float *src3, const float *src4, float k1, float k2, float k3, float k4, size_t count);
+            void fmadd4(float *dst, const float *a, const float *b, const float *c, size_t count);
+            void fmadd4_fma3(float *dst, const float *a, const float *b, const float *c, size_t count);
+            void x64_biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_x8_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void packed_direct_fft_fma3(float *dst, const float *src, size_t rank);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void copy(float *dst, const float *src, size_t count);
+            void mix_add4(float *dst, const float *src1, const float *src2, const float *src3, const float *src4, float k1, float k2, float k3, float k4, size_t count);
+            void fmadd4(float *dst, const float *a, const float *b, const float *c, size_t count);
+            void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void copy(float *dst, const float *src, size_t count);
+            void mix_add4(float *dst, const float *src1, const float *src2, const float *src3, const float *src4, float k1, float k2, float k3, float k4, size_t count);
+            void fmadd4(float *dst, const float *a, const float *b, const float *c, size_t count);
+            void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+        }
+    )
+
+    typedef void (* copy_t)(float *dst, const float *src, size_t count);
+    typedef void (* mix_add4_t)(float *dst, const float *src1, const float *src2, const float *src3, const float *src4, float k1, float k2, float k3, float k4, size_t count);
+    typedef void (* fmadd4_t)(float *dst, const float *a, const float *b, const float *c, size_t count);
+    typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+    typedef void (* packed_direct_fft_t)(float *dst, const float *src, size_t rank);
+    typedef void (* peak_t)(float *state, size_t count);
+
+    // Register-resident arithmetic kernels that measure the machine peak: independent
+    // multiply-add chains kept in registers, no memory traffic inside the loop. The generic
+    // and x86 kernels compute acc = acc * k + c. NEON and ASIMD multiply-accumulate only
+    // into the destination, so their chains alternate acc = acc + k * c and acc = acc - k * c.
+    // The state holds 8 lanes of acc, k and c followed by a sink where every chain is stored.
+    namespace peak
+    {
+        void generic(float *state, size_t count)
+        {
+            float k = state[8], c = state[16];
+            float a0 = state[0], a1 = state[1], a2 = state[2], a3 = state[3];
+            float a4 = state[4], a5 = state[5], a6 = state[6], a7 = state[7];
+
+            for (size_t i=0; i<count; ++i)
+            {
+                a0      = a0 * k + c;
+                a1      = a1 * k + c;
+                a2      = a2 * k + c;
+                a3      = a3 * k + c;
+                a4      = a4 * k + c;
+                a5      = a5 * k + c;
+                a6      = a6 * k + c;
+                a7      = a7 * k + c;
+            }
+
+            state[24]   = a0;
+            state[25]   = a1;
+            state[26]   = a2;
+            state[27]   = a3;
+            state[28]   = a4;
+            state[29]   = a5;
+            state[30]   = a6;
+            state[31]   = a7;
+        }
+
+        IF_ARCH_X86(
+            void sse(float *state, size_t count)
+            {
+                ARCH_X86_ASM
+                (
+                    __ASM_EMIT("movaps      0x20(%[state]), %%xmm6")            /* xmm6 = k */
+                    __ASM_EMIT("movaps      0x40(%[state]), %%xmm7")            /* xmm7 = c */
+                    __ASM_EMIT("movaps      0x00(%[state]), %%xmm0")            /* xmm0 = acc */
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm2")
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm3")
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm5")
+                    __ASM_EMIT64("movaps    %%xmm0, %%xmm8")
+                    __ASM_EMIT64("movaps    %%xmm0, %%xmm9")
+                    __ASM_EMIT64("movaps    %%xmm0, %%xmm10")
+                    __ASM_EMIT64("movaps    %%xmm0, %%xmm11")
+                    __ASM_EMIT64("movaps    %%xmm0, %%xmm12")
+                    __ASM_EMIT64("movaps    %%xmm0, %%xmm13")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("mulps       %%xmm6, %%xmm0")
+                    __ASM_EMIT("mulps       %%xmm6, %%xmm1")
+                    __ASM_EMIT("mulps       %%xmm6, %%xmm2")
+                    __ASM_EMIT("mulps       %%xmm6, %%xmm3")
+                    __ASM_EMIT("mulps       %%xmm6, %%xmm4")
+                    __ASM_EMIT("mulps       %%xmm6, %%xmm5")
+                    __ASM_EMIT64("mulps     %%xmm6, %%xmm8")
+                    __ASM_EMIT64("mulps     %%xmm6, %%xmm9")
+                    __ASM_EMIT64("mulps     %%xmm6, %%xmm10")
+                    __ASM_EMIT64("mulps     %%xmm6, %%xmm11")
+                    __ASM_EMIT64("mulps     %%xmm6, %%xmm12")
+                    __ASM_EMIT64("mulps     %%xmm6, %%xmm13")
+                    __ASM_EMIT("addps       %%xmm7, %%xmm0")
+                    __ASM_EMIT("addps       %%xmm7, %%xmm1")
+                    __ASM_EMIT("addps       %%xmm7, %%xmm2")
+                    __ASM_EMIT("addps       %%xmm7, %%xmm3")
+                    __ASM_EMIT("addps       %%xmm7, %%xmm4")
+                    __ASM_EMIT("addps       %%xmm7, %%xmm5")
+                    __ASM_EMIT64("addps     %%xmm7, %%xmm8")
+                    __ASM_EMIT64("addps     %%xmm7, %%xmm9")
+                    __ASM_EMIT64("addps     %%xmm7, %%xmm10")
+                    __ASM_EMIT64("addps     %%xmm7, %%xmm11")
+                    __ASM_EMIT64("addps     %%xmm7, %%xmm12")
+                    __ASM_EMIT64("addps     %%xmm7, %%xmm13")
+                    __ASM_EMIT("dec         %[count]")
+                    __ASM_EMIT("jnz         1b")
+                    /* Store every chain to keep all of them alive */
+                    __ASM_EMIT("movaps      %%xmm0, 0x60(%[state])")
+                    __ASM_EMIT("movaps      %%xmm1, 0x70(%[state])")
+                    __ASM_EMIT("movaps      %%xmm2, 0x80(%[state])")
+                    __ASM_EMIT("movaps      %%xmm3, 0x90(%[state])")
+                    __ASM_EMIT("movaps      %%xmm4, 0xa0(%[state])")
+                    __ASM_EMIT("movaps      %%xmm5, 0xb0(%[state])")
+                    __ASM_EMIT64("movaps    %%xmm8, 0xc0(%[state])")
+                    __ASM_EMIT64("movaps    %%xmm9, 0xd0(%[state])")
+                    __ASM_EMIT64("movaps    %%xmm10, 0xe0(%[state])")
+                    __ASM_EMIT64("movaps    %%xmm11, 0xf0(%[state])")
+                    __ASM_EMIT64("movaps    %%xmm12, 0x100(%[state])")
+                    __ASM_EMIT64("movaps    %%xmm13, 0x110(%[state])")
+                    : [count] "+r" (count)
+                    : [state] "r" (state)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                      __IF_64(, "%xmm8", "%xmm9", "%xmm10", "%xmm11", "%xmm12", "%xmm13")
+                );
+            }
+
+            void avx(float *state, size_t count)
+            {
+                ARCH_X86_ASM
+                (
+                    __ASM_EMIT("vmovaps     0x20(%[state]), %%ymm6")            /* ymm6 = k */
+                    __ASM_EMIT("vmovaps     0x40(%[state]), %%ymm7")            /* ymm7 = c */
+                    __ASM_EMIT("vmovaps     0x00(%[state]), %%ymm0")            /* ymm0 = acc */
+                    __ASM_EMIT("vmovaps     %%ymm0, %%ymm1")
+                    __ASM_EMIT("vmovaps     %%ymm0, %%ymm2")
+                    __ASM_EMIT("vmovaps     %%ymm0, %%ymm3")
+                    __ASM_EMIT("vmovaps     %%ymm0, %%ymm4")
+                    __ASM_EMIT("vmovaps     %%ymm0, %%ymm5")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm8")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm9")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm10")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm11")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm12")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm13")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("vmulps      %%ymm6, %%ymm0, %%ymm0")
+                    __ASM_EMIT("vmulps      %%ymm6, %%ymm1, %%ymm1")
+                    __ASM_EMIT("vmulps      %%ymm6, %%ymm2, %%ymm2")
+                    __ASM_EMIT("vmulps      %%ymm6, %%ymm3, %%ymm3")
+                    __ASM_EMIT("vmulps      %%ymm6, %%ymm4, %%ymm4")
+                    __ASM_EMIT("vmulps      %%ymm6, %%ymm5, %%ymm5")
+                    __ASM_EMIT64("vmulps    %%ymm6, %%ymm8, %%ymm8")
+                    __ASM_EMIT64("vmulps    %%ymm6, %%ymm9, %%ymm9")
+                    __ASM_EMIT64("vmulps    %%ymm6, %%ymm10, %%ymm10")
+                    __ASM_EMIT64("vmulps    %%ymm6, %%ymm11, %%ymm11")
+                    __ASM_EMIT64("vmulps    %%ymm6, %%ymm12, %%ymm12")
+                    __ASM_EMIT64("vmulps    %%ymm6, %%ymm13, %%ymm13")
+                    __ASM_EMIT("vaddps      %%ymm7, %%ymm0, %%ymm0")
+                    __ASM_EMIT("vaddps      %%ymm7, %%ymm1, %%ymm1")
+                    __ASM_EMIT("vaddps      %%ymm7, %%ymm2, %%ymm2")
+                    __ASM_EMIT("vaddps      %%ymm7, %%ymm3, %%ymm3")
+                    __ASM_EMIT("vaddps      %%ymm7, %%ymm4, %%ymm4")
+                    __ASM_EMIT("vaddps      %%ymm7, %%ymm5, %%ymm5")
+                    __ASM_EMIT64("vaddps    %%ymm7, %%ymm8, %%ymm8")
+                    __ASM_EMIT64("vaddps    %%ymm7, %%ymm9, %%ymm9")
+                    __ASM_EMIT64("vaddps    %%ymm7, %%ymm10, %%ymm10")
+                    __ASM_EMIT64("vaddps    %%ymm7, %%ymm11, %%ymm11")
+                    __ASM_EMIT64("vaddps    %%ymm7, %%ymm12, %%ymm12")
+                    __ASM_EMIT64("vaddps    %%ymm7, %%ymm13, %%ymm13")
+                    __ASM_EMIT("dec         %[count]")
+                    __ASM_EMIT("jnz         1b")
+                    /* Store every chain to keep all of them alive */
+                    __ASM_EMIT("vmovaps     %%ymm0, 0x60(%[state])")
+                    __ASM_EMIT("vmovaps     %%ymm1, 0x80(%[state])")
+                    __ASM_EMIT("vmovaps     %%ymm2, 0xa0(%[state])")
+                    __ASM_EMIT("vmovaps     %%ymm3, 0xc0(%[state])")
+                    __ASM_EMIT("vmovaps     %%ymm4, 0xe0(%[state])")
+                    __ASM_EMIT("vmovaps     %%ymm5, 0x100(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm8, 0x120(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm9, 0x140(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm10, 0x160(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm11, 0x180(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm12, 0x1a0(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm13, 0x1c0(%[state])")
+                    __ASM_EMIT("vzeroupper")
+                    : [count] "+r" (count)
+                    : [state] "r" (state)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                      __IF_64(, "%xmm8", "%xmm9", "%xmm10", "%xmm11", "%xmm12", "%xmm13")
+                );
+            }
+
+            void avx_fma3(float *state, size_t count)
+            {
+                ARCH_X86_ASM
+                (
+                    __ASM_EMIT("vmovaps     0x20(%[state]), %%ymm6")            /* ymm6 = k */
+                    __ASM_EMIT("vmovaps     0x40(%[state]), %%ymm7")            /* ymm7 = c */
+                    __ASM_EMIT("vmovaps     0x00(%[state]), %%ymm0")            /* ymm0 = acc */
+                    __ASM_EMIT("vmovaps     %%ymm0, %%ymm1")
+                    __ASM_EMIT("vmovaps     %%ymm0, %%ymm2")
+                    __ASM_EMIT("vmovaps     %%ymm0, %%ymm3")
+                    __ASM_EMIT("vmovaps     %%ymm0, %%ymm4")
+                    __ASM_EMIT("vmovaps     %%ymm0, %%ymm5")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm8")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm9")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm10")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm11")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm12")
+                    __ASM_EMIT64("vmovaps   %%ymm0, %%ymm13")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("vfmadd213ps %%ymm7, %%ymm6, %%ymm0")
+                    __ASM_EMIT("vfmadd213ps %%ymm7, %%ymm6, %%ymm1")
+                    __ASM_EMIT("vfmadd213ps %%ymm7, %%ymm6, %%ymm2")
+                    __ASM_EMIT("vfmadd213ps %%ymm7, %%ymm6, %%ymm3")
+                    __ASM_EMIT("vfmadd213ps %%ymm7, %%ymm6, %%ymm4")
+                    __ASM_EMIT("vfmadd213ps %%ymm7, %%ymm6, %%ymm5")
+                    __ASM_EMIT64("vfmadd213ps %%ymm7, %%ymm6, %%ymm8")
+                    __ASM_EMIT64("vfmadd213ps %%ymm7, %%ymm6, %%ymm9")
+                    __ASM_EMIT64("vfmadd213ps %%ymm7, %%ymm6, %%ymm10")
+                    __ASM_EMIT64("vfmadd213ps %%ymm7, %%ymm6, %%ymm11")
+                    __ASM_EMIT64("vfmadd213ps %%ymm7, %%ymm6, %%ymm12")
+                    __ASM_EMIT64("vfmadd213ps %%ymm7, %%ymm6, %%ymm13")
+                    __ASM_EMIT("dec         %[count]")
+                    __ASM_EMIT("jnz         1b")
+                    /* Store every chain to keep all of them alive */
+                    __ASM_EMIT("vmovaps     %%ymm0, 0x60(%[state])")
+                    __ASM_EMIT("vmovaps     %%ymm1, 0x80(%[state])")
+                    __ASM_EMIT("vmovaps     %%ymm2, 0xa0(%[state])")
+                    __ASM_EMIT("vmovaps     %%ymm3, 0xc0(%[state])")
+                    __ASM_EMIT("vmovaps     %%ymm4, 0xe0(%[state])")
+                    __ASM_EMIT("vmovaps     %%ymm5, 0x100(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm8, 0x120(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm9, 0x140(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm10, 0x160(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm11, 0x180(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm12, 0x1a0(%[state])")
+                    __ASM_EMIT64("vmovaps   %%ymm13, 0x1c0(%[state])")
+                    __ASM_EMIT("vzeroupper")
+                    : [count] "+r" (count)
+                    : [state] "r" (state)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                      __IF_64(, "%xmm8", "%xmm9", "%xmm10", "%xmm11", "%xmm12", "%xmm13")
+                );
+            }
+        )
+
+        IF_ARCH_ARM(
+            void neon_d32(float *state, size_t count)
+            {
+                const float *k  = &state[8];
+                const float *c  = &state[16];
+                float *sink     = &state[24];
+
+                ARCH_ARM_ASM
+                (
+                    __ASM_EMIT("vld1.32     {q14}, [%[k]]")                     /* q14 = k */
+                    __ASM_EMIT("vld1.32     {q15}, [%[c]]")                     /* q15 = c */
+                    __ASM_EMIT("vld1.32     {q0}, [%[state]]")                  /* q0 = acc */
+                    __ASM_EMIT("vmov        q1, q0")
+                    __ASM_EMIT("vmov        q2, q0")
+                    __ASM_EMIT("vmov        q3, q0")
+                    __ASM_EMIT("vmov        q4, q0")
+                    __ASM_EMIT("vmov        q5, q0")
+                    __ASM_EMIT("vmov        q6, q0")
+                    __ASM_EMIT("vmov        q7, q0")
+                    __ASM_EMIT("vmov        q8, q0")
+                    __ASM_EMIT("vmov        q9, q0")
+                    __ASM_EMIT("vmov        q10, q0")
+                    __ASM_EMIT("vmov        q11, q0")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("vmla.f32    q0, q14, q15")
+                    __ASM_EMIT("vmla.f32    q1, q14, q15")
+                    __ASM_EMIT("vmla.f32    q2, q14, q15")
+                    __ASM_EMIT("vmla.f32    q3, q14, q15")
+                    __ASM_EMIT("vmla.f32    q4, q14, q15")
+                    __ASM_EMIT("vmla.f32    q5, q14, q15")
+                    __ASM_EMIT("vmla.f32    q6, q14, q15")
+                    __ASM_EMIT("vmla.f32    q7, q14, q15")
+                    __ASM_EMIT("vmla.f32    q8, q14, q15")
+                    __ASM_EMIT("vmla.f32    q9, q14, q15")
+                    __ASM_EMIT("vmla.f32    q10, q14, q15")
+                    __ASM_EMIT("vmla.f32    q11, q14, q15")
+                    __ASM_EMIT("vmls.f32    q0, q14, q15")
+                    __ASM_EMIT("vmls.f32    q1, q14, q15")
+                    __ASM_EMIT("vmls.f32    q2, q14, q15")
+                    __ASM_EMIT("vmls.f32    q3, q14, q15")
+                    __ASM_EMIT("vmls.f32    q4, q14, q15")
+                    __ASM_EMIT("vmls.f32    q5, q14, q15")
+                    __ASM_EMIT("vmls.f32    q6, q14, q15")
+                    __ASM_EMIT("vmls.f32    q7, q14, q15")
+                    __ASM_EMIT("vmls.f32    q8, q14, q15")
+                    __ASM_EMIT("vmls.f32    q9, q14, q15")
+                    __ASM_EMIT("vmls.f32    q10, q14, q15")
+                    __ASM_EMIT("vmls.f32    q11, q14, q15")
+                    __ASM_EMIT("subs        %[count], %[count], #1")
+                    __ASM_EMIT("bne         1b")
+                    /* Store every chain to keep all of them alive */
+                    __ASM_EMIT("vstm        %[sink]!, {q0-q7}")
+                    __ASM_EMIT("vstm        %[sink], {q8-q11}")
+                    : [count] "+r" (count), [sink] "+r" (sink)
+                    : [state] "r" (state), [k] "r" (k), [c] "r" (c)
+                    : "cc", "memory",
+                      "q0", "q1", "q2", "q3", "q4", "q5", "q6", "q7",
+                      "q8", "q9", "q10", "q11", "q14", "q15"
+                );
+            }
+        )
+
+        IF_ARCH_AARCH64(
+            void asimd(float *state, size_t count)
+            {
+                ARCH_AARCH64_ASM
+                (
+                    __ASM_EMIT("ldr         q16, [%[state], #0x20]")            /* v16 = k */
+                    __ASM_EMIT("ldr         q17, [%[state], #0x40]")            /* v17 = c */
+                    __ASM_EMIT("ldr         q0, [%[state], #0x00]")             /* v0  = acc */
+                    __ASM_EMIT("mov         v1.16b, v0.16b")
+                    __ASM_EMIT("mov         v2.16b, v0.16b")
+                    __ASM_EMIT("mov         v3.16b, v0.16b")
+                    __ASM_EMIT("mov         v4.16b, v0.16b")
+                    __ASM_EMIT("mov         v5.16b, v0.16b")
+                    __ASM_EMIT("mov         v6.16b, v0.16b")
+                    __ASM_EMIT("mov         v7.16b, v0.16b")
+                    __ASM_EMIT("mov         v8.16b, v0.16b")
+                    __ASM_EMIT("mov         v9.16b, v0.16b")
+                    __ASM_EMIT("mov         v10.16b, v0.16b")
+                    __ASM_EMIT("mov         v11.16b, v0.16b")
+                    __ASM_EMIT("mov         v12.16b, v0.16b")
+                    __ASM_EMIT("mov         v13.16b, v0.16b")
+                    __ASM_EMIT("mov         v14.16b, v0.16b")
+                    __ASM_EMIT("mov         v15.16b, v0.16b")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("fmla        v0.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v1.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v2.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v3.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v4.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v5.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v6.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v7.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v8.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v9.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v10.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v11.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v12.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v13.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v14.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmla        v15.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v0.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v1.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v2.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v3.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v4.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v5.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v6.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v7.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v8.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v9.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v10.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v11.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v12.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v13.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v14.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("fmls        v15.4s, v16.4s, v17.4s")
+                    __ASM_EMIT("subs        %[count], %[count], #1")
+                    __ASM_EMIT("b.ne        1b")
+                    /* Store every chain to keep all of them alive */
+                    __ASM_EMIT("stp         q0, q1, [%[state], #0x060]")
+                    __ASM_EMIT("stp         q2, q3, [%[state], #0x080]")
+                    __ASM_EMIT("stp         q4, q5, [%[state], #0x0a0]")
+                    __ASM_EMIT("stp         q6, q7, [%[state], #0x0c0]")
+                    __ASM_EMIT("stp         q8, q9, [%[state], #0x0e0]")
+                    __ASM_EMIT("stp         q10, q11, [%[state], #0x100]")
+                    __ASM_EMIT("stp         q12, q13, [%[state], #0x120]")
+                    __ASM_EMIT("stp         q14, q15, [%[state], #0x140]")
+                    : [count] "+r" (count)
+                    : [state] "r" (state)
+                    : "cc", "memory",
+                      "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7",
+                      "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15",
+                      "v16", "v17"
+                );
+            }
+        )
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Memory hierarchy sweep. Each case label carries the traffic and the
+// arithmetic per sample as '[<bytes>B <flops>F]' so the report tools can
+// turn calls/s into GB/s and GFLOP/s. The copy kernel serves as the
+// bandwidth roof for every working set size, the register-resident peak
+// kernels serve as the arithmetic roof.
+PTEST_BEGIN("dsp", sweep, 2, 1000)
+
+    // Stream layout: 'streams' buffers of 'count' floats each, 64-byte aligned
+    static size_t stream_count(size_t wset, size_t streams)
+    {
+        size_t count    = wset / (streams * sizeof(float));
+        return count & ~size_t(0x0f);
+    }
+
+    void call(const char *label, float *buf, size_t wset, copy_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        size_t count    = stream_count(wset, 2);
+        float *dst      = buf;
+        float *src      = &dst[count];
+
+        char name[80];
+        sprintf(name, "%s x %d [8B 0F]", label, int(count));
+        printf("Testing %s ...\n", name);
+
+        PTEST_LOOP(name,
+            func(dst, src, count);
+        );
+    }
+
+    void call(const char *label, float *buf, size_t wset, mix_add4_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        size_t count    = stream_count(wset, 5);
+        float *dst      = buf;
+        float *s1       = &dst[count];
+        float *s2       = &s1[count];
+        float *s3       = &s2[count];
+        float *s4       = &s3[count];
+
+        char name[80];
+        sprintf(name, "%s x %d [20B 7F]", label, int(count));
+        printf("Testing %s ...\n", name);
+
+        PTEST_LOOP(name,
+            func(dst, s1, s2, s3, s4, 0.25f, 0.5f, 0.75f, 1.0f, count);
+        );
+    }
+
+    void call(const char *label, float *buf, size_t wset, fmadd4_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        size_t count    = stream_count(wset, 4);
+        float *dst      = buf;
+        float *a        = &dst[count];
+        float *b        = &a[count];
+        float *c        = &b[count];
+
+        char name[80];
+        sprintf(name, "%s x %d [16B 2F]", label, int(count));
+        printf("Testing %s ...\n", name);
+
+        PTEST_LOOP(name,
+            func(dst, a, b, c, count);
+        );
+    }
+
+    void call(const char *label, float *buf, size_t wset, biquad_process_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        size_t count    = stream_count(wset, 2);
+        float *dst      = buf;
+        float *src      = &dst[count];
+
+        // Eight cascaded stable sections, 5 mul + 4 add each
+        dsp::biquad_t f __lsp_aligned64;
+        for (size_t i=0; i<8; ++i)
+        {
+            f.x8.b0[i]      = 0.25f;
+            f.x8.b1[i]      = 0.5f;
+            f.x8.b2[i]      = 0.25f;
+            f.x8.a1[i]      = 0.5f;
+            f.x8.a2[i]      = -0.25f;
+        }
+        for (size_t i=0; i<8; ++i)
+            f.d[i]          = 0.0f;
+
+        char name[80];
+        sprintf(name, "%s x %d [8B 72F]", label, int(count));
+        printf("Testing %s ...\n", name);
+
+        PTEST_LOOP(name,
+            func(dst, src, count, &f);
+        );
+    }
+
+    void call_fft(const char *label, float *buf, size_t rank, packed_direct_fft_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        // Packed complex in and out: 16 bytes and 5*log2(N) flops per sample
+        size_t count    = size_t(1) << rank;
+        float *dst      = buf;
+        float *src      = &dst[count * 2];
+
+        char name[80];
+        sprintf(name, "%s x %d [16B %dF]", label, int(count), int(rank * 5));
+        printf("Testing %s ...\n", name);
+
+        PTEST_LOOP(name,
+            func(dst, src, rank);
+        );
+    }
+
+    void call_peak(const char *label, float *buf, bool supported, size_t flops, peak_t func)
+    {
+        if (!supported)
+            return;
+
+        // acc = 1 is the fixed point of acc * 0.5 + 0.5 and the ARM chains add and subtract
+        // the same 0.25, so the chains never overflow or denormalize
+        float *state    = buf;
+        for (size_t i=0; i<8; ++i)
+        {
+            state[i]        = 1.0f;
+            state[i + 8]    = 0.5f;
+            state[i + 16]   = 0.5f;
+        }
+
+        size_t count    = PEAK_ITERATIONS;
+
+        char name[80];
+        sprintf(name, "%s x %d [0B %dF]", label, int(count), int(flops));
+        printf("Testing %s ...\n", name);
+
+        PTEST_LOOP(name,
+            func(state, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        size_t items    = MAX_WSET / sizeof(float);
+        float *buf      = alloc_aligned<float>(data, items, 64);
+
+        for (size_t i=0; i < items; ++i)
+            buf[i]          = randf(-1.0f, 1.0f);
+
+        // Arithmetic roof: chains * lanes * 2 flops per multiply-add, the ARM kernels issue
+        // two multiply-adds per chain in each iteration. Each kernel runs only where its
+        // backend does
+        call_peak("generic::peak", buf, true, 8 * 2, peak::generic);
+        IF_ARCH_X86(call_peak("sse::peak", buf, PTEST_SUPPORTED(sse::copy), __IF_32_64(6, 12) * 4 * 2, peak::sse));
+        IF_ARCH_X86(call_peak("avx::peak", buf, PTEST_SUPPORTED(avx::copy), __IF_32_64(6, 12) * 8 * 2, peak::avx));
+        IF_ARCH_X86(call_peak("avx::peak_fma3", buf, PTEST_SUPPORTED(avx::fmadd4_fma3), __IF_32_64(6, 12) * 8 * 2, peak::avx_fma3));
+        IF_ARCH_ARM(call_peak("neon_d32::peak", buf, PTEST_SUPPORTED(neon_d32::copy), 12 * 4 * 4, peak::neon_d32));
+        IF_ARCH_AARCH64(call_peak("asimd::peak", buf, PTEST_SUPPORTED(asimd::copy), 16 * 4 * 4, peak::asimd));
+        PTEST_SEPARATOR2;
+
+        #define CALL(func) \
+            call(#func, buf, wset, func)
+
+        for (size_t wset=MIN_WSET; wset <= MAX_WSET; wset <<= WSET_STEP)
+        {
+            CALL(generic::copy);
+            IF_ARCH_X86(CALL(sse::copy));
+            IF_ARCH_X86(CALL(avx::copy));
+            IF_ARCH_ARM(CALL(neon_d32::copy));
+            IF_ARCH_AARCH64(CALL(asimd::copy));
+            PTEST_SEPARATOR;
+
+            CALL(generic::mix_add4);
+            IF_ARCH_X86(CALL(sse::mix_add4));
+            IF_ARCH_X86(CALL(avx::mix_add4));
+            IF_ARCH_ARM(CALL(neon_d32::mix_add4));
+            IF_ARCH_AARCH64(CALL(asimd::mix_add4));
+            PTEST_SEPARATOR;
+
+            CALL(generic::fmadd4);
+            IF_ARCH_X86(CALL(sse::fmadd4));
+            IF_ARCH_X86(CALL(avx::fmadd4));
+            IF_ARCH_X86(CALL(avx::fmadd4_fma3));
+            IF_ARCH_ARM(CALL(neon_d32::fmadd4));
+            IF_ARCH_AARCH64(CALL(asimd::fmadd4));
+            PTEST_SEPARATOR;
+
+            CALL(generic::biquad_process_x8);
+            IF_ARCH_X86(CALL(sse::biquad_process_x8));
+            IF_ARCH_X86(CALL(sse3::x64_biquad_process_x8));
+            IF_ARCH_X86(CALL(avx::x64_biquad_process_x8));
+            IF_ARCH_X86(CALL(avx::biquad_process_x8_fma3));
+            IF_ARCH_ARM(CALL(neon_d32::biquad_process_x8));
+            IF_ARCH_AARCH64(CALL(asimd::biquad_process_x8));
+            PTEST_SEPARATOR2;
+        }
+
+        #undef CALL
+        #define CALL(func) \
+            call_fft(#func, buf, rank, func)
+
+        // Packed FFT: 16 bytes per sample, working set 4 KiB .. 1 MiB
+        for (size_t rank=FFT_MIN_RANK; rank <= FFT_MAX_RANK; rank += WSET_STEP)
+        {
+            CALL(generic::packed_direct_fft);
+            IF_ARCH_X86(CALL(sse::packed_direct_fft));
+            IF_ARCH_X86(CALL(avx::packed_direct_fft));
+            IF_ARCH_X86(CALL(avx::packed_direct_fft_fma3));
+            IF_ARCH_ARM(CALL(neon_d32::packed_direct_fft));
+            IF_ARCH_AARCH64(CALL(asimd::packed_direct_fft));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
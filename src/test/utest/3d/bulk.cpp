@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <private/utest/dsp/3d/helpers.h>
+
+#define TOLERANCE       1e-4f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void calc_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+        void calc_sqr_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+        void calc_avg_distance_pvn(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+        void unit_vector_p1pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+        void calc_oriented_plane_pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+        void vector_mul_v2n(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void calc_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+            void calc_sqr_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+            void calc_avg_distance_pvn(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void unit_vector_p1pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void calc_oriented_plane_pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void vector_mul_v2n(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n);
+        }
+
+        namespace avx
+        {
+            void calc_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+            void calc_sqr_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+            void calc_avg_distance_pvn(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void unit_vector_p1pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void vector_mul_v2n(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void calc_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+            void calc_sqr_distance_p1n(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+            void calc_avg_distance_pvn(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void unit_vector_p1pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void calc_oriented_plane_pvn(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+            void vector_mul_v2n(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n);
+        }
+    )
+
+    typedef void (* distance_n_t)(float *dst, const dsp::point3d_t *sp, const dsp::point3d_t *p, size_t n);
+    typedef void (* vector_p1pvn_t)(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv, size_t n);
+    typedef void (* vector_mul_v2n_t)(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t n);
+}
+
+UTEST_BEGIN("dsp.3d", bulk)
+
+    static void init_points(dsp::point3d_t *p, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+            dsp::init_point_xyz(&p[i], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+    }
+
+    static void init_vectors(dsp::vector3d_t *v, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+            dsp::init_vector_dxyz(&v[i], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+    }
+
+    void check_vectors(const char *label, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            if (!vector3d_ack(&v1[i], &v2[i], TOLERANCE))
+            {
+                dump_vector("v1", &v1[i]);
+                dump_vector("v2", &v2[i]);
+                UTEST_FAIL_MSG("Output of '%s' differs at index %d", label, int(i));
+            }
+        }
+    }
+
+    void call(const char *label, size_t step, distance_n_t ref, distance_n_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 3, 4, 5, 8, 16, 33, 64, 0x1ff)
+        {
+            printf("Testing %s on count=%d\n", label, int(count));
+
+            dsp::point3d_t sp;
+            dsp::point3d_t *p   = new dsp::point3d_t[count * step];
+            FloatBuffer dst1(count);
+            FloatBuffer dst2(dst1);
+
+            init_points(&sp, 1);
+            init_points(p, count * step);
+
+            ref(dst1, &sp, p, count);
+            func(dst2, &sp, p, count);
+            delete [] p;
+
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output of '%s' differs at index %d: %.6f vs %.6f",
+                    label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+            }
+        }
+    }
+
+    void call(const char *label, vector_p1pvn_t ref, vector_p1pvn_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 3, 4, 5, 8, 16, 33, 64, 0x1ff)
+        {
+            printf("Testing %s on count=%d\n", label, int(count));
+
+            dsp::point3d_t sp;
+            dsp::point3d_t *pv  = new dsp::point3d_t[count * 3];
+            dsp::vector3d_t *v1 = new dsp::vector3d_t[count + 1];
+            dsp::vector3d_t *v2 = new dsp::vector3d_t[count + 1];
+
+            dsp::init_point_xyz(&sp, 1.0f, 2.0f, 3.0f);
+            init_points(pv, count * 3);
+            if (count > 0)
+            {
+                // Degenerate triangle, the center matches sp exactly
+                pv[0]   = sp;
+                pv[1]   = sp;
+                pv[2]   = sp;
+            }
+            dsp::init_vector_dxyz(&v1[count], 1.0f, 2.0f, 3.0f);
+            dsp::init_vector_dxyz(&v2[count], 1.0f, 2.0f, 3.0f);
+
+            ref(v1, &sp, pv, count);
+            func(v2, &sp, pv, count);
+            check_vectors(label, v1, v2, count + 1);
+
+            delete [] pv;
+            delete [] v1;
+            delete [] v2;
+        }
+    }
+
+    void call(const char *label, vector_mul_v2n_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 3, 4, 5, 8, 16, 33, 64, 0x1ff)
+        {
+            printf("Testing %s on count=%d\n", label, int(count));
+
+            dsp::vector3d_t *v  = new dsp::vector3d_t[count * 2];
+            dsp::vector3d_t *r1 = new dsp::vector3d_t[count + 1];
+            dsp::vector3d_t *r2 = new dsp::vector3d_t[count + 1];
+
+            init_vectors(v, count * 2);
+            dsp::init_vector_dxyz(&r1[count], 1.0f, 2.0f, 3.0f);
+            dsp::init_vector_dxyz(&r2[count], 1.0f, 2.0f, 3.0f);
+
+            generic::vector_mul_v2n(r1, v, &v[count], count);
+            func(r2, v, &v[count], count);
+            check_vectors(label, r1, r2, count + 1);
+
+            delete [] v;
+            delete [] r1;
+            delete [] r2;
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL_DISTANCE(arch, func, step) \
+            call(#arch "::" #func, step, generic::func, arch::func)
+        #define CALL_VECTOR(arch, func) \
+            call(#arch "::" #func, generic::func, arch::func)
+
+        IF_ARCH_X86(CALL_DISTANCE(sse, calc_distance_p1n, 1));
+        IF_ARCH_X86(CALL_DISTANCE(sse, calc_sqr_distance_p1n, 1));
+        IF_ARCH_X86(CALL_DISTANCE(sse, calc_avg_distance_pvn, 3));
+        IF_ARCH_X86(CALL_VECTOR(sse, unit_vector_p1pvn));
+        IF_ARCH_X86(CALL_VECTOR(sse, calc_oriented_plane_pvn));
+        IF_ARCH_X86(call("sse::vector_mul_v2n", sse::vector_mul_v2n));
+
+        IF_ARCH_X86(CALL_DISTANCE(avx, calc_distance_p1n, 1));
+        IF_ARCH_X86(CALL_DISTANCE(avx, calc_sqr_distance_p1n, 1));
+        IF_ARCH_X86(CALL_DISTANCE(avx, calc_avg_distance_pvn, 3));
+        IF_ARCH_X86(CALL_VECTOR(avx, unit_vector_p1pvn));
+        IF_ARCH_X86(call("avx::vector_mul_v2n", avx::vector_mul_v2n));
+
+        IF_ARCH_AARCH64(CALL_DISTANCE(asimd, calc_distance_p1n, 1));
+        IF_ARCH_AARCH64(CALL_DISTANCE(asimd, calc_sqr_distance_p1n, 1));
+        IF_ARCH_AARCH64(CALL_DISTANCE(asimd, calc_avg_distance_pvn, 3));
+        IF_ARCH_AARCH64(CALL_VECTOR(asimd, unit_vector_p1pvn));
+        IF_ARCH_AARCH64(CALL_VECTOR(asimd, calc_oriented_plane_pvn));
+        IF_ARCH_AARCH64(call("asimd::vector_mul_v2n", asimd::vector_mul_v2n));
+
+        #undef CALL_DISTANCE
+        #undef CALL_VECTOR
+    }
+UTEST_END;
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <private/utest/dsp/3d/helpers.h>
+
+#define TOLERANCE       1e-4f
+
+namespace lsp
+{
+    namespace generic
+    {
+        float calc_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+        float calc_distance_pv(const dsp::point3d_t *pv);
+        float calc_distance_v1(const dsp::vector3d_t *v);
+        float calc_sqr_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+        float calc_sqr_distance_pv(const dsp::point3d_t *pv);
+        float projection_length_p2(const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *pp);
+        float projection_length_v2(const dsp::vector3d_t *v, const dsp::vector3d_t *pv);
+        float calc_avg_distance_p3(const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+        void unit_vector_p1p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+        void unit_vector_p1pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            float calc_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            float calc_distance_pv(const dsp::point3d_t *pv);
+            float calc_distance_v1(const dsp::vector3d_t *v);
+            float calc_sqr_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            float calc_sqr_distance_pv(const dsp::point3d_t *pv);
+            float projection_length_p2(const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *pp);
+            float projection_length_v2(const dsp::vector3d_t *v, const dsp::vector3d_t *pv);
+            float calc_avg_distance_p3(const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            void unit_vector_p1p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            void unit_vector_p1pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            float calc_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            float calc_distance_pv(const dsp::point3d_t *pv);
+            float calc_distance_v1(const dsp::vector3d_t *v);
+            float calc_sqr_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            float calc_sqr_distance_pv(const dsp::point3d_t *pv);
+            float projection_length_p2(const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *pp);
+            float projection_length_v2(const dsp::vector3d_t *v, const dsp::vector3d_t *pv);
+            float calc_avg_distance_p3(const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            void unit_vector_p1p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            void unit_vector_p1pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+        }
+    )
+
+    typedef float (* calc_distance_p2_t)(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+    typedef float (* calc_distance_pv_t)(const dsp::point3d_t *pv);
+    typedef float (* calc_distance_v1_t)(const dsp::vector3d_t *v);
+    typedef float (* projection_length_p2_t)(const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *pp);
+    typedef float (* projection_length_v2_t)(const dsp::vector3d_t *v, const dsp::vector3d_t *pv);
+    typedef float (* calc_avg_distance_p3_t)(const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+    typedef void (* unit_vector_p1p3_t)(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+    typedef void (* unit_vector_p1pv_t)(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+}
+
+UTEST_BEGIN("dsp.3d", distance)
+
+    static void init_points(dsp::point3d_t *p, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+            dsp::init_point_xyz(&p[i], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+    }
+
+    void check_value(const char *label, float v1, float v2)
+    {
+        if (!float_equals_adaptive(v1, v2, TOLERANCE))
+            UTEST_FAIL_MSG("Result of %s differs: %e vs %e", label, v1, v2);
+    }
+
+    void call(const char *label,
+            calc_distance_p2_t distance_p2, calc_distance_pv_t distance_pv, calc_distance_v1_t distance_v1,
+            calc_distance_p2_t sqr_distance_p2, calc_distance_pv_t sqr_distance_pv)
+    {
+        if ((!UTEST_SUPPORTED(distance_p2)) ||
+            (!UTEST_SUPPORTED(distance_pv)) ||
+            (!UTEST_SUPPORTED(distance_v1)) ||
+            (!UTEST_SUPPORTED(sqr_distance_p2)) ||
+            (!UTEST_SUPPORTED(sqr_distance_pv)))
+            return;
+
+        printf("Testing %s...\n", label);
+
+        dsp::point3d_t pv[2];
+        dsp::vector3d_t v;
+
+        for (size_t i=0; i<0x200; ++i)
+        {
+            init_points(pv, 2);
+            dsp::init_vector_p2(&v, &pv[0], &pv[1]);
+
+            check_value("calc_distance_p2", generic::calc_distance_p2(&pv[0], &pv[1]), distance_p2(&pv[0], &pv[1]));
+            check_value("calc_distance_pv", generic::calc_distance_pv(pv), distance_pv(pv));
+            check_value("calc_distance_v1", generic::calc_distance_v1(&v), distance_v1(&v));
+            check_value("calc_sqr_distance_p2", generic::calc_sqr_distance_p2(&pv[0], &pv[1]), sqr_distance_p2(&pv[0], &pv[1]));
+            check_value("calc_sqr_distance_pv", generic::calc_sqr_distance_pv(pv), sqr_distance_pv(pv));
+        }
+    }
+
+    void call(const char *label, projection_length_p2_t proj_p2, projection_length_v2_t proj_v2)
+    {
+        if ((!UTEST_SUPPORTED(proj_p2)) || (!UTEST_SUPPORTED(proj_v2)))
+            return;
+
+        printf("Testing %s...\n", label);
+
+        dsp::point3d_t p[3];
+        dsp::vector3d_t v[2];
+
+        for (size_t i=0; i<0x200; ++i)
+        {
+            init_points(p, 3);
+            dsp::init_vector_p2(&v[0], &p[0], &p[2]);
+            dsp::init_vector_p2(&v[1], &p[0], &p[1]);
+
+            check_value("projection_length_p2", generic::projection_length_p2(&p[0], &p[1], &p[2]), proj_p2(&p[0], &p[1], &p[2]));
+            check_value("projection_length_v2", generic::projection_length_v2(&v[0], &v[1]), proj_v2(&v[0], &v[1]));
+        }
+    }
+
+    void call(const char *label, calc_avg_distance_p3_t avg_distance, unit_vector_p1p3_t unit_p1p3, unit_vector_p1pv_t unit_p1pv)
+    {
+        if ((!UTEST_SUPPORTED(avg_distance)) || (!UTEST_SUPPORTED(unit_p1p3)) || (!UTEST_SUPPORTED(unit_p1pv)))
+            return;
+
+        printf("Testing %s...\n", label);
+
+        dsp::point3d_t sp, pv[3];
+        dsp::vector3d_t v1, v2;
+
+        for (size_t i=0; i<0x200; ++i)
+        {
+            init_points(&sp, 1);
+            init_points(pv, 3);
+
+            check_value("calc_avg_distance_p3",
+                generic::calc_avg_distance_p3(&sp, &pv[0], &pv[1], &pv[2]),
+                avg_distance(&sp, &pv[0], &pv[1], &pv[2]));
+
+            generic::unit_vector_p1p3(&v1, &sp, &pv[0], &pv[1], &pv[2]);
+            unit_p1p3(&v2, &sp, &pv[0], &pv[1], &pv[2]);
+            if (!vector3d_ack(&v1, &v2, TOLERANCE))
+            {
+                dump_vector("v1", &v1);
+                dump_vector("v2", &v2);
+                UTEST_FAIL_MSG("Result of unit_vector_p1p3 differs");
+            }
+
+            generic::unit_vector_p1pv(&v1, &sp, pv);
+            unit_p1pv(&v2, &sp, pv);
+            if (!vector3d_ack(&v1, &v2, TOLERANCE))
+            {
+                dump_vector("v1", &v1);
+                dump_vector("v2", &v2);
+                UTEST_FAIL_MSG("Result of unit_vector_p1pv differs");
+            }
+        }
+
+        // Degenerate case: the center of triangle matches the source point
+        dsp::init_point_xyz(&sp, 1.0f, 2.0f, 3.0f);
+        pv[0] = sp;
+        pv[1] = sp;
+        pv[2] = sp;
+        generic::unit_vector_p1pv(&v1, &sp, pv);
+        unit_p1pv(&v2, &sp, pv);
+        UTEST_ASSERT_MSG(vector3d_ack(&v1, &v2, TOLERANCE), "Result of unit_vector_p1pv differs for degenerate triangle");
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL_DISTANCE(arch) \
+            call(#arch "::calc_distance", \
+                arch::calc_distance_p2, arch::calc_distance_pv, arch::calc_distance_v1, \
+                arch::calc_sqr_distance_p2, arch::calc_sqr_distance_pv)
+        #define CALL_PROJECTION(arch) \
+            call(#arch "::projection_length", arch::projection_length_p2, arch::projection_length_v2)
+        #define CALL_UNIT(arch) \
+            call(#arch "::unit_vector", arch::calc_avg_distance_p3, arch::unit_vector_p1p3, arch::unit_vector_p1pv)
+
+        IF_ARCH_X86(CALL_DISTANCE(sse));
+        IF_ARCH_X86(CALL_PROJECTION(sse));
+        IF_ARCH_X86(CALL_UNIT(sse));
+
+        IF_ARCH_AARCH64(CALL_DISTANCE(asimd));
+        IF_ARCH_AARCH64(CALL_PROJECTION(asimd));
+        IF_ARCH_AARCH64(CALL_UNIT(asimd));
+
+        #undef CALL_DISTANCE
+        #undef CALL_PROJECTION
+        #undef CALL_UNIT
+    }
+UTEST_END;
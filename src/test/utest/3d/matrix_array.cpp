@@ -0,0 +1,348 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <private/utest/dsp/3d/helpers.h>
+
+#define TOLERANCE       1e-5f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void apply_matrix3d_mvn(dsp::vector3d_t *r, const dsp::vector3d_t *v, const dsp::matrix3d_t *m, size_t n);
+        void apply_matrix3d_mpn(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+        void apply_matrix3d_mv_soa(dsp::vector3d_soa_t *dst, const dsp::vector3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+        void apply_matrix3d_mp_soa(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+        void apply_matrix3d_mpn_bound_box(dsp::bound_box3d_t *b, dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void apply_matrix3d_mvn(dsp::vector3d_t *r, const dsp::vector3d_t *v, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mpn(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mv_soa(dsp::vector3d_soa_t *dst, const dsp::vector3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mp_soa(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mpn_bound_box(dsp::bound_box3d_t *b, dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+        }
+    )
+
+    IF_ARCH_X86(
+        namespace avx
+        {
+            void apply_matrix3d_mvn(dsp::vector3d_t *r, const dsp::vector3d_t *v, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mpn(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mv_soa(dsp::vector3d_soa_t *dst, const dsp::vector3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mp_soa(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void apply_matrix3d_mvn(dsp::vector3d_t *r, const dsp::vector3d_t *v, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mpn(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mv_soa(dsp::vector3d_soa_t *dst, const dsp::vector3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mp_soa(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+            void apply_matrix3d_mpn_bound_box(dsp::bound_box3d_t *b, dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+        }
+    )
+
+    typedef void (* apply_matrix3d_mvn_t)(dsp::vector3d_t *r, const dsp::vector3d_t *v, const dsp::matrix3d_t *m, size_t n);
+    typedef void (* apply_matrix3d_mpn_t)(dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+    typedef void (* apply_matrix3d_mv_soa_t)(dsp::vector3d_soa_t *dst, const dsp::vector3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+    typedef void (* apply_matrix3d_mp_soa_t)(dsp::point3d_soa_t *dst, const dsp::point3d_soa_t *src, const dsp::matrix3d_t *m, size_t n);
+    typedef void (* apply_matrix3d_mpn_bound_box_t)(dsp::bound_box3d_t *b, dsp::point3d_t *r, const dsp::point3d_t *p, const dsp::matrix3d_t *m, size_t n);
+}
+
+UTEST_BEGIN("dsp.3d", matrix_array)
+
+    static const size_t MATRICES    = 3;
+
+    // Generate affine, projective and degenerate (w = 0) transformations
+    void init_matrix(dsp::matrix3d_t *m, size_t type)
+    {
+        dsp::matrix3d_t xm;
+        dsp::init_matrix3d_rotate_xyz(m, randf(-1.0f, 1.0f), randf(-1.0f, 1.0f), randf(-1.0f, 1.0f), randf(-M_PI, M_PI));
+        dsp::init_matrix3d_scale(&xm, randf(0.5f, 2.0f), randf(0.5f, 2.0f), randf(0.5f, 2.0f));
+        dsp::apply_matrix3d_mm1(m, &xm);
+        dsp::init_matrix3d_translate(&xm, randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+        dsp::apply_matrix3d_mm1(m, &xm);
+
+        if (type == 1)
+        {
+            m->m[3]     = randf(-0.1f, 0.1f);
+            m->m[7]     = randf(-0.1f, 0.1f);
+            m->m[11]    = randf(-0.1f, 0.1f);
+        }
+        else if (type == 2)
+            m->m[15]    = 0.0f;
+    }
+
+    void init_points(dsp::point3d_t *p, float *x, float *y, float *z, size_t n)
+    {
+        for (size_t i=0; i<n; ++i)
+        {
+            dsp::init_point_xyz(&p[i], randf(-1.0f, 1.0f), randf(-1.0f, 1.0f), randf(-1.0f, 1.0f));
+            x[i]        = p[i].x;
+            y[i]        = p[i].y;
+            z[i]        = p[i].z;
+        }
+    }
+
+    void check_aos(const char *label, const dsp::point3d_t *p1, const dsp::point3d_t *p2, size_t n)
+    {
+        for (size_t i=0; i<n; ++i)
+        {
+            if (!point3d_ack(&p1[i], &p2[i], TOLERANCE))
+                UTEST_FAIL_MSG("Output of '%s' differs at index %d: {%f, %f, %f, %f} vs {%f, %f, %f, %f}",
+                    label, int(i),
+                    p1[i].x, p1[i].y, p1[i].z, p1[i].w,
+                    p2[i].x, p2[i].y, p2[i].z, p2[i].w);
+        }
+    }
+
+    void check_soa(const char *label, FloatBuffer &a, FloatBuffer &b)
+    {
+        UTEST_ASSERT_MSG(a.valid(), "Buffer 1 corrupted");
+        UTEST_ASSERT_MSG(b.valid(), "Buffer 2 corrupted");
+        if (!a.equals_adaptive(b, TOLERANCE))
+        {
+            a.dump("buf1 ");
+            b.dump("buf2 ");
+            UTEST_FAIL_MSG("Output of '%s' differs at index %d: %.6f vs %.6f",
+                label, int(a.last_diff()), a.get_diff(), b.get_diff());
+        }
+    }
+
+    void call(const char *label, apply_matrix3d_mpn_t func1, apply_matrix3d_mpn_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 100, 1001)
+        {
+            printf("Testing %s on %d points...\n", label, int(count));
+
+            dsp::point3d_t *src = new dsp::point3d_t[count * 3 + 3];
+            dsp::point3d_t *dst1 = &src[count + 1];
+            dsp::point3d_t *dst2 = &dst1[count + 1];
+            FloatBuffer tmp(count * 3);
+
+            for (size_t type=0; type < MATRICES; ++type)
+            {
+                dsp::matrix3d_t m;
+                init_matrix(&m, type);
+                init_points(src, tmp.data(0), tmp.data(count), tmp.data(count * 2), count);
+                dst1[count].w   = 123.0f;
+                dst2[count].w   = 123.0f;
+
+                func1(dst1, src, &m, count);
+                func2(dst2, src, &m, count);
+                check_aos(label, dst1, dst2, count);
+                UTEST_ASSERT_MSG(dst2[count].w == 123.0f, "Destination buffer overflow");
+
+                // In-place transform
+                func2(src, src, &m, count);
+                check_aos(label, dst1, src, count);
+            }
+
+            delete [] src;
+        }
+    }
+
+    void call(const char *label, apply_matrix3d_mvn_t func1, apply_matrix3d_mvn_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 100, 1001)
+        {
+            printf("Testing %s on %d vectors...\n", label, int(count));
+
+            dsp::point3d_t *src = new dsp::point3d_t[count * 3 + 3];
+            dsp::point3d_t *dst1 = &src[count + 1];
+            dsp::point3d_t *dst2 = &dst1[count + 1];
+            FloatBuffer tmp(count * 3);
+
+            for (size_t type=0; type < MATRICES; ++type)
+            {
+                dsp::matrix3d_t m;
+                init_matrix(&m, type);
+                init_points(src, tmp.data(0), tmp.data(count), tmp.data(count * 2), count);
+                for (size_t i=0; i<count; ++i)
+                    src[i].w        = 0.0f;
+                dst1[count].w   = 123.0f;
+                dst2[count].w   = 123.0f;
+
+                func1(reinterpret_cast<dsp::vector3d_t *>(dst1), reinterpret_cast<dsp::vector3d_t *>(src), &m, count);
+                func2(reinterpret_cast<dsp::vector3d_t *>(dst2), reinterpret_cast<dsp::vector3d_t *>(src), &m, count);
+                check_aos(label, dst1, dst2, count);
+                UTEST_ASSERT_MSG(dst2[count].w == 123.0f, "Destination buffer overflow");
+
+                // In-place transform
+                func2(reinterpret_cast<dsp::vector3d_t *>(src), reinterpret_cast<dsp::vector3d_t *>(src), &m, count);
+                check_aos(label, dst1, src, count);
+            }
+
+            delete [] src;
+        }
+    }
+
+    template <class soa_t, class func_t>
+        void call_soa(const char *label, bool point, func_t func1, func_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 100, 1001)
+        {
+            printf("Testing %s on %d elements...\n", label, int(count));
+
+            dsp::point3d_t *p   = new dsp::point3d_t[count * 2 + 1];
+            dsp::point3d_t *r   = &p[count];
+            FloatBuffer src(count * 3);
+            FloatBuffer dst1(count * 3);
+            FloatBuffer dst2(count * 3);
+            FloatBuffer dst3(count * 3);
+            soa_t s     = { src.data(0), src.data(count), src.data(count * 2) };
+            soa_t d1    = { dst1.data(0), dst1.data(count), dst1.data(count * 2) };
+            soa_t d2    = { dst2.data(0), dst2.data(count), dst2.data(count * 2) };
+
+            for (size_t type=0; type < MATRICES; ++type)
+            {
+                dsp::matrix3d_t m;
+                init_matrix(&m, type);
+                init_points(p, src.data(0), src.data(count), src.data(count * 2), count);
+
+                func1(&d1, &s, &m, count);
+                func2(&d2, &s, &m, count);
+                check_soa(label, dst1, dst2);
+
+                // The result should match the AoS transform
+                for (size_t i=0; i<count; ++i)
+                {
+                    if (point)
+                        dsp::apply_matrix3d_mp2(&r[i], &p[i], &m);
+                    else
+                    {
+                        p[i].w      = 0.0f;
+                        dsp::apply_matrix3d_mv2(reinterpret_cast<dsp::vector3d_t *>(&r[i]), reinterpret_cast<dsp::vector3d_t *>(&p[i]), &m);
+                    }
+                    dst3[i]             = r[i].x;
+                    dst3[i + count]     = r[i].y;
+                    dst3[i + count * 2] = r[i].z;
+                }
+                check_soa(label, dst3, dst2);
+
+                // In-place transform
+                func2(&s, &s, &m, count);
+                check_soa(label, dst1, src);
+            }
+
+            delete [] p;
+        }
+    }
+
+    void call(const char *label, apply_matrix3d_mv_soa_t func1, apply_matrix3d_mv_soa_t func2)
+    {
+        call_soa<dsp::vector3d_soa_t>(label, false, func1, func2);
+    }
+
+    void call(const char *label, apply_matrix3d_mp_soa_t func1, apply_matrix3d_mp_soa_t func2)
+    {
+        call_soa<dsp::point3d_soa_t>(label, true, func1, func2);
+    }
+
+    void call(const char *label, apply_matrix3d_mpn_bound_box_t func1, apply_matrix3d_mpn_bound_box_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 100, 1001)
+        {
+            printf("Testing %s on %d points...\n", label, int(count));
+
+            dsp::point3d_t *src = new dsp::point3d_t[count * 3];
+            dsp::point3d_t *dst1 = &src[count];
+            dsp::point3d_t *dst2 = &dst1[count];
+            FloatBuffer tmp(count * 3);
+
+            for (size_t type=0; type < MATRICES; ++type)
+            {
+                dsp::matrix3d_t m;
+                dsp::bound_box3d_t b1, b2, b3;
+                init_matrix(&m, type);
+                init_points(src, tmp.data(0), tmp.data(count), tmp.data(count * 2), count);
+
+                func1(&b1, dst1, src, &m, count);
+                func2(&b2, dst2, src, &m, count);
+                check_aos(label, dst1, dst2, count);
+                check_aos(label, b1.p, b2.p, 8);
+
+                // The result should match the separate transform and bounding box calculation
+                dsp::apply_matrix3d_mpn(dst1, src, &m, count);
+                dsp::calc_bound_box(&b3, dst1, count);
+                check_aos(label, b3.p, b2.p, 8);
+            }
+
+            delete [] src;
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(arch, func) \
+            call(#arch "::" #func, generic::func, arch::func)
+
+        IF_ARCH_X86(CALL(sse, apply_matrix3d_mvn));
+        IF_ARCH_X86(CALL(sse, apply_matrix3d_mpn));
+        IF_ARCH_X86(CALL(sse, apply_matrix3d_mv_soa));
+        IF_ARCH_X86(CALL(sse, apply_matrix3d_mp_soa));
+        IF_ARCH_X86(CALL(sse, apply_matrix3d_mpn_bound_box));
+
+        IF_ARCH_X86(CALL(avx, apply_matrix3d_mvn));
+        IF_ARCH_X86(CALL(avx, apply_matrix3d_mpn));
+        IF_ARCH_X86(CALL(avx, apply_matrix3d_mv_soa));
+        IF_ARCH_X86(CALL(avx, apply_matrix3d_mp_soa));
+
+        IF_ARCH_AARCH64(CALL(asimd, apply_matrix3d_mvn));
+        IF_ARCH_AARCH64(CALL(asimd, apply_matrix3d_mpn));
+        IF_ARCH_AARCH64(CALL(asimd, apply_matrix3d_mv_soa));
+        IF_ARCH_AARCH64(CALL(asimd, apply_matrix3d_mp_soa));
+        IF_ARCH_AARCH64(CALL(asimd, apply_matrix3d_mpn_bound_box));
+    }
+
+UTEST_END
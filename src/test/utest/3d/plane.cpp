@@ -33,6 +33,8 @@ namespace lsp
         float calc_plane_p3(dsp::vector3d_t *v, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
         float calc_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *pv);
         float calc_plane_v1p2(dsp::vector3d_t *v, const dsp::vector3d_t *v0, const dsp::point3d_t *p0, const dsp::point3d_t *p1);
+        float calc_oriented_plane_p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+        float calc_rev_oriented_plane_p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
     }
 
     IF_ARCH_X86(
@@ -41,12 +43,28 @@ namespace lsp
             float calc_plane_p3(dsp::vector3d_t *v, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
             float calc_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *pv);
             float calc_plane_v1p2(dsp::vector3d_t *v, const dsp::vector3d_t *v0, const dsp::point3d_t *p0, const dsp::point3d_t *p1);
+            float calc_oriented_plane_p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            float calc_oriented_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+            float calc_rev_oriented_plane_p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            float calc_rev_oriented_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            float calc_oriented_plane_p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            float calc_oriented_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
+            float calc_rev_oriented_plane_p3(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+            float calc_rev_oriented_plane_pv(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
         }
     )
 
     typedef float (* calc_plane_p3_t)(dsp::vector3d_t *v, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
     typedef float (* calc_plane_pv_t)(dsp::vector3d_t *v, const dsp::point3d_t *pv);
     typedef float (* calc_plane_v1p2_t)(dsp::vector3d_t *v, const dsp::vector3d_t *v0, const dsp::point3d_t *p0, const dsp::point3d_t *p1);
+    typedef float (* calc_oriented_plane_p3_t)(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *p0, const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+    typedef float (* calc_oriented_plane_pv_t)(dsp::vector3d_t *v, const dsp::point3d_t *sp, const dsp::point3d_t *pv);
 }
 
 UTEST_BEGIN("dsp.3d", plane)
@@ -163,11 +181,62 @@ UTEST_BEGIN("dsp.3d", plane)
         }
     }
 
+    void call(const char *label, calc_oriented_plane_p3_t ref,
+            calc_oriented_plane_p3_t f_p3, calc_oriented_plane_pv_t f_pv)
+    {
+        if ((!UTEST_SUPPORTED(f_p3)) || (!UTEST_SUPPORTED(f_pv)))
+            return;
+
+        printf("Testing %s...\n", label);
+
+        dsp::point3d_t sp, pv[3];
+        dsp::vector3d_t v1, v2, v3;
+
+        for (size_t i=0; i<0x200; ++i)
+        {
+            // Intialize points
+            dsp::init_point_xyz(&sp, randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+            for (size_t j=0; j<3; ++j)
+                dsp::init_point_xyz(&pv[j], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+
+            // Compute the value
+            float w1  = ref(&v1, &sp, &pv[0], &pv[1], &pv[2]);
+            float w2  = f_p3(&v2, &sp, &pv[0], &pv[1], &pv[2]);
+            float w3  = f_pv(&v3, &sp, pv);
+
+            if ((!float_equals_adaptive(w1, w2, DSP_3D_TOLERANCE)) ||
+                (!float_equals_adaptive(w1, w3, DSP_3D_TOLERANCE)) ||
+                (!vector3d_ack(&v1, &v2, TOLERANCE)) ||
+                (!vector3d_ack(&v1, &v3, TOLERANCE)))
+            {
+                dump_point("sp", &sp);
+                dump_point("pv[0]", &pv[0]);
+                dump_point("pv[1]", &pv[1]);
+                dump_point("pv[2]", &pv[2]);
+                dump_vector("v[0]", &v1);
+                dump_vector("v[1]", &v2);
+                dump_vector("v[2]", &v3);
+                printf("w[0] = %e, w[1] = %e, w[2] = %e\n", w1, w2, w3);
+                UTEST_FAIL_MSG("result of functions differ");
+            }
+        }
+    }
+
     UTEST_MAIN
     {
         IF_ARCH_X86(call("sse::calc_plane_p3", sse::calc_plane_p3));
         IF_ARCH_X86(call("sse::calc_plane_pv", sse::calc_plane_pv));
         IF_ARCH_X86(call("sse::calc_plane_v1p2", sse::calc_plane_v1p2));
+
+        #define CALL_ORIENTED(arch, func) \
+            call(#arch "::" #func, generic::func##_p3, arch::func##_p3, arch::func##_pv)
+
+        IF_ARCH_X86(CALL_ORIENTED(sse, calc_oriented_plane));
+        IF_ARCH_X86(CALL_ORIENTED(sse, calc_rev_oriented_plane));
+        IF_ARCH_AARCH64(CALL_ORIENTED(asimd, calc_oriented_plane));
+        IF_ARCH_AARCH64(CALL_ORIENTED(asimd, calc_rev_oriented_plane));
+
+        #undef CALL_ORIENTED
     }
 UTEST_END;
 
@@ -0,0 +1,436 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <string.h>
+
+#define TOLERANCE       1e-5f
+
+namespace lsp
+{
+    namespace generic
+    {
+        float calc_distance_p2(const dsp::point3d_t *p1, const dsp::point3d_t *p2);
+        float calc_area_pv(const dsp::point3d_t *pv);
+        void calc_normal3d_pv(dsp::vector3d_t *n, const dsp::point3d_t *pv);
+        size_t colocation_x3_v1pv(const dsp::vector3d_t *pl, const dsp::point3d_t *pv);
+
+        void points3d_to_soa(const dsp::point3d_soa_t *dst, const dsp::point3d_t *src, size_t n);
+        void points3d_from_soa(dsp::point3d_t *dst, const dsp::point3d_soa_t *src, size_t n);
+        void raw_triangles_to_soa(const dsp::raw_triangle_soa_t *dst, const dsp::raw_triangle_t *src, size_t n);
+        void raw_triangles_from_soa(dsp::raw_triangle_t *dst, const dsp::raw_triangle_soa_t *src, size_t n);
+        void calc_distance_soa(float *dst, const dsp::point3d_soa_t *p1, const dsp::point3d_soa_t *p2, size_t n);
+        void calc_area_soa(float *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+        void calc_normal3d_soa(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+        void colocation_x3_v1_soa(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void points3d_to_soa(const dsp::point3d_soa_t *dst, const dsp::point3d_t *src, size_t n);
+            void points3d_from_soa(dsp::point3d_t *dst, const dsp::point3d_soa_t *src, size_t n);
+            void raw_triangles_to_soa(const dsp::raw_triangle_soa_t *dst, const dsp::raw_triangle_t *src, size_t n);
+            void raw_triangles_from_soa(dsp::raw_triangle_t *dst, const dsp::raw_triangle_soa_t *src, size_t n);
+            void calc_distance_soa(float *dst, const dsp::point3d_soa_t *p1, const dsp::point3d_soa_t *p2, size_t n);
+            void calc_area_soa(float *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void calc_normal3d_soa(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void colocation_x3_v1_soa(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n);
+        }
+
+        namespace avx
+        {
+            void calc_distance_soa(float *dst, const dsp::point3d_soa_t *p1, const dsp::point3d_soa_t *p2, size_t n);
+            void calc_area_soa(float *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void calc_normal3d_soa(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void colocation_x3_v1_soa(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void points3d_to_soa(const dsp::point3d_soa_t *dst, const dsp::point3d_t *src, size_t n);
+            void points3d_from_soa(dsp::point3d_t *dst, const dsp::point3d_soa_t *src, size_t n);
+            void raw_triangles_to_soa(const dsp::raw_triangle_soa_t *dst, const dsp::raw_triangle_t *src, size_t n);
+            void raw_triangles_from_soa(dsp::raw_triangle_t *dst, const dsp::raw_triangle_soa_t *src, size_t n);
+            void calc_distance_soa(float *dst, const dsp::point3d_soa_t *p1, const dsp::point3d_soa_t *p2, size_t n);
+            void calc_area_soa(float *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void calc_normal3d_soa(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+            void colocation_x3_v1_soa(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n);
+        }
+    )
+
+    typedef void (* points3d_to_soa_t)(const dsp::point3d_soa_t *dst, const dsp::point3d_t *src, size_t n);
+    typedef void (* points3d_from_soa_t)(dsp::point3d_t *dst, const dsp::point3d_soa_t *src, size_t n);
+    typedef void (* raw_triangles_to_soa_t)(const dsp::raw_triangle_soa_t *dst, const dsp::raw_triangle_t *src, size_t n);
+    typedef void (* raw_triangles_from_soa_t)(dsp::raw_triangle_t *dst, const dsp::raw_triangle_soa_t *src, size_t n);
+    typedef void (* calc_distance_soa_t)(float *dst, const dsp::point3d_soa_t *p1, const dsp::point3d_soa_t *p2, size_t n);
+    typedef void (* calc_area_soa_t)(float *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+    typedef void (* calc_normal3d_soa_t)(dsp::vector3d_soa_t *dst, const dsp::raw_triangle_soa_t *t, size_t n);
+    typedef void (* colocation_x3_v1_soa_t)(uint32_t *dst, const dsp::vector3d_t *pl, const dsp::raw_triangle_soa_t *t, size_t n);
+}
+
+UTEST_BEGIN("dsp.3d", soa)
+
+    static void bind_points(dsp::point3d_soa_t *p, FloatBuffer &buf, size_t count)
+    {
+        p->x        = buf.data(0);
+        p->y        = buf.data(count);
+        p->z        = buf.data(count * 2);
+    }
+
+    static void bind_triangles(dsp::raw_triangle_soa_t *t, FloatBuffer &buf, size_t count)
+    {
+        for (size_t i=0; i<3; ++i)
+        {
+            t->v[i].x   = buf.data((i*3 + 0) * count);
+            t->v[i].y   = buf.data((i*3 + 1) * count);
+            t->v[i].z   = buf.data((i*3 + 2) * count);
+        }
+    }
+
+    static void init_points(dsp::point3d_t *p, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            dsp::init_point_xyz(&p[i], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+            p[i].w      = randf(-1.0f, 1.0f);
+        }
+    }
+
+    void check_buffers(const char *label, FloatBuffer &a, FloatBuffer &b)
+    {
+        UTEST_ASSERT_MSG(a.valid(), "Buffer 1 corrupted");
+        UTEST_ASSERT_MSG(b.valid(), "Buffer 2 corrupted");
+        if (!a.equals_adaptive(b, TOLERANCE))
+        {
+            a.dump("buf1 ");
+            b.dump("buf2 ");
+            UTEST_FAIL_MSG("Output of '%s' differs at index %d: %.6f vs %.6f",
+                label, int(a.last_diff()), a.get_diff(), b.get_diff());
+        }
+    }
+
+    void check_points(const char *label, const dsp::point3d_t *p1, const dsp::point3d_t *p2, size_t count)
+    {
+        if (memcmp(p1, p2, count * sizeof(dsp::point3d_t)) == 0)
+            return;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            if (memcmp(&p1[i], &p2[i], sizeof(dsp::point3d_t)) != 0)
+                UTEST_FAIL_MSG("Output of '%s' differs at index %d: {%f, %f, %f, %f} vs {%f, %f, %f, %f}",
+                    label, int(i),
+                    p1[i].x, p1[i].y, p1[i].z, p1[i].w,
+                    p2[i].x, p2[i].y, p2[i].z, p2[i].w);
+        }
+    }
+
+    void call(const char *label, points3d_to_soa_t to_soa, points3d_from_soa_t from_soa)
+    {
+        if (!UTEST_SUPPORTED(to_soa))
+            return;
+        if (!UTEST_SUPPORTED(from_soa))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 100, 1001)
+        {
+            printf("Testing %s on %d points...\n", label, int(count));
+
+            dsp::point3d_t *src     = new dsp::point3d_t[count * 3 + 2];
+            dsp::point3d_t *dst1    = &src[count];
+            dsp::point3d_t *dst2    = &dst1[count + 1];
+            FloatBuffer b1(count * 3), b2(count * 3);
+            dsp::point3d_soa_t s1, s2;
+
+            init_points(src, count);
+            bind_points(&s1, b1, count);
+            bind_points(&s2, b2, count);
+            dst1[count].w   = 123.0f;
+            dst2[count].w   = 123.0f;
+
+            generic::points3d_to_soa(&s1, src, count);
+            to_soa(&s2, src, count);
+            check_buffers(label, b1, b2);
+
+            generic::points3d_from_soa(dst1, &s1, count);
+            from_soa(dst2, &s2, count);
+            check_points(label, dst1, dst2, count);
+            UTEST_ASSERT_MSG(dst2[count].w == 123.0f, "Destination buffer overflow");
+
+            // Round trip should restore coordinates and set w = 1
+            for (size_t i=0; i<count; ++i)
+            {
+                UTEST_ASSERT_MSG((dst2[i].x == src[i].x) && (dst2[i].y == src[i].y) && (dst2[i].z == src[i].z),
+                    "Coordinates of point %d have not been restored", int(i));
+                UTEST_ASSERT_MSG(dst2[i].w == 1.0f, "W component of point %d is not 1", int(i));
+            }
+
+            delete [] src;
+        }
+    }
+
+    void call(const char *label, raw_triangles_to_soa_t to_soa, raw_triangles_from_soa_t from_soa)
+    {
+        if (!UTEST_SUPPORTED(to_soa))
+            return;
+        if (!UTEST_SUPPORTED(from_soa))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 100, 1001)
+        {
+            printf("Testing %s on %d triangles...\n", label, int(count));
+
+            dsp::raw_triangle_t *src    = new dsp::raw_triangle_t[count * 3 + 2];
+            dsp::raw_triangle_t *dst1   = &src[count];
+            dsp::raw_triangle_t *dst2   = &dst1[count + 1];
+            FloatBuffer b1(count * 9), b2(count * 9);
+            dsp::raw_triangle_soa_t s1, s2;
+
+            init_points(src->v, count * 3);
+            bind_triangles(&s1, b1, count);
+            bind_triangles(&s2, b2, count);
+            dst1[count].v[0].x  = 123.0f;
+            dst2[count].v[0].x  = 123.0f;
+
+            generic::raw_triangles_to_soa(&s1, src, count);
+            to_soa(&s2, src, count);
+            check_buffers(label, b1, b2);
+
+            generic::raw_triangles_from_soa(dst1, &s1, count);
+            from_soa(dst2, &s2, count);
+            check_points(label, dst1->v, dst2->v, count * 3);
+            UTEST_ASSERT_MSG(dst2[count].v[0].x == 123.0f, "Destination buffer overflow");
+
+            delete [] src;
+        }
+    }
+
+    void call(const char *label, calc_distance_soa_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 100, 1001)
+        {
+            printf("Testing %s on %d points...\n", label, int(count));
+
+            dsp::point3d_t *p       = new dsp::point3d_t[count * 2];
+            FloatBuffer src(count * 6);
+            FloatBuffer dst1(count), dst2(count);
+            dsp::point3d_soa_t p1, p2;
+
+            init_points(p, count * 2);
+            p1.x = src.data(0);         p1.y = src.data(count);     p1.z = src.data(count * 2);
+            p2.x = src.data(count * 3); p2.y = src.data(count * 4); p2.z = src.data(count * 5);
+            generic::points3d_to_soa(&p1, p, count);
+            generic::points3d_to_soa(&p2, &p[count], count);
+
+            generic::calc_distance_soa(dst1, &p1, &p2, count);
+            func(dst2, &p1, &p2, count);
+            check_buffers(label, dst1, dst2);
+
+            // The result should be the same to the AoS function
+            for (size_t i=0; i<count; ++i)
+            {
+                float d = generic::calc_distance_p2(&p[i], &p[count + i]);
+                UTEST_ASSERT_MSG(float_equals_adaptive(d, dst2[i], TOLERANCE),
+                    "Distance %d differs from calc_distance_p2(): %f vs %f", int(i), d, dst2[i]);
+            }
+
+            delete [] p;
+        }
+    }
+
+    void call(const char *label, calc_area_soa_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 100, 1001)
+        {
+            printf("Testing %s on %d triangles...\n", label, int(count));
+
+            dsp::raw_triangle_t *t  = new dsp::raw_triangle_t[count];
+            FloatBuffer src(count * 9);
+            FloatBuffer dst1(count), dst2(count);
+            dsp::raw_triangle_soa_t st;
+
+            init_points(t->v, count * 3);
+            bind_triangles(&st, src, count);
+            generic::raw_triangles_to_soa(&st, t, count);
+
+            generic::calc_area_soa(dst1, &st, count);
+            func(dst2, &st, count);
+            check_buffers(label, dst1, dst2);
+
+            for (size_t i=0; i<count; ++i)
+            {
+                float a = generic::calc_area_pv(t[i].v);
+                UTEST_ASSERT_MSG(float_equals_adaptive(a, dst2[i], TOLERANCE),
+                    "Area %d differs from calc_area_pv(): %f vs %f", int(i), a, dst2[i]);
+            }
+
+            delete [] t;
+        }
+    }
+
+    void call(const char *label, calc_normal3d_soa_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 100, 1001)
+        {
+            printf("Testing %s on %d triangles...\n", label, int(count));
+
+            dsp::raw_triangle_t *t  = new dsp::raw_triangle_t[count];
+            FloatBuffer src(count * 9);
+            FloatBuffer dst1(count * 3), dst2(count * 3);
+            dsp::raw_triangle_soa_t st;
+            dsp::vector3d_soa_t n1, n2;
+
+            init_points(t->v, count * 3);
+            // Add degenerate triangles
+            for (size_t i=0; i<count; i += 5)
+                t[i].v[2] = t[i].v[1] = t[i].v[0];
+
+            bind_triangles(&st, src, count);
+            generic::raw_triangles_to_soa(&st, t, count);
+            n1.dx = dst1.data(0); n1.dy = dst1.data(count); n1.dz = dst1.data(count * 2);
+            n2.dx = dst2.data(0); n2.dy = dst2.data(count); n2.dz = dst2.data(count * 2);
+
+            generic::calc_normal3d_soa(&n1, &st, count);
+            func(&n2, &st, count);
+            check_buffers(label, dst1, dst2);
+
+            for (size_t i=0; i<count; ++i)
+            {
+                dsp::vector3d_t n;
+                generic::calc_normal3d_pv(&n, t[i].v);
+                UTEST_ASSERT_MSG(
+                    float_equals_adaptive(n.dx, n2.dx[i], TOLERANCE) &&
+                    float_equals_adaptive(n.dy, n2.dy[i], TOLERANCE) &&
+                    float_equals_adaptive(n.dz, n2.dz[i], TOLERANCE),
+                    "Normal %d differs from calc_normal3d_pv(): {%f, %f, %f} vs {%f, %f, %f}",
+                    int(i), n.dx, n.dy, n.dz, n2.dx[i], n2.dy[i], n2.dz[i]);
+            }
+
+            delete [] t;
+        }
+    }
+
+    void call(const char *label, colocation_x3_v1_soa_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 100, 1001)
+        {
+            printf("Testing %s on %d triangles...\n", label, int(count));
+
+            dsp::raw_triangle_t *t  = new dsp::raw_triangle_t[count];
+            uint32_t *dst1          = new uint32_t[count * 2 + 1];
+            uint32_t *dst2          = &dst1[count];
+            FloatBuffer src(count * 9);
+            dsp::raw_triangle_soa_t st;
+            dsp::vector3d_t pl;
+
+            dsp::init_normal3d_dxyz(&pl, randf(-1.0f, 1.0f), randf(-1.0f, 1.0f), randf(-1.0f, 1.0f));
+            pl.dw       = randf(-1.0f, 1.0f);
+
+            // Put some vertexes on the plane
+            init_points(t->v, count * 3);
+            for (size_t i=0; i<count*3; ++i)
+            {
+                dsp::point3d_t *p   = &t->v[i];
+                p->w                = 1.0f;
+                if ((i % 3) != 0)
+                    continue;
+                float k             = p->x * pl.dx + p->y * pl.dy + p->z * pl.dz + pl.dw;
+                p->x               -= k * pl.dx;
+                p->y               -= k * pl.dy;
+                p->z               -= k * pl.dz;
+            }
+
+            bind_triangles(&st, src, count);
+            generic::raw_triangles_to_soa(&st, t, count);
+            dst2[count]     = 0xdeadbeef;
+
+            generic::colocation_x3_v1_soa(dst1, &pl, &st, count);
+            func(dst2, &pl, &st, count);
+            UTEST_ASSERT_MSG(dst2[count] == 0xdeadbeef, "Destination buffer overflow");
+
+            for (size_t i=0; i<count; ++i)
+            {
+                size_t tag = generic::colocation_x3_v1pv(&pl, t[i].v);
+                UTEST_ASSERT_MSG(dst1[i] == dst2[i],
+                    "Output of '%s' differs at index %d: 0x%02x vs 0x%02x", label, int(i), int(dst1[i]), int(dst2[i]));
+                UTEST_ASSERT_MSG(tag == dst2[i],
+                    "Tag %d differs from colocation_x3_v1pv(): 0x%02x vs 0x%02x", int(i), int(tag), int(dst2[i]));
+            }
+
+            delete [] dst1;
+            delete [] t;
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(arch, func) \
+            call(#arch "::" #func, arch::func)
+        #define CALL2(arch, func1, func2) \
+            call(#arch "::" #func1, arch::func1, arch::func2)
+
+        CALL2(generic, points3d_to_soa, points3d_from_soa);
+        CALL2(generic, raw_triangles_to_soa, raw_triangles_from_soa);
+        CALL(generic, calc_distance_soa);
+        CALL(generic, calc_area_soa);
+        CALL(generic, calc_normal3d_soa);
+        CALL(generic, colocation_x3_v1_soa);
+
+        IF_ARCH_X86(CALL2(sse, points3d_to_soa, points3d_from_soa));
+        IF_ARCH_X86(CALL2(sse, raw_triangles_to_soa, raw_triangles_from_soa));
+        IF_ARCH_X86(CALL(sse, calc_distance_soa));
+        IF_ARCH_X86(CALL(sse, calc_area_soa));
+        IF_ARCH_X86(CALL(sse, calc_normal3d_soa));
+        IF_ARCH_X86(CALL(sse, colocation_x3_v1_soa));
+
+        IF_ARCH_X86(CALL(avx, calc_distance_soa));
+        IF_ARCH_X86(CALL(avx, calc_area_soa));
+        IF_ARCH_X86(CALL(avx, calc_normal3d_soa));
+        IF_ARCH_X86(CALL(avx, colocation_x3_v1_soa));
+
+        IF_ARCH_AARCH64(CALL2(asimd, points3d_to_soa, points3d_from_soa));
+        IF_ARCH_AARCH64(CALL2(asimd, raw_triangles_to_soa, raw_triangles_from_soa));
+        IF_ARCH_AARCH64(CALL(asimd, calc_distance_soa));
+        IF_ARCH_AARCH64(CALL(asimd, calc_area_soa));
+        IF_ARCH_AARCH64(CALL(asimd, calc_normal3d_soa));
+        IF_ARCH_AARCH64(CALL(asimd, colocation_x3_v1_soa));
+    }
+
+UTEST_END
@@ -22,6 +22,9 @@
 #include <lsp-plug.in/common/types.h>
 #include <lsp-plug.in/dsp/dsp.h>
 #include <lsp-plug.in/test-fw/utest.h>
+#include <private/utest/dsp/3d/helpers.h>
+
+#define TOLERANCE       1e-4f
 
 namespace lsp
 {
@@ -30,6 +33,9 @@ namespace lsp
         float check_point3d_on_triangle_p3p(const dsp::point3d_t *p1, const dsp::point3d_t *p2, const dsp::point3d_t *p3, const dsp::point3d_t *p);
         float check_point3d_on_triangle_pvp(const dsp::point3d_t *pv, const dsp::point3d_t *p);
         float check_point3d_on_triangle_tp(const dsp::triangle3d_t *t, const dsp::point3d_t *p);
+        void calc_triangle3d_p3(dsp::triangle3d_t *t, const dsp::point3d_t *p1, const dsp::point3d_t *p2, const dsp::point3d_t *p3);
+        void calc_triangle3d_pv(dsp::triangle3d_t *t, const dsp::point3d_t *p);
+        void calc_triangle3d(dsp::triangle3d_t *dst, const dsp::triangle3d_t *src);
     }
 
     IF_ARCH_X86(
@@ -38,12 +44,27 @@ namespace lsp
             float check_point3d_on_triangle_p3p(const dsp::point3d_t *p1, const dsp::point3d_t *p2, const dsp::point3d_t *p3, const dsp::point3d_t *p);
             float check_point3d_on_triangle_pvp(const dsp::point3d_t *pv, const dsp::point3d_t *p);
             float check_point3d_on_triangle_tp(const dsp::triangle3d_t *t, const dsp::point3d_t *p);
+            void calc_triangle3d_p3(dsp::triangle3d_t *t, const dsp::point3d_t *p1, const dsp::point3d_t *p2, const dsp::point3d_t *p3);
+            void calc_triangle3d_pv(dsp::triangle3d_t *t, const dsp::point3d_t *p);
+            void calc_triangle3d(dsp::triangle3d_t *dst, const dsp::triangle3d_t *src);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void calc_triangle3d_p3(dsp::triangle3d_t *t, const dsp::point3d_t *p1, const dsp::point3d_t *p2, const dsp::point3d_t *p3);
+            void calc_triangle3d_pv(dsp::triangle3d_t *t, const dsp::point3d_t *p);
+            void calc_triangle3d(dsp::triangle3d_t *dst, const dsp::triangle3d_t *src);
         }
     )
 
     typedef float (* check_point3d_on_triangle_p3p_t)(const dsp::point3d_t *p1, const dsp::point3d_t *p2, const dsp::point3d_t *p3, const dsp::point3d_t *p);
     typedef float (* check_point3d_on_triangle_pvp_t)(const dsp::point3d_t *pv, const dsp::point3d_t *p);
     typedef float (* check_point3d_on_triangle_tp_t)(const dsp::triangle3d_t *t, const dsp::point3d_t *p);
+    typedef void (* calc_triangle3d_p3_t)(dsp::triangle3d_t *t, const dsp::point3d_t *p1, const dsp::point3d_t *p2, const dsp::point3d_t *p3);
+    typedef void (* calc_triangle3d_pv_t)(dsp::triangle3d_t *t, const dsp::point3d_t *p);
+    typedef void (* calc_triangle3d_t)(dsp::triangle3d_t *dst, const dsp::triangle3d_t *src);
 }
 
 UTEST_BEGIN("dsp.3d", triangle)
@@ -129,6 +150,60 @@ UTEST_BEGIN("dsp.3d", triangle)
         }
     }
 
+    void check_triangle(const char *label, const dsp::triangle3d_t *t1, const dsp::triangle3d_t *t2)
+    {
+        for (size_t i=0; i<3; ++i)
+        {
+            if (!point3d_ack(&t1->p[i], &t2->p[i], TOLERANCE))
+            {
+                dump_point("p1", &t1->p[i]);
+                dump_point("p2", &t2->p[i]);
+                UTEST_FAIL_MSG("Result of %s differs at point %d", label, int(i));
+            }
+        }
+
+        if (!vector3d_ack(&t1->n, &t2->n, TOLERANCE))
+        {
+            dump_vector("n1", &t1->n);
+            dump_vector("n2", &t2->n);
+            UTEST_FAIL_MSG("Result of %s differs at normal", label);
+        }
+    }
+
+    void call(const char *label,
+        calc_triangle3d_p3_t calc_triangle3d_p3,
+        calc_triangle3d_pv_t calc_triangle3d_pv,
+        calc_triangle3d_t calc_triangle3d
+    )
+    {
+        if ((!UTEST_SUPPORTED(calc_triangle3d_p3)) ||
+            (!UTEST_SUPPORTED(calc_triangle3d_pv)) ||
+            (!UTEST_SUPPORTED(calc_triangle3d)))
+            return;
+
+        printf("Testing %s...\n", label);
+
+        dsp::point3d_t p[3];
+        dsp::triangle3d_t t1, t2;
+
+        for (size_t i=0; i<0x200; ++i)
+        {
+            for (size_t j=0; j<3; ++j)
+                dsp::init_point_xyz(&p[j], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+
+            generic::calc_triangle3d_p3(&t1, &p[0], &p[1], &p[2]);
+            calc_triangle3d_p3(&t2, &p[0], &p[1], &p[2]);
+            check_triangle("calc_triangle3d_p3", &t1, &t2);
+
+            calc_triangle3d_pv(&t2, p);
+            check_triangle("calc_triangle3d_pv", &t1, &t2);
+
+            calc_triangle3d(&t2, &t1);
+            generic::calc_triangle3d(&t1, &t1);
+            check_triangle("calc_triangle3d", &t1, &t2);
+        }
+    }
+
     UTEST_MAIN
     {
         call("generic::ck_triangle",
@@ -144,6 +219,9 @@ UTEST_BEGIN("dsp.3d", triangle)
                     sse::check_point3d_on_triangle_tp
                     );
         )
+
+        IF_ARCH_X86(call("sse::calc_triangle3d", sse::calc_triangle3d_p3, sse::calc_triangle3d_pv, sse::calc_triangle3d));
+        IF_ARCH_AARCH64(call("asimd::calc_triangle3d", asimd::calc_triangle3d_p3, asimd::calc_triangle3d_pv, asimd::calc_triangle3d));
     }
 
 UTEST_END
@@ -31,6 +31,8 @@ namespace lsp
         void init_vector_dxyz(dsp::vector3d_t *v, float dx, float dy, float dz);
         void init_vector(dsp::vector3d_t *p, const dsp::vector3d_t *s);
         void normalize_vector(dsp::vector3d_t *v);
+        void vector_mul_v2(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2);
+        void vector_mul_vv(dsp::vector3d_t *r, const dsp::vector3d_t *vv);
     }
 
     IF_ARCH_X86(
@@ -39,12 +41,24 @@ namespace lsp
             void init_vector_dxyz(dsp::vector3d_t *v, float dx, float dy, float dz);
             void init_vector(dsp::vector3d_t *p, const dsp::vector3d_t *s);
             void normalize_vector(dsp::vector3d_t *v);
+            void vector_mul_v2(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2);
+            void vector_mul_vv(dsp::vector3d_t *r, const dsp::vector3d_t *vv);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void vector_mul_v2(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2);
+            void vector_mul_vv(dsp::vector3d_t *r, const dsp::vector3d_t *vv);
         }
     )
 
     typedef void (* init_vector_dxyz_t)(dsp::vector3d_t *v, float dx, float dy, float dz);
     typedef void (* init_vector_t)(dsp::vector3d_t *p, const dsp::vector3d_t *s);
     typedef void (* normalize_vector_t)(dsp::vector3d_t *v);
+    typedef void (* vector_mul_v2_t)(dsp::vector3d_t *r, const dsp::vector3d_t *v1, const dsp::vector3d_t *v2);
+    typedef void (* vector_mul_vv_t)(dsp::vector3d_t *r, const dsp::vector3d_t *vv);
 }
 
 UTEST_BEGIN("dsp.3d", vector)
@@ -78,9 +92,34 @@ UTEST_BEGIN("dsp.3d", vector)
         UTEST_ASSERT_MSG(vector3d_sck(&v2, &v3), "Failed normalize vector");
     }
 
+    void call(const char *label, vector_mul_v2_t mul_v2, vector_mul_vv_t mul_vv)
+    {
+        if ((!UTEST_SUPPORTED(mul_v2)) || (!UTEST_SUPPORTED(mul_vv)))
+            return;
+
+        printf("Testing %s\n", label);
+
+        dsp::vector3d_t v[2], r1, r2;
+
+        for (size_t i=0; i<0x200; ++i)
+        {
+            for (size_t j=0; j<2; ++j)
+                dsp::init_vector_dxyz(&v[j], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+
+            generic::vector_mul_v2(&r1, &v[0], &v[1]);
+            mul_v2(&r2, &v[0], &v[1]);
+            UTEST_ASSERT_MSG(vector3d_ack(&r1, &r2), "Failed vector_mul_v2");
+
+            mul_vv(&r2, v);
+            UTEST_ASSERT_MSG(vector3d_ack(&r1, &r2), "Failed vector_mul_vv");
+        }
+    }
+
     UTEST_MAIN
     {
         IF_ARCH_X86(call("sse_vector", sse::init_vector_dxyz, sse::init_vector, sse::normalize_vector));
+        IF_ARCH_X86(call("sse::vector_mul", sse::vector_mul_v2, sse::vector_mul_vv));
+        IF_ARCH_AARCH64(call("asimd::vector_mul", asimd::vector_mul_v2, asimd::vector_mul_vv));
     }
 UTEST_END;
 
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        uint32_t denormal_mode();
+        uint32_t denormal_sample();
+    }
+
+    // Produce the result that underflows the single precision
+    static float underflow(float a, float b)
+    {
+        volatile float va   = a;
+        volatile float vb   = b;
+        volatile float res  = va * vb;
+        return res;
+    }
+
+    // Perform the operation with the denormal operand
+    static float denormal_input(float a)
+    {
+        volatile float va   = a;
+        volatile float vb   = 1.0f;
+        volatile float res  = va * vb;
+        return res;
+    }
+}
+
+UTEST_BEGIN("dsp", context)
+
+    // x86 raises the denormal operand flag only while DAZ mode is off
+    void check_x86_denormal_input()
+    {
+        if (dsp::denormal_mode() & dsp::DENORMAL_DAZ)
+            return;
+
+        dsp::denormal_sample();
+        float res = denormal_input(1e-40f);
+        UTEST_ASSERT_MSG(res != 0.0f, "Denormal operand has been flushed without DAZ mode");
+
+        uint32_t flags = dsp::denormal_sample();
+        UTEST_ASSERT_MSG(flags & dsp::DENORMAL_INPUT, "Denormal operand has not been detected: 0x%x", int(flags));
+    }
+
+    UTEST_MAIN
+    {
+        IF_ARCH_X86(check_x86_denormal_input());
+
+        UTEST_ASSERT(generic::denormal_mode() == 0);
+        UTEST_ASSERT(generic::denormal_sample() == 0);
+
+        // Check the guard without sampling
+        {
+            dsp::context_guard_t guard;
+            UTEST_ASSERT(!guard.sampling());
+
+            underflow(1e-30f, 1e-20f);
+            UTEST_ASSERT(guard.sample() == 0);
+            UTEST_ASSERT(guard.samples() == 0);
+        }
+
+        // Check the guard with sampling
+        dsp::context_guard_t guard(true);
+        uint32_t mode = guard.mode();
+        printf("Denormal mode: 0x%x\n", int(mode));
+        if (mode == 0)
+        {
+            printf("Denormal flags are not supported by the architecture, skipping\n");
+            return;
+        }
+
+        UTEST_ASSERT_MSG(mode & dsp::DENORMAL_FTZ, "Flush-to-zero mode is not enabled");
+        UTEST_ASSERT(guard.sampling());
+        UTEST_ASSERT(guard.sample() == 0);
+
+        float res = underflow(1e-30f, 1e-20f);
+        UTEST_ASSERT_MSG(res == 0.0f, "Denormal result has not been flushed: %g", res);
+
+        uint32_t flags = guard.sample();
+        UTEST_ASSERT_MSG(flags & dsp::DENORMAL_OUTPUT, "Underflow has not been detected: 0x%x", int(flags));
+        UTEST_ASSERT_MSG(guard.sample() == 0, "Denormal flags have not been reset");
+
+        UTEST_ASSERT(guard.samples() == 3);
+        UTEST_ASSERT(guard.events() == 1);
+        UTEST_ASSERT(guard.flags() & dsp::DENORMAL_OUTPUT);
+
+        // Denormal operand is flushed, ARM reports it while x86 in DAZ mode does not
+        bool input      = true;
+        IF_ARCH_X86(input = false);
+
+        res             = denormal_input(1e-40f);
+        UTEST_ASSERT_MSG(res == 0.0f, "Denormal operand has not been flushed: %g", res);
+
+        flags           = guard.sample();
+        if (input)
+        {
+            UTEST_ASSERT_MSG(flags & dsp::DENORMAL_INPUT, "Denormal operand has not been detected: 0x%x", int(flags));
+        }
+        else
+        {
+            UTEST_ASSERT_MSG(!(flags & dsp::DENORMAL_INPUT), "Denormal operand has been detected in DAZ mode: 0x%x", int(flags));
+        }
+    }
+
+UTEST_END
@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#define TOLERANCE       1e-4f
+#define MAX_BANDS       LSP_DSP_CROSSOVER_MAX_BANDS
+
+namespace lsp
+{
+    namespace generic
+    {
+        void crossover_init(dsp::crossover_t *c, const dsp::crossover_params_t *p);
+        void crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c);
+    }
+
+    IF_ARCH_X86_64(
+        namespace sse3
+        {
+            void x64_crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c);
+        }
+
+        namespace avx
+        {
+            void x64_crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void crossover_process(float **dst, const float *src, size_t count, dsp::crossover_t *c);
+        }
+    )
+
+    typedef void (* crossover_process_t)(float **dst, const float *src, size_t count, dsp::crossover_t *c);
+}
+
+namespace
+{
+    // Split frequencies at 48 kHz sample rate
+    const float split_freq[MAX_BANDS - 1] =
+    {
+        80.0f / 48000.0f,
+        250.0f / 48000.0f,
+        600.0f / 48000.0f,
+        1500.0f / 48000.0f,
+        3500.0f / 48000.0f,
+        8000.0f / 48000.0f,
+        14000.0f / 48000.0f
+    };
+
+    void init_params(lsp::dsp::crossover_params_t *p, size_t bands, lsp::dsp::crossover_type_t type, bool phase)
+    {
+        p->type         = type;
+        p->bands        = bands;
+        p->phase        = (phase) ? 1 : 0;
+
+        // Take split frequencies evenly from the list
+        for (size_t i=0; i<bands-1; ++i)
+            p->freq[i]      = split_freq[(i * (MAX_BANDS - 1)) / (bands - 1)];
+    }
+}
+
+UTEST_BEGIN("dsp", crossover)
+
+    // Check the allpass property of the crossover and the level of the split
+    void check_reference()
+    {
+        size_t count = 0x8000;
+        FloatBuffer src(count);
+        FloatBuffer sum(count);
+        FloatBuffer *dst[MAX_BANDS];
+        float *vd[MAX_BANDS];
+        dsp::crossover_params_t p;
+        dsp::crossover_t c;
+
+        for (size_t i=0; i<MAX_BANDS; ++i)
+        {
+            dst[i]          = new FloatBuffer(count);
+            vd[i]           = dst[i]->data();
+        }
+
+        UTEST_FOREACH(bands, 2, 3, 4, 5, 6, 7, 8)
+        {
+            for (size_t type=dsp::CROSSOVER_LR4; type <= dsp::CROSSOVER_LR8; ++type)
+            {
+                printf("Testing allpass response of %d-band %s crossover\n",
+                    int(bands), (type == dsp::CROSSOVER_LR8) ? "LR8" : "LR4");
+
+                // The sum of all bands should preserve the energy of the impulse
+                init_params(&p, bands, dsp::crossover_type_t(type), true);
+                generic::crossover_init(&c, &p);
+                UTEST_ASSERT_MSG(c.stages <= LSP_DSP_CROSSOVER_MAX_STAGES, "Too many stages: %d", int(c.stages));
+
+                src.fill_zero();
+                src[0]          = 1.0f;
+                generic::crossover_process(vd, src, count, &c);
+
+                sum.fill_zero();
+                for (size_t i=0; i<bands; ++i)
+                    dsp::add2(sum, vd[i], count);
+                float e         = dsp::h_sqr_sum(sum, count);
+                UTEST_ASSERT_MSG(fabsf(e - 1.0f) < 1e-3f, "Energy of the sum of bands is %.6f", e);
+
+                // The sine wave at the frequency of the first split should be at -6 dB in both bands
+                float w         = 2.0f * M_PI * p.freq[0];
+                for (size_t i=0; i<count; ++i)
+                    src[i]          = sinf(w * i);
+                generic::crossover_init(&c, &p);
+                generic::crossover_process(vd, src, count, &c);
+
+                for (size_t i=0; i<2; ++i)
+                {
+                    float amp       = dsp::abs_max(&vd[i][count/2], count/2);
+                    UTEST_ASSERT_MSG(fabsf(amp - 0.5f) < 1e-2f,
+                        "Amplitude of band %d at split frequency is %.6f", int(i), amp);
+                }
+            }
+        }
+
+        for (size_t i=0; i<MAX_BANDS; ++i)
+            delete dst[i];
+    }
+
+    void call(const char *label, size_t align, crossover_process_t func1, crossover_process_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(bands, 1, 2, 3, 4, 5, 6, 7, 8)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                    32, 64, 65, 100, 127, 999, 0xfff)
+            {
+                for (size_t mask=0; mask <= 0x07; ++mask)
+                {
+                    dsp::crossover_type_t type = (mask & 0x04) ? dsp::CROSSOVER_LR8 : dsp::CROSSOVER_LR4;
+                    printf("Testing %s on %d bands of %d numbers, mask=0x%x...\n",
+                        label, int(bands), int(count), int(mask));
+
+                    FloatBuffer src(count, align, mask & 0x01);
+                    FloatBuffer *dst1[MAX_BANDS], *dst2[MAX_BANDS];
+                    float *vd1[MAX_BANDS], *vd2[MAX_BANDS];
+                    dsp::crossover_params_t p;
+                    dsp::crossover_t c1, c2;
+
+                    src.randomize_sign();
+                    for (size_t i=0; i<bands; ++i)
+                    {
+                        dst1[i]         = new FloatBuffer(count, align, mask & 0x02);
+                        dst2[i]         = new FloatBuffer(*dst1[i]);
+                        vd1[i]          = dst1[i]->data();
+                        vd2[i]          = dst2[i]->data();
+                    }
+
+                    init_params(&p, (bands > 1) ? bands : 2, type, mask & 0x02);
+                    p.bands         = bands;
+                    generic::crossover_init(&c1, &p);
+                    generic::crossover_init(&c2, &p);
+
+                    // Process the signal by two portions to check the state
+                    size_t half = count / 2;
+                    func1(vd1, src, half, &c1);
+                    func2(vd2, src, half, &c2);
+                    for (size_t i=0; i<bands; ++i)
+                    {
+                        vd1[i]         += half;
+                        vd2[i]         += half;
+                    }
+                    func1(vd1, src.data(half), count - half, &c1);
+                    func2(vd2, src.data(half), count - half, &c2);
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    for (size_t i=0; i<bands; ++i)
+                    {
+                        UTEST_ASSERT_MSG(dst1[i]->valid(), "Destination buffer 1 of band %d corrupted", int(i));
+                        UTEST_ASSERT_MSG(dst2[i]->valid(), "Destination buffer 2 of band %d corrupted", int(i));
+                        if (!dst1[i]->equals_adaptive(*dst2[i], TOLERANCE))
+                        {
+                            src.dump("src  ");
+                            dst1[i]->dump("dst1 ");
+                            dst2[i]->dump("dst2 ");
+                            UTEST_FAIL_MSG("Output of band %d differs at index %d: %.6f vs %.6f",
+                                int(i), int(dst1[i]->last_diff()), dst1[i]->get_diff(), dst2[i]->get_diff());
+                        }
+                    }
+
+                    for (size_t i=0; i<bands; ++i)
+                    {
+                        delete dst1[i];
+                        delete dst2[i];
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_reference();
+
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func)
+
+        IF_ARCH_X86_64(CALL(generic::crossover_process, sse3::x64_crossover_process, 16));
+        IF_ARCH_X86_64(CALL(generic::crossover_process, avx::x64_crossover_process, 32));
+
+        IF_ARCH_AARCH64(CALL(generic::crossover_process, asimd::crossover_process, 16));
+    }
+
+UTEST_END;
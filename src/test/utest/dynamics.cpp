@@ -0,0 +1,341 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#define TOLERANCE       1e-4f
+#define MAX_CHANNELS    8
+
+namespace lsp
+{
+    namespace generic
+    {
+        void envelope_init(dsp::envelope_t *env, float attack, float release);
+        void gain_curve_init(dsp::gain_curve_t *c, float threshold, float ratio, float knee, dsp::gain_curve_type_t type);
+        void envelope_peak(float *dst, const float *src, dsp::envelope_t *env, size_t count);
+        void envelope_rms(float *dst, const float *src, dsp::envelope_t *env, size_t count);
+        void envelope_peak_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+        void envelope_rms_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+        void envelope_peak_linked(float *dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+        void envelope_rms_linked(float *dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+        void gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void envelope_peak_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+            void envelope_rms_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+        }
+
+        namespace sse2
+        {
+            void gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace avx2
+        {
+            void x64_gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void envelope_peak_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+            void envelope_rms_mc(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+            void gain_curve(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count);
+        }
+    )
+
+    typedef void (* envelope_mc_t)(float **dst, const float **src, dsp::envelope_t *env, size_t channels, size_t count);
+    typedef void (* gain_curve_func_t)(float *dst, const float *src, const dsp::gain_curve_t *c, size_t count);
+}
+
+namespace
+{
+    // Threshold, ratio, knee and type of tested curves
+    typedef struct curve_params_t
+    {
+        float       threshold;
+        float       ratio;
+        float       knee;
+        bool        expander;
+    } curve_params_t;
+
+    const curve_params_t curves[] =
+    {
+        { 0.1f,     4.0f,       1.0f,       false },
+        { 0.1f,     4.0f,       0.5f,       false },
+        { 0.5f,     100.0f,     0.25f,      false },
+        { 0.01f,    2.0f,       1.0f,       true  },
+        { 0.01f,    2.0f,       0.5f,       true  },
+        { 0.2f,     1.0f,       0.5f,       true  }
+    };
+
+    // Reference gain computed with double precision in decibels
+    double gain_value(const curve_params_t *p, float x)
+    {
+        double l    = (x > 0.0f) ? 20.0 * log10(x) : -1000.0;
+        double t    = 20.0 * log10(p->threshold);
+        double w    = (p->knee < 1.0f) ? -20.0 * log10(p->knee) : 0.0;
+        double s    = (p->expander) ? t - l : l - t;
+        double h    = (s <= -w) ? 0.0 : (s >= w) ? s : (s + w) * (s + w) / (4.0 * w);
+        double k    = (p->expander) ? 1.0 - p->ratio : 1.0 / p->ratio - 1.0;
+        double g    = k * h;
+        double gmin = -80.0 * 20.0 / M_LN10;
+        return pow(10.0, ((g < gmin) ? gmin : g) / 20.0);
+    }
+}
+
+UTEST_BEGIN("dsp", dynamics)
+
+    void init_envelopes(dsp::envelope_t *env, size_t channels)
+    {
+        for (size_t i=0; i<channels; ++i)
+        {
+            generic::envelope_init(&env[i], 2.0f + i * 3.0f, 20.0f + i * 15.0f);
+            env[i].env      = 0.1f * i;
+        }
+    }
+
+    void compare(const char *label, FloatBuffer &dst1, FloatBuffer &dst2)
+    {
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1 ");
+            dst2.dump("dst2 ");
+            UTEST_FAIL_MSG("Output of '%s' differs at index %d: %.6f vs %.6f",
+                label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+    }
+
+    // Check the generic implementation against the straightforward references
+    void check_reference()
+    {
+        size_t count = 1000;
+
+        // Gain curves
+        FloatBuffer src(count);
+        FloatBuffer dst1(count);
+        FloatBuffer dst2(count);
+        src.randomize(1e-5f, 2.0f);
+        src[0]          = 0.0f;
+        for (size_t i=0; i<sizeof(curves)/sizeof(curve_params_t); ++i)
+        {
+            printf("Testing reference gain curve %d\n", int(i));
+
+            const curve_params_t *p = &curves[i];
+            dsp::gain_curve_t c;
+            generic::gain_curve_init(&c, p->threshold, p->ratio, p->knee,
+                (p->expander) ? dsp::GAIN_CURVE_EXPANDER : dsp::GAIN_CURVE_COMPRESSOR);
+
+            for (size_t j=0; j<count; ++j)
+                dst1[j]         = gain_value(p, src[j]);
+            generic::gain_curve(dst2, src, &c, count);
+            compare("generic::gain_curve", dst1, dst2);
+        }
+
+        // Linked envelopes
+        FloatBuffer *in[MAX_CHANNELS];
+        const float *vs[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            in[i]           = new FloatBuffer(count);
+            in[i]->randomize_sign();
+            vs[i]           = in[i]->data();
+        }
+
+        UTEST_FOREACH(channels, 1, 2, 3, 5, 8)
+        {
+            printf("Testing reference linked envelopes for %d channels\n", int(channels));
+
+            dsp::envelope_t e1, e2;
+
+            // Peak: the envelope of the loudest channel
+            for (size_t j=0; j<count; ++j)
+            {
+                float v         = 0.0f;
+                for (size_t i=0; i<channels; ++i)
+                    v               = (fabsf(vs[i][j]) > v) ? fabsf(vs[i][j]) : v;
+                src[j]          = v;
+            }
+            generic::envelope_init(&e1, 5.0f, 50.0f);
+            generic::envelope_init(&e2, 5.0f, 50.0f);
+            generic::envelope_peak(dst1, src, &e1, count);
+            generic::envelope_peak_linked(dst2, vs, &e2, channels, count);
+            compare("generic::envelope_peak_linked", dst1, dst2);
+
+            // RMS: the envelope of the mean power of channels
+            for (size_t j=0; j<count; ++j)
+            {
+                float v         = 0.0f;
+                for (size_t i=0; i<channels; ++i)
+                    v              += vs[i][j] * vs[i][j];
+                src[j]          = sqrtf(v / channels);
+            }
+            generic::envelope_init(&e1, 5.0f, 50.0f);
+            generic::envelope_init(&e2, 5.0f, 50.0f);
+            generic::envelope_rms(dst1, src, &e1, count);
+            generic::envelope_rms_linked(dst2, vs, &e2, channels, count);
+            compare("generic::envelope_rms_linked", dst1, dst2);
+        }
+
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+            delete in[i];
+    }
+
+    void call(const char *label, size_t align, envelope_mc_t func1, envelope_mc_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(channels, 0, 1, 2, 3, 4, 5, 8)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                    32, 64, 65, 100, 127, 999, 0xfff)
+            {
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    printf("Testing %s on %d channels of %d numbers, mask=0x%x...\n",
+                        label, int(channels), int(count), int(mask));
+
+                    FloatBuffer *src[MAX_CHANNELS], *dst1[MAX_CHANNELS], *dst2[MAX_CHANNELS];
+                    const float *vs[MAX_CHANNELS];
+                    float *vd1[MAX_CHANNELS], *vd2[MAX_CHANNELS];
+                    dsp::envelope_t e1[MAX_CHANNELS], e2[MAX_CHANNELS];
+
+                    for (size_t i=0; i<channels; ++i)
+                    {
+                        src[i]          = new FloatBuffer(count, align, mask & 0x01);
+                        dst1[i]         = new FloatBuffer(count, align, mask & 0x02);
+                        src[i]->randomize_sign();
+                        dst2[i]         = new FloatBuffer(*dst1[i]);
+                        vs[i]           = src[i]->data();
+                        vd1[i]          = dst1[i]->data();
+                        vd2[i]          = dst2[i]->data();
+                    }
+                    init_envelopes(e1, channels);
+                    init_envelopes(e2, channels);
+
+                    // Process the signal by two portions to check the state
+                    size_t half = count / 2;
+                    func1(vd1, vs, e1, channels, half);
+                    func2(vd2, vs, e2, channels, half);
+                    for (size_t i=0; i<channels; ++i)
+                    {
+                        vs[i]          += half;
+                        vd1[i]         += half;
+                        vd2[i]         += half;
+                    }
+                    func1(vd1, vs, e1, channels, count - half);
+                    func2(vd2, vs, e2, channels, count - half);
+
+                    for (size_t i=0; i<channels; ++i)
+                    {
+                        UTEST_ASSERT_MSG(src[i]->valid(), "Source buffer corrupted");
+                        compare(label, *dst1[i], *dst2[i]);
+                        UTEST_ASSERT_MSG(float_equals_adaptive(e1[i].env, e2[i].env, TOLERANCE),
+                            "Envelope state of channel %d differs: %.6f vs %.6f",
+                            int(i), e1[i].env, e2[i].env);
+                    }
+
+                    for (size_t i=0; i<channels; ++i)
+                    {
+                        delete src[i];
+                        delete dst1[i];
+                        delete dst2[i];
+                    }
+                }
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, gain_curve_func_t func1, gain_curve_func_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                32, 64, 65, 100, 127, 999, 0xfff)
+        {
+            for (size_t mask=0; mask <= 0x03; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer src(count, align, mask & 0x01);
+                FloatBuffer dst1(count, align, mask & 0x02);
+                src.randomize(1e-5f, 2.0f);
+                if (count > 0)
+                    src[count/2]    = 0.0f;
+
+                for (size_t i=0; i<sizeof(curves)/sizeof(curve_params_t); ++i)
+                {
+                    const curve_params_t *p = &curves[i];
+                    dsp::gain_curve_t c;
+                    generic::gain_curve_init(&c, p->threshold, p->ratio, p->knee,
+                        (p->expander) ? dsp::GAIN_CURVE_EXPANDER : dsp::GAIN_CURVE_COMPRESSOR);
+
+                    dst1.randomize_sign();
+                    FloatBuffer dst2(dst1);
+                    func1(dst1, src, &c, count);
+                    func2(dst2, src, &c, count);
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    compare(label, dst1, dst2);
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_reference();
+
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func)
+
+        IF_ARCH_X86(CALL(generic::envelope_peak_mc, sse::envelope_peak_mc, 16));
+        IF_ARCH_X86(CALL(generic::envelope_rms_mc, sse::envelope_rms_mc, 16));
+        IF_ARCH_X86(CALL(generic::gain_curve, sse2::gain_curve, 16));
+
+        IF_ARCH_X86_64(CALL(generic::gain_curve, avx2::x64_gain_curve, 32));
+
+        IF_ARCH_AARCH64(CALL(generic::envelope_peak_mc, asimd::envelope_peak_mc, 16));
+        IF_ARCH_AARCH64(CALL(generic::envelope_rms_mc, asimd::envelope_rms_mc, 16));
+        IF_ARCH_AARCH64(CALL(generic::gain_curve, asimd::gain_curve, 16));
+    }
+
+UTEST_END;
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <string.h>
+
+#define MAX_RANK        13
+
+namespace lsp
+{
+    namespace generic
+    {
+        void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+        void reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+        void packed_direct_fft(float *dst, const float *src, size_t rank);
+        void packed_reverse_fft(float *dst, const float *src, size_t rank);
+
+        void direct_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+        void reverse_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+        void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+        void packed_reverse_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void packed_reverse_fft(float *dst, const float *src, size_t rank);
+
+            void direct_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+            void reverse_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+            void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+            void packed_reverse_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+        }
+
+        namespace avx
+        {
+            void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void packed_reverse_fft(float *dst, const float *src, size_t rank);
+
+            void direct_fft_fma3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void reverse_fft_fma3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void packed_direct_fft_fma3(float *dst, const float *src, size_t rank);
+            void packed_reverse_fft_fma3(float *dst, const float *src, size_t rank);
+
+            void direct_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+            void reverse_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+            void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+            void packed_reverse_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+
+            void direct_fft_batch_fma3(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+            void reverse_fft_batch_fma3(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+            void packed_direct_fft_batch_fma3(float **dst, const float * const *src, size_t rank, size_t count);
+            void packed_reverse_fft_batch_fma3(float **dst, const float * const *src, size_t rank, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void packed_reverse_fft(float *dst, const float *src, size_t rank);
+
+            void direct_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+            void reverse_fft_batch(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+            void packed_direct_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+            void packed_reverse_fft_batch(float **dst, const float * const *src, size_t rank, size_t count);
+        }
+    )
+
+    typedef void (* fft_t)(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+    typedef void (* packed_fft_t)(float *dst, const float *src, size_t rank);
+    typedef void (* fft_batch_t)(float **dst_re, float **dst_im, const float * const *src_re, const float * const *src_im, size_t rank, size_t count);
+    typedef void (* packed_fft_batch_t)(float **dst, const float * const *src, size_t rank, size_t count);
+}
+
+UTEST_BEGIN("dsp.fft", batch)
+
+    void check(const char *label, FloatBuffer &src, FloatBuffer &dst1, FloatBuffer &dst2)
+    {
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        // The batch runs the same butterflies for each channel, the result should be bit-exact
+        if (memcmp(dst1.data(), dst2.data(), dst1.size() * sizeof(float)) != 0)
+        {
+            dst1.equals_absolute(dst2, 0.0f);
+            src.dump("src ");
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output of functions for test '%s' is not bit-exact at sample %d: %.8f vs %.8f",
+                    label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+    }
+
+    void call(const char *label, size_t align, fft_t func, fft_batch_t batch)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+        if (!UTEST_SUPPORTED(batch))
+            return;
+
+        float *dst_re[64], *dst_im[64];
+        const float *src_re[64], *src_im[64];
+
+        for (size_t rank=0; rank<=MAX_RANK; ++rank)
+        {
+            size_t n = 1 << rank;
+
+            UTEST_FOREACH(count, 0, 1, 3, 5, 17, 33, 64)
+            {
+                for (size_t inplace=0; inplace < 2; ++inplace)
+                {
+                    printf("Testing %s on rank=%d, count=%d, inplace=%d...\n", label, int(rank), int(count), int(inplace));
+
+                    // Channels are placed with stride of 2*n to keep real and imaginary parts together
+                    FloatBuffer src(count * n * 2, align);
+                    FloatBuffer dst1(count * n * 2, align);
+                    FloatBuffer dst2(count * n * 2, align);
+                    src.randomize_sign();
+                    if (inplace)
+                    {
+                        dst1.copy(src);
+                        dst2.copy(src);
+                    }
+
+                    for (size_t j=0; j<count; ++j)
+                    {
+                        float *s    = (inplace) ? dst1.data(j * n * 2) : src.data(j * n * 2);
+                        func(dst1.data(j * n * 2), dst1.data(j * n * 2 + n), s, &s[n], rank);
+
+                        float *b    = dst2.data(j * n * 2);
+                        const float *x = (inplace) ? b : src.data(j * n * 2);
+                        dst_re[j]   = b;
+                        dst_im[j]   = &b[n];
+                        src_re[j]   = x;
+                        src_im[j]   = &x[n];
+                    }
+
+                    batch(dst_re, dst_im, src_re, src_im, rank, count);
+                    check(label, src, dst1, dst2);
+                }
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, packed_fft_t func, packed_fft_batch_t batch)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+        if (!UTEST_SUPPORTED(batch))
+            return;
+
+        float *dst[64];
+        const float *src[64];
+
+        for (size_t rank=0; rank<=MAX_RANK; ++rank)
+        {
+            size_t n = 2 << rank;
+
+            UTEST_FOREACH(count, 0, 1, 3, 5, 17, 33, 64)
+            {
+                for (size_t inplace=0; inplace < 2; ++inplace)
+                {
+                    printf("Testing %s on rank=%d, count=%d, inplace=%d...\n", label, int(rank), int(count), int(inplace));
+
+                    FloatBuffer sbuf(count * n, align);
+                    FloatBuffer dst1(count * n, align);
+                    FloatBuffer dst2(count * n, align);
+                    sbuf.randomize_sign();
+                    if (inplace)
+                    {
+                        dst1.copy(sbuf);
+                        dst2.copy(sbuf);
+                    }
+
+                    for (size_t j=0; j<count; ++j)
+                    {
+                        float *s    = (inplace) ? dst1.data(j * n) : sbuf.data(j * n);
+                        func(dst1.data(j * n), s, rank);
+
+                        dst[j]      = dst2.data(j * n);
+                        src[j]      = (inplace) ? dst[j] : sbuf.data(j * n);
+                    }
+
+                    batch(dst, src, rank, count);
+                    check(label, sbuf, dst1, dst2);
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, batch, align) \
+            call(#batch, align, func, batch)
+
+        CALL(generic::direct_fft, generic::direct_fft_batch, 16);
+        CALL(generic::reverse_fft, generic::reverse_fft_batch, 16);
+        CALL(generic::packed_direct_fft, generic::packed_direct_fft_batch, 16);
+        CALL(generic::packed_reverse_fft, generic::packed_reverse_fft_batch, 16);
+
+        IF_ARCH_X86(CALL(sse::direct_fft, sse::direct_fft_batch, 16));
+        IF_ARCH_X86(CALL(sse::reverse_fft, sse::reverse_fft_batch, 16));
+        IF_ARCH_X86(CALL(sse::packed_direct_fft, sse::packed_direct_fft_batch, 16));
+        IF_ARCH_X86(CALL(sse::packed_reverse_fft, sse::packed_reverse_fft_batch, 16));
+
+        IF_ARCH_X86(CALL(avx::direct_fft, avx::direct_fft_batch, 32));
+        IF_ARCH_X86(CALL(avx::reverse_fft, avx::reverse_fft_batch, 32));
+        IF_ARCH_X86(CALL(avx::packed_direct_fft, avx::packed_direct_fft_batch, 32));
+        IF_ARCH_X86(CALL(avx::packed_reverse_fft, avx::packed_reverse_fft_batch, 32));
+
+        IF_ARCH_X86(CALL(avx::direct_fft_fma3, avx::direct_fft_batch_fma3, 32));
+        IF_ARCH_X86(CALL(avx::reverse_fft_fma3, avx::reverse_fft_batch_fma3, 32));
+        IF_ARCH_X86(CALL(avx::packed_direct_fft_fma3, avx::packed_direct_fft_batch_fma3, 32));
+        IF_ARCH_X86(CALL(avx::packed_reverse_fft_fma3, avx::packed_reverse_fft_batch_fma3, 32));
+
+        IF_ARCH_AARCH64(CALL(asimd::direct_fft, asimd::direct_fft_batch, 16));
+        IF_ARCH_AARCH64(CALL(asimd::reverse_fft, asimd::reverse_fft_batch, 16));
+        IF_ARCH_AARCH64(CALL(asimd::packed_direct_fft, asimd::packed_direct_fft_batch, 16));
+        IF_ARCH_AARCH64(CALL(asimd::packed_reverse_fft, asimd::packed_reverse_fft_batch, 16));
+    }
+UTEST_END;
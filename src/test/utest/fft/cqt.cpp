@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define RANK            12
+#define TOLERANCE       1e-4f
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t cqt_bins(const dsp::cqt_params_t *p);
+        size_t cqt_kernel_size(const dsp::cqt_params_t *p);
+        void cqt_init(dsp::cqt_bin_t *bins, float *kernel, float *tmp, const dsp::cqt_params_t *p);
+        void cqt_apply(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void cqt_apply(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void cqt_apply(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count);
+        }
+    )
+
+    typedef void (* cqt_apply_t)(float *dst, const float *fft, const dsp::cqt_bin_t *bins, const float *kernel, size_t count);
+}
+
+UTEST_BEGIN("dsp.fft", cqt)
+
+    void call(const char *label, const dsp::cqt_bin_t *bins, const float *kernel, size_t nbins, cqt_apply_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 5, 8, 16, 33, nbins)
+        {
+            for (size_t mask=0; mask <= 0x03; ++mask)
+            {
+                printf("Testing %s on %d bins, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer fft(2 << RANK, 16, mask & 0x01);
+                FloatBuffer dst1(count, 16, mask & 0x02);
+                FloatBuffer dst2(dst1);
+                fft.randomize_sign();
+
+                generic::cqt_apply(dst1, fft, bins, kernel, count);
+                func(dst2, fft, bins, kernel, count);
+
+                UTEST_ASSERT_MSG(fft.valid(), "FFT buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+            }
+        }
+    }
+
+    void check_tone(const dsp::cqt_bin_t *bins, const float *kernel, size_t nbins, size_t bpo, size_t index)
+    {
+        size_t fft_size = 1 << RANK;
+        FloatBuffer fft(fft_size * 2);
+        FloatBuffer dst(nbins);
+
+        // Generate the tone with amplitude 0.5 at the center frequency of the bin
+        double f        = bins[index].freq;
+        for (size_t i=0; i<fft_size; ++i)
+        {
+            fft[i*2]        = 0.5 * cos(2.0 * M_PI * f * i + 1.0);
+            fft[i*2+1]      = 0.0f;
+        }
+
+        dsp::packed_direct_fft(fft, fft, RANK);
+        generic::cqt_apply(dst, fft, bins, kernel, nbins);
+
+        printf("Tone at bin %d (f=%.5f): level=%.6f\n", int(index), f, dst[index]);
+        UTEST_ASSERT_MSG(fabs(dst[index] - 0.5f) < 1e-3f,
+                "Invalid level of bin %d: %.6f", int(index), dst[index]);
+
+        // Bins that are far enough from the tone should not respond
+        for (size_t i=0; i<nbins; ++i)
+        {
+            if ((i + bpo/2 > index) && (i < index + bpo/2))
+                continue;
+            UTEST_ASSERT_MSG(dst[i] < 5e-3f,
+                    "Too high response of bin %d for tone at bin %d: %.6f", int(i), int(index), dst[i]);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        dsp::cqt_params_t p;
+        p.fmin          = 20.0f / 48000.0f;
+        p.fmax          = 20000.0f / 48000.0f;
+        p.bpo           = 12;
+        p.rank          = RANK;
+
+        size_t nbins    = generic::cqt_bins(&p);
+        size_t ksize    = generic::cqt_kernel_size(&p);
+        printf("Number of bins: %d, kernel size: %d floats\n", int(nbins), int(ksize));
+        UTEST_ASSERT(nbins == 120);
+
+        uint8_t *data   = NULL;
+        uint8_t *bdata  = NULL;
+        float *kernel   = alloc_aligned<float>(data, ksize + (2 << RANK), 16);
+        float *tmp      = &kernel[ksize];
+        dsp::cqt_bin_t *bins = alloc_aligned<dsp::cqt_bin_t>(bdata, nbins, 16);
+        UTEST_ASSERT(kernel != NULL);
+        UTEST_ASSERT(bins != NULL);
+
+        generic::cqt_init(bins, kernel, tmp, &p);
+        UTEST_ASSERT(bins[nbins-1].offset + bins[nbins-1].count * 2 == ksize);
+
+        // Check the response of the bins which have constant Q factor
+        check_tone(bins, kernel, nbins, p.bpo, 60);
+        check_tone(bins, kernel, nbins, p.bpo, 84);
+        check_tone(bins, kernel, nbins, p.bpo, 119);
+
+        // Compare optimized implementations
+        IF_ARCH_X86(call("sse::cqt_apply", bins, kernel, nbins, sse::cqt_apply));
+        IF_ARCH_AARCH64(call("asimd::cqt_apply", bins, kernel, nbins, asimd::cqt_apply));
+
+        free_aligned(data);
+        free_aligned(bdata);
+    }
+UTEST_END
@@ -36,6 +36,7 @@ namespace lsp
         void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
         void fastconv_restore(float *dst, float *src, size_t rank);
         void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
     }
 
     IF_ARCH_X86(
@@ -45,6 +46,7 @@ namespace lsp
             void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
             void fastconv_restore(float *dst, float *src, size_t rank);
             void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+            void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
         }
 
         namespace avx
@@ -53,11 +55,13 @@ namespace lsp
             void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
             void fastconv_restore(float *dst, float *src, size_t rank);
             void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+            void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
 
             void fastconv_parse_fma3(float *dst, const float *src, size_t rank);
             void fastconv_parse_apply_fma3(float *dst, float *tmp, const float *c, const float *src, size_t rank);
             void fastconv_restore_fma3(float *dst, float *src, size_t rank);
             void fastconv_apply_fma3(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+            void fastconv_fmadd_fma3(float *dst, const float *c1, const float *c2, size_t rank);
         }
     )
 
@@ -68,6 +72,7 @@ namespace lsp
             void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
             void fastconv_restore(float *dst, float *src, size_t rank);
             void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+            void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
         }
     )
 
@@ -78,6 +83,7 @@ namespace lsp
             void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
             void fastconv_restore(float *dst, float *src, size_t rank);
             void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+            void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
         }
     )
 }
@@ -90,6 +96,8 @@ typedef void (* fastconv_restore_t)(float *dst, float *src, size_t rank);
 
 typedef void (* fastconv_apply_t)(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
 
+typedef void (* fastconv_fmadd_t)(float *dst, const float *c1, const float *c2, size_t rank);
+
 UTEST_BEGIN("dsp.fft", fastconv)
 
     // This is long-time test, raise time limit for it to one second
@@ -297,6 +305,81 @@ UTEST_BEGIN("dsp.fft", fastconv)
         }
     }
 
+    void call_pfr(const char *label, size_t align,
+            fastconv_parse_t parse,
+            fastconv_fmadd_t fmadd,
+            fastconv_restore_t restore
+        )
+    {
+        if (!UTEST_SUPPORTED(parse))
+            return;
+        if (!UTEST_SUPPORTED(fmadd))
+            return;
+        if (!UTEST_SUPPORTED(restore))
+            return;
+
+        for (size_t rank=MIN_RANK; rank<=MAX_RANK; rank ++)
+        {
+            for (size_t mask=0; mask <= 0x07; ++mask)
+            {
+                printf("Testing '%s' for FFT rank=%d, mask=0x%x\n", label, rank, mask);
+
+                FloatBuffer src1(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer src2(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer src3(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer fa1(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fa2(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fb1(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fb2(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fc1(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fc2(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer acc1(1 << (rank+1), align, mask & 0x04);
+                FloatBuffer acc2(1 << (rank+1), align, mask & 0x04);
+                FloatBuffer dst1(1 << rank, align, mask & 0x04);
+                FloatBuffer dst2(1 << rank, align, mask & 0x04);
+
+                generic::fastconv_parse(fa1, src1, rank);
+                generic::fastconv_parse(fb1, src2, rank);
+                generic::fastconv_parse(fc1, src3, rank);
+                parse(fa2, src1, rank);
+                parse(fb2, src2, rank);
+                parse(fc2, src3, rank);
+
+                // acc = a*c + b*c
+                dsp::fill_zero(acc1, acc1.size());
+                dsp::fill_zero(acc2, acc2.size());
+                generic::fastconv_fmadd(acc1, fa1, fc1, rank);
+                generic::fastconv_fmadd(acc1, fb1, fc1, rank);
+                UTEST_ASSERT_MSG(acc1.valid(), "Buffer ACC1 corrupted");
+                fmadd(acc2, fa2, fc2, rank);
+                fmadd(acc2, fb2, fc2, rank);
+                UTEST_ASSERT_MSG(acc2.valid(), "Buffer ACC2 corrupted");
+                UTEST_ASSERT_MSG(fa2.valid(), "Buffer FA2 corrupted");
+                UTEST_ASSERT_MSG(fb2.valid(), "Buffer FB2 corrupted");
+                UTEST_ASSERT_MSG(fc2.valid(), "Buffer FC2 corrupted");
+
+                generic::fastconv_restore(dst1, acc1, rank);
+                UTEST_ASSERT_MSG(dst1.valid(), "Buffer DST1 corrupted");
+                restore(dst2, acc2, rank);
+                UTEST_ASSERT_MSG(dst2.valid(), "Buffer DST2 corrupted");
+
+                // Compare buffers
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src1.dump("src1");
+                    src2.dump("src2");
+                    src3.dump("src3");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+
+                    ssize_t diff = dst2.last_diff();
+                    UTEST_FAIL_MSG("DST1 differs DST2 for test '%s' at sample %d (%.5f vs %.5f), rank=%d",
+                            label, int(diff), dst1.get(diff), dst2.get(diff), int(rank));
+                }
+            }
+        }
+    }
+
     UTEST_MAIN
     {
         // Do tests
@@ -317,6 +400,12 @@ UTEST_BEGIN("dsp.fft", fastconv)
         IF_ARCH_X86(call_pap("avx::fastconv_parse_fma3 + avx::fastconv_parse_apply_fma3", 32, avx::fastconv_parse_fma3, avx::fastconv_parse_apply_fma3));
         IF_ARCH_ARM(call_pap("neon_d32::fastconv_parse + neon_d32::fastconv_parse_apply", 16, neon_d32::fastconv_parse, neon_d32::fastconv_parse_apply));
         IF_ARCH_AARCH64(call_pap("asimd::fastconv_parse + asimd::fastconv_parse_apply", 16, asimd::fastconv_parse, asimd::fastconv_parse_apply));
+
+        IF_ARCH_X86(call_pfr("sse::fastconv_fmadd", 16, sse::fastconv_parse, sse::fastconv_fmadd, sse::fastconv_restore));
+        IF_ARCH_X86(call_pfr("avx::fastconv_fmadd", 32, avx::fastconv_parse, avx::fastconv_fmadd, avx::fastconv_restore));
+        IF_ARCH_X86(call_pfr("avx::fastconv_fmadd_fma3", 32, avx::fastconv_parse_fma3, avx::fastconv_fmadd_fma3, avx::fastconv_restore_fma3));
+        IF_ARCH_ARM(call_pfr("neon_d32::fastconv_fmadd", 16, neon_d32::fastconv_parse, neon_d32::fastconv_fmadd, neon_d32::fastconv_restore));
+        IF_ARCH_AARCH64(call_pfr("asimd::fastconv_fmadd", 16, asimd::fastconv_parse, asimd::fastconv_fmadd, asimd::fastconv_restore));
     }
 UTEST_END;
 
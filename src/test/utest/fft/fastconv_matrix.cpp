@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define MIN_RANK    4
+#define MAX_RANK    12
+#define TOLERANCE   1e-3
+
+UTEST_BEGIN("dsp.fft", fastconv_matrix)
+
+    void call(size_t inputs, size_t outputs, size_t rank, bool sparse)
+    {
+        printf("Testing fastconv_matrix_apply for %dx%d matrix, rank=%d, sparse=%s\n",
+                int(inputs), int(outputs), int(rank), (sparse) ? "true" : "false");
+
+        size_t half     = 1 << (rank - 1);
+        size_t items    = 1 << (rank + 1);
+        size_t paths    = inputs * outputs;
+
+        FloatBuffer src(inputs * half);
+        FloatBuffer conv(paths * items);
+        FloatBuffer dst1(outputs * half * 2);
+        FloatBuffer dst2(outputs * half * 2);
+        FloatBuffer tmp1(items);
+        FloatBuffer tmp2((inputs + 2) * items);
+        FloatBuffer ir(half);
+
+        const float **vc    = new const float *[paths];
+        const float **vs    = new const float *[inputs];
+        float **vd          = new float *[outputs];
+
+        // Prepare convolutions, make each third path empty for sparse matrix
+        src.randomize_sign();
+        for (size_t i=0; i<paths; ++i)
+        {
+            float *c        = conv.data(i * items);
+            ir.randomize_sign();
+            dsp::fill_zero(ir.data(half >> 1), half >> 1);
+            dsp::fastconv_parse(c, ir, rank);
+            vc[i]           = ((sparse) && ((i % 3) == 1)) ? NULL : c;
+        }
+        for (size_t i=0; i<inputs; ++i)
+            vs[i]           = src.data(i * half);
+
+        dst1.randomize_sign();
+        dst2.copy(dst1);
+
+        // Reference: apply each path separately
+        for (size_t o=0; o<outputs; ++o)
+            for (size_t i=0; i<inputs; ++i)
+            {
+                const float *c  = vc[o*inputs + i];
+                if (c != NULL)
+                    dsp::fastconv_parse_apply(dst1.data(o * half * 2), tmp1, c, vs[i], rank);
+            }
+
+        // Matrix processing
+        for (size_t o=0; o<outputs; ++o)
+            vd[o]           = dst2.data(o * half * 2);
+        dsp::fastconv_matrix_apply(vd, tmp2, vc, vs, rank, inputs, outputs);
+
+        delete [] vc;
+        delete [] vs;
+        delete [] vd;
+
+        UTEST_ASSERT_MSG(tmp1.valid(), "Buffer TMP1 corrupted");
+        UTEST_ASSERT_MSG(tmp2.valid(), "Buffer TMP2 corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Buffer DST1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Buffer DST2 corrupted");
+
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            ssize_t diff = dst1.last_diff();
+            UTEST_FAIL_MSG("DST1 differs DST2 at sample %d (%.5f vs %.5f), matrix=%dx%d, rank=%d",
+                    int(diff), dst1.get(diff), dst2.get(diff), int(inputs), int(outputs), int(rank));
+        }
+    }
+
+    UTEST_MAIN
+    {
+        for (size_t rank=MIN_RANK; rank<=MAX_RANK; rank += 2)
+        {
+            call(1, 1, rank, false);
+            call(2, 2, rank, false);
+            call(2, 2, rank, true);
+            call(1, 4, rank, false);
+            call(4, 1, rank, false);
+            call(4, 16, rank, false);
+            call(4, 16, rank, true);
+        }
+    }
+UTEST_END;
@@ -81,7 +81,7 @@ UTEST_BEGIN("dsp.fft", pfft)
 
         for (int same=0; same < 2; ++same)
         {
-            for (size_t rank=6; rank<=16; ++rank)
+            for (size_t rank=0; rank<=16; ++rank)
             {
                 size_t count = 1 << (rank + 1);
                 for (size_t mask=0; mask <= 0x03; ++mask)
@@ -124,11 +124,37 @@ UTEST_BEGIN("dsp.fft", pfft)
         }
     }
 
+    void check_roundtrip()
+    {
+        for (size_t rank=0; rank<=8; ++rank)
+        {
+            size_t count = 1 << (rank + 1);
+            printf("Testing packed direct and reverse FFT roundtrip for rank=%d...\n", int(rank));
+
+            FloatBuffer src(count);
+            FloatBuffer dst(count);
+            generic::packed_direct_fft(dst, src, rank);
+            generic::packed_reverse_fft(dst, dst, rank);
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+            if (!src.equals_adaptive(dst, 1e-5))
+            {
+                src.dump("src");
+                dst.dump("dst");
+                UTEST_FAIL_MSG("Roundtrip differs at sample %d (%.5f vs %.5f)",
+                        int(src.last_diff()), src.get_diff(), dst.get_diff());
+            }
+        }
+    }
+
     UTEST_MAIN
     {
         #define CALL(generic, func, align) \
             call(#func, align, generic, func)
 
+        check_roundtrip();
+
         // Do tests
         IF_ARCH_X86(CALL(generic::packed_direct_fft, sse::packed_direct_fft, 16));
         IF_ARCH_X86(CALL(generic::packed_reverse_fft, sse::packed_reverse_fft, 16));
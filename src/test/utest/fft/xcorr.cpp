@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define RANK            11
+#define TOLERANCE       1e-4f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void xcorr_spectrum(float *dst, const float *src, size_t rank);
+        void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+        float xcorr_peak(float *value, float *tmp, const float *acc, size_t max_lag, size_t rank);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+        }
+
+        namespace avx
+        {
+            void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void xcorr_accumulate(float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+        }
+    )
+
+    typedef void (* xcorr_accumulate_t)(float *acc, const float *a, const float *b, float k, size_t weight, size_t count);
+}
+
+UTEST_BEGIN("dsp.fft", xcorr)
+
+    void call(const char *label, size_t align, xcorr_accumulate_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 100, 999, 0x400)
+        {
+            for (size_t mask=0; mask <= 0x07; ++mask)
+            {
+                for (size_t weight=dsp::XCORR_PLAIN; weight <= dsp::XCORR_PHAT; ++weight)
+                {
+                    printf("Testing %s on %d bins, weight=%d, mask=0x%x...\n",
+                        label, int(count), int(weight), int(mask));
+
+                    FloatBuffer a(count*2, align, mask & 0x01);
+                    FloatBuffer b(count*2, align, mask & 0x02);
+                    FloatBuffer acc1(count*2, align, mask & 0x04);
+                    a.randomize_sign();
+                    b.randomize_sign();
+                    acc1.randomize_sign();
+                    FloatBuffer acc2(acc1);
+
+                    // Apply twice to check both the smoothing and the replacement of the accumulator
+                    generic::xcorr_accumulate(acc1, a, b, 0.25f, weight, count);
+                    func(acc2, a, b, 0.25f, weight, count);
+                    generic::xcorr_accumulate(acc1, b, a, 1.0f, weight, count);
+                    func(acc2, b, a, 1.0f, weight, count);
+
+                    UTEST_ASSERT_MSG(a.valid(), "Source buffer A corrupted");
+                    UTEST_ASSERT_MSG(b.valid(), "Source buffer B corrupted");
+                    UTEST_ASSERT_MSG(acc1.valid(), "Accumulator 1 corrupted");
+                    UTEST_ASSERT_MSG(acc2.valid(), "Accumulator 2 corrupted");
+
+                    if (!acc1.equals_adaptive(acc2, TOLERANCE))
+                    {
+                        acc1.dump("acc1");
+                        acc2.dump("acc2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                                label, int(acc1.last_diff()), acc1.get_diff(), acc2.get_diff());
+                    }
+                }
+            }
+        }
+    }
+
+    // Estimate the delay of the frame b relatively to the frame a
+    float estimate(float *value, const float *a, const float *b, size_t weight)
+    {
+        size_t bins     = 1 << RANK;
+        FloatBuffer sa(bins*2), sb(bins*2), acc(bins*2), tmp(bins*2);
+
+        dsp::fill_zero(acc, bins*2);
+        generic::xcorr_spectrum(sa, a, RANK);
+        generic::xcorr_spectrum(sb, b, RANK);
+        generic::xcorr_accumulate(acc, sa, sb, 1.0f, weight, bins);
+        return generic::xcorr_peak(value, tmp, acc, bins/2, RANK);
+    }
+
+    void check_delay(size_t weight, float delay, float tolerance)
+    {
+        size_t frame    = 1 << (RANK - 1);
+        size_t pad      = 64;
+        FloatBuffer src(frame + pad*2);
+        FloatBuffer a(frame), b(frame);
+        src.randomize_sign();
+
+        float value     = 0.0f;
+        ssize_t d       = delay;
+
+        if (delay == float(d))
+        {
+            // Integer delay: shift the noise
+            dsp::copy(a, &src[pad], frame);
+            dsp::copy(b, &src[pad - d], frame);
+        }
+        else
+        {
+            // Fractional delay: shift the band-limited signal analytically
+            float phase[32];
+            for (size_t j=0; j<32; ++j)
+                phase[j]        = randf(0.0f, 2.0f * M_PI);
+            for (size_t i=0; i<frame; ++i)
+            {
+                a[i]            = 0.0f;
+                b[i]            = 0.0f;
+                for (size_t j=0; j<32; ++j)
+                {
+                    float w         = M_PI * (j + 1) / 128.0f;
+                    a[i]           += sinf(w * i + phase[j]);
+                    b[i]           += sinf(w * (i - delay) + phase[j]);
+                }
+            }
+        }
+
+        float lag       = estimate(&value, a, b, weight);
+        printf("Delay %.2f, weight=%d: lag=%.4f, value=%.4f\n", delay, int(weight), lag, value);
+
+        UTEST_ASSERT_MSG(fabsf(lag - delay) <= tolerance,
+                "Estimated lag %.4f differs from the delay %.2f", lag, delay);
+        if (weight == dsp::XCORR_PHAT)
+            UTEST_ASSERT_MSG(value > 0.5f, "Too low PHAT peak value %.4f", value);
+    }
+
+    UTEST_MAIN
+    {
+        // Check the delay estimation
+        for (size_t weight=dsp::XCORR_PLAIN; weight <= dsp::XCORR_PHAT; ++weight)
+        {
+            check_delay(weight, 0.0f, 1e-2f);
+            check_delay(weight, 7.0f, 1e-2f);
+            check_delay(weight, -13.0f, 1e-2f);
+            check_delay(weight, 63.0f, 1e-2f);
+        }
+        check_delay(dsp::XCORR_PLAIN, 2.5f, 0.1f);
+        check_delay(dsp::XCORR_PLAIN, -4.25f, 0.1f);
+
+        // Compare optimized implementations
+        #define CALL(func, align) \
+            call(#func, align, func)
+
+        IF_ARCH_X86(CALL(sse::xcorr_accumulate, 16));
+        IF_ARCH_X86(CALL(avx::xcorr_accumulate, 32));
+        IF_ARCH_AARCH64(CALL(asimd::xcorr_accumulate, 16));
+    }
+UTEST_END
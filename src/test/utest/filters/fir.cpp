@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-5f
+#define FFT_RANK        10
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_design(float *dst, const dsp::fir_params_t *p, size_t count);
+        void fir_design_fastconv(float *dst, const dsp::fir_params_t *p, size_t count, size_t rank);
+    }
+
+    static double fir_window(size_t method, size_t i, size_t count)
+    {
+        if (count <= 1)
+            return 1.0;
+
+        double t = 2.0 * M_PI * i / (count - 1);
+        switch (method)
+        {
+            case dsp::FIR_HANN:             return 0.5 - 0.5 * cos(t);
+            case dsp::FIR_HAMMING:          return 0.54 - 0.46 * cos(t);
+            case dsp::FIR_BLACKMAN:         return 0.42 - 0.5 * cos(t) + 0.08 * cos(2.0 * t);
+            case dsp::FIR_BLACKMAN_HARRIS:  return 0.35875 - 0.48829 * cos(t) + 0.14128 * cos(2.0 * t) - 0.01168 * cos(3.0 * t);
+            default: break;
+        }
+        return 1.0;
+    }
+
+    static double fir_sinc(double f, double x)
+    {
+        return (x == 0.0) ? 2.0 * f : sin(2.0 * M_PI * f * x) / (M_PI * x);
+    }
+
+    // Straightforward implementation of the designer in double precision
+    static void fir_design_ref(float *dst, const dsp::fir_params_t *p, size_t count)
+    {
+        bool invert     = (p->type == dsp::FIR_HIGHPASS) || (p->type == dsp::FIR_BANDSTOP);
+        if (((invert) || (p->type == dsp::FIR_HILBERT)) && (!(count & 1)))
+            dst[--count]    = 0.0f;
+
+        double c        = (count - 1) * 0.5;
+        double sum      = 0.0;
+        size_t order    = 0.62 * count * p->transition + 0.5;
+        if (order < 1)
+            order           = 1;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            double x        = i - c;
+            double h;
+
+            switch (p->type)
+            {
+                case dsp::FIR_BANDPASS:
+                case dsp::FIR_BANDSTOP:
+                    h               = fir_sinc(p->f2, x) - fir_sinc(p->f1, x);
+                    break;
+                case dsp::FIR_HILBERT:
+                    h               = (x == 0.0) ? 0.0 : (1.0 - cos(M_PI * x)) / (M_PI * x);
+                    break;
+                default:
+                    h               = fir_sinc(p->f1, x);
+                    break;
+            }
+
+            if (p->method == dsp::FIR_LSQ)
+            {
+                double a        = M_PI * p->transition * x / order;
+                if (x != 0.0)
+                    h              *= pow(sin(a) / a, double(order));
+            }
+            else
+                h              *= fir_window(p->method, i, count);
+
+            dst[i]          = h;
+            sum            += h;
+        }
+
+        if (((p->type == dsp::FIR_LOWPASS) || (p->type == dsp::FIR_HIGHPASS)) && (sum != 0.0))
+        {
+            for (size_t i=0; i<count; ++i)
+                dst[i]         /= sum;
+        }
+
+        if (invert)
+        {
+            for (size_t i=0; i<count; ++i)
+                dst[i]          = -dst[i];
+            dst[count >> 1]    += 1.0f;
+        }
+    }
+
+    // Compute amplitude response of the kernel at the specified normalized frequency
+    static double fir_response(const float *h, size_t count, double f)
+    {
+        double re = 0.0, im = 0.0;
+        for (size_t i=0; i<count; ++i)
+        {
+            re             += h[i] * cos(2.0 * M_PI * f * i);
+            im             -= h[i] * sin(2.0 * M_PI * f * i);
+        }
+        return sqrt(re*re + im*im);
+    }
+}
+
+UTEST_BEGIN("dsp.filters", fir)
+
+    void check_design(const dsp::fir_params_t *p, size_t count)
+    {
+        printf("Testing fir_design type=%d, method=%d, taps=%d...\n", int(p->type), int(p->method), int(count));
+
+        FloatBuffer dst1(count, 64);
+        FloatBuffer dst2(count, 64);
+
+        generic::fir_design(dst1, p, count);
+        fir_design_ref(dst2, p, count);
+
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        for (size_t i=0; i<count; ++i)
+        {
+            if (fabs(dst1[i] - dst2[i]) <= TOLERANCE)
+                continue;
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Kernel differs from reference at tap %d: %.7f vs %.7f", int(i), dst1[i], dst2[i]);
+        }
+    }
+
+    void check_response(size_t type, size_t method, size_t count, float f1, float f2,
+            const float *pass, const float *stop, float ripple, float atten)
+    {
+        dsp::fir_params_t p;
+        p.type          = type;
+        p.method        = method;
+        p.f1            = f1;
+        p.f2            = f2;
+        p.transition    = 0.05f;
+
+        FloatBuffer h(count, 64);
+        generic::fir_design(h, &p, count);
+
+        for ( ; *pass >= 0.0f; ++pass)
+        {
+            double a        = fir_response(h, count, *pass);
+            UTEST_ASSERT_MSG(fabs(a - 1.0) <= ripple,
+                    "Passband response type=%d, method=%d at f=%.3f is %.6f",
+                    int(type), int(method), *pass, a);
+        }
+        for ( ; *stop >= 0.0f; ++stop)
+        {
+            double a        = fir_response(h, count, *stop);
+            UTEST_ASSERT_MSG(a <= atten,
+                    "Stopband response type=%d, method=%d at f=%.3f is %.6f",
+                    int(type), int(method), *stop, a);
+        }
+    }
+
+    void check_fastconv(const dsp::fir_params_t *p, size_t count, size_t rank)
+    {
+        printf("Testing fir_design_fastconv type=%d, method=%d, taps=%d, rank=%d...\n",
+            int(p->type), int(p->method), int(count), int(rank));
+
+        size_t half     = 1 << (rank - 1);
+        FloatBuffer tmp(half, 64);
+        FloatBuffer dst1(half * 4, 64);
+        FloatBuffer dst2(half * 4, 64);
+
+        generic::fir_design_fastconv(dst1, p, count, rank);
+
+        dsp::fill_zero(tmp, half);
+        generic::fir_design(tmp, p, (count > half) ? half : count);
+        dsp::fastconv_parse(dst2, tmp, rank);
+
+        UTEST_ASSERT_MSG(tmp.valid(), "Temporary buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        if (!dst1.equals_absolute(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output of fir_design_fastconv differs at sample %d: %.6f vs %.6f",
+                    int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+    }
+
+    UTEST_MAIN
+    {
+        static const size_t types[] =
+        {
+            dsp::FIR_LOWPASS, dsp::FIR_HIGHPASS, dsp::FIR_BANDPASS, dsp::FIR_BANDSTOP, dsp::FIR_HILBERT
+        };
+        static const size_t methods[] =
+        {
+            dsp::FIR_RECTANGULAR, dsp::FIR_HANN, dsp::FIR_HAMMING, dsp::FIR_BLACKMAN, dsp::FIR_BLACKMAN_HARRIS, dsp::FIR_LSQ
+        };
+
+        // Compare with reference implementation
+        dsp::fir_params_t p;
+        p.f1            = 0.1f;
+        p.f2            = 0.3f;
+        p.transition    = 0.05f;
+
+        for (size_t i=0; i<sizeof(types)/sizeof(size_t); ++i)
+            for (size_t j=0; j<sizeof(methods)/sizeof(size_t); ++j)
+            {
+                p.type          = types[i];
+                p.method        = methods[j];
+
+                UTEST_FOREACH(count, 3, 4, 5, 7, 8, 15, 16, 31, 33, 64, 101, 0x100, 0x101, 0x200, 0x3ff)
+                    check_design(&p, count);
+            }
+
+        // Check the frequency response
+        static const float lp_pass[]    = { 0.0f, 0.05f, 0.09f, -1.0f };
+        static const float lp_stop[]    = { 0.16f, 0.2f, 0.3f, 0.5f, -1.0f };
+        static const float bp_pass[]    = { 0.2f, 0.25f, 0.29f, -1.0f };
+        static const float bp_stop[]    = { 0.0f, 0.1f, 0.15f, 0.4f, 0.5f, -1.0f };
+        static const float hb_pass[]    = { 0.1f, 0.25f, 0.4f, -1.0f };
+        static const float none[]       = { -1.0f };
+
+        check_response(dsp::FIR_LOWPASS, dsp::FIR_LSQ, 127, 0.125f, 0.0f, lp_pass, lp_stop, 1e-3f, 1e-3f);
+        check_response(dsp::FIR_LOWPASS, dsp::FIR_BLACKMAN, 127, 0.125f, 0.0f, lp_pass, lp_stop, 1e-3f, 1e-3f);
+        check_response(dsp::FIR_HIGHPASS, dsp::FIR_LSQ, 127, 0.125f, 0.0f, lp_stop, lp_pass, 1e-3f, 1e-3f);
+        check_response(dsp::FIR_HIGHPASS, dsp::FIR_BLACKMAN_HARRIS, 128, 0.125f, 0.0f, lp_stop, lp_pass, 1e-3f, 1e-3f);
+        check_response(dsp::FIR_BANDPASS, dsp::FIR_LSQ, 200, 0.175f, 0.325f, bp_pass, bp_stop, 1e-3f, 1e-3f);
+        check_response(dsp::FIR_BANDSTOP, dsp::FIR_HAMMING, 201, 0.175f, 0.325f, bp_stop, bp_pass, 1e-2f, 1e-2f);
+        check_response(dsp::FIR_HILBERT, dsp::FIR_BLACKMAN, 127, 0.0f, 0.0f, hb_pass, none, 1e-2f, 0.0f);
+
+        // Check fast convolution data
+        p.type          = dsp::FIR_LOWPASS;
+        p.method        = dsp::FIR_LSQ;
+        p.f1            = 0.1f;
+        UTEST_FOREACH(count, 1, 16, 101, 0x200, 0x400)
+            check_fastconv(&p, count, FFT_RANK);
+        UTEST_FOREACH(count, 1, 3, 4, 5)
+            check_fastconv(&p, count, 3);
+
+        p.type          = dsp::FIR_BANDSTOP;
+        p.method        = dsp::FIR_HANN;
+        p.f2            = 0.2f;
+        UTEST_FOREACH(count, 1, 16, 101, 0x200)
+            check_fastconv(&p, count, FFT_RANK);
+    }
+
+UTEST_END
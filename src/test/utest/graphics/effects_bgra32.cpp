@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        void eff_hsla_hue(float *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count);
+        void eff_hsla_sat(float *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count);
+        void eff_hsla_light(float *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count);
+        void eff_hsla_alpha(float *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count);
+        void hsla_to_rgba(float *dst, const float *src, size_t count);
+        void rgba_to_bgra32(void *dst, const float *src, size_t count);
+
+        void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count);
+        void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count);
+        void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count);
+        void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count);
+            void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count);
+            void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count);
+            void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count);
+        }
+
+        namespace avx2
+        {
+            void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count);
+            void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count);
+            void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count);
+            void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void eff_hsla_hue_bgra32(void *dst, const float *v, const dsp::hsla_hue_eff_t *eff, size_t count);
+            void eff_hsla_sat_bgra32(void *dst, const float *v, const dsp::hsla_sat_eff_t *eff, size_t count);
+            void eff_hsla_light_bgra32(void *dst, const float *v, const dsp::hsla_light_eff_t *eff, size_t count);
+            void eff_hsla_alpha_bgra32(void *dst, const float *v, const dsp::hsla_alpha_eff_t *eff, size_t count);
+        }
+    )
+}
+
+UTEST_BEGIN("dsp.graphics", effects_bgra32)
+
+    template <class eff_t>
+        void call(const char *label, size_t align,
+                void (* chain)(float *dst, const float *v, const eff_t *eff, size_t count),
+                void (* func)(void *dst, const float *v, const eff_t *eff, size_t count),
+                const eff_t *eff
+            )
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+                32, 64, 65, 100, 768, 999, 1024, 0x1fff)
+        {
+            for (size_t mask=0; mask <= 0x03; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer src(count, align, mask & 0x01);
+                FloatBuffer hsla(count*4, align, false);
+                FloatBuffer dst1(count, align, mask & 0x02);
+                FloatBuffer dst2(count, align, mask & 0x02);
+
+                src.randomize_sign();
+                dst1.fill_zero();
+                dst2.fill_zero();
+
+                // Reference: the chain of non-fused functions
+                chain(hsla, src, eff, count);
+                generic::hsla_to_rgba(hsla, hsla, count);
+                generic::rgba_to_bgra32(dst1.data(), hsla, count);
+
+                func(dst2.data(), src, eff, count);
+
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                // Compare pixels, allow difference of 1 for each channel due to rounding
+                const uint8_t *p1   = dst1.data<uint8_t>();
+                const uint8_t *p2   = dst2.data<uint8_t>();
+                for (size_t i=0; i<count*4; ++i)
+                {
+                    int diff = int(p1[i]) - int(p2[i]);
+                    if ((diff < -1) || (diff > 1))
+                    {
+                        src.dump("src");
+                        UTEST_FAIL_MSG("Pixel %d differs at channel %d for value %.6f: 0x%02x vs 0x%02x",
+                            int(i >> 2), int(i & 3), src[i >> 2], int(p1[i]), int(p2[i]));
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        dsp::hsla_hue_eff_t hue;
+        dsp::hsla_alpha_eff_t alpha;
+        dsp::hsla_sat_eff_t sat;
+        dsp::hsla_light_eff_t light;
+
+        for (size_t i=0; i<4; ++i)
+        {
+            hue.h       = randf(0.0f, 1.0f);
+            hue.s       = randf(0.0f, 1.0f);
+            hue.l       = randf(0.0f, 1.0f);
+            hue.a       = 0.0f;
+            hue.thresh  = randf(0.1f, 0.9f);
+
+            alpha.h     = randf(0.0f, 1.0f);
+            alpha.s     = randf(0.0f, 1.0f);
+            alpha.l     = randf(0.0f, 1.0f);
+            alpha.a     = 0.0f;
+
+            sat.h       = randf(0.0f, 1.0f);
+            sat.s       = randf(0.0f, 1.0f);
+            sat.l       = randf(0.0f, 1.0f);
+            sat.a       = 0.0f;
+            sat.thresh  = randf(0.1f, 0.9f);
+
+            light.h     = randf(0.0f, 1.0f);
+            light.s     = randf(0.0f, 1.0f);
+            light.l     = randf(0.0f, 1.0f);
+            light.a     = 0.0f;
+            light.thresh= randf(0.1f, 0.9f);
+
+            call("generic::eff_hsla_hue_bgra32", 16, generic::eff_hsla_hue, generic::eff_hsla_hue_bgra32, &hue);
+            call("generic::eff_hsla_sat_bgra32", 16, generic::eff_hsla_sat, generic::eff_hsla_sat_bgra32, &sat);
+            call("generic::eff_hsla_light_bgra32", 16, generic::eff_hsla_light, generic::eff_hsla_light_bgra32, &light);
+            call("generic::eff_hsla_alpha_bgra32", 16, generic::eff_hsla_alpha, generic::eff_hsla_alpha_bgra32, &alpha);
+
+            IF_ARCH_X86(call("sse2::eff_hsla_hue_bgra32", 16, generic::eff_hsla_hue, sse2::eff_hsla_hue_bgra32, &hue));
+            IF_ARCH_X86(call("sse2::eff_hsla_sat_bgra32", 16, generic::eff_hsla_sat, sse2::eff_hsla_sat_bgra32, &sat));
+            IF_ARCH_X86(call("sse2::eff_hsla_light_bgra32", 16, generic::eff_hsla_light, sse2::eff_hsla_light_bgra32, &light));
+            IF_ARCH_X86(call("sse2::eff_hsla_alpha_bgra32", 16, generic::eff_hsla_alpha, sse2::eff_hsla_alpha_bgra32, &alpha));
+
+            IF_ARCH_X86(call("avx2::eff_hsla_hue_bgra32", 32, generic::eff_hsla_hue, avx2::eff_hsla_hue_bgra32, &hue));
+            IF_ARCH_X86(call("avx2::eff_hsla_sat_bgra32", 32, generic::eff_hsla_sat, avx2::eff_hsla_sat_bgra32, &sat));
+            IF_ARCH_X86(call("avx2::eff_hsla_light_bgra32", 32, generic::eff_hsla_light, avx2::eff_hsla_light_bgra32, &light));
+            IF_ARCH_X86(call("avx2::eff_hsla_alpha_bgra32", 32, generic::eff_hsla_alpha, avx2::eff_hsla_alpha_bgra32, &alpha));
+
+            IF_ARCH_AARCH64(call("asimd::eff_hsla_hue_bgra32", 16, generic::eff_hsla_hue, asimd::eff_hsla_hue_bgra32, &hue));
+            IF_ARCH_AARCH64(call("asimd::eff_hsla_sat_bgra32", 16, generic::eff_hsla_sat, asimd::eff_hsla_sat_bgra32, &sat));
+            IF_ARCH_AARCH64(call("asimd::eff_hsla_light_bgra32", 16, generic::eff_hsla_light, asimd::eff_hsla_light_bgra32, &light));
+            IF_ARCH_AARCH64(call("asimd::eff_hsla_alpha_bgra32", 16, generic::eff_hsla_alpha, asimd::eff_hsla_alpha_bgra32, &alpha));
+        }
+    }
+
+UTEST_END;
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <float.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+        }
+
+        namespace avx2
+        {
+            void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void spectrogram_bgra32(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+        }
+    )
+
+    typedef void (* spectrogram_bgra32_t)(void *dst, const float *src, const void *lut, float dbmin, float dbmax, size_t count);
+}
+
+namespace
+{
+    size_t spectrogram_index(float v, float dbmin, float dbmax)
+    {
+        v           = fabsf(v);
+        if (!(v >= FLT_MIN))
+            v           = FLT_MIN;
+        double x    = 255.0 * (20.0 * log10(double(v)) - dbmin) / (dbmax - dbmin) + 0.5;
+        if (x <= 0.0)
+            return 0;
+        return (x >= 255.0) ? 255 : size_t(x);
+    }
+}
+
+UTEST_BEGIN("dsp.graphics", spectrogram_bgra32)
+
+    void call(const char *label, size_t align, spectrogram_bgra32_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        // Each colormap entry stores the own index in all channels
+        uint32_t lut[256];
+        for (size_t i=0; i<256; ++i)
+            lut[i]      = uint32_t(i) * 0x01010101;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33,
+                64, 65, 100, 768, 999, 1024, 0x1fff)
+        {
+            for (size_t mask=0; mask <= 0x03; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer src(count, align, mask & 0x01);
+                FloatBuffer dst(count, align, mask & 0x02);
+
+                // Generate magnitudes in range of -180 .. +20 dB including special values
+                float *s    = src.data();
+                for (size_t i=0; i<count; ++i)
+                {
+                    float v     = expf(randf(-9.0f, 1.0f) * M_LN10);
+                    switch (i % 16)
+                    {
+                        case 3: v       = 0.0f; break;
+                        case 7: v       = FLT_MIN * 0.25f; break;
+                        case 11: v      = NAN; break;
+                        case 13: v      = INFINITY; break;
+                        default: break;
+                    }
+                    s[i]        = (i & 1) ? -v : v;
+                }
+
+                float ranges[] = { -120.0f, 0.0f, -72.0f, 12.0f, -30.0f, -20.0f };
+                for (size_t j=0; j<sizeof(ranges)/sizeof(float); j += 2)
+                {
+                    float dbmin     = ranges[j];
+                    float dbmax     = ranges[j+1];
+                    dst.fill_zero();
+                    func(dst.data(), src, lut, dbmin, dbmax, count);
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+
+                    const uint32_t *d   = dst.data<uint32_t>();
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        size_t index    = spectrogram_index(s[i], dbmin, dbmax);
+                        size_t value    = d[i] & 0xff;
+                        size_t diff     = (value > index) ? value - index : index - value;
+                        if ((d[i] != lut[value]) || (diff > 1))
+                        {
+                            src.dump("src");
+                            UTEST_FAIL_MSG("Invalid pixel 0x%08x at index %d for value %g in range [%.1f, %.1f], expected index %d",
+                                    int(d[i]), int(i), s[i], dbmin, dbmax, int(index));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, align) \
+            call(#func, align, func)
+
+        CALL(generic::spectrogram_bgra32, 16);
+        IF_ARCH_X86(CALL(sse2::spectrogram_bgra32, 16));
+        IF_ARCH_X86(CALL(avx2::spectrogram_bgra32, 32));
+        IF_ARCH_AARCH64(CALL(asimd::spectrogram_bgra32, 16));
+    }
+
+UTEST_END;
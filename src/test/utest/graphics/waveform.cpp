@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <algorithm>
+
+#define TOLERANCE       1e-4f
+
+UTEST_BEGIN("dsp.graphics", waveform)
+
+    void summary(dsp::waveform_peak_t *v, const float *src, size_t first, size_t last)
+    {
+        v->min      = src[first];
+        v->max      = src[first];
+        v->sqr      = 0.0f;
+        for (size_t i=first; i<last; ++i)
+        {
+            v->min      = std::min(v->min, src[i]);
+            v->max      = std::max(v->max, src[i]);
+            v->sqr     += src[i] * src[i];
+        }
+    }
+
+    void check_levels(const dsp::waveform_mipmap_t *m, const dsp::waveform_peak_t *data, const float *src)
+    {
+        dsp::waveform_peak_t v;
+
+        for (size_t l=0; l<m->levels; ++l)
+        {
+            size_t k        = m->shift + l;
+            size_t n        = ((m->count - 1) >> k) + 1;
+            const dsp::waveform_peak_t *p = &data[m->offset[l]];
+
+            for (size_t i=0; i<n; ++i)
+            {
+                size_t last     = std::min((i + 1) << k, size_t(m->count));
+                summary(&v, src, i << k, last);
+
+                UTEST_ASSERT_MSG((p[i].min == v.min) && (p[i].max == v.max),
+                    "Level %d, entry %d: min/max mismatch {%f, %f} vs {%f, %f}",
+                    int(l), int(i), p[i].min, p[i].max, v.min, v.max);
+                UTEST_ASSERT_MSG(float_equals_adaptive(p[i].sqr, v.sqr, TOLERANCE),
+                    "Level %d, entry %d: sum of squares mismatch %f vs %f",
+                    int(l), int(i), p[i].sqr, v.sqr);
+            }
+        }
+    }
+
+    void check_query(const dsp::waveform_mipmap_t *m, const dsp::waveform_peak_t *data, const float *src,
+            size_t first, float step, size_t count, bool raw)
+    {
+        printf("Testing query first=%d, step=%.3f, columns=%d, raw=%s\n",
+                int(first), step, int(count), (raw) ? "true" : "false");
+
+        FloatBuffer vmin(count);
+        FloatBuffer vmax(count);
+        FloatBuffer vrms(count);
+        dsp::waveform_peak_t v;
+
+        dsp::waveform_mipmap_query(vmin, vmax, vrms, m, data, (raw) ? src : NULL, first, step, count);
+        UTEST_ASSERT(vmin.valid());
+        UTEST_ASSERT(vmax.valid());
+        UTEST_ASSERT(vrms.valid());
+
+        // Compute the block size of the level selected by the query
+        size_t k        = m->shift;
+        if ((raw) && (step < float(size_t(1) << k)))
+            k               = 0;
+        else
+        {
+            for (size_t l=1; l<m->levels; ++l)
+                if (float(size_t(1) << (m->shift + l)) <= step)
+                    k               = m->shift + l;
+        }
+
+        for (size_t c=0; c<count; ++c)
+        {
+            size_t s0       = first + size_t(double(c) * step);
+            size_t s1       = first + size_t(double(c + 1) * step);
+            if (s0 >= m->count)
+            {
+                UTEST_ASSERT_MSG((vmin[c] == 0.0f) && (vmax[c] == 0.0f) && (vrms[c] == 0.0f),
+                        "Column %d beyond the data is not zero", int(c));
+                continue;
+            }
+            s1              = std::max(s1, s0 + 1);
+            s1              = std::min(s1, size_t(m->count));
+
+            // Align the range to the entries
+            s0              = (s0 >> k) << k;
+            s1              = std::min((((s1 - 1) >> k) + 1) << k, size_t(m->count));
+            summary(&v, src, s0, s1);
+
+            float r         = sqrtf(v.sqr / (s1 - s0));
+            UTEST_ASSERT_MSG((vmin[c] == v.min) && (vmax[c] == v.max),
+                    "Column %d: min/max mismatch {%f, %f} vs {%f, %f}",
+                    int(c), vmin[c], vmax[c], v.min, v.max);
+            UTEST_ASSERT_MSG(float_equals_adaptive(vrms[c], r, TOLERANCE),
+                    "Column %d: RMS mismatch %f vs %f", int(c), vrms[c], r);
+        }
+    }
+
+    void call(size_t capacity, size_t samples, size_t shift)
+    {
+        printf("Testing waveform mipmap capacity=%d, samples=%d, shift=%d\n",
+                int(capacity), int(samples), int(shift));
+
+        dsp::waveform_mipmap_t m;
+        size_t n    = dsp::waveform_mipmap_init(&m, capacity, shift);
+        UTEST_ASSERT(n > 0);
+        UTEST_ASSERT(m.levels > 0);
+        UTEST_ASSERT(m.offset[m.levels - 1] == n - 1);
+
+        FloatBuffer src(samples);
+        FloatBuffer data(n * 3);
+        src.randomize_sign();
+        dsp::waveform_peak_t *peaks = data.data<dsp::waveform_peak_t>();
+
+        // Append the signal by portions of random size
+        size_t off  = 0;
+        while (off < samples)
+        {
+            size_t k    = std::min(size_t(randf(1.0f, 5000.0f)), samples - off);
+            size_t r    = dsp::waveform_mipmap_append(&m, peaks, src.data(off), k);
+            UTEST_ASSERT(r == ((off < capacity) ? std::min(k, capacity - off) : 0));
+            off        += k;
+        }
+        UTEST_ASSERT(data.valid());
+        UTEST_ASSERT(m.count == std::min(samples, capacity));
+        if (m.count >= capacity)
+            UTEST_ASSERT(dsp::waveform_mipmap_append(&m, peaks, src, 1) == 0);
+
+        check_levels(&m, peaks, src);
+
+        check_query(&m, peaks, src, 0, float(m.count) / 640.0f, 640, false);
+        check_query(&m, peaks, src, 0, float(m.count) / 333.0f, 400, false);
+        check_query(&m, peaks, src, m.count / 3, 17.3f, 200, false);
+        check_query(&m, peaks, src, m.count / 2, 0.7f, 100, false);
+        check_query(&m, peaks, src, m.count / 2, 0.7f, 100, true);
+        check_query(&m, peaks, src, 7, 2.5f, 100, true);
+        check_query(&m, peaks, src, 1, 1e+9f, 3, false);
+    }
+
+    UTEST_MAIN
+    {
+        dsp::waveform_mipmap_t m;
+        UTEST_ASSERT(dsp::waveform_mipmap_init(&m, 0, 4) == 0);
+        UTEST_ASSERT(dsp::waveform_mipmap_init(&m, 100, 17) == 0);
+        UTEST_ASSERT(dsp::waveform_mipmap_init(&m, 1, 0) == 1);
+        UTEST_ASSERT(m.levels == 1);
+
+        call(1000, 1000, 0);
+        call(1000, 1000, 3);
+        call(1 << 16, 1 << 16, 4);
+        call(100000, 123457, 6);
+        call(300000, 250000, 8);
+        call(1 << 18, 1 << 18, 16);
+    }
+UTEST_END;
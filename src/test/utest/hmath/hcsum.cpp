@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#include <float.h>
+#include <math.h>
+
+// Documented bound of the compensated reduction is 8 * FLT_EPSILON * sum(abs(x)), plus
+// FLT_EPSILON * sum(abs(x)) for the rounding of products in dot product
+#define ERROR_BOUND     (9.0 * FLT_EPSILON)
+
+namespace lsp
+{
+    namespace generic
+    {
+        float h_csum(const float *src, size_t count);
+        float h_sqr_csum(const float *src, size_t count);
+        float h_abs_csum(const float *src, size_t count);
+        float h_cdotp(const float *a, const float *b, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            float h_csum(const float *src, size_t count);
+            float h_sqr_csum(const float *src, size_t count);
+            float h_abs_csum(const float *src, size_t count);
+            float h_cdotp(const float *a, const float *b, size_t count);
+        }
+
+        namespace avx
+        {
+            float h_csum(const float *src, size_t count);
+            float h_sqr_csum(const float *src, size_t count);
+            float h_abs_csum(const float *src, size_t count);
+            float h_cdotp(const float *a, const float *b, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            float h_csum(const float *src, size_t count);
+            float h_sqr_csum(const float *src, size_t count);
+            float h_abs_csum(const float *src, size_t count);
+            float h_cdotp(const float *a, const float *b, size_t count);
+        }
+    )
+
+    typedef float (* h_csum_t)(const float *src, size_t count);
+    typedef float (* h_cdotp_t)(const float *a, const float *b, size_t count);
+}
+
+UTEST_BEGIN("dsp.hmath", hcsum)
+
+    void check(const char *label, float res, double ref, double norm, size_t count)
+    {
+        double err      = fabs(double(res) - ref);
+        double bound    = ERROR_BOUND * norm + FLT_MIN;
+        if (err > bound)
+            UTEST_FAIL_MSG("Result of %s on count=%d is %.8f, expected %.8f: error %g exceeds the bound %g",
+                label, int(count), res, ref, err, bound);
+    }
+
+    void call(const char *label, size_t align, h_csum_t func, size_t type)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33,
+                100, 999, 0x1fff, 1000003)
+        {
+            for (size_t mask=0; mask <= 0x01; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer src(count, align, mask & 0x01);
+                float *s = src.data();
+                for (size_t i=0; i<count; ++i)
+                    s[i]        = (type == 0) ? randf(0.5f, 2.0f) : randf(-2.0f, 2.0f);
+
+                double ref = 0.0, norm = 0.0;
+                for (size_t i=0; i<count; ++i)
+                {
+                    double x    = s[i];
+                    x           = (type == 1) ? x * x : (type == 2) ? fabs(x) : x;
+                    ref        += x;
+                    norm       += fabs(x);
+                }
+
+                float res = func(src, count);
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                check(label, res, ref, norm, count);
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, h_cdotp_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33,
+                100, 999, 0x1fff, 1000003)
+        {
+            for (size_t mask=0; mask <= 0x03; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer a(count, align, mask & 0x01);
+                FloatBuffer b(count, align, mask & 0x02);
+                a.randomize_sign();
+                b.randomize(0.5f, 1.0f);
+
+                double ref = 0.0, norm = 0.0;
+                for (size_t i=0; i<count; ++i)
+                {
+                    double x    = double(a[i]) * double(b[i]);
+                    ref        += x;
+                    norm       += fabs(x);
+                }
+
+                float res = func(a, b, count);
+                UTEST_ASSERT_MSG(a.valid(), "Source buffer A corrupted");
+                UTEST_ASSERT_MSG(b.valid(), "Source buffer B corrupted");
+                check(label, res, ref, norm, count);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, align, ...) \
+            call(#func, align, func, ## __VA_ARGS__);
+
+        CALL(generic::h_csum, 16, 0);
+        CALL(generic::h_sqr_csum, 16, 1);
+        CALL(generic::h_abs_csum, 16, 2);
+        CALL(generic::h_cdotp, 16);
+
+        IF_ARCH_X86(CALL(sse::h_csum, 16, 0));
+        IF_ARCH_X86(CALL(sse::h_sqr_csum, 16, 1));
+        IF_ARCH_X86(CALL(sse::h_abs_csum, 16, 2));
+        IF_ARCH_X86(CALL(sse::h_cdotp, 16));
+
+        IF_ARCH_X86(CALL(avx::h_csum, 32, 0));
+        IF_ARCH_X86(CALL(avx::h_sqr_csum, 32, 1));
+        IF_ARCH_X86(CALL(avx::h_abs_csum, 32, 2));
+        IF_ARCH_X86(CALL(avx::h_cdotp, 32));
+
+        IF_ARCH_AARCH64(CALL(asimd::h_csum, 16, 0));
+        IF_ARCH_AARCH64(CALL(asimd::h_sqr_csum, 16, 1));
+        IF_ARCH_AARCH64(CALL(asimd::h_abs_csum, 16, 2));
+        IF_ARCH_AARCH64(CALL(asimd::h_cdotp, 16));
+    }
+UTEST_END
@@ -0,0 +1,348 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#define TOLERANCE       1e-4f
+#define RANK            11
+
+namespace lsp
+{
+    namespace generic
+    {
+        void delay_init(float *buf, dsp::delay_t *d, size_t rank);
+        void delay_write(float *buf, dsp::delay_t *d, const float *src, size_t count);
+        void delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+        void delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+        void delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+        void delay_read_allpass(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, float *state, size_t count);
+        void delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace sse2
+        {
+            void x64_delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count);
+        }
+
+        namespace avx2
+        {
+            void x64_delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void x64_delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void x64_delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void x64_delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void delay_read_linear(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void delay_read_hermite(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void delay_read_lagrange(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+            void delay_read_taps(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count);
+        }
+    )
+
+    typedef void (* delay_read_t)(float *dst, const float *buf, const dsp::delay_t *d, const float *delay, size_t count);
+    typedef void (* delay_taps_t)(float *dst, const float *buf, const dsp::delay_t *d, const dsp::delay_tap_t *taps, size_t ntaps, size_t count);
+}
+
+namespace
+{
+    // Test signals defined over the absolute time
+    float signal_linear(size_t n)
+    {
+        return 0.01f * n - 1.0f;
+    }
+
+    float signal_cubic(size_t n)
+    {
+        float t = 0.01f * n - 1.5f;
+        return t*t*t - t;
+    }
+}
+
+UTEST_BEGIN("dsp.interpolation", delay)
+
+    void check_output(const char *label, FloatBuffer &dst1, FloatBuffer &dst2)
+    {
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1 ");
+            dst2.dump("dst2 ");
+            UTEST_FAIL_MSG("Output of '%s' differs at index %d: %.6f vs %.6f",
+                label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+    }
+
+    // Fill the delay line with the signal by blocks of the specified size
+    void fill(float *buf, dsp::delay_t *d, size_t rank, float (*signal)(size_t n), size_t total, size_t block)
+    {
+        float tmp[64];
+
+        generic::delay_init(buf, d, rank);
+        for (size_t off=0; off < total; off += block)
+        {
+            size_t n = (total - off < block) ? total - off : block;
+            for (size_t i=0; i<n; ++i)
+                tmp[i]      = signal(off + i);
+            generic::delay_write(buf, d, tmp, n);
+        }
+    }
+
+    void check_reference()
+    {
+        const size_t rank = 6, block = 37;
+        const size_t size = 1 << rank;
+        dsp::delay_t d;
+        FloatBuffer buf(size + LSP_DSP_DELAY_GUARD);
+        FloatBuffer delay(block);
+        FloatBuffer ref(block);
+        FloatBuffer dst(block);
+        float state;
+
+        printf("Testing reference delay line implementation\n");
+
+        // Check the guard zone after wrapping the ring several times
+        fill(buf, &d, rank, signal_cubic, 5*block, block);
+        UTEST_ASSERT(d.head == 5*block);
+        size_t start = d.head - block;
+        for (size_t i=0; i<LSP_DSP_DELAY_GUARD; ++i)
+            UTEST_ASSERT_MSG(buf[size + i] == buf[i], "Guard zone differs at index %d", int(i));
+
+        // Integer delays should return exact samples of the signal
+        for (size_t i=0; i<block; ++i)
+        {
+            delay[i]    = 2 + (i * 7) % (size - block - 4);
+            ref[i]      = signal_cubic(start + i - size_t(delay[i]));
+        }
+
+        generic::delay_read_linear(dst, buf, &d, delay, block);
+        check_output("generic::delay_read_linear", ref, dst);
+        generic::delay_read_hermite(dst, buf, &d, delay, block);
+        check_output("generic::delay_read_hermite", ref, dst);
+        generic::delay_read_lagrange(dst, buf, &d, delay, block);
+        check_output("generic::delay_read_lagrange", ref, dst);
+        state = 0.0f;
+        generic::delay_read_allpass(dst, buf, &d, delay, &state, block);
+        check_output("generic::delay_read_allpass", ref, dst);
+
+        // Fractional delays: all interpolators are exact for the linear signal,
+        // lagrange interpolation is also exact for the cubic signal
+        for (size_t i=0; i<block; ++i)
+            delay[i]    = 2.0f + ((i * 13) % (size - block - 4)) + (i % 8) * 0.125f;
+
+        fill(buf, &d, rank, signal_linear, 4*block + 5, block);
+        start = d.head - block;
+        for (size_t i=0; i<block; ++i)
+            ref[i]      = 0.01f * (start + i - delay[i]) - 1.0f;
+
+        generic::delay_read_linear(dst, buf, &d, delay, block);
+        check_output("generic::delay_read_linear", ref, dst);
+        generic::delay_read_hermite(dst, buf, &d, delay, block);
+        check_output("generic::delay_read_hermite", ref, dst);
+        generic::delay_read_lagrange(dst, buf, &d, delay, block);
+        check_output("generic::delay_read_lagrange", ref, dst);
+
+        fill(buf, &d, rank, signal_cubic, 4*block + 5, block);
+        start = d.head - block;
+        for (size_t i=0; i<block; ++i)
+        {
+            float t     = 0.01f * (start + i - delay[i]) - 1.5f;
+            ref[i]      = t*t*t - t;
+        }
+        generic::delay_read_lagrange(dst, buf, &d, delay, block);
+        check_output("generic::delay_read_lagrange", ref, dst);
+
+        // Single tap should match the read with the constant delay
+        static const dsp::delay_interp_t interp[] = { dsp::DELAY_LINEAR, dsp::DELAY_HERMITE, dsp::DELAY_LAGRANGE };
+        static const delay_read_t read[] = { generic::delay_read_linear, generic::delay_read_hermite, generic::delay_read_lagrange };
+        for (size_t k=0; k<3; ++k)
+        {
+            dsp::delay_tap_t tap;
+            tap.delay   = 7.375f;
+            tap.gain    = 1.0f;
+            tap.interp  = interp[k];
+
+            for (size_t i=0; i<block; ++i)
+                delay[i]    = tap.delay;
+            read[k](ref, buf, &d, delay, block);
+            generic::delay_read_taps(dst, buf, &d, &tap, 1, block);
+            check_output("generic::delay_read_taps", ref, dst);
+        }
+    }
+
+    void check_small_ring()
+    {
+        const size_t rank = 2;
+        const size_t size = 1 << rank;
+        dsp::delay_t d;
+        FloatBuffer buf(size + LSP_DSP_DELAY_GUARD);
+        FloatBuffer delay(1);
+        FloatBuffer ref(1);
+        FloatBuffer dst(1);
+
+        UTEST_FOREACH(block, 1, 2, 3, 5, 7, 17)
+        {
+            printf("Testing delay line of rank %d on blocks of %d samples\n", int(rank), int(block));
+
+            // The ring is shorter than the guard zone and should be repeated in it
+            fill(buf, &d, rank, signal_cubic, 11*block + 3, block);
+            for (size_t i=0; i<LSP_DSP_DELAY_GUARD; ++i)
+                UTEST_ASSERT_MSG(buf[size + i] == buf[i & (size - 1)], "Guard zone differs at index %d", int(i));
+            UTEST_ASSERT_MSG(buf.valid(), "Delay line buffer corrupted");
+
+            delay[0]    = 1.0f;
+            ref[0]      = signal_cubic(d.head - 2);
+            generic::delay_read_linear(dst, buf, &d, delay, 1);
+            check_output("generic::delay_read_linear", ref, dst);
+        }
+    }
+
+    void init_delay_line(FloatBuffer &buf, dsp::delay_t *d, size_t count)
+    {
+        generic::delay_init(buf, d, RANK);
+
+        // Wrap the ring at least once
+        FloatBuffer src((1 << RANK) + 117);
+        src.randomize_sign();
+        generic::delay_write(buf, d, src, src.size());
+        src.randomize_sign();
+        generic::delay_write(buf, d, src, count);
+    }
+
+    void call(const char *label, size_t align, delay_read_t func1, delay_read_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                32, 64, 65, 100, 127, 999)
+        {
+            for (size_t mask=0; mask <= 0x03; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                dsp::delay_t d;
+                FloatBuffer buf((1 << RANK) + LSP_DSP_DELAY_GUARD);
+                init_delay_line(buf, &d, count);
+
+                FloatBuffer delay(count, align, mask & 0x01);
+                FloatBuffer dst1(count, align, mask & 0x02);
+                for (size_t i=0; i<count; ++i)
+                    delay[i]        = 2.0f + (float(rand()) / RAND_MAX) * 1000.0f;
+                dst1.randomize_sign();
+                FloatBuffer dst2(dst1);
+
+                func1(dst1, buf, &d, delay, count);
+                func2(dst2, buf, &d, delay, count);
+
+                UTEST_ASSERT_MSG(buf.valid(), "Delay line buffer corrupted");
+                UTEST_ASSERT_MSG(delay.valid(), "Delay buffer corrupted");
+                check_output(label, dst1, dst2);
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, delay_taps_t func1, delay_taps_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                32, 64, 65, 100, 127, 999)
+        {
+            UTEST_FOREACH(ntaps, 0, 1, 3, 16, 17, 40)
+            {
+                printf("Testing %s on input buffer of %d numbers, %d taps...\n", label, int(count), int(ntaps));
+
+                dsp::delay_t d;
+                FloatBuffer buf((1 << RANK) + LSP_DSP_DELAY_GUARD);
+                init_delay_line(buf, &d, count);
+
+                dsp::delay_tap_t taps[40];
+                for (size_t i=0; i<ntaps; ++i)
+                {
+                    taps[i].delay   = 2.0f + (float(rand()) / RAND_MAX) * 1000.0f;
+                    taps[i].gain    = (float(rand()) / RAND_MAX) * 2.0f - 1.0f;
+                    taps[i].interp  = i % 3;
+                }
+
+                FloatBuffer dst1(count, align, false);
+                dst1.randomize_sign();
+                FloatBuffer dst2(dst1);
+
+                func1(dst1, buf, &d, taps, ntaps, count);
+                func2(dst2, buf, &d, taps, ntaps, count);
+
+                UTEST_ASSERT_MSG(buf.valid(), "Delay line buffer corrupted");
+                check_output(label, dst1, dst2);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_reference();
+        check_small_ring();
+
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func)
+
+        IF_ARCH_X86(CALL(generic::delay_read_linear, sse2::delay_read_linear, 16));
+        IF_ARCH_X86(CALL(generic::delay_read_hermite, sse2::delay_read_hermite, 16));
+        IF_ARCH_X86(CALL(generic::delay_read_lagrange, sse2::delay_read_lagrange, 16));
+        IF_ARCH_X86_64(CALL(generic::delay_read_taps, sse2::x64_delay_read_taps, 16));
+
+        IF_ARCH_X86_64(CALL(generic::delay_read_linear, avx2::x64_delay_read_linear, 32));
+        IF_ARCH_X86_64(CALL(generic::delay_read_hermite, avx2::x64_delay_read_hermite, 32));
+        IF_ARCH_X86_64(CALL(generic::delay_read_lagrange, avx2::x64_delay_read_lagrange, 32));
+        IF_ARCH_X86_64(CALL(generic::delay_read_taps, avx2::x64_delay_read_taps, 32));
+
+        IF_ARCH_AARCH64(CALL(generic::delay_read_linear, asimd::delay_read_linear, 16));
+        IF_ARCH_AARCH64(CALL(generic::delay_read_hermite, asimd::delay_read_hermite, 16));
+        IF_ARCH_AARCH64(CALL(generic::delay_read_lagrange, asimd::delay_read_lagrange, 16));
+        IF_ARCH_AARCH64(CALL(generic::delay_read_taps, asimd::delay_read_taps, 16));
+    }
+
+UTEST_END;
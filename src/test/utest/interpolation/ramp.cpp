@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#define TOLERANCE       1e-4f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void ramp_set(float *dst, dsp::ramp_t *r, size_t count);
+        void ramp_mul2(float *dst, dsp::ramp_t *r, size_t count);
+        void ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+        void ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+        void smooth_cubic_linear(float *dst, float start, float stop, size_t count);
+        void smooth_cubic_log(float *dst, float start, float stop, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void ramp_set(float *dst, dsp::ramp_t *r, size_t count);
+            void ramp_mul2(float *dst, dsp::ramp_t *r, size_t count);
+            void ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+            void ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+            void smooth_cubic_linear(float *dst, float start, float stop, size_t count);
+            void smooth_cubic_log(float *dst, float start, float stop, size_t count);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace avx2
+        {
+            void x64_ramp_set(float *dst, dsp::ramp_t *r, size_t count);
+            void x64_ramp_mul2(float *dst, dsp::ramp_t *r, size_t count);
+            void x64_ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+            void x64_ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+            void x64_smooth_cubic_linear(float *dst, float start, float stop, size_t count);
+            void x64_smooth_cubic_log(float *dst, float start, float stop, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void ramp_set(float *dst, dsp::ramp_t *r, size_t count);
+            void ramp_mul2(float *dst, dsp::ramp_t *r, size_t count);
+            void ramp_mul3(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+            void ramp_fmadd2(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+            void smooth_cubic_linear(float *dst, float start, float stop, size_t count);
+            void smooth_cubic_log(float *dst, float start, float stop, size_t count);
+        }
+    )
+
+    typedef void (* ramp1_t)(float *dst, dsp::ramp_t *r, size_t count);
+    typedef void (* ramp2_t)(float *dst, const float *src, dsp::ramp_t *r, size_t count);
+    typedef void (* smooth_t)(float *dst, float start, float stop, size_t count);
+}
+
+namespace
+{
+    // Reference value of the ramp computed with double precision
+    double ramp_value(const lsp::dsp::ramp_t *r, size_t pos)
+    {
+        if (pos >= r->length)
+            return r->stop;
+
+        double x    = double(pos) / double(r->length);
+        double s    = x*x * (3.0 - 2.0*x);
+        bool log    = r->start * r->stop > 0.0f;
+
+        switch (r->shape)
+        {
+            case lsp::dsp::RAMP_CUBIC:
+                return r->start + (double(r->stop) - r->start) * s;
+            case lsp::dsp::RAMP_EXP:
+                if (log)
+                    return r->start * pow(double(r->stop) / r->start, x);
+                break;
+            case lsp::dsp::RAMP_LOG:
+                if (log)
+                    return r->start * pow(double(r->stop) / r->start, s);
+                return r->start + (double(r->stop) - r->start) * s;
+            default:
+                break;
+        }
+
+        return r->start + (double(r->stop) - r->start) * x;
+    }
+
+    const float ramp_ranges[] =
+    {
+        0.1f, 2.0f,
+        2.0f, 0.001f,
+        -3.0f, -0.5f,
+        1.0f, -1.0f,
+        0.0f, 1.0f
+    };
+}
+
+UTEST_BEGIN("dsp.interpolation", ramp)
+
+    void init_ramp(dsp::ramp_t *r, size_t shape, size_t range, size_t length)
+    {
+        r->start        = ramp_ranges[range*2];
+        r->stop         = ramp_ranges[range*2 + 1];
+        r->shape        = shape;
+        r->length       = length;
+        r->offset       = 0;
+    }
+
+    void compare(const char *label, FloatBuffer &dst1, FloatBuffer &dst2, const dsp::ramp_t *r1, const dsp::ramp_t *r2)
+    {
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        UTEST_ASSERT_MSG(r1->offset == r2->offset, "Ramp offsets differ: %d vs %d", int(r1->offset), int(r2->offset));
+
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1 ");
+            dst2.dump("dst2 ");
+            UTEST_FAIL_MSG("Output of '%s' differs at index %d: %.6f vs %.6f",
+                label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+    }
+
+    // Check the generic implementation against the double-precision reference
+    void check_reference()
+    {
+        for (size_t shape=dsp::RAMP_LINEAR; shape<=dsp::RAMP_LOG; ++shape)
+            for (size_t range=0; range < sizeof(ramp_ranges)/(2*sizeof(float)); ++range)
+            {
+                printf("Testing reference ramp shape=%d range=%d\n", int(shape), int(range));
+
+                size_t count = 1000;
+                dsp::ramp_t r;
+                init_ramp(&r, shape, range, 700);
+
+                FloatBuffer dst1(count);
+                FloatBuffer dst2(count);
+
+                for (size_t i=0; i<count; ++i)
+                    dst1[i]     = ramp_value(&r, i);
+                for (size_t off=0; off < count; off += 37)
+                    generic::ramp_set(dst2.data(off), &r, (count - off < 37) ? count - off : 37);
+
+                compare("generic::ramp_set", dst1, dst2, &r, &r);
+                UTEST_ASSERT(r.offset == r.length);
+            }
+    }
+
+    void call(const char *label, size_t align, ramp1_t func1, ramp1_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                32, 64, 65, 100, 127, 999, 0xfff)
+        {
+            for (size_t mask=0; mask <= 0x01; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                for (size_t shape=dsp::RAMP_LINEAR; shape<=dsp::RAMP_LOG; ++shape)
+                    for (size_t range=0; range < sizeof(ramp_ranges)/(2*sizeof(float)); ++range)
+                    {
+                        dsp::ramp_t r1, r2;
+                        init_ramp(&r1, shape, range, (count * 2) / 3 + 1);
+                        init_ramp(&r2, shape, range, (count * 2) / 3 + 1);
+
+                        FloatBuffer dst1(count, align, mask & 0x01);
+                        dst1.randomize_sign();
+                        FloatBuffer dst2(dst1);
+
+                        // Process the ramp by two portions
+                        size_t half = count / 2;
+                        func1(dst1, &r1, half);
+                        func1(dst1.data(half), &r1, count - half);
+                        func2(dst2, &r2, half);
+                        func2(dst2.data(half), &r2, count - half);
+
+                        compare(label, dst1, dst2, &r1, &r2);
+                    }
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, ramp2_t func1, ramp2_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                32, 64, 65, 100, 127, 999, 0xfff)
+        {
+            for (size_t mask=0; mask <= 0x03; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                for (size_t shape=dsp::RAMP_LINEAR; shape<=dsp::RAMP_LOG; ++shape)
+                    for (size_t range=0; range < sizeof(ramp_ranges)/(2*sizeof(float)); ++range)
+                    {
+                        dsp::ramp_t r1, r2;
+                        init_ramp(&r1, shape, range, (count * 2) / 3 + 1);
+                        init_ramp(&r2, shape, range, (count * 2) / 3 + 1);
+
+                        FloatBuffer src(count, align, mask & 0x01);
+                        FloatBuffer dst1(count, align, mask & 0x02);
+                        src.randomize_sign();
+                        dst1.randomize_sign();
+                        FloatBuffer dst2(dst1);
+
+                        // Process the ramp by two portions
+                        size_t half = count / 2;
+                        func1(dst1, src, &r1, half);
+                        func1(dst1.data(half), src.data(half), &r1, count - half);
+                        func2(dst2, src, &r2, half);
+                        func2(dst2.data(half), src.data(half), &r2, count - half);
+
+                        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                        compare(label, dst1, dst2, &r1, &r2);
+                    }
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, smooth_t func1, smooth_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                32, 64, 65, 100, 127, 999, 0xfff)
+        {
+            printf("Testing %s on input buffer of %d numbers...\n", label, int(count));
+
+            for (size_t range=0; range < sizeof(ramp_ranges)/(2*sizeof(float)); ++range)
+            {
+                float start     = ramp_ranges[range*2];
+                float stop      = ramp_ranges[range*2 + 1];
+
+                FloatBuffer dst1(count, align, false);
+                FloatBuffer dst2(dst1);
+
+                func1(dst1, start, stop, count);
+                func2(dst2, start, stop, count);
+
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    dst1.dump("dst1 ");
+                    dst2.dump("dst2 ");
+                    UTEST_FAIL_MSG("Output of '%s' for range %.3f..%.3f differs at index %d: %.6f vs %.6f",
+                        label, start, stop, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_reference();
+
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func)
+
+        IF_ARCH_X86(CALL(generic::ramp_set, sse2::ramp_set, 16));
+        IF_ARCH_X86(CALL(generic::ramp_mul2, sse2::ramp_mul2, 16));
+        IF_ARCH_X86(CALL(generic::ramp_mul3, sse2::ramp_mul3, 16));
+        IF_ARCH_X86(CALL(generic::ramp_fmadd2, sse2::ramp_fmadd2, 16));
+        IF_ARCH_X86(CALL(generic::smooth_cubic_linear, sse2::smooth_cubic_linear, 16));
+        IF_ARCH_X86(CALL(generic::smooth_cubic_log, sse2::smooth_cubic_log, 16));
+
+        IF_ARCH_X86_64(CALL(generic::ramp_set, avx2::x64_ramp_set, 32));
+        IF_ARCH_X86_64(CALL(generic::ramp_mul2, avx2::x64_ramp_mul2, 32));
+        IF_ARCH_X86_64(CALL(generic::ramp_mul3, avx2::x64_ramp_mul3, 32));
+        IF_ARCH_X86_64(CALL(generic::ramp_fmadd2, avx2::x64_ramp_fmadd2, 32));
+        IF_ARCH_X86_64(CALL(generic::smooth_cubic_linear, avx2::x64_smooth_cubic_linear, 32));
+        IF_ARCH_X86_64(CALL(generic::smooth_cubic_log, avx2::x64_smooth_cubic_log, 32));
+
+        IF_ARCH_AARCH64(CALL(generic::ramp_set, asimd::ramp_set, 16));
+        IF_ARCH_AARCH64(CALL(generic::ramp_mul2, asimd::ramp_mul2, 16));
+        IF_ARCH_AARCH64(CALL(generic::ramp_mul3, asimd::ramp_mul3, 16));
+        IF_ARCH_AARCH64(CALL(generic::ramp_fmadd2, asimd::ramp_fmadd2, 16));
+        IF_ARCH_AARCH64(CALL(generic::smooth_cubic_linear, asimd::smooth_cubic_linear, 16));
+        IF_ARCH_AARCH64(CALL(generic::smooth_cubic_log, asimd::smooth_cubic_log, 16));
+    }
+
+UTEST_END;
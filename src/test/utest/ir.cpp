@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-4f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void ir_kernel_init(float *kernel);
+        void ir_bin_taps(dsp::ir_tap_t *dst, const dsp::ir_tap_t *src, uint32_t *bins, size_t count, size_t length);
+        void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length);
+        }
+
+        namespace avx
+        {
+            void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void ir_render_taps(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length);
+        }
+    )
+
+    typedef void (* ir_render_taps_t)(float *dst, const dsp::ir_tap_t *taps, const float *kernel, size_t count, size_t length);
+}
+
+UTEST_BEGIN("dsp", ir)
+
+    void call(const char *label, const float *kernel, ir_render_taps_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(length, 1, 2, 3, 5, 8, 13, 16, 64, 100, 999, 0x1000)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 5, 16, 100, 1000)
+            {
+                for (size_t mask=0; mask <= 0x01; ++mask)
+                {
+                    printf("Testing %s on %d taps, length=%d, mask=0x%x...\n",
+                        label, int(count), int(length), int(mask));
+
+                    // Generate taps that also cover both edges of the buffer
+                    FloatBuffer taps(count * 2);
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        taps[i*2]       = randf(-6.0f, length + 6.0f);
+                        taps[i*2+1]     = randf(-1.0f, 1.0f);
+                    }
+                    const dsp::ir_tap_t *vt = reinterpret_cast<const dsp::ir_tap_t *>(taps.data());
+
+                    FloatBuffer dst1(length, 16, mask & 0x01);
+                    dst1.randomize_sign();
+                    FloatBuffer dst2(dst1);
+
+                    generic::ir_render_taps(dst1, vt, kernel, count, length);
+                    func(dst2, vt, kernel, count, length);
+
+                    UTEST_ASSERT_MSG(taps.valid(), "Taps buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                                label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                    }
+                }
+            }
+        }
+    }
+
+    void check_kernel(const float *kernel)
+    {
+        dsp::ir_tap_t t;
+        FloatBuffer dst(32);
+
+        // The tap at the integer position should give the unit impulse
+        t.position      = 10.0f;
+        t.gain          = 0.5f;
+        dst.fill_zero();
+        generic::ir_render_taps(dst, &t, kernel, 1, 32);
+        for (size_t i=0; i<32; ++i)
+            UTEST_ASSERT_MSG(fabsf(dst[i] - ((i == 10) ? 0.5f : 0.0f)) < 1e-6f,
+                "Invalid sample %d of integer tap: %.6f", int(i), dst[i]);
+
+        // Fractional taps should keep the DC gain, the half-sample tap should be symmetric
+        for (size_t i=0; i<=32; ++i)
+        {
+            t.position      = 10.0f + i / 32.0f;
+            t.gain          = 1.0f;
+            dst.fill_zero();
+            generic::ir_render_taps(dst, &t, kernel, 1, 32);
+
+            float sum       = 0.0f;
+            for (size_t j=0; j<32; ++j)
+                sum            += dst[j];
+            UTEST_ASSERT_MSG(fabsf(sum - 1.0f) < 1e-5f,
+                "Invalid DC gain of the tap at %.4f: %.6f", t.position, sum);
+        }
+
+        t.position      = 10.5f;
+        t.gain          = 1.0f;
+        dst.fill_zero();
+        generic::ir_render_taps(dst, &t, kernel, 1, 32);
+        for (size_t i=0; i<4; ++i)
+            UTEST_ASSERT_MSG(fabsf(dst[10 - i] - dst[11 + i]) < 1e-6f,
+                "Asymmetric half-sample tap at offset %d: %.6f vs %.6f", int(i), dst[10 - i], dst[11 + i]);
+        UTEST_ASSERT_MSG(dst[10] > 0.5f, "Too low value of half-sample tap: %.6f", dst[10]);
+    }
+
+    void check_non_finite(const char *label, const float *kernel, ir_render_taps_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s on non-finite tap positions...\n", label);
+
+        // Only the last tap touches the buffer, all others should be skipped
+        dsp::ir_tap_t t[5];
+        t[0].position   = NAN;
+        t[1].position   = -NAN;
+        t[2].position   = +INFINITY;
+        t[3].position   = -INFINITY;
+        t[4].position   = 10.0f;
+        for (size_t i=0; i<5; ++i)
+            t[i].gain       = 1.0f;
+
+        FloatBuffer dst(32);
+        dst.fill_zero();
+        func(dst, t, kernel, 5, 32);
+
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        for (size_t i=0; i<32; ++i)
+            UTEST_ASSERT_MSG(fabsf(dst[i] - ((i == 10) ? 1.0f : 0.0f)) < 1e-6f,
+                "Invalid sample %d of %s: %.6f", int(i), label, dst[i]);
+    }
+
+    size_t tap_position(const dsp::ir_tap_t *t, size_t length)
+    {
+        if (t->position <= 0.0f)
+            return 0;
+        return (t->position < length) ? size_t(t->position) : length;
+    }
+
+    void check_binning()
+    {
+        size_t length   = 10000;
+        size_t count    = 5000;
+        size_t block    = 1 << LSP_DSP_IR_BLOCK_RANK;
+        size_t nbins    = ((length + block - 1) / block) + 1;
+
+        FloatBuffer src(count * 2), dst(count * 2);
+        uint32_t *bins  = new uint32_t[nbins];
+        for (size_t i=0; i<count; ++i)
+        {
+            src[i*2]        = randf(-10.0f, length + 10.0f);
+            src[i*2+1]      = i;        // Original index to check the stability
+        }
+
+        const dsp::ir_tap_t *vs = reinterpret_cast<const dsp::ir_tap_t *>(src.data());
+        dsp::ir_tap_t *vd       = reinterpret_cast<dsp::ir_tap_t *>(dst.data());
+        generic::ir_bin_taps(vd, vs, bins, count, length);
+        UTEST_ASSERT_MSG(src.valid(), "Source taps corrupted");
+        UTEST_ASSERT_MSG(dst.valid(), "Destination taps corrupted");
+
+        for (size_t i=1; i<count; ++i)
+        {
+            size_t b0       = tap_position(&vd[i-1], length) / block;
+            size_t b1       = tap_position(&vd[i], length) / block;
+
+            UTEST_ASSERT_MSG(b0 <= b1, "Taps %d and %d are not sorted by blocks: %.3f, %.3f",
+                int(i-1), int(i), vd[i-1].position, vd[i].position);
+            if (b0 == b1)
+                UTEST_ASSERT_MSG(vd[i-1].gain < vd[i].gain, "Order of taps %d and %d in block is not preserved",
+                    int(i-1), int(i));
+        }
+
+        delete [] bins;
+    }
+
+    UTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *kernel   = alloc_aligned<float>(data, LSP_DSP_IR_KERNEL_SIZE, 32);
+        UTEST_ASSERT(kernel != NULL);
+        generic::ir_kernel_init(kernel);
+
+        check_kernel(kernel);
+        check_binning();
+        check_non_finite("generic::ir_render_taps", kernel, generic::ir_render_taps);
+        IF_ARCH_X86(check_non_finite("sse::ir_render_taps", kernel, sse::ir_render_taps));
+        IF_ARCH_X86(check_non_finite("avx::ir_render_taps", kernel, avx::ir_render_taps));
+        IF_ARCH_AARCH64(check_non_finite("asimd::ir_render_taps", kernel, asimd::ir_render_taps));
+
+        IF_ARCH_X86(call("sse::ir_render_taps", kernel, sse::ir_render_taps));
+        IF_ARCH_X86(call("avx::ir_render_taps", kernel, avx::ir_render_taps));
+        IF_ARCH_AARCH64(call("asimd::ir_render_taps", kernel, asimd::ir_render_taps));
+
+        free_aligned(data);
+    }
+UTEST_END
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#define TOLERANCE       1e-4f
+#define SAMPLE_RATE     48000
+#define MAX_CHANNELS    LSP_DSP_LOUDNESS_MAX_CHANNELS
+
+namespace lsp
+{
+    namespace generic
+    {
+        void loudness_init(dsp::loudness_t *l, size_t channels, size_t sample_rate);
+        void loudness_accumulate(dsp::loudness_t *l, const float **src, size_t count);
+        void loudness_process(dsp::loudness_t *l, const float **src, size_t count);
+        float loudness_momentary(const dsp::loudness_t *l);
+        float loudness_short_term(const dsp::loudness_t *l);
+        float loudness_integrated(const dsp::loudness_t *l);
+        float loudness_range(const dsp::loudness_t *l);
+    }
+
+    IF_ARCH_X86_64(
+        namespace sse3
+        {
+            void x64_loudness_accumulate(dsp::loudness_t *l, const float **src, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void loudness_accumulate(dsp::loudness_t *l, const float **src, size_t count);
+        }
+    )
+
+    typedef void (* loudness_accumulate_t)(dsp::loudness_t *l, const float **src, size_t count);
+}
+
+UTEST_BEGIN("dsp", loudness)
+
+    // Feed the meter with a stereo 997 Hz sine wave of the specified level in dBFS
+    void feed_sine(dsp::loudness_t *l, float *buf, float level, float seconds)
+    {
+        float amp           = powf(10.0f, level / 20.0f);
+        float w             = 2.0f * M_PI * 997.0f / SAMPLE_RATE;
+        size_t total        = seconds * SAMPLE_RATE;
+        const float *vs[2]  = { buf, buf };
+
+        // Use odd-sized chunks to exercise the sub-block splitting
+        for (size_t off=0; off < total; )
+        {
+            size_t to_do        = total - off;
+            if (to_do > 1234)
+                to_do               = 1234;
+            for (size_t i=0; i<to_do; ++i)
+                buf[i]              = amp * sinf(w * (off + i));
+            generic::loudness_process(l, vs, to_do);
+            off                += to_do;
+        }
+    }
+
+    void check_value(const char *label, float value, float expected, float tolerance)
+    {
+        printf("  %s = %.3f (expected %.3f)\n", label, value, expected);
+        UTEST_ASSERT_MSG(fabsf(value - expected) <= tolerance,
+            "%s = %.3f, expected %.3f +/- %.2f", label, value, expected, tolerance);
+    }
+
+    // Check the meter against the EBU Tech 3341 and Tech 3342 test cases
+    void check_reference()
+    {
+        FloatBuffer buf(1234);
+        dsp::loudness_t l;
+
+        printf("Testing silence\n");
+        generic::loudness_init(&l, 2, SAMPLE_RATE);
+        check_value("integrated", generic::loudness_integrated(&l), LSP_DSP_LOUDNESS_SILENCE, 0.0f);
+        check_value("range", generic::loudness_range(&l), 0.0f, 0.0f);
+
+        printf("Testing stereo sine wave at -23 dBFS\n");
+        generic::loudness_init(&l, 2, SAMPLE_RATE);
+        feed_sine(&l, buf, -23.0f, 20.0f);
+        check_value("momentary", generic::loudness_momentary(&l), -23.0f, 0.1f);
+        check_value("short-term", generic::loudness_short_term(&l), -23.0f, 0.1f);
+        check_value("integrated", generic::loudness_integrated(&l), -23.0f, 0.1f);
+
+        printf("Testing relative gate: -36, -23, -36 dBFS\n");
+        generic::loudness_init(&l, 2, SAMPLE_RATE);
+        feed_sine(&l, buf, -36.0f, 10.0f);
+        feed_sine(&l, buf, -23.0f, 60.0f);
+        feed_sine(&l, buf, -36.0f, 10.0f);
+        check_value("integrated", generic::loudness_integrated(&l), -23.0f, 0.1f);
+
+        printf("Testing absolute gate: -72, -26, -72 dBFS\n");
+        generic::loudness_init(&l, 2, SAMPLE_RATE);
+        feed_sine(&l, buf, -72.0f, 10.0f);
+        feed_sine(&l, buf, -26.0f, 60.0f);
+        feed_sine(&l, buf, -72.0f, 10.0f);
+        check_value("integrated", generic::loudness_integrated(&l), -26.0f, 0.1f);
+
+        printf("Testing loudness range: -20, -30 dBFS\n");
+        generic::loudness_init(&l, 2, SAMPLE_RATE);
+        feed_sine(&l, buf, -20.0f, 20.0f);
+        feed_sine(&l, buf, -30.0f, 20.0f);
+        check_value("range", generic::loudness_range(&l), 10.0f, 1.0f);
+
+        printf("Testing loudness range: -20, -15 dBFS\n");
+        generic::loudness_init(&l, 2, SAMPLE_RATE);
+        feed_sine(&l, buf, -20.0f, 20.0f);
+        feed_sine(&l, buf, -15.0f, 20.0f);
+        check_value("range", generic::loudness_range(&l), 5.0f, 1.0f);
+    }
+
+    void call(const char *label, size_t align, loudness_accumulate_t func1, loudness_accumulate_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(channels, 1, 2, 3, 4, 5, 6, 7, 8)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                    32, 64, 65, 100, 127, 999, 0xfff)
+            {
+                for (size_t mask=0; mask <= 0x01; ++mask)
+                {
+                    printf("Testing %s on %d channels of %d numbers, mask=0x%x...\n",
+                        label, int(channels), int(count), int(mask));
+
+                    FloatBuffer *src[MAX_CHANNELS];
+                    const float *vs[MAX_CHANNELS];
+                    dsp::loudness_t l1, l2;
+
+                    for (size_t i=0; i<channels; ++i)
+                    {
+                        src[i]          = new FloatBuffer(count, align, mask & 0x01);
+                        src[i]->randomize_sign();
+                        vs[i]           = src[i]->data();
+                    }
+                    generic::loudness_init(&l1, channels, SAMPLE_RATE);
+                    generic::loudness_init(&l2, channels, SAMPLE_RATE);
+
+                    // Process the signal by two portions to check the state
+                    size_t half = count / 2;
+                    func1(&l1, vs, half);
+                    func2(&l2, vs, half);
+                    for (size_t i=0; i<channels; ++i)
+                        vs[i]          += half;
+                    func1(&l1, vs, count - half);
+                    func2(&l2, vs, count - half);
+
+                    for (size_t i=0; i<channels; ++i)
+                    {
+                        UTEST_ASSERT_MSG(src[i]->valid(), "Source buffer corrupted");
+                        UTEST_ASSERT_MSG(float_equals_adaptive(l1.ms[i], l2.ms[i], TOLERANCE),
+                            "Mean square of channel %d differs: %.6f vs %.6f",
+                            int(i), l1.ms[i], l2.ms[i]);
+                        for (size_t j=0; j<4; ++j)
+                        {
+                            float d1        = l1.d[i + j*MAX_CHANNELS];
+                            float d2        = l2.d[i + j*MAX_CHANNELS];
+                            UTEST_ASSERT_MSG(float_equals_adaptive(d1, d2, TOLERANCE),
+                                "Filter state %d of channel %d differs: %.6f vs %.6f",
+                                int(j), int(i), d1, d2);
+                        }
+                    }
+
+                    for (size_t i=0; i<channels; ++i)
+                        delete src[i];
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_reference();
+
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func)
+
+        IF_ARCH_X86_64(CALL(generic::loudness_accumulate, sse3::x64_loudness_accumulate, 16));
+
+        IF_ARCH_AARCH64(CALL(generic::loudness_accumulate, asimd::loudness_accumulate, 16));
+    }
+
+UTEST_END;
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-5f
+#define STAT_SAMPLES    0x10000
+
+namespace lsp
+{
+    namespace generic
+    {
+        void noise_init(dsp::noise_t *n, uint32_t seed);
+        void noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count);
+        void noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count);
+        void noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count);
+        void noise_pink(float *dst, dsp::noise_t *n, float k, size_t count);
+    }
+
+    IF_ARCH_X86_64(
+        namespace sse2
+        {
+            void x64_noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count);
+            void x64_noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count);
+            void x64_noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count);
+        }
+
+        namespace avx2
+        {
+            void x64_noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count);
+            void x64_noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count);
+            void x64_noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void noise_uniform(float *dst, dsp::noise_t *n, float k, size_t count);
+            void noise_tpdf(float *dst, dsp::noise_t *n, float k, size_t count);
+            void noise_gaussian(float *dst, dsp::noise_t *n, float s, size_t count);
+        }
+    )
+
+    typedef void (* noise_func_t)(float *dst, dsp::noise_t *n, float k, size_t count);
+}
+
+UTEST_BEGIN("dsp", noise)
+
+    void check_stats(const char *label, noise_func_t func, float k, float var, float tolerance, float max)
+    {
+        dsp::noise_t n;
+        FloatBuffer dst(STAT_SAMPLES);
+
+        printf("Testing statistics of %s\n", label);
+        generic::noise_init(&n, 1);
+        func(dst, &n, k, STAT_SAMPLES);
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+
+        double sum = 0.0, sum2 = 0.0;
+        for (size_t i=0; i<STAT_SAMPLES; ++i)
+        {
+            UTEST_ASSERT_MSG((dst[i] >= -max) && (dst[i] < max),
+                "%s: sample %d = %.6f is out of range [%.6f, %.6f)", label, int(i), dst[i], -max, max);
+            sum        += dst[i];
+            sum2       += dst[i] * dst[i];
+        }
+        double mean = sum / STAT_SAMPLES;
+        double dev  = sum2 / STAT_SAMPLES - mean * mean;
+
+        UTEST_ASSERT_MSG(fabs(mean) <= tolerance * sqrt(var), "%s: mean = %.6f, expected 0", label, mean);
+        UTEST_ASSERT_MSG(fabs(dev - var) <= tolerance * var, "%s: variance = %.6f, expected %.6f", label, dev, var);
+    }
+
+    void check_generators()
+    {
+        check_stats("uniform", generic::noise_uniform, 1.0f, 1.0f / 3.0f, 0.02f, 1.0f);
+        check_stats("tpdf", generic::noise_tpdf, 0.5f, 0.25f / 6.0f, 0.02f, 0.5f);
+        check_stats("gaussian", generic::noise_gaussian, 2.0f, 4.0f, 0.02f, 4.0f * sqrtf(3.0f));
+        check_stats("pink", generic::noise_pink, 1.0f, 1.0f / 3.0f, 0.3f, sqrtf(LSP_DSP_NOISE_PINK_ROWS + 1));
+
+        printf("Testing spectrum of pink noise\n");
+        dsp::noise_t n;
+        FloatBuffer white(STAT_SAMPLES), pink(STAT_SAMPLES);
+        generic::noise_init(&n, 2);
+        generic::noise_uniform(white, &n, 1.0f, STAT_SAMPLES);
+        generic::noise_pink(pink, &n, 1.0f, STAT_SAMPLES);
+
+        // The first difference emphasizes high frequencies: it doubles the power of
+        // the white noise and removes most of the power of the pink noise
+        double pw = 0.0, dw = 0.0, pp = 0.0, dp = 0.0;
+        for (size_t i=1; i<STAT_SAMPLES; ++i)
+        {
+            pw     += white[i] * white[i];
+            dw     += (white[i] - white[i-1]) * (white[i] - white[i-1]);
+            pp     += pink[i] * pink[i];
+            dp     += (pink[i] - pink[i-1]) * (pink[i] - pink[i-1]);
+        }
+        UTEST_ASSERT_MSG(fabs(dw / pw - 2.0) < 0.05, "White noise is not white: ratio = %.4f", dw / pw);
+        UTEST_ASSERT_MSG(dp / pp < 0.5, "Pink noise is not pink: ratio = %.4f", dp / pp);
+    }
+
+    void check_reproducibility()
+    {
+        printf("Testing reproducibility\n");
+        dsp::noise_t n1, n2;
+        FloatBuffer dst1(1000), dst2(1000);
+
+        generic::noise_init(&n1, 12345);
+        generic::noise_init(&n2, 12345);
+        generic::noise_pink(dst1, &n1, 1.0f, 1000);
+        generic::noise_pink(dst2, &n2, 1.0f, 1000);
+        UTEST_ASSERT_MSG(dst1.equals_absolute(dst2, 0.0f), "Generators with the same seed differ");
+
+        generic::noise_init(&n2, 12346);
+        generic::noise_pink(dst2, &n2, 1.0f, 1000);
+        size_t equal = 0;
+        for (size_t i=0; i<1000; ++i)
+            if (dst1[i] == dst2[i])
+                ++equal;
+        UTEST_ASSERT_MSG(equal < 10, "Generators with different seeds produce the same noise");
+    }
+
+    void call(const char *label, size_t align, noise_func_t func1, noise_func_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                24, 32, 40, 48, 56, 64, 65, 100, 127, 999, 0xfff)
+        {
+            for (size_t mask=0; mask <= 0x01; ++mask)
+            {
+                printf("Testing %s on %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                dsp::noise_t n1, n2;
+                generic::noise_init(&n1, uint32_t(count));
+                generic::noise_init(&n2, uint32_t(count));
+
+                FloatBuffer dst1(count * 2, align, mask & 0x01);
+                FloatBuffer dst2(dst1);
+
+                // Two calls to check that the state is passed between calls
+                func1(dst1, &n1, 0.5f, count);
+                func1(&dst1[count], &n1, 0.5f, count);
+                func2(dst2, &n2, 0.5f, count);
+                func2(&dst2[count], &n2, 0.5f, count);
+
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+                UTEST_ASSERT_MSG(memcmp(&n1, &n2, sizeof(dsp::noise_t)) == 0,
+                        "State of generators for test '%s' differs", label);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_generators();
+        check_reproducibility();
+
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func)
+
+        IF_ARCH_X86_64(CALL(generic::noise_uniform, sse2::x64_noise_uniform, 16));
+        IF_ARCH_X86_64(CALL(generic::noise_tpdf, sse2::x64_noise_tpdf, 16));
+        IF_ARCH_X86_64(CALL(generic::noise_gaussian, sse2::x64_noise_gaussian, 16));
+
+        IF_ARCH_X86_64(CALL(generic::noise_uniform, avx2::x64_noise_uniform, 32));
+        IF_ARCH_X86_64(CALL(generic::noise_tpdf, avx2::x64_noise_tpdf, 32));
+        IF_ARCH_X86_64(CALL(generic::noise_gaussian, avx2::x64_noise_gaussian, 32));
+
+        IF_ARCH_AARCH64(CALL(generic::noise_uniform, asimd::noise_uniform, 16));
+        IF_ARCH_AARCH64(CALL(generic::noise_tpdf, asimd::noise_tpdf, 16));
+        IF_ARCH_AARCH64(CALL(generic::noise_gaussian, asimd::noise_gaussian, 16));
+    }
+
+UTEST_END;
@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <string.h>
+
+#define CHANNELS        24
+#define TOLERANCE       1e-4f
+
+namespace lsp
+{
+    typedef void (* op2_t)(float *dst, const float *src, size_t count);
+    typedef void (* op3_t)(float *dst, const float *src1, const float *src2, size_t count);
+    typedef void (* op4_t)(float *dst, const float *a, const float *b, const float *c, size_t count);
+}
+
+UTEST_BEGIN("dsp", parallel)
+
+    void check(const char *label, FloatBuffer &dst1, FloatBuffer &dst2, size_t count)
+    {
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        if (memcmp(dst1.data(), dst2.data(), count * sizeof(float)) != 0)
+        {
+            dst1.equals_absolute(dst2, 0.0f);
+            UTEST_FAIL_MSG("Output of '%s' is not bit-exact at sample %d: %.8f vs %.8f",
+                    label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+    }
+
+    void call(const char *label, size_t count, op2_t func, op2_t mt)
+    {
+        printf("Testing %s on count=%d...\n", label, int(count));
+
+        FloatBuffer src(count);
+        FloatBuffer dst1(count);
+        src.randomize(0.5f, 2.0f);
+        dst1.randomize(0.5f, 2.0f);
+        FloatBuffer dst2(dst1);
+
+        func(dst1, src, count);
+        mt(dst2, src, count);
+        check(label, dst1, dst2, count);
+    }
+
+    void call(const char *label, size_t count, op3_t func, op3_t mt)
+    {
+        printf("Testing %s on count=%d...\n", label, int(count));
+
+        FloatBuffer src1(count);
+        FloatBuffer src2(count);
+        FloatBuffer dst1(count);
+        src1.randomize(0.5f, 2.0f);
+        src2.randomize(0.5f, 2.0f);
+        dst1.randomize(0.5f, 2.0f);
+        FloatBuffer dst2(dst1);
+
+        func(dst1, src1, src2, count);
+        mt(dst2, src1, src2, count);
+        check(label, dst1, dst2, count);
+    }
+
+    void call(const char *label, size_t count, op4_t func, op4_t mt)
+    {
+        printf("Testing %s on count=%d...\n", label, int(count));
+
+        FloatBuffer a(count);
+        FloatBuffer b(count);
+        FloatBuffer c(count);
+        FloatBuffer dst1(count);
+        a.randomize_sign();
+        b.randomize_sign();
+        c.randomize_sign();
+        dst1.randomize_sign();
+        FloatBuffer dst2(dst1);
+
+        func(dst1, a, b, c, count);
+        mt(dst2, a, b, c, count);
+        check(label, dst1, dst2, count);
+    }
+
+    void test_fft(size_t rank, size_t channels)
+    {
+        printf("Testing direct_fft_batch_mt on rank=%d, channels=%d...\n", int(rank), int(channels));
+
+        size_t n = 1 << rank;
+        float **dst_re          = new float *[channels];
+        float **dst_im          = new float *[channels];
+        const float **src_re    = new const float *[channels];
+        const float **src_im    = new const float *[channels];
+
+        FloatBuffer src(channels * n * 2);
+        FloatBuffer dst1(channels * n * 2);
+        FloatBuffer dst2(channels * n * 2);
+        src.randomize_sign();
+
+        for (size_t j=0; j<channels; ++j)
+        {
+            src_re[j]   = src.data(j * n * 2);
+            src_im[j]   = &src_re[j][n];
+            dst_re[j]   = dst1.data(j * n * 2);
+            dst_im[j]   = &dst_re[j][n];
+        }
+        dsp::direct_fft_batch(dst_re, dst_im, src_re, src_im, rank, channels);
+
+        for (size_t j=0; j<channels; ++j)
+        {
+            dst_re[j]   = dst2.data(j * n * 2);
+            dst_im[j]   = &dst_re[j][n];
+        }
+        dsp::direct_fft_batch_mt(dst_re, dst_im, src_re, src_im, rank, channels);
+
+        delete [] dst_re;
+        delete [] dst_im;
+        delete [] src_re;
+        delete [] src_im;
+
+        check("direct_fft_batch_mt", dst1, dst2, channels * n * 2);
+    }
+
+    void test_fastconv(size_t rank, size_t count)
+    {
+        printf("Testing fastconv_convolve_mt on rank=%d, count=%d...\n", int(rank), int(count));
+
+        size_t half = 1 << (rank - 1);
+        size_t ir   = half - 3;
+
+        FloatBuffer src(count);
+        FloatBuffer conv(half);
+        FloatBuffer c(half * 4);
+        FloatBuffer tmp(half * 4);
+        FloatBuffer buf(half * 3);
+        FloatBuffer dst1(count + half);
+        FloatBuffer dst2(count + half);
+        FloatBuffer dst3(count + half);
+
+        src.randomize_sign();
+        conv.randomize_sign();
+        dsp::fill_zero(conv.data(ir), half - ir);
+        dsp::fastconv_parse(c, conv, rank);
+
+        // Reference: sequential processing of blocks
+        size_t off  = 0;
+        dst1.fill_zero();
+        for ( ; off + half <= count; off += half)
+            dsp::fastconv_parse_apply(dst1.data(off), tmp, c, src.data(off), rank);
+        if (off < count)
+        {
+            buf.fill_zero();
+            dsp::copy(buf, src.data(off), count - off);
+            dsp::fastconv_parse_apply(buf.data(half), tmp, c, buf, rank);
+            dsp::add2(dst1.data(off), buf.data(half), count - off + half);
+        }
+
+        // Direct convolution
+        dst3.fill_zero();
+        dsp::convolve(dst3, src, conv, ir, count);
+
+        dsp::fastconv_convolve_mt(dst2, c, src, rank, count);
+
+        check("fastconv_convolve_mt", dst1, dst2, count + half);
+        if (!dst3.equals_adaptive(dst2, TOLERANCE))
+            UTEST_FAIL_MSG("Output of fastconv_convolve_mt differs from direct convolution at sample %d: %.6f vs %.6f",
+                    int(dst3.last_diff()), dst3.get_diff(), dst2.get_diff());
+    }
+
+    void test_bound_box(size_t count)
+    {
+        printf("Testing calc_bound_box_mt on count=%d...\n", int(count));
+
+        dsp::point3d_t *p   = new dsp::point3d_t[count];
+        for (size_t i=0; i<count; ++i)
+            dsp::init_point_xyz(&p[i], randf(-10.0f, 10.0f), randf(-10.0f, 10.0f), randf(-10.0f, 10.0f));
+
+        dsp::bound_box3d_t b1, b2;
+        dsp::calc_bound_box(&b1, p, count);
+        dsp::calc_bound_box_mt(&b2, p, count);
+        delete [] p;
+
+        UTEST_ASSERT_MSG(memcmp(&b1, &b2, sizeof(dsp::bound_box3d_t)) == 0, "Bounding boxes differ");
+    }
+
+    void test_restart(size_t count)
+    {
+        printf("Testing job submission right after set_threads(), count=%d...\n", int(count));
+
+        FloatBuffer src(count);
+        FloatBuffer base(count);
+        src.randomize(0.5f, 2.0f);
+        base.randomize(0.5f, 2.0f);
+        FloatBuffer dst1(base);
+        FloatBuffer dst2(base);
+        dsp::add2(dst1, src, count);
+
+        // Workers may not be scheduled yet when the job is submitted
+        for (size_t i=0; i<50; ++i)
+        {
+            size_t threads = (i & 1) ? 8 : 3;
+            UTEST_ASSERT(dsp::set_threads(threads) == threads);
+
+            dst2.copy(base);
+            dsp::add2_mt(dst2, src, count);
+            check("add2_mt", dst1, dst2, count);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        size_t cpus = dsp::set_threads(0);
+        printf("Number of available threads: %d\n", int(cpus));
+
+        UTEST_FOREACH(threads, 1, 2, 3, 4, 8)
+        {
+            size_t n = dsp::set_threads(threads);
+            UTEST_ASSERT(n == threads);
+            UTEST_ASSERT(dsp::get_threads() == threads);
+            printf("Testing with %d threads\n", int(n));
+
+            UTEST_FOREACH(count, 0, 1, 17, 0x4000, 0x4001, 0x4000 * 7 + 13, 0x40000 + 0x1f)
+            {
+                #define CALL(func) \
+                    call(#func "_mt", count, dsp::func, dsp::func##_mt)
+
+                CALL(add2);
+                CALL(sub2);
+                CALL(mul2);
+                CALL(div2);
+                CALL(add3);
+                CALL(sub3);
+                CALL(mul3);
+                CALL(div3);
+                CALL(fmadd3);
+                CALL(fmadd4);
+
+                #undef CALL
+            }
+
+            UTEST_FOREACH(rank, 0, 3, 8, 12)
+            {
+                // The chunk holds 0x4000 samples, test also batches that span several chunks
+                test_fft(rank, CHANNELS);
+                test_fft(rank, (0x4000 >> rank) * 3 + 1);
+            }
+
+            UTEST_FOREACH(count, 0, 1, 100, 0x1000, 0x10000 + 123)
+            {
+                test_fastconv(8, count);
+                test_fastconv(10, count);
+            }
+
+            UTEST_FOREACH(count, 1, 100, 0x1000, 0x10000 + 17, 0x80000 + 1)
+                test_bound_box(count);
+        }
+
+        test_restart(0x100000);
+
+        UTEST_ASSERT(dsp::set_threads(1) == 1);
+    }
+UTEST_END;
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-4f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void halfband_init(dsp::halfband_t *f, float transition);
+        void halfband_reset(dsp::halfband_t *f);
+        void halfband_upsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+        void halfband_downsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void halfband_upsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+            void halfband_downsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void halfband_upsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+            void halfband_downsample_2x(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+        }
+    )
+
+    typedef void (* halfband_process_t)(float *dst, const float *src, size_t count, dsp::halfband_t *f);
+}
+
+UTEST_BEGIN("dsp.resampling", halfband)
+
+    void call(const char *label, size_t align, size_t times,
+            halfband_process_t func1, halfband_process_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        dsp::halfband_t f1, f2;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0x1f, 0x40, 0x1ff)
+        {
+            for (size_t mask=0; mask <= 0x03; ++mask)
+            {
+                printf("Testing %s on input buffer size=%d, mask=0x%x...\n", label, int(count), int(mask));
+
+                size_t src_count    = (times > 1) ? count : count*2;
+                size_t dst_count    = (times > 1) ? count*2 : count;
+
+                FloatBuffer src(src_count, align, mask & 0x01);
+                FloatBuffer dst1(dst_count, align, mask & 0x02);
+                FloatBuffer dst2(dst1);
+                src.randomize_sign();
+
+                // Process data in two calls to check that the state is saved properly
+                generic::halfband_init(&f1, 0.05f);
+                f2          = f1;
+                size_t half = count >> 1;
+                size_t rest = count - half;
+                size_t s1   = (times > 1) ? 1 : 2;
+                size_t d1   = (times > 1) ? 2 : 1;
+
+                func1(dst1, src, half, &f1);
+                func1(dst1.data(half * d1), src.data(half * s1), rest, &f1);
+                func2(dst2, src, half, &f2);
+                func2(dst2.data(half * d1), src.data(half * s1), rest, &f2);
+
+                // Perform validation
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+
+                for (size_t i=0; i<LSP_DSP_HALFBAND_ITEMS; ++i)
+                {
+                    UTEST_ASSERT_MSG(float_equals_adaptive(f1.x[i], f2.x[i], TOLERANCE), "Input memory differs at index %d", int(i));
+                    UTEST_ASSERT_MSG(float_equals_adaptive(f1.y[i], f2.y[i], TOLERANCE), "Output memory differs at index %d", int(i));
+                }
+            }
+        }
+    }
+
+    float tone_level(float freq)
+    {
+        // Feed the sine wave to the 2x downsampler and measure the RMS level after the filter settles
+        size_t count = 0x800;
+        FloatBuffer src(count * 2);
+        FloatBuffer dst(count);
+        dsp::halfband_t f;
+
+        for (size_t i=0; i<count*2; ++i)
+            src[i]      = sin(2.0 * M_PI * freq * i);
+
+        generic::halfband_init(&f, 0.05f);
+        generic::halfband_downsample_2x(dst, src, count, &f);
+
+        double rms  = 0.0;
+        for (size_t i=count/2; i<count; ++i)
+            rms        += dst[i] * dst[i];
+
+        return sqrt(rms * 4.0 / count);
+    }
+
+    UTEST_MAIN
+    {
+        // Check the frequency response of the designed filter
+        float pass  = tone_level(0.1f);
+        float stop  = tone_level(0.35f);
+        printf("Passband level: %.6f, stopband level: %.6f\n", pass, stop);
+        UTEST_ASSERT_MSG(fabsf(pass - 1.0f) < 1e-3f, "Passband level is too far from 1: %f", pass);
+        UTEST_ASSERT_MSG(stop < 1e-4f, "Stopband level is too high: %f", stop);
+
+        #define CALL(func1, func2, align, times) \
+            call(#func2, align, times, func1, func2)
+
+        IF_ARCH_X86(CALL(generic::halfband_upsample_2x, sse::halfband_upsample_2x, 16, 2));
+        IF_ARCH_X86(CALL(generic::halfband_downsample_2x, sse::halfband_downsample_2x, 16, 1));
+
+        IF_ARCH_AARCH64(CALL(generic::halfband_upsample_2x, asimd::halfband_upsample_2x, 16, 2));
+        IF_ARCH_AARCH64(CALL(generic::halfband_downsample_2x, asimd::halfband_downsample_2x, 16, 1));
+    }
+UTEST_END;
@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-4f
+#define CURVE_SIZE      257
+
+namespace lsp
+{
+    namespace generic
+    {
+        void shaper_init(float *buf, dsp::shaper_t *s, const float *curve, size_t size, float xmin, float xmax);
+        void shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+        void shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+        void shaper_oversampled(float *dst, const float *src, float *tmp,
+                const float *buf, const dsp::shaper_t *s, size_t interp, size_t factor,
+                dsp::halfband_t *up, dsp::halfband_t *down, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+            void shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace avx2
+        {
+            void x64_shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+            void x64_shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void shaper_linear(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+            void shaper_cubic(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+        }
+    )
+
+    typedef void (* shaper_func_t)(float *dst, const float *src, const float *buf, const dsp::shaper_t *s, size_t count);
+}
+
+UTEST_BEGIN("dsp", shaper)
+
+    void init_tanh(float *buf, dsp::shaper_t *s)
+    {
+        float curve[CURVE_SIZE];
+        for (size_t i=0; i<CURVE_SIZE; ++i)
+            curve[i]        = tanhf(-3.0f + 6.0f * i / (CURVE_SIZE - 1));
+        generic::shaper_init(buf, s, curve, CURVE_SIZE, -3.0f, 3.0f);
+    }
+
+    void check_value(const char *label, float x, float value, float expected, float tolerance)
+    {
+        UTEST_ASSERT_MSG(fabsf(value - expected) <= tolerance,
+            "%s: f(%.4f) = %.6f, expected %.6f", label, x, value, expected);
+    }
+
+    void check_reference()
+    {
+        float buf[CURVE_SIZE + LSP_DSP_SHAPER_GUARD];
+        float src[8], dst[8];
+        dsp::shaper_t s;
+
+        printf("Testing linear curve\n");
+        float line[5]       = { -1.0f, -0.5f, 0.0f, 0.5f, 1.0f };
+        generic::shaper_init(buf, &s, line, 5, -2.0f, 2.0f);
+        for (size_t i=0; i<=40; ++i)
+        {
+            float x         = -2.0f + 0.1f * i;
+            src[0]          = x;
+            generic::shaper_linear(dst, src, buf, &s, 1);
+            check_value("linear", x, dst[0], 0.5f * x, 1e-5f);
+            generic::shaper_cubic(dst, src, buf, &s, 1);
+            check_value("cubic", x, dst[0], 0.5f * x, 1e-5f);
+        }
+
+        printf("Testing clamping of the input\n");
+        src[0]          = -100.0f;
+        src[1]          = 100.0f;
+        src[2]          = -INFINITY;
+        src[3]          = INFINITY;
+        src[4]          = NAN;
+        src[5]          = -2.5f;
+        src[6]          = 2.5f;
+        src[7]          = 2.0f;
+        float expected[8] = { -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f };
+        generic::shaper_linear(dst, src, buf, &s, 8);
+        for (size_t i=0; i<8; ++i)
+            check_value("linear clamp", src[i], dst[i], expected[i], 0.0f);
+        generic::shaper_cubic(dst, src, buf, &s, 8);
+        for (size_t i=0; i<8; ++i)
+            check_value("cubic clamp", src[i], dst[i], expected[i], 0.0f);
+
+        printf("Testing tanh curve\n");
+        init_tanh(buf, &s);
+        for (size_t i=0; i<=600; ++i)
+        {
+            float x         = -3.0f + 0.01f * i;
+            src[0]          = x;
+            generic::shaper_linear(dst, src, buf, &s, 1);
+            check_value("linear tanh", x, dst[0], tanhf(x), 2e-4f);
+            generic::shaper_cubic(dst, src, buf, &s, 1);
+            check_value("cubic tanh", x, dst[0], tanhf(x), 2e-5f);
+        }
+    }
+
+    void check_oversampling()
+    {
+        float buf[CURVE_SIZE + LSP_DSP_SHAPER_GUARD];
+        float line[2]       = { -4.0f, 4.0f };
+        dsp::shaper_t s;
+        dsp::halfband_t up[2], down[2], vup[2], vdown[2];
+        size_t count        = 1000;
+
+        // The identity curve with the range wider than the overshoot of the filters
+        // should make the shaper equivalent to the resampling chain
+        generic::shaper_init(buf, &s, line, 2, -4.0f, 4.0f);
+        FloatBuffer src(count), dst1(count), dst2(count), tmp1(count * 4), tmp2(count * 4);
+        src.randomize_sign();
+
+        generic::shaper_oversampled(dst1, src, tmp1, buf, &s, dsp::SHAPER_LINEAR, 1, NULL, NULL, count);
+        UTEST_ASSERT_MSG(dst1.equals_absolute(src, 1e-6f), "Shaper without oversampling differs from the source");
+
+        for (size_t factor=2; factor<=4; factor <<= 1)
+        {
+            printf("Testing %dx oversampling\n", int(factor));
+            for (size_t i=0; i<2; ++i)
+            {
+                dsp::halfband_init(&up[i], 0.05f);
+                dsp::halfband_init(&down[i], 0.05f);
+                dsp::halfband_init(&vup[i], 0.05f);
+                dsp::halfband_init(&vdown[i], 0.05f);
+            }
+
+            generic::shaper_oversampled(dst1, src, tmp1, buf, &s, dsp::SHAPER_CUBIC, factor, up, down, count);
+            if (factor == 2)
+            {
+                dsp::halfband_upsample_2x(tmp2, src, count, vup);
+                dsp::halfband_downsample_2x(dst2, tmp2, count, vdown);
+            }
+            else
+            {
+                dsp::halfband_upsample_4x(tmp2, src, count, vup);
+                dsp::halfband_downsample_4x(dst2, tmp2, count, vdown);
+            }
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(tmp1.valid(), "Temporary buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer corrupted");
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Oversampled shaper differs at sample %d: %.6f vs %.6f",
+                        int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, shaper_func_t func1, shaper_func_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        float buf[CURVE_SIZE + LSP_DSP_SHAPER_GUARD];
+        dsp::shaper_t s;
+        init_tanh(buf, &s);
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                32, 64, 65, 100, 127, 999, 0xfff)
+        {
+            for (size_t mask=0; mask <= 0x07; ++mask)
+            {
+                printf("Testing %s on %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer src(count, align, mask & 0x01);
+                FloatBuffer dst1(count, align, mask & 0x02);
+                FloatBuffer dst2(dst1);
+
+                // Cover the range of the curve and out-of-range values
+                for (size_t i=0; i<count; ++i)
+                    src[i]          = randf(-4.0f, 4.0f);
+                if ((mask & 0x04) && (count > 0))
+                {
+                    src[0]          = NAN;
+                    src[count - 1]  = INFINITY;
+                    src[count / 2]  = -INFINITY;
+                }
+
+                func1(dst1, src, buf, &s, count);
+                func2(dst2, src, buf, &s, count);
+
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_reference();
+        check_oversampling();
+
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func)
+
+        IF_ARCH_X86(CALL(generic::shaper_linear, sse2::shaper_linear, 16));
+        IF_ARCH_X86(CALL(generic::shaper_cubic, sse2::shaper_cubic, 16));
+
+        IF_ARCH_X86_64(CALL(generic::shaper_linear, avx2::x64_shaper_linear, 32));
+        IF_ARCH_X86_64(CALL(generic::shaper_cubic, avx2::x64_shaper_cubic, 32));
+
+        IF_ARCH_AARCH64(CALL(generic::shaper_linear, asimd::shaper_linear, 16));
+        IF_ARCH_AARCH64(CALL(generic::shaper_cubic, asimd::shaper_cubic, 16));
+    }
+
+UTEST_END;